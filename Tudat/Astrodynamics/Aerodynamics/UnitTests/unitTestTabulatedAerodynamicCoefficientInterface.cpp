@@ -0,0 +1,274 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <random>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedAerodynamicCoefficientInterface.h"
+#include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace aerodynamics;
+using namespace interpolators;
+
+//! Function to create a (non-uniform) grid of independent variables and random force and moment coefficients on it.
+void createTestCoefficientTables(
+        std::vector< std::vector< double > >& independentVariables,
+        boost::multi_array< Eigen::Vector3d, 3 >& forceCoefficients,
+        boost::multi_array< Eigen::Vector3d, 3 >& momentCoefficients )
+{
+    independentVariables.clear( );
+    independentVariables.push_back( { 0.5, 1.0, 2.0, 3.5, 5.0, 10.0 } );
+    independentVariables.push_back( { -0.2, -0.1, 0.0, 0.05, 0.1, 0.2, 0.4 } );
+    independentVariables.push_back( { -0.1, 0.0, 0.1 } );
+
+    std::mt19937 generator( 42 );
+    std::uniform_real_distribution< double > distribution( -1.0, 1.0 );
+
+    forceCoefficients.resize( boost::extents[ 6 ][ 7 ][ 3 ] );
+    momentCoefficients.resize( boost::extents[ 6 ][ 7 ][ 3 ] );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        for( unsigned int j = 0; j < 7; j++ )
+        {
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                for( unsigned int l = 0; l < 3; l++ )
+                {
+                    forceCoefficients[ i ][ j ][ k ]( l ) = distribution( generator );
+                    momentCoefficients[ i ][ j ][ k ]( l ) = distribution( generator );
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_tabulated_aerodynamic_coefficient_interface )
+
+//! Test multi-linear interpolation of coefficients against general multi-linear interpolator, inside and outside of
+//! tabulated domain, for a series of slowly varying and discontinuous independent variables.
+BOOST_AUTO_TEST_CASE( testMultiLinearAerodynamicCoefficientInterpolation )
+{
+    std::vector< std::vector< double > > independentVariables;
+    boost::multi_array< Eigen::Vector3d, 3 > forceCoefficients;
+    boost::multi_array< Eigen::Vector3d, 3 > momentCoefficients;
+    createTestCoefficientTables( independentVariables, forceCoefficients, momentCoefficients );
+
+    // Test different combinations of boundary handling
+    std::vector< std::vector< BoundaryInterpolationType > > boundaryHandlingList;
+    boundaryHandlingList.push_back( std::vector< BoundaryInterpolationType >( 3, use_boundary_value ) );
+    boundaryHandlingList.push_back( std::vector< BoundaryInterpolationType >( 3, extrapolate_at_boundary ) );
+    boundaryHandlingList.push_back( { use_boundary_value, extrapolate_at_boundary, use_boundary_value } );
+
+    std::mt19937 generator( 1 );
+    std::uniform_real_distribution< double > distribution( -0.2, 1.2 );
+    for( unsigned int test = 0; test < boundaryHandlingList.size( ); test++ )
+    {
+        MultiLinearInterpolator< double, Eigen::Vector3d, 3 > forceInterpolator(
+                    independentVariables, forceCoefficients, huntingAlgorithm, boundaryHandlingList.at( test ) );
+        MultiLinearInterpolator< double, Eigen::Vector3d, 3 > momentInterpolator(
+                    independentVariables, momentCoefficients, huntingAlgorithm, boundaryHandlingList.at( test ) );
+        MultiLinearAerodynamicCoefficientInterpolator< 3 > coefficientInterpolator(
+                    independentVariables, forceCoefficients, momentCoefficients, boundaryHandlingList.at( test ) );
+
+        std::vector< double > currentIndependentVariables( 3 );
+        for( unsigned int i = 0; i < 1000; i++ )
+        {
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                // Alternate between random values (up to 20 % outside of grid) and slowly varying values
+                double gridStart = independentVariables.at( j ).front( );
+                double gridLength = independentVariables.at( j ).back( ) - gridStart;
+                if( i % 100 < 50 )
+                {
+                    currentIndependentVariables[ j ] = gridStart + distribution( generator ) * gridLength;
+                }
+                else
+                {
+                    currentIndependentVariables[ j ] = gridStart + gridLength *
+                            ( -0.2 + 1.4 * static_cast< double >( i % 100 - 50 ) / 49.0 );
+                }
+            }
+
+            // Interpolate at exact grid point and upper boundary
+            if( i == 0 )
+            {
+                currentIndependentVariables = { 3.5, 0.05, 0.1 };
+            }
+
+            Eigen::Vector6d expectedCoefficients;
+            expectedCoefficients << forceInterpolator.interpolate( currentIndependentVariables ),
+                    momentInterpolator.interpolate( currentIndependentVariables );
+            Eigen::Vector6d computedCoefficients = coefficientInterpolator.interpolate( currentIndependentVariables );
+
+            for( unsigned int j = 0; j < 6; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( expectedCoefficients( j ) - computedCoefficients( j ) ), 1.0E-12 );
+            }
+        }
+    }
+
+    // Check that unsupported boundary handling and invalid grids are rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        MultiLinearAerodynamicCoefficientInterpolator< 3 > coefficientInterpolator(
+                    independentVariables, forceCoefficients, momentCoefficients,
+                    std::vector< BoundaryInterpolationType >( 3, throw_exception_at_boundary ) );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    isExceptionCaught = false;
+    try
+    {
+        std::vector< std::vector< double > > invalidIndependentVariables = independentVariables;
+        invalidIndependentVariables[ 2 ] = { 0.0 };
+        MultiLinearAerodynamicCoefficientInterpolator< 3 > coefficientInterpolator(
+                    invalidIndependentVariables, forceCoefficients, momentCoefficients );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test tabulated coefficient interface, including control surface increments updated by control surface index.
+BOOST_AUTO_TEST_CASE( testTabulatedAerodynamicCoefficientInterface )
+{
+    std::vector< std::vector< double > > independentVariables;
+    boost::multi_array< Eigen::Vector3d, 3 > forceCoefficients;
+    boost::multi_array< Eigen::Vector3d, 3 > momentCoefficients;
+    createTestCoefficientTables( independentVariables, forceCoefficients, momentCoefficients );
+
+    std::vector< AerodynamicCoefficientsIndependentVariables > independentVariableNames =
+    { mach_number_dependent, angle_of_attack_dependent, angle_of_sideslip_dependent };
+    std::vector< BoundaryInterpolationType > boundaryHandling( 3, use_boundary_value );
+
+    std::shared_ptr< AerodynamicCoefficientInterface > coefficientInterface =
+            std::make_shared< TabulatedAerodynamicCoefficientInterface< 3 > >(
+                independentVariables, forceCoefficients, momentCoefficients, boundaryHandling,
+                2.0, 4.0, 3.0, Eigen::Vector3d::Zero( ), independentVariableNames );
+    MultiLinearAerodynamicCoefficientInterpolator< 3 > coefficientInterpolator(
+                independentVariables, forceCoefficients, momentCoefficients, boundaryHandling );
+
+    // Create two control surfaces, with (tabulated) increments depending on Mach number and deflection.
+    std::map< std::string, std::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > > controlSurfaceInterfaces;
+    std::vector< std::vector< double > > controlSurfaceIndependentVariables =
+    { independentVariables.at( 0 ), independentVariables.at( 1 ), { -0.5, 0.5 } };
+    boost::multi_array< Eigen::Vector3d, 3 > controlSurfaceForceCoefficients( boost::extents[ 6 ][ 7 ][ 2 ] );
+    boost::multi_array< Eigen::Vector3d, 3 > controlSurfaceMomentCoefficients( boost::extents[ 6 ][ 7 ][ 2 ] );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        for( unsigned int j = 0; j < 7; j++ )
+        {
+            for( unsigned int k = 0; k < 2; k++ )
+            {
+                controlSurfaceForceCoefficients[ i ][ j ][ k ] = 0.1 * forceCoefficients[ i ][ j ][ k ];
+                controlSurfaceMomentCoefficients[ i ][ j ][ k ] = -0.2 * momentCoefficients[ i ][ j ][ k ];
+            }
+        }
+    }
+    std::vector< AerodynamicCoefficientsIndependentVariables > controlSurfaceIndependentVariableNames =
+    { mach_number_dependent, angle_of_attack_dependent, control_surface_deflection_dependent };
+    controlSurfaceInterfaces[ "Elevon" ] =
+            std::make_shared< TabulatedControlSurfaceIncrementAerodynamicInterface< 3 > >(
+                controlSurfaceIndependentVariables, controlSurfaceForceCoefficients, controlSurfaceMomentCoefficients,
+                controlSurfaceIndependentVariableNames );
+    controlSurfaceInterfaces[ "Aileron" ] =
+            std::make_shared< TabulatedControlSurfaceIncrementAerodynamicInterface< 3 > >(
+                controlSurfaceIndependentVariables, controlSurfaceForceCoefficients, controlSurfaceForceCoefficients,
+                controlSurfaceIndependentVariableNames );
+    coefficientInterface->setControlSurfaceIncrements( controlSurfaceInterfaces );
+
+    BOOST_CHECK_EQUAL( coefficientInterface->getNumberOfControlSurfaces( ), 2 );
+    BOOST_CHECK_EQUAL( coefficientInterface->getControlSurfaceName( 0 ), "Aileron" );
+    BOOST_CHECK_EQUAL( coefficientInterface->getControlSurfaceName( 1 ), "Elevon" );
+    BOOST_CHECK_EQUAL( coefficientInterface->getControlSurfaceIncrementInterface( 1 ), controlSurfaceInterfaces.at( "Elevon" ) );
+
+    std::vector< double > bodyIndependentVariables = { 2.7, 0.12, -0.03 };
+    std::map< std::string, std::vector< double > > controlSurfaceInputMap;
+    controlSurfaceInputMap[ "Aileron" ] = { 2.7, 0.12, 0.3 };
+    controlSurfaceInputMap[ "Elevon" ] = { 2.7, 0.12, -0.1 };
+    std::vector< std::vector< double > > controlSurfaceInputList =
+    { controlSurfaceInputMap.at( "Aileron" ), controlSurfaceInputMap.at( "Elevon" ) };
+
+    // Check body coefficients without control surfaces
+    coefficientInterface->updateFullCurrentCoefficients( bodyIndependentVariables );
+    Eigen::Vector6d bodyCoefficients = coefficientInterpolator.interpolate( bodyIndependentVariables );
+    Eigen::Vector6d computedCoefficients = coefficientInterface->getCurrentAerodynamicCoefficients( );
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( computedCoefficients( i ) - bodyCoefficients( i ) ), 1.0E-15 );
+    }
+
+    // Check that update by control surface name and index give same results
+    coefficientInterface->updateFullCurrentCoefficients( bodyIndependentVariables, controlSurfaceInputMap );
+    Eigen::Vector6d coefficientsFromMap = coefficientInterface->getCurrentAerodynamicCoefficients( );
+    coefficientInterface->updateFullCurrentCoefficients( bodyIndependentVariables, controlSurfaceInputList );
+    Eigen::Vector6d coefficientsFromList = coefficientInterface->getCurrentAerodynamicCoefficients( );
+
+    Eigen::Vector6d expectedCoefficients = bodyCoefficients;
+    for( auto controlSurfaceIterator : controlSurfaceInterfaces )
+    {
+        controlSurfaceIterator.second->updateCurrentCoefficients(
+                    controlSurfaceInputMap.at( controlSurfaceIterator.first ) );
+        expectedCoefficients += controlSurfaceIterator.second->getCurrentAerodynamicCoefficients( );
+    }
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_EQUAL( coefficientsFromMap( i ), coefficientsFromList( i ) );
+        BOOST_CHECK_SMALL( std::fabs( coefficientsFromList( i ) - expectedCoefficients( i ) ), 1.0E-15 );
+    }
+
+    // Check that inconsistent input is rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        controlSurfaceInputList.pop_back( );
+        coefficientInterface->updateFullCurrentCoefficients( bodyIndependentVariables, controlSurfaceInputList );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    isExceptionCaught = false;
+    try
+    {
+        bodyIndependentVariables.pop_back( );
+        coefficientInterface->updateFullCurrentCoefficients( bodyIndependentVariables );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -185,6 +185,41 @@ public:
         }
     }
 
+    //! Function to update the aerodynamic coefficients of the full body with control surfaces, by control surface index
+    /*!
+     *  Function to update the aerodynamic coefficients of the full body with control surfaces. Contrary to the
+     *  overloaded function taking a map as input, the control surfaces are identified by their index in the list of
+     *  control surfaces (see getControlSurfaceName), so that no lookup by name or copy of the independent variables is
+     *  required. This function is used by the flight conditions during the propagation.
+     *  \param independentVariables Independent variables of force and moment coefficient of body without control surfaces
+     *  \param controlSurfaceIndependentVariables Independent variables of force and moment coefficient of control
+     *  surfaces, with the vector index denoting the index of the control surface.
+     *  \param currentTime Time to which coefficients are to be updated.
+     */
+    void updateFullCurrentCoefficients(
+            const std::vector< double >& independentVariables,
+            std::vector< std::vector< double > >& controlSurfaceIndependentVariables,
+            const double currentTime = TUDAT_NAN )
+    {
+        updateCurrentCoefficients( independentVariables, currentTime );
+
+        if( controlSurfaceIndependentVariables.size( ) != controlSurfaceIncrementInterfaceList_.size( ) )
+        {
+            throw std::runtime_error( "Error when updating coefficients, number of control surface inputs (" +
+                                      std::to_string( controlSurfaceIndependentVariables.size( ) ) +
+                                      ") is inconsistent with number of control surfaces (" +
+                                      std::to_string( controlSurfaceIncrementInterfaceList_.size( ) ) + ")" );
+        }
+
+        for( unsigned int i = 0; i < controlSurfaceIncrementInterfaceList_.size( ); i++ )
+        {
+            controlSurfaceIncrementInterfaceList_[ i ]->updateCurrentCoefficients(
+                        controlSurfaceIndependentVariables[ i ] );
+            currentForceCoefficients_ += controlSurfaceIncrementInterfaceList_[ i ]->getCurrentForceCoefficients( );
+            currentMomentCoefficients_ += controlSurfaceIncrementInterfaceList_[ i ]->getCurrentMomentCoefficients( );
+        }
+    }
+
     //! Pure virtual function for calculating and returning aerodynamic force coefficients
     /*!
      *  Pure virtual function for calculating and returning aerodynamic force coefficients.
@@ -300,6 +335,7 @@ public:
     {
         controlSurfaceIncrementInterfaces_ = controlSurfaceIncrementInterfaces;
         controlSurfaceNames_ = utilities::createVectorFromMapKeys( controlSurfaceIncrementInterfaces_ );
+        controlSurfaceIncrementInterfaceList_ = utilities::createVectorFromMapValues( controlSurfaceIncrementInterfaces_ );
     }
 
     //! Function to get control surface name at given index in list of control surfaces
@@ -308,11 +344,23 @@ public:
      * \param index Index in list of control surfaces (controlSurfaceNames_)
      * \return Name of requested control surfaces.
      */
-    std::string getControlSurfaceName( const int index )
+    const std::string& getControlSurfaceName( const int index )
     {
         return controlSurfaceNames_.at( index );
     }
 
+    //! Function to get control surface coefficient interface at given index in list of control surfaces
+    /*!
+     * Function to get control surface coefficient interface at given index in list of control surfaces
+     * \param index Index in list of control surfaces (controlSurfaceNames_)
+     * \return Coefficient interface of requested control surface.
+     */
+    std::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > getControlSurfaceIncrementInterface(
+            const unsigned int index )
+    {
+        return controlSurfaceIncrementInterfaceList_.at( index );
+    }
+
     //! Function to return the number of control surfaces in current coefficient interface.
     /*!
      * Function to return the number of control surfaces in current coefficient interface.
@@ -457,6 +505,9 @@ protected:
     //! Explicit list of control surface names, in same order as iterator over controlSurfaceIncrementInterfaces_
     std::vector< std::string > controlSurfaceNames_;
 
+    //! List of control surface aerodynamic coefficient interfaces, in same order as controlSurfaceNames_
+    std::vector< std::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > > controlSurfaceIncrementInterfaceList_;
+
 private:
 };
 
@@ -87,6 +87,7 @@ AtmosphericFlightConditions::AtmosphericFlightConditions(
         updateLatitudeAndLongitudeForAtmosphere_ = 0;
     }
     isLatitudeAndLongitudeSet_ = 0;
+    isAerodynamicCoefficientInputSet_ = 0;
 
     if( updateLatitudeAndLongitudeForAtmosphere_ && aerodynamicAngleCalculator_== nullptr )
     {
@@ -210,27 +211,38 @@ double AtmosphericFlightConditions::getAerodynamicCoefficientIndependentVariable
 //! Function to update the independent variables of the aerodynamic coefficient interface
 void AtmosphericFlightConditions::updateAerodynamicCoefficientInput( )
 {
-    aerodynamicCoefficientIndependentVariables_.clear( );
-    // Calculate independent variables for aerodynamic coefficients.
-    for( unsigned int i = 0; i < aerodynamicCoefficientInterface_->getNumberOfIndependentVariables( ); i++ )
+    // Calculate independent variables for aerodynamic coefficients (existing buffers are reused, so that no memory is
+    // allocated after the first call).
+    aerodynamicCoefficientIndependentVariables_.resize(
+                aerodynamicCoefficientInterface_->getNumberOfIndependentVariables( ) );
+    for( unsigned int i = 0; i < aerodynamicCoefficientIndependentVariables_.size( ); i++ )
     {
-        aerodynamicCoefficientIndependentVariables_.push_back(
-                    getAerodynamicCoefficientIndependentVariable(
-                        aerodynamicCoefficientInterface_->getIndependentVariableName( i ) ) );
+        aerodynamicCoefficientIndependentVariables_[ i ] =
+                getAerodynamicCoefficientIndependentVariable(
+                    aerodynamicCoefficientInterface_->getIndependentVariableName( i ) );
     }
 
-    controlSurfaceAerodynamicCoefficientIndependentVariables_.clear( );
-    for( unsigned int i = 0; i < aerodynamicCoefficientInterface_->getNumberOfControlSurfaces( ); i++ )
+    // Calculate independent variables for control surface increments, indexed by control surface index.
+    controlSurfaceAerodynamicCoefficientIndependentVariables_.resize(
+                aerodynamicCoefficientInterface_->getNumberOfControlSurfaces( ) );
+    for( unsigned int i = 0; i < controlSurfaceAerodynamicCoefficientIndependentVariables_.size( ); i++ )
     {
-        std::string currentControlSurface = aerodynamicCoefficientInterface_->getControlSurfaceName( i );
-        for( unsigned int j = 0; j < aerodynamicCoefficientInterface_->getNumberOfControlSurfaceIndependentVariables( currentControlSurface ); j++ )
+        const std::string& currentControlSurface = aerodynamicCoefficientInterface_->getControlSurfaceName( i );
+        std::shared_ptr< ControlSurfaceIncrementAerodynamicInterface > currentControlSurfaceInterface =
+                aerodynamicCoefficientInterface_->getControlSurfaceIncrementInterface( i );
+        std::vector< double >& currentControlSurfaceVariables =
+                controlSurfaceAerodynamicCoefficientIndependentVariables_[ i ];
+
+        currentControlSurfaceVariables.resize( currentControlSurfaceInterface->getNumberOfIndependentVariables( ) );
+        for( unsigned int j = 0; j < currentControlSurfaceVariables.size( ); j++ )
         {
-            controlSurfaceAerodynamicCoefficientIndependentVariables_[ currentControlSurface ].push_back(
-                        getAerodynamicCoefficientIndependentVariable(
-                            aerodynamicCoefficientInterface_->getControlSurfaceIndependentVariableName(
-                                currentControlSurface, j ), currentControlSurface ) );
+            currentControlSurfaceVariables[ j ] =
+                    getAerodynamicCoefficientIndependentVariable(
+                        currentControlSurfaceInterface->getIndependentVariableName( j ), currentControlSurface );
         }
     }
+
+    isAerodynamicCoefficientInputSet_ = 1;
 }
 
 //! Function to set the angle of attack to trimmed conditions.
@@ -462,8 +462,7 @@ public:
      */
     std::vector< double > getAerodynamicCoefficientIndependentVariables( )
     {
-        if( aerodynamicCoefficientIndependentVariables_.size( ) !=
-                aerodynamicCoefficientInterface_->getNumberOfIndependentVariables( ) )
+        if( !isAerodynamicCoefficientInputSet_ )
         {
             updateAerodynamicCoefficientInput( );
         }
@@ -479,13 +478,18 @@ public:
      */
     std::map< std::string, std::vector< double > > getControlSurfaceAerodynamicCoefficientIndependentVariables( )
     {
-        if( controlSurfaceAerodynamicCoefficientIndependentVariables_.size( ) !=
-                aerodynamicCoefficientInterface_->getNumberOfControlSurfaces( ) )
+        if( !isAerodynamicCoefficientInputSet_ )
         {
             updateAerodynamicCoefficientInput( );
         }
 
-        return controlSurfaceAerodynamicCoefficientIndependentVariables_;
+        std::map< std::string, std::vector< double > > controlSurfaceIndependentVariables;
+        for( unsigned int i = 0; i < controlSurfaceAerodynamicCoefficientIndependentVariables_.size( ); i++ )
+        {
+            controlSurfaceIndependentVariables[ aerodynamicCoefficientInterface_->getControlSurfaceName( i ) ] =
+                    controlSurfaceAerodynamicCoefficientIndependentVariables_.at( i );
+        }
+        return controlSurfaceIndependentVariables;
     }
 
     //! Function to reset the current time of the flight conditions.
@@ -502,8 +506,7 @@ public:
         isLatitudeAndLongitudeSet_ = 0;
 
         aerodynamicAngleCalculator_->resetCurrentTime( currentTime_ );
-        aerodynamicCoefficientIndependentVariables_.clear( );
-        controlSurfaceAerodynamicCoefficientIndependentVariables_.clear( );
+        isAerodynamicCoefficientInputSet_ = 0;
     }
 
 private:
@@ -640,9 +643,13 @@ private:
     //! Current list of independent variables of the aerodynamic coefficient interface
     std::vector< double > aerodynamicCoefficientIndependentVariables_;
 
-    //! List of independent variables of the control surface aerodynamic coefficient interface, with map key
-    //! control surface identifiers.
-    std::map< std::string, std::vector< double > > controlSurfaceAerodynamicCoefficientIndependentVariables_;
+    //! List of independent variables of the control surface aerodynamic coefficient interface, with vector index
+    //! the index of the control surface in the aerodynamic coefficient interface.
+    std::vector< std::vector< double > > controlSurfaceAerodynamicCoefficientIndependentVariables_;
+
+    //! Boolean denoting whether the independent variables of the aerodynamic coefficients have been computed at the
+    //! current time.
+    bool isAerodynamicCoefficientInputSet_;
 };
 
 } // namespace aerodynamics
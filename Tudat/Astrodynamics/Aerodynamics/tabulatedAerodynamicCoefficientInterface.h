@@ -0,0 +1,409 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TABULATED_AERODYNAMIC_COEFFICIENT_INTERFACE_H
+#define TUDAT_TABULATED_AERODYNAMIC_COEFFICIENT_INTERFACE_H
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/array.hpp>
+#include <boost/multi_array.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Aerodynamics/aerodynamicCoefficientInterface.h"
+#include "Tudat/Mathematics/Interpolators/interpolator.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/utilityMacros.h"
+
+namespace tudat
+{
+namespace aerodynamics
+{
+
+//! Class for multi-linear interpolation of tabulated aerodynamic force and moment coefficients.
+/*!
+ *  Class for multi-linear interpolation of tabulated aerodynamic force and moment coefficients, which are interpolated
+ *  simultaneously. Contrary to the general interpolators::MultiLinearInterpolator, this class is specialized for use
+ *  during a propagation: the force and moment coefficients at each grid point are stored contiguously, the lower
+ *  indices of the grid hyper-rectangle are cached between calls (and only searched for if the independent variables
+ *  moved beyond a neighbouring interval), and no memory is allocated when interpolating. Outside of the tabulated
+ *  domain, the boundary values are used, or the coefficients are linearly extrapolated from the boundary interval
+ *  (per independent variable).
+ */
+template< unsigned int NumberOfDimensions >
+class MultiLinearAerodynamicCoefficientInterpolator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param independentVariables Values of the independent variables at which the coefficients are tabulated, one
+     *  (strictly increasing) vector per dimension.
+     *  \param forceCoefficients Tabulated force coefficients.
+     *  \param momentCoefficients Tabulated moment coefficients (defined on the same grid as the force coefficients).
+     *  \param boundaryHandling Boundary handling method for each independent variable, only use_boundary_value and
+     *  extrapolate_at_boundary are supported.
+     */
+    MultiLinearAerodynamicCoefficientInterpolator(
+            const std::vector< std::vector< double > >& independentVariables,
+            const boost::multi_array< Eigen::Vector3d, NumberOfDimensions >& forceCoefficients,
+            const boost::multi_array< Eigen::Vector3d, NumberOfDimensions >& momentCoefficients,
+            const std::vector< interpolators::BoundaryInterpolationType >& boundaryHandling =
+            std::vector< interpolators::BoundaryInterpolationType >(
+                NumberOfDimensions, interpolators::use_boundary_value ) )
+    {
+        if( independentVariables.size( ) != NumberOfDimensions || boundaryHandling.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error(
+                        "Error when creating tabulated aerodynamic coefficient interpolator, input size is inconsistent "
+                        "with number of dimensions " + std::to_string( NumberOfDimensions ) );
+        }
+
+        // Check and set grid and boundary handling in each dimension
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            if( independentVariables.at( i ).size( ) < 2 )
+            {
+                throw std::runtime_error(
+                            "Error when creating tabulated aerodynamic coefficient interpolator, at least 2 data "
+                            "points are required in each dimension, found " +
+                            std::to_string( independentVariables.at( i ).size( ) ) + " in dimension " +
+                            std::to_string( i ) );
+            }
+
+            if( ( forceCoefficients.shape( )[ i ] != independentVariables.at( i ).size( ) ) ||
+                    ( momentCoefficients.shape( )[ i ] != independentVariables.at( i ).size( ) ) )
+            {
+                throw std::runtime_error(
+                            "Error when creating tabulated aerodynamic coefficient interpolator, size of coefficient "
+                            "table is inconsistent with independent variables in dimension " + std::to_string( i ) );
+            }
+
+            if( boundaryHandling.at( i ) != interpolators::use_boundary_value &&
+                    boundaryHandling.at( i ) != interpolators::extrapolate_at_boundary )
+            {
+                throw std::runtime_error(
+                            "Error when creating tabulated aerodynamic coefficient interpolator, boundary handling " +
+                            std::to_string( boundaryHandling.at( i ) ) + " not supported" );
+            }
+
+            independentVariables_[ i ] = independentVariables.at( i );
+            useBoundaryValue_[ i ] = ( boundaryHandling.at( i ) == interpolators::use_boundary_value );
+            lowerIndices_[ i ] = 0;
+        }
+
+        // Compute row-major strides of coefficient table
+        unsigned int numberOfGridPoints = 1;
+        for( int i = NumberOfDimensions - 1; i >= 0; i-- )
+        {
+            strides_[ i ] = numberOfGridPoints;
+            numberOfGridPoints *= independentVariables_[ i ].size( );
+        }
+
+        // Store force and moment coefficients contiguously, one column per grid point
+        coefficients_.resize( 6, numberOfGridPoints );
+        boost::array< unsigned int, NumberOfDimensions > gridIndices;
+        for( unsigned int i = 0; i < numberOfGridPoints; i++ )
+        {
+            for( unsigned int j = 0; j < NumberOfDimensions; j++ )
+            {
+                gridIndices[ j ] = ( i / strides_[ j ] ) % independentVariables_[ j ].size( );
+            }
+            coefficients_.block( 0, i, 3, 1 ) = forceCoefficients( gridIndices );
+            coefficients_.block( 3, i, 3, 1 ) = momentCoefficients( gridIndices );
+        }
+    }
+
+    //! Function to interpolate the force and moment coefficients
+    /*!
+     *  Function to interpolate the force and moment coefficients
+     *  \param independentVariables Current values of independent variables (size must be equal to number of dimensions,
+     *  which is not checked by this function).
+     *  \return Concatenated force and moment coefficients at given independent variables.
+     */
+    Eigen::Vector6d interpolate( const std::vector< double >& independentVariables )
+    {
+        // Determine interval and interpolation fraction in each dimension
+        unsigned int lowerCornerIndex = 0;
+        for( unsigned int i = 0; i < NumberOfDimensions; i++ )
+        {
+            const std::vector< double >& currentGrid = independentVariables_[ i ];
+            double currentValue = independentVariables[ i ];
+            if( useBoundaryValue_[ i ] )
+            {
+                currentValue = std::min( std::max( currentValue, currentGrid.front( ) ), currentGrid.back( ) );
+            }
+
+            int lowerIndex = findLowerIndex( i, currentValue );
+            upperFractions_[ i ] = ( currentValue - currentGrid[ lowerIndex ] ) /
+                    ( currentGrid[ lowerIndex + 1 ] - currentGrid[ lowerIndex ] );
+            lowerCornerIndex += lowerIndex * strides_[ i ];
+        }
+
+        // Compute weighted sum of coefficients at corners of grid hyper-rectangle
+        Eigen::Vector6d interpolatedCoefficients = Eigen::Vector6d::Zero( );
+        for( unsigned int i = 0; i < ( 1u << NumberOfDimensions ); i++ )
+        {
+            double currentWeight = 1.0;
+            unsigned int currentIndex = lowerCornerIndex;
+            for( unsigned int j = 0; j < NumberOfDimensions; j++ )
+            {
+                if( i & ( 1u << j ) )
+                {
+                    currentWeight *= upperFractions_[ j ];
+                    currentIndex += strides_[ j ];
+                }
+                else
+                {
+                    currentWeight *= 1.0 - upperFractions_[ j ];
+                }
+            }
+            interpolatedCoefficients += currentWeight * coefficients_.col( currentIndex );
+        }
+
+        return interpolatedCoefficients;
+    }
+
+private:
+
+    //! Function to find the lower index of the grid interval in a single dimension
+    /*!
+     *  Function to find the lower index of the grid interval in a single dimension. The interval of the previous call is
+     *  checked first, followed by its direct neighbours, after which a binary search is performed. Values outside of
+     *  the grid are assigned to the boundary interval.
+     *  \param dimension Dimension for which the interval is to be found.
+     *  \param value Value of independent variable.
+     *  \return Lower index of grid interval.
+     */
+    int findLowerIndex( const unsigned int dimension, const double value )
+    {
+        const std::vector< double >& currentGrid = independentVariables_[ dimension ];
+        const int maximumIndex = static_cast< int >( currentGrid.size( ) ) - 2;
+        int& lowerIndex = lowerIndices_[ dimension ];
+
+        if( value >= currentGrid[ lowerIndex ] && value < currentGrid[ lowerIndex + 1 ] )
+        {
+            return lowerIndex;
+        }
+        else if( lowerIndex < maximumIndex && value >= currentGrid[ lowerIndex + 1 ] &&
+                 value < currentGrid[ lowerIndex + 2 ] )
+        {
+            lowerIndex++;
+        }
+        else if( lowerIndex > 0 && value >= currentGrid[ lowerIndex - 1 ] && value < currentGrid[ lowerIndex ] )
+        {
+            lowerIndex--;
+        }
+        else
+        {
+            lowerIndex = static_cast< int >(
+                        std::upper_bound( currentGrid.begin( ), currentGrid.end( ), value ) - currentGrid.begin( ) ) - 1;
+            lowerIndex = std::min( std::max( lowerIndex, 0 ), maximumIndex );
+        }
+        return lowerIndex;
+    }
+
+    //! Values of the independent variables at which the coefficients are tabulated, per dimension.
+    boost::array< std::vector< double >, NumberOfDimensions > independentVariables_;
+
+    //! Booleans denoting whether the boundary value is used outside of the grid (extrapolated if false), per dimension.
+    boost::array< bool, NumberOfDimensions > useBoundaryValue_;
+
+    //! Index strides of each dimension in the (row-major) list of grid points.
+    boost::array< unsigned int, NumberOfDimensions > strides_;
+
+    //! Lower indices of the grid interval found in the previous call, per dimension.
+    boost::array< int, NumberOfDimensions > lowerIndices_;
+
+    //! Interpolation fractions w.r.t. upper grid points in current call, per dimension.
+    boost::array< double, NumberOfDimensions > upperFractions_;
+
+    //! Concatenated force and moment coefficients, with each column denoting a single grid point.
+    Eigen::Matrix< double, 6, Eigen::Dynamic > coefficients_;
+};
+
+//! Aerodynamic coefficient interface for coefficients tabulated on a multi-dimensional grid.
+/*!
+ *  Aerodynamic coefficient interface for coefficients tabulated on a multi-dimensional grid, which are computed by
+ *  multi-linear interpolation (see MultiLinearAerodynamicCoefficientInterpolator). Force and moment coefficients are
+ *  interpolated simultaneously, and no memory is allocated when updating the coefficients.
+ */
+template< unsigned int NumberOfDimensions >
+class TabulatedAerodynamicCoefficientInterface: public AerodynamicCoefficientInterface
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param independentVariables Values of the independent variables at which the coefficients are tabulated.
+     *  \param forceCoefficients Tabulated force coefficients.
+     *  \param momentCoefficients Tabulated moment coefficients.
+     *  \param boundaryHandling Boundary handling method for each independent variable (use_boundary_value or
+     *  extrapolate_at_boundary).
+     *  \param referenceLength Reference length with which aerodynamic moments
+     *  (about x- and z- axes) are non-dimensionalized.
+     *  \param referenceArea Reference area with which aerodynamic forces and moments are
+     *  non-dimensionalized.
+     *  \param lateralReferenceLength Reference length with which aerodynamic moments (about y-axis)
+     *  is non-dimensionalized.
+     *  \param momentReferencePoint Point w.r.t. which aerodynamic moment is calculated.
+     *  \param independentVariableNames Vector with identifiers for the physical meaning of each
+     *  independent variable of the aerodynamic coefficients.
+     *  \param areCoefficientsInAerodynamicFrame Boolean to define whether the aerodynamic
+     *  coefficients are defined in the aerodynamic frame (drag, side, lift force) or in the body
+     *  frame (typically denoted as Cx, Cy, Cz) (default true).
+     *  \param areCoefficientsInNegativeAxisDirection Boolean to define whether the aerodynamic
+     *  coefficients are positive along tyhe positive axes of the body or aerodynamic frame
+     *  (see areCoefficientsInAerodynamicFrame). Note that for (drag, side, lift force), the
+     *  coefficients are typically defined in negative direction (default true).
+     */
+    TabulatedAerodynamicCoefficientInterface(
+            const std::vector< std::vector< double > >& independentVariables,
+            const boost::multi_array< Eigen::Vector3d, NumberOfDimensions >& forceCoefficients,
+            const boost::multi_array< Eigen::Vector3d, NumberOfDimensions >& momentCoefficients,
+            const std::vector< interpolators::BoundaryInterpolationType >& boundaryHandling,
+            const double referenceLength,
+            const double referenceArea,
+            const double lateralReferenceLength,
+            const Eigen::Vector3d& momentReferencePoint,
+            const std::vector< AerodynamicCoefficientsIndependentVariables >& independentVariableNames,
+            const bool areCoefficientsInAerodynamicFrame = true,
+            const bool areCoefficientsInNegativeAxisDirection = true ):
+        AerodynamicCoefficientInterface(
+            referenceLength, referenceArea, lateralReferenceLength, momentReferencePoint,
+            independentVariableNames, areCoefficientsInAerodynamicFrame,
+            areCoefficientsInNegativeAxisDirection ),
+        coefficientInterpolator_( independentVariables, forceCoefficients, momentCoefficients, boundaryHandling )
+    {
+        if( independentVariableNames.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error(
+                        "Error when creating tabulated aerodynamic coefficient interface, number of independent "
+                        "variable names is inconsistent " + std::to_string( independentVariableNames.size( ) ) +
+                        ", " + std::to_string( NumberOfDimensions ) );
+        }
+    }
+
+    //! Destructor
+    ~TabulatedAerodynamicCoefficientInterface( ){ }
+
+    //! Compute the aerodynamic coefficients at current flight condition.
+    /*!
+     *  Computes the current force and moment coefficients by interpolating the tabulated coefficients.
+     *  \param independentVariables Independent variables of force and moment coefficient determination.
+     *  \param currentTime Time to which coefficients are to be updated (unused).
+     */
+    void updateCurrentCoefficients( const std::vector< double >& independentVariables,
+                                    const double currentTime = TUDAT_NAN )
+    {
+        TUDAT_UNUSED_PARAMETER( currentTime );
+
+        // Check if the correct number of aerodynamic coefficients is provided.
+        if( independentVariables.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error(
+                        "Error in TabulatedAerodynamicCoefficientInterface, number of input variables is inconsistent " +
+                        std::to_string( independentVariables.size( ) ) + ", " +
+                        std::to_string( NumberOfDimensions ) );
+        }
+
+        Eigen::Vector6d currentCoefficients = coefficientInterpolator_.interpolate( independentVariables );
+        currentForceCoefficients_ = currentCoefficients.segment< 3 >( 0 );
+        currentMomentCoefficients_ = currentCoefficients.segment< 3 >( 3 );
+    }
+
+private:
+
+    //! Object to interpolate the tabulated force and moment coefficients.
+    MultiLinearAerodynamicCoefficientInterpolator< NumberOfDimensions > coefficientInterpolator_;
+};
+
+//! Control surface aerodynamic coefficient interface for increments tabulated on a multi-dimensional grid.
+/*!
+ *  Control surface aerodynamic coefficient interface for force and moment coefficient increments tabulated on a
+ *  multi-dimensional grid, which are computed by multi-linear interpolation (see
+ *  MultiLinearAerodynamicCoefficientInterpolator). No memory is allocated when updating the coefficients.
+ */
+template< unsigned int NumberOfDimensions >
+class TabulatedControlSurfaceIncrementAerodynamicInterface: public ControlSurfaceIncrementAerodynamicInterface
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param independentVariables Values of the independent variables at which the increments are tabulated.
+     *  \param forceCoefficients Tabulated force coefficient increments.
+     *  \param momentCoefficients Tabulated moment coefficient increments.
+     *  \param independentVariableNames Vector with identifiers for the physical meaning of each
+     *  independent variable of the aerodynamic coefficients.
+     *  \param boundaryHandling Boundary handling method for each independent variable (use_boundary_value or
+     *  extrapolate_at_boundary).
+     */
+    TabulatedControlSurfaceIncrementAerodynamicInterface(
+            const std::vector< std::vector< double > >& independentVariables,
+            const boost::multi_array< Eigen::Vector3d, NumberOfDimensions >& forceCoefficients,
+            const boost::multi_array< Eigen::Vector3d, NumberOfDimensions >& momentCoefficients,
+            const std::vector< AerodynamicCoefficientsIndependentVariables >& independentVariableNames,
+            const std::vector< interpolators::BoundaryInterpolationType >& boundaryHandling =
+            std::vector< interpolators::BoundaryInterpolationType >(
+                NumberOfDimensions, interpolators::extrapolate_at_boundary ) ):
+        ControlSurfaceIncrementAerodynamicInterface( independentVariableNames ),
+        coefficientInterpolator_( independentVariables, forceCoefficients, momentCoefficients, boundaryHandling )
+    {
+        if( independentVariableNames.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error(
+                        "Error when creating tabulated control surface aerodynamic coefficient interface, number of "
+                        "independent variable names is inconsistent " +
+                        std::to_string( independentVariableNames.size( ) ) + ", " +
+                        std::to_string( NumberOfDimensions ) );
+        }
+    }
+
+    //! Destructor
+    ~TabulatedControlSurfaceIncrementAerodynamicInterface( ){ }
+
+    //! Compute the aerodynamic coefficient increments of the control surface.
+    /*!
+     *  Computes the current force and moment coefficients increments of the control surface by interpolating the
+     *  tabulated increments.
+     *  \param independentVariables Independent variables of force and moment coefficient increment determination.
+     */
+    void updateCurrentCoefficients( std::vector< double >& independentVariables )
+    {
+        // Check if the correct number of aerodynamic coefficients is provided.
+        if( independentVariables.size( ) != NumberOfDimensions )
+        {
+            throw std::runtime_error(
+                        "Error in TabulatedControlSurfaceIncrementAerodynamicInterface, number of "
+                        "input variables is inconsistent " );
+        }
+
+        Eigen::Vector6d currentCoefficients = coefficientInterpolator_.interpolate( independentVariables );
+        currentForceCoefficients_ = currentCoefficients.segment< 3 >( 0 );
+        currentMomentCoefficients_ = currentCoefficients.segment< 3 >( 3 );
+    }
+
+private:
+
+    //! Object to interpolate the tabulated force and moment coefficient increments.
+    MultiLinearAerodynamicCoefficientInterpolator< NumberOfDimensions > coefficientInterpolator_;
+};
+
+} // namespace aerodynamics
+
+} // namespace tudat
+
+#endif // TUDAT_TABULATED_AERODYNAMIC_COEFFICIENT_INTERFACE_H
@@ -429,6 +429,64 @@ BOOST_AUTO_TEST_CASE( test_convertMeanAnomalyToEccentricAnomaly_specificInitialG
                        1.0E-13 );
 }
 
+//! Test 8: Test specialized solver and array conversion against root finder-based conversion.
+BOOST_AUTO_TEST_CASE( test_convertMeanAnomalyToEccentricAnomaly_specializedSolver )
+{
+    // Create random eccentricities and mean anomalies (including large and negative mean anomalies).
+    boost::mt19937 randomNumberGenerator( 42 );
+    boost::random::uniform_real_distribution< > eccentricityDistribution( 0.0, 0.999 );
+    boost::random::uniform_real_distribution< > meanAnomalyDistribution( -20.0, 20.0 );
+
+    // Use number of entries that is not a multiple of the block size, to also test remaining entries.
+    const int numberOfEntries = 1001;
+    Eigen::ArrayXd eccentricities = Eigen::ArrayXd( numberOfEntries );
+    Eigen::ArrayXd meanAnomalies = Eigen::ArrayXd( numberOfEntries );
+    for( int i = 0; i < numberOfEntries; i++ )
+    {
+        eccentricities( i ) = ( i % 10 == 0 ) ? 0.0 : eccentricityDistribution( randomNumberGenerator );
+        meanAnomalies( i ) = meanAnomalyDistribution( randomNumberGenerator );
+    }
+
+    Eigen::ArrayXd eccentricAnomalies;
+    convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies, eccentricAnomalies );
+    BOOST_CHECK_EQUAL( eccentricAnomalies.rows( ), numberOfEntries );
+
+    for( int i = 0; i < numberOfEntries; i++ )
+    {
+        // Compute eccentric anomaly with (non-default) root finder.
+        const double reducedMeanAnomaly = basic_mathematics::computeModulo( meanAnomalies( i ), 2.0 * PI );
+        const double rootFinderEccentricAnomaly = convertMeanAnomalyToEccentricAnomaly(
+                    eccentricities( i ), meanAnomalies( i ), false, reducedMeanAnomaly );
+
+        // Compute eccentric anomaly with specialized solver.
+        const double scalarEccentricAnomaly = solveKeplersEquationForEllipticalOrbits(
+                    eccentricities( i ), meanAnomalies( i ) );
+
+        BOOST_CHECK_SMALL( scalarEccentricAnomaly - rootFinderEccentricAnomaly, 1.0E-12 );
+        BOOST_CHECK_SMALL( eccentricAnomalies( i ) - scalarEccentricAnomaly, 1.0E-14 );
+        BOOST_CHECK_SMALL( scalarEccentricAnomaly - eccentricities( i ) * std::sin( scalarEccentricAnomaly ) -
+                           reducedMeanAnomaly, 1.0E-14 );
+        BOOST_CHECK( eccentricAnomalies( i ) >= 0.0 && eccentricAnomalies( i ) < 2.0 * PI );
+    }
+
+    // Check single-eccentricity interface.
+    Eigen::ArrayXd singleEccentricityAnomalies =
+            convertMeanAnomaliesToEccentricAnomalies( 0.3, meanAnomalies );
+    for( int i = 0; i < numberOfEntries; i++ )
+    {
+        BOOST_CHECK_SMALL( singleEccentricityAnomalies( i ) -
+                           solveKeplersEquationForEllipticalOrbits( 0.3, meanAnomalies( i ) ), 1.0E-14 );
+    }
+
+    // Check error handling.
+    eccentricities( 5 ) = 1.0;
+    BOOST_CHECK_THROW( convertMeanAnomaliesToEccentricAnomalies( eccentricities, meanAnomalies, eccentricAnomalies ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( convertMeanAnomaliesToEccentricAnomalies(
+                           Eigen::ArrayXd( Eigen::ArrayXd::Zero( 3 ) ), meanAnomalies, eccentricAnomalies ),
+                       std::runtime_error );
+}
+
 // End Boost test suite.
 BOOST_AUTO_TEST_SUITE_END( )
 
@@ -115,6 +115,154 @@ BOOST_AUTO_TEST_CASE( testShadowFunctionForPartialShadow )
     BOOST_CHECK_CLOSE_FRACTION( 0.4547, shadowFunction, 0.001 );
 }
 
+//! Unit test for shadow function with occulting body disk fully inside occulted body disk (annular eclipse).
+BOOST_AUTO_TEST_CASE( testShadowFunctionForAnnularShadow )
+{
+    // Satellite far behind a small occulting body, slightly off the Sun-body axis, so that the apparent disk of the
+    // occulting body lies fully inside the apparent disk of the Sun.
+    const Eigen::Vector3d occultedBodyPosition = -149598000.0e3 * Eigen::Vector3d( 1.0, 0.0, 0.0 );
+    const Eigen::Vector3d occultingBodyPosition = Eigen::Vector3d::Zero( );
+    const double occultedBodyRadius = 6.96e8; // Siedelmann 1992.
+    const double occultingBodyRadius = 1.0e6;
+
+    const Eigen::Vector3d satellitePosition( 1.0e9, 1.0e5, 0.0 );
+
+    // Compute shadow function
+    const double shadowFunction = mission_geometry::computeShadowFunction(
+                occultedBodyPosition,
+                occultedBodyRadius,
+                occultingBodyPosition,
+                occultingBodyRadius,
+                satellitePosition );
+
+    // Shadow function is equal to the fraction of the apparent disk of the Sun that is not covered.
+    const double occultedBodyApparentRadius =
+            std::asin( occultedBodyRadius / ( occultedBodyPosition - satellitePosition ).norm( ) );
+    const double occultingBodyApparentRadius =
+            std::asin( occultingBodyRadius / ( satellitePosition - occultingBodyPosition ).norm( ) );
+    const double expectedShadowFunction = 1.0 - ( occultingBodyApparentRadius * occultingBodyApparentRadius ) /
+            ( occultedBodyApparentRadius * occultedBodyApparentRadius );
+
+    // Test values.
+    BOOST_CHECK_CLOSE_FRACTION( expectedShadowFunction, shadowFunction, 1.0E-14 );
+    BOOST_CHECK( shadowFunction > 0.9 && shadowFunction < 1.0 );
+}
+
+//! Unit test for shadow function with multiple occulting bodies.
+BOOST_AUTO_TEST_CASE( testShadowFunctionForMultipleOccultations )
+{
+    const Eigen::Vector3d occultedBodyPosition = -149598000.0e3 * Eigen::Vector3d( 1.0, 0.0, 0.0 );
+    const double occultedBodyRadius = 6.96e8; // Siedelmann 1992.
+    const double occultingBodyRadius = 6378.137e3; // WGS-84.
+
+    // Use geometry of partial shadow test.
+    Eigen::Vector3d satelliteDirection( 0.018, 1.0, 0.0 );
+    satelliteDirection.normalize( );
+    const Eigen::Vector3d satellitePosition = ( occultingBodyRadius + 1.0e3 ) * satelliteDirection;
+
+    const double singleShadowFunction = mission_geometry::computeShadowFunction(
+                occultedBodyPosition, occultedBodyRadius, Eigen::Vector3d::Zero( ),
+                occultingBodyRadius, satellitePosition );
+
+    // Test single occultation, and occultation with additional body that is not in front of the occulted body.
+    {
+        std::vector< Eigen::Vector3d > occultingBodyPositions;
+        occultingBodyPositions.push_back( Eigen::Vector3d::Zero( ) );
+        std::vector< double > occultingBodyRadii;
+        occultingBodyRadii.push_back( occultingBodyRadius );
+
+        BOOST_CHECK_EQUAL( mission_geometry::computeMultipleOccultationShadowFunction(
+                               occultedBodyPosition, occultedBodyRadius, occultingBodyPositions,
+                               occultingBodyRadii, satellitePosition ), singleShadowFunction );
+
+        occultingBodyPositions.push_back( satellitePosition + 3.8E8 * Eigen::Vector3d( 1.0, 0.0, 0.0 ) );
+        occultingBodyRadii.push_back( 1737.1E3 );
+
+        BOOST_CHECK_EQUAL( mission_geometry::isOccultationPossible(
+                               occultedBodyPosition, occultedBodyRadius, occultingBodyPositions.at( 1 ),
+                               occultingBodyRadii.at( 1 ), satellitePosition ), false );
+        BOOST_CHECK_EQUAL( mission_geometry::computeMultipleOccultationShadowFunction(
+                               occultedBodyPosition, occultedBodyRadius, occultingBodyPositions,
+                               occultingBodyRadii, satellitePosition ), singleShadowFunction );
+    }
+
+    // Test concurrent occultation by two bodies that do not overlap one another: occulted fractions are added.
+    {
+        std::vector< Eigen::Vector3d > occultingBodyPositions;
+        occultingBodyPositions.push_back( satellitePosition + 1.0E8 * Eigen::Vector3d( -1.0, 0.0015, 0.0 ) );
+        occultingBodyPositions.push_back( satellitePosition + 1.0E8 * Eigen::Vector3d( -1.0, -0.0015, 0.0 ) );
+        std::vector< double > occultingBodyRadii( 2, 1.0E5 );
+
+        BOOST_CHECK_EQUAL( mission_geometry::areApparentDisksOverlapping(
+                               occultingBodyPositions.at( 0 ), occultingBodyRadii.at( 0 ),
+                               occultingBodyPositions.at( 1 ), occultingBodyRadii.at( 1 ), satellitePosition ), false );
+
+        double expectedOccultedFraction = 0.0;
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            expectedOccultedFraction += 1.0 - mission_geometry::computeShadowFunction(
+                        occultedBodyPosition, occultedBodyRadius, occultingBodyPositions.at( i ),
+                        occultingBodyRadii.at( i ), satellitePosition );
+        }
+        BOOST_CHECK_CLOSE_FRACTION( mission_geometry::computeMultipleOccultationShadowFunction(
+                                        occultedBodyPosition, occultedBodyRadius, occultingBodyPositions,
+                                        occultingBodyRadii, satellitePosition ),
+                                    1.0 - expectedOccultedFraction, 1.0E-14 );
+    }
+
+    // Test concurrent occultation by two overlapping bodies: the overlapping part should not be counted twice.
+    {
+        // Two bodies at the same location: shadow function should be equal to that of single body
+        std::vector< Eigen::Vector3d > occultingBodyPositions;
+        occultingBodyPositions.push_back( Eigen::Vector3d::Zero( ) );
+        occultingBodyPositions.push_back( Eigen::Vector3d::Zero( ) );
+        std::vector< double > occultingBodyRadii( 2, occultingBodyRadius );
+
+        double multipleShadowFunction = mission_geometry::computeMultipleOccultationShadowFunction(
+                    occultedBodyPosition, occultedBodyRadius, occultingBodyPositions,
+                    occultingBodyRadii, satellitePosition, 128 );
+        BOOST_CHECK_CLOSE_FRACTION( multipleShadowFunction, singleShadowFunction, 1.0E-3 );
+
+        // Second body fully in front of first body, as seen from satellite: shadow function should be equal to that of
+        // larger body.
+        occultingBodyPositions[ 1 ] = satellitePosition / 2.0;
+        occultingBodyRadii[ 1 ] = occultingBodyRadius / 10.0;
+        multipleShadowFunction = mission_geometry::computeMultipleOccultationShadowFunction(
+                    occultedBodyPosition, occultedBodyRadius, occultingBodyPositions,
+                    occultingBodyRadii, satellitePosition, 128 );
+        BOOST_CHECK_CLOSE_FRACTION( multipleShadowFunction, singleShadowFunction, 1.0E-3 );
+    }
+
+    // Test overlapping occultation with additional body behind the occulted body, with apparent disk fully covering
+    // that of occulted body: shadow function should be unaffected.
+    {
+        std::vector< Eigen::Vector3d > occultingBodyPositions;
+        occultingBodyPositions.push_back( Eigen::Vector3d::Zero( ) );
+        occultingBodyPositions.push_back( Eigen::Vector3d::Zero( ) );
+        std::vector< double > occultingBodyRadii( 2, occultingBodyRadius );
+
+        const double multipleShadowFunction = mission_geometry::computeMultipleOccultationShadowFunction(
+                    occultedBodyPosition, occultedBodyRadius, occultingBodyPositions,
+                    occultingBodyRadii, satellitePosition, 128 );
+
+        const Eigen::Vector3d occultingBodyBehindSourcePosition = 2.0 * occultedBodyPosition;
+        const double occultingBodyBehindSourceRadius = 1.0E10;
+        BOOST_CHECK_EQUAL( mission_geometry::isOccultationPossible(
+                               occultedBodyPosition, occultedBodyRadius, occultingBodyBehindSourcePosition,
+                               occultingBodyBehindSourceRadius, satellitePosition ), false );
+        BOOST_CHECK_EQUAL( mission_geometry::areApparentDisksOverlapping(
+                               occultedBodyPosition, occultedBodyRadius, occultingBodyBehindSourcePosition,
+                               occultingBodyBehindSourceRadius, satellitePosition ), true );
+
+        occultingBodyPositions.insert( occultingBodyPositions.begin( ), occultingBodyBehindSourcePosition );
+        occultingBodyRadii.insert( occultingBodyRadii.begin( ), occultingBodyBehindSourceRadius );
+        BOOST_CHECK_CLOSE_FRACTION( mission_geometry::computeMultipleOccultationShadowFunction(
+                                        occultedBodyPosition, occultedBodyRadius, occultingBodyPositions,
+                                        occultingBodyRadii, satellitePosition, 128 ),
+                                    multipleShadowFunction, 1.0E-14 );
+    }
+}
+
 //! Unit test for computation of radius of sphere of influence (Earth with respect to Sun).
 BOOST_AUTO_TEST_CASE( testSphereOfInfluenceEarth )
 {
@@ -17,6 +17,9 @@
  *              Deep Space Maneuvers, MSc thesis report, Delft University of Technology, 2012.
  *              [unpublished so far]. Section available on tudat website (tudat.tudelft.nl)
  *              under issue #539.
+ *      Regarding the specialized (allocation-free) solver:
+ *          Markley, F.L. Kepler equation solver, Celestial Mechanics and Dynamical Astronomy 63,
+ *              101-111, 1995.
  *
  *    Notes
  *      There are known to be some issues on some systems with near-parabolic orbits that are very
@@ -36,6 +39,9 @@
 #include <boost/math/special_functions/asinh.hpp>
 
 #include <cmath>
+#include <limits>
+
+#include <Eigen/Core>
 
 #include "Tudat/Mathematics/RootFinders/newtonRaphson.h"
 #include "Tudat/Mathematics/RootFinders/rootFinder.h"
@@ -135,6 +141,264 @@ ScalarType computeFirstDerivativeKeplersFunctionForHyperbolicOrbits(
     return eccentricity * std::cosh( hyperbolicEccentricAnomaly ) - 1.0;
 }
 
+//! Compute starter for Kepler's equation for elliptical orbits, according to (Markley, 1995).
+/*!
+ * Computes starter for Kepler's equation for elliptical orbits, according to (Markley, 1995), "Kepler equation
+ * solver", Celestial Mechanics and Dynamical Astronomy 63, 101-111. The starter is obtained from a cubic equation
+ * (Pade approximation of sin( E )), and is accurate to about 1.0e-4 for all eccentricities and mean anomalies.
+ * \param eccentricity Eccentricity of the orbit (0.0 <= e < 1.0) [-].
+ * \param meanAnomaly Mean anomaly, reduced to the interval [-PI, PI] [rad].
+ * \return Starter for eccentric anomaly [rad].
+ */
+template< typename ScalarType = double >
+ScalarType computeMarkleyStarterForEllipticalOrbits( const ScalarType eccentricity, const ScalarType meanAnomaly )
+{
+    using namespace mathematical_constants;
+
+    const ScalarType pi = getPi< ScalarType >( );
+    const ScalarType one = getFloatingInteger< ScalarType >( 1 );
+    const ScalarType two = getFloatingInteger< ScalarType >( 2 );
+    const ScalarType three = getFloatingInteger< ScalarType >( 3 );
+
+    ScalarType alpha = ( three * pi * pi + getFloatingFraction< ScalarType >( 8, 5 ) * pi *
+                         ( pi - std::fabs( meanAnomaly ) ) / ( one + eccentricity ) ) /
+            ( pi * pi - getFloatingInteger< ScalarType >( 6 ) );
+    ScalarType d = three * ( one - eccentricity ) + alpha * eccentricity;
+    ScalarType q = two * alpha * d * ( one - eccentricity ) - meanAnomaly * meanAnomaly;
+    ScalarType r = three * alpha * d * ( d - one + eccentricity ) * meanAnomaly +
+            meanAnomaly * meanAnomaly * meanAnomaly;
+    ScalarType w = std::pow( std::fabs( r ) + std::sqrt( q * q * q + r * r ), getFloatingFraction< ScalarType >( 2, 3 ) );
+
+    return ( two * r * w / ( w * w + w * q + q * q ) + meanAnomaly ) / d;
+}
+
+//! Apply fifth-order correction of (Markley, 1995) to an estimate of the eccentric anomaly.
+/*!
+ * Applies fifth-order correction of (Markley, 1995) to an estimate of the eccentric anomaly, which results in an
+ * accuracy close to machine precision (for doubles) when applied to the starter of
+ * computeMarkleyStarterForEllipticalOrbits.
+ * \param eccentricAnomaly Estimate of eccentric anomaly [rad].
+ * \param eccentricity Eccentricity of the orbit (0.0 <= e < 1.0) [-].
+ * \param meanAnomaly Mean anomaly [rad].
+ * \return Corrected eccentric anomaly [rad].
+ */
+template< typename ScalarType = double >
+ScalarType applyMarkleyCorrectionForEllipticalOrbits(
+        const ScalarType eccentricAnomaly, const ScalarType eccentricity, const ScalarType meanAnomaly )
+{
+    using namespace mathematical_constants;
+
+    ScalarType sineTerm = eccentricity * std::sin( eccentricAnomaly );
+    ScalarType cosineTerm = eccentricity * std::cos( eccentricAnomaly );
+
+    ScalarType function = eccentricAnomaly - sineTerm - meanAnomaly;
+    ScalarType firstDerivative = getFloatingInteger< ScalarType >( 1 ) - cosineTerm;
+
+    ScalarType thirdOrderCorrection = -function /
+            ( firstDerivative - getFloatingFraction< ScalarType >( 1, 2 ) * function * sineTerm / firstDerivative );
+    ScalarType fourthOrderCorrection = -function /
+            ( firstDerivative + getFloatingFraction< ScalarType >( 1, 2 ) * thirdOrderCorrection * sineTerm +
+              getFloatingFraction< ScalarType >( 1, 6 ) * thirdOrderCorrection * thirdOrderCorrection * cosineTerm );
+    ScalarType fifthOrderCorrection = -function /
+            ( firstDerivative + getFloatingFraction< ScalarType >( 1, 2 ) * fourthOrderCorrection * sineTerm +
+              getFloatingFraction< ScalarType >( 1, 6 ) * fourthOrderCorrection * fourthOrderCorrection * cosineTerm -
+              getFloatingFraction< ScalarType >( 1, 24 ) * fourthOrderCorrection * fourthOrderCorrection *
+              fourthOrderCorrection * sineTerm );
+
+    return eccentricAnomaly + fifthOrderCorrection;
+}
+
+//! Solve Kepler's equation for elliptical orbits, without use of (dynamically allocated) root finder objects.
+/*!
+ * Solves Kepler's equation for elliptical orbits, using the starter and fifth-order correction of (Markley, 1995),
+ * followed by Halley iterations until convergence to (close to) machine precision. No objects are allocated, so
+ * that this function is suitable for very large numbers of evaluations. For eccentricities >= 0.0 and < 1.0, the result
+ * is equal to that of the convertMeanAnomalyToEccentricAnomaly function with default settings.
+ * \param eccentricity Eccentricity of the orbit (0.0 <= e < 1.0) [-].
+ * \param meanAnomaly Mean anomaly to convert to eccentric anomaly [rad].
+ * \param maximumNumberOfIterations Maximum number of Halley iterations after Markley correction.
+ * \return Eccentric anomaly, in the interval [0, 2 PI) [rad].
+ */
+template< typename ScalarType = double >
+ScalarType solveKeplersEquationForEllipticalOrbits(
+        const ScalarType eccentricity, const ScalarType meanAnomaly, const int maximumNumberOfIterations = 5 )
+{
+    using namespace mathematical_constants;
+
+    const ScalarType pi = getPi< ScalarType >( );
+    const ScalarType twoPi = getFloatingInteger< ScalarType >( 2 ) * pi;
+
+    // Reduce mean anomaly to [-PI, PI).
+    ScalarType reducedMeanAnomaly = meanAnomaly - twoPi * std::floor( ( meanAnomaly + pi ) / twoPi );
+
+    // Compute starter and correct it.
+    ScalarType eccentricAnomaly = applyMarkleyCorrectionForEllipticalOrbits(
+                computeMarkleyStarterForEllipticalOrbits( eccentricity, reducedMeanAnomaly ),
+                eccentricity, reducedMeanAnomaly );
+
+    // Refine solution using Halley iterations.
+    ScalarType tolerance = getFloatingInteger< ScalarType >( 4 ) * std::numeric_limits< ScalarType >::epsilon( ) * pi;
+    for( int i = 0; i < maximumNumberOfIterations; i++ )
+    {
+        ScalarType sineTerm = eccentricity * std::sin( eccentricAnomaly );
+        ScalarType function = eccentricAnomaly - sineTerm - reducedMeanAnomaly;
+        ScalarType firstDerivative = getFloatingInteger< ScalarType >( 1 ) - eccentricity * std::cos( eccentricAnomaly );
+        ScalarType correction = -function /
+                ( firstDerivative - getFloatingFraction< ScalarType >( 1, 2 ) * function * sineTerm / firstDerivative );
+        eccentricAnomaly += correction;
+
+        if( !( std::fabs( correction ) > tolerance ) )
+        {
+            break;
+        }
+    }
+
+    // Set eccentric anomaly to region between 0 and 2 PI.
+    if( eccentricAnomaly < getFloatingInteger< ScalarType >( 0 ) )
+    {
+        eccentricAnomaly += twoPi;
+    }
+    return eccentricAnomaly;
+}
+
+//! Size of the blocks in which mean anomalies are converted to eccentric anomalies by the array conversion functions.
+static const int KEPLER_SOLVER_BLOCK_SIZE = 16;
+
+//! Solve Kepler's equation for elliptical orbits for a fixed-size block of mean anomalies and eccentricities.
+/*!
+ * Solves Kepler's equation for elliptical orbits for a fixed-size block of mean anomalies and eccentricities, using the
+ * starter and fifth-order correction of (Markley, 1995), followed by a single Halley iteration. No branching is used, and
+ * all operations are done on fixed-size Eigen arrays, so that the computations can be vectorized by the compiler/Eigen.
+ * Input is not checked, and should be in range 0.0 <= e < 1.0.
+ * \param eccentricities Eccentricities of the orbits [-].
+ * \param meanAnomalies Mean anomalies to convert to eccentric anomalies [rad].
+ * \return Eccentric anomalies, in the interval [0, 2 PI) [rad].
+ */
+template< typename ScalarType, int BlockSize >
+Eigen::Array< ScalarType, BlockSize, 1 > solveKeplersEquationForEllipticalOrbitsBlock(
+        const Eigen::Array< ScalarType, BlockSize, 1 >& eccentricities,
+        const Eigen::Array< ScalarType, BlockSize, 1 >& meanAnomalies )
+{
+    using namespace mathematical_constants;
+    typedef Eigen::Array< ScalarType, BlockSize, 1 > BlockType;
+
+    const ScalarType pi = getPi< ScalarType >( );
+    const ScalarType twoPi = getFloatingInteger< ScalarType >( 2 ) * pi;
+    const ScalarType one = getFloatingInteger< ScalarType >( 1 );
+
+    // Reduce mean anomaly to [-PI, PI).
+    BlockType reducedMeanAnomalies = meanAnomalies - twoPi * ( ( meanAnomalies + pi ) / twoPi ).floor( );
+
+    // Compute starter (Markley, 1995).
+    BlockType alpha = ( getFloatingInteger< ScalarType >( 3 ) * pi * pi + getFloatingFraction< ScalarType >( 8, 5 ) * pi *
+                        ( pi - reducedMeanAnomalies.abs( ) ) / ( one + eccentricities ) ) /
+            ( pi * pi - getFloatingInteger< ScalarType >( 6 ) );
+    BlockType d = getFloatingInteger< ScalarType >( 3 ) * ( one - eccentricities ) + alpha * eccentricities;
+    BlockType q = getFloatingInteger< ScalarType >( 2 ) * alpha * d * ( one - eccentricities ) -
+            reducedMeanAnomalies.square( );
+    BlockType r = getFloatingInteger< ScalarType >( 3 ) * alpha * d * ( d - one + eccentricities ) * reducedMeanAnomalies +
+            reducedMeanAnomalies.cube( );
+    BlockType w = ( r.abs( ) + ( q.cube( ) + r.square( ) ).sqrt( ) ).pow( getFloatingFraction< ScalarType >( 2, 3 ) );
+    BlockType eccentricAnomalies = ( getFloatingInteger< ScalarType >( 2 ) * r * w / ( w.square( ) + w * q + q.square( ) ) +
+                                     reducedMeanAnomalies ) / d;
+
+    // Apply fifth-order correction (Markley, 1995).
+    BlockType sineTerms = eccentricities * eccentricAnomalies.sin( );
+    BlockType cosineTerms = eccentricities * eccentricAnomalies.cos( );
+    BlockType functions = eccentricAnomalies - sineTerms - reducedMeanAnomalies;
+    BlockType firstDerivatives = one - cosineTerms;
+    BlockType corrections = -functions / ( firstDerivatives - getFloatingFraction< ScalarType >( 1, 2 ) *
+                                           functions * sineTerms / firstDerivatives );
+    corrections = -functions / ( firstDerivatives + getFloatingFraction< ScalarType >( 1, 2 ) * corrections * sineTerms +
+                                 getFloatingFraction< ScalarType >( 1, 6 ) * corrections.square( ) * cosineTerms );
+    corrections = -functions / ( firstDerivatives + getFloatingFraction< ScalarType >( 1, 2 ) * corrections * sineTerms +
+                                 getFloatingFraction< ScalarType >( 1, 6 ) * corrections.square( ) * cosineTerms -
+                                 getFloatingFraction< ScalarType >( 1, 24 ) * corrections.cube( ) * sineTerms );
+    eccentricAnomalies += corrections;
+
+    // Apply single Halley iteration.
+    sineTerms = eccentricities * eccentricAnomalies.sin( );
+    functions = eccentricAnomalies - sineTerms - reducedMeanAnomalies;
+    firstDerivatives = one - eccentricities * eccentricAnomalies.cos( );
+    eccentricAnomalies -= functions / ( firstDerivatives - getFloatingFraction< ScalarType >( 1, 2 ) *
+                                        functions * sineTerms / firstDerivatives );
+
+    // Set eccentric anomaly to region between 0 and 2 PI.
+    return ( eccentricAnomalies < getFloatingInteger< ScalarType >( 0 ) ).select(
+                eccentricAnomalies + twoPi, eccentricAnomalies );
+}
+
+//! Convert an array of mean anomalies to eccentric anomalies, for an array of eccentricities.
+/*!
+ * Converts an array of mean anomalies to eccentric anomalies, for an array of eccentricities (with one entry per
+ * mean anomaly), for elliptical orbits. The conversion is performed in fixed-size blocks (of size
+ * KEPLER_SOLVER_BLOCK_SIZE) by solveKeplersEquationForEllipticalOrbitsBlock, allowing the computations to be vectorized.
+ * Remaining entries are converted by solveKeplersEquationForEllipticalOrbits. No memory is allocated, other than
+ * (possibly) by resizing the output array.
+ * \param eccentricities Eccentricities of the orbits (0.0 <= e < 1.0) [-].
+ * \param meanAnomalies Mean anomalies to convert to eccentric anomalies [rad].
+ * \param eccentricAnomalies Eccentric anomalies, in the interval [0, 2 PI) (returned by reference) [rad].
+ */
+template< typename ScalarType = double >
+void convertMeanAnomaliesToEccentricAnomalies(
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricities,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies,
+        Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& eccentricAnomalies )
+{
+    typedef Eigen::Array< ScalarType, KEPLER_SOLVER_BLOCK_SIZE, 1 > BlockType;
+
+    if( eccentricities.rows( ) != meanAnomalies.rows( ) )
+    {
+        throw std::runtime_error( "Error when converting mean to eccentric anomalies, input sizes are inconsistent." );
+    }
+
+    if( ( eccentricities < mathematical_constants::getFloatingInteger< ScalarType >( 0 ) ).any( ) ||
+            !( eccentricities < mathematical_constants::getFloatingInteger< ScalarType >( 1 ) ).all( ) )
+    {
+        throw std::runtime_error( "Invalid eccentricity when converting mean to eccentric anomalies. Valid range is "
+                                  "0.0 <= e < 1.0." );
+    }
+
+    const int numberOfEntries = meanAnomalies.rows( );
+    eccentricAnomalies.resize( numberOfEntries );
+
+    // Convert full blocks.
+    const int numberOfBlockEntries = numberOfEntries - numberOfEntries % KEPLER_SOLVER_BLOCK_SIZE;
+    for( int i = 0; i < numberOfBlockEntries; i += KEPLER_SOLVER_BLOCK_SIZE )
+    {
+        eccentricAnomalies.template segment< KEPLER_SOLVER_BLOCK_SIZE >( i ) =
+                solveKeplersEquationForEllipticalOrbitsBlock< ScalarType, KEPLER_SOLVER_BLOCK_SIZE >(
+                    BlockType( eccentricities.template segment< KEPLER_SOLVER_BLOCK_SIZE >( i ) ),
+                    BlockType( meanAnomalies.template segment< KEPLER_SOLVER_BLOCK_SIZE >( i ) ) );
+    }
+
+    // Convert remaining entries.
+    for( int i = numberOfBlockEntries; i < numberOfEntries; i++ )
+    {
+        eccentricAnomalies( i ) = solveKeplersEquationForEllipticalOrbits( eccentricities( i ), meanAnomalies( i ) );
+    }
+}
+
+//! Convert an array of mean anomalies to eccentric anomalies, for a single eccentricity.
+/*!
+ * Converts an array of mean anomalies to eccentric anomalies, for a single eccentricity, for elliptical orbits. See
+ * overloaded function for details.
+ * \param eccentricity Eccentricity of the orbit (0.0 <= e < 1.0) [-].
+ * \param meanAnomalies Mean anomalies to convert to eccentric anomalies [rad].
+ * \return Eccentric anomalies, in the interval [0, 2 PI) [rad].
+ */
+template< typename ScalarType = double >
+Eigen::Array< ScalarType, Eigen::Dynamic, 1 > convertMeanAnomaliesToEccentricAnomalies(
+        const ScalarType eccentricity,
+        const Eigen::Array< ScalarType, Eigen::Dynamic, 1 >& meanAnomalies )
+{
+    Eigen::Array< ScalarType, Eigen::Dynamic, 1 > eccentricAnomalies;
+    convertMeanAnomaliesToEccentricAnomalies< ScalarType >(
+                Eigen::Array< ScalarType, Eigen::Dynamic, 1 >::Constant( meanAnomalies.rows( ), eccentricity ),
+                meanAnomalies, eccentricAnomalies );
+    return eccentricAnomalies;
+}
+
 //! Convert mean anomaly to eccentric anomaly.
 /*!
  * Converts mean anomaly to eccentric anomaly for elliptical orbits for all eccentricities >=
@@ -143,7 +407,9 @@ ScalarType computeFirstDerivativeKeplersFunctionForHyperbolicOrbits(
  * for some near-parabolic cases in which macine precision problems occur. These are tested
  * against an accuracy of 1.0e-9. Near-parabolic in this sense means e > 1.0-1.0e-11. Also
  * note that your mean anomaly is automatically transformed to fit within the 0 to 2.0*PI
- * spectrum. Numerical tests performed using double ScalarType.
+ * spectrum. Numerical tests performed using double ScalarType. If no root finder is provided and the default initial
+ * guess is used, the conversion is performed by solveKeplersEquationForEllipticalOrbits, which does not allocate any
+ * root finder objects.
  * \param eccentricity Eccentricity of the orbit [-].
  * \param aMeanAnomaly Mean anomaly to convert to eccentric anomaly [rad].
  * \param useDefaultInitialGuess Boolean specifying whether to use default initial guess [-].
@@ -171,6 +437,18 @@ ScalarType convertMeanAnomalyToEccentricAnomaly(
                 aMeanAnomaly, getFloatingInteger< ScalarType >( 2 ) *
                 getPi< ScalarType >( ) );
 
+    // Use specialized (allocation-free) solver if no root finder or initial guess is provided.
+    if ( !rootFinder.get( ) && useDefaultInitialGuess &&
+         eccentricity < getFloatingInteger< ScalarType >( 1 ) &&
+         eccentricity >= getFloatingInteger< ScalarType >( 0 ) )
+    {
+        ScalarType eccentricAnomaly = solveKeplersEquationForEllipticalOrbits( eccentricity, meanAnomaly );
+        if( std::isfinite( eccentricAnomaly ) )
+        {
+            return eccentricAnomaly;
+        }
+    }
+
     // Required because the make_shared in the function definition gives problems for MSVC.
     if ( !rootFinder.get( ) )
     {
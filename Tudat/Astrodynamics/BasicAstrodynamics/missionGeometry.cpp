@@ -14,7 +14,10 @@
  */
 
 #include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <algorithm>
 #include <cmath>
+#include <stdexcept>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
@@ -130,8 +133,9 @@ double computeShadowFunction( const Eigen::Vector3d& occultedBodyPosition,
         else if ( apparentSeparation < occultedBodyApparentRadius - occultingBodyApparentRadius &&
                   occultedBodyApparentRadius > occultingBodyApparentRadius )
         {
-            // Maximum partial occultation.
-            shadowFunction = 0.0;
+            // Maximum partial occultation (occulting body fully in front of occulted body disk).
+            shadowFunction = 1.0 - occultingBodyApparentRadius * occultingBodyApparentRadius /
+                    ( occultedBodyApparentRadius * occultedBodyApparentRadius );
         }
 
         else if ( occultedBodyApparentRadius + occultingBodyApparentRadius <= apparentSeparation )
@@ -145,6 +149,187 @@ double computeShadowFunction( const Eigen::Vector3d& occultedBodyPosition,
     return shadowFunction;
 }
 
+//! Check whether the apparent disks of two bodies overlap, as seen from the satellite.
+bool areApparentDisksOverlapping( const Eigen::Vector3d& firstBodyPosition,
+                                  const double firstBodyRadius,
+                                  const Eigen::Vector3d& secondBodyPosition,
+                                  const double secondBodyRadius,
+                                  const Eigen::Vector3d& satellitePosition )
+{
+    const Eigen::Vector3d firstBodyRelativePosition = firstBodyPosition - satellitePosition;
+    const Eigen::Vector3d secondBodyRelativePosition = secondBodyPosition - satellitePosition;
+
+    const double firstBodyDistance = firstBodyRelativePosition.norm( );
+    const double secondBodyDistance = secondBodyRelativePosition.norm( );
+
+    // Satellite inside either body: disks always overlap.
+    if( firstBodyDistance <= firstBodyRadius || secondBodyDistance <= secondBodyRadius )
+    {
+        return true;
+    }
+
+    // Compute sine and cosine of apparent radii.
+    const double sineOfFirstBodyApparentRadius = firstBodyRadius / firstBodyDistance;
+    const double sineOfSecondBodyApparentRadius = secondBodyRadius / secondBodyDistance;
+    const double cosineOfFirstBodyApparentRadius =
+            std::sqrt( 1.0 - sineOfFirstBodyApparentRadius * sineOfFirstBodyApparentRadius );
+    const double cosineOfSecondBodyApparentRadius =
+            std::sqrt( 1.0 - sineOfSecondBodyApparentRadius * sineOfSecondBodyApparentRadius );
+
+    // If sum of apparent radii exceeds 180 degrees (negative sine of sum), disks always overlap.
+    if( cosineOfFirstBodyApparentRadius * sineOfSecondBodyApparentRadius +
+            sineOfFirstBodyApparentRadius * cosineOfSecondBodyApparentRadius < 0.0 )
+    {
+        return true;
+    }
+
+    // Compare apparent separation with sum of apparent radii, using cosines.
+    const double cosineOfSumOfApparentRadii =
+            cosineOfFirstBodyApparentRadius * cosineOfSecondBodyApparentRadius -
+            sineOfFirstBodyApparentRadius * sineOfSecondBodyApparentRadius;
+    return ( firstBodyRelativePosition.dot( secondBodyRelativePosition ) >
+             cosineOfSumOfApparentRadii * firstBodyDistance * secondBodyDistance );
+}
+
+//! Check whether an occulting body can (partially) occult the occulted body, as seen from the satellite.
+bool isOccultationPossible( const Eigen::Vector3d& occultedBodyPosition,
+                            const double occultedBodyRadius,
+                            const Eigen::Vector3d& occultingBodyPosition,
+                            const double occultingBodyRadius,
+                            const Eigen::Vector3d& satellitePosition )
+{
+    // Check whether occulting body is fully behind occulted body.
+    if( ( occultingBodyPosition - satellitePosition ).norm( ) - occultingBodyRadius >=
+            ( occultedBodyPosition - satellitePosition ).norm( ) + occultedBodyRadius )
+    {
+        return false;
+    }
+    else
+    {
+        return areApparentDisksOverlapping( occultedBodyPosition, occultedBodyRadius,
+                                            occultingBodyPosition, occultingBodyRadius, satellitePosition );
+    }
+}
+
+//! Compute the shadow function for any number of occulting bodies.
+double computeMultipleOccultationShadowFunction( const Eigen::Vector3d& occultedBodyPosition,
+                                                 const double occultedBodyRadius,
+                                                 const std::vector< Eigen::Vector3d >& occultingBodyPositions,
+                                                 const std::vector< double >& occultingBodyRadii,
+                                                 const Eigen::Vector3d& satellitePosition,
+                                                 const int numberOfRingsForOverlappingOccultations )
+{
+    if( occultingBodyPositions.size( ) != occultingBodyRadii.size( ) )
+    {
+        throw std::runtime_error( "Error when computing multiple occultation shadow function, input sizes are inconsistent" );
+    }
+
+    // Determine number of bodies that can cause occultation, and compute summed occulted fraction.
+    // Bodies that fail the occultation check (e.g. bodies behind the occulted body) are excluded from all further
+    // computations.
+    std::vector< unsigned int > occultingBodyIndices;
+    double totalOccultedFraction = 0.0;
+    bool areOccultationsOverlapping = false;
+    for( unsigned int i = 0; i < occultingBodyPositions.size( ); i++ )
+    {
+        if( isOccultationPossible( occultedBodyPosition, occultedBodyRadius, occultingBodyPositions[ i ],
+                                   occultingBodyRadii[ i ], satellitePosition ) )
+        {
+            double currentOccultedFraction = 1.0 - computeShadowFunction(
+                        occultedBodyPosition, occultedBodyRadius, occultingBodyPositions[ i ],
+                        occultingBodyRadii[ i ], satellitePosition );
+
+            if( currentOccultedFraction > 0.0 )
+            {
+                // Check whether current occulting body overlaps with any previous occulting body.
+                for( unsigned int j = 0; j < occultingBodyIndices.size( ); j++ )
+                {
+                    if( areApparentDisksOverlapping( occultingBodyPositions[ occultingBodyIndices[ j ] ],
+                                                     occultingBodyRadii[ occultingBodyIndices[ j ] ],
+                                                     occultingBodyPositions[ i ], occultingBodyRadii[ i ],
+                                                     satellitePosition ) )
+                    {
+                        areOccultationsOverlapping = true;
+                    }
+                }
+
+                totalOccultedFraction += currentOccultedFraction;
+                occultingBodyIndices.push_back( i );
+            }
+        }
+    }
+
+    double shadowFunction = 1.0;
+    if( !areOccultationsOverlapping || occultingBodyIndices.size( ) < 2 )
+    {
+        shadowFunction = std::max( 1.0 - totalOccultedFraction, 0.0 );
+    }
+    else
+    {
+        // Set up frame with first axis towards center of occulted body.
+        const Eigen::Vector3d occultedBodyRelativePosition = occultedBodyPosition - satellitePosition;
+        const Eigen::Vector3d occultedBodyDirection = occultedBodyRelativePosition.normalized( );
+        Eigen::Vector3d firstPerpendicularDirection = occultedBodyDirection.unitOrthogonal( );
+        Eigen::Vector3d secondPerpendicularDirection = occultedBodyDirection.cross( firstPerpendicularDirection );
+
+        const double occultedBodyApparentRadius = std::asin( occultedBodyRadius / occultedBodyRelativePosition.norm( ) );
+
+        // Compute directions and cosines of apparent radii of bodies that occult the occulted body.
+        std::vector< Eigen::Vector3d > occultingBodyDirections( occultingBodyIndices.size( ) );
+        std::vector< double > cosinesOfOccultingBodyApparentRadii( occultingBodyIndices.size( ) );
+        for( unsigned int i = 0; i < occultingBodyIndices.size( ); i++ )
+        {
+            const unsigned int bodyIndex = occultingBodyIndices[ i ];
+            const Eigen::Vector3d occultingBodyRelativePosition = occultingBodyPositions[ bodyIndex ] - satellitePosition;
+            const double occultingBodyDistance = occultingBodyRelativePosition.norm( );
+            occultingBodyDirections[ i ] = occultingBodyRelativePosition / occultingBodyDistance;
+            cosinesOfOccultingBodyApparentRadii[ i ] = ( occultingBodyDistance > occultingBodyRadii[ bodyIndex ] ) ?
+                        std::sqrt( 1.0 - occultingBodyRadii[ bodyIndex ] * occultingBodyRadii[ bodyIndex ] /
+                                   ( occultingBodyDistance * occultingBodyDistance ) ) : -1.0;
+        }
+
+        // Evaluate lines of sight on polar grid on disk of occulted body, with samples weighted by solid angle
+        double totalWeight = 0.0;
+        double visibleWeight = 0.0;
+        const double ringWidth = occultedBodyApparentRadius / static_cast< double >( numberOfRingsForOverlappingOccultations );
+        for( int i = 0; i < numberOfRingsForOverlappingOccultations; i++ )
+        {
+            const double ringRadius = ( static_cast< double >( i ) + 0.5 ) * ringWidth;
+            const int numberOfSamplesInRing = std::max( 4, static_cast< int >(
+                                                            std::ceil( 2.0 * mathematical_constants::PI * ( i + 0.5 ) ) ) );
+            const double sampleWeight = std::sin( ringRadius ) / static_cast< double >( numberOfSamplesInRing );
+
+            for( int j = 0; j < numberOfSamplesInRing; j++ )
+            {
+                const double sampleAngle = 2.0 * mathematical_constants::PI * static_cast< double >( j ) /
+                        static_cast< double >( numberOfSamplesInRing );
+                const Eigen::Vector3d lineOfSight = std::cos( ringRadius ) * occultedBodyDirection + std::sin( ringRadius ) * (
+                            std::cos( sampleAngle ) * firstPerpendicularDirection +
+                            std::sin( sampleAngle ) * secondPerpendicularDirection );
+
+                bool isLineOfSightOcculted = false;
+                for( unsigned int k = 0; k < occultingBodyDirections.size( ); k++ )
+                {
+                    if( lineOfSight.dot( occultingBodyDirections[ k ] ) > cosinesOfOccultingBodyApparentRadii[ k ] )
+                    {
+                        isLineOfSightOcculted = true;
+                        break;
+                    }
+                }
+
+                totalWeight += sampleWeight;
+                if( !isLineOfSightOcculted )
+                {
+                    visibleWeight += sampleWeight;
+                }
+            }
+        }
+        shadowFunction = visibleWeight / totalWeight;
+    }
+
+    return shadowFunction;
+}
+
 double computeSphereOfInfluence( const double distanceToCentralBody,
                                  const double ratioOfOrbitingToCentralBodyMass )
 {
@@ -20,6 +20,8 @@
 #ifndef TUDAT_MISSION_GEOMETRY_H
 #define TUDAT_MISSION_GEOMETRY_H
 
+#include <vector>
+
 #include <Eigen/Core>
 
 #include "Tudat/Basics/basicTypedefs.h"
@@ -81,6 +83,74 @@ double computeShadowFunction( const Eigen::Vector3d& occultedBodyPosition,
                               const double occultingBodyRadius,
                               const Eigen::Vector3d& satellitePosition );
 
+//! Check whether the apparent disks of two bodies overlap, as seen from the satellite.
+/*!
+ * Checks whether the apparent disks of two bodies overlap, as seen from the satellite, by checking whether the apparent
+ * separation of the bodies is smaller than the sum of their apparent radii (i.e. whether the cones from the satellite
+ * bounding both bodies intersect). This check only requires dot products and square roots.
+ *
+ * \param firstBodyPosition Vector containing Cartesian coordinates of the first body.
+ * \param firstBodyRadius Mean radius of first body.
+ * \param secondBodyPosition Vector containing Cartesian coordinates of the second body.
+ * \param secondBodyRadius Mean radius of second body.
+ * \param satellitePosition Vector containing Cartesian coordinates of the satellite.
+ * \return True if the apparent disks overlap, false otherwise.
+ */
+bool areApparentDisksOverlapping( const Eigen::Vector3d& firstBodyPosition,
+                                  const double firstBodyRadius,
+                                  const Eigen::Vector3d& secondBodyPosition,
+                                  const double secondBodyRadius,
+                                  const Eigen::Vector3d& satellitePosition );
+
+//! Check whether an occulting body can (partially) occult the occulted body, as seen from the satellite.
+/*!
+ * Checks whether an occulting body can (partially) occult the occulted body, as seen from the satellite. Returns false
+ * if the occulting body is fully behind the occulted body, or if the apparent disks of the bodies do not overlap
+ * (see areApparentDisksOverlapping). This check is used to reject occulting bodies prior to evaluating the (much
+ * more expensive) shadow function.
+ *
+ * \param occultedBodyPosition Vector containing Cartesian coordinates of the occulted body.
+ * \param occultedBodyRadius Mean radius of occulted body.
+ * \param occultingBodyPosition Vector containing Cartesian coordinates of the occulting body.
+ * \param occultingBodyRadius Mean radius of occulting body.
+ * \param satellitePosition Vector containing Cartesian coordinates of the satellite.
+ * \return True if an occultation is possible, false otherwise.
+ */
+bool isOccultationPossible( const Eigen::Vector3d& occultedBodyPosition,
+                            const double occultedBodyRadius,
+                            const Eigen::Vector3d& occultingBodyPosition,
+                            const double occultingBodyRadius,
+                            const Eigen::Vector3d& satellitePosition );
+
+//! Compute the shadow function for any number of occulting bodies.
+/*!
+ * Returns the value of of the shadow function for any number of occulting bodies, with 0 denoting the satellite is
+ * fully in shadow, 1 if the satellite is fully exposed and a value between 0 and 1 if the satellite is in penumbra of
+ * one or more bodies. Occulting bodies are first checked with the isOccultationPossible function, so that the shadow
+ * function is only evaluated for bodies that are (nearly) in front of the occulted body.
+ *
+ * If the remaining occulting bodies do not overlap one another (as seen from the satellite), the occulted fractions
+ * computed by computeShadowFunction are added. If two or more occulting bodies overlap one another in front of the
+ * occulted body (e.g. Earth and Moon during a penumbral eclipse seen from lunar orbit), the occulted fraction of
+ * the disk of the occulted body is computed numerically, by evaluating a polar grid of lines of sight on the disk of
+ * the occulted body, so that the overlapping part is not counted twice.
+ *
+ * \param occultedBodyPosition Vector containing Cartesian coordinates of the occulted body.
+ * \param occultedBodyRadius Mean radius of occulted body.
+ * \param occultingBodyPositions List of vectors containing Cartesian coordinates of the occulting bodies.
+ * \param occultingBodyRadii List of mean radii of occulting bodies.
+ * \param satellitePosition Vector containing Cartesian coordinates of the satellite.
+ * \param numberOfRingsForOverlappingOccultations Number of rings into which the disk of the occulted body is divided
+ * when computing the shadow function for overlapping occulting bodies.
+ * \return Shadow function value.
+ */
+double computeMultipleOccultationShadowFunction( const Eigen::Vector3d& occultedBodyPosition,
+                                                 const double occultedBodyRadius,
+                                                 const std::vector< Eigen::Vector3d >& occultingBodyPositions,
+                                                 const std::vector< double >& occultingBodyRadii,
+                                                 const Eigen::Vector3d& satellitePosition,
+                                                 const int numberOfRingsForOverlappingOccultations = 32 );
+
 //! Compute the radius of the sphere of influence.
 /*!
  * Returns the radius of the the Sphere of Influence (SOI) for a body orbiting a central body.
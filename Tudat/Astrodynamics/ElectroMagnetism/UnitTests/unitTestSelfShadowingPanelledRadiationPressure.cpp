@@ -0,0 +1,196 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/panelledRadiationPressure.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/selfShadowingPanelledRadiationPressure.h"
+#include "Tudat/Mathematics/GeometricShapes/lawgsPartGeometry.h"
+#include "Tudat/Mathematics/GeometricShapes/sphereSegment.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::electro_magnetism;
+
+//! Function to create a square panel in the y-z plane at given x, with normal along +x.
+SelfShadowingRadiationPressurePanel createSquarePanel( const double xPosition, const double emissivity )
+{
+    std::vector< Eigen::Vector3d > panelCorners;
+    panelCorners.push_back( Eigen::Vector3d( xPosition, -0.5, -0.5 ) );
+    panelCorners.push_back( Eigen::Vector3d( xPosition, -0.5, 0.5 ) );
+    panelCorners.push_back( Eigen::Vector3d( xPosition, 0.5, 0.5 ) );
+    panelCorners.push_back( Eigen::Vector3d( xPosition, 0.5, -0.5 ) );
+    return SelfShadowingRadiationPressurePanel( panelCorners, emissivity, 0.1 );
+}
+
+BOOST_AUTO_TEST_SUITE( test_self_shadowing_panelled_radiation_pressure )
+
+//! Test ray-traced shadowing of one panel by another.
+BOOST_AUTO_TEST_CASE( testPanelSelfShadowing )
+{
+    // Create two parallel panels, with the second directly behind the first.
+    std::vector< SelfShadowingRadiationPressurePanel > panels;
+    panels.push_back( createSquarePanel( 0.0, 0.3 ) );
+    panels.push_back( createSquarePanel( -1.0, 0.3 ) );
+
+    BOOST_CHECK_SMALL( std::fabs( panels.at( 0 ).getPanelArea( ) - 1.0 ), 1.0E-15 );
+    BOOST_CHECK_SMALL( ( panels.at( 0 ).getPanelSurfaceNormal( ) - Eigen::Vector3d::UnitX( ) ).norm( ), 1.0E-15 );
+
+    // Source along panel normal: second panel is fully shadowed.
+    {
+        Eigen::Vector3d vectorToSource = Eigen::Vector3d::UnitX( );
+        Eigen::Vector6d forceAndTorque = computeSelfShadowedPanelledRadiationPressureForceAndTorque(
+                    panels, vectorToSource, Eigen::Vector3d::Zero( ), 4 );
+        Eigen::Vector3d expectedForce = computeSinglePanelNormalizedRadiationPressureForce(
+                    vectorToSource, Eigen::Vector3d::UnitX( ), 1.0, 0.3, 0.1 );
+
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( forceAndTorque.segment( 0, 3 ), expectedForce, 1.0E-14 );
+        }
+        BOOST_CHECK_SMALL( forceAndTorque.segment( 3, 3 ).norm( ), 1.0E-15 );
+    }
+
+    // Source at 26.6 degrees from panel normal: half of second panel is shadowed.
+    {
+        Eigen::Vector3d vectorToSource = Eigen::Vector3d( 1.0, 0.5, 0.0 ).normalized( );
+        Eigen::Vector6d forceAndTorque = computeSelfShadowedPanelledRadiationPressureForceAndTorque(
+                    panels, vectorToSource, Eigen::Vector3d::Zero( ), 10 );
+        Eigen::Vector3d singlePanelForce = computeSinglePanelNormalizedRadiationPressureForce(
+                    vectorToSource, Eigen::Vector3d::UnitX( ), 1.0, 0.3, 0.1 );
+
+        {
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( forceAndTorque.segment( 0, 3 ), ( 1.5 * singlePanelForce ), 1.0E-14 );
+        }
+
+        // Illuminated half of second panel is at y > 0, torque of first panel is zero: check resulting torque
+        Eigen::Vector3d expectedTorque = 0.5 * Eigen::Vector3d( -1.0, 0.25, 0.0 ).cross( singlePanelForce );
+        BOOST_CHECK_SMALL( ( forceAndTorque.segment( 3, 3 ) - expectedTorque ).norm( ), 1.0E-15 );
+    }
+
+    // Source behind panels: no force
+    {
+        Eigen::Vector6d forceAndTorque = computeSelfShadowedPanelledRadiationPressureForceAndTorque(
+                    panels, -Eigen::Vector3d::UnitX( ), Eigen::Vector3d::Zero( ), 4 );
+        BOOST_CHECK_EQUAL( forceAndTorque.norm( ), 0.0 );
+    }
+}
+
+//! Test self-shadowing model and lookup table for convex body (sphere), for which no self-shadowing should occur.
+BOOST_AUTO_TEST_CASE( testConvexBodyLookupTable )
+{
+    // Create meshed sphere
+    std::shared_ptr< geometric_shapes::SphereSegment > sphere =
+            std::make_shared< geometric_shapes::SphereSegment >( 1.0 );
+    std::shared_ptr< geometric_shapes::LawgsPartGeometry > meshedSphere =
+            std::make_shared< geometric_shapes::LawgsPartGeometry >( );
+    meshedSphere->setMesh( sphere, 11, 11 );
+
+    std::vector< SelfShadowingRadiationPressurePanel > panels =
+            createSelfShadowingRadiationPressurePanels( meshedSphere, 0.4, 0.2 );
+
+    // Compare self-shadowed force with direct sum over panels for arbitrary direction.
+    Eigen::Vector3d vectorToSource = Eigen::Vector3d( 0.3, -0.7, 0.4 ).normalized( );
+    Eigen::Vector3d unshadowedForce = Eigen::Vector3d::Zero( );
+    for( unsigned int i = 0; i < panels.size( ); i++ )
+    {
+        unshadowedForce += computeSinglePanelNormalizedRadiationPressureForce(
+                    vectorToSource, panels.at( i ).getPanelSurfaceNormal( ), panels.at( i ).getPanelArea( ),
+                    panels.at( i ).getEmissivity( ), panels.at( i ).getDiffuseReflectionCoefficient( ) );
+    }
+    Eigen::Vector6d selfShadowedForceAndTorque = computeSelfShadowedPanelledRadiationPressureForceAndTorque(
+                panels, vectorToSource, Eigen::Vector3d::Zero( ) );
+    BOOST_CHECK_SMALL( ( selfShadowedForceAndTorque.segment( 0, 3 ) - unshadowedForce ).norm( ) /
+                       unshadowedForce.norm( ), 1.0E-14 );
+
+    // Create lookup table, both serially and in parallel, and check that results are identical. Torque reference point
+    // is offset from sphere center, to obtain non-zero torque.
+    Eigen::Vector3d torqueReferencePoint = Eigen::Vector3d( 0.1, 0.2, -0.3 );
+    std::shared_ptr< PanelledRadiationPressureLookupTable > serialLookupTable =
+            std::make_shared< PanelledRadiationPressureLookupTable >(
+                panels, 36, 18, torqueReferencePoint, 1, 1 );
+    std::shared_ptr< PanelledRadiationPressureLookupTable > parallelLookupTable =
+            std::make_shared< PanelledRadiationPressureLookupTable >(
+                panels, 36, 18, torqueReferencePoint, 1, 4 );
+
+    for( int i = 0; i <= 36; i++ )
+    {
+        for( int j = 0; j <= 18; j++ )
+        {
+            for( int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_EQUAL( serialLookupTable->getTabulatedForceAndTorque( i, j )( k ),
+                                   parallelLookupTable->getTabulatedForceAndTorque( i, j )( k ) );
+            }
+        }
+    }
+
+    // Check interpolation at grid points
+    for( int i = 0; i <= 36; i += 5 )
+    {
+        for( int j = 1; j < 18; j += 4 )
+        {
+            double longitude = serialLookupTable->getGridLongitude( i );
+            double latitude = serialLookupTable->getGridLatitude( j );
+            Eigen::Vector3d gridVectorToSource = 2.0 * Eigen::Vector3d(
+                        std::cos( latitude ) * std::cos( longitude ),
+                        std::cos( latitude ) * std::sin( longitude ), std::sin( latitude ) );
+
+            Eigen::Vector6d tabulatedForceAndTorque = serialLookupTable->getTabulatedForceAndTorque( i, j );
+            BOOST_CHECK_SMALL( ( serialLookupTable->interpolateForceAndTorque( gridVectorToSource ) -
+                                 tabulatedForceAndTorque ).norm( ) / tabulatedForceAndTorque.norm( ), 1.0E-12 );
+        }
+    }
+
+    // Check interpolation between grid points (loose tolerance, as mesh is coarse)
+    Eigen::Vector3d interpolatedForce = serialLookupTable->interpolateForceAndTorque( vectorToSource ).segment( 0, 3 );
+    BOOST_CHECK_SMALL( ( interpolatedForce - unshadowedForce ).norm( ) / unshadowedForce.norm( ), 2.5E-2 );
+
+    // Check acceleration model, with body-fixed frame rotated w.r.t. propagation frame
+    Eigen::Quaterniond rotationToPropagationFrame =
+            Eigen::Quaterniond( Eigen::AngleAxisd( 0.4, Eigen::Vector3d( 0.2, 0.5, -0.3 ).normalized( ) ) );
+    double radiationPressure = 4.56E-6;
+    double mass = 400.0;
+    Eigen::Vector3d sourcePosition = 1.0E11 * ( rotationToPropagationFrame * vectorToSource );
+
+    TabulatedPanelledRadiationPressureAcceleration accelerationModel(
+                [ & ]( ){ return sourcePosition; }, [ ]( ){ return Eigen::Vector3d::Zero( ); },
+                [ & ]( ){ return rotationToPropagationFrame; }, [ & ]( ){ return radiationPressure; },
+                [ & ]( ){ return mass; }, serialLookupTable );
+    accelerationModel.updateMembers( 0.0 );
+
+    Eigen::Vector6d expectedForceAndTorque = serialLookupTable->interpolateForceAndTorque( vectorToSource );
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    accelerationModel.getAcceleration( ),
+                    ( radiationPressure / mass * ( rotationToPropagationFrame * expectedForceAndTorque.segment( 0, 3 ) ) ),
+                    1.0E-12 );
+    }
+    {
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    accelerationModel.getCurrentTorque( ),
+                    ( radiationPressure * expectedForceAndTorque.segment( 3, 3 ) ), 1.0E-12 );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -28,36 +28,35 @@ double calculateRadiationPressure( const double sourcePower, const double distan
                            distanceFromSource * physical_constants::SPEED_OF_LIGHT );
 }
 
+//! Base class function to update the current properties of radiation pressure
 void RadiationPressureInterface::updateInterfaceBase(
         const double currentTime )
 {
     currentTime_ = currentTime;
 
+    // Retrieve current positions of source and target (once per update).
+    currentSourcePosition_ = sourcePositionFunction_( );
+    currentTargetPosition_ = targetPositionFunction_( );
+
     // Calculate current radiation pressure
-    currentSolarVector_ = sourcePositionFunction_( ) - targetPositionFunction_( );
+    currentSolarVector_ = currentSourcePosition_ - currentTargetPosition_;
     double distanceFromSource = currentSolarVector_.norm( );
     currentRadiationPressure_ = calculateRadiationPressure(
                 sourcePower_( ), distanceFromSource );
 
-    // Calculate total shadowing due to occulting body; note that multiple concurrent
-    // occultations are not completely correctly (prints warning).
-    double shadowFunction = 1.0;
-    double currentShadowFunction = 1.0;
-    for( unsigned int i = 0; i < occultingBodyPositions_.size( ); i++ )
+    // Calculate total shadowing due to (possibly concurrent) occultations by all occulting bodies.
+    if( occultingBodyPositions_.size( ) > 0 )
     {
-        currentShadowFunction *= mission_geometry::computeShadowFunction(
-                    sourcePositionFunction_( ), sourceRadius_, occultingBodyPositions_[ i ]( ),
-                    occultingBodyRadii_[ i ], targetPositionFunction_( ) );
-
-        if( currentShadowFunction != 1.0 && shadowFunction != 1.0 )
+        for( unsigned int i = 0; i < occultingBodyPositions_.size( ); i++ )
         {
-            std::cerr << "Warning, multiple occultation occured in radiation pressure interface, results may be slightly in error" << std::endl;
+            currentOccultingBodyPositions_[ i ] = occultingBodyPositions_[ i ]( );
         }
 
-        shadowFunction *= currentShadowFunction;
+        currentShadowFunction_ = mission_geometry::computeMultipleOccultationShadowFunction(
+                    currentSourcePosition_, sourceRadius_, currentOccultingBodyPositions_,
+                    occultingBodyRadii_, currentTargetPosition_ );
+        currentRadiationPressure_ *= currentShadowFunction_;
     }
-
-    currentRadiationPressure_ *= shadowFunction;
 }
 
 //! Function to update the current value of the radiation pressure
@@ -59,8 +59,8 @@ public:
      *  \param radiationPressureCoefficient Reflectivity coefficient of the target body.
      *  \param area Reflecting area of the target body.
      *  \param occultingBodyPositions List of functions returning the positions of the bodies
-     *  causing occultations (default none) NOTE: Multiple concurrent occultations may currently
-     *  result in slighlty underestimted radiation pressure.
+     *  causing occultations (default none). Multiple concurrent occultations are handled by
+     *  mission_geometry::computeMultipleOccultationShadowFunction.
      *  \param occultingBodyRadii List of radii of the bodies causing occultations (default none).
      *  \param sourceRadius Radius of the source body (used for occultation calculations) (default 0).
      */
@@ -84,7 +84,11 @@ public:
         sourceRadius_( sourceRadius ),
         currentRadiationPressure_( TUDAT_NAN ),
         currentSolarVector_( Eigen::Vector3d::Zero( ) ),
-        currentTime_( TUDAT_NAN ){ }
+        currentShadowFunction_( 1.0 ),
+        currentTime_( TUDAT_NAN )
+    {
+        currentOccultingBodyPositions_.resize( occultingBodyPositions_.size( ) );
+    }
 
     //! Destructor
     virtual ~RadiationPressureInterface( ){ }
@@ -126,6 +130,17 @@ public:
         return currentSolarVector_;
     }
 
+    //! Function to return the current shadow function due to all occulting bodies.
+    /*!
+     *  Function to return the current shadow function due to all occulting bodies (1 if fully illuminated, 0 if in
+     *  full shadow), as computed by the last call to updateInterface.
+     *  \return Current shadow function due to all occulting bodies.
+     */
+    double getCurrentShadowFunction( ) const
+    {
+        return currentShadowFunction_;
+    }
+
     //! Function to return the function returning the current position of the source body.
     /*!
      *  Function to return the function returning the current position of the source body.
@@ -279,6 +294,18 @@ protected:
     //! Current vector from the target to the source.
     Eigen::Vector3d currentSolarVector_;
 
+    //! Current position of the source body.
+    Eigen::Vector3d currentSourcePosition_;
+
+    //! Current position of the target body.
+    Eigen::Vector3d currentTargetPosition_;
+
+    //! Current positions of the bodies causing occultations, retrieved once per update.
+    std::vector< Eigen::Vector3d > currentOccultingBodyPositions_;
+
+    //! Current shadow function due to all occulting bodies.
+    double currentShadowFunction_;
+
     //! Current time of interface (i.e. time of last updateInterface call).
     double currentTime_;
 };
@@ -311,8 +338,8 @@ public:
      *  \param rotationFromLocalToPropagationFrame  Vector containing the functions that return the rotation
      *  from body-fixed to propagation frame for each panel.
      *  \param occultingBodyPositions List of functions returning the positions of the bodies
-     *  causing occultations (default none) NOTE: Multiple concurrent occultations may currently
-     *  result in slighlty underestimted radiation pressure.
+     *  causing occultations (default none). Multiple concurrent occultations are handled by
+     *  mission_geometry::computeMultipleOccultationShadowFunction.
      *  \param occultingBodyRadii List of radii of the bodies causing occultations (default none).
      *  \param sourceRadius Radius of the source body (used for occultation calculations) (default 0).
      */
@@ -508,8 +535,8 @@ public:
      *  \param reflectivityCoefficient Reflectivity coefficient of the target body.
      *  \param specularReflectionCoefficient Specular reflection coefficient of the target body.
      *  \param occultingBodyPositions List of functions returning the positions of the bodies
-     *  causing occultations (default none) NOTE: Multiple concurrent occultations may currently
-     *  result in slighlty underestimted radiation pressure.
+     *  causing occultations (default none). Multiple concurrent occultations are handled by
+     *  mission_geometry::computeMultipleOccultationShadowFunction.
      *  \param centralBodyVelocity Function returning the current velocity of the central body.
      *  \param occultingBodyRadii List of radii of the bodies causing occultations (default none).
      *  \param sourceRadius Radius of the source body (used for occultation calculations) (default 0).
@@ -0,0 +1,304 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Moller, T. and Trumbore, B. Fast, Minimum Storage Ray/Triangle Intersection, Journal of Graphics Tools, 2(1),
+ *        1997.
+ *
+ */
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Astrodynamics/ElectroMagnetism/panelledRadiationPressure.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/selfShadowingPanelledRadiationPressure.h"
+#include "Tudat/Basics/parallelExecution.h"
+
+namespace tudat
+{
+
+namespace electro_magnetism
+{
+
+//! Constructor
+SelfShadowingRadiationPressurePanel::SelfShadowingRadiationPressurePanel(
+        const std::vector< Eigen::Vector3d >& panelCorners,
+        const double emissivity,
+        const double diffuseReflectionCoefficient,
+        const bool invertNormal ):
+    panelCorners_( panelCorners ), emissivity_( emissivity ),
+    diffuseReflectionCoefficient_( diffuseReflectionCoefficient )
+{
+    if( panelCorners_.size( ) != 4 )
+    {
+        throw std::runtime_error( "Error when creating self-shadowing radiation pressure panel, 4 corners required, " +
+                                  std::to_string( panelCorners_.size( ) ) + " provided" );
+    }
+
+    // Compute panel properties, consistent with QuadrilateralMeshedSurfaceGeometry::performPanelCalculations
+    panelCentroid_ = ( panelCorners_.at( 0 ) + panelCorners_.at( 1 ) + panelCorners_.at( 2 ) + panelCorners_.at( 3 ) ) / 4.0;
+
+    Eigen::Vector3d firstDiagonal = panelCorners_.at( 2 ) - panelCorners_.at( 0 );
+    Eigen::Vector3d secondDiagonal = panelCorners_.at( 1 ) - panelCorners_.at( 3 );
+    panelSurfaceNormal_ = firstDiagonal.cross( secondDiagonal );
+    panelArea_ = 0.5 * panelSurfaceNormal_.norm( );
+    panelSurfaceNormal_.normalize( );
+
+    if( invertNormal )
+    {
+        panelSurfaceNormal_ *= -1.0;
+    }
+
+    characteristicSize_ = std::max( firstDiagonal.norm( ), secondDiagonal.norm( ) );
+}
+
+//! Function to determine whether a ray intersects the panel.
+bool SelfShadowingRadiationPressurePanel::isIntersectedByRay(
+        const Eigen::Vector3d& rayOrigin, const Eigen::Vector3d& rayDirection, const double minimumDistance ) const
+{
+    return isTriangleIntersectedByRay( rayOrigin, rayDirection, minimumDistance,
+                                       panelCorners_.at( 0 ), panelCorners_.at( 1 ), panelCorners_.at( 2 ) ) ||
+            isTriangleIntersectedByRay( rayOrigin, rayDirection, minimumDistance,
+                                        panelCorners_.at( 0 ), panelCorners_.at( 2 ), panelCorners_.at( 3 ) );
+}
+
+//! Function to determine whether a ray intersects a triangle (Moller and Trumbore, 1997).
+bool SelfShadowingRadiationPressurePanel::isTriangleIntersectedByRay(
+        const Eigen::Vector3d& rayOrigin, const Eigen::Vector3d& rayDirection, const double minimumDistance,
+        const Eigen::Vector3d& firstCorner, const Eigen::Vector3d& secondCorner, const Eigen::Vector3d& thirdCorner )
+{
+    Eigen::Vector3d firstEdge = secondCorner - firstCorner;
+    Eigen::Vector3d secondEdge = thirdCorner - firstCorner;
+
+    // Check if ray is parallel to triangle.
+    Eigen::Vector3d directionCrossSecondEdge = rayDirection.cross( secondEdge );
+    double determinant = firstEdge.dot( directionCrossSecondEdge );
+    if( std::fabs( determinant ) < std::numeric_limits< double >::epsilon( ) * firstEdge.squaredNorm( ) )
+    {
+        return false;
+    }
+
+    // Compute barycentric coordinates of intersection, and check whether they lie inside triangle.
+    double inverseDeterminant = 1.0 / determinant;
+    Eigen::Vector3d originOffset = rayOrigin - firstCorner;
+    double firstBarycentricCoordinate = inverseDeterminant * originOffset.dot( directionCrossSecondEdge );
+    if( firstBarycentricCoordinate < 0.0 || firstBarycentricCoordinate > 1.0 )
+    {
+        return false;
+    }
+
+    Eigen::Vector3d offsetCrossFirstEdge = originOffset.cross( firstEdge );
+    double secondBarycentricCoordinate = inverseDeterminant * rayDirection.dot( offsetCrossFirstEdge );
+    if( secondBarycentricCoordinate < 0.0 || firstBarycentricCoordinate + secondBarycentricCoordinate > 1.0 )
+    {
+        return false;
+    }
+
+    // Check whether intersection is in positive ray direction.
+    return ( inverseDeterminant * secondEdge.dot( offsetCrossFirstEdge ) > minimumDistance );
+}
+
+//! Function to create the list of self-shadowing panels from a meshed surface geometry.
+std::vector< SelfShadowingRadiationPressurePanel > createSelfShadowingRadiationPressurePanels(
+        const std::shared_ptr< geometric_shapes::QuadrilateralMeshedSurfaceGeometry > meshedSurface,
+        const double emissivity,
+        const double diffuseReflectionCoefficient )
+{
+    std::vector< SelfShadowingRadiationPressurePanel > panels;
+    for( int i = 0; i < meshedSurface->getNumberOfLines( ) - 1; i++ )
+    {
+        for( int j = 0; j < meshedSurface->getNumberOfPoints( ) - 1; j++ )
+        {
+            // Skip degenerate panels (e.g. at poles of surface geometry)
+            if( meshedSurface->getPanelArea( i, j ) > 0.0 )
+            {
+                std::vector< Eigen::Vector3d > panelCorners =
+                { meshedSurface->getMeshPoint( i, j ), meshedSurface->getMeshPoint( i + 1, j ),
+                  meshedSurface->getMeshPoint( i + 1, j + 1 ), meshedSurface->getMeshPoint( i, j + 1 ) };
+
+                // Create panel, and ensure that its normal is consistent with that of meshed surface (which includes
+                // reversal operator)
+                SelfShadowingRadiationPressurePanel currentPanel(
+                            panelCorners, emissivity, diffuseReflectionCoefficient );
+                if( currentPanel.getPanelSurfaceNormal( ).dot( meshedSurface->getPanelSurfaceNormal( i, j ) ) < 0.0 )
+                {
+                    currentPanel = SelfShadowingRadiationPressurePanel(
+                                panelCorners, emissivity, diffuseReflectionCoefficient, true );
+                }
+                panels.push_back( currentPanel );
+            }
+        }
+    }
+    return panels;
+}
+
+//! Function to compute the radiation pressure force and torque on a set of panels, including self-shadowing.
+Eigen::Vector6d computeSelfShadowedPanelledRadiationPressureForceAndTorque(
+        const std::vector< SelfShadowingRadiationPressurePanel >& panels,
+        const Eigen::Vector3d& normalizedVectorToSource,
+        const Eigen::Vector3d& torqueReferencePoint,
+        const int numberOfRaysPerPanelSide )
+{
+    if( numberOfRaysPerPanelSide < 1 )
+    {
+        throw std::runtime_error( "Error when computing self-shadowed radiation pressure, number of rays per side must be positive" );
+    }
+
+    Eigen::Vector6d forceAndTorque = Eigen::Vector6d::Zero( );
+    double subPanelFraction = 1.0 / static_cast< double >( numberOfRaysPerPanelSide * numberOfRaysPerPanelSide );
+
+    Eigen::Vector3d currentPanelForce, currentRayOrigin;
+    for( unsigned int i = 0; i < panels.size( ); i++ )
+    {
+        const SelfShadowingRadiationPressurePanel& currentPanel = panels.at( i );
+
+        // Compute force on full panel; skip if panel is not facing source.
+        currentPanelForce = computeSinglePanelNormalizedRadiationPressureForce(
+                    normalizedVectorToSource, currentPanel.getPanelSurfaceNormal( ), currentPanel.getPanelArea( ),
+                    currentPanel.getEmissivity( ), currentPanel.getDiffuseReflectionCoefficient( ) );
+        if( currentPanelForce.isZero( 0.0 ) )
+        {
+            continue;
+        }
+
+        // Iterate over sub-panels, and trace ray from sub-panel center to source.
+        double minimumDistance = 1.0E-8 * currentPanel.getCharacteristicSize( );
+        for( int j = 0; j < numberOfRaysPerPanelSide; j++ )
+        {
+            for( int k = 0; k < numberOfRaysPerPanelSide; k++ )
+            {
+                currentRayOrigin = currentPanel.getPanelPoint(
+                            ( static_cast< double >( j ) + 0.5 ) / static_cast< double >( numberOfRaysPerPanelSide ),
+                            ( static_cast< double >( k ) + 0.5 ) / static_cast< double >( numberOfRaysPerPanelSide ) );
+
+                bool isSubPanelShadowed = false;
+                for( unsigned int l = 0; l < panels.size( ); l++ )
+                {
+                    if( l != i && panels.at( l ).isIntersectedByRay(
+                                currentRayOrigin, normalizedVectorToSource, minimumDistance ) )
+                    {
+                        isSubPanelShadowed = true;
+                        break;
+                    }
+                }
+
+                // Add contribution of illuminated sub-panel.
+                if( !isSubPanelShadowed )
+                {
+                    forceAndTorque.segment( 0, 3 ) += subPanelFraction * currentPanelForce;
+                    forceAndTorque.segment( 3, 3 ) += subPanelFraction *
+                            ( currentRayOrigin - torqueReferencePoint ).cross( currentPanelForce );
+                }
+            }
+        }
+    }
+
+    return forceAndTorque;
+}
+
+//! Constructor, computes the force and torque at all grid points.
+PanelledRadiationPressureLookupTable::PanelledRadiationPressureLookupTable(
+        const std::vector< SelfShadowingRadiationPressurePanel >& panels,
+        const int numberOfLongitudeIntervals,
+        const int numberOfLatitudeIntervals,
+        const Eigen::Vector3d& torqueReferencePoint,
+        const int numberOfRaysPerPanelSide,
+        const unsigned int numberOfThreads ):
+    numberOfLongitudeIntervals_( numberOfLongitudeIntervals ),
+    numberOfLatitudeIntervals_( numberOfLatitudeIntervals ),
+    torqueReferencePoint_( torqueReferencePoint )
+{
+    if( numberOfLongitudeIntervals_ < 1 || numberOfLatitudeIntervals_ < 1 )
+    {
+        throw std::runtime_error( "Error when creating panelled radiation pressure lookup table, number of intervals must be positive" );
+    }
+
+    longitudeStep_ = 2.0 * mathematical_constants::PI / static_cast< double >( numberOfLongitudeIntervals_ );
+    latitudeStep_ = mathematical_constants::PI / static_cast< double >( numberOfLatitudeIntervals_ );
+
+    // Compute all entries of table in parallel; entries at longitude pi are copied from those at -pi afterwards.
+    forceAndTorqueTable_.resize( 6, ( numberOfLongitudeIntervals_ + 1 ) * ( numberOfLatitudeIntervals_ + 1 ) );
+    utilities::executeParallelForLoop(
+                numberOfLongitudeIntervals_ * ( numberOfLatitudeIntervals_ + 1 ),
+                [ & ]( const unsigned int gridIndex, const unsigned int )
+    {
+        int longitudeIndex = gridIndex % numberOfLongitudeIntervals_;
+        int latitudeIndex = gridIndex / numberOfLongitudeIntervals_;
+
+        double longitude = getGridLongitude( longitudeIndex );
+        double latitude = getGridLatitude( latitudeIndex );
+        Eigen::Vector3d normalizedVectorToSource =
+                ( Eigen::Vector3d( ) << std::cos( latitude ) * std::cos( longitude ),
+                  std::cos( latitude ) * std::sin( longitude ), std::sin( latitude ) ).finished( );
+
+        forceAndTorqueTable_.col( getGridPointIndex( longitudeIndex, latitudeIndex ) ) =
+                computeSelfShadowedPanelledRadiationPressureForceAndTorque(
+                    panels, normalizedVectorToSource, torqueReferencePoint_, numberOfRaysPerPanelSide );
+    }, numberOfThreads );
+
+    for( int i = 0; i <= numberOfLatitudeIntervals_; i++ )
+    {
+        forceAndTorqueTable_.col( getGridPointIndex( numberOfLongitudeIntervals_, i ) ) =
+                forceAndTorqueTable_.col( getGridPointIndex( 0, i ) );
+    }
+}
+
+//! Function to interpolate the force and torque for a given direction to the source.
+Eigen::Vector6d PanelledRadiationPressureLookupTable::interpolateForceAndTorque(
+        const Eigen::Vector3d& vectorToSource ) const
+{
+    // Compute spherical coordinates of vector to source
+    double longitude = std::atan2( vectorToSource.y( ), vectorToSource.x( ) );
+    double latitude = std::asin( std::max( -1.0, std::min( 1.0, vectorToSource.z( ) / vectorToSource.norm( ) ) ) );
+
+    // Determine grid cell directly from equidistant grid spacing.
+    double scaledLongitude = ( longitude + mathematical_constants::PI ) / longitudeStep_;
+    double scaledLatitude = ( latitude + mathematical_constants::PI / 2.0 ) / latitudeStep_;
+
+    int longitudeIndex = std::min( std::max( static_cast< int >( std::floor( scaledLongitude ) ), 0 ),
+                                   numberOfLongitudeIntervals_ - 1 );
+    int latitudeIndex = std::min( std::max( static_cast< int >( std::floor( scaledLatitude ) ), 0 ),
+                                  numberOfLatitudeIntervals_ - 1 );
+
+    double longitudeFraction = scaledLongitude - static_cast< double >( longitudeIndex );
+    double latitudeFraction = scaledLatitude - static_cast< double >( latitudeIndex );
+
+    // Perform bilinear interpolation
+    return ( 1.0 - latitudeFraction ) * (
+                ( 1.0 - longitudeFraction ) * forceAndTorqueTable_.col( getGridPointIndex( longitudeIndex, latitudeIndex ) ) +
+                longitudeFraction * forceAndTorqueTable_.col( getGridPointIndex( longitudeIndex + 1, latitudeIndex ) ) ) +
+            latitudeFraction * (
+                ( 1.0 - longitudeFraction ) * forceAndTorqueTable_.col( getGridPointIndex( longitudeIndex, latitudeIndex + 1 ) ) +
+                longitudeFraction * forceAndTorqueTable_.col( getGridPointIndex( longitudeIndex + 1, latitudeIndex + 1 ) ) );
+}
+
+//! Constructor for setting up the acceleration model, with input RadiationPressureInterface
+TabulatedPanelledRadiationPressureAcceleration::TabulatedPanelledRadiationPressureAcceleration(
+        const std::shared_ptr< RadiationPressureInterface > radiationPressureInterface,
+        const std::function< Eigen::Quaterniond( ) > rotationFromBodyFixedToPropagationFrameFunction,
+        const std::function< double( ) > massFunction,
+        const std::shared_ptr< PanelledRadiationPressureLookupTable > lookupTable ):
+    rotationFromBodyFixedToPropagationFrameFunction_( rotationFromBodyFixedToPropagationFrameFunction ),
+    massFunction_( massFunction ),
+    lookupTable_( lookupTable ),
+    currentAcceleration_( Eigen::Vector3d::Zero( ) ),
+    currentTorque_( Eigen::Vector3d::Zero( ) )
+{
+    sourcePositionFunction_ =
+            std::bind( &RadiationPressureInterface::getCurrentSolarVector, radiationPressureInterface );
+    acceleratedBodyPositionFunction_ = [ ]( ){ return Eigen::Vector3d::Zero( ); };
+    radiationPressureFunction_ =
+            std::bind( &RadiationPressureInterface::getCurrentRadiationPressure, radiationPressureInterface );
+}
+
+} // namespace electro_magnetism
+
+} // namespace tudat
@@ -0,0 +1,556 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Moller, T. and Trumbore, B. Fast, Minimum Storage Ray/Triangle Intersection, Journal of Graphics Tools, 2(1),
+ *        1997.
+ *
+ */
+
+#ifndef TUDAT_SELFSHADOWINGPANELLEDRADIATIONPRESSURE_H
+#define TUDAT_SELFSHADOWINGPANELLEDRADIATIONPRESSURE_H
+
+#include <vector>
+
+#include <memory>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
+#include "Tudat/Astrodynamics/ElectroMagnetism/radiationPressureInterface.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/GeometricShapes/quadrilateralMeshedSurfaceGeometry.h"
+
+namespace tudat
+{
+
+namespace electro_magnetism
+{
+
+//! Class describing the geometry and optical properties of a single quadrilateral panel, for use in self-shadowing
+//! radiation pressure computations.
+/*!
+ *  Class describing the geometry and optical properties of a single quadrilateral panel, for use in self-shadowing
+ *  radiation pressure computations. All geometric properties are defined in the body-fixed frame of the vehicle. The
+ *  panel normal is computed from the corner points in the same manner as in QuadrilateralMeshedSurfaceGeometry (i.e.
+ *  from the cross product of the diagonals (corner 2 - corner 0) x (corner 1 - corner 3)), so that the corners of a
+ *  mesh panel ( i, j ), ( i + 1, j ), ( i + 1, j + 1 ), ( i, j + 1 ) may be passed in order.
+ */
+class SelfShadowingRadiationPressurePanel
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param panelCorners Corner points of the panel, in body-fixed frame, ordered along the panel boundary.
+     *  \param emissivity Emissivity of the panel
+     *  \param diffuseReflectionCoefficient Diffuse reflection coefficient of the panel
+     *  \param invertNormal Boolean denoting whether the panel normal computed from the corner points is to be inverted
+     */
+    SelfShadowingRadiationPressurePanel(
+            const std::vector< Eigen::Vector3d >& panelCorners,
+            const double emissivity,
+            const double diffuseReflectionCoefficient,
+            const bool invertNormal = false );
+
+    //! Function to determine whether a ray intersects the panel.
+    /*!
+     *  Function to determine whether a ray intersects the panel, computed by splitting the panel into two triangles and
+     *  applying the algorithm of Moller and Trumbore (1997) to each.
+     *  \param rayOrigin Origin of the ray
+     *  \param rayDirection Direction of the ray (need not be normalized)
+     *  \param minimumDistance Minimum value of the ray parameter for which an intersection is registered, used to
+     *  prevent a panel from shadowing points on its own surface.
+     *  \return True if the ray intersects the panel, false otherwise.
+     */
+    bool isIntersectedByRay( const Eigen::Vector3d& rayOrigin, const Eigen::Vector3d& rayDirection,
+                             const double minimumDistance ) const;
+
+    //! Function to retrieve a point on the panel, from (bilinear) panel coordinates.
+    /*!
+     *  Function to retrieve a point on the panel, from (bilinear) panel coordinates.
+     *  \param firstCoordinate First panel coordinate (0 at side 0-3, 1 at side 1-2)
+     *  \param secondCoordinate Second panel coordinate (0 at side 0-1, 1 at side 2-3)
+     *  \return Point on the panel
+     */
+    Eigen::Vector3d getPanelPoint( const double firstCoordinate, const double secondCoordinate ) const
+    {
+        return ( 1.0 - secondCoordinate ) * ( ( 1.0 - firstCoordinate ) * panelCorners_.at( 0 ) +
+                                              firstCoordinate * panelCorners_.at( 1 ) ) +
+                secondCoordinate * ( ( 1.0 - firstCoordinate ) * panelCorners_.at( 3 ) +
+                                     firstCoordinate * panelCorners_.at( 2 ) );
+    }
+
+    //! Function to retrieve the panel corner points.
+    /*!
+     *  Function to retrieve the panel corner points.
+     *  \return Panel corner points
+     */
+    std::vector< Eigen::Vector3d > getPanelCorners( ) const
+    {
+        return panelCorners_;
+    }
+
+    //! Function to retrieve the panel centroid.
+    /*!
+     *  Function to retrieve the panel centroid.
+     *  \return Panel centroid
+     */
+    Eigen::Vector3d getPanelCentroid( ) const
+    {
+        return panelCentroid_;
+    }
+
+    //! Function to retrieve the (outward) panel surface normal.
+    /*!
+     *  Function to retrieve the (outward) panel surface normal.
+     *  \return Panel surface normal
+     */
+    Eigen::Vector3d getPanelSurfaceNormal( ) const
+    {
+        return panelSurfaceNormal_;
+    }
+
+    //! Function to retrieve the panel area.
+    /*!
+     *  Function to retrieve the panel area.
+     *  \return Panel area
+     */
+    double getPanelArea( ) const
+    {
+        return panelArea_;
+    }
+
+    //! Function to retrieve the panel emissivity.
+    /*!
+     *  Function to retrieve the panel emissivity.
+     *  \return Panel emissivity
+     */
+    double getEmissivity( ) const
+    {
+        return emissivity_;
+    }
+
+    //! Function to retrieve the panel diffuse reflection coefficient.
+    /*!
+     *  Function to retrieve the panel diffuse reflection coefficient.
+     *  \return Panel diffuse reflection coefficient
+     */
+    double getDiffuseReflectionCoefficient( ) const
+    {
+        return diffuseReflectionCoefficient_;
+    }
+
+    //! Function to retrieve the characteristic size of the panel (length of its longest diagonal).
+    /*!
+     *  Function to retrieve the characteristic size of the panel (length of its longest diagonal).
+     *  \return Characteristic size of the panel
+     */
+    double getCharacteristicSize( ) const
+    {
+        return characteristicSize_;
+    }
+
+private:
+
+    //! Function to determine whether a ray intersects a triangle (Moller and Trumbore, 1997).
+    /*!
+     *  Function to determine whether a ray intersects a triangle (Moller and Trumbore, 1997).
+     *  \param rayOrigin Origin of the ray
+     *  \param rayDirection Direction of the ray
+     *  \param minimumDistance Minimum value of the ray parameter for which an intersection is registered.
+     *  \param firstCorner First corner of triangle
+     *  \param secondCorner Second corner of triangle
+     *  \param thirdCorner Third corner of triangle
+     *  \return True if the ray intersects the triangle, false otherwise.
+     */
+    static bool isTriangleIntersectedByRay(
+            const Eigen::Vector3d& rayOrigin, const Eigen::Vector3d& rayDirection, const double minimumDistance,
+            const Eigen::Vector3d& firstCorner, const Eigen::Vector3d& secondCorner, const Eigen::Vector3d& thirdCorner );
+
+    //! Corner points of the panel, in body-fixed frame.
+    std::vector< Eigen::Vector3d > panelCorners_;
+
+    //! Centroid of the panel.
+    Eigen::Vector3d panelCentroid_;
+
+    //! Outward surface normal of the panel.
+    Eigen::Vector3d panelSurfaceNormal_;
+
+    //! Area of the panel.
+    double panelArea_;
+
+    //! Emissivity of the panel.
+    double emissivity_;
+
+    //! Diffuse reflection coefficient of the panel.
+    double diffuseReflectionCoefficient_;
+
+    //! Characteristic size of the panel (length of its longest diagonal).
+    double characteristicSize_;
+};
+
+//! Function to create the list of self-shadowing panels from a meshed surface geometry.
+/*!
+ *  Function to create the list of self-shadowing panels from a meshed surface geometry (e.g. a LawgsPartGeometry
+ *  created from any of the Mathematics/GeometricShapes surface geometries), with all panels having the same optical
+ *  properties.
+ *  \param meshedSurface Meshed surface geometry from which the panels are to be created.
+ *  \param emissivity Emissivity of all panels
+ *  \param diffuseReflectionCoefficient Diffuse reflection coefficient of all panels
+ *  \return List of panels defining the meshed surface.
+ */
+std::vector< SelfShadowingRadiationPressurePanel > createSelfShadowingRadiationPressurePanels(
+        const std::shared_ptr< geometric_shapes::QuadrilateralMeshedSurfaceGeometry > meshedSurface,
+        const double emissivity,
+        const double diffuseReflectionCoefficient );
+
+//! Function to compute the radiation pressure force and torque on a set of panels, including self-shadowing.
+/*!
+ *  Function to compute the radiation pressure force and torque on a set of panels, including self-shadowing by the
+ *  panels themselves. Each panel is subdivided into numberOfRaysPerPanelSide x numberOfRaysPerPanelSide sub-panels, from
+ *  the center of each of which a ray is traced towards the source. The sub-panel only contributes to the force and torque
+ *  if this ray is not intersected by any of the other panels. The force on each illuminated sub-panel is computed
+ *  from computeSinglePanelNormalizedRadiationPressureForce.
+ *  \param panels List of panels of which the vehicle is composed.
+ *  \param normalizedVectorToSource Normalized vector from the vehicle to the source, in body-fixed frame
+ *  \param torqueReferencePoint Point w.r.t. which the torque is computed (typically the center of mass).
+ *  \param numberOfRaysPerPanelSide Number of rays per panel side used to determine the illuminated part of each panel.
+ *  \return Force (first three entries) and torque (last three entries), in body-fixed frame, for a radiation pressure
+ *  of 1 N/m^2.
+ */
+Eigen::Vector6d computeSelfShadowedPanelledRadiationPressureForceAndTorque(
+        const std::vector< SelfShadowingRadiationPressurePanel >& panels,
+        const Eigen::Vector3d& normalizedVectorToSource,
+        const Eigen::Vector3d& torqueReferencePoint,
+        const int numberOfRaysPerPanelSide = 1 );
+
+//! Class storing a precomputed table of (self-shadowed) radiation pressure force and torque, as a function of the
+//! direction to the source in the body-fixed frame.
+/*!
+ *  Class storing a precomputed table of (self-shadowed) radiation pressure force and torque, as a function of the
+ *  direction to the source in the body-fixed frame. The direction is parameterized by its longitude (in [-pi, pi]) and
+ *  latitude (in [-pi/2, pi/2]) in the body-fixed frame, on an equidistant grid that includes both poles and for which the
+ *  longitude grid is periodic. At each grid point, the force and torque are computed by ray-tracing with the
+ *  computeSelfShadowedPanelledRadiationPressureForceAndTorque function; this offline computation is distributed over a
+ *  number of threads. During propagation, the force and torque are retrieved by bilinear interpolation on the spherical
+ *  grid, for which the cell is determined directly from the grid spacing.
+ */
+class PanelledRadiationPressureLookupTable
+{
+public:
+
+    //! Constructor, computes the force and torque at all grid points.
+    /*!
+     *  Constructor, computes the force and torque at all grid points.
+     *  \param panels List of panels of which the vehicle is composed (in body-fixed frame).
+     *  \param numberOfLongitudeIntervals Number of intervals into which the longitude range [-pi, pi] is divided.
+     *  \param numberOfLatitudeIntervals Number of intervals into which the latitude range [-pi/2, pi/2] is divided.
+     *  \param torqueReferencePoint Point w.r.t. which the torque is computed (typically the center of mass).
+     *  \param numberOfRaysPerPanelSide Number of rays per panel side used to determine the illuminated part of each panel.
+     *  \param numberOfThreads Number of threads used to compute the table (0 to use the hardware default).
+     */
+    PanelledRadiationPressureLookupTable(
+            const std::vector< SelfShadowingRadiationPressurePanel >& panels,
+            const int numberOfLongitudeIntervals,
+            const int numberOfLatitudeIntervals,
+            const Eigen::Vector3d& torqueReferencePoint = Eigen::Vector3d::Zero( ),
+            const int numberOfRaysPerPanelSide = 1,
+            const unsigned int numberOfThreads = 0 );
+
+    //! Function to interpolate the force and torque for a given direction to the source.
+    /*!
+     *  Function to interpolate the force and torque for a given direction to the source, by bilinear interpolation
+     *  in longitude and latitude of the direction.
+     *  \param vectorToSource Vector from the vehicle to the source, in body-fixed frame (need not be normalized).
+     *  \return Force (first three entries) and torque (last three entries), in body-fixed frame, for a radiation pressure
+     *  of 1 N/m^2.
+     */
+    Eigen::Vector6d interpolateForceAndTorque( const Eigen::Vector3d& vectorToSource ) const;
+
+    //! Function to retrieve the tabulated force and torque at a given grid point.
+    /*!
+     *  Function to retrieve the tabulated force and torque at a given grid point.
+     *  \param longitudeIndex Index of the grid point in longitude direction
+     *  \param latitudeIndex Index of the grid point in latitude direction
+     *  \return Force (first three entries) and torque (last three entries) at grid point.
+     */
+    Eigen::Vector6d getTabulatedForceAndTorque( const int longitudeIndex, const int latitudeIndex ) const
+    {
+        return forceAndTorqueTable_.col( getGridPointIndex( longitudeIndex, latitudeIndex ) );
+    }
+
+    //! Function to retrieve the longitude of a given grid point.
+    /*!
+     *  Function to retrieve the longitude of a given grid point.
+     *  \param longitudeIndex Index of the grid point in longitude direction
+     *  \return Longitude of the grid point
+     */
+    double getGridLongitude( const int longitudeIndex ) const
+    {
+        return -mathematical_constants::PI + static_cast< double >( longitudeIndex ) * longitudeStep_;
+    }
+
+    //! Function to retrieve the latitude of a given grid point.
+    /*!
+     *  Function to retrieve the latitude of a given grid point.
+     *  \param latitudeIndex Index of the grid point in latitude direction
+     *  \return Latitude of the grid point
+     */
+    double getGridLatitude( const int latitudeIndex ) const
+    {
+        return -mathematical_constants::PI / 2.0 + static_cast< double >( latitudeIndex ) * latitudeStep_;
+    }
+
+    //! Function to retrieve the number of longitude intervals of the grid.
+    /*!
+     *  Function to retrieve the number of longitude intervals of the grid.
+     *  \return Number of longitude intervals of the grid.
+     */
+    int getNumberOfLongitudeIntervals( ) const
+    {
+        return numberOfLongitudeIntervals_;
+    }
+
+    //! Function to retrieve the number of latitude intervals of the grid.
+    /*!
+     *  Function to retrieve the number of latitude intervals of the grid.
+     *  \return Number of latitude intervals of the grid.
+     */
+    int getNumberOfLatitudeIntervals( ) const
+    {
+        return numberOfLatitudeIntervals_;
+    }
+
+    //! Function to retrieve the point w.r.t. which the torque is computed.
+    /*!
+     *  Function to retrieve the point w.r.t. which the torque is computed.
+     *  \return Point w.r.t. which the torque is computed.
+     */
+    Eigen::Vector3d getTorqueReferencePoint( ) const
+    {
+        return torqueReferencePoint_;
+    }
+
+private:
+
+    //! Function to retrieve the column index in forceAndTorqueTable_ of a given grid point.
+    /*!
+     *  Function to retrieve the column index in forceAndTorqueTable_ of a given grid point.
+     *  \param longitudeIndex Index of the grid point in longitude direction
+     *  \param latitudeIndex Index of the grid point in latitude direction
+     *  \return Column index in forceAndTorqueTable_
+     */
+    int getGridPointIndex( const int longitudeIndex, const int latitudeIndex ) const
+    {
+        return latitudeIndex * ( numberOfLongitudeIntervals_ + 1 ) + longitudeIndex;
+    }
+
+    //! Number of intervals into which the longitude range [-pi, pi] is divided.
+    int numberOfLongitudeIntervals_;
+
+    //! Number of intervals into which the latitude range [-pi/2, pi/2] is divided.
+    int numberOfLatitudeIntervals_;
+
+    //! Longitude step of the grid
+    double longitudeStep_;
+
+    //! Latitude step of the grid
+    double latitudeStep_;
+
+    //! Point w.r.t. which the torque is computed.
+    Eigen::Vector3d torqueReferencePoint_;
+
+    //! Tabulated force and torque, each column containing one grid point (latitude index major).
+    Eigen::Matrix< double, 6, Eigen::Dynamic > forceAndTorqueTable_;
+};
+
+//! Class for calculating the radiation pressure acceleration on a panelled body from a precomputed (self-shadowing)
+//! lookup table.
+/*!
+ *  Class for calculating the radiation pressure acceleration on a panelled body from a precomputed lookup table, in which
+ *  the self-shadowing of the panels is included (see PanelledRadiationPressureLookupTable). Per evaluation, only the
+ *  direction to the source in the body-fixed frame is computed, after which the force and torque are interpolated from
+ *  the table. The torque in the body-fixed frame is computed simultaneously, and may be retrieved from the
+ *  getCurrentTorque function.
+ */
+class TabulatedPanelledRadiationPressureAcceleration: public basic_astrodynamics::AccelerationModel< Eigen::Vector3d >
+{
+public:
+
+    //! Constructor for setting up the acceleration model, with separate input variables for all required data.
+    /*!
+     *  Constructor for setting up the acceleration model, with separate input variables for all required data.
+     *  \param sourcePositionFunction Function providing current position for the source body (i.e. the body from which the
+     *  radiation originates)
+     *  \param acceleratedBodyPositionFunction Function providing current position for the body on which the force is acting
+     *  \param rotationFromBodyFixedToPropagationFrameFunction Function returning the current rotation from the body-fixed
+     *  frame (in which the lookup table is defined) to the propagation frame.
+     *  \param radiationPressureFunction Function returning the current radiation pressure (i.e. incident flux, in W/m^2,
+     *  divided by speed of light)
+     *  \param massFunction Function returning the current mass of the body being accelerated
+     *  \param lookupTable Precomputed force and torque lookup table.
+     */
+    TabulatedPanelledRadiationPressureAcceleration(
+            const std::function< Eigen::Vector3d( ) > sourcePositionFunction,
+            const std::function< Eigen::Vector3d( ) > acceleratedBodyPositionFunction,
+            const std::function< Eigen::Quaterniond( ) > rotationFromBodyFixedToPropagationFrameFunction,
+            const std::function< double( ) > radiationPressureFunction,
+            const std::function< double( ) > massFunction,
+            const std::shared_ptr< PanelledRadiationPressureLookupTable > lookupTable ):
+        sourcePositionFunction_( sourcePositionFunction ),
+        acceleratedBodyPositionFunction_( acceleratedBodyPositionFunction ),
+        rotationFromBodyFixedToPropagationFrameFunction_( rotationFromBodyFixedToPropagationFrameFunction ),
+        radiationPressureFunction_( radiationPressureFunction ),
+        massFunction_( massFunction ),
+        lookupTable_( lookupTable ),
+        currentAcceleration_( Eigen::Vector3d::Zero( ) ),
+        currentTorque_( Eigen::Vector3d::Zero( ) ){ }
+
+    //! Constructor for setting up the acceleration model, with input RadiationPressureInterface
+    /*!
+     *  Constructor for setting up the acceleration model, with input RadiationPressureInterface, from which the
+     *  current vector to the source and (occulted) radiation pressure are retrieved.
+     *  \param radiationPressureInterface Object in which radiation pressure properties of accelerated body due to radiation
+     *  from body causing acceleration is stored.
+     *  \param rotationFromBodyFixedToPropagationFrameFunction Function returning the current rotation from the body-fixed
+     *  frame (in which the lookup table is defined) to the propagation frame.
+     *  \param massFunction Function returning the current mass of the body being accelerated
+     *  \param lookupTable Precomputed force and torque lookup table.
+     */
+    TabulatedPanelledRadiationPressureAcceleration(
+            const std::shared_ptr< RadiationPressureInterface > radiationPressureInterface,
+            const std::function< Eigen::Quaterniond( ) > rotationFromBodyFixedToPropagationFrameFunction,
+            const std::function< double( ) > massFunction,
+            const std::shared_ptr< PanelledRadiationPressureLookupTable > lookupTable );
+
+    //! Get radiation pressure acceleration.
+    /*!
+     * Returns the radiation pressure acceleration, as computed by last call to updateMembers.
+     * \return acceleration.
+     */
+    Eigen::Vector3d getAcceleration( )
+    {
+        return currentAcceleration_;
+    }
+
+    //! Update member variables used by the radiation pressure acceleration model.
+    /*!
+     * Updates member variables used by the acceleration model, retrieving the force and torque from the lookup table
+     * \param currentTime Time at which acceleration model is to be updated.
+     */
+    void updateMembers( const double currentTime = TUDAT_NAN )
+    {
+        if( !( this->currentTime_ == currentTime ) )
+        {
+            currentRadiationPressure_ = radiationPressureFunction_( );
+            currentMass_ = massFunction_( );
+
+            if( currentRadiationPressure_ > 0.0 )
+            {
+                // Compute vector to source in body-fixed frame, and interpolate force/torque.
+                Eigen::Quaterniond rotationToPropagationFrame = rotationFromBodyFixedToPropagationFrameFunction_( );
+                Eigen::Vector6d currentForceAndTorque = currentRadiationPressure_ * lookupTable_->interpolateForceAndTorque(
+                            rotationToPropagationFrame.inverse( ) *
+                            ( sourcePositionFunction_( ) - acceleratedBodyPositionFunction_( ) ) );
+
+                currentAcceleration_ = rotationToPropagationFrame * currentForceAndTorque.segment( 0, 3 ) / currentMass_;
+                currentTorque_ = currentForceAndTorque.segment( 3, 3 );
+            }
+            else
+            {
+                currentAcceleration_.setZero( );
+                currentTorque_.setZero( );
+            }
+            this->currentTime_ = currentTime;
+        }
+    }
+
+    //! Function to retrieve the current radiation pressure torque, in body-fixed frame.
+    /*!
+     *  Function to retrieve the current radiation pressure torque, in body-fixed frame, as computed by last call to
+     *  updateMembers.
+     *  \return Current radiation pressure torque, in body-fixed frame.
+     */
+    Eigen::Vector3d getCurrentTorque( )
+    {
+        return currentTorque_;
+    }
+
+    //! Returns the function returning the current mass of the body being accelerated.
+    /*!
+     *  Returns the function returning the current mass of the body being accelerated.
+     *  \return Function returning the current mass of the body being accelerated.
+     */
+    std::function< double( ) > getMassFunction( )
+    {
+        return massFunction_;
+    }
+
+    //! Returns the current radiation pressure at the accelerated body
+    /*!
+     *  Returns the current radiation pressure at the accelerated body, as set by the last call to the updateMembers function
+     *  \return The current radiation pressure at the accelerated body
+     */
+    double getCurrentRadiationPressure( )
+    {
+        return currentRadiationPressure_;
+    }
+
+    //! Function to retrieve the lookup table from which the force and torque are computed.
+    /*!
+     *  Function to retrieve the lookup table from which the force and torque are computed.
+     *  \return Lookup table from which the force and torque are computed.
+     */
+    std::shared_ptr< PanelledRadiationPressureLookupTable > getLookupTable( )
+    {
+        return lookupTable_;
+    }
+
+private:
+
+    //! Function pointer returning position of source.
+    std::function< Eigen::Vector3d( ) > sourcePositionFunction_;
+
+    //! Function pointer returning position of accelerated body.
+    std::function< Eigen::Vector3d( ) > acceleratedBodyPositionFunction_;
+
+    //! Function returning the current rotation from the body-fixed frame to the propagation frame.
+    std::function< Eigen::Quaterniond( ) > rotationFromBodyFixedToPropagationFrameFunction_;
+
+    //! Function pointer returning radiation pressure.
+    std::function< double( ) > radiationPressureFunction_;
+
+    //! Function pointer returning mass of accelerated body.
+    std::function< double( ) > massFunction_;
+
+    //! Precomputed force and torque lookup table.
+    std::shared_ptr< PanelledRadiationPressureLookupTable > lookupTable_;
+
+    //! Current radiation pressure, as set by the last call to the updateMembers function
+    double currentRadiationPressure_;
+
+    //! Current mass of accelerated body, as set by the last call to the updateMembers function
+    double currentMass_;
+
+    //! Current acceleration, in propagation frame, as set by the last call to the updateMembers function
+    Eigen::Vector3d currentAcceleration_;
+
+    //! Current torque, in body-fixed frame, as set by the last call to the updateMembers function
+    Eigen::Vector3d currentTorque_;
+};
+
+} // namespace electro_magnetism
+
+} // namespace tudat
+
+#endif // TUDAT_SELFSHADOWINGPANELLEDRADIATIONPRESSURE_H
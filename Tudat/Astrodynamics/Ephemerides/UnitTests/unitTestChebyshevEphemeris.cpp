@@ -0,0 +1,171 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Polynomial test function (degree 4 in time), with its derivative as 'velocity'.
+Eigen::Vector6d getPolynomialTestState( const double time )
+{
+    double normalizedTime = time / 1.0E4;
+    Eigen::Vector6d state;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        double coefficientScale = static_cast< double >( i + 1 );
+        state( i ) = 1.0E6 * coefficientScale * (
+                    1.0 - 0.3 * normalizedTime + 0.2 * std::pow( normalizedTime, 2 ) -
+                    0.05 * std::pow( normalizedTime, 3 ) + 0.01 * std::pow( normalizedTime, 4 ) );
+        state( i + 3 ) = 1.0E2 * coefficientScale * (
+                    -0.3 + 0.4 * normalizedTime - 0.15 * std::pow( normalizedTime, 2 ) +
+                    0.04 * std::pow( normalizedTime, 3 ) );
+    }
+    return state;
+}
+
+BOOST_AUTO_TEST_SUITE( test_chebyshev_ephemeris )
+
+//! Test whether a polynomial of lower degree than the Chebyshev series is reproduced exactly.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisPolynomialReproduction )
+{
+    const double initialTime = -2.0E4;
+    const double finalTime = 5.0E4;
+
+    ephemerides::ChebyshevEphemeris chebyshevEphemeris(
+                &getPolynomialTestState, initialTime, finalTime, 3.0E4, 6 );
+
+    // Check segment layout: 3 segments needed, duration adjusted to span interval exactly.
+    BOOST_CHECK_EQUAL( chebyshevEphemeris.getNumberOfSegments( ), 3 );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris.getNumberOfCoefficients( ), 7 );
+    BOOST_CHECK_CLOSE_FRACTION( chebyshevEphemeris.getSegmentDuration( ), ( finalTime - initialTime ) / 3.0,
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris.getCoefficients( ).size( ), 3 * 6 * 7 );
+
+    // Compare states, including interval and segment boundaries.
+    for( double testTime = initialTime; testTime <= finalTime; testTime += 0.1 * chebyshevEphemeris.getSegmentDuration( ) )
+    {
+        Eigen::Vector6d expectedState = getPolynomialTestState( testTime );
+        Eigen::Vector6d computedState = chebyshevEphemeris.getCartesianState( testTime );
+        for( unsigned int i = 0; i < 6; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( computedState( i ) - expectedState( i ) ),
+                               1.0E-12 * expectedState.segment( 3 * ( i / 3 ), 3 ).norm( ) );
+        }
+    }
+
+    Eigen::Vector6d finalStateDifference =
+            chebyshevEphemeris.getCartesianState( finalTime ) - getPolynomialTestState( finalTime );
+    BOOST_CHECK_SMALL( finalStateDifference.segment( 0, 3 ).norm( ), 1.0E-4 );
+
+    // Check error computation
+    std::pair< double, double > maximumErrors =
+            chebyshevEphemeris.getMaximumApproximationError( &getPolynomialTestState, 10 );
+    BOOST_CHECK_SMALL( maximumErrors.first, 1.0E-4 );
+    BOOST_CHECK_SMALL( maximumErrors.second, 1.0E-10 );
+
+    // Check that states outside interval of validity cannot be retrieved.
+    bool isExceptionCaught = false;
+    try
+    {
+        chebyshevEphemeris.getCartesianState( finalTime + 1.0 );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+
+    isExceptionCaught = false;
+    try
+    {
+        chebyshevEphemeris.getCartesianState( initialTime - 1.0 );
+    }
+    catch( std::runtime_error const& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test Chebyshev approximation of Keplerian orbit, and convergence with increasing degree.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisKeplerOrbit )
+{
+    using namespace orbital_element_conversions;
+
+    // Define low Earth orbit
+    const double earthGravitationalParameter = 398600.4415e9;
+    Eigen::Vector6d keplerianElements;
+    keplerianElements( semiMajorAxisIndex ) = 7000.0E3;
+    keplerianElements( eccentricityIndex ) = 0.05;
+    keplerianElements( inclinationIndex ) = 1.0;
+    keplerianElements( argumentOfPeriapsisIndex ) = 0.4;
+    keplerianElements( longitudeOfAscendingNodeIndex ) = 2.3;
+    keplerianElements( trueAnomalyIndex ) = 0.1;
+
+    std::shared_ptr< ephemerides::KeplerEphemeris > keplerEphemeris =
+            std::make_shared< ephemerides::KeplerEphemeris >(
+                keplerianElements, 0.0, earthGravitationalParameter, "Earth", "ECLIPJ2000" );
+    std::function< Eigen::Vector6d( const double ) > keplerStateFunction =
+            std::bind( &ephemerides::KeplerEphemeris::getCartesianState, keplerEphemeris, std::placeholders::_1 );
+
+    // Create Chebyshev ephemerides of increasing degree, and check error.
+    double previousPositionError = std::numeric_limits< double >::max( );
+    for( int degree = 6; degree <= 14; degree += 4 )
+    {
+        ephemerides::ChebyshevEphemeris chebyshevEphemeris(
+                    keplerStateFunction, 0.0, 86400.0, 600.0, degree, "Earth", "ECLIPJ2000" );
+
+        BOOST_CHECK_EQUAL( chebyshevEphemeris.getReferenceFrameOrigin( ), "Earth" );
+        BOOST_CHECK_EQUAL( chebyshevEphemeris.getNumberOfSegments( ), 144 );
+
+        std::pair< double, double > maximumErrors =
+                chebyshevEphemeris.getMaximumApproximationError( keplerStateFunction, 7 );
+        BOOST_CHECK_EQUAL( maximumErrors.first < previousPositionError, true );
+        previousPositionError = maximumErrors.first;
+
+        // Check error at final degree
+        if( degree == 14 )
+        {
+            BOOST_CHECK_SMALL( maximumErrors.first, 1.0E-4 );
+            BOOST_CHECK_SMALL( maximumErrors.second, 1.0E-7 );
+
+            for( double testTime = 0.0; testTime < 86400.0; testTime += 1234.5 )
+            {
+                Eigen::Vector6d stateDifference =
+                        chebyshevEphemeris.getCartesianState( testTime ) - keplerEphemeris->getCartesianState( testTime );
+                BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 1.0E-4 );
+                BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 1.0E-7 );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
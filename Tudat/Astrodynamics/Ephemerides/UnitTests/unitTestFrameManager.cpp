@@ -20,6 +20,7 @@
 
 #include "Tudat/Astrodynamics/Ephemerides/frameManager.h"
 #include "Tudat/Astrodynamics/Ephemerides/constantEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/customEphemeris.h"
 
 namespace tudat
 {
@@ -140,6 +141,97 @@ BOOST_AUTO_TEST_CASE( test_FrameManager )
 
 }
 
+//! Test precompiled frame chains, and whether shared ephemerides are evaluated once per epoch.
+BOOST_AUTO_TEST_CASE( test_FrameChainEvaluator )
+{
+    // Create time-dependent ephemerides, with counter for number of evaluations.
+    std::map< std::string, int > numberOfEvaluations;
+    std::map< std::string, std::shared_ptr< Ephemeris > > ephemerisList;
+    std::map< std::string, std::string > ephemerisOrigins =
+    { { "Sun", getBaseFrameName( ) }, { "EarthMoonBarycenter", "Sun" }, { "Earth", "EarthMoonBarycenter" },
+      { "Moon", "EarthMoonBarycenter" }, { "LRO", "Moon" }, { "LAGEOS", "Earth" }, { "Mars", "Sun" } };
+
+    double bodyCounter = 1.0;
+    for( std::map< std::string, std::string >::iterator originIterator = ephemerisOrigins.begin( );
+         originIterator != ephemerisOrigins.end( ); originIterator++ )
+    {
+        std::string bodyName = originIterator->first;
+        double scale = bodyCounter;
+        numberOfEvaluations[ bodyName ] = 0;
+        ephemerisList[ bodyName ] = std::make_shared< CustomEphemeris >(
+                    [ =, &numberOfEvaluations ]( const double time )
+        {
+            numberOfEvaluations[ bodyName ]++;
+            Eigen::Vector6d state;
+            state << scale * 1.0E6 * std::cos( 1.0E-5 * time * scale ), scale * 1.0E6 * std::sin( 1.0E-5 * time * scale ),
+                    scale * 1.0E3, -scale * 10.0 * std::sin( 1.0E-5 * time * scale ),
+                    scale * 10.0 * std::cos( 1.0E-5 * time * scale ), 0.0;
+            return state;
+        }, originIterator->second, "ECLIPJ2000" );
+        bodyCounter += 1.0;
+    }
+
+    std::shared_ptr< ReferenceFrameManager > frameManager = std::make_shared< ReferenceFrameManager >( ephemerisList );
+
+    // Define requested states, all sharing the Earth-Moon barycenter.
+    std::vector< std::pair< std::string, std::string > > bodiesAndOrigins =
+    { { "Moon", "Earth" }, { "LRO", "LAGEOS" }, { "Earth", getBaseFrameName( ) }, { "LAGEOS", "Mars" },
+      { "Earth", "Earth" }, { "Sun", "LRO" } };
+    std::shared_ptr< FrameChainEvaluator< > > frameChainEvaluator =
+            frameManager->createFrameChainEvaluator< >( bodiesAndOrigins );
+
+    BOOST_CHECK_EQUAL( frameChainEvaluator->getNumberOfChains( ), 6 );
+    BOOST_CHECK_EQUAL( frameChainEvaluator->getNumberOfEphemerides( ), 7 );
+
+    // Create reference ephemerides using existing interface.
+    std::vector< std::shared_ptr< Ephemeris > > referenceEphemerides;
+    for( unsigned int i = 0; i < bodiesAndOrigins.size( ); i++ )
+    {
+        referenceEphemerides.push_back(
+                    frameManager->getEphemeris( bodiesAndOrigins.at( i ).second, bodiesAndOrigins.at( i ).first ) );
+    }
+
+    std::vector< double > epochs = { 0.0, 1.0E4, 2.5E5, -3.0E5 };
+    for( std::map< std::string, int >::iterator counterIterator = numberOfEvaluations.begin( );
+         counterIterator != numberOfEvaluations.end( ); counterIterator++ )
+    {
+        counterIterator->second = 0;
+    }
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > chainStates =
+            frameChainEvaluator->getChainStatesAtEpochs( epochs );
+
+    // Check that each ephemeris is evaluated exactly once per epoch
+    for( std::map< std::string, int >::iterator counterIterator = numberOfEvaluations.begin( );
+         counterIterator != numberOfEvaluations.end( ); counterIterator++ )
+    {
+        BOOST_CHECK_EQUAL( counterIterator->second, static_cast< int >( epochs.size( ) ) );
+    }
+
+    // Compare against composite ephemerides.
+    for( unsigned int i = 0; i < bodiesAndOrigins.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( chainStates.at( i ).cols( ), static_cast< int >( epochs.size( ) ) );
+        for( unsigned int j = 0; j < epochs.size( ); j++ )
+        {
+            Eigen::Vector6d expectedState = referenceEphemerides.at( i )->getCartesianState( epochs.at( j ) );
+            for( unsigned int k = 0; k < 6; k++ )
+            {
+                BOOST_CHECK_SMALL( chainStates.at( i )( k, j ) - expectedState( k ),
+                                   10.0 * std::numeric_limits< double >::epsilon( ) * expectedState.norm( ) );
+            }
+        }
+    }
+
+    // Check single-epoch interface
+    frameChainEvaluator->updateStates( epochs.at( 1 ) );
+    for( unsigned int i = 0; i < bodiesAndOrigins.size( ); i++ )
+    {
+        Eigen::Vector6d stateDifference =
+                frameChainEvaluator->getChainState( i ) - chainStates.at( i ).col( 1 );
+        BOOST_CHECK_EQUAL( stateDifference.norm( ), 0.0 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -0,0 +1,159 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Constructor.
+ChebyshevEphemeris::ChebyshevEphemeris(
+        const std::function< Eigen::Vector6d( const double ) > stateFunction,
+        const double initialTime,
+        const double finalTime,
+        const double segmentDuration,
+        const int polynomialDegree,
+        const std::string& referenceFrameOrigin,
+        const std::string& referenceFrameOrientation ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    initialTime_( initialTime ), finalTime_( finalTime )
+{
+    if( !( finalTime > initialTime ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, final time must be larger than initial time." );
+    }
+
+    if( !( segmentDuration > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, segment duration must be positive." );
+    }
+
+    if( polynomialDegree < 1 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, polynomial degree must be at least 1." );
+    }
+
+    // Set segment properties such that the segments span the time interval exactly.
+    numberOfSegments_ = static_cast< int >( std::ceil( ( finalTime_ - initialTime_ ) / segmentDuration ) );
+    segmentDuration_ = ( finalTime_ - initialTime_ ) / static_cast< double >( numberOfSegments_ );
+    inverseSegmentDuration_ = 1.0 / segmentDuration_;
+    numberOfCoefficients_ = polynomialDegree + 1;
+
+    coefficients_.resize( 6 * numberOfCoefficients_ * numberOfSegments_ );
+    chebyshevPolynomialValues_.setZero( numberOfCoefficients_ );
+
+    // Precompute cosine terms used for both node locations and discrete cosine transform.
+    const double numberOfNodes = static_cast< double >( numberOfCoefficients_ );
+    Eigen::MatrixXd cosineTerms = Eigen::MatrixXd( numberOfCoefficients_, numberOfCoefficients_ );
+    for( int j = 0; j < numberOfCoefficients_; j++ )
+    {
+        for( int k = 0; k < numberOfCoefficients_; k++ )
+        {
+            cosineTerms( k, j ) = std::cos(
+                        mathematical_constants::PI * static_cast< double >( j ) *
+                        ( static_cast< double >( k ) + 0.5 ) / numberOfNodes );
+        }
+    }
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > nodeStates =
+            Eigen::Matrix< double, 6, Eigen::Dynamic >( 6, numberOfCoefficients_ );
+    for( int i = 0; i < numberOfSegments_; i++ )
+    {
+        // Evaluate state function at Chebyshev-Gauss nodes of current segment.
+        double segmentMidTime = initialTime_ + ( static_cast< double >( i ) + 0.5 ) * segmentDuration_;
+        for( int k = 0; k < numberOfCoefficients_; k++ )
+        {
+            nodeStates.col( k ) = stateFunction(
+                        segmentMidTime + 0.5 * segmentDuration_ * cosineTerms( k, 1 ) );
+        }
+
+        // Compute coefficients by discrete cosine transform of node values.
+        Eigen::Map< Eigen::Matrix< double, 6, Eigen::Dynamic > > segmentCoefficients(
+                    coefficients_.data( ) + 6 * numberOfCoefficients_ * i, 6, numberOfCoefficients_ );
+        segmentCoefficients = 2.0 / numberOfNodes * nodeStates * cosineTerms;
+        segmentCoefficients.col( 0 ) *= 0.5;
+    }
+}
+
+//! Function to get state from ephemeris.
+Eigen::Vector6d ChebyshevEphemeris::getCartesianState(
+        const double secondsSinceEpoch )
+{
+    int segmentIndex = getSegmentIndex( secondsSinceEpoch );
+
+    // Compute normalized time in segment, and values of Chebyshev polynomials.
+    double normalizedTime = 2.0 * ( ( secondsSinceEpoch - initialTime_ ) * inverseSegmentDuration_ -
+                                    static_cast< double >( segmentIndex ) ) - 1.0;
+    chebyshevPolynomialValues_( 0 ) = 1.0;
+    chebyshevPolynomialValues_( 1 ) = normalizedTime;
+    for( int j = 2; j < numberOfCoefficients_; j++ )
+    {
+        chebyshevPolynomialValues_( j ) = 2.0 * normalizedTime * chebyshevPolynomialValues_( j - 1 ) -
+                chebyshevPolynomialValues_( j - 2 );
+    }
+
+    return Eigen::Map< const Eigen::Matrix< double, 6, Eigen::Dynamic > >(
+                coefficients_.data( ) + 6 * numberOfCoefficients_ * segmentIndex, 6, numberOfCoefficients_ ) *
+            chebyshevPolynomialValues_;
+}
+
+//! Function to compute the maximum deviation of the approximation w.r.t. a reference state function.
+std::pair< double, double > ChebyshevEphemeris::getMaximumApproximationError(
+        const std::function< Eigen::Vector6d( const double ) > referenceStateFunction,
+        const int numberOfTestPointsPerSegment )
+{
+    double maximumPositionError = 0.0;
+    double maximumVelocityError = 0.0;
+
+    Eigen::Vector6d stateDifference;
+    for( int i = 0; i < numberOfSegments_; i++ )
+    {
+        for( int j = 0; j < numberOfTestPointsPerSegment; j++ )
+        {
+            double testTime = initialTime_ + segmentDuration_ * (
+                        static_cast< double >( i ) +
+                        ( static_cast< double >( j ) + 0.5 ) / static_cast< double >( numberOfTestPointsPerSegment ) );
+            stateDifference = getCartesianState( testTime ) - referenceStateFunction( testTime );
+
+            maximumPositionError = std::max( maximumPositionError, stateDifference.segment( 0, 3 ).norm( ) );
+            maximumVelocityError = std::max( maximumVelocityError, stateDifference.segment( 3, 3 ).norm( ) );
+        }
+    }
+
+    return std::make_pair( maximumPositionError, maximumVelocityError );
+}
+
+//! Function to compute the index of the segment in which the given time lies.
+int ChebyshevEphemeris::getSegmentIndex( const double time )
+{
+    if( time < initialTime_ || time > finalTime_ )
+    {
+        throw std::runtime_error( "Error in Chebyshev ephemeris, requested time " + std::to_string( time ) +
+                                  " is outside interval of validity [" + std::to_string( initialTime_ ) + ", " +
+                                  std::to_string( finalTime_ ) + "]." );
+    }
+
+    int segmentIndex = static_cast< int >( ( time - initialTime_ ) * inverseSegmentDuration_ );
+    return ( segmentIndex < numberOfSegments_ ) ? segmentIndex : numberOfSegments_ - 1;
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
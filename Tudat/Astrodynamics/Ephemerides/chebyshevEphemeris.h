@@ -0,0 +1,191 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_CHEBYSHEVEPHEMERIS_H
+#define TUDAT_CHEBYSHEVEPHEMERIS_H
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Ephemeris derived class that evaluates a piecewise Chebyshev approximation of a body's state.
+/*!
+ *  Ephemeris derived class that evaluates a piecewise Chebyshev approximation of a body's state.
+ *  The time interval of validity is split into segments of equal duration. On each segment, each
+ *  of the six Cartesian state components is approximated by a Chebyshev series, with coefficients
+ *  computed from the state function at the Chebyshev-Gauss nodes of the segment. The coefficients
+ *  of all segments are stored in a single contiguous array, so that retrieving a state requires
+ *  only an index computation (no search) and a single matrix-vector product. This makes the class
+ *  well-suited as a cache for expensive state functions, such as those retrieving data from Spice.
+ */
+class ChebyshevEphemeris : public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor.
+    /*!
+     *  Constructor, samples the state function at the Chebyshev nodes of each segment and computes
+     *  the associated Chebyshev coefficients.
+     *  \param stateFunction Function returning the Cartesian state that is to be approximated.
+     *  \param initialTime Start of the time interval over which the ephemeris is valid.
+     *  \param finalTime End of the time interval over which the ephemeris is valid.
+     *  \param segmentDuration (Maximum) duration of a single Chebyshev segment. The actual segment
+     *  duration is reduced such that an integer number of segments spans the time interval exactly.
+     *  \param polynomialDegree Degree of the Chebyshev series on each segment.
+     *  \param referenceFrameOrigin Origin of reference frame (string identifier).
+     *  \param referenceFrameOrientation Orientation of reference frame (string identifier).
+     */
+    ChebyshevEphemeris( const std::function< Eigen::Vector6d( const double ) > stateFunction,
+                        const double initialTime,
+                        const double finalTime,
+                        const double segmentDuration,
+                        const int polynomialDegree,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000" );
+
+    //! Function to get state from ephemeris.
+    /*!
+     *  Returns state from ephemeris at given time, by evaluating the Chebyshev series of the segment
+     *  in which the requested time lies.
+     *  \param secondsSinceEpoch Seconds since epoch at which ephemeris is to be evaluated.
+     *  \return Cartesian state at given time.
+     */
+    Eigen::Vector6d getCartesianState(
+            const double secondsSinceEpoch );
+
+    //! Function to compute the maximum deviation of the approximation w.r.t. a reference state function.
+    /*!
+     *  Function to compute the maximum deviation of the approximation w.r.t. a reference state function
+     *  (typically the function from which the coefficients were computed). The comparison is made at
+     *  equispaced points inside each segment, which do not coincide with the nodes used for the fit.
+     *  \param referenceStateFunction Function returning the reference Cartesian state.
+     *  \param numberOfTestPointsPerSegment Number of points per segment at which comparison is made.
+     *  \return Pair with maximum position difference norm (first) and velocity difference norm (second).
+     */
+    std::pair< double, double > getMaximumApproximationError(
+            const std::function< Eigen::Vector6d( const double ) > referenceStateFunction,
+            const int numberOfTestPointsPerSegment = 4 );
+
+    //! Function to retrieve the start of the time interval over which the ephemeris is valid.
+    /*!
+     *  Function to retrieve the start of the time interval over which the ephemeris is valid.
+     *  \return Start of the time interval over which the ephemeris is valid.
+     */
+    double getInitialTime( )
+    {
+        return initialTime_;
+    }
+
+    //! Function to retrieve the end of the time interval over which the ephemeris is valid.
+    /*!
+     *  Function to retrieve the end of the time interval over which the ephemeris is valid.
+     *  \return End of the time interval over which the ephemeris is valid.
+     */
+    double getFinalTime( )
+    {
+        return finalTime_;
+    }
+
+    //! Function to retrieve the duration of a single Chebyshev segment.
+    /*!
+     *  Function to retrieve the duration of a single Chebyshev segment.
+     *  \return Duration of a single Chebyshev segment.
+     */
+    double getSegmentDuration( )
+    {
+        return segmentDuration_;
+    }
+
+    //! Function to retrieve the number of Chebyshev segments.
+    /*!
+     *  Function to retrieve the number of Chebyshev segments.
+     *  \return Number of Chebyshev segments.
+     */
+    int getNumberOfSegments( )
+    {
+        return numberOfSegments_;
+    }
+
+    //! Function to retrieve the number of Chebyshev coefficients per state component and segment.
+    /*!
+     *  Function to retrieve the number of Chebyshev coefficients per state component and segment.
+     *  \return Number of Chebyshev coefficients per state component and segment.
+     */
+    int getNumberOfCoefficients( )
+    {
+        return numberOfCoefficients_;
+    }
+
+    //! Function to retrieve the Chebyshev coefficients of all segments.
+    /*!
+     *  Function to retrieve the Chebyshev coefficients of all segments. For each segment, a block of
+     *  6 x numberOfCoefficients values is stored in column-major order (state component index fastest).
+     *  \return Chebyshev coefficients of all segments.
+     */
+    const std::vector< double >& getCoefficients( )
+    {
+        return coefficients_;
+    }
+
+private:
+
+    //! Function to compute the index of the segment in which the given time lies.
+    /*!
+     *  Function to compute the index of the segment in which the given time lies, throws an exception
+     *  if the time is outside the interval of validity of the ephemeris.
+     *  \param time Time for which the segment index is to be computed.
+     *  \return Index of the segment in which the given time lies.
+     */
+    int getSegmentIndex( const double time );
+
+    //! Start of the time interval over which the ephemeris is valid.
+    double initialTime_;
+
+    //! End of the time interval over which the ephemeris is valid.
+    double finalTime_;
+
+    //! Duration of a single Chebyshev segment.
+    double segmentDuration_;
+
+    //! Inverse of segmentDuration_ (precomputed for fast segment lookup).
+    double inverseSegmentDuration_;
+
+    //! Number of Chebyshev segments.
+    int numberOfSegments_;
+
+    //! Number of Chebyshev coefficients per state component and segment (polynomial degree + 1).
+    int numberOfCoefficients_;
+
+    //! Chebyshev coefficients of all segments, stored contiguously (see getCoefficients).
+    std::vector< double > coefficients_;
+
+    //! Pre-allocated vector of Chebyshev polynomial values, used during evaluation.
+    Eigen::VectorXd chebyshevPolynomialValues_;
+};
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEVEPHEMERIS_H
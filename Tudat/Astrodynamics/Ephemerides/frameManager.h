@@ -45,6 +45,177 @@ bool isFrameInertial( const std::string& frame );
  */
 std::string getBaseFrameName( );
 
+//! Class to evaluate a fixed set of state compositions between frames, using precompiled frame chains.
+/*!
+ *  Class to evaluate a fixed set of state compositions between frames, using precompiled frame chains
+ *  (typically created by ReferenceFrameManager::createFrameChainEvaluator). Each requested state
+ *  (body w.r.t. origin) is defined by a flat list of ephemeris indices, with an associated sign, the
+ *  sum of which gives the requested state. The ephemerides used in all chains are stored only once, so
+ *  that an ephemeris shared by multiple chains (e.g. that of a common intermediate origin) is evaluated
+ *  only once per epoch, regardless of the number of chains in which it occurs.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class FrameChainEvaluator
+{
+public:
+
+    //! Typedef for state vector
+    typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param ephemerides List of (unique) ephemerides used in the frame chains.
+     *  \param chainEphemerisIndices Indices (in ephemerides) of the constituent ephemerides of all chains,
+     *  concatenated.
+     *  \param chainSigns Sign (+1 or -1) with which each entry of chainEphemerisIndices is to be added.
+     *  \param chainStartIndices Start index in chainEphemerisIndices of each chain, with an additional
+     *  last entry equal to the size of chainEphemerisIndices.
+     */
+    FrameChainEvaluator(
+            const std::vector< std::shared_ptr< Ephemeris > >& ephemerides,
+            const std::vector< int >& chainEphemerisIndices,
+            const std::vector< StateScalarType >& chainSigns,
+            const std::vector< int >& chainStartIndices ):
+        ephemerides_( ephemerides ), chainEphemerisIndices_( chainEphemerisIndices ),
+        chainSigns_( chainSigns ), chainStartIndices_( chainStartIndices )
+    {
+        if( chainEphemerisIndices_.size( ) != chainSigns_.size( ) )
+        {
+            throw std::runtime_error( "Error when creating frame chain evaluator, chain index and sign sizes are inconsistent" );
+        }
+
+        if( chainStartIndices_.size( ) < 1 ||
+                chainStartIndices_.back( ) != static_cast< int >( chainEphemerisIndices_.size( ) ) )
+        {
+            throw std::runtime_error( "Error when creating frame chain evaluator, chain start indices are inconsistent" );
+        }
+
+        for( unsigned int i = 0; i < chainEphemerisIndices_.size( ); i++ )
+        {
+            if( chainEphemerisIndices_.at( i ) < 0 ||
+                    chainEphemerisIndices_.at( i ) >= static_cast< int >( ephemerides_.size( ) ) )
+            {
+                throw std::runtime_error( "Error when creating frame chain evaluator, ephemeris index out of bounds" );
+            }
+        }
+
+        ephemerisStates_.setZero( 6, ephemerides_.size( ) );
+        chainStates_.setZero( 6, chainStartIndices_.size( ) - 1 );
+    }
+
+    //! Function to evaluate all frame chains at a single epoch.
+    /*!
+     *  Function to evaluate all frame chains at a single epoch. Each constituent ephemeris is evaluated
+     *  once, after which the chains are composed from the stored ephemeris states. The results can be
+     *  retrieved using getChainState or getChainStates.
+     *  \param time Time at which the frame chains are to be evaluated.
+     */
+    void updateStates( const TimeType time )
+    {
+        for( unsigned int i = 0; i < ephemerides_.size( ); i++ )
+        {
+            ephemerisStates_.col( i ) =
+                    ephemerides_[ i ]->template getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time );
+        }
+
+        for( unsigned int i = 0; i < chainStartIndices_.size( ) - 1; i++ )
+        {
+            chainStates_.col( i ).setZero( );
+            for( int j = chainStartIndices_[ i ]; j < chainStartIndices_[ i + 1 ]; j++ )
+            {
+                chainStates_.col( i ) += chainSigns_[ j ] * ephemerisStates_.col( chainEphemerisIndices_[ j ] );
+            }
+        }
+    }
+
+    //! Function to retrieve the state of a single frame chain, as computed by last call to updateStates.
+    /*!
+     *  Function to retrieve the state of a single frame chain, as computed by last call to updateStates.
+     *  \param chainIndex Index of frame chain (order as used when creating object).
+     *  \return State of requested frame chain.
+     */
+    StateType getChainState( const int chainIndex )
+    {
+        return chainStates_.col( chainIndex );
+    }
+
+    //! Function to retrieve the states of all frame chains, as computed by last call to updateStates.
+    /*!
+     *  Function to retrieve the states of all frame chains, as computed by last call to updateStates.
+     *  \return States of all frame chains (one column per chain).
+     */
+    const Eigen::Matrix< StateScalarType, 6, Eigen::Dynamic >& getChainStates( )
+    {
+        return chainStates_;
+    }
+
+    //! Function to evaluate all frame chains at a list of epochs.
+    /*!
+     *  Function to evaluate all frame chains at a list of epochs, each constituent ephemeris is evaluated
+     *  once per epoch.
+     *  \param epochs Times at which the frame chains are to be evaluated.
+     *  \return States of frame chains, one entry per chain, with one column per epoch.
+     */
+    std::vector< Eigen::Matrix< StateScalarType, 6, Eigen::Dynamic > > getChainStatesAtEpochs(
+            const std::vector< TimeType >& epochs )
+    {
+        std::vector< Eigen::Matrix< StateScalarType, 6, Eigen::Dynamic > > statesAtEpochs(
+                    getNumberOfChains( ), Eigen::Matrix< StateScalarType, 6, Eigen::Dynamic >::Zero( 6, epochs.size( ) ) );
+
+        for( unsigned int i = 0; i < epochs.size( ); i++ )
+        {
+            updateStates( epochs.at( i ) );
+            for( int j = 0; j < getNumberOfChains( ); j++ )
+            {
+                statesAtEpochs[ j ].col( i ) = chainStates_.col( j );
+            }
+        }
+        return statesAtEpochs;
+    }
+
+    //! Function to retrieve the number of frame chains.
+    /*!
+     *  Function to retrieve the number of frame chains.
+     *  \return Number of frame chains.
+     */
+    int getNumberOfChains( )
+    {
+        return static_cast< int >( chainStartIndices_.size( ) ) - 1;
+    }
+
+    //! Function to retrieve the number of (unique) ephemerides evaluated per epoch.
+    /*!
+     *  Function to retrieve the number of (unique) ephemerides evaluated per epoch.
+     *  \return Number of (unique) ephemerides evaluated per epoch.
+     */
+    int getNumberOfEphemerides( )
+    {
+        return static_cast< int >( ephemerides_.size( ) );
+    }
+
+private:
+
+    //! List of (unique) ephemerides used in the frame chains.
+    std::vector< std::shared_ptr< Ephemeris > > ephemerides_;
+
+    //! Indices (in ephemerides_) of the constituent ephemerides of all chains, concatenated.
+    std::vector< int > chainEphemerisIndices_;
+
+    //! Sign (+1 or -1) with which each entry of chainEphemerisIndices_ is to be added.
+    std::vector< StateScalarType > chainSigns_;
+
+    //! Start index in chainEphemerisIndices_ of each chain (with size of chainEphemerisIndices_ as last entry).
+    std::vector< int > chainStartIndices_;
+
+    //! States of ephemerides_, as computed by last call to updateStates (one column per ephemeris).
+    Eigen::Matrix< StateScalarType, 6, Eigen::Dynamic > ephemerisStates_;
+
+    //! States of frame chains, as computed by last call to updateStates (one column per chain).
+    Eigen::Matrix< StateScalarType, 6, Eigen::Dynamic > chainStates_;
+
+};
+
 
 //! Class to retrieve translation functions between different frames
 /*!
@@ -164,6 +335,71 @@ public:
         return ephemerisBetweenFrames;
     }
 
+    //! Function to create an object that evaluates a set of states between frames using precompiled frame chains.
+    /*!
+     *  Function to create an object that evaluates a set of states between frames using precompiled frame
+     *  chains. For each requested body/origin pair, the chain of ephemerides linking the two (through their
+     *  nearest common frame) is resolved once, and stored as a flat list of indices into a list of unique
+     *  ephemerides. Unlike the CompositeEphemeris objects created by getEphemeris, the resulting object
+     *  evaluates each ephemeris only once per epoch, even if it is used by several of the requested states.
+     *  \param bodiesAndOrigins List of pairs of body (first) and origin (second) for which the state of the
+     *  body w.r.t. the origin is to be evaluated.
+     *  \return Object to evaluate the requested states at one or more epochs.
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    std::shared_ptr< FrameChainEvaluator< StateScalarType, TimeType > > createFrameChainEvaluator(
+            const std::vector< std::pair< std::string, std::string > >& bodiesAndOrigins )
+    {
+        std::vector< std::shared_ptr< Ephemeris > > uniqueEphemerides;
+        std::map< std::shared_ptr< Ephemeris >, int > ephemerisIndices;
+
+        std::vector< int > chainEphemerisIndices;
+        std::vector< StateScalarType > chainSigns;
+        std::vector< int > chainStartIndices;
+
+        for( unsigned int i = 0; i < bodiesAndOrigins.size( ); i++ )
+        {
+            const std::string& body = bodiesAndOrigins.at( i ).first;
+            const std::string& origin = bodiesAndOrigins.at( i ).second;
+            chainStartIndices.push_back( chainEphemerisIndices.size( ) );
+
+            if( frameIndexList_.count( body ) == 0 || frameIndexList_.count( origin ) == 0 )
+            {
+                throw std::runtime_error( "Error when creating frame chain from " + origin + " to " + body +
+                                          ", frame not found in frame manager" );
+            }
+
+            // State of body w.r.t. itself is zero: leave chain empty.
+            if( body == origin )
+            {
+                continue;
+            }
+
+            // Retrieve ephemerides from nearest common frame to body (added) and to origin (subtracted).
+            std::vector< std::string > framesToCheck = { origin, body };
+            std::string nearestCommonFrame = getNearestCommonFrame( framesToCheck ).first;
+            for( unsigned int j = 0; j < 2; j++ )
+            {
+                std::vector< std::shared_ptr< Ephemeris > > ephemerisList =
+                        getDirectEphemerisFromLowerToUpperFrame( nearestCommonFrame, ( j == 0 ) ? body : origin );
+                for( unsigned int k = 0; k < ephemerisList.size( ); k++ )
+                {
+                    if( ephemerisIndices.count( ephemerisList.at( k ) ) == 0 )
+                    {
+                        ephemerisIndices[ ephemerisList.at( k ) ] = uniqueEphemerides.size( );
+                        uniqueEphemerides.push_back( ephemerisList.at( k ) );
+                    }
+                    chainEphemerisIndices.push_back( ephemerisIndices.at( ephemerisList.at( k ) ) );
+                    chainSigns.push_back( ( j == 0 ) ? 1.0 : -1.0 );
+                }
+            }
+        }
+        chainStartIndices.push_back( chainEphemerisIndices.size( ) );
+
+        return std::make_shared< FrameChainEvaluator< StateScalarType, TimeType > >(
+                    uniqueEphemerides, chainEphemerisIndices, chainSigns, chainStartIndices );
+    }
+
     //! Return the level at which the requested ephemeris is in the hierarchy.
     /*!
      *  Return the level at which the requested ephemeris is in the hierarchy.
@@ -19,6 +19,7 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/InputOutput/binaryHistoryFile.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 
@@ -269,6 +270,46 @@ std::shared_ptr< Ephemeris > getTabulatedEphemeris(
 
 }
 
+//! Create a tabulated ephemeris from a Cartesian state history stored in a binary history file
+/*!
+ * Create a tabulated ephemeris from a Cartesian state history stored in a binary history file (e.g. as streamed to file
+ * during a propagation by the SingleArcDynamicsSimulator).
+ * \param fileName Name of the binary history file.
+ * \param variableIdentifier Identifier of the Cartesian state variable in the file (e.g. "Translational state of
+ * Vehicle"). An exception is thrown if this variable does not have 6 entries.
+ * \param interpolatorSettings Interpolation settings for tabulated ephemeris
+ * \param referenceFrameOrigin Origin of reference frame in which state is defined.
+ * \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+ * \return Tabulated ephemeris, interpolating the state history in the binary history file
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+std::shared_ptr< Ephemeris > createTabulatedEphemerisFromBinaryHistoryFile(
+        const std::string& fileName,
+        const std::string& variableIdentifier,
+        const std::shared_ptr< interpolators::InterpolatorSettings > interpolatorSettings =
+        std::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ),
+        const std::string referenceFrameOrigin = "SSB",
+        const std::string referenceFrameOrientation = "ECLIPJ2000" )
+{
+    typedef Eigen::Matrix< StateScalarType, 6, 1 > StateType;
+
+    // Retrieve state history from file
+    input_output::BinaryHistoryReader historyReader( fileName );
+    std::map< double, Eigen::Vector6d > fileStateMap =
+            historyReader.getFixedSizeVariableHistory< 6 >( variableIdentifier );
+
+    std::map< TimeType, StateType > stateMap;
+    for( auto stateIterator : fileStateMap )
+    {
+        stateMap[ TimeType( stateIterator.first ) ] = stateIterator.second.template cast< StateScalarType >( );
+    }
+
+    // Create tabulated ephemeris model
+    return std::make_shared< TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
+                interpolators::createOneDimensionalInterpolator( stateMap, interpolatorSettings ),
+                referenceFrameOrigin, referenceFrameOrientation );
+}
+
 } // namespace ephemerides
 
 } // namespace tudat
@@ -311,6 +311,125 @@ BOOST_AUTO_TEST_CASE( testGravityFieldVariations )
     }
 }
 
+//! Test whether the (in-place) solid body tide corrections match a direct computation for each body and coefficient.
+BOOST_AUTO_TEST_CASE( testBasicSolidBodyTideInPlaceCorrections )
+{
+    // Define deformed body at constant position, rotating about its z-axis
+    const double referenceRadius = 1.0E6;
+    std::function< Eigen::Vector6d( const double ) > deformedBodyStateFunction = [ = ]( const double )
+    {
+        return ( Eigen::Vector6d( ) << 1.0E8, -2.0E7, 3.0E6, 0.0, 0.0, 0.0 ).finished( );
+    };
+    std::function< Eigen::Quaterniond( const double ) > deformedBodyOrientationFunction = [ = ]( const double time )
+    {
+        return Eigen::Quaterniond( Eigen::AngleAxisd( -1.0E-4 * time, Eigen::Vector3d::UnitZ( ) ) );
+    };
+
+    // Define deforming bodies on inclined circular orbits (last body crosses the polar axis of deformed body)
+    std::vector< std::function< Eigen::Vector6d( const double ) > > deformingBodyStateFunctions;
+    std::vector< std::function< double( ) > > deformingBodyMasses;
+    std::vector< std::string > deformingBodies;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        const double orbitRadius = ( 5.0 + 3.0 * static_cast< double >( i ) ) * referenceRadius;
+        const double inclination = 0.3 + 0.6 * static_cast< double >( i );
+        const double meanMotion = 2.0E-5 / static_cast< double >( i + 1 );
+        deformingBodyStateFunctions.push_back( [ = ]( const double time )
+        {
+            Eigen::Vector6d deformingBodyState = deformedBodyStateFunction( time );
+            deformingBodyState.segment( 0, 3 ) += orbitRadius * (
+                        Eigen::AngleAxisd( inclination, Eigen::Vector3d::UnitX( ) ) *
+                        Eigen::Vector3d( std::cos( meanMotion * time ), std::sin( meanMotion * time ), 0.0 ) );
+            return deformingBodyState;
+        } );
+        deformingBodyMasses.push_back( [ = ]( ){ return 1.0E20 * static_cast< double >( i + 1 ); } );
+        deformingBodies.push_back( "Body" + std::to_string( i ) );
+    }
+    std::function< double( ) > deformedBodyMass = [ = ]( ){ return 5.0E22; };
+
+    // Define complex Love numbers up to degree 4, with degree 4 truncated at order 2.
+    std::vector< std::vector< std::complex< double > > > loveNumbers;
+    loveNumbers.push_back( std::vector< std::complex< double > >(
+    { std::complex< double >( 0.30, 1.0E-3 ), std::complex< double >( 0.31, 2.0E-3 ), std::complex< double >( 0.32, 3.0E-3 ) } ) );
+    loveNumbers.push_back( std::vector< std::complex< double > >( 4, std::complex< double >( 0.09, -1.0E-3 ) ) );
+    loveNumbers.push_back( std::vector< std::complex< double > >( 3, std::complex< double >( 0.05, 0.0 ) ) );
+
+    std::shared_ptr< BasicSolidBodyTideGravityFieldVariations > solidBodyGravityFieldVariations =
+            std::make_shared< BasicSolidBodyTideGravityFieldVariations >(
+                deformedBodyStateFunction, deformedBodyOrientationFunction, deformingBodyStateFunctions,
+                referenceRadius, deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies );
+
+    // Create interpolated corrections
+    std::function< void( const double, Eigen::MatrixXd&, Eigen::MatrixXd& ) > interpolatedCorrectionFunction =
+            createInterpolatedSphericalHarmonicCorrectionFunctions(
+                solidBodyGravityFieldVariations, 0.0, 1.0E5, 100.0,
+                std::make_shared< interpolators::LagrangeInterpolatorSettings >( 8 ) );
+
+    for( int j = 0; j < 5; j++ )
+    {
+        const double testTime = 1.0E4 + 1.6E4 * static_cast< double >( j ) + 37.0;
+
+        // Compute corrections directly from position of each body, for each degree and order
+        Eigen::MatrixXd directCosineCorrections = Eigen::MatrixXd::Zero( 3, 5 );
+        Eigen::MatrixXd directSineCorrections = Eigen::MatrixXd::Zero( 3, 5 );
+        for( unsigned int i = 0; i < deformingBodies.size( ); i++ )
+        {
+            Eigen::Vector3d relativeBodyFixedPosition = deformedBodyOrientationFunction( testTime ) *
+                    ( deformingBodyStateFunctions.at( i )( testTime ) -
+                      deformedBodyStateFunction( testTime ) ).segment( 0, 3 );
+            for( int n = 2; n <= 4; n++ )
+            {
+                for( unsigned int m = 0; m < loveNumbers.at( n - 2 ).size( ); m++ )
+                {
+                    std::complex< double > singleCorrection =
+                            calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude(
+                                loveNumbers.at( n - 2 ).at( m ), deformingBodyMasses.at( i )( ) / deformedBodyMass( ),
+                                referenceRadius, relativeBodyFixedPosition, n, m );
+                    directCosineCorrections( n - 2, m ) += singleCorrection.real( );
+                    if( m > 0 )
+                    {
+                        directSineCorrections( n - 2, m ) -= singleCorrection.imag( );
+                    }
+                }
+            }
+        }
+
+        // Compute corrections from object, both returned as pair and added to coefficient matrices
+        std::pair< Eigen::MatrixXd, Eigen::MatrixXd > corrections =
+                solidBodyGravityFieldVariations->calculateSphericalHarmonicsCorrections( testTime );
+        Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+        Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+        solidBodyGravityFieldVariations->addSphericalHarmonicsCorrections( testTime, sineCoefficients, cosineCoefficients );
+
+        Eigen::MatrixXd interpolatedCosineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+        Eigen::MatrixXd interpolatedSineCoefficients = Eigen::MatrixXd::Zero( 5, 5 );
+        interpolatedCorrectionFunction( testTime, interpolatedSineCoefficients, interpolatedCosineCoefficients );
+
+        // Compare results
+        const double correctionScale = directCosineCorrections.cwiseAbs( ).maxCoeff( );
+        for( int n = 2; n <= 4; n++ )
+        {
+            for( int m = 0; m <= 4; m++ )
+            {
+                BOOST_CHECK_SMALL( corrections.first( n - 2, m ) - directCosineCorrections( n - 2, m ),
+                                   1.0E-14 * correctionScale );
+                BOOST_CHECK_SMALL( corrections.second( n - 2, m ) - directSineCorrections( n - 2, m ),
+                                   1.0E-14 * correctionScale );
+                BOOST_CHECK_SMALL( cosineCoefficients( n, m ) - directCosineCorrections( n - 2, m ),
+                                   1.0E-14 * correctionScale );
+                BOOST_CHECK_SMALL( sineCoefficients( n, m ) - directSineCorrections( n - 2, m ),
+                                   1.0E-14 * correctionScale );
+                BOOST_CHECK_SMALL( interpolatedCosineCoefficients( n, m ) - directCosineCorrections( n - 2, m ),
+                                   1.0E-10 * correctionScale );
+                BOOST_CHECK_SMALL( interpolatedSineCoefficients( n, m ) - directSineCorrections( n - 2, m ),
+                                   1.0E-10 * correctionScale );
+            }
+        }
+        BOOST_CHECK_EQUAL( ( solidBodyGravityFieldVariations->getLastCosineCorrection( ) - cosineCoefficients ).norm( ), 0.0 );
+        BOOST_CHECK_EQUAL( ( solidBodyGravityFieldVariations->getLastSineCorrection( ) - sineCoefficients ).norm( ), 0.0 );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
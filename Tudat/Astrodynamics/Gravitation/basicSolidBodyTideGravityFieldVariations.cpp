@@ -139,14 +139,94 @@ void BasicSolidBodyTideGravityFieldVariations::setBodyGeometryParameters(
     Eigen::Vector3d relativeDeformingBodyPosition = toDeformedBodyFrameRotation * (
                 std::move( deformingBodyStateFunctions_[ bodyIndex ]( evaluationTime ) ).segment( 0, 3 ) -
             deformedBodyPosition );
-    Eigen::Vector3d  relativeDeformingBodySphericalPosition =coordinate_conversions::
-            convertCartesianToSpherical( relativeDeformingBodyPosition );
-
-    // Set geometric parameters of body causing deformation.
-    radiusRatio = deformedBodyReferenceRadius_ / relativeDeformingBodySphericalPosition.x( );
-    iLongitude = mathematical_constants::COMPLEX_I * relativeDeformingBodySphericalPosition.z( );
-    sineOfLatitude = std::sin( mathematical_constants::PI / 2.0 -
-                               relativeDeformingBodySphericalPosition.y( ) );
+
+    // Set geometric parameters of body causing deformation, directly from its Cartesian position.
+    double distance = relativeDeformingBodyPosition.norm( );
+    double distanceFromPolarAxis = std::sqrt(
+                relativeDeformingBodyPosition.x( ) * relativeDeformingBodyPosition.x( ) +
+                relativeDeformingBodyPosition.y( ) * relativeDeformingBodyPosition.y( ) );
+
+    radiusRatio = deformedBodyReferenceRadius_ / distance;
+    sineOfLatitude = relativeDeformingBodyPosition.z( ) / distance;
+    cosineOfLatitude = distanceFromPolarAxis / distance;
+    if( distanceFromPolarAxis > 0.0 )
+    {
+        cosineOfLongitude = relativeDeformingBodyPosition.x( ) / distanceFromPolarAxis;
+        sineOfLongitude = relativeDeformingBodyPosition.y( ) / distanceFromPolarAxis;
+    }
+    else
+    {
+        cosineOfLongitude = 1.0;
+        sineOfLongitude = 0.0;
+    }
+}
+
+//! Function to set the coefficients of the Legendre polynomial recursion, up to maximumDegree_.
+void BasicSolidBodyTideGravityFieldVariations::setLegendrePolynomialRecursionCoefficients( )
+{
+    legendreRecursionFirstCoefficients_ = Eigen::MatrixXd::Zero( maximumDegree_ + 1, maximumDegree_ + 1 );
+    legendreRecursionSecondCoefficients_ = Eigen::MatrixXd::Zero( maximumDegree_ + 1, maximumDegree_ + 1 );
+    legendreSectoralRecursionCoefficients_ = Eigen::VectorXd::Zero( maximumDegree_ + 1 );
+
+    for( int n = 1; n <= maximumDegree_; n++ )
+    {
+        double degree = static_cast< double >( n );
+
+        // Set coefficient for sectoral terms (geodesy normalization differs for order 0).
+        legendreSectoralRecursionCoefficients_( n ) =
+                ( n == 1 ) ? std::sqrt( 3.0 ) : std::sqrt( ( 2.0 * degree + 1.0 ) / ( 2.0 * degree ) );
+
+        // Set coefficients for non-sectoral terms.
+        for( int m = 0; m < n; m++ )
+        {
+            double order = static_cast< double >( m );
+            if( m == n - 1 )
+            {
+                legendreRecursionFirstCoefficients_( n, m ) = std::sqrt( 2.0 * degree + 1.0 );
+            }
+            else
+            {
+                legendreRecursionFirstCoefficients_( n, m ) = std::sqrt(
+                            ( 2.0 * degree - 1.0 ) * ( 2.0 * degree + 1.0 ) /
+                            ( ( degree - order ) * ( degree + order ) ) );
+                legendreRecursionSecondCoefficients_( n, m ) = std::sqrt(
+                            ( 2.0 * degree + 1.0 ) * ( degree + order - 1.0 ) * ( degree - order - 1.0 ) /
+                            ( ( degree - order ) * ( degree + order ) * ( 2.0 * degree - 3.0 ) ) );
+            }
+        }
+    }
+}
+
+//! Function to compute the Legendre polynomials of all bodies causing deformation.
+void BasicSolidBodyTideGravityFieldVariations::computeDeformingBodyLegendrePolynomials( )
+{
+    deformingBodyLegendrePolynomials_.col( 0 ).setConstant( 1.0 );
+    for( int n = 1; n <= maximumDegree_; n++ )
+    {
+        // Compute sectoral term
+        deformingBodyLegendrePolynomials_.col( getLegendrePolynomialIndex( n, n ) ) =
+                legendreSectoralRecursionCoefficients_( n ) * deformingBodyCosinesOfLatitude_.cwiseProduct(
+                    deformingBodyLegendrePolynomials_.col( getLegendrePolynomialIndex( n - 1, n - 1 ) ) );
+
+        // Compute non-sectoral terms
+        for( int m = 0; m < n; m++ )
+        {
+            if( m == n - 1 )
+            {
+                deformingBodyLegendrePolynomials_.col( getLegendrePolynomialIndex( n, m ) ) =
+                        legendreRecursionFirstCoefficients_( n, m ) * deformingBodySinesOfLatitude_.cwiseProduct(
+                            deformingBodyLegendrePolynomials_.col( getLegendrePolynomialIndex( n - 1, m ) ) );
+            }
+            else
+            {
+                deformingBodyLegendrePolynomials_.col( getLegendrePolynomialIndex( n, m ) ) =
+                        legendreRecursionFirstCoefficients_( n, m ) * deformingBodySinesOfLatitude_.cwiseProduct(
+                            deformingBodyLegendrePolynomials_.col( getLegendrePolynomialIndex( n - 1, m ) ) ) -
+                        legendreRecursionSecondCoefficients_( n, m ) *
+                        deformingBodyLegendrePolynomials_.col( getLegendrePolynomialIndex( n - 2, m ) );
+            }
+        }
+    }
 }
 
 //! Function for calculating spherical harmonic coefficient corrections.
@@ -158,67 +238,94 @@ calculateBasicSphericalHarmonicsCorrections(
     Eigen::MatrixXd cTermCorrections = Eigen::MatrixXd::Zero( numberOfDegrees_, numberOfOrders_ );
     Eigen::MatrixXd sTermCorrections = Eigen::MatrixXd::Zero( numberOfDegrees_, numberOfOrders_ );
 
-    // Iterate over all bodies causing deformation and calculate and add associated corrections
-    for( unsigned int i = 0; i < deformingBodyStateFunctions_.size( ); i++ )
+    calculateSphericalHarmonicsCorrectionsInPlace(
+                time, cTermCorrections.block( 0, 0, numberOfDegrees_, numberOfOrders_ ),
+                sTermCorrections.block( 0, 0, numberOfDegrees_, numberOfOrders_ ) );
+
+    return std::make_pair( cTermCorrections, sTermCorrections );
+}
+
+//! Function for calculating spherical harmonic coefficient corrections, setting them in pre-allocated blocks.
+void BasicSolidBodyTideGravityFieldVariations::calculateSphericalHarmonicsCorrectionsInPlace(
+        const double time,
+        Eigen::Block< Eigen::MatrixXd > cosineCorrections,
+        Eigen::Block< Eigen::MatrixXd > sineCorrections )
+{
+    const int numberOfDeformingBodies = deformingBodyStateFunctions_.size( );
+
+    // Set geometry of all bodies causing deformation, and initialize degree 2 scaling factor
+    for( int i = 0; i < numberOfDeformingBodies; i++ )
     {
         setBodyGeometryParameters( i, time );
-
-        // Calculate properties of currently considered body
         massRatio = deformingBodyMasses_[ i ]( ) / deformedBodyMass_( );
 
-        // Calculate all correction functions.
-        for( unsigned int j = 0; j < correctionFunctions.size( ); j++ )
+        deformingBodyRadiusRatios_( i ) = radiusRatio;
+        deformingBodySinesOfLatitude_( i ) = sineOfLatitude;
+        deformingBodyCosinesOfLatitude_( i ) = cosineOfLatitude;
+        deformingBodyDegreeScalingFactors_( i ) = massRatio * radiusRatio * radiusRatio * radiusRatio;
+        deformingBodyCosinesOfOrderTimesLongitude_( i, 0 ) = 1.0;
+        deformingBodySinesOfOrderTimesLongitude_( i, 0 ) = 0.0;
+        if( maximumOrder_ > 0 )
         {
-            correctionFunctions[ j ]( cTermCorrections, sTermCorrections );
+            deformingBodyCosinesOfOrderTimesLongitude_( i, 1 ) = cosineOfLongitude;
+            deformingBodySinesOfOrderTimesLongitude_( i, 1 ) = sineOfLongitude;
         }
     }
 
-    return std::make_pair( cTermCorrections, sTermCorrections );
-}
-
-//! Calculates basic solid body gravity field corrections due to single body.
-void BasicSolidBodyTideGravityFieldVariations::addBasicSolidBodyTideCorrections(
-        Eigen::MatrixXd& cTermCorrections,
-        Eigen::MatrixXd& sTermCorrections )
-{
-//    // Initialize power of radiusRatio^(N+1) (calculation starts at N=2)
-    radiusRatioPower = radiusRatio * radiusRatio * radiusRatio;
-
-    currentCosineCorrections_.setZero( );
-    currentSineCorrections_.setZero( );
+    // Compute cos( m * longitude ) and sin( m * longitude ) of all bodies by recursion
+    for( int m = 2; m <= maximumOrder_; m++ )
+    {
+        deformingBodyCosinesOfOrderTimesLongitude_.col( m ) =
+                deformingBodyCosinesOfOrderTimesLongitude_.col( m - 1 ).cwiseProduct(
+                    deformingBodyCosinesOfOrderTimesLongitude_.col( 1 ) ) -
+                deformingBodySinesOfOrderTimesLongitude_.col( m - 1 ).cwiseProduct(
+                    deformingBodySinesOfOrderTimesLongitude_.col( 1 ) );
+        deformingBodySinesOfOrderTimesLongitude_.col( m ) =
+                deformingBodySinesOfOrderTimesLongitude_.col( m - 1 ).cwiseProduct(
+                    deformingBodyCosinesOfOrderTimesLongitude_.col( 1 ) ) +
+                deformingBodyCosinesOfOrderTimesLongitude_.col( m - 1 ).cwiseProduct(
+                    deformingBodySinesOfOrderTimesLongitude_.col( 1 ) );
+    }
 
-    //    // Iterate over all love
-    std::complex< double > stokesCoefficientCorrection( 0.0, 0.0 );
+    computeDeformingBodyLegendrePolynomials( );
 
+    // Iterate over all degrees and orders, and sum contributions of all bodies before multiplying with Love number
+    cosineCorrections.setZero( );
+    sineCorrections.setZero( );
+    double cosineTermSum, sineTermSum;
+    std::complex< double > scaledLoveNumber;
     for( unsigned int n = 2; n < loveNumbers_.size( ) + 2; n++ )
     {
-        for( unsigned int m = 0; ( m <= n && m < loveNumbers_.at( n - 2 ).size( ) ); m++ )
+        if( n > 2 )
         {
-            updateTidalAmplitudeAndArgument( n, m );
-
-            // Calculate and add coefficients.
-            stokesCoefficientCorrection =
-                    calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude(
-                        loveNumbers_[ n - 2 ][ m ], massRatio, radiusRatioPower, tideAmplitude,
-                    tideArgument, n, m );
-
+            deformingBodyDegreeScalingFactors_ = deformingBodyDegreeScalingFactors_.cwiseProduct(
+                        deformingBodyRadiusRatios_ );
+        }
 
-            currentCosineCorrections_( n - 2, m ) += stokesCoefficientCorrection.real( );
+        for( unsigned int m = 0; ( m <= n && m < loveNumbers_.at( n - 2 ).size( ) ); m++ )
+        {
+            const int legendreIndex = getLegendrePolynomialIndex( n, m );
+            cosineTermSum = ( deformingBodyDegreeScalingFactors_.array( ) *
+                              deformingBodyLegendrePolynomials_.col( legendreIndex ).array( ) *
+                              deformingBodyCosinesOfOrderTimesLongitude_.col( m ).array( ) ).sum( );
+            sineTermSum = ( deformingBodyDegreeScalingFactors_.array( ) *
+                            deformingBodyLegendrePolynomials_.col( legendreIndex ).array( ) *
+                            deformingBodySinesOfOrderTimesLongitude_.col( m ).array( ) ).sum( );
+
+            // Set corrections as real and (negative) imaginary part of k_{nm} / ( 2n + 1 ) * ( sum of terms )
+            scaledLoveNumber = loveNumbers_[ n - 2 ][ m ] / ( 2.0 * static_cast< double >( n ) + 1.0 );
+            cosineCorrections( n - 2, m ) = scaledLoveNumber.real( ) * cosineTermSum +
+                    scaledLoveNumber.imag( ) * sineTermSum;
             if( m != 0 )
             {
-                currentSineCorrections_( n - 2, m ) -= stokesCoefficientCorrection.imag( );
+                sineCorrections( n - 2, m ) = scaledLoveNumber.real( ) * sineTermSum -
+                        scaledLoveNumber.imag( ) * cosineTermSum;
             }
         }
-
-        // Increment radius ratio power.
-        radiusRatioPower *= radiusRatio;
     }
 
-    cTermCorrections.block( 0, 0, maximumDegree_ - minimumDegree_ + 1, maximumOrder_  - minimumOrder_ + 1 ) +=
-            currentCosineCorrections_;
-    sTermCorrections.block( 0, 0, maximumDegree_ - minimumDegree_ + 1, maximumOrder_  - minimumOrder_ + 1 ) +=
-            currentSineCorrections_;
-
+    currentCosineCorrections_ = cosineCorrections;
+    currentSineCorrections_ = sineCorrections;
 }
 
 }
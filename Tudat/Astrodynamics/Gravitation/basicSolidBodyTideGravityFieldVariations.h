@@ -128,6 +128,14 @@ std::pair< Eigen::MatrixXd, Eigen::MatrixXd > calculateSolidBodyTideSingleCoeffi
 
 //! Class to calculate first-order solid body tide gravity field variations on a single body raised
 //! by any number of bodies up to any degree and order.
+/*!
+ *  Class to calculate first-order solid body tide gravity field variations on a single body raised
+ *  by any number of bodies up to any degree and order. The (geodesy-normalized) Legendre polynomials and
+ *  longitude-dependent terms of all bodies causing deformation are evaluated together by recursion, after which the
+ *  contributions of all bodies are summed, and multiplied by the Love number once per degree and order. All
+ *  intermediate quantities are stored in pre-allocated member variables, so that no memory is allocated when
+ *  computing the corrections through calculateSphericalHarmonicsCorrectionsInPlace (or addSphericalHarmonicsCorrections)
+ */
 class BasicSolidBodyTideGravityFieldVariations: public GravityFieldVariations
 {
 public:
@@ -171,15 +179,23 @@ public:
         loveNumbers_( loveNumbers ),
         deformingBodies_( deformingBodies )
     {
-        // Set basic deformation functon as function to be evaluated when requesting variations.
-        correctionFunctions.push_back(
-                    std::bind(
-                        &BasicSolidBodyTideGravityFieldVariations::addBasicSolidBodyTideCorrections,
-                        this, std::placeholders::_1, std::placeholders::_2 ) );
         currentCosineCorrections_ = Eigen::MatrixXd::Zero(
                     maximumDegree_ - minimumDegree_ + 1, maximumOrder_ - minimumOrder_ + 1 );
         currentSineCorrections_ = Eigen::MatrixXd::Zero(
                     maximumDegree_ - minimumDegree_ + 1, maximumOrder_ - minimumOrder_ + 1 );
+
+        // Pre-allocate properties of all bodies causing deformation.
+        const int numberOfDeformingBodies = deformingBodyStateFunctions_.size( );
+        deformingBodyRadiusRatios_ = Eigen::VectorXd::Zero( numberOfDeformingBodies );
+        deformingBodySinesOfLatitude_ = Eigen::VectorXd::Zero( numberOfDeformingBodies );
+        deformingBodyCosinesOfLatitude_ = Eigen::VectorXd::Zero( numberOfDeformingBodies );
+        deformingBodyDegreeScalingFactors_ = Eigen::VectorXd::Zero( numberOfDeformingBodies );
+        deformingBodyLegendrePolynomials_ = Eigen::MatrixXd::Zero(
+                    numberOfDeformingBodies, ( maximumDegree_ + 1 ) * ( maximumDegree_ + 2 ) / 2 );
+        deformingBodyCosinesOfOrderTimesLongitude_ = Eigen::MatrixXd::Zero( numberOfDeformingBodies, maximumOrder_ + 1 );
+        deformingBodySinesOfOrderTimesLongitude_ = Eigen::MatrixXd::Zero( numberOfDeformingBodies, maximumOrder_ + 1 );
+
+        setLegendrePolynomialRecursionCoefficients( );
     }
 
     //! Destructor
@@ -197,6 +213,19 @@ public:
     std::pair< Eigen::MatrixXd, Eigen::MatrixXd > calculateBasicSphericalHarmonicsCorrections(
             const double time );
 
+    //! Function for calculating spherical harmonic coefficient corrections, setting them in pre-allocated blocks.
+    /*!
+     *  Function for calculating spherical harmonic coefficient corrections, setting them in pre-allocated blocks,
+     *  without allocating any memory.
+     *  \param time Time at which variations are to be calculated.
+     *  \param cosineCorrections Block in which variations in cosine coefficients are set (returned by reference).
+     *  \param sineCorrections Block in which variations in sine coefficients are set (returned by reference).
+     */
+    virtual void calculateSphericalHarmonicsCorrectionsInPlace(
+            const double time,
+            Eigen::Block< Eigen::MatrixXd > cosineCorrections,
+            Eigen::Block< Eigen::MatrixXd > sineCorrections );
+
     //! Derived function for calculating spherical harmonic coefficient corrections.
     /*!
      *  Derived function for calculating spherical harmonic coefficient corrections.
@@ -387,31 +416,6 @@ public:
 
 protected:
 
-    //! List of functions to call for calculating spherical harmonic corrections.
-    /*!
-     *  List of functions to call for calculating spherical harmonic corrections. Each function
-     *  modifies MatrixXd arguments (cosine, sine) as they are passed by reference, and adds
-     *  the required (tidal) correction.
-     */
-    std::vector< std::function< void( Eigen::MatrixXd&, Eigen::MatrixXd& ) > >
-    correctionFunctions;
-
-    //! Calculates basic solid body gravity field corrections due to single body.
-    /*!
-     *  Calculates basic solid body gravity field corrections for all degrees and orders set.
-     *  The arguments are modified as they are passed by reference, through which the corrections
-     *  are returned.
-     *  Class variables denoting properties of currently considered body must have been set before
-     *  this function is called.
-     *  \param cTermCorrections Corrections to cosine terms
-     *  (passed by reference; correction added to input value).
-     *  \param sTermCorrections Corrections to sine terms.
-     *
-     *  (passed by reference; correction added to input value).
-     */
-    virtual void addBasicSolidBodyTideCorrections(
-            Eigen::MatrixXd& cTermCorrections, Eigen::MatrixXd& sTermCorrections );
-
     //! Sets current properties (mass state) of body causing tidal deformation.
     /*!
      *  Sets current properties (mass state) of body causing tidal deformation.
@@ -422,18 +426,27 @@ protected:
     virtual void setBodyGeometryParameters(
             const int bodyIndex, const double evaluationTime);
 
-    //! Calculate tidal amplitude and argument at current degree and order.
+    //! Function to compute the Legendre polynomials of all bodies causing deformation.
     /*!
-     * Calculate tidal amplitude and argument at current degree and order.
-     * \param degree Degree of tide.
-     * \param order Order of tide.
+     *  Function to compute the (geodesy-normalized) Legendre polynomials of all bodies causing deformation, up to
+     *  maximumDegree_, by recursion. The sines and cosines of latitude of the bodies must have been set before this
+     *  function is called. Results are set in the deformingBodyLegendrePolynomials_ member variable.
      */
-    virtual void updateTidalAmplitudeAndArgument(
-            const int degree, const int order )
+    void computeDeformingBodyLegendrePolynomials( );
+
+    //! Function to set the coefficients of the Legendre polynomial recursion, up to maximumDegree_.
+    void setLegendrePolynomialRecursionCoefficients( );
+
+    //! Function to retrieve the column index of given degree and order in deformingBodyLegendrePolynomials_
+    /*!
+     *  Function to retrieve the column index of given degree and order in deformingBodyLegendrePolynomials_
+     *  \param degree Degree of Legendre polynomial
+     *  \param order Order of Legendre polynomial
+     *  \return Column index of given degree and order in deformingBodyLegendrePolynomials_
+     */
+    int getLegendrePolynomialIndex( const int degree, const int order )
     {
-        tideAmplitude = basic_mathematics::computeLegendrePolynomialExplicit(
-                    degree, order, sineOfLatitude );
-        tideArgument = static_cast< double >( order ) * iLongitude;
+        return degree * ( degree + 1 ) / 2 + order;
     }
 
 
@@ -506,14 +519,6 @@ protected:
      */
     double radiusRatio;
 
-    //! Ratio of radii in current calculation step to the power (degree+1).
-    /*!
-     *  Ratio of equatorial radius of body being deformed over distance between center of body
-     *  being deformed to center of body causing deformation, to the power (degree+1), in current
-     *  calculation step
-     */
-    double radiusRatioPower;
-
     //! Sine of latitude of currently considered body in current calculation step
     /*!
      *  Sine of latitude of body causing deformation in frame fixed to body being deformed in
@@ -521,27 +526,14 @@ protected:
      */
     double sineOfLatitude;
 
-    //! Longitude of currently considered body times i in current calculation step
-    /*!
-     *  i (sqrt(-1)) times longitude of body causing deformation in frame fixed to body being
-     *  deformed in current calculation step.
-     */
-    std::complex< double > iLongitude;
+    //! Cosine of latitude of currently considered body in current calculation step
+    double cosineOfLatitude;
 
-    //! Current argument of the tide.
-    /*!
-     *  Current argument of the tide, to be used as input to
-     *  calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude, modulates the tide as
-     *  exp( -tideArgument).
-     */
-    std::complex< double > tideArgument;
+    //! Sine of longitude of currently considered body in current calculation step
+    double sineOfLongitude;
 
-    //! Current amplitude of the tide.
-    /*!
-     *  Current amplitude of the tide, to be used as input to
-     *  calculateSolidBodyTideSingleCoefficientSetCorrectionFromAmplitude.
-     */
-    double tideAmplitude;
+    //! Cosine of longitude of currently considered body in current calculation step
+    double cosineOfLongitude;
 
     //! Current position of body being deformed.
     Eigen::Vector3d deformedBodyPosition;
@@ -555,6 +547,36 @@ protected:
     //! Tidal corrections to sine coefficients at current calculation step.
     Eigen::MatrixXd currentSineCorrections_;
 
+    //! Coefficients multiplying sine of latitude times P_{n-1,m} in Legendre polynomial recursion (index n,m).
+    Eigen::MatrixXd legendreRecursionFirstCoefficients_;
+
+    //! Coefficients multiplying P_{n-2,m} in Legendre polynomial recursion (index n,m).
+    Eigen::MatrixXd legendreRecursionSecondCoefficients_;
+
+    //! Coefficients multiplying cosine of latitude times P_{n-1,n-1} in sectoral Legendre polynomial recursion (index n).
+    Eigen::VectorXd legendreSectoralRecursionCoefficients_;
+
+    //! Ratios of reference radius and distance for all bodies causing deformation, in current calculation step.
+    Eigen::VectorXd deformingBodyRadiusRatios_;
+
+    //! Sines of latitude of all bodies causing deformation, in current calculation step.
+    Eigen::VectorXd deformingBodySinesOfLatitude_;
+
+    //! Cosines of latitude of all bodies causing deformation, in current calculation step.
+    Eigen::VectorXd deformingBodyCosinesOfLatitude_;
+
+    //! Mass ratio times radius ratio to the power (degree+1) of all bodies causing deformation, at current degree.
+    Eigen::VectorXd deformingBodyDegreeScalingFactors_;
+
+    //! Legendre polynomials of all bodies causing deformation (row: body; column: see getLegendrePolynomialIndex).
+    Eigen::MatrixXd deformingBodyLegendrePolynomials_;
+
+    //! Cosines of order times longitude of all bodies causing deformation (row: body; column: order).
+    Eigen::MatrixXd deformingBodyCosinesOfOrderTimesLongitude_;
+
+    //! Sines of order times longitude of all bodies causing deformation (row: body; column: order).
+    Eigen::MatrixXd deformingBodySinesOfOrderTimesLongitude_;
+
 };
 
 } // namespace gravitation
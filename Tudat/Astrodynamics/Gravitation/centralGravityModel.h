@@ -76,6 +76,54 @@ Eigen::Vector3d computeGravitationalAcceleration(
         const double gravitationalParameterOfBodyExertingAcceleration,
         const Eigen::Vector3d& positionOfBodyExertingAcceleration = Eigen::Vector3d::Zero( ) );
 
+//! Compute gravitational acceleration, for arbitrary scalar type of the positions.
+/*!
+ * Computes gravitational acceleration experienced by body1, due to its interaction with body2, for an arbitrary scalar
+ * type of the positions (e.g. basic_mathematics::DualNumber, to compute partial derivatives by automatic
+ * differentiation). See double-precision overload for details.
+ * \param positionOfBodySubjectToAcceleration Position vector of body subject to acceleration (body1) [m].
+ * \param gravitationalParameterOfBodyExertingAcceleration Gravitational parameter of body exerting
+ *          acceleration (body2) [m^3 s^-2].
+ * \param positionOfBodyExertingAcceleration Position vector of body exerting acceleration (body2) [m].
+ * \return Gravitational acceleration exerted on body1 [m s^-2].
+ */
+template< typename ScalarType >
+Eigen::Matrix< ScalarType, 3, 1 > computeGravitationalAcceleration(
+        const Eigen::Matrix< ScalarType, 3, 1 >& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameterOfBodyExertingAcceleration,
+        const Eigen::Matrix< ScalarType, 3, 1 >& positionOfBodyExertingAcceleration )
+{
+    Eigen::Matrix< ScalarType, 3, 1 > relativePosition =
+            positionOfBodySubjectToAcceleration - positionOfBodyExertingAcceleration;
+    ScalarType distance = relativePosition.norm( );
+    return ( -gravitationalParameterOfBodyExertingAcceleration * relativePosition ) /
+            ( distance * distance * distance );
+}
+
+//! Compute gravitational acceleration, for arbitrary scalar type of the positions and gravitational parameter.
+/*!
+ * Computes gravitational acceleration experienced by body1, due to its interaction with body2, for an arbitrary scalar
+ * type of the positions and gravitational parameter (e.g. basic_mathematics::DualNumber, to compute partial derivatives
+ * w.r.t. the gravitational parameter by automatic differentiation). See double-precision overload for details.
+ * \param positionOfBodySubjectToAcceleration Position vector of body subject to acceleration (body1) [m].
+ * \param gravitationalParameterOfBodyExertingAcceleration Gravitational parameter of body exerting
+ *          acceleration (body2) [m^3 s^-2].
+ * \param positionOfBodyExertingAcceleration Position vector of body exerting acceleration (body2) [m].
+ * \return Gravitational acceleration exerted on body1 [m s^-2].
+ */
+template< typename ScalarType >
+Eigen::Matrix< ScalarType, 3, 1 > computeGravitationalAcceleration(
+        const Eigen::Matrix< ScalarType, 3, 1 >& positionOfBodySubjectToAcceleration,
+        const ScalarType& gravitationalParameterOfBodyExertingAcceleration,
+        const Eigen::Matrix< ScalarType, 3, 1 >& positionOfBodyExertingAcceleration )
+{
+    Eigen::Matrix< ScalarType, 3, 1 > relativePosition =
+            positionOfBodySubjectToAcceleration - positionOfBodyExertingAcceleration;
+    ScalarType distance = relativePosition.norm( );
+    return ( -gravitationalParameterOfBodyExertingAcceleration * relativePosition ) /
+            ( distance * distance * distance );
+}
+
 //! Compute gravitational force.
 /*!
  * Computes gravitational force experienced by body1, due to its interaction with body2.
@@ -35,24 +35,32 @@ void PairInterpolationInterface::getCosineSinePair(
 }
 
 
+//! Function for calculating corrections, setting them in pre-allocated blocks.
+void GravityFieldVariations::calculateSphericalHarmonicsCorrectionsInPlace(
+        const double time,
+        Eigen::Block< Eigen::MatrixXd > cosineCorrections,
+        Eigen::Block< Eigen::MatrixXd > sineCorrections )
+{
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > correctionPair =
+            calculateSphericalHarmonicsCorrections( time );
+    cosineCorrections = correctionPair.first;
+    sineCorrections = correctionPair.second;
+}
+
 //! Function to add sine and cosine corrections at given time to coefficient matrices.
 void GravityFieldVariations::addSphericalHarmonicsCorrections(
         const double time, Eigen::MatrixXd& sineCoefficients, Eigen::MatrixXd& cosineCoefficients )
 {
-    // Calculate corrections.
-    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > correctionPair =
-            calculateSphericalHarmonicsCorrections( time );
+    // Calculate corrections directly in blocks of latest corrections.
+    calculateSphericalHarmonicsCorrectionsInPlace(
+                time, lastCosineCorrection_.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ ),
+                lastSineCorrection_.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ ) );
 
     // Add corrections to existing values
-    sineCoefficients.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ )
-            += correctionPair.second;
-    lastSineCorrection_.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ )
-            = correctionPair.second;
-
-    cosineCoefficients.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ )
-            += correctionPair.first;
-    lastCosineCorrection_.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ )
-            = correctionPair.first;
+    sineCoefficients.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ ) +=
+            lastSineCorrection_.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ );
+    cosineCoefficients.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ ) +=
+            lastCosineCorrection_.block( minimumDegree_, minimumOrder_, numberOfDegrees_, numberOfOrders_ );
 }
 
 //! Function to retrieve a variation object of given type (and name if necessary).
@@ -130,26 +138,19 @@ createInterpolatedSphericalHarmonicCorrectionFunctions(
     // Declare map of combined cosine and since corrections, to be filled and passed to interpolator
     std::map< double, Eigen::MatrixXd > cosineSineCorrectionsMap;
 
-    // Perform once for matrices size determination.
+    // Retrieve size of correction blocks.
     double currentTime = initialTime;
-    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > singleCorrections;
-    singleCorrections = variationObject->calculateSphericalHarmonicsCorrections( currentTime );
-    int correctionDegrees = singleCorrections.first.rows( );
-    int correctionOrders = singleCorrections.first.cols( );
+    int correctionDegrees = variationObject->getNumberOfDegrees( );
+    int correctionOrders = variationObject->getNumberOfOrders( );
 
     // Loop over all times at which corrections are to be calculated.
-    Eigen::MatrixXd cosineSineCorrections;
+    Eigen::MatrixXd cosineSineCorrections = Eigen::MatrixXd::Zero( correctionDegrees, 2 * correctionOrders );
     while( currentTime < finalTime )
     {
-        // Calculate current corrections.
-        singleCorrections = variationObject->calculateSphericalHarmonicsCorrections( currentTime );
-
-        // Set current corrections in single block.
-        cosineSineCorrections = Eigen::MatrixXd::Zero( correctionDegrees, 2 * correctionOrders );
-        cosineSineCorrections.block( 0, 0, correctionDegrees, correctionOrders ) +=
-                singleCorrections.first;
-        cosineSineCorrections.block( 0, correctionOrders, correctionDegrees, correctionOrders ) +=
-                singleCorrections.second;
+        // Calculate current corrections, directly in single (concatenated) block.
+        variationObject->calculateSphericalHarmonicsCorrectionsInPlace(
+                    currentTime, cosineSineCorrections.block( 0, 0, correctionDegrees, correctionOrders ),
+                    cosineSineCorrections.block( 0, correctionOrders, correctionDegrees, correctionOrders ) );
         cosineSineCorrectionsMap[ currentTime ] = cosineSineCorrections;
 
         // Increment time.
@@ -171,6 +171,21 @@ public:
     virtual std::pair< Eigen::MatrixXd, Eigen::MatrixXd > calculateSphericalHarmonicsCorrections(
             const double time ) = 0;
 
+    //! Function for calculating corrections, setting them in pre-allocated blocks.
+    /*!
+     *  Function for calculating corrections at given time, setting them in pre-allocated blocks (of size
+     *  numberOfDegrees_ x numberOfOrders_). This base class implementation copies the output of
+     *  calculateSphericalHarmonicsCorrections. Derived classes may override this function to compute the corrections
+     *  directly in the blocks, without allocating any memory.
+     *  \param time Time at which variations are to be calculated.
+     *  \param cosineCorrections Block in which variations in cosine coefficients are set (returned by reference).
+     *  \param sineCorrections Block in which variations in sine coefficients are set (returned by reference).
+     */
+    virtual void calculateSphericalHarmonicsCorrectionsInPlace(
+            const double time,
+            Eigen::Block< Eigen::MatrixXd > cosineCorrections,
+            Eigen::Block< Eigen::MatrixXd > sineCorrections );
+
     //! Function to add sine and cosine corrections at given time to coefficient matrices.
     /*!
      *  Function to add sine and cosine corrections at given time to coefficient matrices.
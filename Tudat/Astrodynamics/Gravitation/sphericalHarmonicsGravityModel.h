@@ -475,6 +475,26 @@ public:
         return getSineHarmonicsCoefficients;
     }
 
+    //! Function to retrieve the cosine coefficients, as set by last call to updateMembers.
+    /*!
+     *  Function to retrieve the cosine coefficients, as set by last call to updateMembers.
+     *  \return Cosine coefficients, as set by last call to updateMembers.
+     */
+    const Eigen::MatrixXd& getCurrentCosineHarmonicCoefficients( )
+    {
+        return cosineHarmonicCoefficients;
+    }
+
+    //! Function to retrieve the sine coefficients, as set by last call to updateMembers.
+    /*!
+     *  Function to retrieve the sine coefficients, as set by last call to updateMembers.
+     *  \return Sine coefficients, as set by last call to updateMembers.
+     */
+    const Eigen::MatrixXd& getCurrentSineHarmonicCoefficients( )
+    {
+        return sineHarmonicCoefficients;
+    }
+
     //! Function to retrieve the current rotation from body-fixed frame to integration frame, in the form of a quaternion.
     /*!
      *  Function to retrieve the current rotation from body-fixed frame to integration frame, in the form of a quaternion.
@@ -495,6 +515,16 @@ public:
         return rotationToIntegrationFrame_.toRotationMatrix( );
     }
 
+    //! Function to retrieve the function returning the rotation from body-fixed frame to integration frame.
+    /*!
+     *  Function to retrieve the function returning the rotation from body-fixed frame to integration frame.
+     *  \return Function returning the rotation from body-fixed frame to integration frame.
+     */
+    std::function< Eigen::Quaterniond( ) > getRotationFromBodyFixedToIntegrationFrameFunction( )
+    {
+        return rotationFromBodyFixedToIntegrationFrameFunction_;
+    }
+
     //! Function to set whether each of the separate spherical harmonic terms should be saved
     /*!
      * Function to set whether each of the separate spherical harmonic terms should be saved (in accelerationPerTerm_ member
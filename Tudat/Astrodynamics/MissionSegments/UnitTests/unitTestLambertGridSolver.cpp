@@ -0,0 +1,241 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/Astrodynamics/MissionSegments/lambertGridSolver.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/multiRevolutionLambertTargeterIzzo.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_lambert_grid_solver )
+
+//! Function to compute the state of a body in a circular orbit, slightly inclined w.r.t. the xy-plane.
+Eigen::Vector6d computeCircularOrbitState( const double time, const double radius, const double phase,
+                                           const double gravitationalParameter )
+{
+    const double inclination = 0.02;
+    const double meanMotion = std::sqrt( gravitationalParameter / ( radius * radius * radius ) );
+    const double angle = phase + meanMotion * time;
+    const double velocity = radius * meanMotion;
+
+    Eigen::Vector6d state;
+    state << radius * std::cos( angle ), radius * std::sin( angle ) * std::cos( inclination ),
+            radius * std::sin( angle ) * std::sin( inclination ),
+            -velocity * std::sin( angle ), velocity * std::cos( angle ) * std::cos( inclination ),
+            velocity * std::cos( angle ) * std::sin( inclination );
+    return state;
+}
+
+//! Function to check whether two matrices are equal, with NaN entries being considered equal.
+bool areMatricesIdentical( const Eigen::MatrixXd& firstMatrix, const Eigen::MatrixXd& secondMatrix )
+{
+    return ( ( firstMatrix.array( ) == secondMatrix.array( ) ) ||
+             ( ( firstMatrix.array( ) != firstMatrix.array( ) ) &&
+               ( secondMatrix.array( ) != secondMatrix.array( ) ) ) ).all( );
+}
+
+//! Test grid solution against individual Lambert problem solutions.
+BOOST_AUTO_TEST_CASE( testLambertGridSolver )
+{
+    const double sunGravitationalParameter = 1.32712440018e20;
+    const double astronomicalUnit = physical_constants::ASTRONOMICAL_UNIT;
+
+    std::function< Eigen::Vector6d( const double ) > earthStateFunction = [ = ]( const double time )
+    {
+        return computeCircularOrbitState( time, astronomicalUnit, 0.0, sunGravitationalParameter );
+    };
+    std::function< Eigen::Vector6d( const double ) > marsStateFunction = [ = ]( const double time )
+    {
+        return computeCircularOrbitState( time, 1.524 * astronomicalUnit, 0.8, sunGravitationalParameter );
+    };
+
+    // Create grid; first arrival epochs precede part of the departure epochs.
+    const int numberOfDepartureEpochs = 15, numberOfArrivalEpochs = 40;
+    Eigen::VectorXd departureEpochs =
+            Eigen::VectorXd::LinSpaced( numberOfDepartureEpochs, 0.0, 140.0 ) * physical_constants::JULIAN_DAY;
+    Eigen::VectorXd arrivalEpochs =
+            Eigen::VectorXd::LinSpaced( numberOfArrivalEpochs, 100.0, 1660.0 ) * physical_constants::JULIAN_DAY;
+
+    const int maximumNumberOfRevolutions = 2;
+    mission_segments::LambertGridSolver gridSolver(
+                earthStateFunction, marsStateFunction, departureEpochs, arrivalEpochs,
+                sunGravitationalParameter, maximumNumberOfRevolutions, 4 );
+    BOOST_CHECK_EQUAL( gridSolver.getNumberOfBranches( ), 5 );
+    BOOST_CHECK_EQUAL( gridSolver.getBranchNumberOfRevolutions( 4 ), 2 );
+    BOOST_CHECK_EQUAL( gridSolver.getBranchIsRightBranch( 3 ), false );
+    BOOST_CHECK_EQUAL( gridSolver.getBranchIsRightBranch( 4 ), true );
+
+    Eigen::MatrixXd zeroRevolutionDeltaV = gridSolver.getBranchTotalDeltaV( 0 );
+    Eigen::MatrixXd zeroRevolutionC3 = gridSolver.getBranchDepartureC3( 0 );
+    Eigen::MatrixXd zeroRevolutionArrivalVelocity = gridSolver.getBranchArrivalExcessVelocity( 0 );
+    Eigen::MatrixXd totalDeltaV = gridSolver.getTotalDeltaV( );
+    Eigen::MatrixXi optimalBranchIndices = gridSolver.getOptimalBranchIndices( );
+
+    int numberOfMultiRevolutionSolutions = 0;
+    for( int i = 0; i < numberOfDepartureEpochs; i++ )
+    {
+        Eigen::Vector6d departureState = earthStateFunction( departureEpochs( i ) );
+        for( int j = 0; j < numberOfArrivalEpochs; j++ )
+        {
+            Eigen::Vector6d arrivalState = marsStateFunction( arrivalEpochs( j ) );
+            const double timeOfFlight = arrivalEpochs( j ) - departureEpochs( i );
+
+            // Check that cells with non-positive time of flight have no solution.
+            if( timeOfFlight <= 0.0 )
+            {
+                BOOST_CHECK( zeroRevolutionDeltaV( i, j ) != zeroRevolutionDeltaV( i, j ) );
+                BOOST_CHECK_EQUAL( optimalBranchIndices( i, j ), -1 );
+                continue;
+            }
+
+            // Compare zero-revolution solution (obtained with initial guess from neighbour) to
+            // solution obtained with default initial guess.
+            Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+            mission_segments::solveLambertProblemIzzo(
+                        departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ), timeOfFlight,
+                        sunGravitationalParameter, velocityAtDeparture, velocityAtArrival );
+            const double departureExcessVelocity = ( velocityAtDeparture - departureState.segment( 3, 3 ) ).norm( );
+            const double arrivalExcessVelocity = ( velocityAtArrival - arrivalState.segment( 3, 3 ) ).norm( );
+
+            BOOST_CHECK_CLOSE_FRACTION( zeroRevolutionC3( i, j ),
+                                        departureExcessVelocity * departureExcessVelocity, 1.0E-7 );
+            BOOST_CHECK_CLOSE_FRACTION( zeroRevolutionArrivalVelocity( i, j ), arrivalExcessVelocity, 1.0E-7 );
+            BOOST_CHECK_CLOSE_FRACTION( zeroRevolutionDeltaV( i, j ),
+                                        departureExcessVelocity + arrivalExcessVelocity, 1.0E-7 );
+
+            // Compare multi-revolution solutions to those of the multi-revolution targeter.
+            mission_segments::MultiRevolutionLambertTargeterIzzo multiRevolutionTargeter(
+                        departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ), timeOfFlight,
+                        sunGravitationalParameter );
+            const int maximumFeasibleNumberOfRevolutions = multiRevolutionTargeter.getMaximumNumberOfRevolutions( );
+            for( int branchIndex = 1; branchIndex < gridSolver.getNumberOfBranches( ); branchIndex++ )
+            {
+                const double branchDeltaV = gridSolver.getBranchTotalDeltaV( branchIndex )( i, j );
+                if( gridSolver.getBranchNumberOfRevolutions( branchIndex ) > maximumFeasibleNumberOfRevolutions )
+                {
+                    BOOST_CHECK( branchDeltaV != branchDeltaV );
+                }
+                else
+                {
+                    multiRevolutionTargeter.computeForRevolutionsAndBranch(
+                                gridSolver.getBranchNumberOfRevolutions( branchIndex ),
+                                gridSolver.getBranchIsRightBranch( branchIndex ) );
+                    BOOST_CHECK_CLOSE_FRACTION(
+                                branchDeltaV,
+                                ( multiRevolutionTargeter.getInertialVelocityAtDeparture( ) -
+                                  departureState.segment( 3, 3 ) ).norm( ) +
+                                ( multiRevolutionTargeter.getInertialVelocityAtArrival( ) -
+                                  arrivalState.segment( 3, 3 ) ).norm( ), 1.0E-14 );
+                    numberOfMultiRevolutionSolutions++;
+                }
+
+                // Check that optimal solution does not exceed that of any branch.
+                if( branchDeltaV == branchDeltaV )
+                {
+                    BOOST_CHECK( totalDeltaV( i, j ) <= branchDeltaV );
+                }
+            }
+            BOOST_CHECK( totalDeltaV( i, j ) <= zeroRevolutionDeltaV( i, j ) );
+            BOOST_CHECK_EQUAL( totalDeltaV( i, j ),
+                               gridSolver.getBranchTotalDeltaV( optimalBranchIndices( i, j ) )( i, j ) );
+        }
+    }
+
+    // Check that multi-revolution solutions were tested.
+    BOOST_CHECK( numberOfMultiRevolutionSolutions > 0 );
+
+    // Check that results are independent of number of threads.
+    mission_segments::LambertGridSolver serialGridSolver(
+                earthStateFunction, marsStateFunction, departureEpochs, arrivalEpochs,
+                sunGravitationalParameter, maximumNumberOfRevolutions, 1 );
+    for( int branchIndex = 0; branchIndex < gridSolver.getNumberOfBranches( ); branchIndex++ )
+    {
+        BOOST_CHECK( areMatricesIdentical( gridSolver.getBranchTotalDeltaV( branchIndex ),
+                                           serialGridSolver.getBranchTotalDeltaV( branchIndex ) ) );
+        BOOST_CHECK( areMatricesIdentical( gridSolver.getBranchDepartureC3( branchIndex ),
+                                           serialGridSolver.getBranchDepartureC3( branchIndex ) ) );
+    }
+    BOOST_CHECK( optimalBranchIndices == serialGridSolver.getOptimalBranchIndices( ) );
+
+    // Check that zero-revolution solution without initial guess from neighbour is identical to
+    // individual solutions, and that no multi-revolution branches are computed by default.
+    mission_segments::LambertGridSolver zeroRevolutionGridSolver(
+                earthStateFunction, marsStateFunction, departureEpochs, arrivalEpochs,
+                sunGravitationalParameter, 0, 2, false );
+    BOOST_CHECK_EQUAL( zeroRevolutionGridSolver.getNumberOfBranches( ), 1 );
+    BOOST_CHECK( areMatricesIdentical( zeroRevolutionGridSolver.getTotalDeltaV( ),
+                                       zeroRevolutionGridSolver.getBranchTotalDeltaV( 0 ) ) );
+
+    Eigen::Vector6d departureState = earthStateFunction( departureEpochs( 3 ) );
+    Eigen::Vector6d arrivalState = marsStateFunction( arrivalEpochs( 20 ) );
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    mission_segments::solveLambertProblemIzzo(
+                departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ), arrivalEpochs( 20 ) - departureEpochs( 3 ),
+                sunGravitationalParameter, velocityAtDeparture, velocityAtArrival );
+    BOOST_CHECK_EQUAL( zeroRevolutionGridSolver.getDepartureC3( )( 3, 20 ),
+                       ( velocityAtDeparture - departureState.segment( 3, 3 ) ).squaredNorm( ) );
+}
+
+//! Test Izzo Lambert solver with initial guess.
+BOOST_AUTO_TEST_CASE( testLambertProblemIzzoFromInitialGuess )
+{
+    const double gravitationalParameter = 398600.4418;
+    Eigen::Vector3d positionAtDeparture( 15945.34, 0.0, 0.0 );
+    Eigen::Vector3d positionAtArrival( 12214.83899, 10249.46731, 0.0 );
+    const double timeOfFlight = 76.0 * 60.0;
+
+    // Solve with default initial guess.
+    Eigen::Vector3d velocityAtDeparture, velocityAtArrival;
+    double xParameter = TUDAT_NAN;
+    mission_segments::solveLambertProblemIzzoFromInitialGuess(
+                positionAtDeparture, positionAtArrival, timeOfFlight, gravitationalParameter,
+                velocityAtDeparture, velocityAtArrival, xParameter );
+
+    Eigen::Vector3d expectedVelocityAtDeparture, expectedVelocityAtArrival;
+    mission_segments::solveLambertProblemIzzo(
+                positionAtDeparture, positionAtArrival, timeOfFlight, gravitationalParameter,
+                expectedVelocityAtDeparture, expectedVelocityAtArrival );
+    BOOST_CHECK( velocityAtDeparture == expectedVelocityAtDeparture );
+    BOOST_CHECK( velocityAtArrival == expectedVelocityAtArrival );
+    BOOST_CHECK( xParameter > -1.0 && xParameter < 1.0 );
+
+    // Solve slightly perturbed problem, starting from previous solution.
+    double perturbedXParameter = xParameter;
+    mission_segments::solveLambertProblemIzzoFromInitialGuess(
+                positionAtDeparture, positionAtArrival, 1.01 * timeOfFlight, gravitationalParameter,
+                velocityAtDeparture, velocityAtArrival, perturbedXParameter );
+    mission_segments::solveLambertProblemIzzo(
+                positionAtDeparture, positionAtArrival, 1.01 * timeOfFlight, gravitationalParameter,
+                expectedVelocityAtDeparture, expectedVelocityAtArrival );
+    BOOST_CHECK_SMALL( ( velocityAtDeparture - expectedVelocityAtDeparture ).norm( ) /
+                       expectedVelocityAtDeparture.norm( ), 1.0E-10 );
+    BOOST_CHECK_SMALL( ( velocityAtArrival - expectedVelocityAtArrival ).norm( ) /
+                       expectedVelocityAtArrival.norm( ), 1.0E-10 );
+    BOOST_CHECK( perturbedXParameter != xParameter );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,195 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Basics/utilityMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+#include "Tudat/Astrodynamics/MissionSegments/lambertGridSolver.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertRoutines.h"
+#include "Tudat/Astrodynamics/MissionSegments/multiRevolutionLambertTargeterIzzo.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Constructor, solves all Lambert problems on the grid.
+LambertGridSolver::LambertGridSolver(
+        const std::function< Eigen::Vector6d( const double ) > departureBodyStateFunction,
+        const std::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction,
+        const Eigen::VectorXd& departureEpochs,
+        const Eigen::VectorXd& arrivalEpochs,
+        const double gravitationalParameter,
+        const int maximumNumberOfRevolutions,
+        const unsigned int numberOfThreads,
+        const bool useInitialGuessFromNeighbour,
+        const double convergenceTolerance,
+        const unsigned int maximumNumberOfIterations ):
+    departureEpochs_( departureEpochs ), arrivalEpochs_( arrivalEpochs )
+{
+    const int numberOfDepartureEpochs = departureEpochs_.rows( );
+    const int numberOfArrivalEpochs = arrivalEpochs_.rows( );
+    const int numberOfBranches = 1 + 2 * std::max( maximumNumberOfRevolutions, 0 );
+
+    // Retrieve body states once for each epoch (serially, as state functions need not be thread-safe).
+    Eigen::Matrix< double, 6, Eigen::Dynamic > departureBodyStates( 6, numberOfDepartureEpochs );
+    for( int i = 0; i < numberOfDepartureEpochs; i++ )
+    {
+        departureBodyStates.col( i ) = departureBodyStateFunction( departureEpochs_( i ) );
+    }
+
+    Eigen::Matrix< double, 6, Eigen::Dynamic > arrivalBodyStates( 6, numberOfArrivalEpochs );
+    for( int j = 0; j < numberOfArrivalEpochs; j++ )
+    {
+        arrivalBodyStates.col( j ) = arrivalBodyStateFunction( arrivalEpochs_( j ) );
+    }
+
+    // Initialize solution matrices.
+    for( int k = 0; k < numberOfBranches; k++ )
+    {
+        branchDepartureC3_.push_back(
+                    Eigen::MatrixXd::Constant( numberOfDepartureEpochs, numberOfArrivalEpochs, TUDAT_NAN ) );
+        branchArrivalExcessVelocity_.push_back(
+                    Eigen::MatrixXd::Constant( numberOfDepartureEpochs, numberOfArrivalEpochs, TUDAT_NAN ) );
+        branchTotalDeltaV_.push_back(
+                    Eigen::MatrixXd::Constant( numberOfDepartureEpochs, numberOfArrivalEpochs, TUDAT_NAN ) );
+    }
+
+    // Solve Lambert problems, one departure epoch per iteration. Within a single departure epoch,
+    // the arrival epochs are processed in order, so that the result is independent of the
+    // number of threads.
+    utilities::executeParallelForLoop(
+                numberOfDepartureEpochs,
+                [ & ]( const unsigned int i, const unsigned int threadIndex )
+    {
+        TUDAT_UNUSED_PARAMETER( threadIndex );
+
+        Eigen::Vector3d departurePosition = departureBodyStates.block( 0, i, 3, 1 );
+        Eigen::Vector3d departureVelocity = departureBodyStates.block( 3, i, 3, 1 );
+        Eigen::Vector3d arrivalPosition, arrivalVelocity;
+        Eigen::Vector3d transferVelocityAtDeparture, transferVelocityAtArrival;
+
+        double xParameter = TUDAT_NAN;
+        for( int j = 0; j < numberOfArrivalEpochs; j++ )
+        {
+            const double timeOfFlight = arrivalEpochs_( j ) - departureEpochs_( i );
+            if( !( timeOfFlight > 0.0 ) )
+            {
+                xParameter = TUDAT_NAN;
+                continue;
+            }
+
+            arrivalPosition = arrivalBodyStates.block( 0, j, 3, 1 );
+            arrivalVelocity = arrivalBodyStates.block( 3, j, 3, 1 );
+
+            // Compute zero-revolution solution, using solution of previous cell as initial guess.
+            if( !useInitialGuessFromNeighbour )
+            {
+                xParameter = TUDAT_NAN;
+            }
+            try
+            {
+                solveLambertProblemIzzoFromInitialGuess(
+                            departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter,
+                            transferVelocityAtDeparture, transferVelocityAtArrival, xParameter,
+                            false, convergenceTolerance, maximumNumberOfIterations );
+
+                const double departureExcessVelocity = ( transferVelocityAtDeparture - departureVelocity ).norm( );
+                const double arrivalExcessVelocity = ( transferVelocityAtArrival - arrivalVelocity ).norm( );
+                branchDepartureC3_[ 0 ]( i, j ) = departureExcessVelocity * departureExcessVelocity;
+                branchArrivalExcessVelocity_[ 0 ]( i, j ) = arrivalExcessVelocity;
+                branchTotalDeltaV_[ 0 ]( i, j ) = departureExcessVelocity + arrivalExcessVelocity;
+            }
+            catch( std::runtime_error& )
+            {
+                xParameter = TUDAT_NAN;
+            }
+
+            // Compute multi-revolution solutions, if required and feasible.
+            if( maximumNumberOfRevolutions > 0 )
+            {
+                try
+                {
+                    MultiRevolutionLambertTargeterIzzo multiRevolutionTargeter(
+                                departurePosition, arrivalPosition, timeOfFlight, gravitationalParameter,
+                                0, false, false, convergenceTolerance, maximumNumberOfIterations );
+                    const int numberOfRevolutionsToCompute = std::min(
+                                maximumNumberOfRevolutions, multiRevolutionTargeter.getMaximumNumberOfRevolutions( ) );
+
+                    for( int numberOfRevolutions = 1; numberOfRevolutions <= numberOfRevolutionsToCompute;
+                         numberOfRevolutions++ )
+                    {
+                        for( unsigned int isRightBranch = 0; isRightBranch < 2; isRightBranch++ )
+                        {
+                            const int branchIndex = 2 * numberOfRevolutions - 1 + isRightBranch;
+                            try
+                            {
+                                multiRevolutionTargeter.computeForRevolutionsAndBranch(
+                                            numberOfRevolutions, isRightBranch );
+
+                                const double departureExcessVelocity =
+                                        ( multiRevolutionTargeter.getInertialVelocityAtDeparture( ) -
+                                          departureVelocity ).norm( );
+                                const double arrivalExcessVelocity =
+                                        ( multiRevolutionTargeter.getInertialVelocityAtArrival( ) -
+                                          arrivalVelocity ).norm( );
+                                branchDepartureC3_[ branchIndex ]( i, j ) =
+                                        departureExcessVelocity * departureExcessVelocity;
+                                branchArrivalExcessVelocity_[ branchIndex ]( i, j ) = arrivalExcessVelocity;
+                                branchTotalDeltaV_[ branchIndex ]( i, j ) =
+                                        departureExcessVelocity + arrivalExcessVelocity;
+                            }
+                            catch( std::exception& )
+                            {
+                                // No solution on this branch, entries remain NaN.
+                            }
+                        }
+                    }
+                }
+                catch( std::exception& )
+                {
+                    // Maximum number of revolutions could not be determined, entries remain NaN.
+                }
+            }
+        }
+    }, numberOfThreads );
+
+    // Determine solution branch with minimum total Delta V for each cell.
+    departureC3_ = Eigen::MatrixXd::Constant( numberOfDepartureEpochs, numberOfArrivalEpochs, TUDAT_NAN );
+    arrivalExcessVelocity_ = Eigen::MatrixXd::Constant( numberOfDepartureEpochs, numberOfArrivalEpochs, TUDAT_NAN );
+    totalDeltaV_ = Eigen::MatrixXd::Constant( numberOfDepartureEpochs, numberOfArrivalEpochs, TUDAT_NAN );
+    optimalBranchIndices_ = Eigen::MatrixXi::Constant( numberOfDepartureEpochs, numberOfArrivalEpochs, -1 );
+    for( int k = 0; k < numberOfBranches; k++ )
+    {
+        for( int j = 0; j < numberOfArrivalEpochs; j++ )
+        {
+            for( int i = 0; i < numberOfDepartureEpochs; i++ )
+            {
+                const double currentDeltaV = branchTotalDeltaV_[ k ]( i, j );
+                if( currentDeltaV == currentDeltaV &&
+                        ( optimalBranchIndices_( i, j ) < 0 || currentDeltaV < totalDeltaV_( i, j ) ) )
+                {
+                    departureC3_( i, j ) = branchDepartureC3_[ k ]( i, j );
+                    arrivalExcessVelocity_( i, j ) = branchArrivalExcessVelocity_[ k ]( i, j );
+                    totalDeltaV_( i, j ) = currentDeltaV;
+                    optimalBranchIndices_( i, j ) = k;
+                }
+            }
+        }
+    }
+}
+
+} // namespace mission_segments
+} // namespace tudat
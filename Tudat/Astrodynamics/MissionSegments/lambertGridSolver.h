@@ -0,0 +1,217 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_LAMBERT_GRID_SOLVER_H
+#define TUDAT_LAMBERT_GRID_SOLVER_H
+
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+namespace mission_segments
+{
+
+//! Class to solve the Lambert problems on a grid of departure and arrival epochs (porkchop plot).
+/*!
+ * Class to solve the Lambert problems between two bodies on a grid of departure and arrival epochs,
+ * as required for e.g. porkchop plots. The states of the bodies are retrieved once for each
+ * departure and arrival epoch, after which the Lambert problems are solved concurrently (one
+ * departure epoch per iteration of the parallel loop). The zero-revolution problems are solved with
+ * Izzo's algorithm, using the solution of the preceding cell (previous arrival epoch, same
+ * departure epoch) as initial guess. Optionally, all multi-revolution branches (left and right),
+ * up to a given number of revolutions, are solved as well, using the
+ * MultiRevolutionLambertTargeterIzzo class. For each branch, the departure C3, arrival excess
+ * velocity and total Delta V (sum of departure and arrival excess velocities) are stored in
+ * matrices with one row per departure epoch and one column per arrival epoch. Cells for which no
+ * solution exists (non-positive time of flight, or number of revolutions not feasible), or for
+ * which the solver did not converge, are set to NaN.
+ */
+class LambertGridSolver
+{
+public:
+
+    //! Constructor, solves all Lambert problems on the grid.
+    /*!
+     * Constructor, solves all Lambert problems on the grid.
+     * \param departureBodyStateFunction Function returning the Cartesian state of the departure
+     *          body w.r.t. the central body as a function of time (e.g. from an ephemeris object).
+     * \param arrivalBodyStateFunction Function returning the Cartesian state of the arrival body
+     *          w.r.t. the central body as a function of time.
+     * \param departureEpochs Departure epochs of the grid.
+     * \param arrivalEpochs Arrival epochs of the grid.
+     * \param gravitationalParameter Gravitational parameter of the central body.
+     * \param maximumNumberOfRevolutions Maximum number of revolutions for which multi-revolution
+     *          branches are solved (0 to solve only zero-revolution transfers).
+     * \param numberOfThreads Number of threads to use (0 for default number of threads).
+     * \param useInitialGuessFromNeighbour Boolean denoting whether the zero-revolution solution of
+     *          the neighbouring cell is to be used as initial guess.
+     * \param convergenceTolerance Convergence tolerance for the root-finding process.
+     * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process.
+     */
+    LambertGridSolver( const std::function< Eigen::Vector6d( const double ) > departureBodyStateFunction,
+                       const std::function< Eigen::Vector6d( const double ) > arrivalBodyStateFunction,
+                       const Eigen::VectorXd& departureEpochs,
+                       const Eigen::VectorXd& arrivalEpochs,
+                       const double gravitationalParameter,
+                       const int maximumNumberOfRevolutions = 0,
+                       const unsigned int numberOfThreads = 0,
+                       const bool useInitialGuessFromNeighbour = true,
+                       const double convergenceTolerance = 1.0e-9,
+                       const unsigned int maximumNumberOfIterations = 50 );
+
+    //! Function to retrieve the number of solution branches.
+    /*!
+     * Function to retrieve the number of solution branches: the zero-revolution branch (index 0),
+     * followed by the left and right branch for each number of revolutions (indices 2N-1 and 2N).
+     * \return Number of solution branches.
+     */
+    int getNumberOfBranches( )
+    {
+        return static_cast< int >( branchTotalDeltaV_.size( ) );
+    }
+
+    //! Function to retrieve the number of revolutions of a given solution branch.
+    /*!
+     * Function to retrieve the number of revolutions of a given solution branch.
+     * \param branchIndex Index of solution branch.
+     * \return Number of revolutions of solution branch.
+     */
+    int getBranchNumberOfRevolutions( const int branchIndex )
+    {
+        return ( branchIndex + 1 ) / 2;
+    }
+
+    //! Function to retrieve whether a given solution branch is a right branch.
+    /*!
+     * Function to retrieve whether a given solution branch is a right (high-energy) branch.
+     * \param branchIndex Index of solution branch.
+     * \return True if solution branch is a multi-revolution right branch.
+     */
+    bool getBranchIsRightBranch( const int branchIndex )
+    {
+        return ( branchIndex > 0 ) && ( branchIndex % 2 == 0 );
+    }
+
+    //! Function to retrieve the departure C3 of a given solution branch.
+    /*!
+     * Function to retrieve the departure C3 (squared departure excess velocity) of a given
+     * solution branch.
+     * \param branchIndex Index of solution branch.
+     * \return Departure C3 for each departure (row) and arrival (column) epoch.
+     */
+    Eigen::MatrixXd getBranchDepartureC3( const int branchIndex )
+    {
+        return branchDepartureC3_.at( branchIndex );
+    }
+
+    //! Function to retrieve the arrival excess velocity of a given solution branch.
+    /*!
+     * Function to retrieve the arrival excess velocity of a given solution branch.
+     * \param branchIndex Index of solution branch.
+     * \return Arrival excess velocity for each departure (row) and arrival (column) epoch.
+     */
+    Eigen::MatrixXd getBranchArrivalExcessVelocity( const int branchIndex )
+    {
+        return branchArrivalExcessVelocity_.at( branchIndex );
+    }
+
+    //! Function to retrieve the total Delta V of a given solution branch.
+    /*!
+     * Function to retrieve the total Delta V (sum of departure and arrival excess velocity) of a
+     * given solution branch.
+     * \param branchIndex Index of solution branch.
+     * \return Total Delta V for each departure (row) and arrival (column) epoch.
+     */
+    Eigen::MatrixXd getBranchTotalDeltaV( const int branchIndex )
+    {
+        return branchTotalDeltaV_.at( branchIndex );
+    }
+
+    //! Function to retrieve the departure C3 of the solution branch with minimum total Delta V.
+    /*!
+     * Function to retrieve the departure C3 of the solution branch with minimum total Delta V.
+     * \return Departure C3 for each departure (row) and arrival (column) epoch.
+     */
+    Eigen::MatrixXd getDepartureC3( )
+    {
+        return departureC3_;
+    }
+
+    //! Function to retrieve the arrival excess velocity of the solution branch with minimum total Delta V.
+    /*!
+     * Function to retrieve the arrival excess velocity of the solution branch with minimum total
+     * Delta V.
+     * \return Arrival excess velocity for each departure (row) and arrival (column) epoch.
+     */
+    Eigen::MatrixXd getArrivalExcessVelocity( )
+    {
+        return arrivalExcessVelocity_;
+    }
+
+    //! Function to retrieve the minimum total Delta V over all solution branches.
+    /*!
+     * Function to retrieve the minimum total Delta V over all solution branches.
+     * \return Total Delta V for each departure (row) and arrival (column) epoch.
+     */
+    Eigen::MatrixXd getTotalDeltaV( )
+    {
+        return totalDeltaV_;
+    }
+
+    //! Function to retrieve the index of the solution branch with minimum total Delta V.
+    /*!
+     * Function to retrieve the index of the solution branch with minimum total Delta V (-1 if
+     * no solution exists).
+     * \return Index of solution branch for each departure (row) and arrival (column) epoch.
+     */
+    Eigen::MatrixXi getOptimalBranchIndices( )
+    {
+        return optimalBranchIndices_;
+    }
+
+private:
+
+    //! Departure epochs of the grid.
+    Eigen::VectorXd departureEpochs_;
+
+    //! Arrival epochs of the grid.
+    Eigen::VectorXd arrivalEpochs_;
+
+    //! Departure C3 for each solution branch.
+    std::vector< Eigen::MatrixXd > branchDepartureC3_;
+
+    //! Arrival excess velocity for each solution branch.
+    std::vector< Eigen::MatrixXd > branchArrivalExcessVelocity_;
+
+    //! Total Delta V for each solution branch.
+    std::vector< Eigen::MatrixXd > branchTotalDeltaV_;
+
+    //! Departure C3 of solution branch with minimum total Delta V.
+    Eigen::MatrixXd departureC3_;
+
+    //! Arrival excess velocity of solution branch with minimum total Delta V.
+    Eigen::MatrixXd arrivalExcessVelocity_;
+
+    //! Minimum total Delta V over all solution branches.
+    Eigen::MatrixXd totalDeltaV_;
+
+    //! Index of solution branch with minimum total Delta V.
+    Eigen::MatrixXi optimalBranchIndices_;
+};
+
+} // namespace mission_segments
+} // namespace tudat
+
+#endif // TUDAT_LAMBERT_GRID_SOLVER_H
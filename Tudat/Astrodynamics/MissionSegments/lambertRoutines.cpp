@@ -49,6 +49,25 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
                               const bool isRetrograde,
                               const double convergenceTolerance,
                               const unsigned int maximumNumberOfIterations )
+{
+    double xParameter = TUDAT_NAN;
+    solveLambertProblemIzzoFromInitialGuess(
+                cartesianPositionAtDeparture, cartesianPositionAtArrival, timeOfFlight, gravitationalParameter,
+                cartesianVelocityAtDeparture, cartesianVelocityAtArrival, xParameter,
+                isRetrograde, convergenceTolerance, maximumNumberOfIterations );
+}
+
+//! Solve Lambert Problem using Izzo's algorithm, starting from an initial guess of the solution.
+void solveLambertProblemIzzoFromInitialGuess( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                              const Eigen::Vector3d& cartesianPositionAtArrival,
+                                              const double timeOfFlight,
+                                              const double gravitationalParameter,
+                                              Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                              Eigen::Vector3d& cartesianVelocityAtArrival,
+                                              double& xParameter,
+                                              const bool isRetrograde,
+                                              const double convergenceTolerance,
+                                              const unsigned int maximumNumberOfIterations )
 {
     // Sanity check for specified time-of-flight.
     if ( timeOfFlight <= 0.0 )
@@ -114,14 +133,21 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
     const double logarithmOfTheSpecifiedTimeOfFlight = std::log( normalizedSpecifiedTimeOfFlight );
 
     // Secant Method.
-    // Define initial guesses for abcissae (x) and ordinates (y).
-    double x1 = std::log( 0.5 ), x2 = std::log( 1.5 );
+    // Define initial guesses for abcissae (x) and ordinates (y). If an initial guess is provided,
+    // the abcissae are placed closely around it, otherwise the default guesses are used.
+    double initialXParameter1 = -0.5, initialXParameter2 = 0.5;
+    if ( xParameter == xParameter && xParameter > -1.0 )
+    {
+        initialXParameter1 = xParameter;
+        initialXParameter2 = std::exp( std::log( 1.0 + xParameter ) + 1.0E-3 ) - 1.0;
+    }
+    double x1 = std::log( 1.0 + initialXParameter1 ), x2 = std::log( 1.0 + initialXParameter2 );
 
-    double y1 = std::log( computeTimeOfFlightIzzo( -0.5, semiPerimeter, chord, isLongway,
+    double y1 = std::log( computeTimeOfFlightIzzo( initialXParameter1, semiPerimeter, chord, isLongway,
                                                    semiMajorAxisOfTheMinimumEnergyEllipse ) )
             - logarithmOfTheSpecifiedTimeOfFlight;
 
-    double y2 = std::log( computeTimeOfFlightIzzo( 0.5, semiPerimeter, chord, isLongway,
+    double y2 = std::log( computeTimeOfFlightIzzo( initialXParameter2, semiPerimeter, chord, isLongway,
                                                    semiMajorAxisOfTheMinimumEnergyEllipse ) )
             - logarithmOfTheSpecifiedTimeOfFlight;
 
@@ -165,7 +191,7 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
     }
 
     // Revert to x parameter.
-    const double xParameter = std::exp( xNew ) - 1.0;
+    xParameter = std::exp( xNew ) - 1.0;
 
     // Determine semi-major axis of the conic.
     const double semiMajorAxis = semiMajorAxisOfTheMinimumEnergyEllipse
@@ -67,6 +67,38 @@ void solveLambertProblemIzzo( const Eigen::Vector3d& cartesianPositionAtDepartur
                               const double convergenceTolerance = 1e-9,
                               const unsigned int maximumNumberOfIterations = 50 );
 
+//! Solve Lambert Problem using Izzo's algorithm, starting from an initial guess of the solution.
+/*!
+ * Solves the Lambert Problem using Izzo's algorithm (see solveLambertProblemIzzo), but starts the
+ * root-finding process from a given initial guess of the x-parameter, and returns the converged
+ * x-parameter. This allows the solution of a nearby Lambert problem (e.g. a neighbouring cell in a
+ * grid of departure and arrival epochs) to be used to reduce the number of iterations.
+ * \param cartesianPositionAtDeparture Cartesian position at departure. [Input]
+ * \param cartesianPositionAtArrival Cartesian position at arrival. [Input]
+ * \param timeOfFlight Time-of-flight between departure and arrival. [Input]
+ * \param gravitationalParameter Gravitational parameter of the central body. [Input]
+ * \param cartesianVelocityAtDeparture Velocity at departure. [Output]
+ * \param cartesianVelocityAtArrival Velocity at arrival. [Output]
+ * \param xParameter Initial guess of the x-parameter, which must be larger than -1 (or NaN to use
+ *          the default initial guesses of solveLambertProblemIzzo). [Input]. Converged x-parameter
+ *          of the solution. [Output]
+ * \param isRetrograde Boolean flag to indicate direction of motion. [Input, Optional]
+ * \param convergenceTolerance Convergence tolerance for the root-finding process.
+ *          [Input, Optional]
+ * \param maximumNumberOfIterations Maximum number of iterations of the root-finding process.
+ *          [Input, Optional]
+ */
+void solveLambertProblemIzzoFromInitialGuess( const Eigen::Vector3d& cartesianPositionAtDeparture,
+                                              const Eigen::Vector3d& cartesianPositionAtArrival,
+                                              const double timeOfFlight,
+                                              const double gravitationalParameter,
+                                              Eigen::Vector3d& cartesianVelocityAtDeparture,
+                                              Eigen::Vector3d& cartesianVelocityAtArrival,
+                                              double& xParameter,
+                                              const bool isRetrograde = false,
+                                              const double convergenceTolerance = 1e-9,
+                                              const unsigned int maximumNumberOfIterations = 50 );
+
 //! Compute time-of-flight using Lagrange's equation.
 /*!
  * Computes the time-of-flight according to Lagrange's equation as a function of the x-parameter.
@@ -0,0 +1,284 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/ObservationModels/observationCollection.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+
+BOOST_AUTO_TEST_SUITE( test_observation_collection )
+
+//! Function to create observations and times for a single observation set, with values i * 10 + offset
+std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > createTestObservations(
+        const int numberOfEpochs, const int observationSize, const double offset )
+{
+    Eigen::VectorXd observations = Eigen::VectorXd( numberOfEpochs * observationSize );
+    std::vector< double > times;
+    for( int i = 0; i < numberOfEpochs; i++ )
+    {
+        times.push_back( 100.0 * i + offset );
+        for( int j = 0; j < observationSize; j++ )
+        {
+            observations( i * observationSize + j ) = 10.0 * ( i * observationSize + j ) + offset;
+        }
+    }
+    return std::make_pair( observations, std::make_pair( times, receiver ) );
+}
+
+//! Test creation, indexing, modification and conversion of observation collection
+BOOST_AUTO_TEST_CASE( testObservationCollection )
+{
+    LinkEnds stationALinkEnds;
+    stationALinkEnds[ transmitter ] = std::make_pair( "Earth", "StationA" );
+    stationALinkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+
+    LinkEnds stationBLinkEnds;
+    stationBLinkEnds[ transmitter ] = std::make_pair( "Earth", "StationB" );
+    stationBLinkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+
+    LinkEnds positionLinkEnds;
+    positionLinkEnds[ observed_body ] = std::make_pair( "Vehicle", "" );
+
+    // Create observations in map format (as used in PodInput)
+    ObservationCollection< >::ObservationsMapType observationsMap;
+    observationsMap[ one_way_range ][ stationBLinkEnds ] = createTestObservations( 5, 1, 0.5 );
+    observationsMap[ one_way_range ][ stationALinkEnds ] = createTestObservations( 4, 1, 0.25 );
+    observationsMap[ position_observable ][ positionLinkEnds ] = createTestObservations( 3, 3, 0.75 );
+
+    ObservationCollection< >::WeightsMapType weightsMap;
+    weightsMap[ one_way_range ][ stationALinkEnds ] = Eigen::VectorXd::Constant( 4, 2.0 );
+
+    ObservationCollection< > observationCollection( observationsMap, weightsMap );
+
+    // Check sizes and row ranges (sorted as in map iteration)
+    BOOST_CHECK_EQUAL( observationCollection.getNumberOfObservations( ), 18 );
+    BOOST_CHECK_EQUAL( observationCollection.getObservationSets( ).size( ), 3 );
+    BOOST_CHECK_EQUAL( observationCollection.getObservationTimes( ).size( ), 18 );
+    BOOST_CHECK_EQUAL( observationCollection.getLinkEndsIds( ).size( ), 18 );
+
+    int rangeAStartIndex = ( stationALinkEnds < stationBLinkEnds ) ? 0 : 5;
+    int rangeBStartIndex = ( stationALinkEnds < stationBLinkEnds ) ? 4 : 0;
+    BOOST_CHECK( observationCollection.getObservationSetRange( one_way_range, stationALinkEnds ) ==
+                 std::make_pair( rangeAStartIndex, 4 ) );
+    BOOST_CHECK( observationCollection.getObservationSetRange( one_way_range, stationBLinkEnds ) ==
+                 std::make_pair( rangeBStartIndex, 5 ) );
+    BOOST_CHECK( observationCollection.getObservationSetRange( position_observable, positionLinkEnds ) ==
+                 std::make_pair( 9, 9 ) );
+    BOOST_CHECK( observationCollection.getObservableRange( one_way_range ) == std::make_pair( 0, 9 ) );
+    BOOST_CHECK( observationCollection.getObservableRange( one_way_doppler ) == std::make_pair( 0, 0 ) );
+    BOOST_CHECK_EQUAL( observationCollection.getObservationSetIndex( one_way_doppler, stationALinkEnds ), -1 );
+    BOOST_CHECK_THROW( observationCollection.getObservationSetRange( one_way_doppler, stationALinkEnds ),
+                       std::runtime_error );
+
+    // Check flat data (times and link ends repeated per entry of position observable)
+    for( int i = 0; i < 9; i++ )
+    {
+        BOOST_CHECK_EQUAL( observationCollection.getObservations( ).at( 9 + i ), 10.0 * i + 0.75 );
+        BOOST_CHECK_EQUAL( observationCollection.getObservationTimes( ).at( 9 + i ), 100.0 * ( i / 3 ) + 0.75 );
+        BOOST_CHECK( observationCollection.getLinkEnds( observationCollection.getLinkEndsIds( ).at( 9 + i ) ) ==
+                     positionLinkEnds );
+        BOOST_CHECK_EQUAL( observationCollection.getWeights( ).at( 9 + i ), 1.0 );
+    }
+    for( int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_EQUAL( observationCollection.getWeightsVector( )( rangeAStartIndex + i ), 2.0 );
+        BOOST_CHECK_EQUAL( observationCollection.getObservationVector( )( rangeAStartIndex + i ), 10.0 * i + 0.25 );
+    }
+
+    // Check conversion back to map format
+    {
+        ObservationCollection< >::ObservationsMapType reconstructedMap = observationCollection.getObservationsMap( );
+        BOOST_CHECK_EQUAL( reconstructedMap.size( ), observationsMap.size( ) );
+        for( auto observableIterator : observationsMap )
+        {
+            for( auto linkEndIterator : observableIterator.second )
+            {
+                std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > reconstructedData =
+                        reconstructedMap.at( observableIterator.first ).at( linkEndIterator.first );
+                BOOST_CHECK( reconstructedData.first == linkEndIterator.second.first );
+                BOOST_CHECK( reconstructedData.second.first == linkEndIterator.second.second.first );
+                BOOST_CHECK_EQUAL( reconstructedData.second.second, linkEndIterator.second.second.second );
+            }
+        }
+
+        ObservationCollection< >::WeightsMapType reconstructedWeights = observationCollection.getWeightsMap( );
+        BOOST_CHECK( reconstructedWeights.at( one_way_range ).at( stationALinkEnds ) == Eigen::VectorXd::Constant( 4, 2.0 ) );
+        BOOST_CHECK( reconstructedWeights.at( one_way_range ).at( stationBLinkEnds ) == Eigen::VectorXd::Constant( 5, 1.0 ) );
+    }
+
+    // Append observations to a set that is not last, and add a new set; check updated ranges
+    std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > extraObservations =
+            createTestObservations( 2, 1, 0.125 );
+    observationCollection.addObservations(
+                one_way_range, stationALinkEnds, extraObservations.first, extraObservations.second.first, receiver,
+                Eigen::VectorXd::Constant( 2, 3.0 ) );
+    observationCollection.addObservations(
+                one_way_doppler, stationALinkEnds, extraObservations.first, extraObservations.second.first, receiver );
+
+    BOOST_CHECK_EQUAL( observationCollection.getNumberOfObservations( ), 22 );
+    BOOST_CHECK( observationCollection.getObservationSetRange( one_way_range, stationALinkEnds ) ==
+                 std::make_pair( rangeAStartIndex, 6 ) );
+    BOOST_CHECK( observationCollection.getObservationSetRange( one_way_range, stationBLinkEnds ) ==
+                 std::make_pair( ( rangeBStartIndex == 0 ) ? 0 : 6, 5 ) );
+    BOOST_CHECK( observationCollection.getObservationSetRange( position_observable, positionLinkEnds ) ==
+                 std::make_pair( 11, 9 ) );
+    BOOST_CHECK( observationCollection.getObservationSetRange( one_way_doppler, stationALinkEnds ) ==
+                 std::make_pair( 20, 2 ) );
+    int appendedIndex = ( rangeAStartIndex == 0 ) ? 4 : 9;
+    BOOST_CHECK_EQUAL( observationCollection.getObservationVector( )( appendedIndex ), 0.125 );
+    BOOST_CHECK_EQUAL( observationCollection.getWeightsVector( )( appendedIndex ), 3.0 );
+    BOOST_CHECK_EQUAL( observationCollection.getObservationTimes( ).at( appendedIndex + 1 ), 100.125 );
+
+    // Check that inconsistent input is rejected
+    BOOST_CHECK_THROW( observationCollection.addObservations(
+                           one_way_range, stationALinkEnds, extraObservations.first, extraObservations.second.first,
+                           transmitter ), std::runtime_error );
+    BOOST_CHECK_THROW( observationCollection.addObservations(
+                           position_observable, positionLinkEnds, extraObservations.first, extraObservations.second.first,
+                           receiver ), std::runtime_error );
+
+    // Remove outliers: reject one range observation, one entry of position observation (removes full epoch), and all
+    // Doppler observations.
+    Eigen::VectorXd residuals = Eigen::VectorXd::Zero( 22 );
+    residuals( appendedIndex ) = 0.8; // Weighted residual 0.8 * sqrt( 3 ) > 1
+    residuals( 15 ) = -1.5;
+    residuals( 20 ) = 2.0;
+    residuals( 21 ) = 2.0;
+    residuals( 0 ) = 0.9; // Retained (weighted residual < 1)
+    if( rangeAStartIndex == 0 )
+    {
+        residuals( 0 ) = 0.7; // Weighted residual 0.7 * sqrt( 2 ) < 1
+    }
+
+    int numberOfRemovedRows = observationCollection.removeOutliers( residuals, 1.0 );
+    BOOST_CHECK_EQUAL( numberOfRemovedRows, 6 );
+    BOOST_CHECK_EQUAL( observationCollection.getNumberOfObservations( ), 16 );
+    BOOST_CHECK_EQUAL( observationCollection.getObservationSets( ).size( ), 3 );
+    BOOST_CHECK_EQUAL( observationCollection.getObservationSetIndex( one_way_doppler, stationALinkEnds ), -1 );
+    BOOST_CHECK( observationCollection.getObservationSetRange( one_way_range, stationALinkEnds ) ==
+                 std::make_pair( rangeAStartIndex, 5 ) );
+    BOOST_CHECK( observationCollection.getObservationSetRange( position_observable, positionLinkEnds ) ==
+                 std::make_pair( 10, 6 ) );
+
+    // Check that correct position epoch (second) was removed
+    std::vector< double > positionTimes = observationCollection.getObservationSetTimes(
+                observationCollection.getObservationSetIndex( position_observable, positionLinkEnds ) );
+    BOOST_CHECK_EQUAL( positionTimes.size( ), 2 );
+    BOOST_CHECK_EQUAL( positionTimes.at( 0 ), 0.75 );
+    BOOST_CHECK_EQUAL( positionTimes.at( 1 ), 200.75 );
+    BOOST_CHECK_EQUAL( observationCollection.getObservationVector( )( 13 ), 60.75 );
+
+    // Check setting of weights
+    observationCollection.setConstantWeight( one_way_range, stationBLinkEnds, 4.0 );
+    std::pair< int, int > rangeBRange = observationCollection.getObservationSetRange( one_way_range, stationBLinkEnds );
+    for( int i = 0; i < observationCollection.getNumberOfObservations( ); i++ )
+    {
+        bool isInRangeB = ( i >= rangeBRange.first ) && ( i < rangeBRange.first + rangeBRange.second );
+        BOOST_CHECK_EQUAL( observationCollection.getWeights( ).at( i ) == 4.0, isInRangeB );
+    }
+}
+
+//! Test that observations added in arbitrary order of observation sets are stored in the same order as from map format
+BOOST_AUTO_TEST_CASE( testObservationCollectionInterleavedAddition )
+{
+    LinkEnds stationALinkEnds;
+    stationALinkEnds[ transmitter ] = std::make_pair( "Earth", "StationA" );
+    stationALinkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+
+    LinkEnds stationBLinkEnds;
+    stationBLinkEnds[ transmitter ] = std::make_pair( "Earth", "StationB" );
+    stationBLinkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+
+    LinkEnds positionLinkEnds;
+    positionLinkEnds[ observed_body ] = std::make_pair( "Vehicle", "" );
+
+    std::vector< ObservableType > observableTypes = { position_observable, one_way_range, one_way_range };
+    std::vector< LinkEnds > linkEndsList = { positionLinkEnds, stationALinkEnds, stationBLinkEnds };
+    std::vector< int > observationSizes = { 3, 1, 1 };
+
+    // Add two blocks of observations for each set, alternating between sets, in reverse storage order
+    ObservationCollection< > observationCollection;
+    std::vector< std::vector< std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > > >
+            addedObservations( 3 );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            addedObservations[ j ].push_back( createTestObservations( 2 + i + j, observationSizes[ j ], 0.1 * ( i + 2 * j ) ) );
+            observationCollection.addObservations(
+                        observableTypes[ j ], linkEndsList[ j ], addedObservations[ j ][ i ].first,
+                        addedObservations[ j ][ i ].second.first, receiver,
+                        Eigen::VectorXd::Constant( addedObservations[ j ][ i ].first.rows( ), 1.0 + i + 2 * j ) );
+
+            // Check that new observations are directly in place, at the end of their observation set
+            int numberOfNewRows = addedObservations[ j ][ i ].first.rows( );
+            std::pair< int, int > setRange = observationCollection.getObservationSetRange(
+                        observableTypes[ j ], linkEndsList[ j ] );
+            BOOST_CHECK( observationCollection.getObservationVector( ).segment(
+                             setRange.first + setRange.second - numberOfNewRows, numberOfNewRows ) ==
+                         addedObservations[ j ][ i ].first );
+        }
+    }
+
+    // Create same data in map format
+    ObservationCollection< >::ObservationsMapType observationsMap;
+    ObservationCollection< >::WeightsMapType weightsMap;
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        Eigen::VectorXd observations = Eigen::VectorXd( addedObservations[ j ][ 0 ].first.rows( ) +
+                addedObservations[ j ][ 1 ].first.rows( ) );
+        observations << addedObservations[ j ][ 0 ].first, addedObservations[ j ][ 1 ].first;
+        Eigen::VectorXd weights = Eigen::VectorXd( observations.rows( ) );
+        weights << Eigen::VectorXd::Constant( addedObservations[ j ][ 0 ].first.rows( ), 1.0 + 2 * j ),
+                Eigen::VectorXd::Constant( addedObservations[ j ][ 1 ].first.rows( ), 2.0 + 2 * j );
+
+        std::vector< double > times = addedObservations[ j ][ 0 ].second.first;
+        times.insert( times.end( ), addedObservations[ j ][ 1 ].second.first.begin( ),
+                      addedObservations[ j ][ 1 ].second.first.end( ) );
+
+        observationsMap[ observableTypes[ j ] ][ linkEndsList[ j ] ] = std::make_pair(
+                    observations, std::make_pair( times, receiver ) );
+        weightsMap[ observableTypes[ j ] ][ linkEndsList[ j ] ] = weights;
+    }
+    ObservationCollection< > referenceCollection( observationsMap, weightsMap );
+
+    // Compare contents and row ranges
+    BOOST_CHECK_EQUAL( observationCollection.getNumberOfObservations( ), referenceCollection.getNumberOfObservations( ) );
+    BOOST_CHECK( observationCollection.getObservations( ) == referenceCollection.getObservations( ) );
+    BOOST_CHECK( observationCollection.getObservationTimes( ) == referenceCollection.getObservationTimes( ) );
+    BOOST_CHECK( observationCollection.getWeights( ) == referenceCollection.getWeights( ) );
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK( observationCollection.getObservationSetRange( observableTypes[ j ], linkEndsList[ j ] ) ==
+                     referenceCollection.getObservationSetRange( observableTypes[ j ], linkEndsList[ j ] ) );
+        BOOST_CHECK( observationCollection.getObservableRange( observableTypes[ j ] ) ==
+                     referenceCollection.getObservableRange( observableTypes[ j ] ) );
+        BOOST_CHECK( observationCollection.getLinkEnds( observationCollection.getLinkEndsIds( ).at(
+                                                            observationCollection.getObservationSetRange(
+                                                                observableTypes[ j ], linkEndsList[ j ] ).first ) ) ==
+                     linkEndsList[ j ] );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,707 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_OBSERVATIONCOLLECTION_H
+#define TUDAT_OBSERVATIONCOLLECTION_H
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/ObservationModels/linkTypeDefs.h"
+#include "Tudat/Astrodynamics/ObservationModels/observableTypes.h"
+
+namespace tudat
+{
+
+namespace observation_models
+{
+
+//! Data structure describing a single set of observations (single observable type and set of link ends) in an
+//! ObservationCollection
+struct ObservationSetIndices
+{
+    //! Constructor
+    /*!
+     * Constructor
+     * \param observableType Type of observable of the observation set
+     * \param linkEndsId Identifier of the link ends of the observation set (see ObservationCollection::getLinkEnds)
+     * \param referenceLinkEnd Link end to which observation times of the set are referenced
+     * \param observationSize Size of a single observation (e.g. 1 for range, 3 for position)
+     */
+    ObservationSetIndices( const ObservableType observableType, const int linkEndsId, const LinkEndType referenceLinkEnd,
+                           const int observationSize ):
+        observableType_( observableType ), linkEndsId_( linkEndsId ), referenceLinkEnd_( referenceLinkEnd ),
+        observationSize_( observationSize ), startIndex_( 0 ), numberOfRows_( 0 ){ }
+
+    //! Type of observable of the observation set
+    ObservableType observableType_;
+
+    //! Identifier of the link ends of the observation set
+    int linkEndsId_;
+
+    //! Link end to which observation times of the set are referenced
+    LinkEndType referenceLinkEnd_;
+
+    //! Size of a single observation (number of consecutive rows per observation epoch)
+    int observationSize_;
+
+    //! Index of the first row of the observation set in the full (concatenated) observation vector
+    int startIndex_;
+
+    //! Number of rows of the observation set (number of observation epochs times observationSize_)
+    int numberOfRows_;
+};
+
+//! Hash function object for link ends, to allow LinkEnds to be used as key in unordered containers
+struct LinkEndsHash
+{
+    //! Function to compute the hash of a set of link ends
+    /*!
+     * Function to compute the hash of a set of link ends, combining the link end types and identifiers of all link ends.
+     * \param linkEnds Link ends for which hash is to be computed
+     * \return Hash of link ends
+     */
+    std::size_t operator( )( const LinkEnds& linkEnds ) const
+    {
+        std::size_t seed = 0;
+        for( LinkEnds::const_iterator linkEndIterator = linkEnds.begin( ); linkEndIterator != linkEnds.end( );
+             linkEndIterator++ )
+        {
+            boost::hash_combine( seed, static_cast< int >( linkEndIterator->first ) );
+            boost::hash_combine( seed, linkEndIterator->second.first );
+            boost::hash_combine( seed, linkEndIterator->second.second );
+        }
+        return seed;
+    }
+};
+
+//! Flat (structure-of-arrays) container for observation data of any number of observables and link ends.
+/*!
+ *  Flat (structure-of-arrays) container for observation data of any number of observables and link ends. The observation
+ *  values, observation times, weights and link end identifiers are each stored in a single contiguous vector, with one
+ *  entry per row of the full (concatenated) observation vector. For multi-dimensional observables (e.g. position), the
+ *  observation time and link end identifier are repeated for each of the entries of a single observation.
+ *  The rows are ordered by observable type and link ends, in the same order as obtained by iterating over the
+ *  nested maps of the PodInput::PodInputDataType, so that the flat vectors can be used directly in the estimation. The
+ *  row range of each observation set (observable type and link ends) is precomputed, so that it can be retrieved without
+ *  iterating over the data, and observation sets are found by hashed lookup.
+ *  The rows are kept in this order when observations are added, so that the access functions never modify the data, and
+ *  references to the data that are obtained from them remain valid until the collection is next modified.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+class ObservationCollection
+{
+public:
+
+    //! Typedef of vector of observations
+    typedef Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > ObservationVectorType;
+
+    //! Typedef of observations and associated times/reference link end, per link ends and observable type (as used in
+    //! PodInput and simulateObservations).
+    typedef std::map< ObservableType, std::map< LinkEnds, std::pair< ObservationVectorType,
+    std::pair< std::vector< TimeType >, LinkEndType > > > > ObservationsMapType;
+
+    //! Typedef of observation weights, per link ends and observable type (as used in PodInput).
+    typedef std::map< ObservableType, std::map< LinkEnds, Eigen::VectorXd > > WeightsMapType;
+
+    //! Constructor, creates empty collection.
+    ObservationCollection( ){ }
+
+    //! Constructor from observations in map format
+    /*!
+     * Constructor from observations in map format
+     * \param observations Observations and associated times/reference link end, per link ends and observable type.
+     * \param weights Observation weights per link ends and observable type. If a set of observations has no entry in this
+     * map, a weight of 1 is used for all its observations.
+     */
+    ObservationCollection( const ObservationsMapType& observations,
+                           const WeightsMapType& weights = WeightsMapType( ) )
+    {
+        int totalNumberOfRows = 0;
+        for( typename ObservationsMapType::const_iterator observableIterator = observations.begin( );
+             observableIterator != observations.end( ); observableIterator++ )
+        {
+            for( typename ObservationsMapType::mapped_type::const_iterator dataIterator = observableIterator->second.begin( );
+                 dataIterator != observableIterator->second.end( ); dataIterator++ )
+            {
+                totalNumberOfRows += dataIterator->second.first.rows( );
+            }
+        }
+        reserve( totalNumberOfRows );
+
+        // Map iteration order equals required row order, so all sets are appended at the end of the vectors
+        for( typename ObservationsMapType::const_iterator observableIterator = observations.begin( );
+             observableIterator != observations.end( ); observableIterator++ )
+        {
+            for( typename ObservationsMapType::mapped_type::const_iterator dataIterator = observableIterator->second.begin( );
+                 dataIterator != observableIterator->second.end( ); dataIterator++ )
+            {
+                Eigen::VectorXd currentWeights = Eigen::VectorXd::Zero( 0 );
+                if( weights.count( observableIterator->first ) > 0 )
+                {
+                    if( weights.at( observableIterator->first ).count( dataIterator->first ) > 0 )
+                    {
+                        currentWeights = weights.at( observableIterator->first ).at( dataIterator->first );
+                    }
+                }
+                addObservations( observableIterator->first, dataIterator->first, dataIterator->second.first,
+                                 dataIterator->second.second.first, dataIterator->second.second.second, currentWeights );
+            }
+        }
+    }
+
+    //! Function to reserve memory for a given total number of observation rows
+    /*!
+     * Function to reserve memory for a given total number of observation rows, to prevent reallocation when subsequently
+     * adding observations.
+     * \param numberOfRows Total number of observation rows for which memory is to be reserved.
+     */
+    void reserve( const int numberOfRows )
+    {
+        observations_.reserve( numberOfRows );
+        observationTimes_.reserve( numberOfRows );
+        weights_.reserve( numberOfRows );
+        linkEndsIds_.reserve( numberOfRows );
+    }
+
+    //! Function to add a set of observations of a single observable type and link ends
+    /*!
+     * Function to add a set of observations of a single observable type and link ends. If observations of this type and
+     * link ends are already in the collection, the new observations are added after the existing ones. The new rows are
+     * inserted directly at their place in the row ordering. Adding observations that are last in the row ordering (as is
+     * the case when adding data sorted by observable type and link ends) requires no data to be moved; otherwise, the rows
+     * of all subsequent observation sets are moved.
+     * \param observableType Type of observable
+     * \param linkEnds Link ends of the observations
+     * \param observations Observation values; for observables of size n, entries n*i...n*(i+1)-1 are observation i.
+     * \param observationTimes Observation times (one per observation epoch)
+     * \param referenceLinkEnd Link end to which observation times are referenced
+     * \param weights Observation weights (one per entry of observations); if empty, a weight of 1 is used.
+     */
+    void addObservations( const ObservableType observableType,
+                          const LinkEnds& linkEnds,
+                          const ObservationVectorType& observations,
+                          const std::vector< TimeType >& observationTimes,
+                          const LinkEndType referenceLinkEnd,
+                          const Eigen::VectorXd& weights = Eigen::VectorXd::Zero( 0 ) )
+    {
+        if( observationTimes.size( ) == 0 )
+        {
+            if( observations.rows( ) != 0 )
+            {
+                throw std::runtime_error( "Error when adding observations to collection, no times provided" );
+            }
+            return;
+        }
+
+        if( observations.rows( ) % observationTimes.size( ) != 0 )
+        {
+            throw std::runtime_error( "Error when adding observations to collection, number of observations (" +
+                                      std::to_string( observations.rows( ) ) + ") inconsistent with number of times (" +
+                                      std::to_string( observationTimes.size( ) ) + ")" );
+        }
+        int observationSize = observations.rows( ) / observationTimes.size( );
+
+        if( weights.rows( ) != 0 && weights.rows( ) != observations.rows( ) )
+        {
+            throw std::runtime_error( "Error when adding observations to collection, size of weights is inconsistent" );
+        }
+
+        int linkEndsId = getOrCreateLinkEndsId( linkEnds );
+
+        // Retrieve existing, or create new, observation set
+        int setIndex = getObservationSetIndex( observableType, linkEnds );
+        bool isNewSet = ( setIndex < 0 );
+        if( !isNewSet )
+        {
+            if( observationSets_.at( setIndex ).referenceLinkEnd_ != referenceLinkEnd )
+            {
+                throw std::runtime_error( "Error when adding observations to collection, reference link end is inconsistent" );
+            }
+            if( observationSets_.at( setIndex ).observationSize_ != observationSize )
+            {
+                throw std::runtime_error( "Error when adding observations to collection, observation size is inconsistent" );
+            }
+        }
+        else
+        {
+            // Find first set that should come after new set
+            setIndex = 0;
+            while( setIndex < static_cast< int >( observationSets_.size( ) ) &&
+                   isSetOrderedBefore( observationSets_.at( setIndex ), observableType, linkEnds ) )
+            {
+                setIndex++;
+            }
+
+            observationSets_.insert( observationSets_.begin( ) + setIndex, ObservationSetIndices(
+                                         observableType, linkEndsId, referenceLinkEnd, observationSize ) );
+            updateObservationSetIndexMap( );
+        }
+
+        // Insert data after existing observations of set, and shift start of all subsequent sets
+        int firstNewRow = ( isNewSet ) ?
+                    ( ( setIndex + 1 < static_cast< int >( observationSets_.size( ) ) ) ?
+                          observationSets_.at( setIndex + 1 ).startIndex_ : getNumberOfObservations( ) ) :
+                    observationSets_.at( setIndex ).startIndex_ + observationSets_.at( setIndex ).numberOfRows_;
+        int numberOfNewRows = observations.rows( );
+
+        observations_.insert( observations_.begin( ) + firstNewRow, observations.data( ),
+                              observations.data( ) + numberOfNewRows );
+        linkEndsIds_.insert( linkEndsIds_.begin( ) + firstNewRow, numberOfNewRows, linkEndsId );
+        if( weights.rows( ) == 0 )
+        {
+            weights_.insert( weights_.begin( ) + firstNewRow, numberOfNewRows, 1.0 );
+        }
+        else
+        {
+            weights_.insert( weights_.begin( ) + firstNewRow, weights.data( ), weights.data( ) + numberOfNewRows );
+        }
+
+        std::vector< TimeType > newObservationTimes;
+        newObservationTimes.reserve( numberOfNewRows );
+        for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+        {
+            newObservationTimes.insert( newObservationTimes.end( ), observationSize, observationTimes.at( i ) );
+        }
+        observationTimes_.insert( observationTimes_.begin( ) + firstNewRow, newObservationTimes.begin( ),
+                                  newObservationTimes.end( ) );
+
+        if( isNewSet )
+        {
+            observationSets_.at( setIndex ).startIndex_ = firstNewRow;
+        }
+        observationSets_.at( setIndex ).numberOfRows_ += numberOfNewRows;
+        for( unsigned int i = setIndex + 1; i < observationSets_.size( ); i++ )
+        {
+            observationSets_.at( i ).startIndex_ += numberOfNewRows;
+        }
+    }
+
+    //! Function to retain only a subset of the observations in the collection.
+    /*!
+     * Function to retain only a subset of the observations in the collection, for instance for outlier rejection. For
+     * multi-dimensional observables, an observation epoch is removed if any of its entries is to be removed. The data are
+     * compacted in place in a single pass, and observation sets from which all observations are removed are deleted.
+     * \param rowsToKeep Boolean for each row of the collection, denoting whether it is to be retained
+     * \return Number of rows that was removed
+     */
+    int filterObservations( const std::vector< bool >& rowsToKeep )
+    {
+        if( static_cast< int >( rowsToKeep.size( ) ) != getNumberOfObservations( ) )
+        {
+            throw std::runtime_error( "Error when filtering observation collection, size of filter is inconsistent" );
+        }
+
+        int numberOfRemovedRows = 0;
+        int currentOutputIndex = 0;
+        std::vector< ObservationSetIndices > retainedObservationSets;
+        for( unsigned int i = 0; i < observationSets_.size( ); i++ )
+        {
+            ObservationSetIndices currentSet = observationSets_.at( i );
+            int observationSize = currentSet.observationSize_;
+            int retainedRows = 0;
+            for( int epochStart = currentSet.startIndex_; epochStart < currentSet.startIndex_ + currentSet.numberOfRows_;
+                 epochStart += observationSize )
+            {
+                bool keepEpoch = true;
+                for( int j = 0; j < observationSize; j++ )
+                {
+                    if( !rowsToKeep.at( epochStart + j ) )
+                    {
+                        keepEpoch = false;
+                    }
+                }
+
+                if( keepEpoch )
+                {
+                    for( int j = 0; j < observationSize; j++ )
+                    {
+                        observations_[ currentOutputIndex ] = observations_[ epochStart + j ];
+                        observationTimes_[ currentOutputIndex ] = observationTimes_[ epochStart + j ];
+                        weights_[ currentOutputIndex ] = weights_[ epochStart + j ];
+                        linkEndsIds_[ currentOutputIndex ] = linkEndsIds_[ epochStart + j ];
+                        currentOutputIndex++;
+                    }
+                    retainedRows += observationSize;
+                }
+                else
+                {
+                    numberOfRemovedRows += observationSize;
+                }
+            }
+
+            if( retainedRows > 0 )
+            {
+                currentSet.startIndex_ = currentOutputIndex - retainedRows;
+                currentSet.numberOfRows_ = retainedRows;
+                retainedObservationSets.push_back( currentSet );
+            }
+        }
+
+        observations_.resize( currentOutputIndex );
+        observationTimes_.resize( currentOutputIndex );
+        weights_.resize( currentOutputIndex );
+        linkEndsIds_.resize( currentOutputIndex );
+        observationSets_ = retainedObservationSets;
+        updateObservationSetIndexMap( );
+
+        return numberOfRemovedRows;
+    }
+
+    //! Function to remove observations with a weighted residual exceeding a given threshold.
+    /*!
+     * Function to remove observations with a weighted residual (absolute residual times the square root of the weight)
+     * exceeding a given threshold.
+     * \param residuals Observation residuals (in the order of the rows of this collection)
+     * \param maximumWeightedResidual Maximum absolute weighted residual for which an observation is retained
+     * \return Number of rows that was removed
+     */
+    int removeOutliers( const Eigen::VectorXd& residuals, const double maximumWeightedResidual )
+    {
+        if( residuals.rows( ) != getNumberOfObservations( ) )
+        {
+            throw std::runtime_error( "Error when removing outliers from observation collection, size of residuals is inconsistent" );
+        }
+
+        std::vector< bool > rowsToKeep( residuals.rows( ) );
+        for( int i = 0; i < residuals.rows( ); i++ )
+        {
+            rowsToKeep[ i ] = ( std::fabs( residuals( i ) ) * std::sqrt( weights_[ i ] ) <= maximumWeightedResidual );
+        }
+        return filterObservations( rowsToKeep );
+    }
+
+    //! Function to set a constant weight for all observations
+    /*!
+     * Function to set a constant weight for all observations
+     * \param constantWeight Weight that is to be set for all observations
+     */
+    void setConstantWeight( const double constantWeight )
+    {
+        std::fill( weights_.begin( ), weights_.end( ), constantWeight );
+    }
+
+    //! Function to set a constant weight for all observations of a single observable type and link ends
+    /*!
+     * Function to set a constant weight for all observations of a single observable type and link ends
+     * \param observableType Type of observable
+     * \param linkEnds Link ends of observations
+     * \param constantWeight Weight that is to be set for all observations of given observable type and link ends
+     */
+    void setConstantWeight( const ObservableType observableType, const LinkEnds& linkEnds, const double constantWeight )
+    {
+        std::pair< int, int > observationRange = getObservationSetRange( observableType, linkEnds );
+        std::fill( weights_.begin( ) + observationRange.first,
+                   weights_.begin( ) + observationRange.first + observationRange.second, constantWeight );
+    }
+
+    //! Function to retrieve the row range of the observations of a single observable type and link ends
+    /*!
+     * Function to retrieve the row range of the observations of a single observable type and link ends
+     * \param observableType Type of observable
+     * \param linkEnds Link ends of observations
+     * \return Pair of index of first row, and number of rows, of the requested observations
+     */
+    std::pair< int, int > getObservationSetRange( const ObservableType observableType, const LinkEnds& linkEnds ) const
+    {
+        int setIndex = getObservationSetIndex( observableType, linkEnds );
+        if( setIndex < 0 )
+        {
+            throw std::runtime_error( "Error when retrieving observation range, no observations of type " +
+                                      std::to_string( observableType ) + " for link ends " +
+                                      getLinkEndsString( linkEnds ) + " found" );
+        }
+        return std::make_pair( observationSets_.at( setIndex ).startIndex_, observationSets_.at( setIndex ).numberOfRows_ );
+    }
+
+    //! Function to retrieve the row range of the observations of a single observable type (all link ends)
+    /*!
+     * Function to retrieve the row range of the observations of a single observable type (all link ends)
+     * \param observableType Type of observable
+     * \return Pair of index of first row, and number of rows, of the requested observations (number of rows is zero if no
+     * observations of given type are present).
+     */
+    std::pair< int, int > getObservableRange( const ObservableType observableType ) const
+    {
+        std::unordered_map< int, std::pair< int, int > >::const_iterator observableIterator =
+                observableSetIndexRanges_.find( static_cast< int >( observableType ) );
+        if( observableIterator == observableSetIndexRanges_.end( ) )
+        {
+            return std::make_pair( 0, 0 );
+        }
+
+        const ObservationSetIndices& firstSet = observationSets_.at( observableIterator->second.first );
+        const ObservationSetIndices& lastSet = observationSets_.at( observableIterator->second.second );
+        return std::make_pair( firstSet.startIndex_, lastSet.startIndex_ + lastSet.numberOfRows_ - firstSet.startIndex_ );
+    }
+
+    //! Function to retrieve the index (in the list returned by getObservationSets) of a set of observations
+    /*!
+     * Function to retrieve the index (in the list returned by getObservationSets) of a set of observations
+     * \param observableType Type of observable
+     * \param linkEnds Link ends of observations
+     * \return Index of requested observation set (-1 if not present)
+     */
+    int getObservationSetIndex( const ObservableType observableType, const LinkEnds& linkEnds ) const
+    {
+        std::unordered_map< LinkEnds, int, LinkEndsHash >::const_iterator idIterator = linkEndsIdMap_.find( linkEnds );
+        if( idIterator != linkEndsIdMap_.end( ) )
+        {
+            std::unordered_map< std::pair< int, int >, int, boost::hash< std::pair< int, int > > >::const_iterator
+                    setIterator = observationSetIndexMap_.find(
+                        std::make_pair( static_cast< int >( observableType ), idIterator->second ) );
+            if( setIterator != observationSetIndexMap_.end( ) )
+            {
+                return setIterator->second;
+            }
+        }
+        return -1;
+    }
+
+    //! Function to retrieve the observation times (one per epoch) of a single observation set
+    /*!
+     * Function to retrieve the observation times (one per epoch) of a single observation set
+     * \param setIndex Index of observation set (see getObservationSetIndex)
+     * \return Observation times (one per epoch) of requested observation set
+     */
+    std::vector< TimeType > getObservationSetTimes( const int setIndex ) const
+    {
+        const ObservationSetIndices& currentSet = observationSets_.at( setIndex );
+        std::vector< TimeType > setTimes;
+        setTimes.reserve( currentSet.numberOfRows_ / currentSet.observationSize_ );
+        for( int i = currentSet.startIndex_; i < currentSet.startIndex_ + currentSet.numberOfRows_;
+             i += currentSet.observationSize_ )
+        {
+            setTimes.push_back( observationTimes_[ i ] );
+        }
+        return setTimes;
+    }
+
+    //! Function to convert the collection to map format
+    /*!
+     * Function to convert the collection to map format, as used in PodInput
+     * \return Observations and associated times/reference link end, per link ends and observable type.
+     */
+    ObservationsMapType getObservationsMap( ) const
+    {
+        ObservationsMapType observationsMap;
+        for( unsigned int i = 0; i < observationSets_.size( ); i++ )
+        {
+            const ObservationSetIndices& currentSet = observationSets_.at( i );
+            observationsMap[ currentSet.observableType_ ][ linkEndsList_.at( currentSet.linkEndsId_ ) ] =
+                    std::make_pair( getObservationVector( ).segment( currentSet.startIndex_, currentSet.numberOfRows_ ).eval( ),
+                                    std::make_pair( getObservationSetTimes( i ), currentSet.referenceLinkEnd_ ) );
+        }
+        return observationsMap;
+    }
+
+    //! Function to convert the weights in the collection to map format
+    /*!
+     * Function to convert the weights in the collection to map format, as used in PodInput
+     * \return Observation weights per link ends and observable type.
+     */
+    WeightsMapType getWeightsMap( ) const
+    {
+        WeightsMapType weightsMap;
+        for( unsigned int i = 0; i < observationSets_.size( ); i++ )
+        {
+            const ObservationSetIndices& currentSet = observationSets_.at( i );
+            weightsMap[ currentSet.observableType_ ][ linkEndsList_.at( currentSet.linkEndsId_ ) ] =
+                    getWeightsVector( ).segment( currentSet.startIndex_, currentSet.numberOfRows_ );
+        }
+        return weightsMap;
+    }
+
+    //! Function to retrieve the total number of observation rows in the collection
+    /*!
+     * Function to retrieve the total number of observation rows in the collection
+     * \return Total number of observation rows in the collection
+     */
+    int getNumberOfObservations( ) const
+    {
+        return static_cast< int >( observations_.size( ) );
+    }
+
+    //! Function to retrieve the full (concatenated) vector of observations, without copying
+    /*!
+     * Function to retrieve the full (concatenated) vector of observations, without copying
+     * \return Full (concatenated) vector of observations
+     */
+    Eigen::Map< const ObservationVectorType > getObservationVector( ) const
+    {
+        return Eigen::Map< const ObservationVectorType >( observations_.data( ), observations_.size( ) );
+    }
+
+    //! Function to retrieve the full (concatenated) vector of observation weights, without copying
+    /*!
+     * Function to retrieve the full (concatenated) vector of observation weights, without copying
+     * \return Full (concatenated) vector of observation weights
+     */
+    Eigen::Map< const Eigen::VectorXd > getWeightsVector( ) const
+    {
+        return Eigen::Map< const Eigen::VectorXd >( weights_.data( ), weights_.size( ) );
+    }
+
+    //! Function to retrieve the observation values (one per row)
+    /*!
+     * Function to retrieve the observation values (one per row)
+     * \return Observation values (one per row)
+     */
+    const std::vector< ObservationScalarType >& getObservations( ) const
+    {
+        return observations_;
+    }
+
+    //! Function to retrieve the observation times (one per row)
+    /*!
+     * Function to retrieve the observation times (one per row)
+     * \return Observation times (one per row)
+     */
+    const std::vector< TimeType >& getObservationTimes( ) const
+    {
+        return observationTimes_;
+    }
+
+    //! Function to retrieve the observation weights (one per row)
+    /*!
+     * Function to retrieve the observation weights (one per row)
+     * \return Observation weights (one per row)
+     */
+    const std::vector< double >& getWeights( ) const
+    {
+        return weights_;
+    }
+
+    //! Function to retrieve the link ends identifiers (one per row)
+    /*!
+     * Function to retrieve the link ends identifiers (one per row), link ends may be retrieved from identifier by
+     * getLinkEnds function.
+     * \return Link ends identifiers (one per row)
+     */
+    const std::vector< int >& getLinkEndsIds( ) const
+    {
+        return linkEndsIds_;
+    }
+
+    //! Function to retrieve the link ends associated with a link ends identifier
+    /*!
+     * Function to retrieve the link ends associated with a link ends identifier
+     * \param linkEndsId Link ends identifier
+     * \return Link ends associated with identifier
+     */
+    const LinkEnds& getLinkEnds( const int linkEndsId ) const
+    {
+        return linkEndsList_.at( linkEndsId );
+    }
+
+    //! Function to retrieve the list of observation sets (single observable type and link ends) in the collection.
+    /*!
+     * Function to retrieve the list of observation sets (single observable type and link ends) in the collection, in
+     * the order in which they are stored.
+     * \return List of observation sets in the collection
+     */
+    const std::vector< ObservationSetIndices >& getObservationSets( ) const
+    {
+        return observationSets_;
+    }
+
+private:
+
+    //! Function to retrieve the identifier of a set of link ends, creating a new identifier if none exists yet.
+    int getOrCreateLinkEndsId( const LinkEnds& linkEnds )
+    {
+        std::unordered_map< LinkEnds, int, LinkEndsHash >::const_iterator idIterator = linkEndsIdMap_.find( linkEnds );
+        if( idIterator != linkEndsIdMap_.end( ) )
+        {
+            return idIterator->second;
+        }
+
+        int newId = static_cast< int >( linkEndsList_.size( ) );
+        linkEndsList_.push_back( linkEnds );
+        linkEndsIdMap_[ linkEnds ] = newId;
+        return newId;
+    }
+
+    //! Function to determine whether an existing observation set is to be stored before a given set.
+    bool isSetOrderedBefore( const ObservationSetIndices& existingSet, const ObservableType observableType,
+                             const LinkEnds& linkEnds ) const
+    {
+        if( existingSet.observableType_ != observableType )
+        {
+            return existingSet.observableType_ < observableType;
+        }
+        return linkEndsList_.at( existingSet.linkEndsId_ ) < linkEnds;
+    }
+
+    //! Function to recompute the index of each observation set, after sets have been added or removed.
+    void updateObservationSetIndexMap( )
+    {
+        observationSetIndexMap_.clear( );
+        observableSetIndexRanges_.clear( );
+        for( unsigned int i = 0; i < observationSets_.size( ); i++ )
+        {
+            int observableType = static_cast< int >( observationSets_.at( i ).observableType_ );
+            observationSetIndexMap_[ std::make_pair( observableType, observationSets_.at( i ).linkEndsId_ ) ] = i;
+
+            // Sets are ordered by observable type, so sets of single observable are contiguous
+            if( observableSetIndexRanges_.count( observableType ) == 0 )
+            {
+                observableSetIndexRanges_[ observableType ] = std::make_pair( i, i );
+            }
+            else
+            {
+                observableSetIndexRanges_[ observableType ].second = i;
+            }
+        }
+    }
+
+    //! Observation values (one per row)
+    std::vector< ObservationScalarType > observations_;
+
+    //! Observation times (one per row)
+    std::vector< TimeType > observationTimes_;
+
+    //! Observation weights (one per row)
+    std::vector< double > weights_;
+
+    //! Link ends identifiers (one per row)
+    std::vector< int > linkEndsIds_;
+
+    //! List of link ends, with the link ends identifier as index.
+    std::vector< LinkEnds > linkEndsList_;
+
+    //! Link ends identifiers, with link ends as key.
+    std::unordered_map< LinkEnds, int, LinkEndsHash > linkEndsIdMap_;
+
+    //! List of observation sets, in order of storage
+    std::vector< ObservationSetIndices > observationSets_;
+
+    //! Index in observationSets_ of each observation set, with observable type and link ends identifier as key.
+    std::unordered_map< std::pair< int, int >, int, boost::hash< std::pair< int, int > > > observationSetIndexMap_;
+
+    //! Indices in observationSets_ of the first and last observation set of each observable type.
+    std::unordered_map< int, std::pair< int, int > > observableSetIndexRanges_;
+};
+
+} // namespace observation_models
+
+} // namespace tudat
+
+#endif // TUDAT_OBSERVATIONCOLLECTION_H
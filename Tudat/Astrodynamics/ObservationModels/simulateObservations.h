@@ -14,6 +14,7 @@
 #include <memory>
 #include <boost/bind.hpp>
 
+#include "Tudat/Astrodynamics/ObservationModels/observationCollection.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationSimulator.h"
 
 namespace tudat
@@ -180,6 +181,94 @@ createObservationSimulationTimeSettingsMap(
     return newMap;
 }
 
+//! Function to simulate observations for single observable and single set of link ends, for an observable of any size.
+/*!
+ *  Function to simulate observations for single observable and single set of link ends, for an observable of any size.
+ *  The observation simulator is cast to the derived class of the required observation size, after which the observations
+ *  are simulated.
+ *  \param observationTimeSettings Object that computes/defines settings for observation times/reference link end
+ *  \param observationSimulator Observation simulator for observable for which observations are to be calculated.
+ *  \param linkEnds Link end set for which observations are to be calculated.
+ *  \param currentObservationViabilityCalculators List of observation viability calculators, which are used to reject
+ *  simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle (default none).
+ *  \return Pair of first: vector of observations; second: vector of times at which observations are taken
+ *  (reference to link end defined in observationTimeSettings).
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, std::pair< std::vector< TimeType >, LinkEndType > >
+simulateSingleObservationSetOfAnySize(
+        const std::shared_ptr< ObservationSimulationTimeSettings< TimeType > > observationTimeSettings,
+        const std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > observationSimulator,
+        const LinkEnds& linkEnds,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > > currentObservationViabilityCalculators =
+        std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ) )
+{
+    std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >, std::pair< std::vector< TimeType >, LinkEndType > >
+            simulatedObservations;
+
+    int observationSize = observationSimulator->getObservationSize( linkEnds );
+
+    switch( observationSize )
+    {
+    case 1:
+    {
+        std::shared_ptr< ObservationSimulator< 1, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                std::dynamic_pointer_cast< ObservationSimulator< 1, ObservationScalarType, TimeType > >(
+                    observationSimulator );
+
+        if( derivedObservationSimulator == nullptr )
+        {
+            throw std::runtime_error( "Error when simulating observation: dynamic case to size 1 is nullptr" );
+        }
+
+        // Simulate observations for current observable and link ends set.
+        simulatedObservations = simulateSingleObservationSet< ObservationScalarType, TimeType, 1 >(
+                    observationTimeSettings, derivedObservationSimulator,
+                    linkEnds, currentObservationViabilityCalculators );
+        break;
+    }
+    case 2:
+    {
+        std::shared_ptr< ObservationSimulator< 2, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                std::dynamic_pointer_cast< ObservationSimulator< 2, ObservationScalarType, TimeType > >(
+                    observationSimulator );
+
+        if( derivedObservationSimulator == nullptr )
+        {
+            throw std::runtime_error( "Error when simulating observation: dynamic case to size 2 is nullptr" );
+        }
+
+        // Simulate observations for current observable and link ends set.
+        simulatedObservations = simulateSingleObservationSet< ObservationScalarType, TimeType, 2 >(
+                    observationTimeSettings, derivedObservationSimulator,
+                    linkEnds, currentObservationViabilityCalculators );
+        break;
+    }
+    case 3:
+    {
+        std::shared_ptr< ObservationSimulator< 3, ObservationScalarType, TimeType > > derivedObservationSimulator =
+                std::dynamic_pointer_cast< ObservationSimulator< 3, ObservationScalarType, TimeType > >(
+                    observationSimulator );
+
+        if( derivedObservationSimulator == nullptr )
+        {
+            throw std::runtime_error( "Error when simulating observation: dynamic case to size 3 is nullptr" );
+        }
+
+        // Simulate observations for current observable and link ends set.
+        simulatedObservations = simulateSingleObservationSet< ObservationScalarType, TimeType, 3 >(
+                    observationTimeSettings, derivedObservationSimulator,
+                    linkEnds, currentObservationViabilityCalculators );
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
+                                  std::to_string( observationSize ) );
+
+    }
+    return simulatedObservations;
+}
+
 //! Function to simulate observations from set of observables and link and sets and simple vectors of requested times.
 /*!
  *  Function to simulate observations from set of observables and link and sets and simple vectors of requested times.
@@ -251,73 +340,75 @@ simulateObservations(
                 currentObservationViabilityCalculators = perLinkViabilityCalculators.at( linkEndIterator->first );
             }
 
-            int observationSize = observationSimulators.at( observationIterator->first )->getObservationSize(
-                        linkEndIterator->first );
-
-            switch( observationSize )
-            {
-            case 1:
-            {
-                std::shared_ptr< ObservationSimulator< 1, ObservationScalarType, TimeType > > derivedObservationSimulator =
-                        std::dynamic_pointer_cast< ObservationSimulator< 1, ObservationScalarType, TimeType > >(
-                            observationSimulators.at( observationIterator->first ) );
-
-                if( derivedObservationSimulator == nullptr )
-                {
-                    throw std::runtime_error( "Error when simulating observation: dynamic case to size 1 is nullptr" );
-                }
+            // Simulate observations for current observable and link ends set.
+            observations[ observationIterator->first ][ linkEndIterator->first ] =
+                    simulateSingleObservationSetOfAnySize< ObservationScalarType, TimeType >(
+                        linkEndIterator->second, observationSimulators.at( observationIterator->first ),
+                        linkEndIterator->first, currentObservationViabilityCalculators );
+        }
+    }
+    return observations;
+}
 
-                // Simulate observations for current observable and link ends set.
-                observations[ observationIterator->first ][ linkEndIterator->first ] =
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 1 >(
-                            linkEndIterator->second, derivedObservationSimulator,
-                            linkEndIterator->first, currentObservationViabilityCalculators );
-                break;
-            }
-            case 2:
-            {
-                std::shared_ptr< ObservationSimulator< 2, ObservationScalarType, TimeType > > derivedObservationSimulator =
-                        std::dynamic_pointer_cast< ObservationSimulator< 2, ObservationScalarType, TimeType > >(
-                            observationSimulators.at( observationIterator->first ) );
+//! Function to simulate observations from set of observables and link and sets, and store them in an ObservationCollection
+/*!
+ *  Function to simulate observations from set of observables, link ends and observation time settings, and store them
+ *  in an ObservationCollection (with unit weights). Iterates over all observables and link ends and simulates observations,
+ *  which are directly appended to the collection.
+ *  \param observationsToSimulate List of observation time settings per link end set per observable type.
+ *  \param observationSimulators List of Observation simulators per link end set per observable type.
+ *  \param viabilityCalculatorList List (per observable type and per link ends) of observation viability calculators, which
+ *  are used to reject simulated observation if they dont fulfill a given (set of) conditions, e.g. minimum elevation angle
+ *  (default none).
+ *  \return Collection of simulated observation values and associated times for requested observable types and link end
+ *  sets.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > simulateObservationCollection(
+        const std::map< ObservableType, std::map< LinkEnds,
+        std::shared_ptr< ObservationSimulationTimeSettings< TimeType > > > >& observationsToSimulate,
+        const std::map< ObservableType,
+        std::shared_ptr< ObservationSimulatorBase< ObservationScalarType, TimeType > > >& observationSimulators,
+        const PerObservableObservationViabilityCalculatorList viabilityCalculatorList =
+        PerObservableObservationViabilityCalculatorList( ) )
+{
+    std::shared_ptr< ObservationCollection< ObservationScalarType, TimeType > > observationCollection =
+            std::make_shared< ObservationCollection< ObservationScalarType, TimeType > >( );
 
-                if( derivedObservationSimulator == nullptr )
-                {
-                    throw std::runtime_error( "Error when simulating observation: dynamic case to size 2 is nullptr" );
-                }
+    // Iterate over all observables, in order of storage in collection.
+    for( typename std::map< ObservableType, std::map< LinkEnds,
+         std::shared_ptr< ObservationSimulationTimeSettings< TimeType > >  > >::const_iterator observationIterator =
+         observationsToSimulate.begin( ); observationIterator != observationsToSimulate.end( ); observationIterator++ )
+    {
+        PerLinkEndsObservationViabilityCalculatorList perLinkViabilityCalculators;
+        if( viabilityCalculatorList.count( observationIterator->first ) > 0 )
+        {
+            perLinkViabilityCalculators = viabilityCalculatorList.at( observationIterator->first );
+        }
 
-                // Simulate observations for current observable and link ends set.
-                observations[ observationIterator->first ][ linkEndIterator->first ] =
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 2 >(
-                            linkEndIterator->second, derivedObservationSimulator,
-                            linkEndIterator->first, currentObservationViabilityCalculators );
-                break;
-            }
-            case 3:
+        // Iterate over all link ends for current observable.
+        for( typename std::map< LinkEnds,
+             std::shared_ptr< ObservationSimulationTimeSettings< TimeType > > >::const_iterator linkEndIterator =
+             observationIterator->second.begin( ); linkEndIterator != observationIterator->second.end( ); linkEndIterator++ )
+        {
+            std::vector< std::shared_ptr< ObservationViabilityCalculator > > currentObservationViabilityCalculators;
+            if( perLinkViabilityCalculators.count( linkEndIterator->first ) > 0 )
             {
-                std::shared_ptr< ObservationSimulator< 3, ObservationScalarType, TimeType > > derivedObservationSimulator =
-                        std::dynamic_pointer_cast< ObservationSimulator< 3, ObservationScalarType, TimeType > >(
-                            observationSimulators.at( observationIterator->first ) );
-
-                if( derivedObservationSimulator == nullptr )
-                {
-                    throw std::runtime_error( "Error when simulating observation: dynamic case to size 3 is nullptr" );
-                }
-
-                // Simulate observations for current observable and link ends set.
-                observations[ observationIterator->first ][ linkEndIterator->first ] =
-                        simulateSingleObservationSet< ObservationScalarType, TimeType, 3 >(
-                            linkEndIterator->second, derivedObservationSimulator,
-                            linkEndIterator->first, currentObservationViabilityCalculators );
-                break;
+                currentObservationViabilityCalculators = perLinkViabilityCalculators.at( linkEndIterator->first );
             }
-            default:
-                throw std::runtime_error( "Error, simulation of observations not yet implemented for size " +
-                                          std::to_string( observationSize ) );
 
-            }
+            // Simulate observations for current observable and link ends set, and add to collection
+            std::pair< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >,
+                    std::pair< std::vector< TimeType >, LinkEndType > > currentObservations =
+                    simulateSingleObservationSetOfAnySize< ObservationScalarType, TimeType >(
+                        linkEndIterator->second, observationSimulators.at( observationIterator->first ),
+                        linkEndIterator->first, currentObservationViabilityCalculators );
+            observationCollection->addObservations(
+                        observationIterator->first, linkEndIterator->first, currentObservations.first,
+                        currentObservations.second.first, currentObservations.second.second );
         }
     }
-    return observations;
+    return observationCollection;
 }
 
 //! Function to simulate observations with observation noise from set of observables and link and sets
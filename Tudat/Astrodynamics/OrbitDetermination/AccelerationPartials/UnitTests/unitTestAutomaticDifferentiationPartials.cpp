@@ -0,0 +1,163 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/automaticDifferentiationAccelerationPartial.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/centralGravityAccelerationPartial.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/gravitationalParameter.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::acceleration_partials;
+
+BOOST_AUTO_TEST_SUITE( test_automatic_differentiation_partials )
+
+//! Test automatic differentiation partial of central gravity against analytical partial
+BOOST_AUTO_TEST_CASE( testAutomaticDifferentiationCentralGravityPartial )
+{
+    Eigen::Vector6d vehicleState;
+    vehicleState << 7.0E6, -1.2E6, 3.4E5, 1.0E3, 7.0E3, -0.5E3;
+    Eigen::Vector6d earthState;
+    earthState << 1.0E3, 2.0E3, -3.0E3, 1.0, 2.0, 3.0;
+    double gravitationalParameter = 3.986004418E14;
+    std::shared_ptr< gravitation::GravityFieldModel > earthGravityField =
+            std::make_shared< gravitation::GravityFieldModel >( gravitationalParameter );
+    std::function< double( ) > gravitationalParameterFunction =
+            std::bind( &gravitation::GravityFieldModel::getGravitationalParameter, earthGravityField );
+
+    // Create automatic differentiation partial
+    AutomaticDifferentiationAccelerationPartial automaticDifferentiationPartial(
+                createCentralGravityDualAccelerationModelCreator( gravitationalParameterFunction ),
+                [ & ]( ){ return vehicleState; }, [ & ]( ){ return earthState; }, "Vehicle", "Earth",
+                basic_astrodynamics::central_gravity,
+                createCentralGravityDualParameterAccelerationFunctions(
+                    "Vehicle", "Earth", gravitationalParameterFunction ) );
+
+    // Create gravitational parameter objects
+    std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > earthGravitationalParameter =
+            std::make_shared< estimatable_parameters::GravitationalParameter >( earthGravityField, "Earth" );
+    std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > vehicleGravitationalParameter =
+            std::make_shared< estimatable_parameters::GravitationalParameter >(
+                std::make_shared< gravitation::GravityFieldModel >( 1.0E3 ), "Vehicle" );
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        // Change state to check update
+        if( test == 1 )
+        {
+            vehicleState.segment( 0, 3 ) *= 1.1;
+        }
+        automaticDifferentiationPartial.update( static_cast< double >( test ) );
+
+        // Compute analytical values
+        Eigen::Vector3d expectedAcceleration = gravitation::computeGravitationalAcceleration(
+                    Eigen::Vector3d( vehicleState.segment( 0, 3 ) ), gravitationalParameter,
+                    Eigen::Vector3d( earthState.segment( 0, 3 ) ) );
+        Eigen::Matrix3d expectedPositionPartial = calculatePartialOfPointMassGravityWrtPositionOfAcceleratedBody(
+                    vehicleState.segment( 0, 3 ), earthState.segment( 0, 3 ), gravitationalParameter );
+
+        BOOST_CHECK_SMALL( ( automaticDifferentiationPartial.getCurrentAcceleration( ) - expectedAcceleration ).norm( ) /
+                           expectedAcceleration.norm( ), 1.0E-15 );
+
+        // Retrieve partials through AccelerationPartial interface
+        Eigen::MatrixXd partialWrtVehicle = Eigen::MatrixXd::Zero( 3, 6 );
+        Eigen::MatrixXd partialWrtEarth = Eigen::MatrixXd::Zero( 3, 6 );
+        automaticDifferentiationPartial.wrtStateOfAcceleratedBody( partialWrtVehicle.block( 0, 0, 3, 6 ) );
+        automaticDifferentiationPartial.wrtStateOfAcceleratingBody( partialWrtEarth.block( 0, 0, 3, 6 ) );
+
+        BOOST_CHECK_SMALL( ( partialWrtVehicle.block( 0, 0, 3, 3 ) - expectedPositionPartial ).norm( ) /
+                           expectedPositionPartial.norm( ), 1.0E-14 );
+        BOOST_CHECK_SMALL( ( partialWrtEarth.block( 0, 0, 3, 3 ) + expectedPositionPartial ).norm( ) /
+                           expectedPositionPartial.norm( ), 1.0E-14 );
+        BOOST_CHECK_EQUAL( partialWrtVehicle.block( 0, 3, 3, 3 ).norm( ), 0.0 );
+        BOOST_CHECK_EQUAL( partialWrtEarth.block( 0, 3, 3, 3 ).norm( ), 0.0 );
+
+        // Check negative contribution
+        Eigen::MatrixXd negativePartial = Eigen::MatrixXd::Zero( 3, 3 );
+        automaticDifferentiationPartial.wrtPositionOfAcceleratedBody( negativePartial.block( 0, 0, 3, 3 ), false );
+        BOOST_CHECK( negativePartial == -partialWrtVehicle.block( 0, 0, 3, 3 ) );
+
+        // Check partial w.r.t. gravitational parameter against analytical partial
+        Eigen::Vector3d expectedGravitationalParameterPartial = computePartialOfCentralGravityWrtGravitationalParameter(
+                    Eigen::Vector3d( vehicleState.segment( 0, 3 ) ), Eigen::Vector3d( earthState.segment( 0, 3 ) ) );
+        Eigen::MatrixXd gravitationalParameterPartial =
+                automaticDifferentiationPartial.wrtParameter( earthGravitationalParameter );
+        BOOST_CHECK_EQUAL( gravitationalParameterPartial.cols( ), 1 );
+        BOOST_CHECK_SMALL( ( gravitationalParameterPartial - expectedGravitationalParameterPartial ).norm( ) /
+                           expectedGravitationalParameterPartial.norm( ), 1.0E-15 );
+
+        // Check that there is no dependency on gravitational parameter of vehicle (no mutual attraction)
+        BOOST_CHECK_EQUAL(
+                    automaticDifferentiationPartial.getParameterPartialFunction( vehicleGravitationalParameter ).second, 0 );
+    }
+
+    // Check that body mass dependency is detected for body exerting acceleration only
+    BOOST_CHECK_THROW( automaticDifferentiationPartial.isStateDerivativeDependentOnIntegratedAdditionalStateTypes(
+                           std::make_pair( "Earth", "" ), propagators::body_mass_state ), std::runtime_error );
+    BOOST_CHECK( !automaticDifferentiationPartial.isStateDerivativeDependentOnIntegratedAdditionalStateTypes(
+                     std::make_pair( "Vehicle", "" ), propagators::body_mass_state ) );
+    BOOST_CHECK( !automaticDifferentiationPartial.isStateDerivativeDependentOnIntegratedAdditionalStateTypes(
+                     std::make_pair( "Earth", "" ), propagators::rotational_state ) );
+}
+
+//! Test automatic differentiation partial w.r.t. gravitational parameters, for central gravity with mutual attraction
+BOOST_AUTO_TEST_CASE( testAutomaticDifferentiationMutualAttractionParameterPartial )
+{
+    Eigen::Vector6d moonState;
+    moonState << 3.8E8, 1.2E7, -2.4E6, -10.0, 1.0E3, 50.0;
+    Eigen::Vector6d earthState = Eigen::Vector6d::Zero( );
+
+    std::shared_ptr< gravitation::GravityFieldModel > earthGravityField =
+            std::make_shared< gravitation::GravityFieldModel >( 3.986004418E14 );
+    std::shared_ptr< gravitation::GravityFieldModel > moonGravityField =
+            std::make_shared< gravitation::GravityFieldModel >( 4.9048695E12 );
+    std::function< double( ) > totalGravitationalParameterFunction = [ = ]( )
+    {
+        return earthGravityField->getGravitationalParameter( ) + moonGravityField->getGravitationalParameter( );
+    };
+
+    AutomaticDifferentiationAccelerationPartial automaticDifferentiationPartial(
+                createCentralGravityDualAccelerationModelCreator( totalGravitationalParameterFunction ),
+                [ & ]( ){ return moonState; }, [ & ]( ){ return earthState; }, "Moon", "Earth",
+                basic_astrodynamics::central_gravity,
+                createCentralGravityDualParameterAccelerationFunctions(
+                    "Moon", "Earth", totalGravitationalParameterFunction, true ) );
+    automaticDifferentiationPartial.update( 0.0 );
+
+    // Partial w.r.t. gravitational parameter of both bodies is equal to that w.r.t. the summed gravitational parameter
+    Eigen::Vector3d expectedGravitationalParameterPartial = computePartialOfCentralGravityWrtGravitationalParameter(
+                Eigen::Vector3d( moonState.segment( 0, 3 ) ), Eigen::Vector3d( earthState.segment( 0, 3 ) ) );
+    Eigen::MatrixXd earthParameterPartial = automaticDifferentiationPartial.wrtParameter(
+                std::make_shared< estimatable_parameters::GravitationalParameter >( earthGravityField, "Earth" ) );
+    Eigen::MatrixXd moonParameterPartial = automaticDifferentiationPartial.wrtParameter(
+                std::make_shared< estimatable_parameters::GravitationalParameter >( moonGravityField, "Moon" ) );
+    BOOST_CHECK_SMALL( ( earthParameterPartial - expectedGravitationalParameterPartial ).norm( ) /
+                       expectedGravitationalParameterPartial.norm( ), 1.0E-15 );
+    BOOST_CHECK_SMALL( ( moonParameterPartial - expectedGravitationalParameterPartial ).norm( ) /
+                       expectedGravitationalParameterPartial.norm( ), 1.0E-15 );
+
+    // Check that body mass dependency is detected for both bodies
+    BOOST_CHECK_THROW( automaticDifferentiationPartial.isStateDerivativeDependentOnIntegratedAdditionalStateTypes(
+                           std::make_pair( "Moon", "" ), propagators::body_mass_state ), std::runtime_error );
+    BOOST_CHECK_THROW( automaticDifferentiationPartial.isStateDerivativeDependentOnIntegratedAdditionalStateTypes(
+                           std::make_pair( "Earth", "" ), propagators::body_mass_state ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,176 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <complex>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/centralGravityAccelerationPartial.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/parallelNumericalPartials.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::acceleration_partials;
+
+BOOST_AUTO_TEST_SUITE( test_parallel_numerical_partials )
+
+//! Simple environment, of which one copy is created per thread.
+struct TestEnvironment
+{
+    TestEnvironment( const Eigen::Vector6d& bodyState, const Eigen::Vector2d& gravitationalParameters ):
+        bodyState_( bodyState ), gravitationalParameters_( gravitationalParameters )
+    {
+        // Acceleration due to sum of two gravitational parameters (e.g. planet and unresolved satellite).
+        accelerationModel_ = std::make_shared< gravitation::CentralGravitationalAccelerationModel3d >(
+                    [ = ]( ){ return Eigen::Vector3d( bodyState_.segment( 0, 3 ) ); },
+                    std::function< double( ) >( [ = ]( ){ return gravitationalParameters_.sum( ); } ) );
+    }
+
+    Eigen::Vector6d bodyState_;
+
+    Eigen::Vector2d gravitationalParameters_;
+
+    std::shared_ptr< gravitation::CentralGravitationalAccelerationModel3d > accelerationModel_;
+};
+
+//! Vector parameter, setting the gravitational parameters of a single test environment.
+class TestGravitationalParameters: public estimatable_parameters::EstimatableParameter< Eigen::VectorXd >
+{
+public:
+    TestGravitationalParameters( const std::shared_ptr< TestEnvironment > environment ):
+        estimatable_parameters::EstimatableParameter< Eigen::VectorXd >(
+            estimatable_parameters::gravitational_parameter, "Earth" ), environment_( environment ){ }
+
+    Eigen::VectorXd getParameterValue( )
+    {
+        return environment_->gravitationalParameters_;
+    }
+
+    void setParameterValue( const Eigen::VectorXd parameterValue )
+    {
+        environment_->gravitationalParameters_ = parameterValue;
+    }
+
+    int getParameterSize( )
+    {
+        return 2;
+    }
+
+private:
+    std::shared_ptr< TestEnvironment > environment_;
+};
+
+//! Point mass gravitational acceleration, implemented for generic scalar type
+template< typename ScalarType >
+Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > computePointMassAcceleration(
+        const Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& input )
+{
+    // Input: position (3) and gravitational parameter (1)
+    Eigen::Matrix< ScalarType, 3, 1 > position = input.segment( 0, 3 );
+    ScalarType distance = std::sqrt( position( 0 ) * position( 0 ) + position( 1 ) * position( 1 ) +
+                                     position( 2 ) * position( 2 ) );
+    return -input( 3 ) * position / ( distance * distance * distance );
+}
+
+//! Test parallel central difference and complex step partials against analytical partials
+BOOST_AUTO_TEST_CASE( testParallelNumericalAccelerationPartials )
+{
+    Eigen::Vector6d nominalState;
+    nominalState << 7.0E6, -1.2E6, 3.4E5, 1.0E3, 7.0E3, -0.5E3;
+    Eigen::Vector2d nominalGravitationalParameters( 3.986004418E14, 4.9E12 );
+
+    // Create one environment per thread
+    const unsigned int numberOfThreads = 3;
+    std::vector< std::shared_ptr< TestEnvironment > > environments;
+    std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > > parameters;
+    std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > > accelerationModels;
+    std::vector< NumericalPartialModelFunction > stateModelFunctions;
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        environments.push_back( std::make_shared< TestEnvironment >( nominalState, nominalGravitationalParameters ) );
+        parameters.push_back( std::make_shared< TestGravitationalParameters >( environments.at( i ) ) );
+        accelerationModels.push_back( environments.at( i )->accelerationModel_ );
+
+        std::shared_ptr< TestEnvironment > currentEnvironment = environments.at( i );
+        stateModelFunctions.push_back(
+                    createAccelerationWrtStateModelFunction(
+                        [ = ]( const Eigen::Vector6d& state ){ currentEnvironment->bodyState_ = state; },
+                        accelerationModels.at( i ) ) );
+    }
+
+    // Analytical partials
+    Eigen::Matrix3d analyticalPositionPartial = calculatePartialOfPointMassGravityWrtPositionOfAcceleratedBody(
+                nominalState.segment( 0, 3 ), Eigen::Vector3d::Zero( ), nominalGravitationalParameters.sum( ) );
+    Eigen::Vector3d analyticalGravitationalParameterPartial =
+            gravitation::computeGravitationalAcceleration( nominalState.segment( 0, 3 ), 1.0, Eigen::Vector3d::Zero( ) );
+
+    // Compute state partials in parallel, and serially (single model function)
+    Eigen::MatrixXd parallelStatePartial = calculateCentralDifferencePartialsInParallel(
+                stateModelFunctions, nominalState, ( Eigen::VectorXd( 6 ) << 10.0, 10.0, 10.0, 0.1, 0.1, 0.1 ).finished( ) );
+    Eigen::MatrixXd serialStatePartial = calculateCentralDifferencePartialsInParallel(
+                std::vector< NumericalPartialModelFunction >( 1, stateModelFunctions.at( 0 ) ), nominalState,
+                ( Eigen::VectorXd( 6 ) << 10.0, 10.0, 10.0, 0.1, 0.1, 0.1 ).finished( ) );
+
+    BOOST_CHECK_EQUAL( parallelStatePartial.rows( ), 3 );
+    BOOST_CHECK_EQUAL( parallelStatePartial.cols( ), 6 );
+    BOOST_CHECK( parallelStatePartial == serialStatePartial );
+    BOOST_CHECK_SMALL( ( parallelStatePartial.block( 0, 0, 3, 3 ) - analyticalPositionPartial ).norm( ) /
+                       analyticalPositionPartial.norm( ), 1.0E-6 );
+    BOOST_CHECK_SMALL( parallelStatePartial.block( 0, 3, 3, 3 ).norm( ), 1.0E-15 );
+
+    // Check that environments have been reset to nominal state
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        BOOST_CHECK( environments.at( i )->bodyState_ == nominalState );
+    }
+
+    // Compute parameter partials in parallel
+    Eigen::Matrix< double, 3, Eigen::Dynamic > parameterPartial = calculateAccelerationWrtParameterPartialsInParallel(
+                parameters, accelerationModels, Eigen::Vector2d( 1.0E8, 1.0E6 ) );
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        BOOST_CHECK_SMALL( ( parameterPartial.col( i ) - analyticalGravitationalParameterPartial ).norm( ) /
+                           analyticalGravitationalParameterPartial.norm( ), 1.0E-8 );
+    }
+    for( unsigned int i = 0; i < numberOfThreads; i++ )
+    {
+        BOOST_CHECK( environments.at( i )->gravitationalParameters_ == nominalGravitationalParameters );
+    }
+
+    BOOST_CHECK_THROW( calculateAccelerationWrtParameterPartialsInParallel(
+                           parameters, std::vector< std::shared_ptr<
+                           basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >( 1, accelerationModels.at( 0 ) ),
+                           Eigen::Vector2d( 1.0E8, 1.0E6 ) ), std::runtime_error );
+
+    // Compute complex-step partials w.r.t. position and gravitational parameter
+    Eigen::VectorXd nominalInput = Eigen::VectorXd( 4 );
+    nominalInput << nominalState.segment( 0, 3 ), nominalGravitationalParameters.sum( );
+    std::vector< ComplexStepModelFunction > complexModelFunctions(
+                numberOfThreads, &computePointMassAcceleration< std::complex< double > > );
+    Eigen::MatrixXd complexStepPartial = calculateComplexStepPartials( complexModelFunctions, nominalInput );
+
+    BOOST_CHECK_SMALL( ( complexStepPartial.block( 0, 0, 3, 3 ) - analyticalPositionPartial ).norm( ) /
+                       analyticalPositionPartial.norm( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( complexStepPartial.col( 3 ) - analyticalGravitationalParameterPartial ).norm( ) /
+                       analyticalGravitationalParameterPartial.norm( ), 1.0E-14 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -825,6 +825,118 @@ BOOST_AUTO_TEST_CASE( testSphericalHarmonicAccelerationPartial )
 
 }
 
+//! Test partials of spherical harmonic coefficients w.r.t. degree 4 tidal Love numbers, at all orders.
+BOOST_AUTO_TEST_CASE( testDegreeFourTidalLoveNumberCoefficientPartials )
+{
+    // Define deformed body at constant position, rotating about its z-axis
+    const double referenceRadius = 1.0E6;
+    const double testTime = 2.5E4;
+    std::function< Eigen::Vector6d( const double ) > deformedBodyStateFunction = [ = ]( const double )
+    {
+        return ( Eigen::Vector6d( ) << 1.0E8, -2.0E7, 3.0E6, 0.0, 0.0, 0.0 ).finished( );
+    };
+    std::function< Eigen::Quaterniond( const double ) > deformedBodyOrientationFunction = [ = ]( const double time )
+    {
+        return Eigen::Quaterniond( Eigen::AngleAxisd( -1.0E-4 * time, Eigen::Vector3d::UnitZ( ) ) );
+    };
+
+    // Define deforming bodies on inclined circular orbits, one of which is in the southern hemisphere of the deformed
+    // body at the test time, so that the sign of odd-order terms is tested at both positive and negative latitudes.
+    std::vector< std::function< Eigen::Vector6d( const double ) > > deformingBodyStateFunctions;
+    std::vector< std::function< double( ) > > deformingBodyMasses;
+    std::vector< std::string > deformingBodies;
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        const double orbitRadius = ( 5.0 + 3.0 * static_cast< double >( i ) ) * referenceRadius;
+        const double inclination = ( i == 0 ) ? 0.4 : -1.0;
+        const double meanMotion = 2.0E-5 / static_cast< double >( i + 1 );
+        deformingBodyStateFunctions.push_back( [ = ]( const double time )
+        {
+            Eigen::Vector6d deformingBodyState = deformedBodyStateFunction( time );
+            deformingBodyState.segment( 0, 3 ) += orbitRadius * (
+                        Eigen::AngleAxisd( inclination, Eigen::Vector3d::UnitX( ) ) *
+                        Eigen::Vector3d( std::cos( meanMotion * time ), std::sin( meanMotion * time ), 0.0 ) );
+            return deformingBodyState;
+        } );
+        deformingBodyMasses.push_back( [ = ]( ){ return 1.0E20 * static_cast< double >( i + 1 ); } );
+        deformingBodies.push_back( "Body" + std::to_string( i ) );
+    }
+    std::function< double( ) > deformedBodyMass = [ = ]( ){ return 5.0E22; };
+
+    // Create tidal variation models with only a unit real, and only a unit imaginary, degree 4 Love number at all orders
+    std::vector< std::shared_ptr< BasicSolidBodyTideGravityFieldVariations > > unitLoveNumberVariations;
+    std::vector< std::complex< double > > unitLoveNumbers =
+    { std::complex< double >( 1.0, 0.0 ), std::complex< double >( 0.0, 1.0 ) };
+    for( unsigned int i = 0; i < unitLoveNumbers.size( ); i++ )
+    {
+        std::vector< std::vector< std::complex< double > > > loveNumbers;
+        loveNumbers.push_back( std::vector< std::complex< double > >( 3, std::complex< double >( 0.0, 0.0 ) ) );
+        loveNumbers.push_back( std::vector< std::complex< double > >( 4, std::complex< double >( 0.0, 0.0 ) ) );
+        loveNumbers.push_back( std::vector< std::complex< double > >( 5, unitLoveNumbers.at( i ) ) );
+
+        unitLoveNumberVariations.push_back( std::make_shared< BasicSolidBodyTideGravityFieldVariations >(
+                    deformedBodyStateFunction, deformedBodyOrientationFunction, deformingBodyStateFunctions,
+                    referenceRadius, deformedBodyMass, deformingBodyMasses, loveNumbers, deformingBodies ) );
+    }
+
+    // Create Love number partial interface, evaluating all body states at the test time
+    std::vector< std::function< Eigen::Vector3d( ) > > deformingBodyPositionFunctions;
+    for( unsigned int i = 0; i < deformingBodyStateFunctions.size( ); i++ )
+    {
+        deformingBodyPositionFunctions.push_back(
+                    [ = ]( ){ return Eigen::Vector3d( deformingBodyStateFunctions.at( i )( testTime ).segment( 0, 3 ) ); } );
+    }
+    TidalLoveNumberPartialInterface loveNumberPartialInterface(
+                unitLoveNumberVariations.at( 0 ),
+                [ = ]( ){ return Eigen::Vector3d( deformedBodyStateFunction( testTime ).segment( 0, 3 ) ); },
+                deformingBodyPositionFunctions,
+                [ = ]( ){ return deformedBodyOrientationFunction( testTime ); }, "DeformedBody" );
+    loveNumberPartialInterface.update( testTime );
+
+    const std::vector< int > orders = { 0, 1, 2, 3, 4 };
+    const std::vector< int > deformingBodyIndices = { 0, 1 };
+    std::vector< Eigen::Matrix< double, 2, Eigen::Dynamic > > realLoveNumberPartials =
+            loveNumberPartialInterface.calculateSphericalHarmonicCoefficientsPartialWrtRealTidalLoveNumbers(
+                4, orders, deformingBodyIndices, 4, 4 );
+    std::vector< Eigen::Matrix< double, 2, Eigen::Dynamic > > complexLoveNumberPartials =
+            loveNumberPartialInterface.calculateSphericalHarmonicCoefficientsPartialWrtComplexTidalLoveNumbers(
+                4, orders, deformingBodyIndices, 4, 4 );
+
+    // Coefficient corrections are linear in the Love numbers, so the corrections due to a unit Love number must equal the
+    // partial w.r.t. the real/imaginary component, up to rounding errors.
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > realUnitCorrections =
+            unitLoveNumberVariations.at( 0 )->calculateSphericalHarmonicsCorrections( testTime );
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > imaginaryUnitCorrections =
+            unitLoveNumberVariations.at( 1 )->calculateSphericalHarmonicsCorrections( testTime );
+    const double correctionScale = std::max( realUnitCorrections.first.cwiseAbs( ).maxCoeff( ),
+                                             realUnitCorrections.second.cwiseAbs( ).maxCoeff( ) );
+    BOOST_CHECK( correctionScale > 0.0 );
+
+    for( unsigned int m = 0; m < orders.size( ); m++ )
+    {
+        BOOST_CHECK_EQUAL( realLoveNumberPartials.at( m ).cols( ), 1 );
+        BOOST_CHECK_EQUAL( complexLoveNumberPartials.at( m ).cols( ), 2 );
+
+        BOOST_CHECK_SMALL( realLoveNumberPartials.at( m )( 0, 0 ) - realUnitCorrections.first( 2, m ),
+                           1.0E-13 * correctionScale );
+        BOOST_CHECK_SMALL( complexLoveNumberPartials.at( m )( 0, 0 ) - realUnitCorrections.first( 2, m ),
+                           1.0E-13 * correctionScale );
+        BOOST_CHECK_SMALL( complexLoveNumberPartials.at( m )( 0, 1 ) - imaginaryUnitCorrections.first( 2, m ),
+                           1.0E-13 * correctionScale );
+
+        // Sine coefficients at order 0 are not corrected (and do not influence the acceleration)
+        if( m > 0 )
+        {
+            BOOST_CHECK_SMALL( realLoveNumberPartials.at( m )( 1, 0 ) - realUnitCorrections.second( 2, m ),
+                               1.0E-13 * correctionScale );
+            BOOST_CHECK_SMALL( complexLoveNumberPartials.at( m )( 1, 0 ) - realUnitCorrections.second( 2, m ),
+                               1.0E-13 * correctionScale );
+            BOOST_CHECK_SMALL( complexLoveNumberPartials.at( m )( 1, 1 ) - imaginaryUnitCorrections.second( 2, m ),
+                               1.0E-13 * correctionScale );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -0,0 +1,144 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/automaticDifferentiationAccelerationPartial.h"
+
+namespace tudat
+{
+
+namespace acceleration_partials
+{
+
+//! Constructor
+AutomaticDifferentiationAccelerationPartial::AutomaticDifferentiationAccelerationPartial(
+        const DualAccelerationModelCreator& dualAccelerationModelCreator,
+        const std::function< Eigen::Vector6d( ) > acceleratedBodyStateFunction,
+        const std::function< Eigen::Vector6d( ) > acceleratingBodyStateFunction,
+        const std::string& acceleratedBody,
+        const std::string& acceleratingBody,
+        const basic_astrodynamics::AvailableAcceleration accelerationType,
+        const DualParameterAccelerationFunctions& dualParameterAccelerationFunctions ):
+    AccelerationPartial( acceleratedBody, acceleratingBody, accelerationType ),
+    acceleratedBodyStateFunction_( acceleratedBodyStateFunction ),
+    acceleratingBodyStateFunction_( acceleratingBodyStateFunction ),
+    dualParameterAccelerationFunctions_( dualParameterAccelerationFunctions ),
+    currentAcceleration_( Eigen::Vector3d::Constant( TUDAT_NAN ) ),
+    currentStatePartials_( Eigen::Matrix< double, 3, 12 >::Constant( TUDAT_NAN ) )
+{
+    // Create acceleration model that retrieves the seeded states stored in this object.
+    dualAccelerationModel_ = dualAccelerationModelCreator(
+                [ this ]( ){ return currentDualAcceleratedBodyState_; },
+                [ this ]( ){ return currentDualAcceleratingBodyState_; } );
+}
+
+//! Function for updating partial w.r.t. the bodies' states
+void AutomaticDifferentiationAccelerationPartial::update( const double currentTime )
+{
+    if( !( currentTime_ == currentTime ) )
+    {
+        // Seed states of accelerated (derivative indices 0-5) and accelerating (derivative indices 6-11) body.
+        currentAcceleratedBodyState_ = acceleratedBodyStateFunction_( );
+        currentAcceleratingBodyState_ = acceleratingBodyStateFunction_( );
+        currentDualAcceleratedBodyState_ = basic_mathematics::createIndependentDualVector< 12, 6 >(
+                    currentAcceleratedBodyState_, 0 );
+        currentDualAcceleratingBodyState_ = basic_mathematics::createIndependentDualVector< 12, 6 >(
+                    currentAcceleratingBodyState_, 6 );
+
+        // Evaluate acceleration and its Jacobian in a single model evaluation.
+        dualAccelerationModel_->resetTime( TUDAT_NAN );
+        DualVector3 dualAcceleration = basic_astrodynamics::updateAndGetAcceleration< DualVector3 >(
+                    dualAccelerationModel_, currentTime );
+        currentAcceleration_ = basic_mathematics::getDualVectorValues( dualAcceleration );
+        currentStatePartials_ = basic_mathematics::getDualVectorJacobian( dualAcceleration );
+
+        currentTime_ = currentTime;
+    }
+}
+
+//! Function for setting up and retrieving a function returning a partial w.r.t. a double parameter.
+std::pair< std::function< void( Eigen::MatrixXd& ) >, int >
+AutomaticDifferentiationAccelerationPartial::getParameterPartialFunction(
+        std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > parameter )
+{
+    std::function< void( Eigen::MatrixXd& ) > partialFunction;
+    int numberOfColumns = 0;
+
+    // Check if function is provided for parameter
+    DualParameterAccelerationFunctions::const_iterator functionIterator = dualParameterAccelerationFunctions_.find(
+                std::make_pair( parameter->getParameterName( ).first, parameter->getParameterName( ).second.first ) );
+    if( functionIterator != dualParameterAccelerationFunctions_.end( ) )
+    {
+        DualParameterAccelerationFunction dualParameterAccelerationFunction = functionIterator->second;
+        partialFunction = [ this, parameter, dualParameterAccelerationFunction ]( Eigen::MatrixXd& parameterPartial )
+        {
+            // Seed parameter as single independent variable, and evaluate acceleration at states of last update.
+            ParameterDualVector3 dualAcceleration = dualParameterAccelerationFunction(
+                        ParameterPartialDualNumber::createIndependentVariable( parameter->getParameterValue( ), 0 ),
+                        currentAcceleratedBodyState_, currentAcceleratingBodyState_ );
+            parameterPartial = basic_mathematics::getDualVectorJacobian( dualAcceleration );
+        };
+        numberOfColumns = 1;
+    }
+
+    return std::make_pair( partialFunction, numberOfColumns );
+}
+
+//! Function to create a function that creates a central gravity acceleration model with dual number scalar type.
+DualAccelerationModelCreator createCentralGravityDualAccelerationModelCreator(
+        const std::function< double( ) > gravitationalParameterFunction )
+{
+    return [ gravitationalParameterFunction ]( const std::function< DualVector6( ) >& acceleratedBodyStateFunction,
+            const std::function< DualVector6( ) >& acceleratingBodyStateFunction )
+    {
+        return std::make_shared< gravitation::CentralGravitationalAccelerationModel< DualVector3 > >(
+                    [ acceleratedBodyStateFunction ]( ){
+                        return DualVector3( acceleratedBodyStateFunction( ).segment( 0, 3 ) ); },
+                    gravitationalParameterFunction,
+                    [ acceleratingBodyStateFunction ]( ){
+                        return DualVector3( acceleratingBodyStateFunction( ).segment( 0, 3 ) ); } );
+    };
+}
+
+//! Function to create the functions computing a central gravity acceleration as a function of gravitational parameters.
+DualParameterAccelerationFunctions createCentralGravityDualParameterAccelerationFunctions(
+        const std::string& acceleratedBody,
+        const std::string& acceleratingBody,
+        const std::function< double( ) > gravitationalParameterFunction,
+        const bool accelerationUsesMutualAttraction )
+{
+    DualParameterAccelerationFunction gravitationalParameterAccelerationFunction =
+            [ gravitationalParameterFunction ]( const ParameterPartialDualNumber& gravitationalParameter,
+            const Eigen::Vector6d& acceleratedBodyState, const Eigen::Vector6d& acceleratingBodyState )
+    {
+        // Gravitational parameter used by the model may be the sum of that of both bodies (if mutual attraction is used),
+        // and has a unit derivative w.r.t. the gravitational parameter of either body.
+        ParameterPartialDualNumber usedGravitationalParameter =
+                gravitationalParameter + ( gravitationalParameterFunction( ) - gravitationalParameter.getValue( ) );
+        return gravitation::computeGravitationalAcceleration< ParameterPartialDualNumber >(
+                    ParameterDualVector3( acceleratedBodyState.segment( 0, 3 ).cast< ParameterPartialDualNumber >( ) ),
+                    usedGravitationalParameter,
+                    ParameterDualVector3( acceleratingBodyState.segment( 0, 3 ).cast< ParameterPartialDualNumber >( ) ) );
+    };
+
+    DualParameterAccelerationFunctions dualParameterAccelerationFunctions;
+    dualParameterAccelerationFunctions[ std::make_pair( estimatable_parameters::gravitational_parameter, acceleratingBody ) ] =
+            gravitationalParameterAccelerationFunction;
+    if( accelerationUsesMutualAttraction )
+    {
+        dualParameterAccelerationFunctions[ std::make_pair( estimatable_parameters::gravitational_parameter,
+                                                            acceleratedBody ) ] = gravitationalParameterAccelerationFunction;
+    }
+    return dualParameterAccelerationFunctions;
+}
+
+} // namespace acceleration_partials
+
+} // namespace tudat
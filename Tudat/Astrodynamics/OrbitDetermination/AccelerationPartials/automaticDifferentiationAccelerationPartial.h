@@ -0,0 +1,323 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_AUTOMATICDIFFERENTIATIONACCELERATIONPARTIAL_H
+#define TUDAT_AUTOMATICDIFFERENTIATIONACCELERATIONPARTIAL_H
+
+#include <functional>
+#include <map>
+
+#include "Tudat/Mathematics/BasicMathematics/dualNumber.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/accelerationPartial.h"
+
+namespace tudat
+{
+
+namespace acceleration_partials
+{
+
+//! Dual number type used for automatic differentiation of accelerations w.r.t. states of accelerated and accelerating body
+typedef basic_mathematics::DualNumber< 12 > AccelerationPartialDualNumber;
+
+//! Typedef for acceleration vector, with automatic differentiation scalar type.
+typedef Eigen::Matrix< AccelerationPartialDualNumber, 3, 1 > DualVector3;
+
+//! Typedef for Cartesian state vector, with automatic differentiation scalar type.
+typedef Eigen::Matrix< AccelerationPartialDualNumber, 6, 1 > DualVector6;
+
+//! Typedef for function creating an acceleration model (with dual number scalar type) from the states of the bodies.
+/*!
+ *  Typedef for function creating an acceleration model (with dual number scalar type) from functions returning the states
+ *  of the accelerated and accelerating body. The returned model must retrieve the body states through these functions
+ *  (and not from the environment directly), so that their derivatives are propagated through the acceleration.
+ */
+typedef std::function< std::shared_ptr< basic_astrodynamics::AccelerationModel< DualVector3 > >(
+        const std::function< DualVector6( ) >&, const std::function< DualVector6( ) >& ) > DualAccelerationModelCreator;
+
+//! Dual number type used for automatic differentiation of accelerations w.r.t. a single double parameter
+typedef basic_mathematics::DualNumber< 1 > ParameterPartialDualNumber;
+
+//! Typedef for acceleration vector, with scalar type for automatic differentiation w.r.t. a single parameter.
+typedef Eigen::Matrix< ParameterPartialDualNumber, 3, 1 > ParameterDualVector3;
+
+//! Typedef for function computing an acceleration (with dual number scalar type) from the value of a double parameter.
+/*!
+ *  Typedef for function computing an acceleration (with dual number scalar type) from the (seeded) value of a double
+ *  parameter, and the current states of the accelerated and accelerating body (in that order).
+ */
+typedef std::function< ParameterDualVector3( const ParameterPartialDualNumber&, const Eigen::Vector6d&,
+                                             const Eigen::Vector6d& ) > DualParameterAccelerationFunction;
+
+//! Typedef for list of functions computing an acceleration as a function of a double parameter.
+/*!
+ *  Typedef for list of functions computing an acceleration as a function of a double parameter, with the parameter type
+ *  and the name of the body associated with the parameter as key.
+ */
+typedef std::map< std::pair< estimatable_parameters::EstimatebleParametersEnum, std::string >,
+DualParameterAccelerationFunction > DualParameterAccelerationFunctions;
+
+//! Class to calculate the partials of an acceleration w.r.t. the body states using automatic differentiation.
+/*!
+ *  Class to calculate the partials of an acceleration w.r.t. the body states using forward-mode automatic
+ *  differentiation. It can be used for any acceleration model that can be instantiated with a dual number scalar type
+ *  (through its StateMatrix/AccelerationDataType template arguments). In each update, the Cartesian states of the
+ *  accelerated and accelerating bodies are seeded as 12 independent variables, so that a single evaluation of the
+ *  (dual number) acceleration model provides the acceleration and its Jacobian w.r.t. the positions and velocities of
+ *  both bodies, without the need for repeated (numerical) evaluations or a hand-written partial for each model.
+ *  Partials w.r.t. double parameters are computed in the same manner, by evaluating the acceleration with the parameter
+ *  seeded as the single independent variable, for those parameters for which a function is provided to the constructor
+ *  (see DualParameterAccelerationFunctions).
+ *  NOTE: of the existing acceleration models, only the central gravity model (see
+ *  createCentralGravityDualAccelerationModelCreator) can currently be instantiated with a dual number scalar type. The
+ *  third-body and spherical harmonic gravity models (as well as all non-gravitational models) are implemented for
+ *  Eigen::Vector3d only, and their partials are not available through this class.
+ */
+class AutomaticDifferentiationAccelerationPartial: public AccelerationPartial
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param dualAccelerationModelCreator Function creating the acceleration model (with dual number scalar type).
+     *  \param acceleratedBodyStateFunction Function returning the state of the body undergoing acceleration.
+     *  \param acceleratingBodyStateFunction Function returning the state of the body exerting acceleration.
+     *  \param acceleratedBody Name of body undergoing acceleration.
+     *  \param acceleratingBody Name of body exerting acceleration.
+     *  \param accelerationType Type of acceleration w.r.t. which partial is taken.
+     *  \param dualParameterAccelerationFunctions Functions computing the acceleration (with dual number scalar type) as a
+     *  function of the double parameters on which it depends (none by default).
+     */
+    AutomaticDifferentiationAccelerationPartial(
+            const DualAccelerationModelCreator& dualAccelerationModelCreator,
+            const std::function< Eigen::Vector6d( ) > acceleratedBodyStateFunction,
+            const std::function< Eigen::Vector6d( ) > acceleratingBodyStateFunction,
+            const std::string& acceleratedBody,
+            const std::string& acceleratingBody,
+            const basic_astrodynamics::AvailableAcceleration accelerationType,
+            const DualParameterAccelerationFunctions& dualParameterAccelerationFunctions =
+            DualParameterAccelerationFunctions( ) );
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body undergoing acceleration and
+     *  adding it to the existing partial block.
+     *  The update( ) function must have been called during current time step before calling this function.
+     *  \param partialMatrix Block of partial derivatives where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratedBody( Eigen::Block< Eigen::MatrixXd > partialMatrix,
+                                       const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        addPartialBlock( partialMatrix, 0, addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the velocity of body undergoing acceleration and
+     *  adding it to the existing partial block.
+     *  \param partialMatrix Block of partial derivatives where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtVelocityOfAcceleratedBody( Eigen::Block< Eigen::MatrixXd > partialMatrix,
+                                       const bool addContribution = 1, const int startRow = 0, const int startColumn = 3 )
+    {
+        addPartialBlock( partialMatrix, 3, addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the position of body exerting acceleration and
+     *  adding it to the existing partial block.
+     *  \param partialMatrix Block of partial derivatives where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtPositionOfAcceleratingBody( Eigen::Block< Eigen::MatrixXd > partialMatrix,
+                                        const bool addContribution = 1, const int startRow = 0, const int startColumn = 0 )
+    {
+        addPartialBlock( partialMatrix, 6, addContribution, startRow, startColumn );
+    }
+
+    //! Function for calculating the partial of the acceleration w.r.t. the velocity of body exerting acceleration.
+    /*!
+     *  Function for calculating the partial of the acceleration w.r.t. the velocity of body exerting acceleration and
+     *  adding it to the existing partial block.
+     *  \param partialMatrix Block of partial derivatives where current partial is to be added.
+     *  \param addContribution Variable denoting whether to return the partial itself (true) or the negative partial (false).
+     *  \param startRow First row in partialMatrix block where the computed partial is to be added.
+     *  \param startColumn First column in partialMatrix block where the computed partial is to be added.
+     */
+    void wrtVelocityOfAcceleratingBody( Eigen::Block< Eigen::MatrixXd > partialMatrix,
+                                        const bool addContribution = 1, const int startRow = 0, const int startColumn = 3 )
+    {
+        addPartialBlock( partialMatrix, 9, addContribution, startRow, startColumn );
+    }
+
+    //! Function for determining if the acceleration is dependent on a non-translational integrated state.
+    /*!
+     *  Function for determining if the acceleration is dependent on a non-translational integrated state.
+     *  No dependency is implemented, but an error is thrown if the dependency on the mass of a body is requested, for a
+     *  body whose gravitational parameter the acceleration depends on (as in CentralGravitationPartial).
+     *  \param stateReferencePoint Reference point id of propagated state
+     *  \param integratedStateType Type of propagated state for which dependency is to be determined.
+     *  \return True if dependency exists (non-zero partial), false otherwise.
+     */
+    bool isStateDerivativeDependentOnIntegratedAdditionalStateTypes(
+            const std::pair< std::string, std::string >& stateReferencePoint,
+            const propagators::IntegratedStateType integratedStateType )
+    {
+        if( integratedStateType == propagators::body_mass_state &&
+                dualParameterAccelerationFunctions_.count(
+                    std::make_pair( estimatable_parameters::gravitational_parameter, stateReferencePoint.first ) ) > 0 )
+        {
+            throw std::runtime_error( "Warning, dependency of acceleration on body masses not yet implemented" );
+        }
+        return false;
+    }
+
+    //! Function for setting up and retrieving a function returning a partial w.r.t. a double parameter.
+    /*!
+     *  Function for setting up and retrieving a function returning a partial w.r.t. a double parameter, computed by
+     *  automatic differentiation of the function provided for this parameter to the constructor.
+     *  Function returns empty function and zero size indicator for parameters with no dependency for current acceleration.
+     *  \param parameter Parameter w.r.t. which partial is to be taken.
+     *  \return Pair of parameter partial function and number of columns in partial (0 for no dependency, 1 otherwise).
+     */
+    std::pair< std::function< void( Eigen::MatrixXd& ) >, int >
+    getParameterPartialFunction( std::shared_ptr< estimatable_parameters::EstimatableParameter< double > > parameter );
+
+    //! Function for setting up and retrieving a function returning a partial w.r.t. a vector parameter.
+    /*!
+     *  Function for setting up and retrieving a function returning a partial w.r.t. a vector parameter. No vector
+     *  parameter dependencies are implemented for this class.
+     *  \param parameter Parameter w.r.t. which partial is to be taken.
+     *  \return Pair of parameter partial function and number of columns in partial (always 0).
+     */
+    std::pair< std::function< void( Eigen::MatrixXd& ) >, int > getParameterPartialFunction(
+            std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > parameter )
+    {
+        return AccelerationPartial::getParameterPartialFunction( parameter );
+    }
+
+    //! Function for updating partial w.r.t. the bodies' states
+    /*!
+     *  Function for updating partial w.r.t. the bodies' states, by a single evaluation of the acceleration model with
+     *  dual number scalar type.
+     *  \param currentTime Time at which partials are to be calculated
+     */
+    void update( const double currentTime = TUDAT_NAN );
+
+    //! Function to retrieve the acceleration computed during the last update
+    /*!
+     *  Function to retrieve the acceleration computed during the last update
+     *  \return Acceleration computed during the last update
+     */
+    Eigen::Vector3d getCurrentAcceleration( )
+    {
+        return currentAcceleration_;
+    }
+
+    //! Function to retrieve the partials w.r.t. the body states computed during the last update
+    /*!
+     *  Function to retrieve the partials w.r.t. the body states computed during the last update
+     *  \return Partials w.r.t. states of accelerated body (columns 0-5) and accelerating body (columns 6-11).
+     */
+    Eigen::Matrix< double, 3, 12 > getCurrentStatePartials( )
+    {
+        return currentStatePartials_;
+    }
+
+protected:
+
+    //! Function to add (or subtract) a 3x3 block of the current state partials to a partial matrix
+    void addPartialBlock( Eigen::Block< Eigen::MatrixXd > partialMatrix, const int partialStartColumn,
+                          const bool addContribution, const int startRow, const int startColumn )
+    {
+        if( addContribution )
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) += currentStatePartials_.block( 0, partialStartColumn, 3, 3 );
+        }
+        else
+        {
+            partialMatrix.block( startRow, startColumn, 3, 3 ) -= currentStatePartials_.block( 0, partialStartColumn, 3, 3 );
+        }
+    }
+
+    //! Function to retrieve current state of body undergoing acceleration.
+    std::function< Eigen::Vector6d( ) > acceleratedBodyStateFunction_;
+
+    //! Function to retrieve current state of body exerting acceleration.
+    std::function< Eigen::Vector6d( ) > acceleratingBodyStateFunction_;
+
+    //! Functions computing the acceleration (with dual number scalar type) as a function of double parameters.
+    DualParameterAccelerationFunctions dualParameterAccelerationFunctions_;
+
+    //! Current state of body undergoing acceleration.
+    Eigen::Vector6d currentAcceleratedBodyState_;
+
+    //! Current state of body exerting acceleration.
+    Eigen::Vector6d currentAcceleratingBodyState_;
+
+    //! Current (seeded) state of body undergoing acceleration, used as input to dual acceleration model.
+    DualVector6 currentDualAcceleratedBodyState_;
+
+    //! Current (seeded) state of body exerting acceleration, used as input to dual acceleration model.
+    DualVector6 currentDualAcceleratingBodyState_;
+
+    //! Acceleration model with dual number scalar type.
+    std::shared_ptr< basic_astrodynamics::AccelerationModel< DualVector3 > > dualAccelerationModel_;
+
+    //! Acceleration computed during last update.
+    Eigen::Vector3d currentAcceleration_;
+
+    //! Partials w.r.t. states of accelerated body (columns 0-5) and accelerating body (columns 6-11) from last update.
+    Eigen::Matrix< double, 3, 12 > currentStatePartials_;
+};
+
+//! Function to create a function that creates a central gravity acceleration model with dual number scalar type.
+/*!
+ *  Function to create a function that creates a central gravity acceleration model with dual number scalar type, for use
+ *  in the AutomaticDifferentiationAccelerationPartial class.
+ *  \param gravitationalParameterFunction Function returning the gravitational parameter of the body exerting acceleration
+ *  \return Function creating the dual number central gravity acceleration model.
+ */
+DualAccelerationModelCreator createCentralGravityDualAccelerationModelCreator(
+        const std::function< double( ) > gravitationalParameterFunction );
+
+//! Function to create the functions computing a central gravity acceleration as a function of gravitational parameters.
+/*!
+ *  Function to create the functions computing a central gravity acceleration (with dual number scalar type) as a function
+ *  of the gravitational parameter(s) on which it depends, for use in the AutomaticDifferentiationAccelerationPartial class.
+ *  \param acceleratedBody Name of body undergoing acceleration.
+ *  \param acceleratingBody Name of body exerting acceleration.
+ *  \param gravitationalParameterFunction Function returning the gravitational parameter used by the acceleration model
+ *  (the sum of that of both bodies if mutual attraction is used).
+ *  \param accelerationUsesMutualAttraction Boolean denoting whether the gravitational parameter of the body undergoing
+ *  acceleration is included in the acceleration model.
+ *  \return Functions computing the acceleration as a function of the gravitational parameter of the accelerating body (and
+ *  of the accelerated body, if mutual attraction is used).
+ */
+DualParameterAccelerationFunctions createCentralGravityDualParameterAccelerationFunctions(
+        const std::string& acceleratedBody,
+        const std::string& acceleratingBody,
+        const std::function< double( ) > gravitationalParameterFunction,
+        const bool accelerationUsesMutualAttraction = false );
+
+} // namespace acceleration_partials
+
+} // namespace tudat
+
+#endif // TUDAT_AUTOMATICDIFFERENTIATIONACCELERATIONPARTIAL_H
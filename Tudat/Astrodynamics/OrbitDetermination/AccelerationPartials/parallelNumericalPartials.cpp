@@ -0,0 +1,204 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <stdexcept>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/parallelNumericalPartials.h"
+
+namespace tudat
+{
+
+namespace acceleration_partials
+{
+
+namespace
+{
+
+//! Function to assemble partial derivative matrix from list of columns, checking consistency of sizes.
+Eigen::MatrixXd assemblePartialMatrixFromColumns( const std::vector< Eigen::VectorXd >& partialColumns )
+{
+    if( partialColumns.size( ) == 0 )
+    {
+        return Eigen::MatrixXd::Zero( 0, 0 );
+    }
+
+    Eigen::MatrixXd partialMatrix = Eigen::MatrixXd( partialColumns.at( 0 ).rows( ), partialColumns.size( ) );
+    for( unsigned int i = 0; i < partialColumns.size( ); i++ )
+    {
+        if( partialColumns.at( i ).rows( ) != partialMatrix.rows( ) )
+        {
+            throw std::runtime_error( "Error when computing numerical partials, model output size is not constant" );
+        }
+        partialMatrix.col( i ) = partialColumns.at( i );
+    }
+    return partialMatrix;
+}
+
+} // namespace
+
+//! Function to numerically compute the partial derivatives of a model w.r.t. its input, evaluating columns in parallel.
+Eigen::MatrixXd calculateCentralDifferencePartialsInParallel(
+        const std::vector< NumericalPartialModelFunction >& threadLocalModelFunctions,
+        const Eigen::VectorXd& nominalInput,
+        const Eigen::VectorXd& inputPerturbations,
+        const bool resetToNominalInput )
+{
+    if( threadLocalModelFunctions.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing numerical partials in parallel, no model functions provided" );
+    }
+
+    if( nominalInput.rows( ) != inputPerturbations.rows( ) )
+    {
+        throw std::runtime_error( "Error when computing numerical partials in parallel, input and perturbations are not the same size" );
+    }
+
+    // Compute each column (up- and down-perturbation of single input entry) using model function of current thread.
+    std::vector< Eigen::VectorXd > partialColumns( nominalInput.rows( ) );
+    utilities::executeParallelForLoop(
+                nominalInput.rows( ),
+                [ & ]( const unsigned int inputIndex, const unsigned int threadIndex )
+    {
+        const NumericalPartialModelFunction& modelFunction = threadLocalModelFunctions.at( threadIndex );
+
+        Eigen::VectorXd perturbedInput = nominalInput;
+        perturbedInput( inputIndex ) += inputPerturbations( inputIndex );
+        Eigen::VectorXd upPerturbedOutput = modelFunction( perturbedInput );
+
+        perturbedInput( inputIndex ) = nominalInput( inputIndex ) - inputPerturbations( inputIndex );
+        Eigen::VectorXd downPerturbedOutput = modelFunction( perturbedInput );
+
+        partialColumns[ inputIndex ] =
+                ( upPerturbedOutput - downPerturbedOutput ) / ( 2.0 * inputPerturbations( inputIndex ) );
+    }, threadLocalModelFunctions.size( ) );
+
+    // Reset environments to original state.
+    if( resetToNominalInput )
+    {
+        for( unsigned int i = 0; i < threadLocalModelFunctions.size( ); i++ )
+        {
+            threadLocalModelFunctions.at( i )( nominalInput );
+        }
+    }
+
+    return assemblePartialMatrixFromColumns( partialColumns );
+}
+
+//! Function to compute the partial derivatives of a model w.r.t. its input using complex-step differentiation.
+Eigen::MatrixXd calculateComplexStepPartials(
+        const std::vector< ComplexStepModelFunction >& threadLocalModelFunctions,
+        const Eigen::VectorXd& nominalInput,
+        const double stepSize )
+{
+    if( threadLocalModelFunctions.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing complex-step partials, no model functions provided" );
+    }
+
+    const Eigen::VectorXcd complexNominalInput = nominalInput.cast< std::complex< double > >( );
+
+    std::vector< Eigen::VectorXd > partialColumns( nominalInput.rows( ) );
+    utilities::executeParallelForLoop(
+                nominalInput.rows( ),
+                [ & ]( const unsigned int inputIndex, const unsigned int threadIndex )
+    {
+        Eigen::VectorXcd perturbedInput = complexNominalInput;
+        perturbedInput( inputIndex ) += std::complex< double >( 0.0, stepSize );
+        partialColumns[ inputIndex ] = threadLocalModelFunctions.at( threadIndex )( perturbedInput ).imag( ) / stepSize;
+    }, threadLocalModelFunctions.size( ) );
+
+    return assemblePartialMatrixFromColumns( partialColumns );
+}
+
+//! Function to create a model function computing an acceleration as a function of a body state.
+NumericalPartialModelFunction createAccelerationWrtStateModelFunction(
+        const std::function< void( Eigen::Vector6d ) > setBodyState,
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::function< void( ) > updateFunction,
+        const double evaluationTime )
+{
+    return [ = ]( const Eigen::VectorXd& bodyState )
+    {
+        if( bodyState.rows( ) != 6 )
+        {
+            throw std::runtime_error( "Error when computing acceleration as function of state, state size is not 6" );
+        }
+        setBodyState( bodyState );
+        updateFunction( );
+        accelerationModel->resetTime( TUDAT_NAN );
+        Eigen::VectorXd acceleration = basic_astrodynamics::updateAndGetAcceleration< Eigen::Vector3d >(
+                    accelerationModel, evaluationTime );
+        accelerationModel->resetTime( TUDAT_NAN );
+        return acceleration;
+    };
+}
+
+//! Function to create a model function computing an acceleration as a function of a vector parameter.
+NumericalPartialModelFunction createAccelerationWrtParameterModelFunction(
+        const std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > parameter,
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::function< void( ) > updateDependentVariables,
+        const double currentTime,
+        const std::function< void( const double ) > timeDependentUpdateDependentVariables )
+{
+    return [ = ]( const Eigen::VectorXd& parameterValue )
+    {
+        parameter->setParameterValue( parameterValue );
+        updateDependentVariables( );
+        timeDependentUpdateDependentVariables( currentTime );
+        accelerationModel->resetTime( TUDAT_NAN );
+        Eigen::VectorXd acceleration = basic_astrodynamics::updateAndGetAcceleration< Eigen::Vector3d >(
+                    accelerationModel, currentTime );
+        accelerationModel->resetTime( TUDAT_NAN );
+        return acceleration;
+    };
+}
+
+//! Function to numerically compute the partial derivative of an acceleration w.r.t. a vector parameter, in parallel.
+Eigen::Matrix< double, 3, Eigen::Dynamic > calculateAccelerationWrtParameterPartialsInParallel(
+        const std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > >&
+        threadLocalParameters,
+        const std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >&
+        threadLocalAccelerationModels,
+        const Eigen::VectorXd& parameterPerturbation,
+        const std::vector< std::function< void( const double ) > >& threadLocalUpdateFunctions,
+        const double currentTime )
+{
+    if( threadLocalParameters.size( ) != threadLocalAccelerationModels.size( ) ||
+            ( threadLocalUpdateFunctions.size( ) != 0 &&
+              threadLocalUpdateFunctions.size( ) != threadLocalParameters.size( ) ) )
+    {
+        throw std::runtime_error( "Error when computing acceleration partials in parallel, number of thread-local models is inconsistent" );
+    }
+
+    if( threadLocalParameters.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing acceleration partials in parallel, no thread-local models provided" );
+    }
+
+    std::vector< NumericalPartialModelFunction > threadLocalModelFunctions;
+    for( unsigned int i = 0; i < threadLocalParameters.size( ); i++ )
+    {
+        threadLocalModelFunctions.push_back(
+                    createAccelerationWrtParameterModelFunction(
+                        threadLocalParameters.at( i ), threadLocalAccelerationModels.at( i ), emptyFunction, currentTime,
+                        ( threadLocalUpdateFunctions.size( ) == 0 ) ?
+                            std::function< void( const double ) >( emptyTimeFunction ) :
+                            threadLocalUpdateFunctions.at( i ) ) );
+    }
+
+    return calculateCentralDifferencePartialsInParallel(
+                threadLocalModelFunctions, threadLocalParameters.at( 0 )->getParameterValue( ), parameterPerturbation );
+}
+
+} // namespace acceleration_partials
+
+} // namespace tudat
@@ -0,0 +1,145 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Martins J.R.R.A., Sturdza P., Alonso J.J. The complex-step derivative approximation.
+ *          ACM Transactions on Mathematical Software 29(3), 2003.
+ *
+ */
+
+#ifndef TUDAT_PARALLELNUMERICALPARTIALS_H
+#define TUDAT_PARALLELNUMERICALPARTIALS_H
+
+#include <complex>
+#include <functional>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/OrbitDetermination/AccelerationPartials/numericalAccelerationPartial.h"
+
+namespace tudat
+{
+
+namespace acceleration_partials
+{
+
+//! Typedef for a function computing a model output (e.g. acceleration) from an input vector (e.g. state or parameter).
+typedef std::function< Eigen::VectorXd( const Eigen::VectorXd& ) > NumericalPartialModelFunction;
+
+//! Typedef for a function computing a complex model output from a complex input vector, used for complex-step partials.
+typedef std::function< Eigen::VectorXcd( const Eigen::VectorXcd& ) > ComplexStepModelFunction;
+
+//! Function to numerically compute the partial derivatives of a model w.r.t. its input, evaluating columns in parallel.
+/*!
+ * Function to numerically compute the partial derivatives of a model w.r.t. its input, using a first-order central
+ * difference method. The columns of the partial derivative matrix (one per input entry) are distributed over a number of
+ * threads, each of which uses its own model function. Each model function must operate on its own copy of the
+ * environment (e.g. a set of bodies and acceleration models created with the same settings), so that perturbing the
+ * input in one thread does not affect the other threads. Since the environment cannot be copied, this function is not
+ * called by any of the acceleration partials (or the estimation) in Tudat, which compute their numerical partials
+ * serially. It is provided for user code that creates the thread-local environments itself.
+ * \param threadLocalModelFunctions List of model functions, one per thread (number of threads equals size of list).
+ * \param nominalInput Nominal input at which the partials are to be computed.
+ * \param inputPerturbations Perturbations to be used for each entry of the input.
+ * \param resetToNominalInput Boolean denoting whether each model function is to be called with the nominal input after
+ * the partials are computed, to reset the associated environment to its nominal state.
+ * \return Numerical partial of model output w.r.t. model input.
+ */
+Eigen::MatrixXd calculateCentralDifferencePartialsInParallel(
+        const std::vector< NumericalPartialModelFunction >& threadLocalModelFunctions,
+        const Eigen::VectorXd& nominalInput,
+        const Eigen::VectorXd& inputPerturbations,
+        const bool resetToNominalInput = true );
+
+//! Function to compute the partial derivatives of a model w.r.t. its input using complex-step differentiation.
+/*!
+ * Function to compute the partial derivatives of a model w.r.t. its input using complex-step differentiation
+ * (Martins et al., 2003): df/dx_i = Im( f( x + i h e_i ) ) / h. Since no difference of nearly equal numbers is taken,
+ * the result is accurate to machine precision for any (small) step size. This requires the model to be implemented for
+ * a generic scalar type (so that it can be evaluated for std::complex< double >), using only analytic operations (i.e.
+ * no abs, comparisons on the value, or branches depending on the input). Columns are distributed over threads as in
+ * calculateCentralDifferencePartialsInParallel. The acceleration models in Tudat are implemented for double only, so
+ * this function is not used by any of them; it is provided for user models that meet the above requirements.
+ * \param threadLocalModelFunctions List of complex model functions, one per thread.
+ * \param nominalInput Nominal input at which the partials are to be computed.
+ * \param stepSize Size of imaginary step to use for each entry of the input.
+ * \return Partial of model output w.r.t. model input.
+ */
+Eigen::MatrixXd calculateComplexStepPartials(
+        const std::vector< ComplexStepModelFunction >& threadLocalModelFunctions,
+        const Eigen::VectorXd& nominalInput,
+        const double stepSize = 1.0E-20 );
+
+//! Function to create a model function computing an acceleration as a function of a body state.
+/*!
+ * Function to create a model function computing an acceleration as a function of a body state, for use in
+ * calculateCentralDifferencePartialsInParallel. Each call resets the state, updates the environment and recomputes the
+ * acceleration, as in calculateAccelerationWrtStatePartials.
+ * \param setBodyState Function to reset the current state of the body.
+ * \param accelerationModel Acceleration model that is to be evaluated.
+ * \param updateFunction Function to update the required environment models following the change of the body state.
+ * \param evaluationTime Time at which the acceleration is to be evaluated.
+ * \return Function computing the acceleration from the (Cartesian) body state.
+ */
+NumericalPartialModelFunction createAccelerationWrtStateModelFunction(
+        const std::function< void( Eigen::Vector6d ) > setBodyState,
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::function< void( ) > updateFunction = emptyFunction,
+        const double evaluationTime = TUDAT_NAN );
+
+//! Function to create a model function computing an acceleration as a function of a vector parameter.
+/*!
+ * Function to create a model function computing an acceleration as a function of a vector parameter, for use in
+ * calculateCentralDifferencePartialsInParallel. Each call resets the parameter, updates the environment and recomputes
+ * the acceleration, as in calculateAccelerationWrtParameterPartials.
+ * \param parameter Object describing the parameter w.r.t. which the partial is to be taken.
+ * \param accelerationModel Acceleration model that is to be evaluated.
+ * \param updateDependentVariables Function to update the required environment models following the change in parameter,
+ * for models that do not explicitly depend on the current time.
+ * \param currentTime Time at which the acceleration is to be evaluated.
+ * \param timeDependentUpdateDependentVariables Function to update the required environment models following the change in
+ * parameters for models that do  explicitly depend on the current time.
+ * \return Function computing the acceleration from the parameter value.
+ */
+NumericalPartialModelFunction createAccelerationWrtParameterModelFunction(
+        const std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > parameter,
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel,
+        const std::function< void( ) > updateDependentVariables = emptyFunction,
+        const double currentTime = 0.0,
+        const std::function< void( const double ) > timeDependentUpdateDependentVariables = emptyTimeFunction );
+
+//! Function to numerically compute the partial derivative of an acceleration w.r.t. a vector parameter, in parallel.
+/*!
+ * Function to numerically compute the partial derivative of an acceleration w.r.t. a vector parameter, using a first-order
+ * central difference method, with the perturbed parameter entries distributed over a number of threads. Each thread uses
+ * its own parameter and acceleration model, which must be defined on separate (but identically created) environments.
+ * \param threadLocalParameters Parameter objects, one per thread.
+ * \param threadLocalAccelerationModels Acceleration models, one per thread.
+ * \param parameterPerturbation Perturbations to be used for parameter value.
+ * \param threadLocalUpdateFunctions Functions to update the environment models following the change in parameter, one per
+ * thread (none are used if empty).
+ * \param currentTime Time at which partial is to be computed.
+ * \return Numerical partial of the acceleration w.r.t. given parameter.
+ */
+Eigen::Matrix< double, 3, Eigen::Dynamic > calculateAccelerationWrtParameterPartialsInParallel(
+        const std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameter< Eigen::VectorXd > > >&
+        threadLocalParameters,
+        const std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > >&
+        threadLocalAccelerationModels,
+        const Eigen::VectorXd& parameterPerturbation,
+        const std::vector< std::function< void( const double ) > >& threadLocalUpdateFunctions =
+        std::vector< std::function< void( const double ) > >( ),
+        const double currentTime = 0.0 );
+
+} // namespace acceleration_partials
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLELNUMERICALPARTIALS_H
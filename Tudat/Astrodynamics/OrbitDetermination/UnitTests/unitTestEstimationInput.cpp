@@ -169,6 +169,68 @@ BOOST_AUTO_TEST_CASE( test_CovarianceAsFunctionOfTime )
     }
 }
 
+//! Test that POD input created from an observation collection uses that collection directly
+BOOST_AUTO_TEST_CASE( testPodInputFromObservationCollection )
+{
+    using namespace observation_models;
+
+    LinkEnds stationALinkEnds;
+    stationALinkEnds[ transmitter ] = std::make_pair( "Earth", "StationA" );
+    stationALinkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+
+    LinkEnds positionLinkEnds;
+    positionLinkEnds[ observed_body ] = std::make_pair( "Vehicle", "" );
+
+    Eigen::VectorXd rangeObservations = Eigen::VectorXd::LinSpaced( 4, 1.0, 4.0 );
+    std::vector< double > rangeTimes = { 0.0, 60.0, 120.0, 180.0 };
+    Eigen::VectorXd positionObservations = Eigen::VectorXd::LinSpaced( 9, -4.0, 4.0 );
+    std::vector< double > positionTimes = { 30.0, 90.0, 150.0 };
+
+    std::shared_ptr< ObservationCollection< > > observationCollection = std::make_shared< ObservationCollection< > >( );
+    observationCollection->addObservations(
+                one_way_range, stationALinkEnds, rangeObservations, rangeTimes, receiver,
+                Eigen::VectorXd::Constant( 4, 2.0 ) );
+    observationCollection->addObservations(
+                position_observable, positionLinkEnds, positionObservations, positionTimes,
+                receiver, Eigen::VectorXd::Constant( 9, 3.0 ) );
+
+    std::shared_ptr< simulation_setup::PodInput< double, double > > podInput =
+            std::make_shared< simulation_setup::PodInput< double, double > >( observationCollection, 6 );
+
+    // Check that collection (with its weights) is used directly
+    BOOST_CHECK( podInput->getObservationCollection( ) == observationCollection );
+    BOOST_CHECK( observationCollection->getWeightsVector( ).segment(
+                     observationCollection->getObservationSetRange( one_way_range, stationALinkEnds ).first, 4 ) ==
+                 Eigen::VectorXd::Constant( 4, 2.0 ) );
+
+    // Check that weights are set in collection
+    std::map< ObservableType, double > weightPerObservable;
+    weightPerObservable[ position_observable ] = 5.0;
+    podInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
+    BOOST_CHECK( podInput->getObservationCollection( ) == observationCollection );
+    std::pair< int, int > positionRange =
+            observationCollection->getObservationSetRange( position_observable, positionLinkEnds );
+    std::pair< int, int > rangeRange =
+            observationCollection->getObservationSetRange( one_way_range, stationALinkEnds );
+    BOOST_CHECK( observationCollection->getWeightsVector( ).segment( positionRange.first, positionRange.second ) ==
+                 Eigen::VectorXd::Constant( 9, 5.0 ) );
+    BOOST_CHECK( observationCollection->getWeightsVector( ).segment( rangeRange.first, rangeRange.second ) ==
+                 Eigen::VectorXd::Constant( 4, 2.0 ) );
+
+    podInput->setConstantWeightsMatrix( 7.0 );
+    BOOST_CHECK( observationCollection->getWeightsVector( ) == Eigen::VectorXd::Constant( 13, 7.0 ) );
+
+    // Check conversion to map format when requested
+    BOOST_CHECK( podInput->getObservationsAndTimes( ).at( one_way_range ).at( stationALinkEnds ).first ==
+                 rangeObservations );
+    BOOST_CHECK( podInput->getWeightsMatrixDiagonals( ).at( position_observable ).at( positionLinkEnds ) ==
+                 Eigen::VectorXd::Constant( 9, 7.0 ) );
+    podInput->setConstantWeightsMatrix( 1.0 );
+    BOOST_CHECK( podInput->getObservationCollection( ) != observationCollection );
+    BOOST_CHECK( podInput->getObservationCollection( )->getObservations( ) == observationCollection->getObservations( ) );
+    BOOST_CHECK( podInput->getObservationCollection( )->getWeightsVector( ) == Eigen::VectorXd::Constant( 13, 1.0 ) );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
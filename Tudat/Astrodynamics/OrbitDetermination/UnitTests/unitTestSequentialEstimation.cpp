@@ -0,0 +1,220 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/utilities.h"
+#include "Tudat/Mathematics/Statistics/randomVariableGenerator.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/SimulationSetup/EstimationSetup/orbitDeterminationManager.h"
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+using namespace tudat::estimatable_parameters;
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::ephemerides;
+using namespace tudat::propagators;
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::statistics;
+
+BOOST_AUTO_TEST_SUITE( test_sequential_estimation )
+
+typedef Eigen::Matrix< double, Eigen::Dynamic, 1 > ObservationVectorType;
+typedef std::map< LinkEnds, std::pair< ObservationVectorType, std::pair< std::vector< double >, LinkEndType > > >
+SingleObservablePodInputType;
+typedef std::map< ObservableType, SingleObservablePodInputType > PodInputDataType;
+
+//! Test whether estimation in two sequential batches reproduces the estimation using all data in a single batch
+BOOST_AUTO_TEST_CASE( test_SequentialEstimationTwoBatches )
+{
+    // Create Earth (point mass, fixed at origin) and vehicle, without dependency on ephemeris kernels
+    double earthGravitationalParameter = 3.986004418E14;
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >(
+                earthGravitationalParameter );
+
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< TabulatedCartesianEphemeris< > >(
+                                            std::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create accelerations and propagation settings
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    Eigen::Vector6d initialStateInKeplerianElements;
+    initialStateInKeplerianElements( semiMajorAxisIndex ) = 7200.0E3;
+    initialStateInKeplerianElements( eccentricityIndex ) = 0.05;
+    initialStateInKeplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 85.3 );
+    initialStateInKeplerianElements( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 235.7 );
+    initialStateInKeplerianElements( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 23.4 );
+    initialStateInKeplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( 139.87 );
+    Eigen::Vector6d systemInitialState = convertKeplerianToCartesianElements(
+                initialStateInKeplerianElements, earthGravitationalParameter );
+
+    double initialTime = 1.0E7;
+    double finalTime = initialTime + 4.0 * 3600.0;
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToIntegrate, systemInitialState, finalTime );
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                initialTime, 30.0, RungeKuttaCoefficients::CoefficientSets::rungeKuttaFehlberg78, 30.0, 30.0, 1.0, 1.0 );
+
+    // Create estimated parameters (initial state of vehicle) and observation models (position of vehicle)
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back(
+                std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Vehicle", systemInitialState, "Earth" ) );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    LinkEnds linkEnds;
+    linkEnds[ observed_body ] = std::make_pair( "Vehicle", "" );
+    observation_models::ObservationSettingsMap observationSettingsMap;
+    observationSettingsMap.insert( std::make_pair( linkEnds, std::make_shared< ObservationSettings >(
+                                                       position_observable ) ) );
+
+    OrbitDeterminationManager< double, double > orbitDeterminationManager =
+            OrbitDeterminationManager< double, double >(
+                bodyMap, parametersToEstimate, observationSettingsMap, integratorSettings, propagatorSettings );
+
+    // Simulate observations, and split them into two consecutive batches
+    std::vector< double > observationTimes;
+    for( int i = 0; i < 200; i++ )
+    {
+        observationTimes.push_back( initialTime + 600.0 + static_cast< double >( i ) * 60.0 );
+    }
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    measurementSimulationInput[ position_observable ][ linkEnds ] = std::make_pair( observationTimes, observed_body );
+    PodInputDataType observationsAndTimes = simulateObservations< double, double >(
+                measurementSimulationInput, orbitDeterminationManager.getObservationSimulators( ) );
+
+    // Add noise to observations, so that the estimated state differs between batches
+    double positionNoise = 1.0;
+    std::function< double( ) > noiseFunction = createBoostContinuousRandomVariableGeneratorFunction(
+                normal_boost_distribution, { 0.0, positionNoise }, 0.0 );
+    ObservationVectorType& observations = observationsAndTimes[ position_observable ][ linkEnds ].first;
+    for( int i = 0; i < observations.rows( ); i++ )
+    {
+        observations( i ) += noiseFunction( );
+    }
+
+    int numberOfObservationsInFirstBatch = 100;
+    PodInputDataType firstBatchObservationsAndTimes;
+    PodInputDataType secondBatchObservationsAndTimes;
+    firstBatchObservationsAndTimes[ position_observable ][ linkEnds ] = std::make_pair(
+                observations.segment( 0, 3 * numberOfObservationsInFirstBatch ),
+                std::make_pair( std::vector< double >(
+                                    observationTimes.begin( ),
+                                    observationTimes.begin( ) + numberOfObservationsInFirstBatch ),
+                                observed_body ) );
+    secondBatchObservationsAndTimes[ position_observable ][ linkEnds ] = std::make_pair(
+                observations.segment( 3 * numberOfObservationsInFirstBatch,
+                                      observations.rows( ) - 3 * numberOfObservationsInFirstBatch ),
+                std::make_pair( std::vector< double >(
+                                    observationTimes.begin( ) + numberOfObservationsInFirstBatch,
+                                    observationTimes.end( ) ), observed_body ) );
+
+    // Define perturbation of initial estimate
+    Eigen::VectorXd truthParameters = parametersToEstimate->template getFullParameterValues< double >( );
+    Eigen::VectorXd parameterPerturbation = Eigen::VectorXd::Zero( 6 );
+    parameterPerturbation.segment( 0, 3 ) = Eigen::Vector3d::Constant( 10.0 );
+    parameterPerturbation.segment( 3, 3 ) = Eigen::Vector3d::Constant( 1.0E-2 );
+    double weight = 1.0 / ( positionNoise * positionNoise );
+
+    // Estimate parameters with all data in single batch
+    std::shared_ptr< PodInput< double, double > > fullPodInput = std::make_shared< PodInput< double, double > >(
+                observationsAndTimes, 6, Eigen::MatrixXd::Zero( 0, 0 ), parameterPerturbation );
+    fullPodInput->setConstantWeightsMatrix( weight );
+    fullPodInput->defineEstimationSettings( true, true, false, false, false );
+    std::shared_ptr< PodOutput< double > > fullPodOutput = orbitDeterminationManager.estimateParameters(
+                fullPodInput, std::make_shared< EstimationConvergenceChecker >( 4 ) );
+
+    // Estimate parameters sequentially: first batch from same initial estimate, then second batch from first estimate
+    parametersToEstimate->resetParameterValues( truthParameters );
+    std::shared_ptr< linear_algebra::SequentialNormalEquations > accumulatedNormalEquations =
+            std::make_shared< linear_algebra::SequentialNormalEquations >( truthParameters + parameterPerturbation );
+
+    std::shared_ptr< PodInput< double, double > > firstPodInput = std::make_shared< PodInput< double, double > >(
+                firstBatchObservationsAndTimes, 6, Eigen::MatrixXd::Zero( 0, 0 ), parameterPerturbation );
+    firstPodInput->setConstantWeightsMatrix( weight );
+    firstPodInput->defineEstimationSettings( true, true, false, false, false );
+    std::shared_ptr< PodOutput< double > > firstPodOutput = orbitDeterminationManager.estimateParametersSequentially(
+                firstPodInput, accumulatedNormalEquations, std::make_shared< EstimationConvergenceChecker >( 4 ) );
+
+    parametersToEstimate->resetParameterValues( firstPodOutput->parameterEstimate_ );
+    std::shared_ptr< PodInput< double, double > > secondPodInput = std::make_shared< PodInput< double, double > >(
+                secondBatchObservationsAndTimes, 6 );
+    secondPodInput->setConstantWeightsMatrix( weight );
+    secondPodInput->defineEstimationSettings( true, true, false, false, false );
+    std::shared_ptr< PodOutput< double > > secondPodOutput = orbitDeterminationManager.estimateParametersSequentially(
+                secondPodInput, accumulatedNormalEquations, std::make_shared< EstimationConvergenceChecker >( 4 ) );
+
+    BOOST_CHECK_EQUAL( accumulatedNormalEquations->getNumberOfProcessedObservations( ), observations.rows( ) );
+
+    // Check that the first batch alone gives a different solution, so that the comparison below is meaningful
+    Eigen::VectorXd fullFormalError = fullPodOutput->getFormalErrorVector( );
+    BOOST_CHECK( ( ( firstPodOutput->parameterEstimate_ - fullPodOutput->parameterEstimate_ ).cwiseQuotient(
+                       fullFormalError ) ).cwiseAbs( ).maxCoeff( ) > 1.0E-2 );
+
+    // The sequential solution differs from the single batch solution only through the linearization of the first batch
+    // at the first estimate, rather than at the final estimate. This difference is of second order in the (sub-formal
+    // error) difference between the two estimates, and must be well below the formal error.
+    Eigen::VectorXd sequentialEstimateDifference =
+            ( secondPodOutput->parameterEstimate_ - fullPodOutput->parameterEstimate_ ).cwiseQuotient( fullFormalError );
+    for( int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( sequentialEstimateDifference( i ), 1.0E-4 );
+    }
+
+    // Compare covariance, normalized by formal errors: the partials are evaluated at slightly different states
+    // (relative difference of order 1E-8), leading to similar relative differences in the covariance.
+    Eigen::MatrixXd fullCovariance = fullPodOutput->getUnnormalizedCovarianceMatrix( );
+    Eigen::MatrixXd sequentialCovariance = secondPodOutput->getUnnormalizedCovarianceMatrix( );
+    for( int i = 0; i < 6; i++ )
+    {
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_SMALL( ( sequentialCovariance( i, j ) - fullCovariance( i, j ) ) /
+                               ( fullFormalError( i ) * fullFormalError( j ) ), 1.0E-6 );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
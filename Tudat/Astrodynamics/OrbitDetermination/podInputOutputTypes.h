@@ -21,6 +21,7 @@
 
 #include "Tudat/Basics/timeType.h"
 #include "Tudat/Astrodynamics/ObservationModels/linkTypeDefs.h"
+#include "Tudat/Astrodynamics/ObservationModels/observationCollection.h"
 #include "Tudat/Astrodynamics/ObservationModels/observableTypes.h"
 
 namespace tudat
@@ -63,6 +64,7 @@ public:
             Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( 0, 1 ) ):
         observationsAndTimes_( observationsAndTimes ), initialParameterDeviationEstimate_( initialParameterDeviationEstimate ),
         inverseOfAprioriCovariance_( inverseOfAprioriCovariance ),
+        useObservationCollection_( false ),
         reintegrateEquationsOnFirstIteration_( true ),
         reintegrateVariationalEquations_( true ),
         saveInformationMatrix_( true ),
@@ -70,29 +72,47 @@ public:
         saveResidualsAndParametersFromEachIteration_( true ),
         saveStateHistoryForEachIteration_( false )
     {
-        if( inverseOfAprioriCovariance_.rows( ) == 0 )
-        {
-            inverseOfAprioriCovariance_ = Eigen::MatrixXd::Zero( numberOfEstimatedParameters, numberOfEstimatedParameters );
-        }
-
-        if( ( numberOfEstimatedParameters != inverseOfAprioriCovariance_.rows( ) ) ||
-                ( numberOfEstimatedParameters != inverseOfAprioriCovariance_.cols( ) ) )
-        {
-            throw std::runtime_error( "Error when making POD input, size of a priori covariance is inconsistent" );
-        }
-
-        if( initialParameterDeviationEstimate_.rows( ) == 0 )
-        {
-            initialParameterDeviationEstimate_ =
-                    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( numberOfEstimatedParameters, 1 );
-        }
+        checkAprioriSettings( numberOfEstimatedParameters );
+        setConstantWeightsMatrix( 1.0 );
+    }
 
-        if( numberOfEstimatedParameters != initialParameterDeviationEstimate_.rows( ) )
+    //! Constructor from flat observation collection
+    /*!
+     * Constructor from flat observation collection, the observations and weights in the collection are used as the
+     * observations and weights of the estimation. The collection is retained, and used directly in the estimation (see
+     * getObservationCollection), without conversion to the nested map format. The weights set through this object are
+     * set in the collection, so it is modified by these functions. The collection is converted to map format only if the
+     * observations or weights are requested in that format (see getObservationsAndTimes and getWeightsMatrixDiagonals),
+     * after which the map format is used.
+     * \param observationCollection Observations, with associated times/link ends/type and weights
+     * \param numberOfEstimatedParameters Size of vector of estimated parameters
+     * \param inverseOfAprioriCovariance A priori covariance matrix (unnormalized) of estimated parameters. None (matrix of
+     * size 0) by default
+     * \param initialParameterDeviationEstimate Correction to estimated parameter vector to be applied on first iteration.
+     * None (vector of size 0) by default
+     */
+    PodInput( const std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+              observationCollection,
+              const int numberOfEstimatedParameters,
+              const Eigen::MatrixXd inverseOfAprioriCovariance = Eigen::MatrixXd::Zero( 0, 0 ),
+              const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > initialParameterDeviationEstimate =
+            Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( 0, 1 ) ):
+        initialParameterDeviationEstimate_( initialParameterDeviationEstimate ),
+        inverseOfAprioriCovariance_( inverseOfAprioriCovariance ),
+        observationCollection_( observationCollection ),
+        useObservationCollection_( true ),
+        reintegrateEquationsOnFirstIteration_( true ),
+        reintegrateVariationalEquations_( true ),
+        saveInformationMatrix_( true ),
+        printOutput_( true ),
+        saveResidualsAndParametersFromEachIteration_( true ),
+        saveStateHistoryForEachIteration_( false )
+    {
+        if( observationCollection_ == nullptr )
         {
-            throw std::runtime_error( "Error when making POD input, size of initial parameter deviation is inconsistent" );
+            throw std::runtime_error( "Error when making POD input, no observation collection provided" );
         }
-
-        setConstantWeightsMatrix( 1.0 );
+        checkAprioriSettings( numberOfEstimatedParameters );
     }
 
     //! Destructor
@@ -105,6 +125,12 @@ public:
      */
     void setConstantWeightsMatrix( const double constantWeight = 1.0 )
     {
+        if( useObservationCollection_ )
+        {
+            observationCollection_->setConstantWeight( constantWeight );
+            return;
+        }
+
         std::map< observation_models::ObservableType,
                 std::map< observation_models::LinkEnds, double > > weightPerObservableAndLinkEnds;
         for( typename PodInputDataType::const_iterator observablesIterator = observationsAndTimes_.begin( );
@@ -127,6 +153,23 @@ public:
     void setConstantPerObservableWeightsMatrix(
             const std::map< observation_models::ObservableType, double > weightPerObservable )
     {
+        if( useObservationCollection_ )
+        {
+            const std::vector< observation_models::ObservationSetIndices >& observationSets =
+                    observationCollection_->getObservationSets( );
+            for( unsigned int i = 0; i < observationSets.size( ); i++ )
+            {
+                if( weightPerObservable.count( observationSets.at( i ).observableType_ ) != 0 )
+                {
+                    observationCollection_->setConstantWeight(
+                                observationSets.at( i ).observableType_,
+                                observationCollection_->getLinkEnds( observationSets.at( i ).linkEndsId_ ),
+                                weightPerObservable.at( observationSets.at( i ).observableType_ ) );
+                }
+            }
+            return;
+        }
+
         std::map< observation_models::ObservableType,
                 std::map< observation_models::LinkEnds, double > > weightPerObservableAndLinkEnds;
         for( typename PodInputDataType::const_iterator observablesIterator = observationsAndTimes_.begin( );
@@ -154,6 +197,38 @@ public:
             const std::map< observation_models::ObservableType,
             std::map< observation_models::LinkEnds, double > > weightPerObservableAndLinkEnds )
     {
+        if( useObservationCollection_ )
+        {
+            // Check that weights are provided for all observation sets, before modifying any weights
+            const std::vector< observation_models::ObservationSetIndices >& observationSets =
+                    observationCollection_->getObservationSets( );
+            for( unsigned int i = 0; i < observationSets.size( ); i++ )
+            {
+                if( weightPerObservableAndLinkEnds.count( observationSets.at( i ).observableType_ ) == 0 )
+                {
+                    throw std::runtime_error( "Error when setting  weights per observable, observable " +
+                                              std::to_string( observationSets.at( i ).observableType_ ) + " not found" );
+                }
+                else if( weightPerObservableAndLinkEnds.at( observationSets.at( i ).observableType_ ).count(
+                             observationCollection_->getLinkEnds( observationSets.at( i ).linkEndsId_ ) ) == 0 )
+                {
+                    throw std::runtime_error( "Error when setting  weights per observable, link ends not found for observable " +
+                                              std::to_string( observationSets.at( i ).observableType_ ) );
+                }
+            }
+
+            for( unsigned int i = 0; i < observationSets.size( ); i++ )
+            {
+                const observation_models::LinkEnds& currentLinkEnds =
+                        observationCollection_->getLinkEnds( observationSets.at( i ).linkEndsId_ );
+                observationCollection_->setConstantWeight(
+                            observationSets.at( i ).observableType_, currentLinkEnds,
+                            weightPerObservableAndLinkEnds.at( observationSets.at( i ).observableType_ ).at( currentLinkEnds ) );
+            }
+            return;
+        }
+
+        observationCollection_ = nullptr;
         for( typename PodInputDataType::const_iterator observablesIterator = observationsAndTimes_.begin( );
              observablesIterator != observationsAndTimes_.end( ); observablesIterator++ )
         {
@@ -219,14 +294,40 @@ public:
 
     //! Function to return the total data structure of observations and associated times/link ends/type (by reference)
     /*!
-     * Function to return the total data structure of observations and associated times/link ends/type (by reference)
+     * Function to return the total data structure of observations and associated times/link ends/type (by reference).
+     * Since the returned data may be modified, the flat observation collection is recreated on the next call to
+     * getObservationCollection. If this object was created from an observation collection, the observations and weights
+     * are converted to map format on the first call, and the map format is used from then on.
      * \return Total data structure of observations and associated times/link ends/type (by reference)
      */
     PodInputDataType& getObservationsAndTimes( )
     {
+        convertObservationCollectionToMapFormat( );
+        observationCollection_ = nullptr;
         return observationsAndTimes_;
     }
 
+    //! Function to retrieve the flat observation collection of the observations and weights
+    /*!
+     * Function to retrieve the flat observation collection of the observations and weights, with the rows ordered in the
+     * same manner as the concatenated observations/weights vectors used in the estimation. If this object was created
+     * from a collection, that collection is returned. Otherwise, the collection is created from the observations and
+     * weights on the first call, and is reused on subsequent calls, until the observations or weights are modified
+     * through this object.
+     * \return Flat observation collection of current observations and weights
+     */
+    std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+    getObservationCollection( )
+    {
+        if( observationCollection_ == nullptr )
+        {
+            observationCollection_ =
+                    std::make_shared< observation_models::ObservationCollection< ObservationScalarType, TimeType > >(
+                        observationsAndTimes_, weightsMatrixDiagonals_ );
+        }
+        return observationCollection_;
+    }
+
     //! Function to return the correction to estimated parameter vector to be applied on first iteration
     /*!
      * Function to return the correction to estimated parameter vector to be applied on first iteration
@@ -250,12 +351,17 @@ public:
 
     //! Function to return the weight matrix diagonals, sorted by link ends and observable type (by reference)
     /*!
-     * Function to return the weight matrix diagonals, sorted by link ends and observable type (by reference)
+     * Function to return the weight matrix diagonals, sorted by link ends and observable type (by reference).
+     * Since the returned data may be modified, the flat observation collection is recreated on the next call to
+     * getObservationCollection. If this object was created from an observation collection, the observations and weights
+     * are converted to map format on the first call, and the map format is used from then on.
      * \return Weight matrix diagonals, sorted by link ends and observable type (by reference)
      */
     std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, Eigen::VectorXd > >&
     getWeightsMatrixDiagonals( )
     {
+        convertObservationCollectionToMapFormat( );
+        observationCollection_ = nullptr;
         return weightsMatrixDiagonals_;
     }
 
@@ -321,6 +427,49 @@ public:
     }
 
 private:
+
+    //! Function to check the size of the a priori covariance and initial parameter deviation, and set default values
+    /*!
+     * Function to check the size of the a priori covariance and initial parameter deviation, and set default values
+     * (zero) if they are empty.
+     * \param numberOfEstimatedParameters Size of vector of estimated parameters
+     */
+    void checkAprioriSettings( const int numberOfEstimatedParameters )
+    {
+        if( inverseOfAprioriCovariance_.rows( ) == 0 )
+        {
+            inverseOfAprioriCovariance_ = Eigen::MatrixXd::Zero( numberOfEstimatedParameters, numberOfEstimatedParameters );
+        }
+
+        if( ( numberOfEstimatedParameters != inverseOfAprioriCovariance_.rows( ) ) ||
+                ( numberOfEstimatedParameters != inverseOfAprioriCovariance_.cols( ) ) )
+        {
+            throw std::runtime_error( "Error when making POD input, size of a priori covariance is inconsistent" );
+        }
+
+        if( initialParameterDeviationEstimate_.rows( ) == 0 )
+        {
+            initialParameterDeviationEstimate_ =
+                    Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( numberOfEstimatedParameters, 1 );
+        }
+
+        if( numberOfEstimatedParameters != initialParameterDeviationEstimate_.rows( ) )
+        {
+            throw std::runtime_error( "Error when making POD input, size of initial parameter deviation is inconsistent" );
+        }
+    }
+
+    //! Function to convert the observation collection to map format, if this object was created from a collection.
+    void convertObservationCollectionToMapFormat( )
+    {
+        if( useObservationCollection_ )
+        {
+            observationsAndTimes_ = observationCollection_->getObservationsMap( );
+            weightsMatrixDiagonals_ = observationCollection_->getWeightsMap( );
+            useObservationCollection_ = false;
+        }
+    }
+
     //! Total data structure of observations and associated times/link ends/type
     PodInputDataType observationsAndTimes_;
 
@@ -334,6 +483,13 @@ private:
     std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, Eigen::VectorXd > >
     weightsMatrixDiagonals_;
 
+    //! Flat observation collection of observations and weights (nullptr if not yet created, or no longer up to date)
+    std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+    observationCollection_;
+
+    //! Boolean denoting whether the observation collection (rather than the map format) holds the observations and weights
+    bool useObservationCollection_;
+
     //!  Boolean denoting whether the dynamics and variational equations are to be reintegrated on first iteration
     bool reintegrateEquationsOnFirstIteration_;
 
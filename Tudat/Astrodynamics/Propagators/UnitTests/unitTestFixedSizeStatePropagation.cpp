@@ -0,0 +1,133 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_fixed_size_state_propagation )
+
+// Test propagation with fixed-size state vector, for propagators with 6 and 7 propagated state elements.
+BOOST_AUTO_TEST_CASE( testFixedSizeStatePropagation )
+{
+    using namespace tudat;
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+    using namespace orbital_element_conversions;
+
+    // Load Spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Set simulation time settings.
+    const double simulationStartEpoch = 0.0;
+    const double simulationEndEpoch = tudat::physical_constants::JULIAN_DAY;
+
+    // Create body objects.
+    std::vector< std::string > bodiesToCreate;
+    bodiesToCreate.push_back( "Sun" );
+    bodiesToCreate.push_back( "Earth" );
+    bodiesToCreate.push_back( "Moon" );
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodiesToCreate, simulationStartEpoch - 300.0, simulationEndEpoch + 300.0 );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< simulation_setup::Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                            std::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Eigen::Vector6d  > >( ), "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Define accelerations
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< SphericalHarmonicAccelerationSettings >( 5, 5 ) );
+    accelerationMap[ "Vehicle" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >(
+                                                         basic_astrodynamics::central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >(
+                                                          basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    // Set initial state
+    Eigen::Vector6d vehicleInitialStateInKeplerianElements;
+    vehicleInitialStateInKeplerianElements << 8000.0E3, 0.1, 1.3, 4.1, 0.4, 2.4;
+    const Eigen::Vector6d vehicleInitialState = convertKeplerianToCartesianElements(
+                vehicleInitialStateInKeplerianElements,
+                bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+    // Test propagators with 6 and 7 propagated state elements, for fixed and variable step size integrator
+    std::vector< TranslationalPropagatorType > propagatorTypes =
+    { cowell, gauss_keplerian, unified_state_model_quaternions, unified_state_model_exponential_map };
+    for( unsigned int i = 0; i < propagatorTypes.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            std::shared_ptr< IntegratorSettings< > > integratorSettings;
+            if( j == 0 )
+            {
+                integratorSettings = std::make_shared< IntegratorSettings< > >( rungeKutta4, simulationStartEpoch, 10.0 );
+            }
+            else
+            {
+                integratorSettings = std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< > >(
+                            simulationStartEpoch, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                            1.0E-3, 1.0E3, 1.0E-12, 1.0E-12 );
+            }
+
+            // Propagate with dynamic-size and fixed-size state
+            std::vector< std::map< double, Eigen::VectorXd > > numericalSolutions;
+            for( unsigned int k = 0; k < 2; k++ )
+            {
+                std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                        std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                            centralBodies, accelerationModelMap, bodiesToPropagate, vehicleInitialState,
+                            simulationEndEpoch, propagatorTypes.at( i ) );
+                propagatorSettings->useFixedSizeState_ = ( k == 1 );
+
+                SingleArcDynamicsSimulator< double > dynamicsSimulator(
+                            bodyMap, integratorSettings, propagatorSettings, true, false, false );
+                numericalSolutions.push_back( dynamicsSimulator.getEquationsOfMotionNumericalSolution( ) );
+            }
+
+            // Check that both propagations give the same results
+            BOOST_CHECK_EQUAL( numericalSolutions.at( 0 ).size( ), numericalSolutions.at( 1 ).size( ) );
+            std::map< double, Eigen::VectorXd >::const_iterator fixedSizeIterator = numericalSolutions.at( 1 ).begin( );
+            for( std::map< double, Eigen::VectorXd >::const_iterator dynamicSizeIterator = numericalSolutions.at( 0 ).begin( );
+                 dynamicSizeIterator != numericalSolutions.at( 0 ).end( ); dynamicSizeIterator++, fixedSizeIterator++ )
+            {
+                BOOST_CHECK_EQUAL( dynamicSizeIterator->first, fixedSizeIterator->first );
+                for( int l = 0; l < 3; l++ )
+                {
+                    BOOST_CHECK_SMALL( std::fabs( dynamicSizeIterator->second( l ) - fixedSizeIterator->second( l ) ), 1.0E-6 );
+                    BOOST_CHECK_SMALL( std::fabs( dynamicSizeIterator->second( l + 3 ) - fixedSizeIterator->second( l + 3 ) ), 1.0E-9 );
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,660 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <iterator>
+#include <limits>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Gravitation/centralGravityModel.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Astrodynamics/Propagators/multiRateAccelerationEvaluator.h"
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/defaultBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::basic_astrodynamics;
+
+//! Acceleration model with analytical time dependency, counting the number of evaluations.
+class AnalyticalTestAccelerationModel: public AccelerationModel3d
+{
+public:
+
+    AnalyticalTestAccelerationModel( const std::function< Eigen::Vector3d( const double ) > accelerationFunction ):
+        accelerationFunction_( accelerationFunction ), numberOfEvaluations_( 0 ){ }
+
+    Eigen::Vector3d getAcceleration( )
+    {
+        return currentAcceleration_;
+    }
+
+    void updateMembers( const double currentTime = TUDAT_NAN )
+    {
+        if( !( currentTime_ == currentTime ) )
+        {
+            currentAcceleration_ = accelerationFunction_( currentTime );
+            currentTime_ = currentTime;
+            numberOfEvaluations_++;
+        }
+    }
+
+    int getNumberOfEvaluations( )
+    {
+        return numberOfEvaluations_;
+    }
+
+private:
+
+    std::function< Eigen::Vector3d( const double ) > accelerationFunction_;
+
+    Eigen::Vector3d currentAcceleration_;
+
+    int numberOfEvaluations_;
+};
+
+BOOST_AUTO_TEST_SUITE( test_multi_rate_acceleration_evaluator )
+
+//! Test held and linearly extrapolated approximations, using accelerations with linear time dependency.
+BOOST_AUTO_TEST_CASE( testMultiRateAccelerationApproximation )
+{
+    std::function< Eigen::Vector3d( const double ) > linearAccelerationFunction =
+            [ ]( const double time ) -> Eigen::Vector3d { return ( Eigen::Vector3d( ) << 1.0E-3, -2.0E-3, 5.0E-4 ).finished( ) +
+                time * ( Eigen::Vector3d( ) << 1.0E-6, 3.0E-6, -2.0E-6 ).finished( ); };
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        SlowAccelerationApproximationType approximationType =
+                ( test == 0 ) ? held_slow_acceleration : linearly_extrapolated_slow_acceleration;
+        std::shared_ptr< AnalyticalTestAccelerationModel > slowAcceleration =
+                std::make_shared< AnalyticalTestAccelerationModel >( linearAccelerationFunction );
+
+        MultiRateAccelerationEvaluator multiRateEvaluator(
+        { slowAcceleration }, { nullptr },
+                    std::make_shared< MultiRateAccelerationSettings >(
+                        std::vector< AvailableAcceleration >( ), 60.0, TUDAT_NAN, TUDAT_NAN, TUDAT_NAN,
+                        approximationType ) );
+
+        BOOST_CHECK_EQUAL( multiRateEvaluator.getSlowAccelerationIndex( slowAcceleration ), 0 );
+        BOOST_CHECK_EQUAL( multiRateEvaluator.getSlowAccelerationIndex(
+                               std::make_shared< AnalyticalTestAccelerationModel >( linearAccelerationFunction ) ), -1 );
+
+        // Evaluate at 10 s time steps, full evaluations should be performed every 60 s.
+        double lastFullEvaluationTime = TUDAT_NAN;
+        for( int i = 0; i <= 120; i++ )
+        {
+            double currentTime = 10.0 * static_cast< double >( i );
+            multiRateEvaluator.updateAccelerations( currentTime );
+
+            if( i % 6 == 0 )
+            {
+                lastFullEvaluationTime = currentTime;
+            }
+
+            BOOST_CHECK_EQUAL( slowAcceleration->getNumberOfEvaluations( ), i / 6 + 1 );
+            BOOST_CHECK_EQUAL( multiRateEvaluator.getNumberOfFullEvaluations( ), i / 6 + 1 );
+
+            Eigen::Vector3d expectedAcceleration;
+            if( approximationType == held_slow_acceleration || i < 6 )
+            {
+                expectedAcceleration = linearAccelerationFunction( lastFullEvaluationTime );
+            }
+            else
+            {
+                // Linear extrapolation of linear function is exact.
+                expectedAcceleration = linearAccelerationFunction( currentTime );
+            }
+
+            for( unsigned int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( multiRateEvaluator.getAcceleration( 0 )( j ) - expectedAcceleration( j ) ),
+                                   1.0E-15 );
+            }
+        }
+
+        // Check that reset forces a full evaluation.
+        multiRateEvaluator.reset( );
+        BOOST_CHECK_EQUAL( multiRateEvaluator.getNumberOfFullEvaluations( ), 0 );
+        multiRateEvaluator.updateAccelerations( 1201.0 );
+        BOOST_CHECK_EQUAL( multiRateEvaluator.getNumberOfFullEvaluations( ), 1 );
+        BOOST_CHECK_EQUAL( slowAcceleration->getNumberOfEvaluations( ), 22 );
+    }
+}
+
+//! Test restriction of full evaluations to accepted states.
+BOOST_AUTO_TEST_CASE( testMultiRateAccelerationUpdateAtAcceptedStates )
+{
+    std::function< Eigen::Vector3d( const double ) > linearAccelerationFunction =
+            [ ]( const double time ) -> Eigen::Vector3d { return Eigen::Vector3d::UnitZ( ) * ( 1.0E-3 + 1.0E-6 * time ); };
+    std::shared_ptr< AnalyticalTestAccelerationModel > slowAcceleration =
+            std::make_shared< AnalyticalTestAccelerationModel >( linearAccelerationFunction );
+
+    MultiRateAccelerationEvaluator multiRateEvaluator(
+    { slowAcceleration }, { nullptr },
+                std::make_shared< MultiRateAccelerationSettings >(
+                    std::vector< AvailableAcceleration >( ), 60.0, TUDAT_NAN, TUDAT_NAN, TUDAT_NAN,
+                    held_slow_acceleration ) );
+    multiRateEvaluator.setUpdateAtAcceptedStatesOnly( true );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getUpdateAtAcceptedStatesOnly( ), true );
+
+    // First evaluation is always full, even if state is not accepted.
+    BOOST_CHECK_EQUAL( multiRateEvaluator.isFullEvaluationDue( 0.0 ), true );
+    multiRateEvaluator.updateAccelerations( 0.0 );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getNumberOfFullEvaluations( ), 1 );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.isFullEvaluationDue( 30.0 ), false );
+
+    // Evaluations at non-accepted states (e.g. intermediate stages) do not trigger full evaluation.
+    BOOST_CHECK_EQUAL( multiRateEvaluator.isFullEvaluationDue( 90.0 ), true );
+    multiRateEvaluator.updateAccelerations( 90.0 );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getNumberOfFullEvaluations( ), 1 );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getAcceleration( 0 )( 2 ), linearAccelerationFunction( 0.0 )( 2 ) );
+
+    // Evaluation at accepted state triggers full evaluation.
+    multiRateEvaluator.setIsCurrentStateAccepted( true );
+    multiRateEvaluator.updateAccelerations( 70.0 );
+    multiRateEvaluator.setIsCurrentStateAccepted( false );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getNumberOfFullEvaluations( ), 2 );
+    BOOST_CHECK_EQUAL( slowAcceleration->getNumberOfEvaluations( ), 2 );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getAcceleration( 0 )( 2 ), linearAccelerationFunction( 70.0 )( 2 ) );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.isFullEvaluationDue( 90.0 ), false );
+
+    // Signalled accepted step triggers full evaluation at the next call only, if due.
+    BOOST_CHECK_EQUAL( multiRateEvaluator.isFullEvaluationToBePerformed( 140.0 ), false );
+    multiRateEvaluator.signalAcceptedStep( );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.isFullEvaluationToBePerformed( 100.0 ), false );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.isFullEvaluationToBePerformed( 140.0 ), true );
+    multiRateEvaluator.updateAccelerations( 140.0 );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getNumberOfFullEvaluations( ), 3 );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getAcceleration( 0 )( 2 ), linearAccelerationFunction( 140.0 )( 2 ) );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.isFullEvaluationToBePerformed( 210.0 ), false );
+    multiRateEvaluator.updateAccelerations( 210.0 );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getNumberOfFullEvaluations( ), 3 );
+
+    // Check that first evaluation after reset is full.
+    multiRateEvaluator.reset( );
+    multiRateEvaluator.updateAccelerations( 100.0 );
+    BOOST_CHECK_EQUAL( multiRateEvaluator.getNumberOfFullEvaluations( ), 1 );
+}
+
+//! Test adaptation of update interval from residual tolerance.
+BOOST_AUTO_TEST_CASE( testMultiRateAccelerationIntervalAdaptation )
+{
+    // Define acceleration with quadratic time dependency, so that linear extrapolation error scales with interval squared
+    std::function< Eigen::Vector3d( const double ) > quadraticAccelerationFunction =
+            [ ]( const double time ) -> Eigen::Vector3d { return Eigen::Vector3d::UnitX( ) * 1.0E-8 * time * time; };
+
+    std::shared_ptr< AnalyticalTestAccelerationModel > slowAcceleration =
+            std::make_shared< AnalyticalTestAccelerationModel >( quadraticAccelerationFunction );
+
+    MultiRateAccelerationEvaluator multiRateEvaluator(
+    { slowAcceleration }, { nullptr },
+                std::make_shared< MultiRateAccelerationSettings >(
+                    std::vector< AvailableAcceleration >( ), 100.0, 1.0E-6, 1.0, 400.0,
+                    linearly_extrapolated_slow_acceleration ) );
+
+    // Extrapolation error for update interval dt is 2.0E-8 * dt^2, so interval should converge to value with error
+    // between 1.0E-7 and 1.0E-6
+    for( int i = 0; i <= 10000; i++ )
+    {
+        multiRateEvaluator.updateAccelerations( static_cast< double >( i ) );
+    }
+    double finalUpdateInterval = multiRateEvaluator.getUpdateIntervals( ).at( 0 );
+    BOOST_CHECK_EQUAL( finalUpdateInterval < 100.0, true );
+    BOOST_CHECK_EQUAL( finalUpdateInterval >= 1.0, true );
+    BOOST_CHECK_EQUAL( 2.0E-8 * finalUpdateInterval * finalUpdateInterval <= 1.0E-6, true );
+    BOOST_CHECK_EQUAL( 2.0E-8 * 4.0 * finalUpdateInterval * finalUpdateInterval > 1.0E-7, true );
+
+    // Check that interval grows to maximum value if acceleration is linear.
+    std::shared_ptr< AnalyticalTestAccelerationModel > linearAcceleration =
+            std::make_shared< AnalyticalTestAccelerationModel >(
+                [ ]( const double time ) -> Eigen::Vector3d { return Eigen::Vector3d::UnitY( ) * 1.0E-6 * time; } );
+    MultiRateAccelerationEvaluator linearMultiRateEvaluator(
+    { linearAcceleration }, { nullptr },
+                std::make_shared< MultiRateAccelerationSettings >(
+                    std::vector< AvailableAcceleration >( ), 100.0, 1.0E-6, 1.0, 400.0 ) );
+    for( int i = 0; i <= 2000; i++ )
+    {
+        linearMultiRateEvaluator.updateAccelerations( static_cast< double >( i ) );
+    }
+    BOOST_CHECK_CLOSE_FRACTION( linearMultiRateEvaluator.getUpdateIntervals( ).at( 0 ), 400.0,
+                                std::numeric_limits< double >::epsilon( ) );
+}
+
+//! Test multi-rate evaluation of spherical harmonic gravity, with low-degree terms evaluated at each call.
+BOOST_AUTO_TEST_CASE( testMultiRateSphericalHarmonicAcceleration )
+{
+    using namespace gravitation;
+
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+
+    // Define degree 6 gravity field.
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 7, 7 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 7, 7 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84165E-4;
+    cosineCoefficients( 2, 2 ) = 2.43938E-6;
+    sineCoefficients( 2, 2 ) = -1.40027E-6;
+    cosineCoefficients( 3, 0 ) = 9.57161E-7;
+    cosineCoefficients( 3, 1 ) = 2.03046E-6;
+    sineCoefficients( 3, 1 ) = 2.48200E-7;
+    cosineCoefficients( 4, 0 ) = 5.39966E-7;
+    cosineCoefficients( 4, 4 ) = -3.95233E-7;
+    sineCoefficients( 4, 4 ) = 3.08868E-7;
+    cosineCoefficients( 5, 3 ) = -4.51955E-7;
+    cosineCoefficients( 6, 2 ) = 4.81737E-8;
+
+    // Define circular, inclined orbit as state of body undergoing acceleration.
+    double currentTime = 0.0;
+    const double orbitRadius = 7000.0E3;
+    const double meanMotion = std::sqrt( gravitationalParameter / std::pow( orbitRadius, 3 ) );
+    std::function< Eigen::Vector3d( ) > positionFunction = [ & ]( ) -> Eigen::Vector3d
+    {
+        return ( Eigen::Vector3d( ) << std::cos( meanMotion * currentTime ),
+                 0.6 * std::sin( meanMotion * currentTime ),
+                 0.8 * std::sin( meanMotion * currentTime ) ).finished( ) * orbitRadius;
+    };
+
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > sphericalHarmonicAcceleration =
+            std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                positionFunction, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients );
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > referenceAcceleration =
+            std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                positionFunction, gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients );
+    std::shared_ptr< CentralGravitationalAccelerationModel3d > pointMassAcceleration =
+            std::make_shared< CentralGravitationalAccelerationModel3d >(
+                positionFunction, 1.0E3, [ ]( ){ return Eigen::Vector3d::Zero( ); } );
+
+    std::vector< std::shared_ptr< AccelerationModel3d > > accelerationModelList =
+    { pointMassAcceleration, sphericalHarmonicAcceleration };
+
+    // Compare multi-rate evaluation with and without low-degree terms evaluated at each call.
+    const double updateInterval = 120.0;
+    double maximumErrorWithoutFastTerms = 0.0;
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        std::vector< int > slowAccelerationIndices;
+        std::shared_ptr< MultiRateAccelerationEvaluator > multiRateEvaluator =
+                createMultiRateAccelerationEvaluator(
+                    accelerationModelList, std::make_shared< MultiRateAccelerationSettings >(
+                        std::vector< AvailableAcceleration >( { spherical_harmonic_gravity } ), updateInterval,
+                        TUDAT_NAN, TUDAT_NAN, TUDAT_NAN, held_slow_acceleration, ( test == 0 ) ? -1 : 2, 0 ),
+                    slowAccelerationIndices );
+
+        BOOST_CHECK_EQUAL( slowAccelerationIndices.size( ), 2 );
+        BOOST_CHECK_EQUAL( slowAccelerationIndices.at( 0 ), -1 );
+        BOOST_CHECK_EQUAL( slowAccelerationIndices.at( 1 ), 0 );
+
+        double maximumError = 0.0;
+        for( int i = 0; i <= 600; i++ )
+        {
+            currentTime = 5.0 * static_cast< double >( i );
+            multiRateEvaluator->updateAccelerations( currentTime );
+            referenceAcceleration->updateMembers( currentTime );
+
+            double currentError =
+                    ( multiRateEvaluator->getAcceleration( 0 ) - referenceAcceleration->getAcceleration( ) ).norm( );
+
+            // Check that full evaluations reproduce full acceleration
+            if( i % 24 == 0 )
+            {
+                BOOST_CHECK_SMALL( currentError, 1.0E-14 * referenceAcceleration->getAcceleration( ).norm( ) );
+            }
+            maximumError = std::max( maximumError, currentError );
+        }
+        BOOST_CHECK_EQUAL( multiRateEvaluator->getNumberOfFullEvaluations( ), 26 );
+
+        if( test == 0 )
+        {
+            maximumErrorWithoutFastTerms = maximumError;
+
+            // Holding full point-mass acceleration over 115 s yields error of order 1 m/s^2.
+            BOOST_CHECK_EQUAL( maximumErrorWithoutFastTerms > 0.1, true );
+        }
+        else
+        {
+            // Holding only terms above J2 should reduce error by several orders of magnitude.
+            BOOST_CHECK_SMALL( maximumError, 1.0E-4 );
+            BOOST_CHECK_EQUAL( maximumError < 1.0E-4 * maximumErrorWithoutFastTerms, true );
+        }
+    }
+}
+
+//! Function to propagate an orbit about a body with a spherical harmonic gravity field, with or without multi-rate evaluation.
+/*!
+ *  Function to propagate an orbit about a body with a spherical harmonic gravity field, with or without multi-rate
+ *  evaluation, through the dynamics simulator.
+ *  \param multiRateAccelerationSettings Settings for multi-rate evaluation (nullptr for single-rate propagation).
+ *  \param integratorSettings Settings for the numerical integrator.
+ *  \param useFixedSizeState Boolean denoting whether the fixed-size state propagation is to be used.
+ *  \param numberOfFullEvaluations Number of full evaluations of the slow accelerations (returned by reference).
+ *  \param numberOfFunctionEvaluations Number of state derivative evaluations (returned by reference).
+ *  \param maximumApproximationError Maximum difference between approximated and fully evaluated slow acceleration, over
+ *  all slow accelerations (returned by reference).
+ *  \param propagationProfiler Profiler that is to be used in the propagation (nullptr if none).
+ *  \param addThirdBodyAcceleration Boolean denoting whether a point-mass third-body acceleration of the Moon is to be
+ *  added to the accelerations.
+ *  \return Propagated state history.
+ */
+std::map< double, Eigen::VectorXd > propagateSphericalHarmonicOrbit(
+        const std::shared_ptr< MultiRateAccelerationSettings > multiRateAccelerationSettings,
+        const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
+        const bool useFixedSizeState,
+        int& numberOfFullEvaluations,
+        int& numberOfFunctionEvaluations,
+        double& maximumApproximationError,
+        const std::shared_ptr< PropagationProfiler > propagationProfiler = nullptr,
+        const bool addThirdBodyAcceleration = false )
+{
+    using namespace simulation_setup;
+
+    // Define degree 6 gravity field.
+    Eigen::MatrixXd cosineCoefficients = Eigen::MatrixXd::Zero( 7, 7 );
+    Eigen::MatrixXd sineCoefficients = Eigen::MatrixXd::Zero( 7, 7 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    cosineCoefficients( 2, 0 ) = -4.84165E-4;
+    cosineCoefficients( 2, 2 ) = 2.43938E-6;
+    sineCoefficients( 2, 2 ) = -1.40027E-6;
+    cosineCoefficients( 3, 0 ) = 9.57161E-7;
+    cosineCoefficients( 3, 1 ) = 2.03046E-6;
+    sineCoefficients( 3, 1 ) = 2.48200E-7;
+    cosineCoefficients( 4, 0 ) = 5.39966E-7;
+    cosineCoefficients( 4, 4 ) = -3.95233E-7;
+    sineCoefficients( 4, 4 ) = 3.08868E-7;
+    cosineCoefficients( 5, 3 ) = -4.51955E-7;
+    cosineCoefficients( 6, 2 ) = 4.81737E-8;
+
+    // Create rotating central body with spherical harmonic gravity field, (optionally) a point-mass Moon, and vehicle.
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "J2000" );
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< SphericalHarmonicsGravityFieldSettings >(
+                3.986004418E14, 6378137.0, cosineCoefficients, sineCoefficients, "IAU_Earth" );
+    bodySettings[ "Earth" ]->rotationModelSettings = std::make_shared< SimpleRotationModelSettings >(
+                "J2000", "IAU_Earth", Eigen::Quaterniond::Identity( ), 0.0, 7.292115E-5 );
+    if( addThirdBodyAcceleration )
+    {
+        Eigen::Vector6d moonState = Eigen::Vector6d::Zero( );
+        moonState( 0 ) = 384400.0E3;
+        bodySettings[ "Moon" ] = std::make_shared< BodySettings >( );
+        bodySettings[ "Moon" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                    moonState, "SSB", "J2000" );
+        bodySettings[ "Moon" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >( 4.9028E12 );
+    }
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+
+    // Create accelerations
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< SphericalHarmonicAccelerationSettings >( 6, 6 ) );
+    if( addThirdBodyAcceleration )
+    {
+        accelerationSettingsMap[ "Vehicle" ][ "Moon" ].push_back(
+                    std::make_shared< AccelerationSettings >( central_gravity ) );
+    }
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettingsMap, bodiesToPropagate, centralBodies );
+
+    // Define inclined, eccentric low Earth orbit.
+    Eigen::Vector6d initialState;
+    initialState << 7000.0E3, 0.0, 0.0, 0.0, 4.5E3, 6.0E3;
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState,
+                std::make_shared< PropagationTimeTerminationSettings >( 7200.0, true ) );
+    propagatorSettings->multiRateAccelerationSettings_ = multiRateAccelerationSettings;
+    propagatorSettings->useFixedSizeState_ = useFixedSizeState;
+
+    SingleArcDynamicsSimulator< double, double > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false );
+
+    std::shared_ptr< NBodyStateDerivative< double, double > > translationalStateDerivative =
+            std::dynamic_pointer_cast< NBodyStateDerivative< double, double > >(
+                dynamicsSimulator.getDynamicsStateDerivative( )->getStateDerivativeModels( ).at( translational_state ).at( 0 ) );
+
+    // Set profiler before (re)setting multi-rate settings, so that profiling indices have to be updated.
+    if( propagationProfiler != nullptr )
+    {
+        dynamicsSimulator.setPropagationProfiler( propagationProfiler );
+        translationalStateDerivative->setMultiRateAccelerationSettings( multiRateAccelerationSettings );
+    }
+
+    dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+    numberOfFunctionEvaluations = dynamicsSimulator.getDynamicsStateDerivative( )->getNumberOfFunctionEvaluations( );
+
+    std::shared_ptr< MultiRateAccelerationEvaluator > multiRateAccelerationEvaluator =
+            translationalStateDerivative->getMultiRateAccelerationEvaluator( );
+    numberOfFullEvaluations = 0;
+    maximumApproximationError = 0.0;
+    if( multiRateAccelerationEvaluator != nullptr )
+    {
+        numberOfFullEvaluations = multiRateAccelerationEvaluator->getNumberOfFullEvaluations( );
+        std::vector< double > maximumApproximationErrors = multiRateAccelerationEvaluator->getMaximumApproximationErrors( );
+        for( unsigned int i = 0; i < maximumApproximationErrors.size( ); i++ )
+        {
+            maximumApproximationError = std::max( maximumApproximationError, maximumApproximationErrors.at( i ) );
+        }
+    }
+
+    return dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+}
+
+//! Function to interpolate a state history onto fixed output epochs.
+/*!
+ *  Function to interpolate a state history onto fixed output epochs, using an eighth-order Lagrange interpolator. Only
+ *  epochs at which the interpolating polynomial is centered on the requested interval are used, with the first and last
+ *  epoch of the history added without interpolation.
+ *  \param stateHistory State history that is to be interpolated.
+ *  \param outputInterval Interval between the output epochs (multiples of which are used as output epochs).
+ *  \return State history at the output epochs.
+ */
+std::map< double, Eigen::VectorXd > interpolateStateHistoryToFixedEpochs(
+        const std::map< double, Eigen::VectorXd >& stateHistory, const double outputInterval )
+{
+    const int numberOfStages = 8;
+    interpolators::LagrangeInterpolator< double, Eigen::VectorXd > stateInterpolator( stateHistory, numberOfStages );
+
+    double firstInterpolatedEpoch = std::next( stateHistory.begin( ), numberOfStages / 2 )->first;
+    double lastInterpolatedEpoch = std::next( stateHistory.rbegin( ), numberOfStages / 2 )->first;
+
+    std::map< double, Eigen::VectorXd > interpolatedStateHistory;
+    interpolatedStateHistory[ stateHistory.begin( )->first ] = stateHistory.begin( )->second;
+    for( double epoch = outputInterval * std::ceil( firstInterpolatedEpoch / outputInterval );
+         epoch <= lastInterpolatedEpoch; epoch += outputInterval )
+    {
+        interpolatedStateHistory[ epoch ] = stateInterpolator.interpolate( epoch );
+    }
+    interpolatedStateHistory[ stateHistory.rbegin( )->first ] = stateHistory.rbegin( )->second;
+    return interpolatedStateHistory;
+}
+
+//! Test multi-rate evaluation of spherical harmonic gravity in full propagation, against single-rate propagation.
+BOOST_AUTO_TEST_CASE( testMultiRatePropagation )
+{
+    using namespace numerical_integrators;
+
+    const double propagationTime = 7200.0;
+    for( unsigned int test = 0; test < 3; test++ )
+    {
+        // Use fixed-step propagation with dynamic-size and fixed-size state, and variable-step propagation.
+        std::shared_ptr< IntegratorSettings< double > > integratorSettings;
+        double maximumStepSize;
+        if( test < 2 )
+        {
+            maximumStepSize = 10.0;
+            integratorSettings = std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, maximumStepSize );
+        }
+        else
+        {
+            maximumStepSize = 300.0;
+            integratorSettings = std::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                        0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-3, maximumStepSize,
+                        1.0E-10, 1.0E-10 );
+        }
+        bool useFixedSizeState = ( test == 1 );
+
+        int numberOfFullEvaluations, numberOfReferenceFunctionEvaluations, numberOfFunctionEvaluations;
+        double maximumApproximationError;
+        std::map< double, Eigen::VectorXd > referenceStateHistory = propagateSphericalHarmonicOrbit(
+                    nullptr, integratorSettings, useFixedSizeState, numberOfFullEvaluations,
+                    numberOfReferenceFunctionEvaluations, maximumApproximationError );
+        BOOST_CHECK_EQUAL( numberOfFullEvaluations, 0 );
+
+        std::map< double, Eigen::VectorXd > multiRateStateHistory = propagateSphericalHarmonicOrbit(
+                    std::make_shared< MultiRateAccelerationSettings >(
+                        std::vector< AvailableAcceleration >( { spherical_harmonic_gravity } ), 60.0 ),
+                    integratorSettings, useFixedSizeState, numberOfFullEvaluations,
+                    numberOfFunctionEvaluations, maximumApproximationError );
+
+        // Full evaluations are only performed at accepted steps, at most once per update interval (plus initial one).
+        BOOST_CHECK_EQUAL( numberOfFullEvaluations <= propagationTime / 60.0 + 1, true );
+        BOOST_CHECK_EQUAL( numberOfFullEvaluations <= static_cast< int >( multiRateStateHistory.size( ) ), true );
+        BOOST_CHECK_EQUAL( numberOfFullEvaluations > propagationTime / 300.0, true );
+
+        // Full evaluations at accepted steps do not require any additional state derivative evaluations.
+        if( test < 2 )
+        {
+            BOOST_CHECK_EQUAL( numberOfFunctionEvaluations, numberOfReferenceFunctionEvaluations );
+        }
+
+        // Check that both propagations are terminated exactly at the same final time.
+        BOOST_CHECK_EQUAL( referenceStateHistory.rbegin( )->first, propagationTime );
+        BOOST_CHECK_EQUAL( multiRateStateHistory.rbegin( )->first, propagationTime );
+
+        // The position difference caused by an acceleration error is bounded using the along-track drift in the
+        // Clohessy-Wiltshire equations for a constant along-track acceleration error da, which is 3/2 da t^2 (dominating
+        // the bounded radial and cross-track terms). The error is bounded by the largest approximation error found at
+        // the full evaluations, which occurs at the end of an update interval.
+        BOOST_CHECK_EQUAL( maximumApproximationError > 0.0, true );
+        double positionTolerance = 1.5 * maximumApproximationError * propagationTime * propagationTime;
+
+        // Compare propagations at the same (interpolated) epochs, omitting the first and last four steps.
+        std::map< double, Eigen::VectorXd > interpolatedReferenceStateHistory =
+                interpolateStateHistoryToFixedEpochs( referenceStateHistory, 60.0 );
+        std::map< double, Eigen::VectorXd > interpolatedMultiRateStateHistory =
+                interpolateStateHistoryToFixedEpochs( multiRateStateHistory, 60.0 );
+        int numberOfComparedEpochs = 0;
+        double maximumPositionDifference = 0.0;
+        for( auto const& stateEntry : interpolatedMultiRateStateHistory )
+        {
+            if( interpolatedReferenceStateHistory.count( stateEntry.first ) > 0 )
+            {
+                maximumPositionDifference = std::max(
+                            maximumPositionDifference,
+                            ( stateEntry.second - interpolatedReferenceStateHistory.at( stateEntry.first ) ).
+                            segment( 0, 3 ).norm( ) );
+                numberOfComparedEpochs++;
+            }
+        }
+        BOOST_CHECK_EQUAL( numberOfComparedEpochs >= ( propagationTime - 8.0 * maximumStepSize ) / 60.0, true );
+        BOOST_CHECK_SMALL( maximumPositionDifference, positionTolerance );
+        BOOST_CHECK_SMALL( ( multiRateStateHistory.rbegin( )->second -
+                             referenceStateHistory.rbegin( )->second ).segment( 0, 3 ).norm( ), positionTolerance );
+    }
+}
+
+//! Test profiling of multi-rate evaluation, with the profiler set before the multi-rate settings.
+BOOST_AUTO_TEST_CASE( testMultiRatePropagationProfiling )
+{
+    std::shared_ptr< PropagationProfiler > propagationProfiler = std::make_shared< PropagationProfiler >( );
+
+    int numberOfFullEvaluations, numberOfFunctionEvaluations;
+    double maximumApproximationError;
+    std::map< double, Eigen::VectorXd > multiRateStateHistory = propagateSphericalHarmonicOrbit(
+                std::make_shared< MultiRateAccelerationSettings >(
+                    std::vector< AvailableAcceleration >( { spherical_harmonic_gravity } ), 60.0 ),
+                std::make_shared< numerical_integrators::IntegratorSettings< double > >(
+                    numerical_integrators::rungeKutta4, 0.0, 10.0 ),
+                false, numberOfFullEvaluations, numberOfFunctionEvaluations, maximumApproximationError,
+                propagationProfiler );
+    BOOST_CHECK_EQUAL( numberOfFullEvaluations > 0, true );
+
+    // Check that the slow accelerations are profiled as a single entry, at each state derivative evaluation.
+    std::map< std::string, std::pair< double, unsigned int > > profilingResults =
+            propagationProfiler->getProfilingResults( );
+    BOOST_CHECK_EQUAL( profilingResults.count( "Acceleration: multi-rate slow accelerations" ), 1 );
+    BOOST_CHECK_EQUAL( profilingResults.at( "Acceleration: multi-rate slow accelerations" ).second,
+                       profilingResults.at( "Total: state derivative model update" ).second );
+}
+
+//! Test that environment updates only required by slow accelerations are only performed at their full evaluations.
+BOOST_AUTO_TEST_CASE( testMultiRateDeferredEnvironmentUpdates )
+{
+    using namespace numerical_integrators;
+
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 10.0 );
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        std::shared_ptr< MultiRateAccelerationSettings > multiRateAccelerationSettings;
+        if( test == 1 )
+        {
+            multiRateAccelerationSettings = std::make_shared< MultiRateAccelerationSettings >(
+                        std::vector< AvailableAcceleration >( { spherical_harmonic_gravity, third_body_central_gravity } ),
+                        60.0 );
+        }
+
+        std::shared_ptr< PropagationProfiler > propagationProfiler = std::make_shared< PropagationProfiler >( );
+        int numberOfFullEvaluations, numberOfFunctionEvaluations;
+        double maximumApproximationError;
+        propagateSphericalHarmonicOrbit(
+                    multiRateAccelerationSettings, integratorSettings, false, numberOfFullEvaluations,
+                    numberOfFunctionEvaluations, maximumApproximationError, propagationProfiler, true );
+
+        std::map< std::string, std::pair< double, unsigned int > > profilingResults =
+                propagationProfiler->getProfilingResults( );
+        unsigned int numberOfModelUpdates = profilingResults.at( "Total: state derivative model update" ).second;
+        unsigned int numberOfMoonUpdates = profilingResults.at( "Environment update: translational state of Moon" ).second;
+        unsigned int numberOfEarthRotationUpdates =
+                profilingResults.at( "Environment update: rotational state of Earth" ).second;
+        BOOST_CHECK_EQUAL( numberOfModelUpdates, static_cast< unsigned int >( numberOfFunctionEvaluations ) );
+        BOOST_CHECK_EQUAL( numberOfEarthRotationUpdates, numberOfModelUpdates );
+        if( test == 0 )
+        {
+            // All environment models are updated at each state derivative evaluation.
+            BOOST_CHECK_EQUAL( numberOfMoonUpdates, numberOfModelUpdates );
+        }
+        else
+        {
+            // State of the Moon is only required by the slow third-body acceleration, and only updated at its full
+            // evaluations (the Earth rotation is still required by the low-degree terms of the gravity field).
+            BOOST_CHECK_EQUAL( 2 * numberOfMoonUpdates, static_cast< unsigned int >( numberOfFullEvaluations ) );
+            BOOST_CHECK_EQUAL( 10 * numberOfMoonUpdates < numberOfModelUpdates, true );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,230 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
+#include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationEvents.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+using namespace tudat::orbital_element_conversions;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_events )
+
+//! Gravitational parameter of central body used in the tests.
+const double gravitationalParameter = 3.986004418E14;
+
+//! Function to compute the state derivative of a body in a Keplerian orbit.
+Eigen::VectorXd computeKeplerStateDerivative( const double, const Eigen::VectorXd& state )
+{
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -gravitationalParameter * state.segment( 0, 3 ) /
+            std::pow( state.segment( 0, 3 ).norm( ), 3.0 );
+    return stateDerivative;
+}
+
+//! Function to compute the time since the start of the propagation at which the given true anomaly is reached.
+double getTimeOfTrueAnomaly( const Eigen::Vector6d& keplerianElements, const double trueAnomaly )
+{
+    double eccentricity = keplerianElements( eccentricityIndex );
+    double meanMotion = std::sqrt( gravitationalParameter /
+                                   std::pow( keplerianElements( semiMajorAxisIndex ), 3.0 ) );
+    double meanAnomalyChange =
+            convertEccentricAnomalyToMeanAnomaly(
+                convertTrueAnomalyToEccentricAnomaly( trueAnomaly, eccentricity ), eccentricity ) -
+            convertEccentricAnomalyToMeanAnomaly(
+                convertTrueAnomalyToEccentricAnomaly( keplerianElements( trueAnomalyIndex ), eccentricity ), eccentricity );
+    while( meanAnomalyChange < 0.0 )
+    {
+        meanAnomalyChange += 2.0 * mathematical_constants::PI;
+    }
+    return meanAnomalyChange / meanMotion;
+}
+
+// Test detection and localization of logged and terminating events in a Keplerian orbit, for a fixed- and a
+// variable-step integrator.
+BOOST_AUTO_TEST_CASE( testKeplerOrbitEvents )
+{
+    Eigen::Vector6d keplerianElements;
+    keplerianElements( semiMajorAxisIndex ) = 7000.0E3;
+    keplerianElements( eccentricityIndex ) = 0.1;
+    keplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 30.0 );
+    keplerianElements( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 45.0 );
+    keplerianElements( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 20.0 );
+    keplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( -60.0 );
+    Eigen::VectorXd initialState = convertKeplerianToCartesianElements( keplerianElements, gravitationalParameter );
+
+    double orbitalPeriod = 2.0 * mathematical_constants::PI *
+            std::sqrt( std::pow( keplerianElements( semiMajorAxisIndex ), 3.0 ) / gravitationalParameter );
+
+    // Set analytical epochs of events in first orbit (nodes at argument of latitude 0 and 180 degrees).
+    double argumentOfPeriapsis = keplerianElements( argumentOfPeriapsisIndex );
+    std::map< std::string, double > expectedEventTimes;
+    expectedEventTimes[ "Periapsis" ] = getTimeOfTrueAnomaly( keplerianElements, 0.0 );
+    expectedEventTimes[ "Apoapsis" ] = getTimeOfTrueAnomaly( keplerianElements, mathematical_constants::PI );
+    expectedEventTimes[ "Ascending node" ] = getTimeOfTrueAnomaly( keplerianElements, -argumentOfPeriapsis );
+    expectedEventTimes[ "Descending node" ] =
+            getTimeOfTrueAnomaly( keplerianElements, mathematical_constants::PI - argumentOfPeriapsis );
+
+    // Terminate on radius of 7000 km, when descending towards periapsis (i.e. before the periapsis of the second orbit).
+    double terminationRadius = 7000.0E3;
+    double terminationTrueAnomaly = -std::acos(
+                ( keplerianElements( semiMajorAxisIndex ) * ( 1.0 - std::pow( keplerianElements( eccentricityIndex ), 2 ) ) /
+                  terminationRadius - 1.0 ) / keplerianElements( eccentricityIndex ) );
+    double expectedTerminationTime = getTimeOfTrueAnomaly( keplerianElements, terminationTrueAnomaly );
+    if( expectedTerminationTime < expectedEventTimes.at( "Ascending node" ) )
+    {
+        expectedTerminationTime += orbitalPeriod;
+    }
+
+    // Create events (node and apsis events for body at start of state vector, with empty body map).
+    std::map< std::string, std::pair< int, std::string > > translationalStateIndices;
+    translationalStateIndices[ "Vehicle" ] = std::make_pair( 0, "Earth" );
+
+    std::vector< std::shared_ptr< PropagationEventSettings > > eventSettings;
+    eventSettings.push_back( std::make_shared< ApsisEventSettings >(
+                                 "Periapsis", "Vehicle", increasing_event_crossing ) );
+    eventSettings.push_back( std::make_shared< ApsisEventSettings >(
+                                 "Apoapsis", "Vehicle", decreasing_event_crossing ) );
+    eventSettings.push_back( std::make_shared< NodeCrossingEventSettings >(
+                                 "Ascending node", "Vehicle", increasing_event_crossing ) );
+    eventSettings.push_back( std::make_shared< NodeCrossingEventSettings >(
+                                 "Descending node", "Vehicle", decreasing_event_crossing ) );
+    eventSettings.push_back( std::make_shared< CustomEventSettings >(
+                                 "Radius", [ = ]( const double, const Eigen::VectorXd& state )
+    {
+        return state.segment( 0, 3 ).norm( ) - terminationRadius;
+    }, decreasing_event_crossing, true ) );
+
+    std::vector< std::shared_ptr< IntegratorSettings< double > > > integratorSettingsList;
+    integratorSettingsList.push_back( std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 10.0 ) );
+    integratorSettingsList.push_back( std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                                          0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                                          1.0E-4, 1.0E4, 1.0E-12, 1.0E-12 ) );
+    for( unsigned int i = 0; i < integratorSettingsList.size( ); i++ )
+    {
+        std::shared_ptr< PropagationEventDetector< Eigen::VectorXd, double, double > > eventDetector =
+                std::make_shared< PropagationEventDetector< Eigen::VectorXd, double, double > >(
+                    createPropagationEvents( eventSettings, simulation_setup::NamedBodyMap( ),
+                                             translationalStateIndices ) );
+
+        // Propagate, with regular termination condition after the terminating event.
+        std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+                &computeKeplerStateDerivative;
+        std::map< double, Eigen::VectorXd > solutionHistory;
+        std::map< double, Eigen::VectorXd > dependentVariableHistory;
+        std::map< double, double > cumulativeComputationTimeHistory;
+        std::shared_ptr< PropagationTerminationDetails > terminationDetails =
+                integrateEquationsFromIntegrator< Eigen::VectorXd, double, double >(
+                    createIntegrator< double, Eigen::VectorXd >(
+                        stateDerivativeFunction, initialState, integratorSettingsList.at( i ) ),
+                    integratorSettingsList.at( i )->initialTimeStep_,
+                    std::make_shared< FixedTimePropagationTerminationCondition >( 2.0 * orbitalPeriod, true ),
+                    solutionHistory, dependentVariableHistory, cumulativeComputationTimeHistory,
+                    std::function< Eigen::VectorXd( ) >( ), std::function< void( Eigen::VectorXd& ) >( ), 1,
+                    TUDAT_NAN, std::chrono::steady_clock::now( ),
+                    std::function< void( const double, const Eigen::VectorXd&, const Eigen::VectorXd& ) >( ),
+                    true, eventDetector );
+
+        // Check termination reason
+        BOOST_CHECK_EQUAL( terminationDetails->getPropagationTerminationReason( ), termination_condition_reached );
+        std::shared_ptr< PropagationTerminationDetailsFromEvent > eventTerminationDetails =
+                std::dynamic_pointer_cast< PropagationTerminationDetailsFromEvent >( terminationDetails );
+        BOOST_CHECK( eventTerminationDetails != nullptr );
+        BOOST_CHECK_EQUAL( eventTerminationDetails->getEventName( ), "Radius" );
+
+        // Check event history: each event of the first orbit once, followed by the terminating event.
+        std::vector< PropagationEventOccurrence > eventHistory = eventDetector->getEventHistory( );
+        BOOST_CHECK_EQUAL( eventHistory.size( ), 5 );
+        for( unsigned int j = 0; j < eventHistory.size( ); j++ )
+        {
+            if( j > 0 )
+            {
+                BOOST_CHECK( eventHistory.at( j ).eventTime_ > eventHistory.at( j - 1 ).eventTime_ );
+            }
+
+            if( eventHistory.at( j ).eventName_ != "Radius" )
+            {
+                BOOST_CHECK_SMALL( eventHistory.at( j ).eventTime_ -
+                                   expectedEventTimes.at( eventHistory.at( j ).eventName_ ), 1.0E-3 );
+                BOOST_CHECK_EQUAL( eventHistory.at( j ).isPropagationTerminated_, false );
+            }
+        }
+
+        // Check that the propagation terminated exactly at the terminating event.
+        BOOST_CHECK_EQUAL( eventHistory.back( ).eventName_, "Radius" );
+        BOOST_CHECK_EQUAL( eventHistory.back( ).isPropagationTerminated_, true );
+        BOOST_CHECK_SMALL( solutionHistory.rbegin( )->first - expectedTerminationTime, 1.0E-3 );
+        BOOST_CHECK_EQUAL( solutionHistory.rbegin( )->first, eventHistory.back( ).eventTime_ );
+        BOOST_CHECK_SMALL( solutionHistory.rbegin( )->second.segment( 0, 3 ).norm( ) - terminationRadius, 1.0E-3 );
+
+        // Check that the final state is consistent with the Keplerian orbit (up to the integration error).
+        Eigen::Vector6d finalKeplerianElements = convertCartesianToKeplerianElements(
+                    Eigen::Vector6d( solutionHistory.rbegin( )->second ), gravitationalParameter );
+        BOOST_CHECK_SMALL( finalKeplerianElements( semiMajorAxisIndex ) - keplerianElements( semiMajorAxisIndex ),
+                           0.1 );
+    }
+}
+
+// Test event function values and crossing directions
+BOOST_AUTO_TEST_CASE( testEventCrossingDirections )
+{
+    std::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings =
+            std::make_shared< root_finders::RootFinderSettings >( root_finders::bisection_root_finder, 1.0E-8, 200 );
+    std::function< double( const double, const Eigen::VectorXd& ) > eventFunction =
+            [ ]( const double time, const Eigen::VectorXd& ){ return time; };
+
+    PropagationEvent anyCrossingEvent( "Any", eventFunction, any_event_crossing, false, rootFinderSettings );
+    PropagationEvent increasingCrossingEvent( "Increasing", eventFunction, increasing_event_crossing, false,
+                                              rootFinderSettings );
+    PropagationEvent decreasingCrossingEvent( "Decreasing", eventFunction, decreasing_event_crossing, false,
+                                              rootFinderSettings );
+
+    BOOST_CHECK_EQUAL( anyCrossingEvent.evaluateEventFunction( 2.0, Eigen::VectorXd::Zero( 1 ) ), 2.0 );
+
+    BOOST_CHECK( anyCrossingEvent.isEventCrossed( -1.0, 1.0 ) );
+    BOOST_CHECK( anyCrossingEvent.isEventCrossed( 1.0, -1.0 ) );
+    BOOST_CHECK( !anyCrossingEvent.isEventCrossed( 1.0, 2.0 ) );
+
+    BOOST_CHECK( increasingCrossingEvent.isEventCrossed( -1.0, 1.0 ) );
+    BOOST_CHECK( increasingCrossingEvent.isEventCrossed( -1.0, 0.0 ) );
+    BOOST_CHECK( !increasingCrossingEvent.isEventCrossed( 0.0, 1.0 ) );
+    BOOST_CHECK( !increasingCrossingEvent.isEventCrossed( 1.0, -1.0 ) );
+
+    BOOST_CHECK( decreasingCrossingEvent.isEventCrossed( 1.0, -1.0 ) );
+    BOOST_CHECK( !decreasingCrossingEvent.isEventCrossed( -1.0, 1.0 ) );
+
+    // Check that first evaluation (no previous value) does not trigger an event.
+    BOOST_CHECK( !anyCrossingEvent.isEventCrossed( TUDAT_NAN, 1.0 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,162 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <chrono>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/massRateModel.h"
+#include "Tudat/Astrodynamics/Propagators/bodyMassStateDerivative.h"
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::basic_astrodynamics;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_profiler )
+
+//! Test registration, accumulation and retrieval of profiled computation times.
+BOOST_AUTO_TEST_CASE( testPropagationProfilerBookkeeping )
+{
+    PropagationProfiler propagationProfiler;
+
+    // Check that registering an existing name returns the existing index.
+    int firstIndex = propagationProfiler.registerComputation( "Acceleration: first" );
+    int secondIndex = propagationProfiler.registerComputation( "Acceleration: second" );
+    int thirdIndex = propagationProfiler.registerComputation( "Torque: first" );
+    BOOST_CHECK_EQUAL( firstIndex, 0 );
+    BOOST_CHECK_EQUAL( secondIndex, 1 );
+    BOOST_CHECK_EQUAL( thirdIndex, 2 );
+    BOOST_CHECK_EQUAL( propagationProfiler.registerComputation( "Acceleration: first" ), firstIndex );
+
+    propagationProfiler.addComputationTime( firstIndex, 1.0 );
+    propagationProfiler.addComputationTime( firstIndex, 2.0 );
+    propagationProfiler.addComputationTime( secondIndex, 4.0 );
+    propagationProfiler.addComputationTime( thirdIndex, 8.0 );
+
+    // Check accumulated times and number of calls.
+    std::map< std::string, std::pair< double, unsigned int > > profilingResults =
+            propagationProfiler.getProfilingResults( );
+    BOOST_CHECK_EQUAL( profilingResults.size( ), 3 );
+    BOOST_CHECK_CLOSE_FRACTION( profilingResults.at( "Acceleration: first" ).first, 3.0,
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_EQUAL( profilingResults.at( "Acceleration: first" ).second, 2 );
+    BOOST_CHECK_EQUAL( profilingResults.at( "Acceleration: second" ).second, 1 );
+    BOOST_CHECK_CLOSE_FRACTION( propagationProfiler.getTotalComputationTime( "Acceleration" ), 7.0,
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( propagationProfiler.getTotalComputationTime( ), 15.0,
+                                std::numeric_limits< double >::epsilon( ) );
+
+    // Check that printed results are sorted by decreasing computation time.
+    std::stringstream printedResults;
+    propagationProfiler.printProfilingResults( printedResults );
+    BOOST_CHECK( printedResults.str( ).find( "Torque: first" ) < printedResults.str( ).find( "Acceleration: second" ) );
+    BOOST_CHECK( printedResults.str( ).find( "Acceleration: second" ) < printedResults.str( ).find( "Acceleration: first" ) );
+
+    // Check that reset keeps the registered computations, but clears their data.
+    propagationProfiler.resetProfilingData( );
+    profilingResults = propagationProfiler.getProfilingResults( );
+    BOOST_CHECK_EQUAL( profilingResults.size( ), 3 );
+    BOOST_CHECK_EQUAL( profilingResults.at( "Acceleration: first" ).first, 0.0 );
+    BOOST_CHECK_EQUAL( profilingResults.at( "Acceleration: first" ).second, 0 );
+
+    // Check that disabled timer does not require a valid index.
+    {
+        ScopedProfilingTimer profilingTimer( nullptr, -1 );
+    }
+    BOOST_CHECK_EQUAL( propagationProfiler.getTotalComputationTime( ), 0.0 );
+}
+
+//! Test that aggregate ("Total:") entries are not counted twice in the total computation time.
+BOOST_AUTO_TEST_CASE( testPropagationProfilerAggregateEntries )
+{
+    PropagationProfiler propagationProfiler;
+
+    propagationProfiler.addComputationTime(
+                propagationProfiler.registerComputation( "Acceleration: first" ), 1.0 );
+    propagationProfiler.addComputationTime(
+                propagationProfiler.registerComputation( "Environment: first" ), 2.0 );
+    propagationProfiler.addComputationTime(
+                propagationProfiler.registerComputation( "Total: state derivative evaluation" ), 4.0 );
+    propagationProfiler.addComputationTime(
+                propagationProfiler.registerComputation( "Total: environment update" ), 2.0 );
+
+    // Check that aggregate entries are only included when explicitly requested.
+    BOOST_CHECK_CLOSE_FRACTION( propagationProfiler.getTotalComputationTime( ), 3.0,
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( propagationProfiler.getTotalComputationTime( "Acceleration" ), 1.0,
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( propagationProfiler.getTotalComputationTime( "Total:" ), 6.0,
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( propagationProfiler.getTotalComputationTime( "Total: environment" ), 2.0,
+                                std::numeric_limits< double >::epsilon( ) );
+}
+
+//! Test profiling of mass rate models through the state derivative model.
+BOOST_AUTO_TEST_CASE( testMassRateModelProfiling )
+{
+    // Create mass rate models, of which one takes a known minimum amount of time.
+    std::map< std::string, std::vector< std::shared_ptr< MassRateModel > > > massRateModels;
+    massRateModels[ "Vehicle1" ].push_back(
+                std::make_shared< CustomMassRateModel >(
+                    [ ]( const double ){ std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) ); return -1.0; } ) );
+    massRateModels[ "Vehicle1" ].push_back(
+                std::make_shared< CustomMassRateModel >( [ ]( const double ){ return -0.5; } ) );
+    massRateModels[ "Vehicle2" ].push_back(
+                std::make_shared< CustomMassRateModel >( [ ]( const double ){ return -0.1; } ) );
+
+    BodyMassStateDerivative< double, double > massStateDerivative(
+                massRateModels, std::vector< std::string >( { "Vehicle1", "Vehicle2" } ) );
+
+    std::shared_ptr< PropagationProfiler > propagationProfiler = std::make_shared< PropagationProfiler >( );
+    massStateDerivative.setPropagationProfiler( propagationProfiler );
+
+    int numberOfEvaluations = 5;
+    for( int i = 0; i < numberOfEvaluations; i++ )
+    {
+        massStateDerivative.updateStateDerivativeModel( static_cast< double >( i ) );
+    }
+
+    // Check that each model is profiled separately, and that the timing is consistent with the model.
+    std::map< std::string, std::pair< double, unsigned int > > profilingResults =
+            propagationProfiler->getProfilingResults( );
+    BOOST_CHECK_EQUAL( profilingResults.size( ), 3 );
+    for( auto const& entry : profilingResults )
+    {
+        BOOST_CHECK_EQUAL( entry.second.second, numberOfEvaluations );
+    }
+    BOOST_CHECK( profilingResults.at( "Mass rate: model 0 of Vehicle1" ).first >= numberOfEvaluations * 2.0E-3 );
+    BOOST_CHECK( profilingResults.at( "Mass rate: model 1 of Vehicle1" ).first <
+                 profilingResults.at( "Mass rate: model 0 of Vehicle1" ).first );
+    BOOST_CHECK( profilingResults.count( "Mass rate: model 0 of Vehicle2" ) > 0 );
+
+    // Check that no profiling is done after disabling the profiler.
+    massStateDerivative.setPropagationProfiler( nullptr );
+    massStateDerivative.updateStateDerivativeModel( static_cast< double >( numberOfEvaluations ) );
+    BOOST_CHECK_EQUAL( propagationProfiler->getProfilingResults( ).at( "Mass rate: model 0 of Vehicle1" ).second,
+                       numberOfEvaluations );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
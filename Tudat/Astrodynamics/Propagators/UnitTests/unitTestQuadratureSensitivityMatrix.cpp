@@ -0,0 +1,175 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/utilities.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Astrodynamics/Propagators/stateTransitionMatrixInterface.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_quadrature_sensitivity_matrix )
+
+//! Test sensitivity matrix computed by quadrature for forced harmonic oscillator, for which S is known analytically.
+BOOST_AUTO_TEST_CASE( testQuadratureSensitivityMatrixForHarmonicOscillator )
+{
+    // Harmonic oscillator x'' = -omega^2 x + p1 + p2 * t, for which Phi = exp( A t ), and B = [ 0 0; 1 t ].
+    const double angularFrequency = 1.3;
+    std::map< double, Eigen::MatrixXd > stateTransitionMatrixHistory;
+    std::map< double, Eigen::MatrixXd > parameterPartialHistory;
+    for( int i = 0; i <= 400; i++ )
+    {
+        // Use non-equidistant epochs
+        double currentTime = 10.0 * ( static_cast< double >( i ) / 400.0 ) * ( 1.0 + 0.2 * static_cast< double >( i ) / 400.0 );
+        double phase = angularFrequency * currentTime;
+
+        Eigen::MatrixXd stateTransitionMatrix = Eigen::MatrixXd( 2, 2 );
+        stateTransitionMatrix << std::cos( phase ), std::sin( phase ) / angularFrequency,
+                -angularFrequency * std::sin( phase ), std::cos( phase );
+        stateTransitionMatrixHistory[ currentTime ] = stateTransitionMatrix;
+
+        Eigen::MatrixXd parameterPartial = Eigen::MatrixXd::Zero( 2, 2 );
+        parameterPartial( 1, 0 ) = 1.0;
+        parameterPartial( 1, 1 ) = currentTime;
+        parameterPartialHistory[ currentTime ] = parameterPartial;
+    }
+
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > stateTransitionMatrixInterpolator =
+            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                utilities::createVectorFromMapKeys( stateTransitionMatrixHistory ),
+                utilities::createVectorFromMapValues( stateTransitionMatrixHistory ), 8 );
+
+    std::shared_ptr< SingleArcQuadratureSensitivityMatrixInterface > sensitivityInterface =
+            std::make_shared< SingleArcQuadratureSensitivityMatrixInterface >(
+                stateTransitionMatrixInterpolator, stateTransitionMatrixHistory, parameterPartialHistory, 2, 4 );
+    BOOST_CHECK_EQUAL( sensitivityInterface->getFullParameterVectorSize( ), 4 );
+
+    // Retrieve single column at early time, and check that only required part of integral is computed.
+    double omegaSquared = angularFrequency * angularFrequency;
+    double testTime = 1.234;
+    Eigen::MatrixXd firstColumn = sensitivityInterface->getSensitivityMatrixColumns( testTime, { 0 } );
+    BOOST_CHECK_EQUAL( firstColumn.cols( ), 1 );
+    BOOST_CHECK_EQUAL( sensitivityInterface->getNumberOfIntegratedEpochs( 1 ), 0 );
+    BOOST_CHECK( sensitivityInterface->getNumberOfIntegratedEpochs( 0 ) > 0 );
+    BOOST_CHECK( sensitivityInterface->getNumberOfIntegratedEpochs( 0 ) < 60 );
+
+    Eigen::Vector2d expectedFirstColumn(
+                ( 1.0 - std::cos( angularFrequency * testTime ) ) / omegaSquared,
+                std::sin( angularFrequency * testTime ) / angularFrequency );
+    BOOST_CHECK_SMALL( ( firstColumn.col( 0 ) - expectedFirstColumn ).norm( ) / expectedFirstColumn.norm( ), 1.0E-7 );
+
+    // Compare full combined matrix with analytical solution at a number of (node and non-node) epochs.
+    std::vector< double > testTimes = { 0.0, 0.05, 2.5, 5.0, 7.77, 12.0 };
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        double currentTime = testTimes.at( i );
+        double phase = angularFrequency * currentTime;
+        Eigen::MatrixXd combinedMatrix = sensitivityInterface->getCombinedStateTransitionAndSensitivityMatrix( currentTime );
+
+        Eigen::MatrixXd expectedMatrix = Eigen::MatrixXd( 2, 4 );
+        expectedMatrix << std::cos( phase ), std::sin( phase ) / angularFrequency,
+                ( 1.0 - std::cos( phase ) ) / omegaSquared,
+                currentTime / omegaSquared - std::sin( phase ) / ( omegaSquared * angularFrequency ),
+                -angularFrequency * std::sin( phase ), std::cos( phase ),
+                std::sin( phase ) / angularFrequency,
+                ( 1.0 - std::cos( phase ) ) / omegaSquared;
+
+        BOOST_CHECK_SMALL( ( combinedMatrix - expectedMatrix ).norm( ), 1.0E-6 );
+
+        // Check consistency of retrieval of single columns
+        Eigen::MatrixXd secondColumn = sensitivityInterface->getSensitivityMatrixColumns( currentTime, { 1 } );
+        BOOST_CHECK_SMALL( ( secondColumn.col( 0 ) - combinedMatrix.col( 3 ) ).norm( ), 1.0E-15 );
+    }
+    BOOST_CHECK_EQUAL( sensitivityInterface->getNumberOfIntegratedEpochs( 1 ), 400 );
+
+    // Check error handling
+    BOOST_CHECK_THROW( sensitivityInterface->getSensitivityMatrixColumns( 1.0, { 2 } ), std::runtime_error );
+    parameterPartialHistory.erase( parameterPartialHistory.begin( ) );
+    BOOST_CHECK_THROW( SingleArcQuadratureSensitivityMatrixInterface(
+                           stateTransitionMatrixInterpolator, stateTransitionMatrixHistory, parameterPartialHistory, 2, 4 ),
+                       std::runtime_error );
+}
+
+//! Test that identically zero columns of the sensitivity matrix are not computed, and that unset interfaces throw on use.
+BOOST_AUTO_TEST_CASE( testQuadratureSensitivityMatrixZeroColumns )
+{
+    // Harmonic oscillator x'' = -omega^2 x + p1 + p3 * t, with parameter p2 not influencing the dynamics (e.g. a bias).
+    const double angularFrequency = 0.7;
+    std::map< double, Eigen::MatrixXd > stateTransitionMatrixHistory;
+    std::map< double, Eigen::MatrixXd > parameterPartialHistory;
+    for( int i = 0; i <= 200; i++ )
+    {
+        double currentTime = 0.05 * static_cast< double >( i );
+        double phase = angularFrequency * currentTime;
+
+        Eigen::MatrixXd stateTransitionMatrix = Eigen::MatrixXd( 2, 2 );
+        stateTransitionMatrix << std::cos( phase ), std::sin( phase ) / angularFrequency,
+                -angularFrequency * std::sin( phase ), std::cos( phase );
+        stateTransitionMatrixHistory[ currentTime ] = stateTransitionMatrix;
+
+        Eigen::MatrixXd parameterPartial = Eigen::MatrixXd::Zero( 2, 3 );
+        parameterPartial( 1, 0 ) = 1.0;
+        parameterPartial( 1, 2 ) = currentTime;
+        parameterPartialHistory[ currentTime ] = parameterPartial;
+    }
+
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > stateTransitionMatrixInterpolator =
+            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                utilities::createVectorFromMapKeys( stateTransitionMatrixHistory ),
+                utilities::createVectorFromMapValues( stateTransitionMatrixHistory ), 8 );
+
+    std::shared_ptr< SingleArcQuadratureSensitivityMatrixInterface > sensitivityInterface =
+            std::make_shared< SingleArcQuadratureSensitivityMatrixInterface >(
+                stateTransitionMatrixInterpolator, stateTransitionMatrixHistory, parameterPartialHistory, 2, 5 );
+
+    std::vector< int > nonZeroColumns = sensitivityInterface->getNonZeroSensitivityMatrixColumns( );
+    BOOST_CHECK_EQUAL( nonZeroColumns.size( ), 2 );
+    BOOST_CHECK_EQUAL( nonZeroColumns.at( 0 ), 0 );
+    BOOST_CHECK_EQUAL( nonZeroColumns.at( 1 ), 2 );
+
+    // Check that combined matrix contains non-zero columns, and that zero column is not integrated.
+    double testTime = 8.88;
+    Eigen::MatrixXd combinedMatrix = sensitivityInterface->getCombinedStateTransitionAndSensitivityMatrix( testTime );
+    BOOST_CHECK_EQUAL( sensitivityInterface->getNumberOfIntegratedEpochs( 1 ), 0 );
+    BOOST_CHECK( sensitivityInterface->getNumberOfIntegratedEpochs( 0 ) > 0 );
+    BOOST_CHECK( sensitivityInterface->getNumberOfIntegratedEpochs( 2 ) > 0 );
+    BOOST_CHECK_EQUAL( combinedMatrix.col( 3 ).norm( ), 0.0 );
+
+    Eigen::MatrixXd explicitColumns = sensitivityInterface->getSensitivityMatrixColumns( testTime, { 0, 1, 2 } );
+    BOOST_CHECK_SMALL( ( explicitColumns - combinedMatrix.block( 0, 2, 2, 3 ) ).norm( ), 1.0E-15 );
+
+    // Check that interfaces without interpolators (i.e. created before variational equations are integrated) throw on use.
+    SingleArcQuadratureSensitivityMatrixInterface unsetQuadratureInterface(
+                nullptr, std::map< double, Eigen::MatrixXd >( ), std::map< double, Eigen::MatrixXd >( ), 2, 5 );
+    BOOST_CHECK_THROW( unsetQuadratureInterface.getCombinedStateTransitionAndSensitivityMatrix( testTime ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( unsetQuadratureInterface.getSensitivityMatrixColumns( testTime, { 0 } ), std::runtime_error );
+
+    SingleArcCombinedStateTransitionAndSensitivityMatrixInterface unsetInterface( nullptr, nullptr, 2, 5 );
+    BOOST_CHECK_THROW( unsetInterface.getFullCombinedStateTransitionAndSensitivityMatrix( testTime ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,306 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModel.h"
+#include "Tudat/Astrodynamics/Propagators/customStateDerivative.h"
+#include "Tudat/Astrodynamics/Propagators/dynamicsStateDerivativeModel.h"
+#include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
+#include "Tudat/Astrodynamics/Propagators/rotationalMotionQuaternionsStateDerivative.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationTermination.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+
+BOOST_AUTO_TEST_SUITE( test_rotational_sub_cycling )
+
+//! Torque model proportional to the position of a harmonic oscillator, which is retrieved from the environment.
+class OscillatorCoupledTorque: public basic_astrodynamics::TorqueModel
+{
+public:
+
+    OscillatorCoupledTorque( const std::shared_ptr< Eigen::Vector3d > oscillatorPosition, const double torqueScaling ):
+        oscillatorPosition_( oscillatorPosition ), torqueScaling_( torqueScaling ){ }
+
+    Eigen::Vector3d getTorque( )
+    {
+        return currentTorque_;
+    }
+
+    void updateMembers( const double currentTime )
+    {
+        if( !( currentTime_ == currentTime ) )
+        {
+            currentTorque_ = torqueScaling_ * ( *oscillatorPosition_ );
+            currentTime_ = currentTime;
+        }
+    }
+
+private:
+
+    std::shared_ptr< Eigen::Vector3d > oscillatorPosition_;
+
+    double torqueScaling_;
+
+    Eigen::Vector3d currentTorque_;
+};
+
+//! Function to compute the state derivative of a three-dimensional harmonic oscillator.
+/*!
+ *  Function to compute the state derivative of a three-dimensional harmonic oscillator, with an additional constant
+ *  force along the x-axis of a body-fixed frame.
+ *  \param state State of the oscillator.
+ *  \param bodyFixedForceDirection Direction of x-axis of body-fixed frame, in inertial frame.
+ *  \param bodyFixedForceMagnitude Magnitude of (mass-normalized) body-fixed force.
+ *  \return State derivative of the oscillator.
+ */
+Eigen::VectorXd computeOscillatorStateDerivative( const Eigen::VectorXd& state,
+                                                  const Eigen::Vector3d& bodyFixedForceDirection,
+                                                  const double bodyFixedForceMagnitude )
+{
+    Eigen::VectorXd stateDerivative = Eigen::VectorXd( 6 );
+    stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+    stateDerivative.segment( 3, 3 ) = -1.0E-4 * state.segment( 0, 3 ) + bodyFixedForceMagnitude * bodyFixedForceDirection;
+    return stateDerivative;
+}
+
+//! Function to propagate a rigid body, with torque coupled to a harmonic oscillator through the environment.
+/*!
+ *  Function to propagate a rigid body, with torque coupled to a harmonic oscillator through the environment.
+ *  \param integratorSettings Settings for the numerical integrator
+ *  \param terminateExactlyOnFinalTime Boolean denoting whether the propagation is to terminate exactly on the final time
+ *  \param numberOfSubSteps Number of rotational sub-steps per integration step (0 if the rotational dynamics is not
+ *  sub-cycled)
+ *  \param subStepIntegratorType Integrator used for the rotational sub-steps
+ *  \param initialAngularVelocity Initial angular velocity of the body, in its body-fixed frame
+ *  \param bodyFixedForceMagnitude Magnitude of force on the oscillator along the body-fixed x-axis, which couples the
+ *  oscillator to the rotational state (zero by default)
+ *  \return Final propagated state (oscillator state, followed by quaternion and angular velocity vector)
+ */
+Eigen::VectorXd propagateCoupledDynamics(
+        const std::shared_ptr< IntegratorSettings< double > > integratorSettings,
+        const bool terminateExactlyOnFinalTime,
+        const unsigned int numberOfSubSteps,
+        const RotationalSubStepIntegratorType subStepIntegratorType = runge_kutta_4_rotational_sub_step,
+        const Eigen::Vector3d& initialAngularVelocity = ( Eigen::Vector3d( ) << 0.3, 0.01, 0.2 ).finished( ),
+        const double bodyFixedForceMagnitude = 0.0 )
+{
+    // Create torque model, which retrieves the oscillator position from the environment
+    std::shared_ptr< Eigen::Vector3d > oscillatorPosition = std::make_shared< Eigen::Vector3d >( Eigen::Vector3d::Zero( ) );
+    basic_astrodynamics::TorqueModelMap torqueModelMap;
+    torqueModelMap[ "Vehicle" ][ "Oscillator" ].push_back(
+                std::make_shared< OscillatorCoupledTorque >( oscillatorPosition, 0.05 ) );
+
+    // Create state derivative models
+    Eigen::Matrix3d inertiaTensor = Eigen::Matrix3d::Zero( );
+    inertiaTensor.diagonal( ) << 10.0, 15.0, 20.0;
+    std::shared_ptr< RotationalMotionQuaternionsStateDerivative< double, double > > rotationalStateDerivative =
+            std::make_shared< RotationalMotionQuaternionsStateDerivative< double, double > >(
+                torqueModelMap, std::vector< std::string >{ "Vehicle" },
+                std::vector< std::function< Eigen::Matrix3d( ) > >{ [ = ]( ){ return inertiaTensor; } } );
+    if( numberOfSubSteps > 0 )
+    {
+        rotationalStateDerivative->setSubCyclingSettings(
+                    std::make_shared< RotationalSubCyclingSettings >( numberOfSubSteps, subStepIntegratorType ) );
+    }
+
+    // Create oscillator state derivative model, with force direction retrieved from the environment
+    std::shared_ptr< Eigen::Vector3d > bodyFixedForceDirection = std::make_shared< Eigen::Vector3d >( Eigen::Vector3d::Zero( ) );
+    std::vector< std::shared_ptr< SingleStateTypeDerivative< double, double > > > stateDerivativeModels;
+    stateDerivativeModels.push_back(
+                std::make_shared< CustomStateDerivative< double, double > >(
+                    [ = ]( const double, const Eigen::VectorXd& state )
+    {
+        return computeOscillatorStateDerivative( state, *bodyFixedForceDirection, bodyFixedForceMagnitude );
+    }, 6 ) );
+    stateDerivativeModels.push_back( rotationalStateDerivative );
+
+    std::shared_ptr< DynamicsStateDerivativeModel< double, double > > dynamicsStateDerivative =
+            std::make_shared< DynamicsStateDerivativeModel< double, double > >(
+                stateDerivativeModels,
+                [ = ]( const double, const std::unordered_map< IntegratedStateType, Eigen::VectorXd >& currentStates,
+                const std::vector< IntegratedStateType > )
+    {
+        *oscillatorPosition = currentStates.at( custom_state ).segment( 0, 3 );
+        *bodyFixedForceDirection = Eigen::Quaterniond(
+                    currentStates.at( rotational_state )( 0 ), currentStates.at( rotational_state )( 1 ),
+                    currentStates.at( rotational_state )( 2 ), currentStates.at( rotational_state )( 3 ) ).
+                normalized( ).toRotationMatrix( ).col( 0 );
+    } );
+    dynamicsStateDerivative->setPropagationSettings( std::vector< IntegratedStateType >( ), true, false );
+    BOOST_CHECK_EQUAL( dynamicsStateDerivative->isRotationalStateSubCycled( ), ( numberOfSubSteps > 0 ) );
+
+    // Set initial state
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 13 );
+    initialState.segment( 0, 6 ) << 1.0, 0.0, 0.5, 0.0, 0.01, 0.0;
+    initialState( 6 ) = 1.0;
+    initialState.segment( 10, 3 ) = initialAngularVelocity;
+
+    std::function< void( const double, const Eigen::VectorXd&, const double, Eigen::VectorXd&,
+                         const Eigen::VectorXd&, const Eigen::VectorXd& ) > subCycledStateUpdateFunction;
+    if( numberOfSubSteps > 0 )
+    {
+        subCycledStateUpdateFunction = std::bind(
+                    &DynamicsStateDerivativeModel< double, double >::updateSubCycledRotationalState,
+                    dynamicsStateDerivative, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+                    std::placeholders::_4, std::placeholders::_5, std::placeholders::_6 );
+    }
+
+    // Propagate dynamics
+    std::map< double, Eigen::VectorXd > stateHistory;
+    std::map< double, Eigen::VectorXd > dependentVariableHistory;
+    std::map< double, double > cumulativeComputationTimeHistory;
+    EquationIntegrationInterface< Eigen::VectorXd, double >::integrateEquations(
+                std::bind( &DynamicsStateDerivativeModel< double, double >::computeStateDerivative,
+                           dynamicsStateDerivative, std::placeholders::_1, std::placeholders::_2 ),
+                stateHistory, initialState, integratorSettings,
+                std::make_shared< FixedTimePropagationTerminationCondition >( 300.0, true, terminateExactlyOnFinalTime ),
+                dependentVariableHistory, cumulativeComputationTimeHistory,
+                std::function< Eigen::VectorXd( ) >( ),
+                std::bind( &DynamicsStateDerivativeModel< double, double >::postProcessState,
+                           dynamicsStateDerivative, std::placeholders::_1 ),
+                TUDAT_NAN, std::chrono::steady_clock::now( ),
+                std::function< void( const double, const Eigen::VectorXd&, const Eigen::VectorXd& ) >( ), true,
+                nullptr, subCycledStateUpdateFunction );
+
+    BOOST_CHECK_SMALL( std::fabs( stateHistory.rbegin( )->first - 300.0 ), 1.0E-12 );
+    return stateHistory.rbegin( )->second;
+}
+
+//! Test whether sub-cycled rotational dynamics reproduces a fine-step propagation of the full coupled dynamics.
+BOOST_AUTO_TEST_CASE( testSubCycledRotationalDynamics )
+{
+    // Propagate full dynamics with small fixed step as reference
+    Eigen::VectorXd referenceState = propagateCoupledDynamics(
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 0.0625 ), false, 0 );
+
+    // Propagate with large fixed step (with rotational sub-step equal to reference step), with and without sub-cycling
+    Eigen::VectorXd subCycledState = propagateCoupledDynamics(
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 10.0 ), false, 160 );
+    Eigen::VectorXd directState = propagateCoupledDynamics(
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 10.0 ), false, 0 );
+
+    // Propagate with variable step, with rotational sub-cycling, terminating exactly on final time
+    Eigen::VectorXd variableStepSubCycledState = propagateCoupledDynamics(
+                std::make_shared< RungeKuttaVariableStepSizeSettings< double > >(
+                    0.0, 1.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-3, 10.0, 1.0E-12, 1.0E-12 ), true, 160 );
+
+    // Check oscillator state (limited by truncation error of large-step RK4 propagation)
+    for( unsigned int i = 0; i < 6; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( subCycledState( i ) - referenceState( i ) ), 1.0E-5 );
+        BOOST_CHECK_SMALL( std::fabs( variableStepSubCycledState( i ) - referenceState( i ) ), 1.0E-8 );
+    }
+
+    // Check that sub-cycled rotational state is close to reference, whereas large-step direct propagation is not.
+    double subCycledRotationalError = ( subCycledState - referenceState ).segment( 6, 7 ).cwiseAbs( ).maxCoeff( );
+    double variableStepSubCycledRotationalError =
+            ( variableStepSubCycledState - referenceState ).segment( 6, 7 ).cwiseAbs( ).maxCoeff( );
+    double directRotationalError = ( directState - referenceState ).segment( 6, 7 ).cwiseAbs( ).maxCoeff( );
+
+    BOOST_CHECK_SMALL( subCycledRotationalError, 2.0E-5 );
+    BOOST_CHECK_SMALL( variableStepSubCycledRotationalError, 2.0E-5 );
+    BOOST_CHECK( directRotationalError > 1.0E3 * subCycledRotationalError );
+
+    // Check that the quaternion remains normalized
+    BOOST_CHECK_SMALL( std::fabs( subCycledState.segment( 6, 4 ).norm( ) - 1.0 ), 1.0E-13 );
+    BOOST_CHECK_SMALL( std::fabs( variableStepSubCycledState.segment( 6, 4 ).norm( ) - 1.0 ), 1.0E-13 );
+}
+
+//! Test whether Munthe-Kaas rotational sub-steps accurately propagate a rapidly spinning body.
+BOOST_AUTO_TEST_CASE( testMuntheKaasRotationalSubSteps )
+{
+    // Set rapid spin about (nearly) principal axis
+    Eigen::Vector3d initialAngularVelocity = ( Eigen::Vector3d( ) << 0.02, 0.01, 2.0 ).finished( );
+
+    // Propagate full dynamics with small fixed step as reference
+    Eigen::VectorXd referenceState = propagateCoupledDynamics(
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 0.0078125 ), false, 0,
+                runge_kutta_4_rotational_sub_step, initialAngularVelocity );
+
+    // Propagate with large fixed step and rotational sub-cycling, with Munthe-Kaas and RK4 sub-steps
+    Eigen::VectorXd muntheKaasState = propagateCoupledDynamics(
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 10.0 ), false, 10,
+                munthe_kaas_runge_kutta_4_rotational_sub_step, initialAngularVelocity );
+    Eigen::VectorXd refinedMuntheKaasState = propagateCoupledDynamics(
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 10.0 ), false, 20,
+                munthe_kaas_runge_kutta_4_rotational_sub_step, initialAngularVelocity );
+    Eigen::VectorXd rungeKuttaState = propagateCoupledDynamics(
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 10.0 ), false, 10,
+                runge_kutta_4_rotational_sub_step, initialAngularVelocity );
+
+    double muntheKaasRotationalError = ( muntheKaasState - referenceState ).segment( 6, 7 ).cwiseAbs( ).maxCoeff( );
+    double refinedMuntheKaasRotationalError =
+            ( refinedMuntheKaasState - referenceState ).segment( 6, 7 ).cwiseAbs( ).maxCoeff( );
+    double rungeKuttaRotationalError = ( rungeKuttaState - referenceState ).segment( 6, 7 ).cwiseAbs( ).maxCoeff( );
+
+    // Check that Munthe-Kaas sub-steps converge to reference, and are much more accurate than RK4 sub-steps of equal size
+    BOOST_CHECK_SMALL( muntheKaasRotationalError, 1.0E-4 );
+    BOOST_CHECK_SMALL( refinedMuntheKaasRotationalError, 5.0E-6 );
+    BOOST_CHECK( rungeKuttaRotationalError > 1.0E3 * muntheKaasRotationalError );
+
+    // Check that the quaternion remains normalized
+    BOOST_CHECK_SMALL( std::fabs( muntheKaasState.segment( 6, 4 ).norm( ) - 1.0 ), 1.0E-14 );
+    BOOST_CHECK_SMALL( std::fabs( refinedMuntheKaasState.segment( 6, 4 ).norm( ) - 1.0 ), 1.0E-14 );
+}
+
+//! Test whether the coupling of sub-cycled rotational dynamics to the remaining dynamics converges at second order.
+BOOST_AUTO_TEST_CASE( testSubCycledRotationalDynamicsCoupling )
+{
+    // Set force along body-fixed axis, so that the oscillator depends on the rotational state
+    const double bodyFixedForceMagnitude = 1.0E-4;
+    const double referenceStepSize = 0.0625;
+    const Eigen::Vector3d initialAngularVelocity = ( Eigen::Vector3d( ) << 0.03, 0.001, 0.02 ).finished( );
+
+    // Propagate full dynamics with small fixed step as reference
+    Eigen::VectorXd referenceState = propagateCoupledDynamics(
+                std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, referenceStepSize ), false, 0,
+                runge_kutta_4_rotational_sub_step, initialAngularVelocity, bodyFixedForceMagnitude );
+
+    // Propagate with sub-cycling at decreasing step size (with rotational sub-step equal to reference step)
+    std::vector< double > oscillatorErrors;
+    for( double stepSize = 2.5; stepSize >= 0.625; stepSize /= 2.0 )
+    {
+        Eigen::VectorXd subCycledState = propagateCoupledDynamics(
+                    std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, stepSize ), false,
+                    static_cast< unsigned int >( stepSize / referenceStepSize ),
+                    runge_kutta_4_rotational_sub_step, initialAngularVelocity, bodyFixedForceMagnitude );
+        oscillatorErrors.push_back( ( subCycledState - referenceState ).segment( 0, 3 ).norm( ) );
+    }
+
+    // Check that the error of the oscillator decreases with step size, and that it converges faster than first order
+    // (which would reduce the error by a factor 4 when reducing the step size by a factor 4)
+    BOOST_CHECK( oscillatorErrors.at( 0 ) < 1.0E-4 );
+    for( unsigned int i = 1; i < oscillatorErrors.size( ); i++ )
+    {
+        BOOST_CHECK( oscillatorErrors.at( i ) < oscillatorErrors.at( i - 1 ) );
+    }
+    BOOST_CHECK( oscillatorErrors.at( 2 ) < oscillatorErrors.at( 0 ) / 8.0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -1027,6 +1027,100 @@ BOOST_AUTO_TEST_CASE( testPhobosRotationVariationalEquationCalculation )
                 ( manualPartial.block( 0, 13, 13, 8 ) ), ( stateTransitionAndSensitivityMatrixAtEpoch.block( 0, 13, 13, 8 ) ), 1.0E-4 );
 }
 
+//! Test the sensitivity matrix computed by quadrature against the numerically integrated sensitivity matrix.
+/*!
+ *  Test the sensitivity matrix computed by quadrature against the numerically integrated sensitivity matrix, for the
+ *  Earth-Moon system with estimated gravitational parameters. A variable step-size integrator is used, so that the partials
+ *  w.r.t. the parameters used for the quadrature must not be affected by intermediate stages or rejected steps.
+ */
+BOOST_AUTO_TEST_CASE( testQuadratureSensitivityMatrixCalculation )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Moon" );
+
+    double initialEphemerisTime = 1.0E7;
+    double finalEphemerisTime = initialEphemerisTime + 0.5E7;
+    double buffer = 10.0 * 86400.0;
+
+    // Create bodies needed in simulation
+    NamedBodyMap bodyMap = createBodies(
+                getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Set accelerations between bodies that are to be taken into account.
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Earth" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Earth" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+
+    std::vector< std::string > bodiesToIntegrate = { "Moon", "Earth" };
+    std::vector< std::string > centralBodies = { "Earth", "Sun" };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    // Create propagator settings
+    Eigen::VectorXd initialState = getInitialStatesOfBodies(
+                bodiesToIntegrate, centralBodies, bodyMap, initialEphemerisTime );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, accelerationModelMap, bodiesToIntegrate, initialState, finalEphemerisTime );
+
+    // Create variable step-size integrator settings, with initial step size that is too large (causing rejected steps).
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< RungeKuttaVariableStepSizeSettings< double > >
+            ( initialEphemerisTime, 2.0 * 86400.0,
+              RungeKuttaCoefficients::CoefficientSets::rungeKuttaFehlberg78,
+              60.0, 86400.0, 1.0E-12, 1.0E-12 );
+
+    // Define parameters.
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back(
+                std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Moon", initialState.segment( 0, 6 ), "Earth" ) );
+    parameterNames.push_back(
+                std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Earth", initialState.segment( 6, 6 ), "Sun" ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Moon", gravitational_parameter ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Sun", gravitational_parameter ) );
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    // Compute sensitivity matrix by numerical integration, and by quadrature
+    SingleArcVariationalEquationsSolver< double, double > integratedSensitivitySolver(
+                bodyMap, integratorSettings, propagatorSettings, parametersToEstimate,
+                true, nullptr, true, true, false, false );
+    SingleArcVariationalEquationsSolver< double, double > quadratureSensitivitySolver(
+                bodyMap, integratorSettings, propagatorSettings, parametersToEstimate,
+                true, nullptr, true, true, false, true );
+
+    // Compare sensitivity matrices at number of epochs (column-wise, as columns have different scaling)
+    std::vector< double > testEpochs = { initialEphemerisTime + 1.0E5, 1.2345E7, 1.4E7, finalEphemerisTime - 1.0E4 };
+    for( unsigned int i = 0; i < testEpochs.size( ); i++ )
+    {
+        Eigen::MatrixXd integratedMatrix = integratedSensitivitySolver.getStateTransitionMatrixInterface( )->
+                getCombinedStateTransitionAndSensitivityMatrix( testEpochs.at( i ) );
+        Eigen::MatrixXd quadratureMatrix = quadratureSensitivitySolver.getStateTransitionMatrixInterface( )->
+                getCombinedStateTransitionAndSensitivityMatrix( testEpochs.at( i ) );
+
+        BOOST_CHECK_EQUAL( integratedMatrix.rows( ), 12 );
+        BOOST_CHECK_EQUAL( integratedMatrix.cols( ), 15 );
+        BOOST_CHECK_EQUAL( quadratureMatrix.cols( ), 15 );
+
+        for( unsigned int j = 0; j < 15; j++ )
+        {
+            BOOST_CHECK_SMALL( ( integratedMatrix.col( j ) - quadratureMatrix.col( j ) ).norm( ) /
+                               integratedMatrix.col( j ).norm( ), ( j < 12 ) ? 1.0E-10 : 1.0E-6 );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
@@ -143,7 +143,8 @@ public:
      */
     void updateStateDerivativeModel( const TimeType currentTime )
     {
-
+        PropagationProfiler* profiler = this->propagationProfiler_.get( );
+        int currentMassRateModelIndex = 0;
 
         // Update local variables of mass rate model objects.
         for( massRateModelIterator_ = massRateModels_.begin( );
@@ -152,7 +153,38 @@ public:
         {
             for( unsigned int i = 0; i < massRateModelIterator_->second.size( ); i++ )
             {
+                ScopedProfilingTimer profilingTimer(
+                            profiler, getProfilingIndex( profiler, massRateProfilingIndices_, currentMassRateModelIndex ) );
                 massRateModelIterator_->second.at ( i )->updateMembers( static_cast< double >( currentTime ) );
+                currentMassRateModelIndex++;
+            }
+        }
+    }
+
+    //! Function to set the object used to profile the computation time of the mass rate models.
+    /*!
+     * Function to set the object used to profile the computation time of the mass rate models. Each mass rate model is
+     * registered separately, by the body to which it applies and its index in the list of models of that body.
+     * \param propagationProfiler Object used to profile the computation time (nullptr to disable profiling).
+     */
+    void setPropagationProfiler( const std::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        this->propagationProfiler_ = propagationProfiler;
+        massRateProfilingIndices_.clear( );
+        if( propagationProfiler == nullptr )
+        {
+            return;
+        }
+
+        for( massRateModelIterator_ = massRateModels_.begin( );
+             massRateModelIterator_ != massRateModels_.end( );
+             massRateModelIterator_++ )
+        {
+            for( unsigned int i = 0; i < massRateModelIterator_->second.size( ); i++ )
+            {
+                massRateProfilingIndices_.push_back(
+                            propagationProfiler->registerComputation(
+                                "Mass rate: model " + std::to_string( i ) + " of " + massRateModelIterator_->first ) );
             }
         }
     }
@@ -245,6 +277,9 @@ private:
     //! Predefined iterator to save (de-)allocation time.
     std::map< std::string, std::vector< std::shared_ptr< basic_astrodynamics::MassRateModel > > >::const_iterator massRateModelIterator_;
 
+    //! Profiling index of each mass rate model, in order of iteration over massRateModels_ (empty if not profiled).
+    std::vector< int > massRateProfilingIndices_;
+
     //! List of bodies for which the mass is to be propagated.
     /*!
      * List of bodies for which the mass is to be propagated. Note that this vector have
@@ -26,6 +26,8 @@
 #include "Tudat/Astrodynamics/Propagators/bodyMassStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
+#include "Tudat/Astrodynamics/Propagators/rotationalMotionQuaternionsStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/rotationalMotionStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/variationalEquations.h"
 
@@ -129,6 +131,38 @@ public:
                     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >::Zero(
                         conventionalStateTypeSize_.at( stateDerivativeModels.at( i )->getIntegratedStateType( )  ), 1 );
         }
+
+        // Retrieve settings for sub-cycling of rotational dynamics, if any.
+        if( stateDerivativeModels_.count( rotational_state ) > 0 )
+        {
+            for( unsigned int i = 0; i < stateDerivativeModels_.at( rotational_state ).size( ); i++ )
+            {
+                std::shared_ptr< RotationalMotionStateDerivative< StateScalarType, TimeType > > rotationalStateDerivative =
+                        std::dynamic_pointer_cast< RotationalMotionStateDerivative< StateScalarType, TimeType > >(
+                            stateDerivativeModels_.at( rotational_state ).at( i ) );
+                std::shared_ptr< RotationalSubCyclingSettings > currentSubCyclingSettings =
+                        ( rotationalStateDerivative == nullptr ) ? nullptr : rotationalStateDerivative->getSubCyclingSettings( );
+                if( i > 0 && ( currentSubCyclingSettings != rotationalSubCyclingSettings_ ) )
+                {
+                    throw std::runtime_error(
+                                "Error when creating dynamics state derivative model, inconsistent rotational sub-cycling settings." );
+                }
+                rotationalSubCyclingSettings_ = currentSubCyclingSettings;
+                subCycledRotationalPropagatorTypes_.push_back(
+                            ( rotationalStateDerivative == nullptr ) ? undefined_rotational_propagator :
+                                                                       rotationalStateDerivative->getRotationalPropagatorType( ) );
+
+                if( rotationalSubCyclingSettings_ != nullptr &&
+                        rotationalSubCyclingSettings_->subStepIntegratorType_ ==
+                        munthe_kaas_runge_kutta_4_rotational_sub_step &&
+                        rotationalStateDerivative->getRotationalPropagatorType( ) != quaternions )
+                {
+                    throw std::runtime_error(
+                                "Error when creating dynamics state derivative model, Munthe-Kaas rotational sub-steps "
+                                "are only supported for quaternion propagator." );
+                }
+            }
+        }
     }
 
 
@@ -147,91 +181,33 @@ public:
     {
 //        std::cout << "Computing state derivative: " <<time<<" "<<state.transpose( ) << std::endl;
 
-        // Initialize state derivative
-        if( stateDerivative_.rows( ) != state.rows( ) || stateDerivative_.cols( ) != state.cols( )  )
-        {
-            stateDerivative_.resize( state.rows( ), state.cols( ) );
-        }
-
-        // If dynamical equations are integrated, update the environment with the current state.
-        if( evaluateDynamicsEquations_ )
-        {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-            {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    stateDerivativeModelsIterator_->second.at( i )->clearStateDerivativeModel( );
-                }
-            }
-
-            convertCurrentStateToGlobalRepresentationPerType( state, time, evaluateVariationalEquations_ );
-            environmentUpdateFunction_( time, currentStatesPerTypeInConventionalRepresentation_,
-                                        integratedStatesFromEnvironment_ );
-        }
-        else
-        {
-            environmentUpdateFunction_(
-                        time, std::unordered_map<
-                        IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
-                        integratedStatesFromEnvironment_ );
-        }
-
-        if( evaluateVariationalEquations_ )
-        {
-            variationalEquations_->clearPartials( );
-        }
-
-        // If dynamical equations are integrated, evaluate dynamics state derivatives.
-        std::pair< int, int > currentIndices;
-        if( evaluateDynamicsEquations_ )
-        {
-            // Iterate over all types of equations.
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-            {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Update state derivative models
-                    stateDerivativeModelsIterator_->second.at( i )->updateStateDerivativeModel( time );
-                }
-            }
-
-            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
-                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
-                 stateDerivativeModelsIterator_++ )
-            {
-                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
-                {
-                    // Evaluate and set current dynamical state derivative
-                    currentIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
-
-                    stateDerivativeModelsIterator_->second.at( i )->calculateSystemStateDerivative(
-                                time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
-                                stateDerivative_.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
-                }
-            }
-        }
+        evaluateStateDerivative( time, state );
+        return stateDerivative_;
+    }
 
-        // If variational equations are to be integrated: evaluate and set.
+    //! Function to calculate the system state derivative for a fixed-size state vector.
+    /*!
+     *  Function to calculate the system state derivative for a fixed-size state vector, for use in the fixed-size
+     *  propagation of a single body (e.g. with 6 or 7 propagated state elements). The input state is copied to a
+     *  pre-allocated dynamic-size buffer, which is passed to evaluateStateDerivative, and the first StateSize entries of
+     *  the resulting state derivative are returned. The state derivative models themselves therefore still operate on
+     *  dynamic-size vectors. Variational equations cannot be evaluated with this function.
+     *  \param time Current time.
+     *  \param state Current complete state.
+     *  \return Calculated state derivative.
+     */
+    template< int StateSize >
+    Eigen::Matrix< StateScalarType, StateSize, 1 > computeFixedSizeStateDerivative(
+            const TimeType time, const Eigen::Matrix< StateScalarType, StateSize, 1 >& state )
+    {
         if( evaluateVariationalEquations_ )
         {
-            variationalEquations_->updatePartials( time, currentStatesPerTypeInConventionalRepresentation_ );
-
-            variationalEquations_->evaluateVariationalEquations< StateScalarType >(
-                        time, state.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ),
-                        stateDerivative_.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ) );
+            throw std::runtime_error( "Error when computing fixed-size state derivative, variational equations cannot be evaluated." );
         }
 
-        // Update counters
-        functionEvaluationCounter_++;
-        cumulativeFunctionEvaluationCounter_[ time ] = functionEvaluationCounter_;
-
-        return stateDerivative_;
-
+        fixedSizeStateBuffer_ = state;
+        evaluateStateDerivative( time, fixedSizeStateBuffer_ );
+        return stateDerivative_.template topLeftCorner< StateSize, 1 >( );
     }
 
     //! Function to calculate the system state derivative with double precision, regardless of template arguments.
@@ -382,6 +358,21 @@ public:
         }
     }
 
+    //! Function to process the fixed-size state vector during propagation.
+    /*!
+     * Function to process the fixed-size state vector during propagation.
+     * \sa computeFixedSizeStateDerivative
+     * \param unprocessedState State before processing.
+     * \return Processed state (returned by reference).
+     */
+    template< int StateSize >
+    void postProcessFixedSizeState( Eigen::Matrix< StateScalarType, StateSize, 1 >& unprocessedState )
+    {
+        fixedSizePostProcessingBuffer_ = unprocessedState;
+        postProcessState( fixedSizePostProcessingBuffer_ );
+        unprocessedState = fixedSizePostProcessingBuffer_;
+    }
+
     //! Function to process the state vector and variational equations during propagation.
     /*!
      * Function to process the state vector and variational equations during propagation.
@@ -436,18 +427,27 @@ public:
             const bool evaluateDynamicsEquations,
             const bool evaluateVariationalEquations )
     {
+        if( evaluateVariationalEquations && rotationalSubCyclingSettings_ != nullptr )
+        {
+            throw std::runtime_error( "Error, variational equations cannot be propagated with sub-cycled rotational dynamics." );
+        }
+
         integratedStatesFromEnvironment_ = stateTypesToNotIntegrate;
         evaluateDynamicsEquations_ = evaluateDynamicsEquations;
         evaluateVariationalEquations_ = evaluateVariationalEquations;
 
         if( evaluateVariationalEquations_ )
         {
-            dynamicsStartColumn_ = variationalEquations_->getNumberOfParameterValues( );
+            dynamicsStartColumn_ = variationalEquations_->getNumberOfIntegratedColumns( );
         }
         else
         {
             dynamicsStartColumn_ = 0;
         }
+
+        // Clear history of multi-rate acceleration evaluation and sub-cycled rotational state from any previous propagation.
+        resetMultiRateAccelerationEvaluators( false );
+        resetSubCycledRotationalStateExtrapolation( );
     }
 
     //! Function to update the settings of the state derivative models with new initial states
@@ -575,8 +575,670 @@ public:
         cumulativeFunctionEvaluationCounter_.clear( );
     }
 
+    //! Function to set the object used to profile the computation time of the state derivative evaluation.
+    /*!
+     * Function to set the object used to profile the computation time of the state derivative evaluation. The profiler
+     * is passed to all state derivative models (which register their individual models), and is used to time the
+     * complete evaluation, the environment update, the update of the state derivative models and the variational
+     * equations. Note that the individual environment update functions are profiled by the EnvironmentUpdater, which
+     * is not accessible from this class, and for which the profiler must be set separately.
+     * \param propagationProfiler Object used to profile the computation time (nullptr to disable profiling).
+     */
+    void setPropagationProfiler( const std::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        propagationProfiler_ = propagationProfiler;
+        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+             stateDerivativeModelsIterator_++ )
+        {
+            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+            {
+                stateDerivativeModelsIterator_->second.at( i )->setPropagationProfiler( propagationProfiler );
+            }
+        }
+
+        if( propagationProfiler != nullptr )
+        {
+            totalEvaluationProfilingIndex_ = propagationProfiler->registerComputation(
+                        "Total: state derivative evaluation" );
+            environmentUpdateProfilingIndex_ = propagationProfiler->registerComputation(
+                        "Total: environment update" );
+            modelUpdateProfilingIndex_ = propagationProfiler->registerComputation(
+                        "Total: state derivative model update" );
+            partialsUpdateProfilingIndex_ = propagationProfiler->registerComputation(
+                        "Variational equations: partials update" );
+            variationalEquationsProfilingIndex_ = propagationProfiler->registerComputation(
+                        "Variational equations: evaluation" );
+        }
+    }
+
+    //! Function to retrieve the object used to profile the computation time of the state derivative evaluation.
+    /*!
+     * Function to retrieve the object used to profile the computation time of the state derivative evaluation.
+     * \return Object used to profile the computation time (nullptr if not profiled).
+     */
+    std::shared_ptr< PropagationProfiler > getPropagationProfiler( )
+    {
+        return propagationProfiler_;
+    }
+
+    //! Function to check whether the rotational dynamics is sub-cycled inside the integration steps.
+    /*!
+     * Function to check whether the rotational dynamics is sub-cycled inside the integration steps (see
+     * RotationalSubCyclingSettings). If so, the rotational state derivative returned by computeStateDerivative is zero,
+     * and the rotational state is to be updated after each integration step by updateSubCycledRotationalState.
+     * \return True if the rotational dynamics is sub-cycled.
+     */
+    bool isRotationalStateSubCycled( )
+    {
+        return ( rotationalSubCyclingSettings_ != nullptr );
+    }
+
+    //! Function to check whether any of the translational state derivative models uses multi-rate acceleration evaluation.
+    /*!
+     * Function to check whether any of the translational state derivative models uses multi-rate acceleration evaluation
+     * (see MultiRateAccelerationEvaluator).
+     * \return True if multi-rate acceleration evaluation is used.
+     */
+    bool isMultiRateAccelerationEvaluationUsed( )
+    {
+        return ( getMultiRateAccelerationEvaluators( ).size( ) > 0 );
+    }
+
+    //! Function to reset the multi-rate acceleration evaluators of all translational state derivative models.
+    /*!
+     * Function to reset the multi-rate acceleration evaluators of all translational state derivative models, so that the
+     * next state derivative evaluation performs full evaluations of all slow accelerations. This function is called by
+     * setPropagationSettings, with full evaluations performed whenever the update interval has elapsed. If the
+     * propagation calls signalAcceptedStepToMultiRateAccelerationEvaluators after each accepted integration step, this
+     * function should subsequently be called with updateAtAcceptedStatesOnly set to true, so that intermediate stages and
+     * rejected steps of the integrator do not enter the approximation of the slow accelerations.
+     * \param updateAtAcceptedStatesOnly Boolean denoting whether full evaluations (after the first one) are only to be
+     * performed at accepted states.
+     */
+    void resetMultiRateAccelerationEvaluators( const bool updateAtAcceptedStatesOnly )
+    {
+        std::vector< std::shared_ptr< MultiRateAccelerationEvaluator > > multiRateAccelerationEvaluators =
+                getMultiRateAccelerationEvaluators( );
+        for( unsigned int i = 0; i < multiRateAccelerationEvaluators.size( ); i++ )
+        {
+            multiRateAccelerationEvaluators.at( i )->reset( );
+            multiRateAccelerationEvaluators.at( i )->setUpdateAtAcceptedStatesOnly( updateAtAcceptedStatesOnly );
+        }
+    }
+
+    //! Function to signal an accepted integration step to the multi-rate acceleration evaluators.
+    /*!
+     * Function to signal an accepted integration step to the multi-rate acceleration evaluators of all translational state
+     * derivative models, so that the slow accelerations may be fully evaluated at the next state derivative evaluation
+     * (see MultiRateAccelerationEvaluator::signalAcceptedStep). No additional state derivative evaluation is performed.
+     */
+    void signalAcceptedStepToMultiRateAccelerationEvaluators( )
+    {
+        if( stateDerivativeModels_.count( translational_state ) > 0 )
+        {
+            for( unsigned int i = 0; i < stateDerivativeModels_.at( translational_state ).size( ); i++ )
+            {
+                std::shared_ptr< MultiRateAccelerationEvaluator > multiRateAccelerationEvaluator =
+                        getMultiRateAccelerationEvaluator( i );
+                if( multiRateAccelerationEvaluator != nullptr )
+                {
+                    multiRateAccelerationEvaluator->signalAcceptedStep( );
+                }
+            }
+        }
+    }
+
+    //! Function to check whether the environment updates that only the slow multi-rate accelerations need are required.
+    /*!
+     * Function to check whether the environment updates that are only needed by the slow accelerations of the multi-rate
+     * acceleration evaluators are required for the next state derivative evaluation at the given time, i.e. if any of the
+     * evaluators performs a full evaluation at that time. Always true if no multi-rate acceleration evaluation is used,
+     * or if the variational equations are evaluated (as the partials of all accelerations are then computed).
+     * \param time Time at which the next state derivative evaluation is performed.
+     * \return True if the environment updates of the slow accelerations are required.
+     */
+    bool areSlowAccelerationEnvironmentUpdatesRequired( const TimeType time )
+    {
+        if( evaluateVariationalEquations_ || !evaluateDynamicsEquations_ )
+        {
+            return true;
+        }
+
+        bool isMultiRateAccelerationEvaluationUsed = false;
+        if( stateDerivativeModels_.count( translational_state ) > 0 )
+        {
+            for( unsigned int i = 0; i < stateDerivativeModels_.at( translational_state ).size( ); i++ )
+            {
+                std::shared_ptr< MultiRateAccelerationEvaluator > multiRateAccelerationEvaluator =
+                        getMultiRateAccelerationEvaluator( i );
+                if( multiRateAccelerationEvaluator != nullptr )
+                {
+                    if( multiRateAccelerationEvaluator->isFullEvaluationToBePerformed( static_cast< double >( time ) ) )
+                    {
+                        return true;
+                    }
+                    isMultiRateAccelerationEvaluationUsed = true;
+                }
+            }
+        }
+        return !isMultiRateAccelerationEvaluationUsed;
+    }
+
+    //! Function to reset the extrapolation of the sub-cycled rotational state inside the integration steps.
+    /*!
+     * Function to reset the extrapolation of the sub-cycled rotational state inside the integration steps (see
+     * updateSubCycledRotationalState), so that the next state derivative evaluation is used as the start of the
+     * extrapolation. To be called before the start of each propagation (done by setPropagationSettings).
+     */
+    void resetSubCycledRotationalStateExtrapolation( )
+    {
+        subCycleExtrapolationRotationalState_.resize( 0 );
+        subCycleExtrapolationRotationalStateDerivative_.resize( 0 );
+        subCycleExtrapolationTime_ = TUDAT_NAN;
+    }
+
+    //! Function to integrate the sub-cycled rotational state over a single integration step.
+    /*!
+     * Function to integrate the sub-cycled rotational state over a single integration step, using a fixed number of
+     * fourth-order Runge-Kutta or Runge-Kutta-Munthe-Kaas sub-steps (see RotationalSubCyclingSettings). During the sub-steps, the remaining states
+     * are interpolated inside the step from the states and state derivatives at its boundaries (cubic Hermite
+     * interpolation), and passed to the torque models through the environment update. Only the rotational state
+     * derivative models are evaluated in the sub-steps.
+     * After the sub-steps, the rotational state derivative is evaluated at the end of the step. During the next
+     * integration step, in which the numerical integrator keeps the rotational state constant, the remaining state
+     * derivative models are evaluated with the rotational state extrapolated from this state and state derivative
+     * (see getStateWithExtrapolatedSubCycledRotationalState). Without this extrapolation, the remaining dynamics would
+     * see the rotational state at the start of each step, which limits the coupling between the rotational and the
+     * remaining dynamics to first order in the step size. Note that the error in the rotational state (and in its
+     * extrapolation) is not included in the step-size control of the numerical integrator.
+     * \param previousTime Time at start of integration step.
+     * \param previousState State at start of integration step.
+     * \param currentTime Time at end of integration step.
+     * \param currentState State at end of integration step, as computed by the numerical integrator. The rotational
+     * part of the state is replaced by the sub-cycled rotational state (returned by reference).
+     * \param previousStateDerivative State derivative at start of integration step (if empty, the remaining states are
+     * linearly interpolated inside the step).
+     * \param currentStateDerivative State derivative at end of integration step (if empty, the remaining states are
+     * linearly interpolated inside the step).
+     */
+    void updateSubCycledRotationalState(
+            const TimeType previousTime,
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& previousState,
+            const TimeType currentTime,
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& currentState,
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& previousStateDerivative,
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& currentStateDerivative )
+    {
+        if( rotationalSubCyclingSettings_ == nullptr )
+        {
+            throw std::runtime_error( "Error when updating sub-cycled rotational state, no sub-cycling settings found." );
+        }
+
+        const int rotationalStateStartIndex = propagatedStateTypeStartIndex_.at( rotational_state );
+        const int rotationalStateSize = propagatedStateTypeSize_.at( rotational_state );
+
+        // Set boundary values of integration step, from which the remaining states are interpolated.
+        subCycleStepStartTime_ = previousTime;
+        subCycleStepSize_ = static_cast< double >( currentTime - previousTime );
+        subCycleStepInitialState_ = previousState;
+        subCycleStepFinalState_ = currentState;
+        subCycleUseStateDerivatives_ =
+                ( previousStateDerivative.rows( ) == previousState.rows( ) ) &&
+                ( currentStateDerivative.rows( ) == currentState.rows( ) );
+        if( subCycleUseStateDerivatives_ )
+        {
+            subCycleStepInitialStateDerivative_ = previousStateDerivative;
+            subCycleStepFinalStateDerivative_ = currentStateDerivative;
+        }
+        subCycleState_.resize( previousState.rows( ), 1 );
+        subCycleStateDerivative_.resize( rotationalStateSize, 1 );
+
+        // Integrate rotational state over integration step with fixed-size sub-steps.
+        const double subStepSize = subCycleStepSize_ / static_cast< double >( rotationalSubCyclingSettings_->numberOfSubSteps_ );
+        subCycleRotationalState_ = previousState.segment( rotationalStateStartIndex, rotationalStateSize );
+        for( unsigned int i = 0; i < rotationalSubCyclingSettings_->numberOfSubSteps_; i++ )
+        {
+            const double subStepStartTime = static_cast< double >( i ) * subStepSize;
+            switch( rotationalSubCyclingSettings_->subStepIntegratorType_ )
+            {
+            case runge_kutta_4_rotational_sub_step:
+                performRungeKutta4RotationalSubStep( subStepStartTime, subStepSize );
+                break;
+            case munthe_kaas_runge_kutta_4_rotational_sub_step:
+                performMuntheKaasRotationalSubStep( subStepStartTime, subStepSize );
+                break;
+            default:
+                throw std::runtime_error( "Error when updating sub-cycled rotational state, sub-step integrator type not recognized." );
+            }
+
+            // Post-process rotational state (e.g. normalize quaternions) after each sub-step.
+            for( unsigned int j = 0; j < stateDerivativeModels_.at( rotational_state ).size( ); j++ )
+            {
+                if( stateDerivativeModels_.at( rotational_state ).at( j )->isStateToBePostProcessed( ) )
+                {
+                    std::pair< int, int > currentIndices = propagatedStateIndices_.at( rotational_state ).at( j );
+                    stateDerivativeModels_.at( rotational_state ).at( j )->postProcessState(
+                                subCycleRotationalState_.block( currentIndices.first - rotationalStateStartIndex, 0,
+                                                                currentIndices.second, 1 ) );
+                }
+            }
+        }
+
+        currentState.segment( rotationalStateStartIndex, rotationalStateSize ) = subCycleRotationalState_;
+
+        // Evaluate rotational state derivative at end of step, from which rotational state is extrapolated in next step.
+        evaluateSubCycledRotationalStateDerivative( subCycleStepSize_, subCycleRotationalState_ );
+        subCycleExtrapolationTime_ = currentTime;
+        subCycleExtrapolationRotationalState_ = subCycleRotationalState_;
+        subCycleExtrapolationRotationalStateDerivative_ = subCycleStateDerivative_.col( 0 );
+    }
+
 private:
 
+    //! Function to retrieve the multi-rate acceleration evaluators of all translational state derivative models.
+    /*!
+     *  Function to retrieve the multi-rate acceleration evaluators of all translational state derivative models.
+     *  \return Multi-rate acceleration evaluators of all translational state derivative models that use one.
+     */
+    std::vector< std::shared_ptr< MultiRateAccelerationEvaluator > > getMultiRateAccelerationEvaluators( )
+    {
+        std::vector< std::shared_ptr< MultiRateAccelerationEvaluator > > multiRateAccelerationEvaluators;
+        if( stateDerivativeModels_.count( translational_state ) > 0 )
+        {
+            for( unsigned int i = 0; i < stateDerivativeModels_.at( translational_state ).size( ); i++ )
+            {
+                if( getMultiRateAccelerationEvaluator( i ) != nullptr )
+                {
+                    multiRateAccelerationEvaluators.push_back( getMultiRateAccelerationEvaluator( i ) );
+                }
+            }
+        }
+        return multiRateAccelerationEvaluators;
+    }
+
+    //! Function to retrieve the multi-rate acceleration evaluator of a single translational state derivative model.
+    /*!
+     *  Function to retrieve the multi-rate acceleration evaluator of a single translational state derivative model.
+     *  \param index Index of translational state derivative model in stateDerivativeModels_.
+     *  \return Multi-rate acceleration evaluator of translational state derivative model (nullptr if none).
+     */
+    std::shared_ptr< MultiRateAccelerationEvaluator > getMultiRateAccelerationEvaluator( const unsigned int index )
+    {
+        std::shared_ptr< NBodyStateDerivative< StateScalarType, TimeType > > translationalStateDerivative =
+                std::dynamic_pointer_cast< NBodyStateDerivative< StateScalarType, TimeType > >(
+                    stateDerivativeModels_.at( translational_state ).at( index ) );
+        return ( translationalStateDerivative == nullptr ) ?
+                    nullptr : translationalStateDerivative->getMultiRateAccelerationEvaluator( );
+    }
+
+    //! Function to perform a single fourth-order Runge-Kutta sub-step of the sub-cycled rotational state.
+    /*!
+     *  Function to perform a single fourth-order Runge-Kutta sub-step of the sub-cycled rotational state, updating the
+     *  subCycleRotationalState_ member variable.
+     *  \param subStepStartTime Time since the start of the integration step at the start of the sub-step.
+     *  \param subStepSize Size of the sub-step.
+     */
+    void performRungeKutta4RotationalSubStep( const double subStepStartTime, const double subStepSize )
+    {
+        const StateScalarType halfSubStep = static_cast< StateScalarType >( subStepSize / 2.0 );
+        const StateScalarType fullSubStep = static_cast< StateScalarType >( subStepSize );
+
+        subCycleIntermediateState_ = subCycleRotationalState_;
+        evaluateSubCycledRotationalStateDerivative( subStepStartTime, subCycleIntermediateState_ );
+        subCycleStageDerivatives_[ 0 ] = subCycleStateDerivative_.col( 0 );
+
+        subCycleIntermediateState_ = subCycleRotationalState_ + halfSubStep * subCycleStageDerivatives_[ 0 ];
+        evaluateSubCycledRotationalStateDerivative( subStepStartTime + subStepSize / 2.0, subCycleIntermediateState_ );
+        subCycleStageDerivatives_[ 1 ] = subCycleStateDerivative_.col( 0 );
+
+        subCycleIntermediateState_ = subCycleRotationalState_ + halfSubStep * subCycleStageDerivatives_[ 1 ];
+        evaluateSubCycledRotationalStateDerivative( subStepStartTime + subStepSize / 2.0, subCycleIntermediateState_ );
+        subCycleStageDerivatives_[ 2 ] = subCycleStateDerivative_.col( 0 );
+
+        subCycleIntermediateState_ = subCycleRotationalState_ + fullSubStep * subCycleStageDerivatives_[ 2 ];
+        evaluateSubCycledRotationalStateDerivative( subStepStartTime + subStepSize, subCycleIntermediateState_ );
+        subCycleStageDerivatives_[ 3 ] = subCycleStateDerivative_.col( 0 );
+
+        subCycleRotationalState_ += fullSubStep / static_cast< StateScalarType >( 6.0 ) * (
+                    subCycleStageDerivatives_[ 0 ] + static_cast< StateScalarType >( 2.0 ) * subCycleStageDerivatives_[ 1 ] +
+                    static_cast< StateScalarType >( 2.0 ) * subCycleStageDerivatives_[ 2 ] + subCycleStageDerivatives_[ 3 ] );
+    }
+
+    //! Function to perform a single Runge-Kutta-Munthe-Kaas sub-step of the sub-cycled (quaternion) rotational state.
+    /*!
+     *  Function to perform a single fourth-order Runge-Kutta-Munthe-Kaas sub-step of the sub-cycled rotational state,
+     *  updating the subCycleRotationalState_ member variable. The rotational state must consist of quaternion and angular
+     *  velocity of each body (7 entries per body). The rotation over the sub-step is written as q = q_0 * exp( theta ),
+     *  with theta the rotation vector in the body-fixed frame at the start of the sub-step. The classical fourth-order
+     *  Runge-Kutta tableau is applied to the rotation vector (with time derivative dexp^-1 of the angular velocity, see
+     *  calculateRotationVectorDerivative) and the angular velocity, and the quaternion is updated by quaternion
+     *  multiplication, so that it remains normalized by construction. The update of the rotation is computed in double
+     *  precision.
+     *  \param subStepStartTime Time since the start of the integration step at the start of the sub-step.
+     *  \param subStepSize Size of the sub-step.
+     */
+    void performMuntheKaasRotationalSubStep( const double subStepStartTime, const double subStepSize )
+    {
+        static const double stageTimeFractions[ 4 ] = { 0.0, 0.5, 0.5, 1.0 };
+
+        const int numberOfBodies = subCycleRotationalState_.rows( ) / 7;
+        Eigen::Vector4d initialQuaternion;
+        Eigen::Vector3d stageRotationVector;
+        Eigen::Vector3d stageAngularVelocity;
+
+        for( unsigned int i = 0; i < 4; i++ )
+        {
+            const double stageStepSize = stageTimeFractions[ i ] * subStepSize;
+
+            // Set rotational state at current stage, from rotation vector and angular velocity derivatives at previous stage.
+            subCycleIntermediateState_ = subCycleRotationalState_;
+            if( i > 0 )
+            {
+                subCycleIntermediateState_ += static_cast< StateScalarType >( stageStepSize ) *
+                        subCycleStageDerivatives_[ i - 1 ];
+            }
+            subCycleStageRotationVectorDerivatives_[ i ].resize( 3 * numberOfBodies );
+            for( int j = 0; j < numberOfBodies; j++ )
+            {
+                initialQuaternion = subCycleRotationalState_.segment( 7 * j, 4 ).template cast< double >( );
+                stageRotationVector = ( i > 0 ) ?
+                            Eigen::Vector3d( stageStepSize * subCycleStageRotationVectorDerivatives_[ i - 1 ].segment( 3 * j, 3 ) ) :
+                            Eigen::Vector3d::Zero( );
+                subCycleIntermediateState_.segment( 7 * j, 4 ) =
+                        multiplyQuaternions( initialQuaternion, convertRotationVectorToQuaternion( stageRotationVector ) ).
+                        template cast< StateScalarType >( );
+
+                stageAngularVelocity = subCycleIntermediateState_.segment( 7 * j + 4, 3 ).template cast< double >( );
+                subCycleStageRotationVectorDerivatives_[ i ].segment( 3 * j, 3 ) =
+                        calculateRotationVectorDerivative( stageRotationVector, stageAngularVelocity );
+            }
+
+            // Evaluate angular acceleration at current stage (quaternion rate is not used).
+            evaluateSubCycledRotationalStateDerivative( subStepStartTime + stageStepSize, subCycleIntermediateState_ );
+            subCycleStageDerivatives_[ i ] = subCycleStateDerivative_.col( 0 );
+        }
+
+        // Update angular velocity (quaternion entries overwritten below) and quaternion
+        subCycleIntermediateState_ = subCycleRotationalState_;
+        subCycleRotationalState_ += static_cast< StateScalarType >( subStepSize / 6.0 ) * (
+                    subCycleStageDerivatives_[ 0 ] + static_cast< StateScalarType >( 2.0 ) * subCycleStageDerivatives_[ 1 ] +
+                    static_cast< StateScalarType >( 2.0 ) * subCycleStageDerivatives_[ 2 ] + subCycleStageDerivatives_[ 3 ] );
+        for( int j = 0; j < numberOfBodies; j++ )
+        {
+            initialQuaternion = subCycleIntermediateState_.segment( 7 * j, 4 ).template cast< double >( );
+            stageRotationVector = subStepSize / 6.0 * (
+                        subCycleStageRotationVectorDerivatives_[ 0 ].segment( 3 * j, 3 ) +
+                    2.0 * subCycleStageRotationVectorDerivatives_[ 1 ].segment( 3 * j, 3 ) +
+                    2.0 * subCycleStageRotationVectorDerivatives_[ 2 ].segment( 3 * j, 3 ) +
+                    subCycleStageRotationVectorDerivatives_[ 3 ].segment( 3 * j, 3 ) );
+            subCycleRotationalState_.segment( 7 * j, 4 ) =
+                    multiplyQuaternions( initialQuaternion, convertRotationVectorToQuaternion( stageRotationVector ) ).
+                    template cast< StateScalarType >( );
+        }
+    }
+
+    //! Function to retrieve the state with the sub-cycled rotational state extrapolated inside the integration step.
+    /*!
+     *  Function to retrieve the state with the sub-cycled rotational state extrapolated inside the integration step,
+     *  for use in the evaluation of the state derivative. The numerical integrator keeps the rotational state constant
+     *  during each integration step (see updateSubCycledRotationalState). If the rotational part of the input state is
+     *  equal to this constant state, and the time differs from the start of the step, the rotational state at the
+     *  current time is extrapolated from the rotational state and state derivative at the start of the step. For
+     *  quaternion propagation, the rotation vector is extrapolated to second order in time from the angular velocity
+     *  and its derivative, and the quaternion is updated by quaternion multiplication, so that the extrapolated
+     *  quaternion remains normalized. For other propagators, the rotational state is extrapolated linearly.
+     *  In all other cases (e.g. at the start of the step, or at states inside the step that are interpolated for event
+     *  detection), the input state is returned unchanged.
+     *  \param time Current time.
+     *  \param state Current complete state, as provided by the numerical integrator.
+     *  \return State with extrapolated rotational state (reference to input state if not extrapolated).
+     */
+    const StateType& getStateWithExtrapolatedSubCycledRotationalState( const TimeType time, const StateType& state )
+    {
+        const int rotationalStateStartIndex = propagatedStateTypeStartIndex_.at( rotational_state );
+        const int rotationalStateSize = propagatedStateTypeSize_.at( rotational_state );
+        if( subCycleExtrapolationRotationalState_.rows( ) != rotationalStateSize || time == subCycleExtrapolationTime_ ||
+                !( state.block( rotationalStateStartIndex, 0, rotationalStateSize, 1 ) ==
+                   subCycleExtrapolationRotationalState_ ) )
+        {
+            return state;
+        }
+
+        const double timeSinceStepStart = static_cast< double >( time - subCycleExtrapolationTime_ );
+        subCycleExtrapolatedState_ = state;
+        Eigen::Vector4d initialQuaternion;
+        Eigen::Vector3d angularVelocity;
+        Eigen::Vector3d angularAcceleration;
+        for( unsigned int i = 0; i < stateDerivativeModels_.at( rotational_state ).size( ); i++ )
+        {
+            std::pair< int, int > currentIndices = propagatedStateIndices_.at( rotational_state ).at( i );
+            int currentStartIndex = currentIndices.first - rotationalStateStartIndex;
+            if( subCycledRotationalPropagatorTypes_.at( i ) == quaternions )
+            {
+                for( int j = 0; j < currentIndices.second / 7; j++ )
+                {
+                    initialQuaternion = subCycleExtrapolationRotationalState_.segment(
+                                currentStartIndex + 7 * j, 4 ).template cast< double >( );
+                    angularVelocity = subCycleExtrapolationRotationalState_.segment(
+                                currentStartIndex + 7 * j + 4, 3 ).template cast< double >( );
+                    angularAcceleration = subCycleExtrapolationRotationalStateDerivative_.segment(
+                                currentStartIndex + 7 * j + 4, 3 ).template cast< double >( );
+
+                    subCycleExtrapolatedState_.block( currentIndices.first + 7 * j, 0, 4, 1 ) = multiplyQuaternions(
+                                initialQuaternion, convertRotationVectorToQuaternion(
+                                    timeSinceStepStart * angularVelocity +
+                                    0.5 * timeSinceStepStart * timeSinceStepStart * angularAcceleration ) ).
+                            template cast< StateScalarType >( );
+                    subCycleExtrapolatedState_.block( currentIndices.first + 7 * j + 4, 0, 3, 1 ) =
+                            ( angularVelocity + timeSinceStepStart * angularAcceleration ).template cast< StateScalarType >( );
+                }
+            }
+            else
+            {
+                subCycleExtrapolatedState_.block( currentIndices.first, 0, currentIndices.second, 1 ) =
+                        subCycleExtrapolationRotationalState_.segment( currentStartIndex, currentIndices.second ) +
+                        static_cast< StateScalarType >( timeSinceStepStart ) *
+                        subCycleExtrapolationRotationalStateDerivative_.segment( currentStartIndex, currentIndices.second );
+            }
+        }
+        return subCycleExtrapolatedState_;
+    }
+
+    //! Function to evaluate the rotational state derivative inside a sub-cycled integration step.
+    /*!
+     *  Function to evaluate the rotational state derivative inside a sub-cycled integration step, and set it in the
+     *  subCycleStateDerivative_ member variable. The remaining states are interpolated inside the step, and the environment
+     *  is updated to the full interpolated state, after which only the rotational state derivative models are evaluated.
+     *  \sa updateSubCycledRotationalState
+     *  \param timeSinceStepStart Time since the start of the integration step.
+     *  \param rotationalState Current rotational state (in propagator-specific form).
+     */
+    void evaluateSubCycledRotationalStateDerivative(
+            const double timeSinceStepStart, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& rotationalState )
+    {
+        const int rotationalStateStartIndex = propagatedStateTypeStartIndex_.at( rotational_state );
+        const TimeType time = subCycleStepStartTime_ + timeSinceStepStart;
+
+        // Interpolate remaining states inside integration step
+        const double fraction = ( subCycleStepSize_ == 0.0 ) ? 0.0 : timeSinceStepStart / subCycleStepSize_;
+        if( subCycleUseStateDerivatives_ )
+        {
+            const double fractionSquared = fraction * fraction;
+            const double fractionCubed = fractionSquared * fraction;
+            subCycleState_ =
+                    static_cast< StateScalarType >( 2.0 * fractionCubed - 3.0 * fractionSquared + 1.0 ) *
+                    subCycleStepInitialState_ +
+                    static_cast< StateScalarType >( -2.0 * fractionCubed + 3.0 * fractionSquared ) *
+                    subCycleStepFinalState_ +
+                    static_cast< StateScalarType >( ( fractionCubed - 2.0 * fractionSquared + fraction ) * subCycleStepSize_ ) *
+                    subCycleStepInitialStateDerivative_ +
+                    static_cast< StateScalarType >( ( fractionCubed - fractionSquared ) * subCycleStepSize_ ) *
+                    subCycleStepFinalStateDerivative_;
+        }
+        else
+        {
+            subCycleState_ = static_cast< StateScalarType >( 1.0 - fraction ) * subCycleStepInitialState_ +
+                    static_cast< StateScalarType >( fraction ) * subCycleStepFinalState_;
+        }
+        subCycleState_.block( rotationalStateStartIndex, 0, rotationalState.rows( ), 1 ) = rotationalState;
+
+        // Update environment to interpolated state
+        for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+             stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+             stateDerivativeModelsIterator_++ )
+        {
+            for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+            {
+                stateDerivativeModelsIterator_->second.at( i )->clearStateDerivativeModel( );
+            }
+        }
+        convertCurrentStateToGlobalRepresentationPerType( subCycleState_, time, false );
+        environmentUpdateFunction_( time, currentStatesPerTypeInConventionalRepresentation_,
+                                    integratedStatesFromEnvironment_ );
+
+        // Evaluate rotational state derivative
+        std::pair< int, int > currentIndices;
+        for( unsigned int i = 0; i < stateDerivativeModels_.at( rotational_state ).size( ); i++ )
+        {
+            currentIndices = propagatedStateIndices_.at( rotational_state ).at( i );
+            stateDerivativeModels_.at( rotational_state ).at( i )->updateStateDerivativeModel( time );
+            stateDerivativeModels_.at( rotational_state ).at( i )->calculateSystemStateDerivative(
+                        time, subCycleState_.block( currentIndices.first, 0, currentIndices.second, 1 ),
+                        subCycleStateDerivative_.block( currentIndices.first - rotationalStateStartIndex, 0,
+                                                        currentIndices.second, 1 ) );
+        }
+    }
+
+    //! Function to evaluate the system state derivative, and set it in the stateDerivative_ member variable.
+    /*!
+     *  Function to evaluate the system state derivative, and set it in the stateDerivative_ member variable.
+     *  \sa computeStateDerivative
+     *  \param time Current time.
+     *  \param inputState Current complete state (with sub-cycled rotational state extrapolated inside the integration
+     *  step, see getStateWithExtrapolatedSubCycledRotationalState).
+     */
+    void evaluateStateDerivative( const TimeType time, const StateType& inputState )
+    {
+        PropagationProfiler* profiler = propagationProfiler_.get( );
+        ScopedProfilingTimer totalProfilingTimer( profiler, totalEvaluationProfilingIndex_ );
+
+        // Extrapolate sub-cycled rotational state, which is kept constant by the integrator, inside integration step
+        const StateType& state = ( rotationalSubCyclingSettings_ != nullptr ) ?
+                    getStateWithExtrapolatedSubCycledRotationalState( time, inputState ) : inputState;
+
+        // Initialize state derivative
+        if( stateDerivative_.rows( ) != state.rows( ) || stateDerivative_.cols( ) != state.cols( )  )
+        {
+            stateDerivative_.resize( state.rows( ), state.cols( ) );
+        }
+
+        // If dynamical equations are integrated, update the environment with the current state.
+        if( evaluateDynamicsEquations_ )
+        {
+            // Iterate over all types of equations.
+            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+                 stateDerivativeModelsIterator_++ )
+            {
+                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+                {
+                    stateDerivativeModelsIterator_->second.at( i )->clearStateDerivativeModel( );
+                }
+            }
+
+            convertCurrentStateToGlobalRepresentationPerType( state, time, evaluateVariationalEquations_ );
+
+            ScopedProfilingTimer profilingTimer( profiler, environmentUpdateProfilingIndex_ );
+            environmentUpdateFunction_( time, currentStatesPerTypeInConventionalRepresentation_,
+                                        integratedStatesFromEnvironment_ );
+        }
+        else
+        {
+            ScopedProfilingTimer profilingTimer( profiler, environmentUpdateProfilingIndex_ );
+            environmentUpdateFunction_(
+                        time, std::unordered_map<
+                        IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
+                        integratedStatesFromEnvironment_ );
+        }
+
+        if( evaluateVariationalEquations_ )
+        {
+            variationalEquations_->clearPartials( );
+        }
+
+        // If dynamical equations are integrated, evaluate dynamics state derivatives.
+        std::pair< int, int > currentIndices;
+        if( evaluateDynamicsEquations_ )
+        {
+            {
+                ScopedProfilingTimer profilingTimer( profiler, modelUpdateProfilingIndex_ );
+
+                // Iterate over all types of equations.
+                for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+                     stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+                     stateDerivativeModelsIterator_++ )
+                {
+                    for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+                    {
+                        // Update state derivative models
+                        stateDerivativeModelsIterator_->second.at( i )->updateStateDerivativeModel( time );
+                    }
+                }
+            }
+
+            for( stateDerivativeModelsIterator_ = stateDerivativeModels_.begin( );
+                 stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
+                 stateDerivativeModelsIterator_++ )
+            {
+                for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
+                {
+                    // Evaluate and set current dynamical state derivative
+                    currentIndices = propagatedStateIndices_.at( stateDerivativeModelsIterator_->first ).at( i );
+
+                    stateDerivativeModelsIterator_->second.at( i )->calculateSystemStateDerivative(
+                                time, state.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ),
+                                stateDerivative_.block( currentIndices.first, dynamicsStartColumn_, currentIndices.second, 1 ) );
+                }
+            }
+
+            // Rotational state is kept constant by the integrator if it is sub-cycled (see updateSubCycledRotationalState).
+            // If no extrapolation has been set yet (start of propagation), it starts from the current evaluation.
+            if( rotationalSubCyclingSettings_ != nullptr )
+            {
+                const int rotationalStateStartIndex = propagatedStateTypeStartIndex_.at( rotational_state );
+                const int rotationalStateSize = propagatedStateTypeSize_.at( rotational_state );
+                if( subCycleExtrapolationRotationalState_.rows( ) != rotationalStateSize )
+                {
+                    subCycleExtrapolationTime_ = time;
+                    subCycleExtrapolationRotationalState_ =
+                            state.block( rotationalStateStartIndex, dynamicsStartColumn_, rotationalStateSize, 1 );
+                    subCycleExtrapolationRotationalStateDerivative_ =
+                            stateDerivative_.block( rotationalStateStartIndex, dynamicsStartColumn_, rotationalStateSize, 1 );
+                }
+                stateDerivative_.block( rotationalStateStartIndex, dynamicsStartColumn_, rotationalStateSize, 1 ).setZero( );
+            }
+        }
+
+        // If variational equations are to be integrated: evaluate and set.
+        if( evaluateVariationalEquations_ )
+        {
+            {
+                ScopedProfilingTimer profilingTimer( profiler, partialsUpdateProfilingIndex_ );
+                variationalEquations_->updatePartials( time, currentStatesPerTypeInConventionalRepresentation_ );
+            }
+
+            ScopedProfilingTimer profilingTimer( profiler, variationalEquationsProfilingIndex_ );
+            variationalEquations_->evaluateVariationalEquations< StateScalarType >(
+                        time, state.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfIntegratedColumns( ) ),
+                        stateDerivative_.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfIntegratedColumns( ) ) );
+        }
+
+        // Update counters
+        functionEvaluationCounter_++;
+        cumulativeFunctionEvaluationCounter_[ time ] = functionEvaluationCounter_;
+    }
+
     //! Function to convert the to the conventional form in the global frame per dynamics type.
     /*!
      * Function to convert the propagator-specific form of the state to the conventional form in the global frame, split
@@ -597,7 +1259,7 @@ private:
         int startColumn = 0;
         if( stateIncludesVariationalState )
         {
-            startColumn = variationalEquations_->getNumberOfParameterValues( );
+            startColumn = variationalEquations_->getNumberOfIntegratedColumns( );
         }
         else
         {
@@ -691,6 +1353,12 @@ private:
     //! Current state derivative, as computed by computeStateDerivative.
     StateType stateDerivative_;
 
+    //! Pre-allocated state, used as input to evaluateStateDerivative by computeFixedSizeStateDerivative.
+    StateType fixedSizeStateBuffer_;
+
+    //! Pre-allocated state, used as input to postProcessState by postProcessFixedSizeState.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > fixedSizePostProcessingBuffer_;
+
     //! Current state in 'conventional' representation, computed from current propagated state by
     //! convertCurrentStateToGlobalRepresentationPerType
     std::unordered_map< IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
@@ -701,6 +1369,74 @@ private:
 
     //! Variable to keep track of the number of calls to the computeStateDerivative function per time step
     std::map< TimeType, unsigned int > cumulativeFunctionEvaluationCounter_;
+
+    //! Object used to profile the computation time of the state derivative evaluation (nullptr if not profiled).
+    std::shared_ptr< PropagationProfiler > propagationProfiler_;
+
+    //! Profiling index of the complete state derivative evaluation.
+    int totalEvaluationProfilingIndex_ = -1;
+
+    //! Profiling index of the environment update.
+    int environmentUpdateProfilingIndex_ = -1;
+
+    //! Profiling index of the update of the state derivative models.
+    int modelUpdateProfilingIndex_ = -1;
+
+    //! Profiling index of the update of the state derivative partials.
+    int partialsUpdateProfilingIndex_ = -1;
+
+    //! Profiling index of the evaluation of the variational equations.
+    int variationalEquationsProfilingIndex_ = -1;
+
+    //! Settings for sub-cycling of the rotational dynamics (nullptr if not sub-cycled).
+    std::shared_ptr< RotationalSubCyclingSettings > rotationalSubCyclingSettings_;
+
+    //! Time at start of integration step through which the rotational state is currently sub-cycled.
+    TimeType subCycleStepStartTime_;
+
+    //! Size of integration step through which the rotational state is currently sub-cycled.
+    double subCycleStepSize_;
+
+    //! Boolean denoting whether the boundary state derivatives are used to interpolate the states in sub-cycled step.
+    bool subCycleUseStateDerivatives_;
+
+    //! States at start and end of integration step through which the rotational state is currently sub-cycled.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > subCycleStepInitialState_;
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > subCycleStepFinalState_;
+
+    //! State derivatives at start and end of integration step through which the rotational state is currently sub-cycled.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > subCycleStepInitialStateDerivative_;
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > subCycleStepFinalStateDerivative_;
+
+    //! Pre-allocated full (interpolated) state, used in evaluateSubCycledRotationalStateDerivative.
+    StateType subCycleState_;
+
+    //! Rotational state derivative, as computed by evaluateSubCycledRotationalStateDerivative.
+    StateType subCycleStateDerivative_;
+
+    //! Current sub-cycled rotational state, and intermediate state at current RK4 stage.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > subCycleRotationalState_;
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > subCycleIntermediateState_;
+
+    //! Rotational state derivatives at the four RK4 stages of the current sub-step.
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > subCycleStageDerivatives_[ 4 ];
+
+    //! Rotation vector derivatives (concatenated for all bodies) at the four stages of the current Munthe-Kaas sub-step.
+    Eigen::VectorXd subCycleStageRotationVectorDerivatives_[ 4 ];
+
+    //! Propagator types of the rotational state derivative models (if sub-cycled).
+    std::vector< RotationalPropagatorType > subCycledRotationalPropagatorTypes_;
+
+    //! Time at start of current integration step, from which the sub-cycled rotational state is extrapolated.
+    TimeType subCycleExtrapolationTime_ = TUDAT_NAN;
+
+    //! Rotational state and state derivative at start of current integration step, from which the sub-cycled rotational
+    //! state is extrapolated (empty if not yet set).
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > subCycleExtrapolationRotationalState_;
+    Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > subCycleExtrapolationRotationalStateDerivative_;
+
+    //! Pre-allocated state with extrapolated rotational state, returned by getStateWithExtrapolatedSubCycledRotationalState.
+    StateType subCycleExtrapolatedState_;
 };
 
 extern template class DynamicsStateDerivativeModel< double, double >;
@@ -9,6 +9,7 @@
  */
 
 #include <algorithm>
+#include <stdexcept>
 #include "Tudat/Astrodynamics/Propagators/environmentUpdateTypes.h"
 
 namespace tudat
@@ -60,6 +61,69 @@ void addEnvironmentUpdates( std::map< propagators::EnvironmentModelsToUpdate,
     }
 }
 
+//! Function to remove entries from an existing list of required environment update types
+void removeEnvironmentUpdates( std::map< propagators::EnvironmentModelsToUpdate,
+                               std::vector< std::string > >& environmentUpdateList,
+                               const std::map< propagators::EnvironmentModelsToUpdate,
+                               std::vector< std::string > >& updatesToRemove )
+{
+    // Iterate over all environment update types that are to be removed.
+    for( std::map< propagators::EnvironmentModelsToUpdate,
+             std::vector< std::string > >::const_iterator
+         environmentUpdateIterator = updatesToRemove.begin( );
+         environmentUpdateIterator != updatesToRemove.end( ); environmentUpdateIterator++ )
+    {
+        if( environmentUpdateList.count( environmentUpdateIterator->first ) > 0 )
+        {
+            // Remove all bodies that are in list of updates to remove.
+            std::vector< std::string >& updatedBodies = environmentUpdateList.at( environmentUpdateIterator->first );
+            for( unsigned int i = 0; i < environmentUpdateIterator->second.size( ); i++ )
+            {
+                updatedBodies.erase( std::remove( updatedBodies.begin( ), updatedBodies.end( ),
+                                                  environmentUpdateIterator->second.at( i ) ),
+                                     updatedBodies.end( ) );
+            }
+
+            // Remove update type if no bodies remain.
+            if( updatedBodies.size( ) == 0 )
+            {
+                environmentUpdateList.erase( environmentUpdateIterator->first );
+            }
+        }
+    }
+}
+
+//! Function to get a string representing a 'named identification' of an environment update type.
+std::string getEnvironmentUpdateTypeName( const EnvironmentModelsToUpdate environmentUpdateType )
+{
+    std::string environmentUpdateName;
+    switch( environmentUpdateType )
+    {
+    case body_translational_state_update:
+        environmentUpdateName = "translational state ";
+        break;
+    case body_rotational_state_update:
+        environmentUpdateName = "rotational state ";
+        break;
+    case body_mass_update:
+        environmentUpdateName = "body mass ";
+        break;
+    case spherical_harmonic_gravity_field_update:
+        environmentUpdateName = "spherical harmonic gravity field ";
+        break;
+    case vehicle_flight_conditions_update:
+        environmentUpdateName = "flight conditions ";
+        break;
+    case radiation_pressure_interface_update:
+        environmentUpdateName = "radiation pressure interface ";
+        break;
+    default:
+        throw std::runtime_error( "Error, environment update type " + std::to_string( environmentUpdateType ) +
+                                  " not found when retrieving environment update name " );
+    }
+    return environmentUpdateName;
+}
+
 
 }
 
@@ -46,6 +46,28 @@ void addEnvironmentUpdates(
         const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >
         updatesToAdd );
 
+//! Function to remove entries from an existing list of required environment update types
+/*!
+ * Function to remove entries from an existing list of required environment update types. Update types for which no
+ * bodies remain after the removal are erased from the list.
+ * \param environmentUpdateList List of environment updates from which entries are to be removed
+ * (passed by reference and modified by function)
+ * \param updatesToRemove List of environment updates that are to be removed from environmentUpdateList
+ */
+void removeEnvironmentUpdates(
+        std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >&
+        environmentUpdateList,
+        const std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >&
+        updatesToRemove );
+
+//! Function to get a string representing a 'named identification' of an environment update type.
+/*!
+ * Function to get a string representing a 'named identification' of an environment update type.
+ * \param environmentUpdateType Type of environment update.
+ * \return String with environment update id.
+ */
+std::string getEnvironmentUpdateTypeName( const EnvironmentModelsToUpdate environmentUpdateType );
+
 } // namespace propagators
 
 } // namespace tudat
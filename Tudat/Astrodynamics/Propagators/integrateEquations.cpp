@@ -18,7 +18,14 @@ Eigen::MatrixXd, double, double >(
         const std::function< void( Eigen::MatrixXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::function< void( const double, const Eigen::MatrixXd&, const Eigen::VectorXd& ) > savedStepOutputFunction,
+        const bool saveHistoryInMemory,
+        const std::shared_ptr< PropagationEventDetector< Eigen::MatrixXd, double, double > > eventDetector,
+        const std::function< void( const double, const Eigen::MatrixXd&, const double, Eigen::MatrixXd&,
+                                   const Eigen::MatrixXd&, const Eigen::MatrixXd& ) > subCycledStateUpdateFunction,
+        const std::function< void( const double ) > savedStepStateDerivativeFunction,
+        const std::function< void( const double ) > acceptedStepFunction );
 
 template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
 Eigen::VectorXd, double, double >(
@@ -32,7 +39,14 @@ Eigen::VectorXd, double, double >(
         const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::function< void( const double, const Eigen::VectorXd&, const Eigen::VectorXd& ) > savedStepOutputFunction,
+        const bool saveHistoryInMemory,
+        const std::shared_ptr< PropagationEventDetector< Eigen::VectorXd, double, double > > eventDetector,
+        const std::function< void( const double, const Eigen::VectorXd&, const double, Eigen::VectorXd&,
+                                   const Eigen::VectorXd&, const Eigen::VectorXd& ) > subCycledStateUpdateFunction,
+        const std::function< void( const double ) > savedStepStateDerivativeFunction,
+        const std::function< void( const double ) > acceptedStepFunction );
 
 } // namespace propagators
 
@@ -26,6 +26,7 @@
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 #include "Tudat/Mathematics/RootFinders/createRootFinder.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationEvents.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationTermination.h"
 
 namespace tudat
@@ -335,6 +336,46 @@ void getFinalStateForExactTerminationCondition(
     }
 }
 
+//! Function to update the sub-cycled part of the state (e.g. rotational state) over an integration step.
+/*!
+ * Function to update the sub-cycled part of the state (e.g. rotational state) over an integration step, using a
+ * function provided by the state derivative model. The state derivatives at the boundaries of the step, required by this
+ * function to interpolate the remaining states inside the step, are retrieved from the integrator if available, and
+ * computed otherwise.
+ * \param integrator Numerical integrator that is used for propagation
+ * \param subCycledStateUpdateFunction Function that updates the sub-cycled part of the state at the end of the step (with
+ * initial time, initial state, final time, final state (modified by reference), initial state derivative and final state
+ * derivative as input)
+ * \param previousTime Time at start of step
+ * \param previousState State at start of step
+ * \param currentTime Time at end of step
+ * \param currentState State at end of step, of which the sub-cycled part is updated (returned by reference)
+ * \param useIntegratorBoundaryDerivatives Boolean denoting whether the state derivatives at the boundaries of the step
+ * may be retrieved from the integrator (only true if the step is the last step taken by the integrator).
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+void updateSubCycledStatesOverStep(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
+        const std::function< void( const TimeType, const StateType&, const TimeType, StateType&,
+                                   const StateType&, const StateType& ) >& subCycledStateUpdateFunction,
+        const TimeType previousTime,
+        const StateType& previousState,
+        const TimeType currentTime,
+        StateType& currentState,
+        const bool useIntegratorBoundaryDerivatives )
+{
+    StateType previousStateDerivative;
+    StateType currentStateDerivative;
+    if( !useIntegratorBoundaryDerivatives ||
+            !integrator->getLastStepBoundaryStateDerivatives( previousStateDerivative, currentStateDerivative ) )
+    {
+        previousStateDerivative = integrator->getStateDerivativeFunction( )( previousTime, previousState );
+        currentStateDerivative = integrator->getStateDerivativeFunction( )( currentTime, currentState );
+    }
+    subCycledStateUpdateFunction( previousTime, previousState, currentTime, currentState,
+                                  previousStateDerivative, currentStateDerivative );
+}
+
 //! Function that propagates to an exact final condition (within tolerance) for arbitrary termination condition
 /*!
  * Function that propagates to an exact final condition (within tolerance) for arbitrary termination condition.
@@ -349,6 +390,10 @@ void getFinalStateForExactTerminationCondition(
  * \param dependentVariableHistory History of dependent variables that are to be saved given as map
  * (time as key; returned by reference)
  * \param currentCpuTime Current run time of propagation.
+ * \param subCycledStateUpdateFunction Function that updates the sub-cycled part of the state over a step (none by
+ * default), see updateSubCycledStatesOverStep.
+ * \param savedStepStateDerivativeFunction Function that is called with the final time, directly after the state derivative
+ * has been evaluated at the final state (none by default), see integrateEquationsFromIntegrator.
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
 void propagateToExactTerminationCondition(
@@ -358,7 +403,13 @@ void propagateToExactTerminationCondition(
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
         std::map< TimeType, StateType >& solutionHistory,
         std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
-        const double currentCpuTime )
+        const double currentCpuTime,
+        const std::function< void( const TimeType, const StateType&, const TimeType, StateType&,
+                                   const StateType&, const StateType& ) > subCycledStateUpdateFunction =
+        std::function< void( const TimeType, const StateType&, const TimeType, StateType&,
+                             const StateType&, const StateType& ) >( ),
+        const std::function< void( const TimeType ) > savedStepStateDerivativeFunction =
+        std::function< void( const TimeType ) >( ) )
 {
     // Turn off step size control
     integrator->setStepSizeControl( false );
@@ -374,6 +425,15 @@ void propagateToExactTerminationCondition(
                 integrator->getCurrentState( ),
                 endTime, endState );
 
+    // Update sub-cycled states over the shortened final step
+    if( subCycledStateUpdateFunction != nullptr )
+    {
+        updateSubCycledStatesOverStep(
+                    integrator, subCycledStateUpdateFunction,
+                    integrator->getPreviousIndependentVariable( ), integrator->getPreviousState( ),
+                    endTime, endState, false );
+    }
+
     // Check if any dependent variables are saved. If so, remove last entry
     bool recomputeDependentVariables = false;
     if( dependentVariableHistory.size( ) > 0 )
@@ -405,19 +465,68 @@ void propagateToExactTerminationCondition(
     }
 
     // Recompute final dependent variables, if required
-    if( recomputeDependentVariables )
+    if( recomputeDependentVariables || savedStepStateDerivativeFunction != nullptr )
     {
         integrator->getStateDerivativeFunction( )( endTime, endState );
-        dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+        if( savedStepStateDerivativeFunction != nullptr )
+        {
+            savedStepStateDerivativeFunction( endTime );
+        }
 
-        // Check stopping conditions to be able to save details
-        propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
+        if( recomputeDependentVariables )
+        {
+            dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+
+            // Check stopping conditions to be able to save details
+            propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
+        }
     }
 
     // Turn step size control back on
     integrator->setStepSizeControl( true );
 }
 
+//! Function to pass the most recently saved step of the propagation to a step output function.
+/*!
+ *  Function to pass the most recently saved step of the propagation to a step output function (e.g. to stream it to a
+ *  file), and to remove it from the saved histories if these are not to be retained in memory. This function is called
+ *  when a new step is about to be saved, and once upon termination of the propagation, so that each step is output only
+ *  once it is final (i.e. after any modification for an exact termination condition).
+ *  \param savedStepOutputFunction Function to which the step is passed (with time, state and dependent variables as
+ *  input). If empty, this function does nothing.
+ *  \param saveHistoryInMemory Boolean denoting whether the saved histories are to be retained in memory.
+ *  \param isPropagationForward Boolean denoting whether the propagation is forward in time.
+ *  \param solutionHistory History of state variables that have been saved (modified by reference)
+ *  \param dependentVariableHistory History of dependent variables that have been saved (modified by reference)
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double >
+void outputLastSavedStep(
+        const std::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) >& savedStepOutputFunction,
+        const bool saveHistoryInMemory,
+        const bool isPropagationForward,
+        std::map< TimeType, StateType >& solutionHistory,
+        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory )
+{
+    if( savedStepOutputFunction == nullptr || solutionHistory.size( ) == 0 )
+    {
+        return;
+    }
+
+    typename std::map< TimeType, StateType >::const_iterator lastSavedStep =
+            isPropagationForward ? std::prev( solutionHistory.end( ) ) : solutionHistory.begin( );
+    typename std::map< TimeType, Eigen::VectorXd >::const_iterator lastSavedDependentVariables =
+            dependentVariableHistory.find( lastSavedStep->first );
+    savedStepOutputFunction( lastSavedStep->first, lastSavedStep->second,
+                             ( lastSavedDependentVariables != dependentVariableHistory.end( ) ) ?
+                                 lastSavedDependentVariables->second : Eigen::VectorXd( ) );
+
+    if( !saveHistoryInMemory )
+    {
+        solutionHistory.clear( );
+        dependentVariableHistory.clear( );
+    }
+}
+
 //! Function to numerically integrate a given first order differential equation
 /*!
  *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
@@ -439,6 +548,24 @@ void propagateToExactTerminationCondition(
  *  \param printInterval Frequency with which to print progress to console (nan = never).
  *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
  *  By default now(), i.e. the moment at which this function is called.
+ *  \param savedStepOutputFunction Function to which each saved step is passed once it is final (with time, state and
+ *  dependent variables as input), e.g. to stream the results to a file during the propagation. None by default.
+ *  \param saveHistoryInMemory Boolean denoting whether the saved histories are to be retained in memory. If false, only
+ *  the most recent saved step (and cumulative computation time) is retained, and the full histories are only available
+ *  through the savedStepOutputFunction.
+ *  \param eventDetector Object detecting the propagation events in each step, which may terminate the propagation
+ *  exactly at an event (none by default).
+ *  \param subCycledStateUpdateFunction Function that updates the sub-cycled part of the state (e.g. the rotational state)
+ *  at the end of each step, with the initial time, initial state, final time, final state (modified by reference),
+ *  initial state derivative and final state derivative of the step as input (none by default).
+ *  \param savedStepStateDerivativeFunction Function that is called with the current time at each saved step (including
+ *  the initial and final step), directly after the state derivative has been evaluated at the saved state. This allows
+ *  quantities that are computed during the evaluation of the state derivative (e.g. partial derivatives) to be retrieved
+ *  at the accepted steps only, without an additional evaluation of the state derivative (none by default).
+ *  \param acceptedStepFunction Function that is called with the current time after each accepted integration step that
+ *  is not the final step, once the state at the end of the step is final. No state derivative is evaluated for this
+ *  function, so that the next evaluation of the state derivative is made by the integrator for the next step (none by
+ *  default).
  *  \return Event that triggered the termination of the propagation
  */
 template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
@@ -453,7 +580,19 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
         const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
         const int saveFrequency = TUDAT_NAN,
         const TimeType printInterval = TUDAT_NAN,
-        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+        const std::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) > savedStepOutputFunction =
+        std::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) >( ),
+        const bool saveHistoryInMemory = true,
+        const std::shared_ptr< PropagationEventDetector< StateType, TimeType, TimeStepType > > eventDetector = nullptr,
+        const std::function< void( const TimeType, const StateType&, const TimeType, StateType&,
+                                   const StateType&, const StateType& ) > subCycledStateUpdateFunction =
+        std::function< void( const TimeType, const StateType&, const TimeType, StateType&,
+                             const StateType&, const StateType& ) >( ),
+        const std::function< void( const TimeType ) > savedStepStateDerivativeFunction =
+        std::function< void( const TimeType ) >( ),
+        const std::function< void( const TimeType ) > acceptedStepFunction =
+        std::function< void( const TimeType ) >( ) )
 {
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason;
 
@@ -467,10 +606,17 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
     solutionHistory[ currentTime ] = newState;
 
     dependentVariableHistory.clear( );
-    if( !( dependentVariableFunction == nullptr ) )
+    if( !( dependentVariableFunction == nullptr ) || !( savedStepStateDerivativeFunction == nullptr ) )
     {
         integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        if( !( savedStepStateDerivativeFunction == nullptr ) )
+        {
+            savedStepStateDerivativeFunction( currentTime );
+        }
+        if( !( dependentVariableFunction == nullptr ) )
+        {
+            dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        }
     }
 
     // CPU time
@@ -479,9 +625,16 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
     cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
 
+    // Initialize event detection
+    if( eventDetector != nullptr )
+    {
+        eventDetector->initialize( currentTime, newState );
+    }
+
     // Set initial time step and total integration time.
     TimeStepType timeStep = initialTimeStep;
     TimeType previousTime = currentTime;
+    StateType previousState;
     TimeType previousPrintTime = TUDAT_NAN;
 
     int saveIndex = 0;
@@ -489,6 +642,7 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
     propagationTerminationReason = std::make_shared< PropagationTerminationDetails >(
                 unknown_propagation_termination_reason );
     bool breakPropagation = 0;
+    bool eventTerminationReached = false;
 
     // Perform numerical integration steps until end time reached.
     do
@@ -498,6 +652,10 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
             if( ( newState.allFinite( ) == true ) && ( !newState.hasNaN( ) ) )
             {
                 previousTime = currentTime;
+                if( subCycledStateUpdateFunction != nullptr )
+                {
+                    previousState = newState;
+                }
 
                 // Perform integration step.
                 newState = integrator->performIntegrationStep( timeStep );
@@ -523,17 +681,52 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 currentTime = integrator->getCurrentIndependentVariable( );
                 timeStep = integrator->getNextStepSize( );
 
-                // Save integration result in map
+                // Update sub-cycled states over last step
+                if( subCycledStateUpdateFunction != nullptr )
+                {
+                    updateSubCycledStatesOverStep(
+                                integrator, subCycledStateUpdateFunction,
+                                previousTime, previousState, currentTime, newState, true );
+                    integrator->modifyCurrentState( newState, true );
+                }
+
+                // Detect events in last step, and move to terminating event (if any)
+                eventTerminationReached = false;
+                if( eventDetector != nullptr )
+                {
+                    TimeType eventTime;
+                    StateType eventState;
+                    if( eventDetector->processLastStep( integrator, eventTime, eventState ) )
+                    {
+                        integrator->modifyCurrentIntegrationVariables( eventState, eventTime, true );
+                        currentTime = eventTime;
+                        newState = eventState;
+                        propagationTerminationReason = std::make_shared< PropagationTerminationDetailsFromEvent >(
+                                    eventDetector->getTerminatingEventName( ) );
+                        eventTerminationReached = true;
+                    }
+                }
+
+                // Save integration result in map (final state is always saved when terminating on event)
                 saveIndex++;
                 saveIndex = saveIndex % saveFrequency;
-                if( saveIndex == 0 )
+                if( saveIndex == 0 || eventTerminationReached )
                 {
+                    outputLastSavedStep( savedStepOutputFunction, saveHistoryInMemory, timeStep > 0,
+                                         solutionHistory, dependentVariableHistory );
                     solutionHistory[ currentTime ] = newState;
 
-                    if( !( dependentVariableFunction == nullptr ) )
+                    if( !( dependentVariableFunction == nullptr ) || !( savedStepStateDerivativeFunction == nullptr ) )
                     {
                         integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        if( !( savedStepStateDerivativeFunction == nullptr ) )
+                        {
+                            savedStepStateDerivativeFunction( currentTime );
+                        }
+                        if( !( dependentVariableFunction == nullptr ) )
+                        {
+                            dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        }
                     }
                 }
             }
@@ -548,6 +741,10 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
 
             currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                         std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
+            if( !saveHistoryInMemory )
+            {
+                cumulativeComputationTimeHistory.clear( );
+            }
             cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
 
             // Print solutions
@@ -563,14 +760,19 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 }
             }
 
-            if( propagationTerminationCondition->checkStopCondition( static_cast< double >( currentTime ), currentCPUTime ) )
+            if( eventTerminationReached )
+            {
+                breakPropagation = true;
+            }
+            else if( propagationTerminationCondition->checkStopCondition( static_cast< double >( currentTime ), currentCPUTime ) )
             {
                 if( propagationTerminationCondition->getTerminateExactlyOnFinalCondition( ) )
                 {
                     propagateToExactTerminationCondition(
                                 integrator, propagationTerminationCondition,
                                 timeStep, dependentVariableFunction,
-                                solutionHistory, dependentVariableHistory, currentCPUTime );
+                                solutionHistory, dependentVariableHistory, currentCPUTime,
+                                subCycledStateUpdateFunction, savedStepStateDerivativeFunction );
                 }
 
                 // Set termination details
@@ -594,6 +796,12 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 }
                 breakPropagation = true;
             }
+
+            // Signal that step has been accepted, if propagation continues
+            if( !breakPropagation && !( acceptedStepFunction == nullptr ) )
+            {
+                acceptedStepFunction( currentTime );
+            }
         }
         catch( const std::exception& caughtException )
         {
@@ -607,6 +815,9 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
     }
     while( !breakPropagation );
 
+    // Output final saved step, which is always retained in memory
+    outputLastSavedStep( savedStepOutputFunction, true, timeStep > 0, solutionHistory, dependentVariableHistory );
+
     return propagationTerminationReason;
 }
 
@@ -622,7 +833,14 @@ Eigen::MatrixXd, double, double >(
         const std::function< void( Eigen::MatrixXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::function< void( const double, const Eigen::MatrixXd&, const Eigen::VectorXd& ) > savedStepOutputFunction,
+        const bool saveHistoryInMemory,
+        const std::shared_ptr< PropagationEventDetector< Eigen::MatrixXd, double, double > > eventDetector,
+        const std::function< void( const double, const Eigen::MatrixXd&, const double, Eigen::MatrixXd&,
+                                   const Eigen::MatrixXd&, const Eigen::MatrixXd& ) > subCycledStateUpdateFunction,
+        const std::function< void( const double ) > savedStepStateDerivativeFunction,
+        const std::function< void( const double ) > acceptedStepFunction );
 
 
 extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
@@ -637,7 +855,14 @@ Eigen::VectorXd, double, double >(
         const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::function< void( const double, const Eigen::VectorXd&, const Eigen::VectorXd& ) > savedStepOutputFunction,
+        const bool saveHistoryInMemory,
+        const std::shared_ptr< PropagationEventDetector< Eigen::VectorXd, double, double > > eventDetector,
+        const std::function< void( const double, const Eigen::VectorXd&, const double, Eigen::VectorXd&,
+                                   const Eigen::VectorXd&, const Eigen::VectorXd& ) > subCycledStateUpdateFunction,
+        const std::function< void( const double ) > savedStepStateDerivativeFunction,
+        const std::function< void( const double ) > acceptedStepFunction );
 
 
 //! Interface class for integrating some state derivative function.
@@ -671,6 +896,15 @@ public:
      *  \param printInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param savedStepOutputFunction Function to which each saved step is passed once it is final (none by default).
+     *  \param saveHistoryInMemory Boolean denoting whether the saved histories are to be retained in memory.
+     *  \param eventDetector Object detecting the propagation events in each step (none by default).
+     *  \param subCycledStateUpdateFunction Function that updates the sub-cycled part of the state at the end of each step
+     *  (none by default).
+     *  \param savedStepStateDerivativeFunction Function that is called at each saved step, directly after the state
+     *  derivative has been evaluated at the saved state (none by default).
+     *  \param acceptedStepFunction Function that is called after each accepted integration step that is not the final
+     *  step, without evaluating the state derivative (none by default).
      *  \return Event that triggered the termination of the propagation
      */
     static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
@@ -684,7 +918,19 @@ public:
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const TimeType printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) );
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) > savedStepOutputFunction =
+            std::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) >( ),
+            const bool saveHistoryInMemory = true,
+            const std::shared_ptr< PropagationEventDetector< StateType, TimeType, TimeType > > eventDetector = nullptr,
+            const std::function< void( const TimeType, const StateType&, const TimeType, StateType&,
+                                       const StateType&, const StateType& ) > subCycledStateUpdateFunction =
+            std::function< void( const TimeType, const StateType&, const TimeType, StateType&,
+                                 const StateType&, const StateType& ) >( ),
+            const std::function< void( const TimeType ) > savedStepStateDerivativeFunction =
+            std::function< void( const TimeType ) >( ),
+            const std::function< void( const TimeType ) > acceptedStepFunction =
+            std::function< void( const TimeType ) >( ) );
 
 };
 
@@ -713,6 +959,15 @@ public:
      *  \param printInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param savedStepOutputFunction Function to which each saved step is passed once it is final (none by default).
+     *  \param saveHistoryInMemory Boolean denoting whether the saved histories are to be retained in memory.
+     *  \param eventDetector Object detecting the propagation events in each step (none by default).
+     *  \param subCycledStateUpdateFunction Function that updates the sub-cycled part of the state at the end of each step
+     *  (none by default).
+     *  \param savedStepStateDerivativeFunction Function that is called at each saved step, directly after the state
+     *  derivative has been evaluated at the saved state (none by default).
+     *  \param acceptedStepFunction Function that is called after each accepted integration step that is not the final
+     *  step, without evaluating the state derivative (none by default).
      *  \return Event that triggered the termination of the propagation
      */
     static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
@@ -726,7 +981,19 @@ public:
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const double printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::function< void( const double, const StateType&, const Eigen::VectorXd& ) > savedStepOutputFunction =
+            std::function< void( const double, const StateType&, const Eigen::VectorXd& ) >( ),
+            const bool saveHistoryInMemory = true,
+            const std::shared_ptr< PropagationEventDetector< StateType, double, double > > eventDetector = nullptr,
+            const std::function< void( const double, const StateType&, const double, StateType&,
+                                       const StateType&, const StateType& ) > subCycledStateUpdateFunction =
+            std::function< void( const double, const StateType&, const double, StateType&,
+                                 const StateType&, const StateType& ) >( ),
+            const std::function< void( const double ) > savedStepStateDerivativeFunction =
+            std::function< void( const double ) >( ),
+            const std::function< void( const double ) > acceptedStepFunction =
+            std::function< void( const double ) >( ) )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -749,7 +1016,13 @@ public:
                     statePostProcessingFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    savedStepOutputFunction,
+                    saveHistoryInMemory,
+                    eventDetector,
+                    subCycledStateUpdateFunction,
+                    savedStepStateDerivativeFunction,
+                    acceptedStepFunction );
     }
 
 };
@@ -779,6 +1052,15 @@ public:
      *  \param printInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param savedStepOutputFunction Function to which each saved step is passed once it is final (none by default).
+     *  \param saveHistoryInMemory Boolean denoting whether the saved histories are to be retained in memory.
+     *  \param eventDetector Object detecting the propagation events in each step (none by default).
+     *  \param subCycledStateUpdateFunction Function that updates the sub-cycled part of the state at the end of each step
+     *  (none by default).
+     *  \param savedStepStateDerivativeFunction Function that is called at each saved step, directly after the state
+     *  derivative has been evaluated at the saved state (none by default).
+     *  \param acceptedStepFunction Function that is called after each accepted integration step that is not the final
+     *  step, without evaluating the state derivative (none by default).
      *  \return Event that triggered the termination of the propagation
      */
     static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
@@ -792,7 +1074,19 @@ public:
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const Time printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::function< void( const Time, const StateType&, const Eigen::VectorXd& ) > savedStepOutputFunction =
+            std::function< void( const Time, const StateType&, const Eigen::VectorXd& ) >( ),
+            const bool saveHistoryInMemory = true,
+            const std::shared_ptr< PropagationEventDetector< StateType, Time, long double > > eventDetector = nullptr,
+            const std::function< void( const Time, const StateType&, const Time, StateType&,
+                                       const StateType&, const StateType& ) > subCycledStateUpdateFunction =
+            std::function< void( const Time, const StateType&, const Time, StateType&,
+                                 const StateType&, const StateType& ) >( ),
+            const std::function< void( const Time ) > savedStepStateDerivativeFunction =
+            std::function< void( const Time ) >( ),
+            const std::function< void( const Time ) > acceptedStepFunction =
+            std::function< void( const Time ) >( ) )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -815,7 +1109,13 @@ public:
                     statePostProcessingFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    savedStepOutputFunction,
+                    saveHistoryInMemory,
+                    eventDetector,
+                    subCycledStateUpdateFunction,
+                    savedStepStateDerivativeFunction,
+                    acceptedStepFunction );
     }
 
 };
@@ -0,0 +1,266 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Astrodynamics/Propagators/multiRateAccelerationEvaluator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Constructor
+MultiRateAccelerationEvaluator::MultiRateAccelerationEvaluator(
+        const std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > >& slowAccelerationModels,
+        const std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > >& fastAccelerationModels,
+        const std::shared_ptr< MultiRateAccelerationSettings > multiRateSettings ):
+    slowAccelerationModels_( slowAccelerationModels ), fastAccelerationModels_( fastAccelerationModels ),
+    multiRateSettings_( multiRateSettings ), updateAtAcceptedStatesOnly_( false ), isCurrentStateAccepted_( false ),
+    isNextEvaluationAtAcceptedState_( false )
+{
+    if( slowAccelerationModels_.size( ) != fastAccelerationModels_.size( ) )
+    {
+        throw std::runtime_error( "Error when creating multi-rate acceleration evaluator, input sizes are inconsistent" );
+    }
+
+    if( !( multiRateSettings_->updateInterval_ > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating multi-rate acceleration evaluator, update interval must be positive" );
+    }
+
+    if( multiRateSettings_->minimumUpdateInterval_ > multiRateSettings_->maximumUpdateInterval_ )
+    {
+        throw std::runtime_error( "Error when creating multi-rate acceleration evaluator, minimum update interval exceeds maximum" );
+    }
+
+    for( unsigned int i = 0; i < slowAccelerationModels_.size( ); i++ )
+    {
+        slowAccelerationIndices_[ slowAccelerationModels_.at( i ) ] = i;
+    }
+
+    lastResiduals_.resize( slowAccelerationModels_.size( ) );
+    previousResiduals_.resize( slowAccelerationModels_.size( ) );
+    currentAccelerations_.resize( slowAccelerationModels_.size( ) );
+    reset( );
+}
+
+//! Function to update all slow accelerations to the current time.
+void MultiRateAccelerationEvaluator::updateAccelerations( const double currentTime )
+{
+    Eigen::Vector3d fastAcceleration;
+    for( unsigned int i = 0; i < slowAccelerationModels_.size( ); i++ )
+    {
+        // Check whether full evaluation is to be performed now.
+        bool performFullEvaluation = isFullEvaluationToBePerformed( i, currentTime );
+
+        // Update slow model first, so that companion model uses coefficients of current full evaluation.
+        if( performFullEvaluation )
+        {
+            slowAccelerationModels_[ i ]->updateMembers( currentTime );
+        }
+
+        // Evaluate cheap companion model at current time (time reset, as the state may differ from last call at the
+        // same time).
+        fastAcceleration.setZero( );
+        if( fastAccelerationModels_[ i ] != nullptr )
+        {
+            fastAccelerationModels_[ i ]->resetTime( TUDAT_NAN );
+            fastAccelerationModels_[ i ]->updateMembers( currentTime );
+            fastAcceleration = fastAccelerationModels_[ i ]->getAcceleration( );
+        }
+
+        if( performFullEvaluation )
+        {
+            Eigen::Vector3d newResidual = slowAccelerationModels_[ i ]->getAcceleration( ) - fastAcceleration;
+            numberOfFullEvaluations_++;
+
+            if( lastUpdateTimes_[ i ] == lastUpdateTimes_[ i ] )
+            {
+                double approximationError = ( getApproximatedResidual( i, currentTime ) - newResidual ).norm( );
+                maximumApproximationErrors_[ i ] = std::max( maximumApproximationErrors_[ i ], approximationError );
+
+                // Adapt update interval from difference between approximated and full residual.
+                if( multiRateSettings_->residualTolerance_ == multiRateSettings_->residualTolerance_ )
+                {
+                    if( approximationError > multiRateSettings_->residualTolerance_ )
+                    {
+                        updateIntervals_[ i ] = std::max( 0.5 * updateIntervals_[ i ],
+                                                          multiRateSettings_->minimumUpdateInterval_ );
+                    }
+                    else if( approximationError < 0.1 * multiRateSettings_->residualTolerance_ )
+                    {
+                        updateIntervals_[ i ] = std::min( 2.0 * updateIntervals_[ i ],
+                                                          multiRateSettings_->maximumUpdateInterval_ );
+                    }
+                }
+            }
+
+            previousUpdateTimes_[ i ] = lastUpdateTimes_[ i ];
+            previousResiduals_[ i ] = lastResiduals_[ i ];
+            lastUpdateTimes_[ i ] = currentTime;
+            lastResiduals_[ i ] = newResidual;
+        }
+
+        currentAccelerations_[ i ] = fastAcceleration + getApproximatedResidual( i, currentTime );
+    }
+    isNextEvaluationAtAcceptedState_ = false;
+}
+
+//! Function to check whether a full evaluation of any of the slow accelerations is due at the given time.
+bool MultiRateAccelerationEvaluator::isFullEvaluationDue( const double currentTime )
+{
+    for( unsigned int i = 0; i < slowAccelerationModels_.size( ); i++ )
+    {
+        if( isFullEvaluationDue( i, currentTime ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! Function to check whether the next call to updateAccelerations at the given time performs a full evaluation.
+bool MultiRateAccelerationEvaluator::isFullEvaluationToBePerformed( const double currentTime )
+{
+    for( unsigned int i = 0; i < slowAccelerationModels_.size( ); i++ )
+    {
+        if( isFullEvaluationToBePerformed( i, currentTime ) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! Function to retrieve the index of an acceleration model in the list of slow accelerations.
+int MultiRateAccelerationEvaluator::getSlowAccelerationIndex(
+        const std::shared_ptr< basic_astrodynamics::AccelerationModel3d > accelerationModel )
+{
+    std::unordered_map< std::shared_ptr< basic_astrodynamics::AccelerationModel3d >, int >::const_iterator
+            indexIterator = slowAccelerationIndices_.find( accelerationModel );
+    return ( indexIterator == slowAccelerationIndices_.end( ) ) ? -1 : indexIterator->second;
+}
+
+//! Function to reset the evaluator, so that the next call to updateAccelerations performs full evaluations.
+void MultiRateAccelerationEvaluator::reset( )
+{
+    updateIntervals_.assign( slowAccelerationModels_.size( ), multiRateSettings_->updateInterval_ );
+    lastUpdateTimes_.assign( slowAccelerationModels_.size( ), TUDAT_NAN );
+    previousUpdateTimes_.assign( slowAccelerationModels_.size( ), TUDAT_NAN );
+    maximumApproximationErrors_.assign( slowAccelerationModels_.size( ), 0.0 );
+    for( unsigned int i = 0; i < slowAccelerationModels_.size( ); i++ )
+    {
+        lastResiduals_[ i ].setZero( );
+        previousResiduals_[ i ].setZero( );
+        currentAccelerations_[ i ].setZero( );
+    }
+    numberOfFullEvaluations_ = 0;
+    isNextEvaluationAtAcceptedState_ = false;
+}
+
+//! Function to compute the approximated residual of a slow acceleration at a given time.
+Eigen::Vector3d MultiRateAccelerationEvaluator::getApproximatedResidual( const int index, const double currentTime )
+{
+    if( multiRateSettings_->approximationType_ == linearly_extrapolated_slow_acceleration &&
+            ( previousUpdateTimes_[ index ] == previousUpdateTimes_[ index ] ) &&
+            ( lastUpdateTimes_[ index ] != previousUpdateTimes_[ index ] ) )
+    {
+        return lastResiduals_[ index ] + ( currentTime - lastUpdateTimes_[ index ] ) *
+                ( lastResiduals_[ index ] - previousResiduals_[ index ] ) /
+                ( lastUpdateTimes_[ index ] - previousUpdateTimes_[ index ] );
+    }
+    else
+    {
+        return lastResiduals_[ index ];
+    }
+}
+
+//! Function to create an object for the multi-rate evaluation of a list of acceleration models.
+std::shared_ptr< MultiRateAccelerationEvaluator > createMultiRateAccelerationEvaluator(
+        const std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > >& accelerationModelList,
+        const std::shared_ptr< MultiRateAccelerationSettings > multiRateSettings,
+        std::vector< int >& slowAccelerationIndices )
+{
+    using namespace basic_astrodynamics;
+    using namespace gravitation;
+
+    std::vector< std::shared_ptr< AccelerationModel3d > > slowAccelerationModels;
+    std::vector< std::shared_ptr< AccelerationModel3d > > fastAccelerationModels;
+
+    slowAccelerationIndices.clear( );
+    for( unsigned int i = 0; i < accelerationModelList.size( ); i++ )
+    {
+        AvailableAcceleration accelerationType = getAccelerationModelType( accelerationModelList.at( i ) );
+        if( std::find( multiRateSettings->slowAccelerationTypes_.begin( ),
+                       multiRateSettings->slowAccelerationTypes_.end( ),
+                       accelerationType ) == multiRateSettings->slowAccelerationTypes_.end( ) )
+        {
+            slowAccelerationIndices.push_back( -1 );
+            continue;
+        }
+
+        slowAccelerationIndices.push_back( slowAccelerationModels.size( ) );
+        slowAccelerationModels.push_back( accelerationModelList.at( i ) );
+
+        // Create truncated spherical harmonic model for low-degree terms, to be evaluated at each call.
+        std::shared_ptr< AccelerationModel3d > fastAccelerationModel;
+        if( accelerationType == spherical_harmonic_gravity && multiRateSettings->fastSphericalHarmonicsDegree_ >= 0 )
+        {
+            std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > sphericalHarmonicAcceleration =
+                    std::dynamic_pointer_cast< SphericalHarmonicsGravitationalAccelerationModel >(
+                        accelerationModelList.at( i ) );
+
+            int fastDegree = multiRateSettings->fastSphericalHarmonicsDegree_;
+            int fastOrder = std::min( multiRateSettings->fastSphericalHarmonicsOrder_, fastDegree );
+            Eigen::MatrixXd cosineCoefficients = sphericalHarmonicAcceleration->getCosineHarmonicCoefficientsFunction( )( );
+            int numberOfRows = std::min< int >( fastDegree + 1, cosineCoefficients.rows( ) );
+            int numberOfColumns = std::min< int >( fastOrder + 1, cosineCoefficients.cols( ) );
+
+            // Companion model reads (block of) coefficients cached by slow model, which is always updated first
+            // at full evaluations, so that the full coefficient matrices are not retrieved at each call.
+
+            fastAccelerationModel = std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                        sphericalHarmonicAcceleration->getStateFunctionOfBodyUndergoingAcceleration( ),
+                        sphericalHarmonicAcceleration->getGravitationalParameterFunction( ),
+                        sphericalHarmonicAcceleration->getReferenceRadius( ),
+                        [ sphericalHarmonicAcceleration, numberOfRows, numberOfColumns ]( ) -> Eigen::MatrixXd
+            {
+                return sphericalHarmonicAcceleration->getCurrentCosineHarmonicCoefficients( ).block(
+                            0, 0, numberOfRows, numberOfColumns );
+            },
+            [ sphericalHarmonicAcceleration, numberOfRows, numberOfColumns ]( ) -> Eigen::MatrixXd
+            {
+                return sphericalHarmonicAcceleration->getCurrentSineHarmonicCoefficients( ).block(
+                            0, 0, numberOfRows, numberOfColumns );
+            },
+                        sphericalHarmonicAcceleration->getStateFunctionOfBodyExertingAcceleration( ),
+                        sphericalHarmonicAcceleration->getRotationFromBodyFixedToIntegrationFrameFunction( ),
+                        sphericalHarmonicAcceleration->getIsMutualAttractionUsed( ) );
+        }
+        fastAccelerationModels.push_back( fastAccelerationModel );
+    }
+
+    std::shared_ptr< MultiRateAccelerationEvaluator > multiRateAccelerationEvaluator;
+    if( slowAccelerationModels.size( ) > 0 )
+    {
+        multiRateAccelerationEvaluator = std::make_shared< MultiRateAccelerationEvaluator >(
+                    slowAccelerationModels, fastAccelerationModels, multiRateSettings );
+    }
+    return multiRateAccelerationEvaluator;
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -0,0 +1,380 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_MULTIRATEACCELERATIONEVALUATOR_H
+#define TUDAT_MULTIRATEACCELERATIONEVALUATOR_H
+
+#include <cmath>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModelTypes.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Enum listing the approximations of slow acceleration contributions between two full evaluations.
+enum SlowAccelerationApproximationType
+{
+    held_slow_acceleration = 0,
+    linearly_extrapolated_slow_acceleration = 1
+};
+
+//! Class defining settings for multi-rate evaluation of translational accelerations.
+/*!
+ *  Class defining settings for multi-rate evaluation of translational accelerations. Accelerations of the types
+ *  listed in slowAccelerationTypes_ are fully evaluated only once per update interval, and approximated in between
+ *  (held constant or linearly extrapolated from the last two full evaluations). All other accelerations are evaluated
+ *  at each call to the state derivative function. For a spherical harmonic acceleration that is evaluated at the slow
+ *  rate, the low-degree part of the field (by default the point mass and J2 terms) is still evaluated at each call,
+ *  so that only the difference between the full and low-degree fields is approximated. If a residual tolerance is
+ *  provided, the update interval of each slow acceleration is adapted by comparing the approximated value with the
+ *  full value at each full evaluation.
+ */
+class MultiRateAccelerationSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param slowAccelerationTypes Types of acceleration that are to be evaluated at the slow rate.
+     *  \param updateInterval (Initial) time interval between two full evaluations of the slow accelerations.
+     *  \param residualTolerance Maximum allowed difference between approximated and fully evaluated slow acceleration,
+     *  used to adapt the update interval. If NaN (default), the update interval is kept fixed.
+     *  \param minimumUpdateInterval Minimum update interval when adapting the interval (default: updateInterval / 64).
+     *  \param maximumUpdateInterval Maximum update interval when adapting the interval (default: updateInterval * 4).
+     *  \param approximationType Approximation of slow accelerations between two full evaluations.
+     *  \param fastSphericalHarmonicsDegree Maximum degree of spherical harmonic gravity terms that are evaluated at each
+     *  call (for spherical harmonic accelerations evaluated at the slow rate). If negative, all terms are slow.
+     *  \param fastSphericalHarmonicsOrder Maximum order of spherical harmonic gravity terms that are evaluated at each
+     *  call (for spherical harmonic accelerations evaluated at the slow rate).
+     */
+    MultiRateAccelerationSettings(
+            const std::vector< basic_astrodynamics::AvailableAcceleration >& slowAccelerationTypes,
+            const double updateInterval,
+            const double residualTolerance = TUDAT_NAN,
+            const double minimumUpdateInterval = TUDAT_NAN,
+            const double maximumUpdateInterval = TUDAT_NAN,
+            const SlowAccelerationApproximationType approximationType = linearly_extrapolated_slow_acceleration,
+            const int fastSphericalHarmonicsDegree = 2,
+            const int fastSphericalHarmonicsOrder = 0 ):
+        slowAccelerationTypes_( slowAccelerationTypes ), updateInterval_( updateInterval ),
+        residualTolerance_( residualTolerance ),
+        minimumUpdateInterval_( ( minimumUpdateInterval == minimumUpdateInterval ) ?
+                                    minimumUpdateInterval : updateInterval / 64.0 ),
+        maximumUpdateInterval_( ( maximumUpdateInterval == maximumUpdateInterval ) ?
+                                    maximumUpdateInterval : updateInterval * 4.0 ),
+        approximationType_( approximationType ),
+        fastSphericalHarmonicsDegree_( fastSphericalHarmonicsDegree ),
+        fastSphericalHarmonicsOrder_( fastSphericalHarmonicsOrder ){ }
+
+    //! Types of acceleration that are to be evaluated at the slow rate.
+    std::vector< basic_astrodynamics::AvailableAcceleration > slowAccelerationTypes_;
+
+    //! (Initial) time interval between two full evaluations of the slow accelerations.
+    double updateInterval_;
+
+    //! Maximum allowed difference between approximated and fully evaluated slow acceleration (NaN if not used).
+    double residualTolerance_;
+
+    //! Minimum update interval when adapting the interval.
+    double minimumUpdateInterval_;
+
+    //! Maximum update interval when adapting the interval.
+    double maximumUpdateInterval_;
+
+    //! Approximation of slow accelerations between two full evaluations.
+    SlowAccelerationApproximationType approximationType_;
+
+    //! Maximum degree of spherical harmonic gravity terms that are evaluated at each call.
+    int fastSphericalHarmonicsDegree_;
+
+    //! Maximum order of spherical harmonic gravity terms that are evaluated at each call.
+    int fastSphericalHarmonicsOrder_;
+};
+
+//! Class to evaluate a set of acceleration models at a reduced rate.
+/*!
+ *  Class to evaluate a set of acceleration models at a reduced rate, according to the settings defined in a
+ *  MultiRateAccelerationSettings object. For each slow acceleration, a (cheap) companion acceleration model may be
+ *  provided, which is evaluated at each call. In that case, only the difference between the slow and companion models
+ *  is approximated between full evaluations. The original acceleration models are only updated at the full evaluation
+ *  epochs, so that their getAcceleration function returns the value at the last full evaluation.
+ *  By default, a full evaluation is performed at the first call after the update interval has elapsed. When used in a
+ *  propagation with step-size control, such a call may be made at an intermediate stage of the integrator, or for a
+ *  step that is subsequently rejected, so that the approximation would be based on states that are not on the
+ *  propagated trajectory. To prevent this, full evaluations may be restricted to accepted states only (see
+ *  setUpdateAtAcceptedStatesOnly), in which case the owner of this object must flag the evaluations at accepted states
+ *  (see setIsCurrentStateAccepted), or signal each accepted integration step (see signalAcceptedStep).
+ */
+class MultiRateAccelerationEvaluator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param slowAccelerationModels Acceleration models that are to be evaluated at the slow rate.
+     *  \param fastAccelerationModels Cheap companion models (one per entry of slowAccelerationModels, nullptr if none),
+     *  that are evaluated at each call.
+     *  \param multiRateSettings Settings for the multi-rate evaluation.
+     */
+    MultiRateAccelerationEvaluator(
+            const std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > >& slowAccelerationModels,
+            const std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > >& fastAccelerationModels,
+            const std::shared_ptr< MultiRateAccelerationSettings > multiRateSettings );
+
+    //! Function to update all slow accelerations to the current time.
+    /*!
+     *  Function to update all slow accelerations to the current time. A full evaluation of a slow acceleration is
+     *  performed if the time since its last full evaluation is at least equal to its current update interval, and (if
+     *  full evaluations are restricted to accepted states) the current state is flagged as accepted. The first call
+     *  after a reset always performs a full evaluation. The environment must have been updated to the current time
+     *  before calling this function.
+     *  \param currentTime Time to which accelerations are to be updated.
+     */
+    void updateAccelerations( const double currentTime );
+
+    //! Function to check whether a full evaluation of any of the slow accelerations is due at the given time.
+    /*!
+     *  Function to check whether a full evaluation of any of the slow accelerations is due at the given time, i.e. if
+     *  no full evaluation has been performed since the last reset, or if the update interval has elapsed.
+     *  \param currentTime Time at which the check is to be performed.
+     *  \return True if a full evaluation of any of the slow accelerations is due.
+     */
+    bool isFullEvaluationDue( const double currentTime );
+
+    //! Function to check whether the next call to updateAccelerations at the given time performs a full evaluation.
+    /*!
+     *  Function to check whether the next call to updateAccelerations at the given time performs a full evaluation of any
+     *  of the slow accelerations, i.e. if a full evaluation is due, and (if full evaluations are restricted to accepted
+     *  states) the state is flagged as accepted. May be used to skip environment updates that are only required by the
+     *  slow accelerations.
+     *  \param currentTime Time at which the check is to be performed.
+     *  \return True if the next call to updateAccelerations performs a full evaluation of any of the slow accelerations.
+     */
+    bool isFullEvaluationToBePerformed( const double currentTime );
+
+    //! Function to set whether full evaluations (after the first one) are only performed at accepted states.
+    /*!
+     *  Function to set whether full evaluations (after the first one) are only performed at accepted states.
+     *  \param updateAtAcceptedStatesOnly Boolean denoting whether full evaluations are only performed at accepted states.
+     */
+    void setUpdateAtAcceptedStatesOnly( const bool updateAtAcceptedStatesOnly )
+    {
+        updateAtAcceptedStatesOnly_ = updateAtAcceptedStatesOnly;
+    }
+
+    //! Function to retrieve whether full evaluations (after the first one) are only performed at accepted states.
+    /*!
+     *  Function to retrieve whether full evaluations (after the first one) are only performed at accepted states.
+     *  \return Boolean denoting whether full evaluations are only performed at accepted states.
+     */
+    bool getUpdateAtAcceptedStatesOnly( )
+    {
+        return updateAtAcceptedStatesOnly_;
+    }
+
+    //! Function to set whether the state at which the next call to updateAccelerations is made is an accepted state.
+    /*!
+     *  Function to set whether the state at which the next call to updateAccelerations is made is an accepted state
+     *  (i.e. an accepted integration step, as opposed to an intermediate stage or rejected step of the integrator).
+     *  \param isCurrentStateAccepted Boolean denoting whether the current state is accepted.
+     */
+    void setIsCurrentStateAccepted( const bool isCurrentStateAccepted )
+    {
+        isCurrentStateAccepted_ = isCurrentStateAccepted;
+    }
+
+    //! Function to signal that an integration step has been accepted.
+    /*!
+     *  Function to signal that an integration step has been accepted, so that the next call to updateAccelerations (only)
+     *  is treated as an evaluation at an accepted state. For integrators that start each step with an evaluation at the
+     *  current state (e.g. Runge-Kutta methods), this is the first evaluation of the next step, which is at the accepted
+     *  state, so that the full evaluations are performed without any additional state derivative evaluation. For other
+     *  integrators, the full evaluations are performed at the first evaluation after the accepted step.
+     */
+    void signalAcceptedStep( )
+    {
+        isNextEvaluationAtAcceptedState_ = true;
+    }
+
+    //! Function to retrieve the current (approximated) value of a slow acceleration.
+    /*!
+     *  Function to retrieve the current (approximated) value of a slow acceleration, as set by last call to
+     *  updateAccelerations.
+     *  \param index Index of slow acceleration (in slowAccelerationModels list provided to constructor).
+     *  \return Current (approximated) value of slow acceleration.
+     */
+    Eigen::Vector3d getAcceleration( const int index )
+    {
+        return currentAccelerations_[ index ];
+    }
+
+    //! Function to retrieve the index of an acceleration model in the list of slow accelerations.
+    /*!
+     *  Function to retrieve the index of an acceleration model in the list of slow accelerations.
+     *  \param accelerationModel Acceleration model for which the index is to be retrieved.
+     *  \return Index of acceleration model in list of slow accelerations (-1 if not a slow acceleration).
+     */
+    int getSlowAccelerationIndex( const std::shared_ptr< basic_astrodynamics::AccelerationModel3d > accelerationModel );
+
+    //! Function to reset the evaluator, so that the next call to updateAccelerations performs full evaluations.
+    void reset( );
+
+    //! Function to retrieve the total number of full evaluations of slow accelerations since last reset.
+    /*!
+     *  Function to retrieve the total number of full evaluations of slow accelerations since last reset.
+     *  \return Total number of full evaluations of slow accelerations since last reset.
+     */
+    int getNumberOfFullEvaluations( )
+    {
+        return numberOfFullEvaluations_;
+    }
+
+    //! Function to retrieve the current update intervals of all slow accelerations.
+    /*!
+     *  Function to retrieve the current update intervals of all slow accelerations.
+     *  \return Current update intervals of all slow accelerations.
+     */
+    std::vector< double > getUpdateIntervals( )
+    {
+        return updateIntervals_;
+    }
+
+    //! Function to retrieve the maximum approximation errors of all slow accelerations since last reset.
+    /*!
+     *  Function to retrieve the maximum approximation errors of all slow accelerations since last reset, i.e. the maximum
+     *  norm of the difference between the approximated and fully evaluated slow acceleration, computed at each full
+     *  evaluation (after the first one).
+     *  \return Maximum approximation errors of all slow accelerations since last reset.
+     */
+    std::vector< double > getMaximumApproximationErrors( )
+    {
+        return maximumApproximationErrors_;
+    }
+
+private:
+
+    //! Acceleration models that are to be evaluated at the slow rate.
+    std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > > slowAccelerationModels_;
+
+    //! Cheap companion models (one per slow acceleration, nullptr if none), evaluated at each call.
+    std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > > fastAccelerationModels_;
+
+    //! Settings for the multi-rate evaluation.
+    std::shared_ptr< MultiRateAccelerationSettings > multiRateSettings_;
+
+    //! Index in slowAccelerationModels_ of each slow acceleration model.
+    std::unordered_map< std::shared_ptr< basic_astrodynamics::AccelerationModel3d >, int > slowAccelerationIndices_;
+
+    //! Current update interval, per slow acceleration.
+    std::vector< double > updateIntervals_;
+
+    //! Times of last full evaluation, per slow acceleration.
+    std::vector< double > lastUpdateTimes_;
+
+    //! Times of full evaluation before last, per slow acceleration.
+    std::vector< double > previousUpdateTimes_;
+
+    //! Maximum approximation error since last reset, per slow acceleration.
+    std::vector< double > maximumApproximationErrors_;
+
+    //! Slow acceleration minus companion acceleration at last full evaluation, per slow acceleration.
+    std::vector< Eigen::Vector3d > lastResiduals_;
+
+    //! Slow acceleration minus companion acceleration at full evaluation before last, per slow acceleration.
+    std::vector< Eigen::Vector3d > previousResiduals_;
+
+    //! Current (approximated) values of slow accelerations.
+    std::vector< Eigen::Vector3d > currentAccelerations_;
+
+    //! Total number of full evaluations of slow accelerations since last reset.
+    int numberOfFullEvaluations_;
+
+    //! Boolean denoting whether full evaluations (after the first one) are only performed at accepted states.
+    bool updateAtAcceptedStatesOnly_;
+
+    //! Boolean denoting whether the state at which updateAccelerations is called is an accepted state.
+    bool isCurrentStateAccepted_;
+
+    //! Boolean denoting whether the next call to updateAccelerations is the first after an accepted step.
+    bool isNextEvaluationAtAcceptedState_;
+
+    //! Function to check whether a full evaluation of a single slow acceleration is due at the given time.
+    /*!
+     *  Function to check whether a full evaluation of a single slow acceleration is due at the given time.
+     *  \param index Index of slow acceleration.
+     *  \param currentTime Time at which the check is to be performed.
+     *  \return True if a full evaluation of the slow acceleration is due.
+     */
+    bool isFullEvaluationDue( const int index, const double currentTime )
+    {
+        return !( lastUpdateTimes_[ index ] == lastUpdateTimes_[ index ] ) ||
+                std::fabs( currentTime - lastUpdateTimes_[ index ] ) >= updateIntervals_[ index ];
+    }
+
+    //! Function to check whether the next call to updateAccelerations performs a full evaluation of a slow acceleration.
+    /*!
+     *  Function to check whether the next call to updateAccelerations at the given time performs a full evaluation of a
+     *  single slow acceleration.
+     *  \param index Index of slow acceleration.
+     *  \param currentTime Time at which the check is to be performed.
+     *  \return True if the next call to updateAccelerations performs a full evaluation of the slow acceleration.
+     */
+    bool isFullEvaluationToBePerformed( const int index, const double currentTime )
+    {
+        return isFullEvaluationDue( index, currentTime ) &&
+                ( !updateAtAcceptedStatesOnly_ || isCurrentStateAccepted_ || isNextEvaluationAtAcceptedState_ ||
+                  !( lastUpdateTimes_[ index ] == lastUpdateTimes_[ index ] ) );
+    }
+
+    //! Function to compute the approximated residual of a slow acceleration at a given time.
+    /*!
+     *  Function to compute the approximated residual of a slow acceleration at a given time, from the residuals at the
+     *  last (two) full evaluations.
+     *  \param index Index of slow acceleration.
+     *  \param currentTime Time at which residual is to be approximated.
+     *  \return Approximated residual.
+     */
+    Eigen::Vector3d getApproximatedResidual( const int index, const double currentTime );
+};
+
+//! Function to create an object for the multi-rate evaluation of a list of acceleration models.
+/*!
+ *  Function to create an object for the multi-rate evaluation of a list of acceleration models. Each acceleration
+ *  model with a type listed in the settings' slow acceleration types is evaluated at the slow rate. For slow spherical
+ *  harmonic accelerations, a companion model truncated to the fast degree and order is created. The coefficients of
+ *  this companion model are taken from the slow model's coefficients at its last full evaluation.
+ *  \param accelerationModelList List of all acceleration models.
+ *  \param multiRateSettings Settings for the multi-rate evaluation.
+ *  \param slowAccelerationIndices Index in the slow acceleration list of each entry of accelerationModelList (-1 if not
+ *  evaluated at slow rate), returned by reference.
+ *  \return Object for the multi-rate evaluation of the slow accelerations (nullptr if no slow accelerations found).
+ */
+std::shared_ptr< MultiRateAccelerationEvaluator > createMultiRateAccelerationEvaluator(
+        const std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel3d > >& accelerationModelList,
+        const std::shared_ptr< MultiRateAccelerationSettings > multiRateSettings,
+        std::vector< int >& slowAccelerationIndices );
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_MULTIRATEACCELERATIONEVALUATOR_H
@@ -22,6 +22,7 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModelTypes.h"
 #include "Tudat/Astrodynamics/Propagators/centralBodyData.h"
+#include "Tudat/Astrodynamics/Propagators/multiRateAccelerationEvaluator.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 
 namespace tudat
@@ -155,7 +156,9 @@ public:
 
     //! Function to clear reference/cached values of acceleration models
     /*!
-     * Function to clear reference/cached values of acceleration models, to ensure that they are all recalculated.
+     * Function to clear reference/cached values of acceleration models, to ensure that they are all recalculated. The
+     * history of the multi-rate evaluator (if any) is retained, as this function is called before each state
+     * derivative evaluation; it is reset at the start of each propagation (see DynamicsStateDerivativeModel).
      */
     void clearTranslationalStateDerivativeModel( )
     {
@@ -187,12 +190,123 @@ public:
      */
     void updateStateDerivativeModel( const TimeType currentTime )
     {
-        for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+        PropagationProfiler* profiler = this->propagationProfiler_.get( );
+        if( multiRateAccelerationEvaluator_ == nullptr )
+        {
+            for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+            {
+                ScopedProfilingTimer profilingTimer(
+                            profiler, getProfilingIndex( profiler, accelerationProfilingIndices_, i ) );
+                accelerationModelList_.at( i )->updateMembers( currentTime );
+            }
+        }
+        else
         {
-            accelerationModelList_.at( i )->updateMembers( currentTime );
+            // Update accelerations evaluated at each call, and (approximate) slow accelerations.
+            for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
+            {
+                if( slowAccelerationIndices_[ i ] < 0 )
+                {
+                    ScopedProfilingTimer profilingTimer(
+                                profiler, getProfilingIndex( profiler, accelerationProfilingIndices_, i ) );
+                    accelerationModelList_.at( i )->updateMembers( currentTime );
+                }
+            }
+
+            ScopedProfilingTimer profilingTimer( profiler, multiRateProfilingIndex_ );
+            multiRateAccelerationEvaluator_->updateAccelerations( static_cast< double >( currentTime ) );
         }
     }
 
+    //! Function to set the object used to profile the computation time of the acceleration models.
+    /*!
+     * Function to set the object used to profile the computation time of the acceleration models. Each acceleration
+     * model is registered separately, by its type and the bodies undergoing and exerting it. When using multi-rate
+     * evaluation, the slow accelerations are profiled as a single entry (re-registered by
+     * setMultiRateAccelerationSettings if the multi-rate settings are changed after calling this function).
+     * \param propagationProfiler Object used to profile the computation time (nullptr to disable profiling).
+     */
+    void setPropagationProfiler( const std::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        this->propagationProfiler_ = propagationProfiler;
+        accelerationProfilingIndices_.clear( );
+        multiRateProfilingIndex_ = -1;
+        if( propagationProfiler == nullptr )
+        {
+            return;
+        }
+
+        for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
+             outerAccelerationIterator != accelerationModelsPerBody_.end( ); outerAccelerationIterator++ )
+        {
+            for( innerAccelerationIterator  = outerAccelerationIterator->second.begin( );
+                 innerAccelerationIterator != outerAccelerationIterator->second.end( );
+                 innerAccelerationIterator++ )
+            {
+                for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
+                {
+                    std::string accelerationName;
+                    try
+                    {
+                        accelerationName = basic_astrodynamics::getAccelerationModelName(
+                                    basic_astrodynamics::getAccelerationModelType(
+                                        innerAccelerationIterator->second.at( j ) ) );
+                    }
+                    catch( std::runtime_error const& )
+                    {
+                        accelerationName = "unidentified acceleration ";
+                    }
+                    accelerationProfilingIndices_.push_back(
+                                propagationProfiler->registerComputation(
+                                    "Acceleration: " + accelerationName + "on " + outerAccelerationIterator->first +
+                                    " by " + innerAccelerationIterator->first ) );
+                }
+            }
+        }
+
+        if( multiRateAccelerationEvaluator_ != nullptr )
+        {
+            multiRateProfilingIndex_ = propagationProfiler->registerComputation(
+                        "Acceleration: multi-rate slow accelerations" );
+        }
+    }
+
+    //! Function to set the settings for multi-rate evaluation of the acceleration models.
+    /*!
+     * Function to set the settings for multi-rate evaluation of the acceleration models. Accelerations of the types
+     * listed in the settings are fully evaluated only at a reduced rate, and approximated in between, as defined by
+     * the MultiRateAccelerationEvaluator class. Providing a nullptr reverts to evaluating all accelerations at each call.
+     * If a profiler has been set, the profiled computations are re-registered, so that the profiling indices are
+     * consistent with the new settings.
+     * \param multiRateAccelerationSettings Settings for multi-rate evaluation of the acceleration models.
+     */
+    void setMultiRateAccelerationSettings(
+            const std::shared_ptr< MultiRateAccelerationSettings > multiRateAccelerationSettings )
+    {
+        multiRateAccelerationEvaluator_ = nullptr;
+        slowAccelerationIndices_.clear( );
+        if( multiRateAccelerationSettings != nullptr )
+        {
+            multiRateAccelerationEvaluator_ = createMultiRateAccelerationEvaluator(
+                        accelerationModelList_, multiRateAccelerationSettings, slowAccelerationIndices_ );
+        }
+
+        if( this->propagationProfiler_ != nullptr )
+        {
+            setPropagationProfiler( this->propagationProfiler_ );
+        }
+    }
+
+    //! Function to retrieve the object for multi-rate evaluation of the acceleration models.
+    /*!
+     * Function to retrieve the object for multi-rate evaluation of the acceleration models.
+     * \return Object for multi-rate evaluation of the acceleration models (nullptr if not used).
+     */
+    std::shared_ptr< MultiRateAccelerationEvaluator > getMultiRateAccelerationEvaluator( )
+    {
+        return multiRateAccelerationEvaluator_;
+    }
+
     //! Function to convert the propagator-specific form of the state to the conventional form in the global frame.
     /*!
      * Function to convert the propagator-specific form of the state to the conventional form in the
@@ -308,7 +422,17 @@ public:
                     for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
                     {
                         // Calculate acceleration and add to state derivative.
-                        totalAcceleration += innerAccelerationIterator->second[ j ]->getAcceleration( );
+                        int slowAccelerationIndex = ( multiRateAccelerationEvaluator_ == nullptr ) ? -1 :
+                                multiRateAccelerationEvaluator_->getSlowAccelerationIndex(
+                                    innerAccelerationIterator->second[ j ] );
+                        if( slowAccelerationIndex < 0 )
+                        {
+                            totalAcceleration += innerAccelerationIterator->second[ j ]->getAcceleration( );
+                        }
+                        else
+                        {
+                            totalAcceleration += multiRateAccelerationEvaluator_->getAcceleration( slowAccelerationIndex );
+                        }
                     }
                 }
             }
@@ -372,6 +496,7 @@ protected:
 
         int currentBodyIndex = 0;
         int currentAccelerationIndex = 0;
+        int currentAccelerationModelIndex = 0;
 
         // Iterate over all bodies with accelerations.
         for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
@@ -388,9 +513,21 @@ protected:
                 for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
                 {
                     // Calculate acceleration and add to state derivative.
-                    stateDerivative.block( currentBodyIndex * 6 + 3, 0, 3, 1 ) += (
-                                innerAccelerationIterator->second[ j ]->getAcceleration( ) ).
-                            template cast< StateScalarType >( );
+                    if( multiRateAccelerationEvaluator_ == nullptr ||
+                            slowAccelerationIndices_[ currentAccelerationModelIndex ] < 0 )
+                    {
+                        stateDerivative.block( currentBodyIndex * 6 + 3, 0, 3, 1 ) += (
+                                    innerAccelerationIterator->second[ j ]->getAcceleration( ) ).
+                                template cast< StateScalarType >( );
+                    }
+                    else
+                    {
+                        stateDerivative.block( currentBodyIndex * 6 + 3, 0, 3, 1 ) += (
+                                    multiRateAccelerationEvaluator_->getAcceleration(
+                                        slowAccelerationIndices_[ currentAccelerationModelIndex ] ) ).
+                                template cast< StateScalarType >( );
+                    }
+                    currentAccelerationModelIndex++;
                 }
             }
 
@@ -449,6 +586,18 @@ protected:
 
     std::vector< int > bodyOrder_;
 
+    //! Object for multi-rate evaluation of the acceleration models (nullptr if not used).
+    std::shared_ptr< MultiRateAccelerationEvaluator > multiRateAccelerationEvaluator_;
+
+    //! Index of each entry of accelerationModelList_ in multi-rate evaluator's slow acceleration list (-1 if not slow).
+    std::vector< int > slowAccelerationIndices_;
+
+    //! Profiling index of each entry of accelerationModelList_ (empty if not profiled).
+    std::vector< int > accelerationProfilingIndices_;
+
+    //! Profiling index of the multi-rate evaluation of the slow accelerations (-1 if not profiled).
+    int multiRateProfilingIndex_ = -1;
+
     //! Predefined iterator to save (de-)allocation time.
     std::unordered_map< std::string, std::vector<
     std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > > >::iterator innerAccelerationIterator;
@@ -0,0 +1,105 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <iomanip>
+
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to register a computation that is to be profiled.
+int PropagationProfiler::registerComputation( const std::string& computationName )
+{
+    std::vector< std::string >::iterator findIterator =
+            std::find( computationNames_.begin( ), computationNames_.end( ), computationName );
+    if( findIterator != computationNames_.end( ) )
+    {
+        return static_cast< int >( std::distance( computationNames_.begin( ), findIterator ) );
+    }
+
+    computationNames_.push_back( computationName );
+    totalComputationTimes_.push_back( 0.0 );
+    numberOfCalls_.push_back( 0 );
+    return static_cast< int >( computationNames_.size( ) ) - 1;
+}
+
+//! Function to reset the accumulated computation times and number of calls of all computations to zero.
+void PropagationProfiler::resetProfilingData( )
+{
+    std::fill( totalComputationTimes_.begin( ), totalComputationTimes_.end( ), 0.0 );
+    std::fill( numberOfCalls_.begin( ), numberOfCalls_.end( ), 0 );
+}
+
+//! Function to retrieve the profiling results.
+std::map< std::string, std::pair< double, unsigned int > > PropagationProfiler::getProfilingResults( )
+{
+    std::map< std::string, std::pair< double, unsigned int > > profilingResults;
+    for( unsigned int i = 0; i < computationNames_.size( ); i++ )
+    {
+        profilingResults[ computationNames_.at( i ) ] =
+                std::make_pair( totalComputationTimes_.at( i ), numberOfCalls_.at( i ) );
+    }
+    return profilingResults;
+}
+
+//! Function to retrieve the total computation time of all computations with a name starting with a given prefix.
+double PropagationProfiler::getTotalComputationTime( const std::string& computationNamePrefix )
+{
+    // Aggregate entries (which contain the time of other entries) are only summed if explicitly requested.
+    const std::string aggregatePrefix = "Total:";
+    bool includeAggregates = ( computationNamePrefix.compare( 0, aggregatePrefix.size( ), aggregatePrefix ) == 0 );
+
+    double totalComputationTime = 0.0;
+    for( unsigned int i = 0; i < computationNames_.size( ); i++ )
+    {
+        if( computationNames_.at( i ).compare( 0, computationNamePrefix.size( ), computationNamePrefix ) == 0 &&
+                ( includeAggregates ||
+                  computationNames_.at( i ).compare( 0, aggregatePrefix.size( ), aggregatePrefix ) != 0 ) )
+        {
+            totalComputationTime += totalComputationTimes_.at( i );
+        }
+    }
+    return totalComputationTime;
+}
+
+//! Function to print the profiling results, sorted by decreasing computation time.
+void PropagationProfiler::printProfilingResults( std::ostream& outputStream )
+{
+    std::vector< unsigned int > sortedIndices;
+    for( unsigned int i = 0; i < computationNames_.size( ); i++ )
+    {
+        sortedIndices.push_back( i );
+    }
+    std::stable_sort( sortedIndices.begin( ), sortedIndices.end( ),
+                      [ & ]( const unsigned int i, const unsigned int j )
+    { return totalComputationTimes_.at( i ) > totalComputationTimes_.at( j ); } );
+
+    outputStream << "Propagation profiling results (total time [s], number of calls, mean time per call [s]):"
+                 << std::endl;
+    for( unsigned int i = 0; i < sortedIndices.size( ); i++ )
+    {
+        unsigned int currentIndex = sortedIndices.at( i );
+        outputStream << std::setw( 14 ) << totalComputationTimes_.at( currentIndex ) << " "
+                     << std::setw( 10 ) << numberOfCalls_.at( currentIndex ) << " "
+                     << std::setw( 14 ) << ( ( numberOfCalls_.at( currentIndex ) > 0 ) ?
+                                                 totalComputationTimes_.at( currentIndex ) /
+                                                 static_cast< double >( numberOfCalls_.at( currentIndex ) ) : 0.0 )
+                     << "  " << computationNames_.at( currentIndex ) << std::endl;
+    }
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -0,0 +1,173 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONPROFILER_H
+#define TUDAT_PROPAGATIONPROFILER_H
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class to accumulate the computation time spent in the separate models used during a propagation.
+/*!
+ *  Class to accumulate the computation time spent in the separate models used during a propagation (environment
+ *  updates, acceleration/torque/mass rate models, variational equations, etc.). Each profiled computation is registered
+ *  once (by name) before the propagation, after which its computation time is added at each call, using the index
+ *  returned at registration (typically through a ScopedProfilingTimer). Profiling is opt-in: models only register
+ *  and time their computations if a profiler has been set. A single profiler object is not thread-safe, and is meant
+ *  to be used by the single thread that evaluates the state derivative it is attached to.
+ */
+class PropagationProfiler
+{
+public:
+
+    //! Constructor
+    PropagationProfiler( ){ }
+
+    //! Function to register a computation that is to be profiled.
+    /*!
+     *  Function to register a computation that is to be profiled. If a computation with the same name has already
+     *  been registered, the index of the existing entry is returned, so that the computation times are combined.
+     *  \param computationName Name of the computation that is to be profiled.
+     *  \return Index of the computation, to be used when adding computation time.
+     */
+    int registerComputation( const std::string& computationName );
+
+    //! Function to add the time spent in a single call of a profiled computation.
+    /*!
+     *  Function to add the time spent in a single call of a profiled computation.
+     *  \param computationIndex Index of the computation, as returned by registerComputation.
+     *  \param computationTime Time (in seconds) spent in the computation.
+     */
+    void addComputationTime( const int computationIndex, const double computationTime )
+    {
+        totalComputationTimes_[ computationIndex ] += computationTime;
+        numberOfCalls_[ computationIndex ]++;
+    }
+
+    //! Function to reset the accumulated computation times and number of calls of all computations to zero.
+    void resetProfilingData( );
+
+    //! Function to retrieve the profiling results.
+    /*!
+     *  Function to retrieve the profiling results.
+     *  \return Map with, per computation name, the total computation time (in seconds) and number of calls.
+     */
+    std::map< std::string, std::pair< double, unsigned int > > getProfilingResults( );
+
+    //! Function to retrieve the total computation time of all computations with a name starting with a given prefix.
+    /*!
+     *  Function to retrieve the total computation time of all computations with a name starting with a given prefix
+     *  (e.g. "Acceleration" for all acceleration models). Aggregate entries, with a name starting with "Total:" (e.g. the
+     *  full state derivative evaluation), contain the time of other entries, and are only included if the prefix
+     *  itself starts with "Total:", so that the default (empty) prefix sums each computation only once.
+     *  \param computationNamePrefix Prefix of names of computations for which the time is to be summed.
+     *  \return Total computation time (in seconds) of all computations with a name starting with the given prefix.
+     */
+    double getTotalComputationTime( const std::string& computationNamePrefix = "" );
+
+    //! Function to print the profiling results, sorted by decreasing computation time.
+    /*!
+     *  Function to print the profiling results, sorted by decreasing computation time.
+     *  \param outputStream Stream to which the results are to be written.
+     */
+    void printProfilingResults( std::ostream& outputStream = std::cout );
+
+private:
+
+    //! Names of the profiled computations.
+    std::vector< std::string > computationNames_;
+
+    //! Total time (in seconds) spent in each profiled computation.
+    std::vector< double > totalComputationTimes_;
+
+    //! Number of calls to each profiled computation.
+    std::vector< unsigned int > numberOfCalls_;
+};
+
+//! Timer that adds the time between its construction and destruction to a profiled computation.
+/*!
+ *  Timer that adds the time between its construction and destruction to a profiled computation. If the profiler is a
+ *  nullptr, no clock is read, so that the overhead when profiling is disabled is limited to a single check.
+ */
+class ScopedProfilingTimer
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor, starts the timer if the profiler is not a nullptr.
+     *  \param propagationProfiler Profiler to which the computation time is to be added (nullptr if not profiled).
+     *  \param computationIndex Index of the computation, as returned by PropagationProfiler::registerComputation.
+     */
+    ScopedProfilingTimer( PropagationProfiler* propagationProfiler, const int computationIndex ):
+        propagationProfiler_( propagationProfiler ), computationIndex_( computationIndex )
+    {
+        if( propagationProfiler_ != nullptr )
+        {
+            startTime_ = std::chrono::steady_clock::now( );
+        }
+    }
+
+    //! Destructor, adds the time since construction to the profiler.
+    ~ScopedProfilingTimer( )
+    {
+        if( propagationProfiler_ != nullptr )
+        {
+            propagationProfiler_->addComputationTime(
+                        computationIndex_, std::chrono::duration< double >(
+                            std::chrono::steady_clock::now( ) - startTime_ ).count( ) );
+        }
+    }
+
+private:
+
+    //! Profiler to which the computation time is to be added (nullptr if not profiled).
+    PropagationProfiler* propagationProfiler_;
+
+    //! Index of the computation, as returned by PropagationProfiler::registerComputation.
+    int computationIndex_;
+
+    //! Clock time at construction.
+    std::chrono::steady_clock::time_point startTime_;
+};
+
+//! Function to retrieve the profiling index of an entry in a list of profiled computations.
+/*!
+ *  Function to retrieve the profiling index of an entry in a list of profiled computations, for use in the constructor
+ *  of a ScopedProfilingTimer.
+ *  \param propagationProfiler Profiler that is used (nullptr if profiling is disabled).
+ *  \param computationIndices Indices of the profiled computations, as returned by
+ *  PropagationProfiler::registerComputation (not used if propagationProfiler is a nullptr).
+ *  \param entry Entry in computationIndices for which the index is to be retrieved.
+ *  \return Profiling index of requested entry (-1 if profiling is disabled).
+ */
+inline int getProfilingIndex( const PropagationProfiler* propagationProfiler,
+                              const std::vector< int >& computationIndices,
+                              const int entry )
+{
+    return ( propagationProfiler == nullptr ) ? -1 : computationIndices[ entry ];
+}
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONPROFILER_H
@@ -75,6 +75,65 @@ Eigen::Vector4d calculateQuaternionDerivative( const Eigen::Vector4d& currentQua
     return getQuaterionToQuaternionRateMatrix( angularVelocityVectorInBodyFixedFrame ) * currentQuaternionsToBaseFrame;
 }
 
+//! Function to compute the product of two quaternions (in vector representation).
+Eigen::Vector4d multiplyQuaternions( const Eigen::Vector4d& leftQuaternion, const Eigen::Vector4d& rightQuaternion )
+{
+    Eigen::Vector3d leftVectorPart = leftQuaternion.segment< 3 >( 1 );
+    Eigen::Vector3d rightVectorPart = rightQuaternion.segment< 3 >( 1 );
+
+    Eigen::Vector4d quaternionProduct;
+    quaternionProduct( 0 ) = leftQuaternion( 0 ) * rightQuaternion( 0 ) - leftVectorPart.dot( rightVectorPart );
+    quaternionProduct.segment< 3 >( 1 ) = leftQuaternion( 0 ) * rightVectorPart + rightQuaternion( 0 ) * leftVectorPart +
+            leftVectorPart.cross( rightVectorPart );
+    return quaternionProduct;
+}
+
+//! Function to compute the unit quaternion (in vector representation) corresponding to a rotation vector.
+Eigen::Vector4d convertRotationVectorToQuaternion( const Eigen::Vector3d& rotationVector )
+{
+    double rotationAngle = rotationVector.norm( );
+
+    // Use series expansion of sin( x / 2 ) / x for small angles
+    double scaledSineOfHalfAngle;
+    if( rotationAngle < 1.0E-4 )
+    {
+        scaledSineOfHalfAngle = 0.5 - rotationAngle * rotationAngle / 48.0;
+    }
+    else
+    {
+        scaledSineOfHalfAngle = std::sin( 0.5 * rotationAngle ) / rotationAngle;
+    }
+
+    Eigen::Vector4d quaternion;
+    quaternion( 0 ) = std::cos( 0.5 * rotationAngle );
+    quaternion.segment< 3 >( 1 ) = scaledSineOfHalfAngle * rotationVector;
+    return quaternion;
+}
+
+//! Function to compute the time derivative of the rotation vector that defines the change in rotation of a body.
+Eigen::Vector3d calculateRotationVectorDerivative( const Eigen::Vector3d& rotationVector,
+                                                   const Eigen::Vector3d& angularVelocityVectorInBodyFixedFrame )
+{
+    double rotationAngle = rotationVector.norm( );
+
+    // Compute coefficient of double cross product term, using series expansion for small angles
+    double doubleCrossProductCoefficient;
+    if( rotationAngle < 1.0E-4 )
+    {
+        doubleCrossProductCoefficient = 1.0 / 12.0 + rotationAngle * rotationAngle / 720.0;
+    }
+    else
+    {
+        double halfAngle = 0.5 * rotationAngle;
+        doubleCrossProductCoefficient = ( 1.0 - halfAngle * std::cos( halfAngle ) / std::sin( halfAngle ) ) /
+                ( rotationAngle * rotationAngle );
+    }
+
+    Eigen::Vector3d rotationVectorCrossAngularVelocity = rotationVector.cross( angularVelocityVectorInBodyFixedFrame );
+    return angularVelocityVectorInBodyFixedFrame + 0.5 * rotationVectorCrossAngularVelocity +
+            doubleCrossProductCoefficient * rotationVector.cross( rotationVectorCrossAngularVelocity );
+}
+
 template class RotationalMotionQuaternionsStateDerivative< double, double >;
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
@@ -54,6 +54,37 @@ Eigen::Matrix< double, 4, 3 > getAngularVelocityToQuaternionRateMatrix( const Ei
 Eigen::Vector4d calculateQuaternionDerivative( const Eigen::Vector4d& currentQuaternionsToBaseFrame,
                                                const Eigen::Vector3d& angularVelocityVectorInBodyFixedFrame );
 
+//! Function to compute the product of two quaternions (in vector representation).
+/*!
+ * Function to compute the (Hamilton) product of two quaternions, both in vector representation (scalar part first).
+ * \param leftQuaternion Quaternion on left-hand side of product
+ * \param rightQuaternion Quaternion on right-hand side of product
+ * \return Product leftQuaternion * rightQuaternion, in vector representation
+ */
+Eigen::Vector4d multiplyQuaternions( const Eigen::Vector4d& leftQuaternion, const Eigen::Vector4d& rightQuaternion );
+
+//! Function to compute the unit quaternion (in vector representation) corresponding to a rotation vector.
+/*!
+ * Function to compute the unit quaternion (in vector representation) corresponding to a rotation vector, i.e. the
+ * exponential map from the Lie algebra so(3) to the unit quaternions.
+ * \param rotationVector Rotation vector, with direction the rotation axis and norm the rotation angle.
+ * \return Unit quaternion (in vector representation) corresponding to rotationVector.
+ */
+Eigen::Vector4d convertRotationVectorToQuaternion( const Eigen::Vector3d& rotationVector );
+
+//! Function to compute the time derivative of the rotation vector that defines the change in rotation of a body.
+/*!
+ * Function to compute the time derivative of the rotation vector theta that defines the change in rotation of a body,
+ * such that q = q_0 * exp( theta ), where q is the quaternion of body-fixed to inertial frame, and q_0 is a constant
+ * quaternion. This is the inverse of the derivative of the exponential map (dexp^-1) on SO(3), evaluated in closed
+ * form. It is used by Lie-group (Munthe-Kaas) integration of the quaternion kinematics.
+ * \param rotationVector Current rotation vector theta
+ * \param angularVelocityVectorInBodyFixedFrame Current angular velocity vector of body, expressed in its body-fixed frame
+ * \return Time derivative of rotation vector theta
+ */
+Eigen::Vector3d calculateRotationVectorDerivative( const Eigen::Vector3d& rotationVector,
+                                                   const Eigen::Vector3d& angularVelocityVectorInBodyFixedFrame );
+
 //! Class for computing the state derivative for rotational dynamics of N bodies.
 /*!
  *  Class for computing the state derivative for rotational dynamics of N bodies, using quaternion from body-fixed to inertial
@@ -20,6 +20,7 @@
 #include <functional>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModel.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModelTypes.h"
 
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
@@ -39,6 +40,63 @@ enum RotationalPropagatorType
     exponential_map = 2
 };
 
+//! Enum listing the integrators that can be used for the sub-steps of sub-cycled rotational dynamics.
+enum RotationalSubStepIntegratorType
+{
+    //! Classical fourth-order Runge-Kutta method, applied to the propagated rotational state.
+    runge_kutta_4_rotational_sub_step = 0,
+    //! Fourth-order Runge-Kutta-Munthe-Kaas (Lie-group) method, only for quaternion propagation.
+    munthe_kaas_runge_kutta_4_rotational_sub_step = 1
+};
+
+//! Class defining settings for sub-cycling the rotational dynamics inside the steps of the numerical integration.
+/*!
+ *  Class defining settings for sub-cycling the rotational dynamics inside the steps of the numerical integration. When
+ *  used, the rotational state is kept constant by the numerical integrator during each (translational) step, after which
+ *  it is integrated over the step with numberOfSubSteps_ fixed-size sub-steps. During these sub-steps, the remaining (e.g.
+ *  translational) states are interpolated inside the step, and communicated to the torque models through the
+ *  environment. This allows the translational step size to be set by the (typically slow) translational dynamics, while
+ *  the (typically fast) rotational dynamics is resolved at the finer sub-step. Inside each step, the remaining state
+ *  derivatives are evaluated with the rotational state extrapolated from the start of the step (to second order in time),
+ *  so that the coupling between the two is second order in the step size, as opposed to first order if the rotational
+ *  state at the start of the step were used. This extrapolation is only accurate if the rotation over a single step is
+ *  (nearly) at constant angular velocity, or small. Note that the step-size control of a variable step-size integrator
+ *  does not include the error of the rotational state, which is only set by the number of sub-steps.
+ *  For quaternion propagation, the sub-steps can be taken with a Runge-Kutta-Munthe-Kaas method, which integrates the
+ *  rotation over each sub-step in the Lie algebra of SO(3), and updates the quaternion by quaternion multiplication. The
+ *  quaternion then remains on the unit sphere by construction, and a rotation at (nearly) constant angular velocity is
+ *  integrated (nearly) exactly, allowing much larger sub-steps than a Runge-Kutta method applied to the quaternion
+ *  elements, in particular for rapidly spinning bodies. This option may be used with a single sub-step per integration
+ *  step, including for propagations of the rotational state only.
+ */
+class RotationalSubCyclingSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfSubSteps Number of rotational integration sub-steps per integration step.
+     *  \param subStepIntegratorType Integrator used for the rotational integration sub-steps.
+     */
+    RotationalSubCyclingSettings(
+            const unsigned int numberOfSubSteps,
+            const RotationalSubStepIntegratorType subStepIntegratorType = runge_kutta_4_rotational_sub_step ):
+        numberOfSubSteps_( numberOfSubSteps ), subStepIntegratorType_( subStepIntegratorType )
+    {
+        if( numberOfSubSteps_ == 0 )
+        {
+            throw std::runtime_error( "Error when creating rotational sub-cycling settings, number of sub-steps must be positive." );
+        }
+    }
+
+    //! Number of rotational integration sub-steps per integration step.
+    unsigned int numberOfSubSteps_;
+
+    //! Integrator used for the rotational integration sub-steps.
+    RotationalSubStepIntegratorType subStepIntegratorType_;
+};
+
 //! Function to evaluated the classical rotational equations of motion (Euler equations)
 /*!
  * Function to evaluated the classical rotational equations of motion (Euler equations). The function returns the time-derivative
@@ -175,6 +233,8 @@ public:
      */
     void updateStateDerivativeModel( const TimeType currentTime )
     {
+        PropagationProfiler* profiler = this->propagationProfiler_.get( );
+        int currentTorqueModelIndex = 0;
         for( torqueModelMapIterator = torqueModelsPerBody_.begin( );
              torqueModelMapIterator != torqueModelsPerBody_.end( ); torqueModelMapIterator++ )
         {
@@ -183,7 +243,52 @@ public:
             {
                 for( unsigned int j = 0; j < innerTorqueIterator->second.size( ); j++ )
                 {
+                    ScopedProfilingTimer profilingTimer(
+                                profiler, getProfilingIndex( profiler, torqueProfilingIndices_, currentTorqueModelIndex ) );
                     innerTorqueIterator->second[ j ]->updateMembers( currentTime );
+                    currentTorqueModelIndex++;
+                }
+            }
+        }
+    }
+
+    //! Function to set the object used to profile the computation time of the torque models.
+    /*!
+     * Function to set the object used to profile the computation time of the torque models. Each torque model is
+     * registered separately, by its type and the bodies undergoing and exerting it.
+     * \param propagationProfiler Object used to profile the computation time (nullptr to disable profiling).
+     */
+    void setPropagationProfiler( const std::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        this->propagationProfiler_ = propagationProfiler;
+        torqueProfilingIndices_.clear( );
+        if( propagationProfiler == nullptr )
+        {
+            return;
+        }
+
+        for( torqueModelMapIterator = torqueModelsPerBody_.begin( );
+             torqueModelMapIterator != torqueModelsPerBody_.end( ); torqueModelMapIterator++ )
+        {
+            for( innerTorqueIterator = torqueModelMapIterator->second.begin( ); innerTorqueIterator !=
+                 torqueModelMapIterator->second.end( ); innerTorqueIterator++ )
+            {
+                for( unsigned int j = 0; j < innerTorqueIterator->second.size( ); j++ )
+                {
+                    std::string torqueName;
+                    try
+                    {
+                        torqueName = basic_astrodynamics::getTorqueModelName(
+                                    basic_astrodynamics::getTorqueModelType( innerTorqueIterator->second[ j ] ) );
+                    }
+                    catch( std::runtime_error const& )
+                    {
+                        torqueName = "unidentified torque ";
+                    }
+                    torqueProfilingIndices_.push_back(
+                                propagationProfiler->registerComputation(
+                                    "Torque: " + torqueName + "on " + torqueModelMapIterator->first +
+                                    " by " + innerTorqueIterator->first ) );
                 }
             }
         }
@@ -288,6 +393,27 @@ public:
         return propagatorType_;
     }
 
+    //! Function to set the settings for sub-cycling the rotational dynamics inside the integration steps.
+    /*!
+     * Function to set the settings for sub-cycling the rotational dynamics inside the integration steps (see
+     * RotationalSubCyclingSettings). The sub-cycling itself is performed by the DynamicsStateDerivativeModel.
+     * \param subCyclingSettings Settings for sub-cycling the rotational dynamics (nullptr if not sub-cycled).
+     */
+    void setSubCyclingSettings( const std::shared_ptr< RotationalSubCyclingSettings > subCyclingSettings )
+    {
+        subCyclingSettings_ = subCyclingSettings;
+    }
+
+    //! Function to get the settings for sub-cycling the rotational dynamics inside the integration steps.
+    /*!
+     * Function to get the settings for sub-cycling the rotational dynamics inside the integration steps.
+     * \return Settings for sub-cycling the rotational dynamics (nullptr if not sub-cycled).
+     */
+    std::shared_ptr< RotationalSubCyclingSettings > getSubCyclingSettings( )
+    {
+        return subCyclingSettings_;
+    }
+
 protected:
 
     //! Function to get the total torques acting on each body, expressed in the body-fixed frames
@@ -354,6 +480,12 @@ protected:
     //! Predefined iterator to save (de-)allocation time.
     basic_astrodynamics::SingleBodyTorqueModelMap::iterator innerTorqueIterator;
 
+    //! Profiling index of each torque model, in order of iteration over torqueModelsPerBody_ (empty if not profiled).
+    std::vector< int > torqueProfilingIndices_;
+
+    //! Settings for sub-cycling the rotational dynamics inside the integration steps (nullptr if not sub-cycled).
+    std::shared_ptr< RotationalSubCyclingSettings > subCyclingSettings_;
+
 };
 
 
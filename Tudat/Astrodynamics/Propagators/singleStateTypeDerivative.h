@@ -12,12 +12,15 @@
 #define TUDAT_STATEDERIVATIVE_H
 
 #include <map>
+#include <memory>
 
 #include <Eigen/Core>
 
 #include "Tudat/Basics/timeType.h"
 #include <Tudat/Basics/utilityMacros.h>
 
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
+
 namespace tudat
 {
 
@@ -229,11 +232,25 @@ public:
         return false;
     }
 
+    //! Function to set the object used to profile the computation time of the state derivative models.
+    /*!
+     * Function to set the object used to profile the computation time of the state derivative models. Derived
+     * classes register their individual models (e.g. acceleration models) with the profiler in this function.
+     * \param propagationProfiler Object used to profile the computation time (nullptr to disable profiling).
+     */
+    virtual void setPropagationProfiler( const std::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        propagationProfiler_ = propagationProfiler;
+    }
+
 protected:
 
     //! Type of dynamics for which the state derivative is calculated.
     IntegratedStateType integratedStateType_;
 
+    //! Object used to profile the computation time of the state derivative models (nullptr if not profiled).
+    std::shared_ptr< PropagationProfiler > propagationProfiler_;
+
     //! Vector used during post-processing of state.
     Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > unprocessedState_;
 };
@@ -8,6 +8,10 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+#include <cmath>
+#include <string>
+
 #include <boost/make_shared.hpp>
 
 #include "Tudat/Astrodynamics/Propagators/stateTransitionMatrixInterface.h"
@@ -33,6 +37,14 @@ void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrix
 Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrix(
         const double evaluationTime )
 {
+    if( stateTransitionMatrixInterpolator_ == nullptr ||
+            ( sensitivityMatrixSize_ > 0 && sensitivityMatrixInterpolator_ == nullptr ) )
+    {
+        throw std::runtime_error(
+                    "Error when retrieving state transition and sensitivity matrix, interpolators have not been set "
+                    "(variational equations not yet integrated)" );
+    }
+
     combinedStateTransitionMatrix_.setZero( );
 
     // Set Phi and S matrices.
@@ -48,6 +60,248 @@ Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::g
     return combinedStateTransitionMatrix_;
 }
 
+//! Function to reset the state transition matrix interpolator and the matrix histories
+void SingleArcQuadratureSensitivityMatrixInterface::updateMatrixHistories(
+        const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
+        stateTransitionMatrixInterpolator,
+        const std::map< double, Eigen::MatrixXd >& stateTransitionMatrixHistory,
+        const std::map< double, Eigen::MatrixXd >& parameterPartialHistory )
+{
+    if( stateTransitionMatrixHistory.size( ) != parameterPartialHistory.size( ) )
+    {
+        throw std::runtime_error(
+                    "Error when making quadrature sensitivity matrix interface, matrix histories have different sizes" );
+    }
+
+    stateTransitionMatrixInterpolator_ = stateTransitionMatrixInterpolator;
+
+    epochs_.clear( );
+    stateTransitionMatrices_.clear( );
+    parameterPartials_.clear( );
+
+    // Retrieve matrix histories, and check consistency of epochs and matrix sizes.
+    std::map< double, Eigen::MatrixXd >::const_iterator parameterPartialIterator = parameterPartialHistory.begin( );
+    for( std::map< double, Eigen::MatrixXd >::const_iterator stateTransitionIterator =
+         stateTransitionMatrixHistory.begin( ); stateTransitionIterator != stateTransitionMatrixHistory.end( );
+         stateTransitionIterator++ )
+    {
+        if( stateTransitionIterator->first != parameterPartialIterator->first )
+        {
+            throw std::runtime_error(
+                        "Error when making quadrature sensitivity matrix interface, matrix histories have different epochs" );
+        }
+
+        if( stateTransitionIterator->second.rows( ) != stateTransitionMatrixSize_ ||
+                stateTransitionIterator->second.cols( ) != stateTransitionMatrixSize_ ||
+                parameterPartialIterator->second.rows( ) != stateTransitionMatrixSize_ ||
+                parameterPartialIterator->second.cols( ) != sensitivityMatrixSize_ )
+        {
+            throw std::runtime_error(
+                        "Error when making quadrature sensitivity matrix interface, matrix sizes are inconsistent" );
+        }
+
+        epochs_.push_back( stateTransitionIterator->first );
+        stateTransitionMatrices_.push_back( stateTransitionIterator->second );
+        parameterPartials_.push_back( parameterPartialIterator->second );
+        parameterPartialIterator++;
+    }
+
+    // Reset lazily computed quantities.
+    int numberOfEpochs = epochs_.size( );
+    stateTransitionMatrixDecompositions_.clear( );
+    stateTransitionMatrixDecompositions_.resize( numberOfEpochs );
+    isStateTransitionMatrixDecomposed_ = std::vector< bool >( numberOfEpochs, false );
+
+    integrands_ = std::vector< Eigen::MatrixXd >(
+                numberOfEpochs, Eigen::MatrixXd::Zero( stateTransitionMatrixSize_, sensitivityMatrixSize_ ) );
+    cumulativeIntegrals_ = integrands_;
+    numberOfIntegrandEpochs_ = std::vector< int >( sensitivityMatrixSize_, 0 );
+    numberOfIntegratedEpochs_ = std::vector< int >( sensitivityMatrixSize_, 0 );
+
+    // Determine columns of sensitivity matrix that are not identically zero (i.e. for which B is not identically zero)
+    nonZeroSensitivityMatrixColumns_.clear( );
+    for( int i = 0; i < sensitivityMatrixSize_; i++ )
+    {
+        for( int j = 0; j < numberOfEpochs; j++ )
+        {
+            if( !parameterPartials_.at( j ).col( i ).isZero( 0.0 ) )
+            {
+                nonZeroSensitivityMatrixColumns_.push_back( i );
+                break;
+            }
+        }
+    }
+
+    if( numberOfEpochs > 0 )
+    {
+        lookUpScheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >( epochs_ );
+    }
+    else
+    {
+        lookUpScheme_ = nullptr;
+    }
+
+    combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
+                stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+}
+
+//! Function to get the selected columns of the sensitivity matrix at a given time.
+Eigen::MatrixXd SingleArcQuadratureSensitivityMatrixInterface::getSensitivityMatrixColumns(
+        const double evaluationTime, const std::vector< int >& columnIndices )
+{
+    if( stateTransitionMatrixInterpolator_ == nullptr )
+    {
+        throw std::runtime_error(
+                    "Error when computing sensitivity matrix by quadrature, state transition matrix interpolator has not "
+                    "been set (variational equations not yet integrated)" );
+    }
+
+    if( epochs_.size( ) < 2 )
+    {
+        throw std::runtime_error(
+                    "Error when computing sensitivity matrix by quadrature, at least two epochs are required" );
+    }
+
+    // Find interval in which evaluation time lies.
+    int epochIndex = std::min( std::max( lookUpScheme_->findNearestLowerNeighbour( evaluationTime ), 0 ),
+                               static_cast< int >( epochs_.size( ) ) - 2 );
+
+    // Compute integral of Phi^{-1}B for requested columns, up to evaluation time.
+    Eigen::MatrixXd integral = Eigen::MatrixXd( stateTransitionMatrixSize_, columnIndices.size( ) );
+    for( unsigned int i = 0; i < columnIndices.size( ); i++ )
+    {
+        int columnIndex = columnIndices.at( i );
+        if( columnIndex < 0 || columnIndex >= sensitivityMatrixSize_ )
+        {
+            throw std::runtime_error(
+                        "Error when computing sensitivity matrix by quadrature, column index " +
+                        std::to_string( columnIndex ) + " is out of bounds" );
+        }
+
+        updateCumulativeIntegral( columnIndex, epochIndex );
+        integral.col( i ) = cumulativeIntegrals_.at( epochIndex ).col( columnIndex ) +
+                integrateInterpolatedIntegrand( columnIndex, epochIndex, evaluationTime );
+    }
+
+    return stateTransitionMatrixInterpolator_->interpolate( evaluationTime ) * integral;
+}
+
+//! Function to get the concatenated state transition and sensitivity matrix at a given time.
+Eigen::MatrixXd SingleArcQuadratureSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrix(
+        const double evaluationTime )
+{
+    if( stateTransitionMatrixInterpolator_ == nullptr )
+    {
+        throw std::runtime_error(
+                    "Error when retrieving state transition and sensitivity matrix, state transition matrix interpolator "
+                    "has not been set (variational equations not yet integrated)" );
+    }
+
+    combinedStateTransitionMatrix_.setZero( );
+
+    // Set Phi matrix.
+    combinedStateTransitionMatrix_.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
+            stateTransitionMatrixInterpolator_->interpolate( evaluationTime );
+
+    // Set columns of S matrix that are not identically zero (remaining columns are left zero).
+    if( nonZeroSensitivityMatrixColumns_.size( ) > 0 )
+    {
+        Eigen::MatrixXd sensitivityMatrixColumns =
+                getSensitivityMatrixColumns( evaluationTime, nonZeroSensitivityMatrixColumns_ );
+        for( unsigned int i = 0; i < nonZeroSensitivityMatrixColumns_.size( ); i++ )
+        {
+            combinedStateTransitionMatrix_.col( stateTransitionMatrixSize_ + nonZeroSensitivityMatrixColumns_.at( i ) ) =
+                    sensitivityMatrixColumns.col( i );
+        }
+    }
+
+    return combinedStateTransitionMatrix_;
+}
+
+//! Function to compute the integrand Phi^{-1}B for a single column, up to (and including) the given epoch.
+void SingleArcQuadratureSensitivityMatrixInterface::updateIntegrand( const int columnIndex, const int lastEpochIndex )
+{
+    for( int i = numberOfIntegrandEpochs_.at( columnIndex ); i <= lastEpochIndex; i++ )
+    {
+        if( !isStateTransitionMatrixDecomposed_.at( i ) )
+        {
+            stateTransitionMatrixDecompositions_[ i ].compute( stateTransitionMatrices_.at( i ) );
+            isStateTransitionMatrixDecomposed_[ i ] = true;
+        }
+
+        integrands_[ i ].col( columnIndex ) =
+                stateTransitionMatrixDecompositions_.at( i ).solve( parameterPartials_.at( i ).col( columnIndex ) );
+    }
+
+    numberOfIntegrandEpochs_[ columnIndex ] = std::max( numberOfIntegrandEpochs_.at( columnIndex ), lastEpochIndex + 1 );
+}
+
+//! Function to compute the cumulative integral of Phi^{-1}B for a single column, up to (and including) the given epoch.
+void SingleArcQuadratureSensitivityMatrixInterface::updateCumulativeIntegral(
+        const int columnIndex, const int lastEpochIndex )
+{
+    if( numberOfIntegratedEpochs_.at( columnIndex ) == 0 )
+    {
+        cumulativeIntegrals_[ 0 ].col( columnIndex ).setZero( );
+        numberOfIntegratedEpochs_[ columnIndex ] = 1;
+    }
+
+    for( int i = numberOfIntegratedEpochs_.at( columnIndex ); i <= lastEpochIndex; i++ )
+    {
+        cumulativeIntegrals_[ i ].col( columnIndex ) = cumulativeIntegrals_.at( i - 1 ).col( columnIndex ) +
+                integrateInterpolatedIntegrand( columnIndex, i - 1, epochs_.at( i ) );
+        numberOfIntegratedEpochs_[ columnIndex ] = i + 1;
+    }
+}
+
+//! Function to get the index of the first epoch of the interpolation stencil for the interval starting at given epoch.
+int SingleArcQuadratureSensitivityMatrixInterface::getStencilStartIndex( const int epochIndex )
+{
+    int numberOfEpochs = epochs_.size( );
+    if( numberOfEpochs <= 4 )
+    {
+        return 0;
+    }
+    else
+    {
+        return std::min( std::max( epochIndex - 1, 0 ), numberOfEpochs - 4 );
+    }
+}
+
+//! Function to integrate the interpolated integrand of a single column from an epoch to a given upper limit.
+Eigen::VectorXd SingleArcQuadratureSensitivityMatrixInterface::integrateInterpolatedIntegrand(
+        const int columnIndex, const int epochIndex, const double upperLimit )
+{
+    int stencilStartIndex = getStencilStartIndex( epochIndex );
+    int stencilSize = std::min( 4, static_cast< int >( epochs_.size( ) ) );
+    updateIntegrand( columnIndex, stencilStartIndex + stencilSize - 1 );
+
+    // Integrate Lagrange polynomial (degree <= 3) exactly using two-point Gauss-Legendre quadrature.
+    double halfIntervalSize = ( upperLimit - epochs_.at( epochIndex ) ) / 2.0;
+    double intervalMidPoint = ( upperLimit + epochs_.at( epochIndex ) ) / 2.0;
+    double gaussPointOffset = halfIntervalSize / std::sqrt( 3.0 );
+
+    Eigen::VectorXd integral = Eigen::VectorXd::Zero( stateTransitionMatrixSize_ );
+    for( int i = 0; i < 2; i++ )
+    {
+        double currentTime = intervalMidPoint + ( i == 0 ? -gaussPointOffset : gaussPointOffset );
+        for( int j = stencilStartIndex; j < stencilStartIndex + stencilSize; j++ )
+        {
+            double lagrangeCoefficient = 1.0;
+            for( int k = stencilStartIndex; k < stencilStartIndex + stencilSize; k++ )
+            {
+                if( k != j )
+                {
+                    lagrangeCoefficient *= ( currentTime - epochs_.at( k ) ) / ( epochs_.at( j ) - epochs_.at( k ) );
+                }
+            }
+            integral += halfIntervalSize * lagrangeCoefficient * integrands_.at( j ).col( columnIndex );
+        }
+    }
+
+    return integral;
+}
+
 //! Constructor
 MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::MultiArcCombinedStateTransitionAndSensitivityMatrixInterface(
         const std::vector< std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > >
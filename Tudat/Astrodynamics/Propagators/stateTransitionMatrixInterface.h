@@ -12,11 +12,13 @@
 #define TUDAT_STATETRANSITIONMATRIXINTERFACE_H
 
 #include <iostream>
+#include <map>
 #include <vector>
 
 #include <memory>
 
 #include <Eigen/Core>
+#include <Eigen/LU>
 
 #include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
 
@@ -221,6 +223,203 @@ private:
     sensitivityMatrixInterpolator_;
 };
 
+
+//! Interface object for single-arc estimation, in which the sensitivity matrix is computed by quadrature.
+/*!
+ *  Interface object for single-arc estimation, in which only the state transition matrix Phi is numerically integrated,
+ *  and the sensitivity matrix S is computed from the stored history of Phi and the partial derivatives B of the state
+ *  derivative w.r.t. the parameters, using S(t) = Phi(t) int_{t0}^{t} Phi^{-1}(tau) B(tau) dtau. The integral is evaluated
+ *  by integrating a piecewise cubic Lagrange polynomial through the integrand at the epochs of the numerical solution.
+ *  All computations are done lazily: the integrand and its cumulative integral are only evaluated for the columns of S
+ *  that are requested, and only up to the latest epoch that has been requested. This avoids the cost of integrating
+ *  the full sensitivity matrix when it is only (sparsely) needed, e.g. for consider parameters and biases.
+ */
+class SingleArcQuadratureSensitivityMatrixInterface: public CombinedStateTransitionAndSensitivityMatrixInterface
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param stateTransitionMatrixInterpolator Interpolator returning the state transition matrix as a function of time.
+     * \param stateTransitionMatrixHistory History of the state transition matrix at the epochs of the numerical solution.
+     * \param parameterPartialHistory History of the partial derivatives of the state derivative w.r.t. the (non-initial
+     * state) parameters, at the same epochs as stateTransitionMatrixHistory.
+     * \param numberOfInitialDynamicalParameters Size of the estimated initial state vector (and size of square
+     * state transition matrix.
+     * \param numberOfParameters Total number of estimated parameters (initial states and other parameters).
+     */
+    SingleArcQuadratureSensitivityMatrixInterface(
+            const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
+            stateTransitionMatrixInterpolator,
+            const std::map< double, Eigen::MatrixXd >& stateTransitionMatrixHistory,
+            const std::map< double, Eigen::MatrixXd >& parameterPartialHistory,
+            const int numberOfInitialDynamicalParameters,
+            const int numberOfParameters ):
+        CombinedStateTransitionAndSensitivityMatrixInterface( numberOfInitialDynamicalParameters, numberOfParameters )
+    {
+        updateMatrixHistories( stateTransitionMatrixInterpolator, stateTransitionMatrixHistory, parameterPartialHistory );
+    }
+
+    //! Destructor.
+    ~SingleArcQuadratureSensitivityMatrixInterface( ){ }
+
+    //! Function to reset the state transition matrix interpolator and the matrix histories
+    /*!
+     * Function to reset the state transition matrix interpolator and the matrix histories, clearing all lazily computed
+     * sensitivity matrix information.
+     * \param stateTransitionMatrixInterpolator New interpolator returning the state transition matrix as a function of time.
+     * \param stateTransitionMatrixHistory New history of the state transition matrix.
+     * \param parameterPartialHistory New history of the partial derivatives of the state derivative w.r.t. the parameters.
+     */
+    void updateMatrixHistories(
+            const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
+            stateTransitionMatrixInterpolator,
+            const std::map< double, Eigen::MatrixXd >& stateTransitionMatrixHistory,
+            const std::map< double, Eigen::MatrixXd >& parameterPartialHistory );
+
+    //! Function to get the interpolator returning the state transition matrix as a function of time.
+    /*!
+     * Function to get the interpolator returning the state transition matrix as a function of time.
+     * \return Interpolator returning the state transition matrix as a function of time.
+     */
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
+    getStateTransitionMatrixInterpolator( )
+    {
+        return stateTransitionMatrixInterpolator_;
+    }
+
+    //! Function to get the selected columns of the sensitivity matrix at a given time.
+    /*!
+     *  Function to get the selected columns of the sensitivity matrix at a given time. Only the requested columns of the
+     *  integral of Phi^{-1}B are computed (if not yet available up to evaluationTime).
+     *  \param evaluationTime Time at which to evaluate the sensitivity matrix
+     *  \param columnIndices Indices of the columns of the sensitivity matrix that are to be computed.
+     *  \return Requested columns of the sensitivity matrix (in order of columnIndices).
+     */
+    Eigen::MatrixXd getSensitivityMatrixColumns( const double evaluationTime, const std::vector< int >& columnIndices );
+
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time. The sensitivity matrix
+     *  is retrieved from getSensitivityMatrixColumns, for only those columns for which the partials w.r.t. the parameter
+     *  are not identically zero (see getNonZeroSensitivityMatrixColumns). All other columns are identically zero, and are
+     *  not computed.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \return Concatenated state transition and sensitivity matrices.
+     */
+    Eigen::MatrixXd getCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime );
+
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time
+     *  (functionality equal to getCombinedStateTransitionAndSensitivityMatrix for single-arc case).
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \return Concatenated state transition and sensitivity matrices.
+     */
+    Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime )
+    {
+        return getCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
+    }
+
+    //! Function to get the size of the total parameter vector.
+    /*!
+     * Function to get the size of the total parameter vector. For single-arc, this is simply the combination of
+     * the size of the state transition and sensitivity matrices.
+     * \return Size of the total parameter vector.
+     */
+    int getFullParameterVectorSize( )
+    {
+        return sensitivityMatrixSize_ + stateTransitionMatrixSize_;
+    }
+
+    //! Function to get the indices of the columns of the sensitivity matrix that are not identically zero.
+    /*!
+     * Function to get the indices of the columns of the sensitivity matrix that are not identically zero, i.e. the columns
+     * for which the partial derivative of the state derivative w.r.t. the parameter is non-zero at one or more epochs.
+     * For parameters that do not influence the dynamics (e.g. observation biases), the column is identically zero.
+     * \return Indices of the columns of the sensitivity matrix that are not identically zero.
+     */
+    std::vector< int > getNonZeroSensitivityMatrixColumns( )
+    {
+        return nonZeroSensitivityMatrixColumns_;
+    }
+
+    //! Function to get the number of epochs for which the integral of a column of Phi^{-1}B has been computed.
+    /*!
+     * Function to get the number of epochs (counted from the first epoch) for which the cumulative integral of a column
+     * of Phi^{-1}B has been computed so far.
+     * \param columnIndex Index of column of sensitivity matrix
+     * \return Number of epochs for which the cumulative integral has been computed.
+     */
+    int getNumberOfIntegratedEpochs( const int columnIndex )
+    {
+        return numberOfIntegratedEpochs_.at( columnIndex );
+    }
+
+private:
+
+    //! Function to compute the integrand Phi^{-1}B for a single column, up to (and including) the given epoch.
+    void updateIntegrand( const int columnIndex, const int lastEpochIndex );
+
+    //! Function to compute the cumulative integral of Phi^{-1}B for a single column, up to (and including) the given epoch.
+    void updateCumulativeIntegral( const int columnIndex, const int lastEpochIndex );
+
+    //! Function to integrate the interpolated integrand of a single column from an epoch to a given upper limit.
+    /*!
+     * Function to integrate the interpolated integrand of a single column from an epoch to a given upper limit, using
+     * the cubic Lagrange polynomial through the (up to) four epochs surrounding the interval starting at the epoch.
+     * \param columnIndex Index of column of sensitivity matrix
+     * \param epochIndex Index of epoch at which the interval (and integration) starts
+     * \param upperLimit Upper limit of integral
+     * \return Integral of interpolated integrand from epoch with index epochIndex to upperLimit.
+     */
+    Eigen::VectorXd integrateInterpolatedIntegrand(
+            const int columnIndex, const int epochIndex, const double upperLimit );
+
+    //! Function to get the index of the first epoch of the interpolation stencil for the interval starting at given epoch.
+    int getStencilStartIndex( const int epochIndex );
+
+    //! Interpolator returning the state transition matrix as a function of time.
+    std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
+    stateTransitionMatrixInterpolator_;
+
+    //! Epochs of the numerical solution at which the matrix histories are given.
+    std::vector< double > epochs_;
+
+    //! State transition matrices at the epochs of the numerical solution.
+    std::vector< Eigen::MatrixXd > stateTransitionMatrices_;
+
+    //! Partials of the state derivative w.r.t. the parameters at the epochs of the numerical solution.
+    std::vector< Eigen::MatrixXd > parameterPartials_;
+
+    //! LU decompositions of the state transition matrices (computed when first needed).
+    std::vector< Eigen::PartialPivLU< Eigen::MatrixXd > > stateTransitionMatrixDecompositions_;
+
+    //! List of booleans denoting whether the entry of stateTransitionMatrixDecompositions_ has been computed.
+    std::vector< bool > isStateTransitionMatrixDecomposed_;
+
+    //! Integrand Phi^{-1}B at the epochs of the numerical solution (columns filled when needed).
+    std::vector< Eigen::MatrixXd > integrands_;
+
+    //! Cumulative integral of Phi^{-1}B at the epochs of the numerical solution (columns filled when needed).
+    std::vector< Eigen::MatrixXd > cumulativeIntegrals_;
+
+    //! Number of epochs for which integrand has been computed, per column of the sensitivity matrix.
+    std::vector< int > numberOfIntegrandEpochs_;
+
+    //! Number of epochs for which cumulative integral has been computed, per column of the sensitivity matrix.
+    std::vector< int > numberOfIntegratedEpochs_;
+
+    //! Indices of the columns of the sensitivity matrix that are not identically zero.
+    std::vector< int > nonZeroSensitivityMatrixColumns_;
+
+    //! Object used to find the interval in epochs_ in which a given time lies.
+    std::shared_ptr< interpolators::HuntingAlgorithmLookupScheme< double > > lookUpScheme_;
+
+    //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
+    Eigen::MatrixXd combinedStateTransitionMatrix_;
+};
 //! Interface object of interpolation of numerically propagated state transition and sensitivity matrices for multi-arc
 //! estimation.
 class MultiArcCombinedStateTransitionAndSensitivityMatrixInterface: public CombinedStateTransitionAndSensitivityMatrixInterface
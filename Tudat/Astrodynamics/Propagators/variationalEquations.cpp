@@ -34,10 +34,54 @@ void VariationalEquations::getBodyInitialStatePartialMatrix(
     setBodyStatePartialMatrix( );
 
     // Add partials of body positions and velocities.
-    currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
+    currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, getNumberOfIntegratedColumns( ) ) =
             ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
 }
 
+//! Function to compute the matrix of partial derivatives of state derivatives w.r.t. parameters.
+void VariationalEquations::setParameterPartialMatrix( )
+{
+    // Initialize matrix to zeros
+    variationalParameterMatrix_.setZero( );
+
+    // Iterate over all bodies undergoing accelerations for which initial condition is to be estimated.
+    for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
+         std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator typeIterator =
+         parameterPartialList_.begin( ); typeIterator != parameterPartialList_.end( ); typeIterator++ )
+    {
+        int startIndex = stateTypeStartIndices_.at( typeIterator->first );
+        int currentStateSize = getSingleIntegrationSize( typeIterator->first );
+        int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator->first );
+
+        // Iterate over all bodies being estimated.
+        for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
+        {
+            // Iterate over all parameter partial functions determined by setParameterPartialFunctionList( )
+            for( functionIterator = typeIterator->second[ i ].begin( );
+                 functionIterator != typeIterator->second[ i ].end( );
+                 functionIterator++ )
+            {
+                functionIterator->second(
+                            variationalParameterMatrix_.block(
+                                startIndex + entriesToSkipPerEntry + currentStateSize * i,
+                                functionIterator->first.first - totalDynamicalStateSize_,
+                                currentStateSize - entriesToSkipPerEntry,
+                                functionIterator->first.second ) );
+            }
+        }
+    }
+
+    for( unsigned int i = 0; i < inertiaTensorsForMultiplication_.size( ); i++ )
+    {
+        variationalParameterMatrix_.block( inertiaTensorsForMultiplication_.at( i ).first, 0, 3,
+                                           numberOfParameterValues_ - totalDynamicalStateSize_ ) =
+                ( inertiaTensorsForMultiplication_.at( i ).second( ).inverse( ) ) *
+                variationalParameterMatrix_.block(
+                    inertiaTensorsForMultiplication_.at( i ).first, 0, 3,
+                    numberOfParameterValues_ - totalDynamicalStateSize_ ).eval( );
+    }
+}
+
 //! Calculates matrix containing partial derivatives of state derivatives w.r.t. body state.
 void VariationalEquations::setBodyStatePartialMatrix( )
 {
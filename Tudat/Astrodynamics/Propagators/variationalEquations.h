@@ -62,7 +62,8 @@ public:
             stateDerivativePartialList,
             const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< ParameterType > > parametersToEstimate,
             const std::map< IntegratedStateType, int >& stateTypeStartIndices ):
-        stateDerivativePartialList_( stateDerivativePartialList ), stateTypeStartIndices_( stateTypeStartIndices )
+        stateDerivativePartialList_( stateDerivativePartialList ), stateTypeStartIndices_( stateTypeStartIndices ),
+        integrateSensitivityMatrix_( true )
     {
         dynamicalStatesToEstimate_ =
                 estimatable_parameters::getListOfInitialDynamicalStateParametersEstimate< ParameterType >(
@@ -138,53 +139,11 @@ public:
     void getParameterPartialMatrix(
             Eigen::Block< Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > > currentMatrixDerivative )
     {
-        // Initialize matrix to zeros
-        variationalParameterMatrix_.setZero( );
-
-        // Iterate over all bodies undergoing accelerations for which initial condition is to be estimated.
-        for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
-             std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator typeIterator =
-             parameterPartialList_.begin( ); typeIterator != parameterPartialList_.end( ); typeIterator++ )
-        {
-            int startIndex = stateTypeStartIndices_.at( typeIterator->first );
-            int currentStateSize = getSingleIntegrationSize( typeIterator->first );
-            int entriesToSkipPerEntry = currentStateSize - getGeneralizedAccelerationSize( typeIterator->first );
-
-            // Iterate over all bodies being estimated.
-            for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
-            {
-                // Iterate over all parameter partial functions determined by setParameterPartialFunctionList( )
-                for( functionIterator = typeIterator->second[ i ].begin( );
-                     functionIterator != typeIterator->second[ i ].end( );
-                     functionIterator++ )
-                {
-                    functionIterator->second(
-                                variationalParameterMatrix_.block(
-                                    startIndex + entriesToSkipPerEntry + currentStateSize * i,
-                                    functionIterator->first.first - totalDynamicalStateSize_,
-                                    currentStateSize - entriesToSkipPerEntry,
-                                    functionIterator->first.second ) );
-                }
-            }
-        }
-
-        for( unsigned int i = 0; i < inertiaTensorsForMultiplication_.size( ); i++ )
-        {
-            variationalParameterMatrix_.block( inertiaTensorsForMultiplication_.at( i ).first, 0, 3,
-                                               numberOfParameterValues_ - totalDynamicalStateSize_ ) =
-                    ( inertiaTensorsForMultiplication_.at( i ).second( ).inverse( ) ) *
-                    variationalParameterMatrix_.block(
-                        inertiaTensorsForMultiplication_.at( i ).first, 0, 3,
-                        numberOfParameterValues_ - totalDynamicalStateSize_ ).eval( );
-        }
+        setParameterPartialMatrix( );
 
         currentMatrixDerivative.block( 0, totalDynamicalStateSize_, totalDynamicalStateSize_,
                                        numberOfParameterValues_ - totalDynamicalStateSize_ ) +=
                 variationalParameterMatrix_.template cast< StateScalarType >( );
-
-
-
-
     }
     
     //! Evaluates the complete variational equations.
@@ -204,9 +163,10 @@ public:
         // Compute and add state partials.
         getBodyInitialStatePartialMatrix< StateScalarType >( stateTransitionAndSensitivityMatrices, currentMatrixDerivative );
 
-        if( numberOfParameterValues_ > totalDynamicalStateSize_ )
+        // Add partials of parameters (if sensitivity matrix is not integrated, these are only computed at the epochs of the
+        // numerical solution, see getCurrentParameterPartialMatrix).
+        if( numberOfParameterValues_ > totalDynamicalStateSize_ && integrateSensitivityMatrix_ )
         {
-            // Add partials of parameters.
             getParameterPartialMatrix< StateScalarType >( currentMatrixDerivative );
         }
 //        currentMatrixDerivative.block( 0, 6, 6, 7 ).setZero( );
@@ -280,11 +240,65 @@ public:
     {
         return numberOfParameterValues_;
     }
+
+    //! Returns the number of columns of the numerically integrated variational equations.
+    /*!
+     *  Returns the number of columns of the numerically integrated variational equations. This is equal to the number of
+     *  parameter values if the sensitivity matrix is integrated, and to the size of the state transition matrix otherwise.
+     *  \return Number of columns of the numerically integrated variational equations.
+     */
+    int getNumberOfIntegratedColumns( )
+    {
+        return ( integrateSensitivityMatrix_ ? numberOfParameterValues_ : totalDynamicalStateSize_ );
+    }
+
+    //! Function to set whether the sensitivity matrix is to be numerically integrated.
+    /*!
+     *  Function to set whether the sensitivity matrix is to be numerically integrated. If not, only the state transition
+     *  matrix is integrated, and the partials of the state derivative w.r.t. the parameters are not computed during the
+     *  evaluation of the variational equations. Instead, they are to be retrieved at the epochs of the numerical solution
+     *  (see getCurrentParameterPartialMatrix), so that the sensitivity matrix can be computed by quadrature a posteriori.
+     *  \param integrateSensitivityMatrix Boolean denoting whether the sensitivity matrix is to be numerically integrated.
+     */
+    void setIntegrateSensitivityMatrix( const bool integrateSensitivityMatrix )
+    {
+        integrateSensitivityMatrix_ = integrateSensitivityMatrix;
+    }
+
+    //! Function to retrieve whether the sensitivity matrix is to be numerically integrated.
+    /*!
+     *  Function to retrieve whether the sensitivity matrix is to be numerically integrated.
+     *  \return Boolean denoting whether the sensitivity matrix is to be numerically integrated.
+     */
+    bool getIntegrateSensitivityMatrix( )
+    {
+        return integrateSensitivityMatrix_;
+    }
+
+    //! Function to compute the partials of the state derivative w.r.t. the parameters at the current state.
+    /*!
+     *  Function to compute the partials of the state derivative w.r.t. the (non-initial state) parameters, at the time and
+     *  state of the latest evaluation of the variational equations (i.e. the state derivative must have been evaluated at
+     *  the required time and state before calling this function).
+     *  \return Partials of the state derivative w.r.t. the (non-initial state) parameters.
+     */
+    Eigen::MatrixXd getCurrentParameterPartialMatrix( )
+    {
+        setParameterPartialMatrix( );
+        return variationalParameterMatrix_;
+    }
     
 protected:
     
 private:
     
+    //! Function to compute the matrix of partial derivatives of state derivatives w.r.t. parameters.
+    /*!
+     *  Function to compute the matrix of partial derivatives of state derivatives w.r.t. parameters, and set it in the
+     *  variationalParameterMatrix_ member.
+     */
+    void setParameterPartialMatrix( );
+
     //! Function (called by constructor) to set up the statePartialList_ member from the state derivative partials
     /*!
      * Function (called by constructor) to set up the functions to evaluate the partial derivatives of the state derivatives
@@ -580,6 +594,9 @@ private:
     //! Total matrix of partial derivatives of state derivatives w.r.t. parameter vectors.
     Eigen::MatrixXd variationalParameterMatrix_;
 
+    //! Boolean denoting whether the sensitivity matrix is numerically integrated.
+    bool integrateSensitivityMatrix_;
+
     //! Current states, in conventional representation (e.g. transformed from specific propagator) sorted per state type.
     std::unordered_map< IntegratedStateType, Eigen::VectorXd > currentStatesPerTypeInConventionalRepresentation_;
 };
@@ -0,0 +1,211 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/TrajectoryDesign/trajectory.h"
+#include "Tudat/Astrodynamics/TrajectoryDesign/trajectoryBatchEvaluator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::transfer_trajectories;
+
+//! Test implementation of trajectory batch evaluator
+BOOST_AUTO_TEST_SUITE( test_trajectory_batch_evaluator )
+
+//! Function to create ephemeris of a planet.
+ephemerides::EphemerisPointer getPlanetEphemeris(
+        const ephemerides::ApproximatePlanetPositionsBase::BodiesWithEphemerisData body )
+{
+    return std::make_shared< ephemerides::ApproximatePlanetPositions >( body );
+}
+
+//! Test batch evaluation of MGA and MGA-1DSM trajectories against individual evaluations.
+BOOST_AUTO_TEST_CASE( testTrajectoryBatchEvaluation )
+{
+    typedef ephemerides::ApproximatePlanetPositionsBase Planets;
+
+    const double sunGravitationalParameter = 1.32712428e20;
+
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        int numberOfLegs;
+        std::vector< TransferLegType > legTypeVector;
+        std::vector< ephemerides::EphemerisPointer > ephemerisVector;
+        Eigen::VectorXd gravitationalParameterVector, nominalVariableVector, minimumPericenterRadii;
+        Eigen::VectorXd semiMajorAxes( 2 ), eccentricities( 2 );
+
+        if( testCase == 0 )
+        {
+            // Cassini 1 (MGA) trajectory, as in unitTestTrajectory.
+            numberOfLegs = 6;
+            legTypeVector = { mga_Departure, mga_Swingby, mga_Swingby, mga_Swingby, mga_Swingby, capture };
+
+            // Use the same ephemeris object for the repeated Venus visits.
+            ephemerisVector.push_back( getPlanetEphemeris( Planets::earthMoonBarycenter ) );
+            ephemerisVector.push_back( getPlanetEphemeris( Planets::venus ) );
+            ephemerisVector.push_back( ephemerisVector.at( 1 ) );
+            ephemerisVector.push_back( getPlanetEphemeris( Planets::earthMoonBarycenter ) );
+            ephemerisVector.push_back( getPlanetEphemeris( Planets::jupiter ) );
+            ephemerisVector.push_back( getPlanetEphemeris( Planets::saturn ) );
+
+            gravitationalParameterVector.resize( numberOfLegs );
+            gravitationalParameterVector << 3.9860119e14, 3.24860e14, 3.24860e14, 3.9860119e14, 1.267e17, 3.79e16;
+
+            nominalVariableVector.resize( numberOfLegs + 1 );
+            nominalVariableVector << -789.8117, 158.302027105278, 449.385873819743, 54.7489684339665,
+                    1024.36205846918, 4552.30796805542, 1.0;
+            nominalVariableVector *= physical_constants::JULIAN_DAY;
+
+            semiMajorAxes << std::numeric_limits< double >::infinity( ), 1.0895e8 / 0.02;
+            eccentricities << 0., 0.98;
+
+            minimumPericenterRadii.resize( numberOfLegs );
+            minimumPericenterRadii << 6778000., 6351800., 6351800., 6778000., 600000000., 600000000.;
+        }
+        else
+        {
+            // Messenger (MGA-1DSM, velocity formulation) trajectory, as in unitTestTrajectory.
+            numberOfLegs = 5;
+            legTypeVector = { mga1DsmVelocity_Departure, mga1DsmVelocity_Swingby, mga1DsmVelocity_Swingby,
+                              mga1DsmVelocity_Swingby, capture };
+
+            ephemerisVector.push_back( getPlanetEphemeris( Planets::earthMoonBarycenter ) );
+            ephemerisVector.push_back( ephemerisVector.at( 0 ) );
+            ephemerisVector.push_back( getPlanetEphemeris( Planets::venus ) );
+            ephemerisVector.push_back( ephemerisVector.at( 2 ) );
+            ephemerisVector.push_back( getPlanetEphemeris( Planets::mercury ) );
+
+            gravitationalParameterVector.resize( numberOfLegs );
+            gravitationalParameterVector << 3.9860119e14, 3.9860119e14, 3.24860e14, 3.24860e14, 2.2321e13;
+
+            nominalVariableVector.resize( numberOfLegs + 1 + 4 * ( numberOfLegs - 1 ) );
+            nominalVariableVector << 1171.64503236 * physical_constants::JULIAN_DAY,
+                    399.999999715 * physical_constants::JULIAN_DAY,
+                    178.372255301 * physical_constants::JULIAN_DAY,
+                    299.223139512 * physical_constants::JULIAN_DAY,
+                    180.510754824 * physical_constants::JULIAN_DAY,
+                    1.0,
+                    0.234594654679, 1408.99421278, 0.37992647165 * 2 * 3.14159265358979,
+                    std::acos(  2 * 0.498004040298 - 1. ) - 3.14159265358979 / 2,
+                    0.0964769387134, 1.35077257078, 1.80629232251 * 6.378e6, 0.0,
+                    0.829948744508, 1.09554368115, 3.04129845698 * 6.052e6, 0.0,
+                    0.317174785637, 1.34317576594, 1.10000000891 * 6.052e6, 0.0;
+
+            semiMajorAxes << std::numeric_limits< double >::infinity( ), std::numeric_limits< double >::infinity( );
+            eccentricities << 0., 0.;
+
+            minimumPericenterRadii = Eigen::VectorXd::Constant( numberOfLegs, TUDAT_NAN );
+        }
+
+        // Create batch of candidates: perturb the times of flight of the later legs, such that
+        // the departure epoch, and the epochs of the first visitations, are shared by all candidates.
+        const int numberOfCandidates = 12;
+        Eigen::MatrixXd variableVectors = nominalVariableVector.replicate( 1, numberOfCandidates );
+        for( int i = 0; i < numberOfCandidates; i++ )
+        {
+            variableVectors( 3, i ) *= ( 1.0 + 0.01 * static_cast< double >( i / 2 ) );
+            variableVectors( 4, i ) *= ( 1.0 - 0.005 * static_cast< double >( i % 3 ) );
+        }
+
+        // Compute Delta V of each candidate with an individually created trajectory.
+        Eigen::VectorXd individualDeltaV( numberOfCandidates );
+        for( int i = 0; i < numberOfCandidates; i++ )
+        {
+            Trajectory trajectory( numberOfLegs, legTypeVector, ephemerisVector,
+                                   gravitationalParameterVector, variableVectors.col( i ),
+                                   sunGravitationalParameter, minimumPericenterRadii, semiMajorAxes, eccentricities );
+            trajectory.calculateTrajectory( individualDeltaV( i ) );
+        }
+
+        for( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads += 3 )
+        {
+            TrajectoryBatchEvaluator batchEvaluator(
+                        numberOfLegs, legTypeVector, ephemerisVector, gravitationalParameterVector,
+                        sunGravitationalParameter, minimumPericenterRadii, semiMajorAxes, eccentricities,
+                        true, true, numberOfThreads );
+            BOOST_CHECK_EQUAL( batchEvaluator.getNumberOfThreads( ), numberOfThreads );
+
+            // Evaluate batch (twice, to check re-use of trajectory objects) and compare to individual evaluations.
+            for( unsigned int repetition = 0; repetition < 2; repetition++ )
+            {
+                Eigen::VectorXd batchDeltaV = batchEvaluator.evaluateTrajectories( variableVectors );
+                for( int i = 0; i < numberOfCandidates; i++ )
+                {
+                    BOOST_CHECK_CLOSE_FRACTION( batchDeltaV( i ), individualDeltaV( i ), 1.0E-14 );
+                    BOOST_CHECK_EQUAL( batchEvaluator.getTrajectoryEvaluationCompleted( ).at( i ), true );
+                }
+            }
+
+            // Check number of ephemeris evaluations: the first three epochs are shared by all
+            // candidates, the fourth is shared by pairs of candidates, and the remaining epochs are
+            // unique for each candidate. For the Messenger case, the first two visitations are of
+            // the same body (but at different epochs), so no additional evaluations are saved.
+            int expectedNumberOfEvaluations = 3 + numberOfCandidates / 2 + numberOfCandidates * ( numberOfLegs - 4 );
+            BOOST_CHECK_EQUAL( batchEvaluator.getNumberOfEphemerisEvaluations( ), expectedNumberOfEvaluations );
+
+            // Evaluate batch with Delta V bound, such that part of the candidates are pruned.
+            std::vector< double > sortedDeltaV( individualDeltaV.data( ), individualDeltaV.data( ) + numberOfCandidates );
+            std::sort( sortedDeltaV.begin( ), sortedDeltaV.end( ) );
+            double maximumDeltaV = 0.5 * ( sortedDeltaV.at( numberOfCandidates / 2 - 1 ) +
+                                           sortedDeltaV.at( numberOfCandidates / 2 ) );
+
+            Eigen::VectorXd prunedDeltaV = batchEvaluator.evaluateTrajectories( variableVectors, maximumDeltaV );
+            std::vector< bool > evaluationCompleted = batchEvaluator.getTrajectoryEvaluationCompleted( );
+            int numberOfCompletedEvaluations = 0;
+            for( int i = 0; i < numberOfCandidates; i++ )
+            {
+                if( individualDeltaV( i ) < maximumDeltaV )
+                {
+                    BOOST_CHECK_EQUAL( evaluationCompleted.at( i ), true );
+                    BOOST_CHECK_CLOSE_FRACTION( prunedDeltaV( i ), individualDeltaV( i ), 1.0E-14 );
+                    numberOfCompletedEvaluations++;
+                }
+                else
+                {
+                    BOOST_CHECK( prunedDeltaV( i ) > maximumDeltaV );
+                    BOOST_CHECK( prunedDeltaV( i ) <= individualDeltaV( i ) * ( 1.0 + 1.0E-14 ) );
+                }
+            }
+            BOOST_CHECK_EQUAL( numberOfCompletedEvaluations, numberOfCandidates / 2 );
+
+            // Check that a bound below the departure Delta V stops all evaluations after the first leg.
+            batchEvaluator.evaluateTrajectories( variableVectors, 0.0 );
+            for( int i = 0; i < numberOfCandidates; i++ )
+            {
+                BOOST_CHECK_EQUAL( batchEvaluator.getTrajectoryEvaluationCompleted( ).at( i ), false );
+            }
+
+            // Check that incorrectly sized variable vectors are rejected.
+            BOOST_CHECK_THROW( batchEvaluator.evaluateTrajectories( variableVectors.topRows( 3 ) ),
+                               std::runtime_error );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -1,3 +1,6 @@
+#include <limits>
+#include <stdexcept>
+
 #include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
@@ -19,6 +22,12 @@ namespace transfer_trajectories
 
 //! Calculate the legs
 void Trajectory::calculateTrajectory( double& totalDeltaV )
+{
+    calculateTrajectory( totalDeltaV, std::numeric_limits< double >::infinity( ) );
+}
+
+//! Calculate the legs, stopping as soon as the accumulated Delta V exceeds a given bound.
+bool Trajectory::calculateTrajectory( double& totalDeltaV, const double maximumDeltaV )
 {
     // Set the deltaV equal to zero.
     totalDeltaV = 0.;
@@ -30,7 +39,14 @@ void Trajectory::calculateTrajectory( double& totalDeltaV )
                     *spacecraftVelocityPtrVector_[ counter ], deltaVVector_[ counter ] );
 
         totalDeltaV += deltaVVector_[ counter ];
+
+        // Stop if the remaining legs can no longer bring the trajectory below the bound.
+        if ( totalDeltaV > maximumDeltaV )
+        {
+            return false;
+        }
     }
+    return true;
 }
 
 //! Returns intermediate points along the trajectory.
@@ -173,6 +189,30 @@ void Trajectory::updateEphemeris( )
     }
 }
 
+//! Update the ephemeris, using pre-computed states of the visited bodies.
+void Trajectory::updateEphemeris( const Eigen::Matrix< double, 6, Eigen::Dynamic >& planetStates )
+{
+    if ( planetStates.cols( ) != numberOfLegs_ )
+    {
+        throw std::runtime_error( "Error when updating trajectory ephemeris, number of states is inconsistent." );
+    }
+
+    // Set the positions and velocities of the planets at the visitation times.
+    for ( int counter = 0; counter < numberOfLegs_ ; counter++ )
+    {
+        planetPositionVector_[ counter ] = planetStates.block( 0, counter, 3, 1 );
+        planetVelocityVector_[ counter ] = planetStates.block( 3, counter, 3, 1 );
+    }
+
+    // Loop through all the mission legs and update their ephemeris variables.
+    for ( int counter = 0; counter < numberOfLegs_; counter++ )
+    {
+        missionLegPtrVector_[ counter ]->updateEphemeris( planetPositionVector_[ counter ],
+                                                          planetPositionVector_[ counter + 1],
+                                                          planetVelocityVector_[ counter ] );
+    }
+}
+
     //! Update the variable vector.
 void Trajectory::updateVariableVector( const Eigen::VectorXd& trajectoryVariableVector )
 {
@@ -269,24 +309,7 @@ void Trajectory::prepareVelocityAndPositionVectors( )
 
 int Trajectory::checkTrajectoryVariableVectorSize( )
 {
-    // The size is always 1, which is the departure epoch.
-    int size = 1;
-
-    // Go through all the legs and add the appropriate amount of additional variables.
-    for ( int counter = 0; counter < numberOfLegs_; counter++ )
-    {
-        switch ( legTypeVector_[ counter ] )
-        {
-            case mga_Departure: case mga_Swingby: case capture:
-                size += 1;
-                break;
-            case mga1DsmPosition_Departure: case mga1DsmPosition_Swingby:
-            case mga1DsmVelocity_Departure: case mga1DsmVelocity_Swingby:
-                size += 5;
-                break;
-        }
-    }
-    return size;
+    return getTrajectoryVariableVectorSize( legTypeVector_ );
 }
 
 //! Prepare the legs and link the variables
@@ -545,5 +568,44 @@ void Trajectory::getLaunchConditions( Eigen::Vector3d& departureBodyPosition,
                                                              velocityAfterDeparture );
 }
 
+//! Compute the size of the variable vector defining a trajectory.
+int getTrajectoryVariableVectorSize( const std::vector< TransferLegType >& legTypeVector )
+{
+    // The size is always 1, which is the departure epoch.
+    int size = 1;
+
+    // Go through all the legs and add the appropriate amount of additional variables.
+    for ( unsigned int counter = 0; counter < legTypeVector.size( ); counter++ )
+    {
+        switch ( legTypeVector[ counter ] )
+        {
+            case mga_Departure: case mga_Swingby: case capture:
+                size += 1;
+                break;
+            case mga1DsmPosition_Departure: case mga1DsmPosition_Swingby:
+            case mga1DsmVelocity_Departure: case mga1DsmVelocity_Swingby:
+                size += 5;
+                break;
+        }
+    }
+    return size;
+}
+
+//! Compute the visitation epochs of the bodies in a trajectory.
+Eigen::VectorXd getTrajectoryVisitationEpochs( const Eigen::VectorXd& trajectoryVariableVector,
+                                               const int numberOfLegs )
+{
+    Eigen::VectorXd visitationEpochs( numberOfLegs );
+
+    // Add the times of flight to the departure epoch, as is done when extracting the ephemeris.
+    double time = 0.0;
+    for ( int counter = 0; counter < numberOfLegs; counter++ )
+    {
+        time = time + trajectoryVariableVector[ counter ];
+        visitationEpochs[ counter ] = time;
+    }
+    return visitationEpochs;
+}
+
 } // namespace transfer_trajectories
 } // namespace tudat
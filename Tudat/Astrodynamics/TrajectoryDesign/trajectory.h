@@ -138,6 +138,19 @@ public:
      */
     void calculateTrajectory( double& totalDeltaV );
 
+    //! Calculate the legs, stopping as soon as the accumulated Delta V exceeds a given bound.
+    /*!
+     * Performs the calculations required for the trajectory, leg by leg, but stops once the
+     * Delta V accumulated over the legs computed so far exceeds the given bound. The remaining
+     * legs are then not computed, which saves computation time when evaluating (many) trajectories
+     * of which only those below a certain total Delta V are of interest (e.g. during optimization).
+     * \param totalDeltaV the total delta V needed for the trajectory, or the partial Delta V (which
+     * exceeds maximumDeltaV) at which the computation was stopped (returned by reference).
+     * \param maximumDeltaV the bound on the Delta V above which the computation is stopped.
+     * \return True if all legs were computed, false if the computation was stopped early.
+     */
+    bool calculateTrajectory( double& totalDeltaV, const double maximumDeltaV );
+
     //! Function to retrieve the value of the capture Delta V.
     /*!
      *  Function to retrieve the value of the capture Delta V.
@@ -213,6 +226,18 @@ public:
      */
     void updateEphemeris( );
 
+    //! Update the ephemeris, using pre-computed states of the visited bodies.
+    /*!
+     * Sets all the positions and the velocities of the trajectory class and the underlying mission
+     * leg classes to new values, as provided by the user, instead of extracting them from the
+     * ephemeris objects. This allows the ephemeris evaluations to be shared between (and
+     * performed outside of) a number of trajectory objects, for instance when evaluating
+     * trajectories concurrently.
+     * \param planetStates Cartesian states of the visited bodies (one column per leg, in the same
+     * order as the ephemeris vector), at the visitation times in the current variable vector.
+     */
+    void updateEphemeris( const Eigen::Matrix< double, 6, Eigen::Dynamic >& planetStates );
+
     //! Update the variable vector.
     /*!
      * Sets the trajectory defining variable vector to the newly specified values. Also sets all
@@ -234,6 +259,16 @@ public:
                               Eigen::Vector3d& departureBodyVelocity,
                               Eigen::Vector3d& velocityAfterDeparture );
 
+    //! Return the number of legs in the trajectory.
+    /*!
+     * Returns the number of legs in the trajectory.
+     * \return The number of legs in the trajectory.
+     */
+    int getNumberOfLegs( )
+    {
+        return static_cast< int >( numberOfLegs_ );
+    }
+
 protected:
 
 private:
@@ -387,6 +422,27 @@ private:
 
 };
 
+//! Compute the size of the variable vector defining a trajectory.
+/*!
+ * Computes the size of the variable vector defining a trajectory, consisting of the departure
+ * epoch, the time of flight of each leg, and four additional variables for each leg with a deep
+ * space maneuver.
+ * \param legTypeVector vector containing the leg types.
+ * \return Size of the trajectory variable vector.
+ */
+int getTrajectoryVariableVectorSize( const std::vector< TransferLegType >& legTypeVector );
+
+//! Compute the visitation epochs of the bodies in a trajectory.
+/*!
+ * Computes the epochs at which the bodies in a trajectory are visited, from the departure epoch
+ * and times of flight in the trajectory variable vector.
+ * \param trajectoryVariableVector vector containing the defining variables for the trajectory.
+ * \param numberOfLegs the number of legs in the trajectory.
+ * \return Visitation epochs of the bodies (one per leg).
+ */
+Eigen::VectorXd getTrajectoryVisitationEpochs( const Eigen::VectorXd& trajectoryVariableVector,
+                                               const int numberOfLegs );
+
 } // namespace transfer_trajectories
 
 } // namespace tudat
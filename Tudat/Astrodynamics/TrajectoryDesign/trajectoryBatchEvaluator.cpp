@@ -0,0 +1,149 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Basics/parallelExecution.h"
+
+#include "Tudat/Astrodynamics/TrajectoryDesign/trajectoryBatchEvaluator.h"
+
+namespace tudat
+{
+
+namespace transfer_trajectories
+{
+
+//! Constructor with immediate definition of parameters.
+TrajectoryBatchEvaluator::TrajectoryBatchEvaluator(
+        const int numberOfLegs,
+        const std::vector< TransferLegType >& legTypeVector,
+        const std::vector< ephemerides::EphemerisPointer >& ephemerisVector,
+        const Eigen::VectorXd& gravitationalParameterVector,
+        const double centralBodyGravitationalParameter,
+        const Eigen::VectorXd& minimumPericenterRadiiVector,
+        const Eigen::VectorXd& semiMajorAxesVector,
+        const Eigen::VectorXd& eccentricityVector,
+        const bool includeDepartureDeltaV,
+        const bool includeArrivalDeltaV,
+        const unsigned int numberOfThreads ):
+    numberOfLegs_( numberOfLegs ), ephemerisVector_( ephemerisVector ),
+    numberOfThreads_( ( numberOfThreads == 0 ) ? utilities::getDefaultNumberOfThreads( ) : numberOfThreads ),
+    numberOfEphemerisEvaluations_( 0 )
+{
+    if( static_cast< int >( legTypeVector.size( ) ) != numberOfLegs_ ||
+            static_cast< int >( ephemerisVector_.size( ) ) != numberOfLegs_ )
+    {
+        throw std::runtime_error( "Error when creating trajectory batch evaluator, leg type or ephemeris vector size is "
+                                  "inconsistent with number of legs." );
+    }
+
+    trajectoryVariableVectorSize_ = getTrajectoryVariableVectorSize( legTypeVector );
+
+    // Identify legs that use the same ephemeris object.
+    for( int i = 0; i < numberOfLegs_; i++ )
+    {
+        uniqueEphemerisIndices_.push_back(
+                    static_cast< int >( std::find( ephemerisVector_.begin( ), ephemerisVector_.end( ),
+                                                   ephemerisVector_.at( i ) ) - ephemerisVector_.begin( ) ) );
+    }
+
+    // Create a trajectory object (and its legs) for each thread. The variable vector used here
+    // is a placeholder, which is overwritten before each evaluation.
+    for( unsigned int i = 0; i < numberOfThreads_; i++ )
+    {
+        threadTrajectories_.push_back(
+                    std::make_shared< Trajectory >(
+                        numberOfLegs_, legTypeVector, ephemerisVector_, gravitationalParameterVector,
+                        Eigen::VectorXd::Zero( trajectoryVariableVectorSize_ ), centralBodyGravitationalParameter,
+                        minimumPericenterRadiiVector, semiMajorAxesVector, eccentricityVector,
+                        includeDepartureDeltaV, includeArrivalDeltaV ) );
+    }
+}
+
+//! Function to compute the states of the visited bodies for all trajectories in a batch.
+void TrajectoryBatchEvaluator::computePlanetStates( const Eigen::MatrixXd& trajectoryVariableVectors )
+{
+    const int numberOfTrajectories = trajectoryVariableVectors.cols( );
+    planetStates_.resize( numberOfTrajectories );
+    numberOfEphemerisEvaluations_ = 0;
+
+    // Location (trajectory and leg index) where state for a given unique body and epoch is stored.
+    std::map< std::pair< int, double >, std::pair< int, int > > computedStateIndices;
+
+    Eigen::VectorXd visitationEpochs;
+    for( int i = 0; i < numberOfTrajectories; i++ )
+    {
+        planetStates_[ i ].resize( 6, numberOfLegs_ );
+        visitationEpochs = getTrajectoryVisitationEpochs( trajectoryVariableVectors.col( i ), numberOfLegs_ );
+
+        for( int j = 0; j < numberOfLegs_; j++ )
+        {
+            std::pair< int, double > currentBodyAndEpoch =
+                    std::make_pair( uniqueEphemerisIndices_.at( j ), visitationEpochs( j ) );
+            std::map< std::pair< int, double >, std::pair< int, int > >::const_iterator stateIterator =
+                    computedStateIndices.find( currentBodyAndEpoch );
+
+            // Retrieve previously computed state, or evaluate ephemeris if not yet computed.
+            if( stateIterator != computedStateIndices.end( ) )
+            {
+                planetStates_[ i ].col( j ) =
+                        planetStates_[ stateIterator->second.first ].col( stateIterator->second.second );
+            }
+            else
+            {
+                planetStates_[ i ].col( j ) = ephemerisVector_.at( j )->getCartesianState( visitationEpochs( j ) );
+                computedStateIndices[ currentBodyAndEpoch ] = std::make_pair( i, j );
+                numberOfEphemerisEvaluations_++;
+            }
+        }
+    }
+}
+
+//! Function to compute the total Delta V of a batch of trajectories.
+Eigen::VectorXd TrajectoryBatchEvaluator::evaluateTrajectories(
+        const Eigen::MatrixXd& trajectoryVariableVectors,
+        const double maximumDeltaV )
+{
+    if( trajectoryVariableVectors.rows( ) != trajectoryVariableVectorSize_ )
+    {
+        throw std::runtime_error( "Error when evaluating batch of trajectories, variable vector size is " +
+                                  std::to_string( trajectoryVariableVectors.rows( ) ) + ", but " +
+                                  std::to_string( trajectoryVariableVectorSize_ ) + " is required." );
+    }
+
+    const int numberOfTrajectories = trajectoryVariableVectors.cols( );
+
+    // Compute body states serially, as ephemeris objects need not be thread-safe.
+    computePlanetStates( trajectoryVariableVectors );
+
+    // Evaluate trajectories concurrently, each thread using its own trajectory object.
+    Eigen::VectorXd totalDeltaV = Eigen::VectorXd::Zero( numberOfTrajectories );
+    std::vector< char > evaluationCompleted( numberOfTrajectories );
+    utilities::executeParallelForLoop(
+                numberOfTrajectories,
+                [ & ]( const unsigned int index, const unsigned int threadIndex )
+    {
+        std::shared_ptr< Trajectory > currentTrajectory = threadTrajectories_.at( threadIndex );
+        currentTrajectory->updateVariableVector( trajectoryVariableVectors.col( index ) );
+        currentTrajectory->updateEphemeris( planetStates_.at( index ) );
+        evaluationCompleted[ index ] = currentTrajectory->calculateTrajectory( totalDeltaV( index ), maximumDeltaV );
+    }, numberOfThreads_ );
+
+    trajectoryEvaluationCompleted_.assign( evaluationCompleted.begin( ), evaluationCompleted.end( ) );
+
+    return totalDeltaV;
+}
+
+} // namespace transfer_trajectories
+
+} // namespace tudat
@@ -0,0 +1,168 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_TRAJECTORY_BATCH_EVALUATOR_H
+#define TUDAT_TRAJECTORY_BATCH_EVALUATOR_H
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Astrodynamics/TrajectoryDesign/trajectory.h"
+
+namespace tudat
+{
+
+namespace transfer_trajectories
+{
+
+//! Class for the (parallel) evaluation of the total Delta V of a batch of trajectories.
+/*!
+ * Class for the evaluation of the total Delta V of a batch of trajectories of the same type (same
+ * legs and visited bodies), which differ only in their defining variables, as is typically
+ * required by population-based global optimizers. The trajectories are evaluated concurrently,
+ * using one Trajectory object (with its own mission leg objects) per thread. The states of the
+ * visited bodies are computed before the concurrent evaluation, and are computed only once for
+ * each combination of body and visitation epoch encountered in the batch, so that candidates
+ * sharing epochs share the ephemeris evaluations (and the ephemeris objects are not accessed from
+ * multiple threads). Optionally, the evaluation of a trajectory can be stopped as soon as the
+ * Delta V of the legs computed so far exceeds a given bound.
+ */
+class TrajectoryBatchEvaluator
+{
+public:
+
+    //! Constructor with immediate definition of parameters.
+    /*!
+     *  Constructor with immediate definition of parameters, which are identical to those of the
+     *  Trajectory class, except for the trajectory variable vector, which is provided for each
+     *  evaluation.
+     *  \param numberOfLegs the number of legs in the trajectory.
+     *  \param legTypeVector vector containing the leg types.
+     *  \param ephemerisVector vector of ephemeris pointers to the different planets.
+     *  \param gravitationalParameterVector vector of the gravitational parameters of the visited planets.
+     *  \param centralBodyGravitationalParameter gravitational parameter of the central body.
+     *  \param minimumPericenterRadiiVector vector containing the minimum distance between the spacecraft and body.
+     *  \param semiMajorAxesVector vector containing the semi-major axes for the departure and capture leg.
+     *  \param eccentricityVector vector containing the eccentricities for the departure and capture leg.
+     *  \param includeDepartureDeltaV Boolean denoting whether to include the Delta V of departure.
+     *  \param includeArrivalDeltaV Boolean denoting whether to include the Delta V of arrival.
+     *  \param numberOfThreads Number of threads to use for the evaluation (0 for default number of threads).
+     */
+    TrajectoryBatchEvaluator( const int numberOfLegs,
+                              const std::vector< TransferLegType >& legTypeVector,
+                              const std::vector< ephemerides::EphemerisPointer >& ephemerisVector,
+                              const Eigen::VectorXd& gravitationalParameterVector,
+                              const double centralBodyGravitationalParameter,
+                              const Eigen::VectorXd& minimumPericenterRadiiVector,
+                              const Eigen::VectorXd& semiMajorAxesVector,
+                              const Eigen::VectorXd& eccentricityVector,
+                              const bool includeDepartureDeltaV = true,
+                              const bool includeArrivalDeltaV = true,
+                              const unsigned int numberOfThreads = 0 );
+
+    //! Function to compute the total Delta V of a batch of trajectories.
+    /*!
+     *  Function to compute the total Delta V of a batch of trajectories.
+     *  \param trajectoryVariableVectors Matrix of which each column contains the defining
+     *  variables of a single trajectory (as in the Trajectory class).
+     *  \param maximumDeltaV Bound on the Delta V above which the evaluation of a trajectory is
+     *  stopped (no bound by default).
+     *  \return Total Delta V of each trajectory. For trajectories of which the evaluation was
+     *  stopped because maximumDeltaV was exceeded, the Delta V accumulated up to that point is
+     *  returned (which is larger than maximumDeltaV, but smaller than or equal to the total).
+     */
+    Eigen::VectorXd evaluateTrajectories(
+            const Eigen::MatrixXd& trajectoryVariableVectors,
+            const double maximumDeltaV = std::numeric_limits< double >::infinity( ) );
+
+    //! Function to retrieve whether the evaluation of each trajectory in the last batch was completed.
+    /*!
+     *  Function to retrieve whether the evaluation of each trajectory in the last batch was
+     *  completed (true), or stopped early because the Delta V bound was exceeded (false).
+     *  \return Completion status of each trajectory in the last batch.
+     */
+    std::vector< bool > getTrajectoryEvaluationCompleted( )
+    {
+        return trajectoryEvaluationCompleted_;
+    }
+
+    //! Function to retrieve the number of ephemeris evaluations performed for the last batch.
+    /*!
+     *  Function to retrieve the number of ephemeris evaluations performed for the last batch, which
+     *  is equal to the number of unique combinations of body and visitation epoch in the batch.
+     *  \return Number of ephemeris evaluations performed for the last batch.
+     */
+    int getNumberOfEphemerisEvaluations( )
+    {
+        return numberOfEphemerisEvaluations_;
+    }
+
+    //! Function to retrieve the number of threads used for the evaluation.
+    /*!
+     *  Function to retrieve the number of threads used for the evaluation.
+     *  \return Number of threads used for the evaluation.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+private:
+
+    //! Function to compute the states of the visited bodies for all trajectories in a batch.
+    /*!
+     *  Function to compute the states of the visited bodies for all trajectories in a batch,
+     *  evaluating the ephemeris only once for each unique combination of body and epoch.
+     *  \param trajectoryVariableVectors Matrix of which each column contains the defining
+     *  variables of a single trajectory.
+     */
+    void computePlanetStates( const Eigen::MatrixXd& trajectoryVariableVectors );
+
+    //! The number of legs in the trajectory.
+    int numberOfLegs_;
+
+    //! The vector containing the Ephemeris objects.
+    std::vector< ephemerides::EphemerisPointer > ephemerisVector_;
+
+    //! Index of the (unique) ephemeris object for each leg.
+    /*!
+     * Index of the (unique) ephemeris object for each leg, such that legs using the same ephemeris
+     * object share its evaluations.
+     */
+    std::vector< int > uniqueEphemerisIndices_;
+
+    //! Size of the variable vector defining a single trajectory.
+    int trajectoryVariableVectorSize_;
+
+    //! Number of threads used for the evaluation.
+    unsigned int numberOfThreads_;
+
+    //! Trajectory objects, one per thread.
+    std::vector< std::shared_ptr< Trajectory > > threadTrajectories_;
+
+    //! States of the visited bodies, for each trajectory in the current batch (one column per leg).
+    std::vector< Eigen::Matrix< double, 6, Eigen::Dynamic > > planetStates_;
+
+    //! Completion status of each trajectory in the last batch.
+    std::vector< bool > trajectoryEvaluationCompleted_;
+
+    //! Number of ephemeris evaluations performed for the last batch.
+    int numberOfEphemerisEvaluations_;
+};
+
+} // namespace transfer_trajectories
+
+} // namespace tudat
+
+#endif // TUDAT_TRAJECTORY_BATCH_EVALUATOR_H
@@ -0,0 +1,117 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLELEXECUTION_H
+#define TUDAT_PARALLELEXECUTION_H
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the number of threads to be used when no number is specified by the user.
+/*!
+ *  Function to retrieve the number of threads to be used when no number is specified by the user, equal to the number of
+ *  concurrent threads supported by the hardware (or 1 if this cannot be determined).
+ *  \return Default number of threads for parallel execution
+ */
+inline unsigned int getDefaultNumberOfThreads( )
+{
+    unsigned int numberOfThreads = std::thread::hardware_concurrency( );
+    return ( numberOfThreads == 0 ) ? 1 : numberOfThreads;
+}
+
+//! Function to execute a loop body for a range of indices, distributed over a number of threads.
+/*!
+ *  Function to execute a loop body for a range of indices [0, numberOfIterations), distributed over a number of threads.
+ *  The indices are divided into contiguous blocks of (nearly) equal size, one per thread. The loop body must be safe to
+ *  call concurrently for different indices (i.e. each iteration may only write to data associated with its own index).
+ *  If the loop body throws an exception in any thread, the first such exception is rethrown after all threads have
+ *  finished.
+ *  \param numberOfIterations Number of iterations of the loop
+ *  \param loopBody Function that is to be called for each index in [0, numberOfIterations). The second argument is the
+ *  index of the thread in which the iteration is executed, which may be used to access thread-local (per-thread) data.
+ *  \param numberOfThreads Number of threads that are to be used (0 to use the default number of threads). If equal to 1,
+ *  the loop is executed serially in the calling thread.
+ */
+inline void executeParallelForLoop(
+        const unsigned int numberOfIterations,
+        const std::function< void( const unsigned int, const unsigned int ) >& loopBody,
+        const unsigned int numberOfThreads = 0 )
+{
+    unsigned int numberOfThreadsToUse =
+            std::min( ( numberOfThreads == 0 ) ? getDefaultNumberOfThreads( ) : numberOfThreads,
+                      std::max( numberOfIterations, 1u ) );
+
+    if( numberOfThreadsToUse == 1 )
+    {
+        for( unsigned int i = 0; i < numberOfIterations; i++ )
+        {
+            loopBody( i, 0 );
+        }
+    }
+    else
+    {
+        std::vector< std::thread > threads;
+        std::vector< std::exception_ptr > threadExceptions( numberOfThreadsToUse );
+
+        // Create threads, each of which handles a contiguous block of iterations.
+        unsigned int blockSize = numberOfIterations / numberOfThreadsToUse;
+        unsigned int remainder = numberOfIterations % numberOfThreadsToUse;
+        unsigned int startIndex = 0;
+        for( unsigned int threadIndex = 0; threadIndex < numberOfThreadsToUse; threadIndex++ )
+        {
+            unsigned int endIndex = startIndex + blockSize + ( ( threadIndex < remainder ) ? 1 : 0 );
+            threads.push_back(
+                        std::thread( [ &loopBody, &threadExceptions, startIndex, endIndex, threadIndex ]( )
+            {
+                try
+                {
+                    for( unsigned int i = startIndex; i < endIndex; i++ )
+                    {
+                        loopBody( i, threadIndex );
+                    }
+                }
+                catch( ... )
+                {
+                    threadExceptions[ threadIndex ] = std::current_exception( );
+                }
+            } ) );
+            startIndex = endIndex;
+        }
+
+        for( unsigned int threadIndex = 0; threadIndex < threads.size( ); threadIndex++ )
+        {
+            threads.at( threadIndex ).join( );
+        }
+
+        // Propagate first exception (if any) to calling thread.
+        for( unsigned int threadIndex = 0; threadIndex < threadExceptions.size( ); threadIndex++ )
+        {
+            if( threadExceptions.at( threadIndex ) )
+            {
+                std::rethrow_exception( threadExceptions.at( threadIndex ) );
+            }
+        }
+    }
+}
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLELEXECUTION_H
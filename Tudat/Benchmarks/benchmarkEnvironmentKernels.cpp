@@ -0,0 +1,217 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cmath>
+#include <map>
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Astrodynamics/ObservationModels/lightTimeSolution.h"
+#include "Tudat/Astrodynamics/ObservationModels/ObservableCorrections/firstOrderRelativisticLightTimeCorrection.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Benchmarks/benchmarkTools.h"
+#include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Function to create a deterministic gravity field coefficient matrix, with a typical decay of the coefficients.
+Eigen::MatrixXd getBenchmarkGravityFieldCoefficients( const int maximumDegree, const bool isSineCoefficient )
+{
+    Eigen::MatrixXd coefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = ( isSineCoefficient ? 1 : 0 ); order <= degree; order++ )
+        {
+            coefficients( degree, order ) = 1.0E-5 / static_cast< double >( degree * degree ) *
+                    std::cos( 0.7 * degree + 1.3 * order + ( isSineCoefficient ? 0.5 : 0.0 ) );
+        }
+    }
+    if( !isSineCoefficient )
+    {
+        coefficients( 0, 0 ) = 1.0;
+    }
+    return coefficients;
+}
+
+//! Function to add the benchmarks of environment, mathematics and observation model kernels to a suite.
+void addEnvironmentBenchmarks( BenchmarkSuite& benchmarkSuite )
+{
+    using namespace mathematical_constants;
+
+    // Update of Legendre polynomial cache, for varying polynomial parameter.
+    for( int maximumDegree : { 20, 100 } )
+    {
+        benchmarkSuite.addBenchmark(
+                    "environment/legendre_cache_update_degree_" + std::to_string( maximumDegree ),
+                    [ = ]( )
+        {
+            std::shared_ptr< basic_mathematics::LegendreCache > legendreCache =
+                    std::make_shared< basic_mathematics::LegendreCache >( maximumDegree, maximumDegree, true );
+            std::shared_ptr< int > counter = std::make_shared< int >( 0 );
+            return [ = ]( )
+            {
+                legendreCache->update( std::sin( 0.001 * static_cast< double >( ( *counter )++ % 1000 ) ) );
+                preventOptimization( legendreCache->getLegendrePolynomial( maximumDegree, maximumDegree / 2 ) );
+            };
+        }, 1000 );
+    }
+
+    // Spherical harmonic gravity acceleration, at varying position.
+    for( int maximumDegree : { 20, 100 } )
+    {
+        benchmarkSuite.addBenchmark(
+                    "environment/spherical_harmonic_acceleration_degree_" + std::to_string( maximumDegree ),
+                    [ = ]( )
+        {
+            Eigen::MatrixXd cosineCoefficients = getBenchmarkGravityFieldCoefficients( maximumDegree, false );
+            Eigen::MatrixXd sineCoefficients = getBenchmarkGravityFieldCoefficients( maximumDegree, true );
+            std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+                    std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree, maximumDegree );
+            std::shared_ptr< std::map< std::pair< int, int >, Eigen::Vector3d > > accelerationPerTerm =
+                    std::make_shared< std::map< std::pair< int, int >, Eigen::Vector3d > >( );
+            std::shared_ptr< int > counter = std::make_shared< int >( 0 );
+            return [ = ]( )
+            {
+                double angle = 0.01 * static_cast< double >( ( *counter )++ % 1000 );
+                Eigen::Vector3d position = 7.0E6 * Eigen::Vector3d(
+                            std::cos( angle ) * std::cos( 0.3 * angle ), std::sin( angle ) * std::cos( 0.3 * angle ),
+                            std::sin( 0.3 * angle ) );
+                preventOptimization(
+                            gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                                position, 3.986004418E14, 6378.137E3, cosineCoefficients, sineCoefficients,
+                                sphericalHarmonicsCache, *accelerationPerTerm ).norm( ) );
+            };
+        }, 100 );
+    }
+
+    // Lagrange interpolation of a tabulated Cartesian state, at varying (non-monotonic) times.
+    benchmarkSuite.addBenchmark(
+                "environment/lagrange_interpolation_order_8",
+                [ ]( )
+    {
+        std::map< double, Eigen::Vector6d > stateMap;
+        for( int i = 0; i < 10000; i++ )
+        {
+            double time = 60.0 * static_cast< double >( i );
+            stateMap[ time ] = orbital_element_conversions::convertKeplerianToCartesianElements(
+                        ( Eigen::Vector6d( ) << 7.0E6, 0.01, 1.0, 0.5, 0.2, 2.0 * PI * time / 5800.0 ).finished( ),
+                        3.986004418E14 );
+        }
+        std::shared_ptr< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > > interpolator =
+                std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::Vector6d > >( stateMap, 8 );
+        std::shared_ptr< int > counter = std::make_shared< int >( 0 );
+        return [ = ]( )
+        {
+            double time = 1.0E3 + std::fmod( 7919.0 * static_cast< double >( ( *counter )++ ), 5.9E5 );
+            preventOptimization( interpolator->interpolate( time ).norm( ) );
+        };
+    }, 1000 );
+
+    // Kepler equation solution and full Keplerian/Cartesian conversion.
+    benchmarkSuite.addBenchmark(
+                "environment/mean_to_eccentric_anomaly",
+                [ ]( )
+    {
+        std::shared_ptr< int > counter = std::make_shared< int >( 0 );
+        return [ = ]( )
+        {
+            double meanAnomaly = 2.0 * PI * static_cast< double >( ( *counter )++ % 1000 ) / 1000.0;
+            preventOptimization( orbital_element_conversions::convertMeanAnomalyToEccentricAnomaly(
+                                     0.3, meanAnomaly ) );
+        };
+    }, 10000 );
+
+    benchmarkSuite.addBenchmark(
+                "environment/mean_to_eccentric_anomaly_array_1000",
+                [ ]( )
+    {
+        std::shared_ptr< Eigen::ArrayXd > eccentricities =
+                std::make_shared< Eigen::ArrayXd >( Eigen::ArrayXd::LinSpaced( 1000, 0.0, 0.9 ) );
+        std::shared_ptr< Eigen::ArrayXd > meanAnomalies =
+                std::make_shared< Eigen::ArrayXd >( Eigen::ArrayXd::LinSpaced( 1000, 0.0, 2.0 * PI ) );
+        std::shared_ptr< Eigen::ArrayXd > eccentricAnomalies = std::make_shared< Eigen::ArrayXd >( 1000 );
+        return [ = ]( )
+        {
+            orbital_element_conversions::convertMeanAnomaliesToEccentricAnomalies< double >(
+                        *eccentricities, *meanAnomalies, *eccentricAnomalies );
+            preventOptimization( eccentricAnomalies->sum( ) );
+        };
+    }, 100 );
+
+    benchmarkSuite.addBenchmark(
+                "environment/keplerian_cartesian_round_trip",
+                [ ]( )
+    {
+        std::shared_ptr< int > counter = std::make_shared< int >( 0 );
+        return [ = ]( )
+        {
+            double trueAnomaly = 2.0 * PI * static_cast< double >( ( *counter )++ % 1000 ) / 1000.0;
+            Eigen::Vector6d cartesianState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                        ( Eigen::Vector6d( ) << 2.0E7, 0.2, 0.9, 0.4, 1.2, trueAnomaly ).finished( ),
+                        3.986004418E14 );
+            preventOptimization( orbital_element_conversions::convertCartesianToKeplerianElements(
+                                     cartesianState, 3.986004418E14 )( 5 ) );
+        };
+    }, 10000 );
+
+    // Light time between two bodies on Keplerian heliocentric orbits, with first-order relativistic correction.
+    benchmarkSuite.addBenchmark(
+                "environment/light_time_with_relativistic_correction",
+                [ ]( )
+    {
+        double sunGravitationalParameter = 1.32712440018E20;
+        std::shared_ptr< ephemerides::KeplerEphemeris > earthEphemeris =
+                std::make_shared< ephemerides::KeplerEphemeris >(
+                    ( Eigen::Vector6d( ) << 1.496E11, 0.0167, 0.0, 1.8, 0.0, 0.1 ).finished( ),
+                    0.0, sunGravitationalParameter );
+        std::shared_ptr< ephemerides::KeplerEphemeris > marsEphemeris =
+                std::make_shared< ephemerides::KeplerEphemeris >(
+                    ( Eigen::Vector6d( ) << 2.279E11, 0.0934, 0.032, 5.0, 0.86, 2.0 ).finished( ),
+                    0.0, sunGravitationalParameter );
+
+        std::vector< std::shared_ptr< observation_models::LightTimeCorrection > > lightTimeCorrections;
+        lightTimeCorrections.push_back(
+                    std::make_shared< observation_models::FirstOrderLightTimeCorrectionCalculator >(
+                        std::vector< std::function< Eigen::Vector6d( const double ) > >(
+                            { [ ]( const double ){ return Eigen::Vector6d::Zero( ).eval( ); } } ),
+                        std::vector< std::function< double( ) > >(
+                            { [ = ]( ){ return sunGravitationalParameter; } } ),
+                        std::vector< std::string >( { "Sun" } ), "Mars", "Earth" ) );
+
+        std::shared_ptr< observation_models::LightTimeCalculator< double, double > > lightTimeCalculator =
+                std::make_shared< observation_models::LightTimeCalculator< double, double > >(
+                    std::bind( &ephemerides::Ephemeris::getCartesianState, marsEphemeris, std::placeholders::_1 ),
+                    std::bind( &ephemerides::Ephemeris::getCartesianState, earthEphemeris, std::placeholders::_1 ),
+                    lightTimeCorrections, true );
+        std::shared_ptr< int > counter = std::make_shared< int >( 0 );
+        return [ = ]( )
+        {
+            double receptionTime = 1.0E7 + 3600.0 * static_cast< double >( ( *counter )++ % 10000 );
+            preventOptimization( lightTimeCalculator->calculateLightTime( receptionTime ) );
+        };
+    }, 1000 );
+}
+
+} // namespace benchmarks
+
+} // namespace tudat
@@ -0,0 +1,324 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Tudat/Benchmarks/benchmarkTools.h"
+#if USE_CSPICE && defined( TUDAT_BENCHMARK_ESTIMATION )
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/External/SpiceInterface/spiceInterface.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGroundStations.h"
+#include "Tudat/SimulationSetup/EstimationSetup/orbitDeterminationManager.h"
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+#endif
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+#if USE_CSPICE && defined( TUDAT_BENCHMARK_ESTIMATION )
+
+//! Typedef for the observations and times used as input to the estimation.
+typedef std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds,
+std::pair< Eigen::VectorXd, std::pair< std::vector< double >, observation_models::LinkEndType > > > >
+PodInputDataType;
+
+//! Function to create the benchmark kernel for an estimation, from an already created estimation setup.
+/*!
+ *  Function to create the benchmark kernel for an estimation, from an already created estimation setup. Each iteration
+ *  of the kernel resets the estimated parameters to their true values (the initial deviation is taken from the
+ *  estimation input) and performs the full estimation.
+ *  \param orbitDeterminationManager Object used to perform the estimation.
+ *  \param parametersToEstimate Parameters that are estimated.
+ *  \param podInput Estimation input (observations, weights and initial parameter deviation).
+ *  \param numberOfIterations Number of iterations of the estimation.
+ *  \return Benchmark kernel.
+ */
+BenchmarkKernel createEstimationKernel(
+        const std::shared_ptr< simulation_setup::OrbitDeterminationManager< > > orbitDeterminationManager,
+        const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate,
+        const std::shared_ptr< simulation_setup::PodInput< double, double > > podInput,
+        const int numberOfIterations )
+{
+    const Eigen::VectorXd truthParameters = parametersToEstimate->template getFullParameterValues< double >( );
+    return [ = ]( )
+    {
+        parametersToEstimate->resetParameterValues( truthParameters );
+        preventOptimization( orbitDeterminationManager->estimateParameters(
+                                 podInput, std::make_shared< simulation_setup::EstimationConvergenceChecker >(
+                                     numberOfIterations ) )->parameterEstimate_( 0 ) );
+    };
+}
+
+//! Function to create the benchmark kernel for the estimation of an Earth orbiter.
+/*!
+ *  Function to create the benchmark kernel for the estimation of an Earth orbiter (initial state and degree 2 Earth
+ *  gravity field coefficients, from one-way range and Doppler data of three ground stations over 3 days), as in the
+ *  unit test of the estimation of an Earth orbiter. The environment, observation models and simulated observations
+ *  are created once; each iteration of the kernel performs only the estimation.
+ *  \return Benchmark kernel.
+ */
+BenchmarkKernel createEarthOrbiterEstimationKernel( )
+{
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+    using namespace observation_models;
+    using namespace estimatable_parameters;
+
+    const int numberOfDaysOfData = 3;
+    const double initialEphemerisTime = 1.0E7;
+    const double finalEphemerisTime = initialEphemerisTime + numberOfDaysOfData * physical_constants::JULIAN_DAY;
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    NamedBodyMap bodyMap = createBodies( getDefaultBodySettings( { "Earth", "Sun", "Moon", "Mars" } ) );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< ephemerides::TabulatedCartesianEphemeris< > >(
+                                            std::shared_ptr< interpolators::OneDimensionalInterpolator
+                                            < double, Eigen::Vector6d > >( ), "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "Earth", "ECLIPJ2000" );
+
+    std::vector< std::string > groundStationNames = { "Station1", "Station2", "Station3" };
+    createGroundStation( bodyMap.at( "Earth" ), groundStationNames.at( 0 ),
+                         ( Eigen::Vector3d( ) << 0.0, 0.35, 0.0 ).finished( ), coordinate_conversions::geodetic_position );
+    createGroundStation( bodyMap.at( "Earth" ), groundStationNames.at( 1 ),
+                         ( Eigen::Vector3d( ) << 0.0, -0.55, 2.0 ).finished( ), coordinate_conversions::geodetic_position );
+    createGroundStation( bodyMap.at( "Earth" ), groundStationNames.at( 2 ),
+                         ( Eigen::Vector3d( ) << 0.0, 0.05, 4.0 ).finished( ), coordinate_conversions::geodetic_position );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< SphericalHarmonicAccelerationSettings >( 8, 8 ) );
+    accelerationMap[ "Vehicle" ][ "Sun" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Moon" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Mars" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+
+    std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    Eigen::Vector6d initialKeplerianElements;
+    initialKeplerianElements << 7200.0E3, 0.05, unit_conversions::convertDegreesToRadians( 85.3 ),
+            unit_conversions::convertDegreesToRadians( 235.7 ), unit_conversions::convertDegreesToRadians( 23.4 ),
+            unit_conversions::convertDegreesToRadians( 139.87 );
+    Eigen::Vector6d systemInitialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                initialKeplerianElements,
+                bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToIntegrate, systemInitialState, finalEphemerisTime );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                initialEphemerisTime, 40.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 40.0, 40.0, 1.0, 1.0 );
+
+    // Set one-way range and Doppler link ends, with the vehicle as transmitter and receiver.
+    std::map< ObservableType, std::vector< LinkEnds > > linkEndsPerObservable;
+    for( unsigned int i = 0; i < groundStationNames.size( ); i++ )
+    {
+        LinkEnds linkEnds;
+        linkEnds[ transmitter ] = std::make_pair( "Earth", groundStationNames.at( i ) );
+        linkEnds[ receiver ] = std::make_pair( "Vehicle", "" );
+        linkEndsPerObservable[ ( i % 2 == 0 ) ? one_way_range : one_way_doppler ].push_back( linkEnds );
+
+        linkEnds.clear( );
+        linkEnds[ receiver ] = std::make_pair( "Earth", groundStationNames.at( i ) );
+        linkEnds[ transmitter ] = std::make_pair( "Vehicle", "" );
+        linkEndsPerObservable[ ( i % 2 == 0 ) ? one_way_doppler : one_way_range ].push_back( linkEnds );
+    }
+
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                  "Vehicle", systemInitialState, "Earth" ) );
+    parameterNames.push_back( std::make_shared< SphericalHarmonicEstimatableParameterSettings >(
+                                  2, 0, 2, 2, "Earth", spherical_harmonics_cosine_coefficient_block ) );
+    parameterNames.push_back( std::make_shared< SphericalHarmonicEstimatableParameterSettings >(
+                                  2, 1, 2, 2, "Earth", spherical_harmonics_sine_coefficient_block ) );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    ObservationSettingsMap observationSettingsMap;
+    for( auto linkEndIterator : linkEndsPerObservable )
+    {
+        for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+        {
+            observationSettingsMap.insert(
+                        std::make_pair( linkEndIterator.second.at( i ),
+                                        std::make_shared< ObservationSettings >( linkEndIterator.first ) ) );
+        }
+    }
+
+    std::shared_ptr< OrbitDeterminationManager< > > orbitDeterminationManager =
+            std::make_shared< OrbitDeterminationManager< > >(
+                bodyMap, parametersToEstimate, observationSettingsMap, integratorSettings, propagatorSettings );
+
+    // Simulate observations during the first 10000 s of each day.
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfDaysOfData; i++ )
+    {
+        for( unsigned int j = 0; j < 500; j++ )
+        {
+            observationTimes.push_back( initialEphemerisTime + 1000.0 +
+                                        static_cast< double >( i ) * physical_constants::JULIAN_DAY +
+                                        static_cast< double >( j ) * 20.0 );
+        }
+    }
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    for( auto linkEndIterator : linkEndsPerObservable )
+    {
+        for( unsigned int i = 0; i < linkEndIterator.second.size( ); i++ )
+        {
+            measurementSimulationInput[ linkEndIterator.first ][ linkEndIterator.second.at( i ) ] =
+                    std::make_pair( observationTimes, receiver );
+        }
+    }
+    PodInputDataType observationsAndTimes = simulateObservations< double, double >(
+                measurementSimulationInput, orbitDeterminationManager->getObservationSimulators( ) );
+
+    // Perturb the initial state of the vehicle.
+    const int numberOfParameters = parametersToEstimate->getParameterSetSize( );
+    Eigen::VectorXd initialParameterDeviation = Eigen::VectorXd::Zero( numberOfParameters );
+    initialParameterDeviation.segment( 0, 3 ) = Eigen::Vector3d::Constant( 1.0 );
+    initialParameterDeviation.segment( 3, 3 ) = Eigen::Vector3d::Constant( 1.0E-3 );
+
+    std::shared_ptr< PodInput< double, double > > podInput = std::make_shared< PodInput< double, double > >(
+                observationsAndTimes, numberOfParameters,
+                Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ), initialParameterDeviation );
+    std::map< ObservableType, double > weightPerObservable;
+    weightPerObservable[ one_way_range ] = 1.0 / ( 1.0 * 1.0 );
+    weightPerObservable[ one_way_doppler ] = 1.0 / ( 1.0E-11 * 1.0E-11 );
+    podInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
+    podInput->defineEstimationSettings( true, true, false, false, false );
+
+    return createEstimationKernel( orbitDeterminationManager, parametersToEstimate, podInput, 5 );
+}
+
+//! Function to create the benchmark kernel for the estimation of the state of the Earth.
+/*!
+ *  Function to create the benchmark kernel for the estimation of the initial state of the Earth and the gravitational
+ *  parameter of the Moon (from one-way range data between Earth and Mars, with point-mass gravity of the Sun, Moon,
+ *  Mars, Jupiter and Saturn), as in the unit test of the estimation of planetary states. The environment, observation
+ *  models and simulated observations are created once; each iteration of the kernel performs only the estimation.
+ *  \return Benchmark kernel.
+ */
+BenchmarkKernel createInnerSolarSystemEstimationKernel( )
+{
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+    using namespace observation_models;
+    using namespace estimatable_parameters;
+
+    const double initialEphemerisTime = 1.0E7;
+    const double finalEphemerisTime = 3.0E7;
+    const double integrationStepSize = 3600.0;
+    const double buffer = 10.0 * integrationStepSize;
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > bodyNames = { "Earth", "Mars", "Sun", "Moon", "Jupiter", "Saturn" };
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, initialEphemerisTime - buffer, finalEphemerisTime + buffer );
+    bodySettings[ "Moon" ]->ephemerisSettings->resetFrameOrigin( "Sun" );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    SelectedAccelerationMap accelerationMap;
+    for( unsigned int i = 0; i < bodyNames.size( ); i++ )
+    {
+        if( bodyNames.at( i ) != "Earth" )
+        {
+            accelerationMap[ "Earth" ][ bodyNames.at( i ) ].push_back(
+                        std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+        }
+    }
+
+    std::vector< std::string > bodiesToIntegrate = { "Earth" };
+    std::vector< std::string > centralBodies = { "SSB" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                  "Earth", getInitialStateOfBody< double, double >(
+                                      "Earth", "SSB", bodyMap, initialEphemerisTime ), "SSB" ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Moon", gravitational_parameter ) );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap );
+
+    std::shared_ptr< IntegratorSettings< > > integratorSettings = std::make_shared< IntegratorSettings< > >(
+                rungeKutta4, initialEphemerisTime - 4.0 * integrationStepSize, 900.0 );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToIntegrate,
+                getInitialStateVectorOfBodiesToEstimate( parametersToEstimate ),
+                finalEphemerisTime + 4.0 * integrationStepSize );
+
+    LinkEnds linkEnds;
+    linkEnds[ transmitter ] = std::make_pair( "Earth", "" );
+    linkEnds[ receiver ] = std::make_pair( "Mars", "" );
+    ObservationSettingsMap observationSettingsMap;
+    observationSettingsMap.insert( std::make_pair( linkEnds, std::make_shared< ObservationSettings >(
+                                                       one_way_range ) ) );
+
+    std::shared_ptr< OrbitDeterminationManager< > > orbitDeterminationManager =
+            std::make_shared< OrbitDeterminationManager< > >(
+                bodyMap, parametersToEstimate, observationSettingsMap, integratorSettings, propagatorSettings );
+
+    // Simulate observations every 1000 s.
+    std::vector< double > observationTimes;
+    for( int i = 0; i < 18000; i++ )
+    {
+        observationTimes.push_back( initialEphemerisTime + 10.0E4 + 30.0 + static_cast< double >( i ) * 1000.0 );
+    }
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    measurementSimulationInput[ one_way_range ][ linkEnds ] = std::make_pair( observationTimes, transmitter );
+    PodInputDataType observationsAndTimes = simulateObservations< double, double >(
+                measurementSimulationInput, orbitDeterminationManager->getObservationSimulators( ) );
+
+    // Perturb the initial state of the Earth and the gravitational parameter of the Moon.
+    Eigen::VectorXd initialParameterDeviation = Eigen::VectorXd( 7 );
+    initialParameterDeviation << 1.0E3, 1.0E3, 1.0E3, 1.0E-2, 1.0E-2, 1.0E-2, 5.0E6;
+
+    std::shared_ptr< PodInput< double, double > > podInput = std::make_shared< PodInput< double, double > >(
+                observationsAndTimes, 7, Eigen::MatrixXd::Zero( 7, 7 ), initialParameterDeviation );
+    podInput->setConstantWeightsMatrix( 1.0 );
+    podInput->defineEstimationSettings( true, true, false, false, false );
+
+    return createEstimationKernel( orbitDeterminationManager, parametersToEstimate, podInput, 5 );
+}
+
+#endif
+
+//! Function to add the benchmarks of state estimation to a suite.
+void addEstimationBenchmarks( BenchmarkSuite& benchmarkSuite )
+{
+#if USE_CSPICE && defined( TUDAT_BENCHMARK_ESTIMATION )
+    benchmarkSuite.addBenchmark( "estimation/earth_orbiter", &createEarthOrbiterEstimationKernel );
+    benchmarkSuite.addBenchmark( "estimation/inner_solar_system", &createInnerSolarSystemEstimationKernel );
+#else
+    static_cast< void >( benchmarkSuite );
+#endif
+}
+
+} // namespace benchmarks
+
+} // namespace tudat
@@ -0,0 +1,78 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "Tudat/Benchmarks/benchmarkTools.h"
+
+//! Execute the Tudat benchmark suite.
+/*!
+ *  Execute the Tudat benchmark suite. Supported command line arguments:
+ *      --repetitions N     Number of timed repetitions of each benchmark (default 5).
+ *      --filter NAME       Only run the benchmarks containing NAME in their name.
+ *      --output FILE       Write the results in JSON format to FILE (default: standard output).
+ *  A human-readable summary is written to standard error while the benchmarks are running.
+ */
+int main( int argc, char* argv[ ] )
+{
+    using namespace tudat::benchmarks;
+
+    unsigned int numberOfRepetitions = 5;
+    std::string nameFilter;
+    std::string outputFile;
+    for( int i = 1; i < argc; i++ )
+    {
+        std::string currentArgument = argv[ i ];
+        if( currentArgument == "--repetitions" && i + 1 < argc )
+        {
+            numberOfRepetitions = static_cast< unsigned int >( std::atoi( argv[ ++i ] ) );
+        }
+        else if( currentArgument == "--filter" && i + 1 < argc )
+        {
+            nameFilter = argv[ ++i ];
+        }
+        else if( currentArgument == "--output" && i + 1 < argc )
+        {
+            outputFile = argv[ ++i ];
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[ 0 ] << " [--repetitions N] [--filter NAME] [--output FILE]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    BenchmarkSuite benchmarkSuite( numberOfRepetitions, nameFilter );
+    addEnvironmentBenchmarks( benchmarkSuite );
+    addPropagationBenchmarks( benchmarkSuite );
+    addEstimationBenchmarks( benchmarkSuite );
+
+    benchmarkSuite.runBenchmarks( std::cerr );
+
+    if( outputFile.empty( ) )
+    {
+        benchmarkSuite.writeBenchmarkResultsAsJson( std::cout );
+    }
+    else
+    {
+        std::ofstream outputStream( outputFile );
+        if( !outputStream.is_open( ) )
+        {
+            std::cerr << "Error, could not open benchmark output file " << outputFile << std::endl;
+            return EXIT_FAILURE;
+        }
+        benchmarkSuite.writeBenchmarkResultsAsJson( outputStream );
+    }
+
+    return EXIT_SUCCESS;
+}
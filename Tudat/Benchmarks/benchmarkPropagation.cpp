@@ -0,0 +1,207 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <memory>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Benchmarks/benchmarkTools.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+#if USE_CSPICE
+#include "Tudat/External/SpiceInterface/spiceInterface.h"
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+#endif
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+#if USE_CSPICE
+
+//! Function to create the benchmark kernel for the propagation of the Galileo constellation.
+/*!
+ *  Function to create the benchmark kernel for the propagation of the Galileo constellation (30 satellites in 3 planes,
+ *  Earth spherical harmonic gravity up to degree 4, RK4 with 30 s step for one hour), as in the unit test of the JSON
+ *  interface for the same scenario. Each iteration of the kernel performs the full propagation.
+ *  \return Benchmark kernel.
+ */
+BenchmarkKernel createGalileoConstellationPropagationKernel( )
+{
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+
+    const unsigned int numberOfSatellites = 30;
+    const unsigned int numberOfPlanes = 3;
+    const unsigned int numberOfSatellitesPerPlane = numberOfSatellites / numberOfPlanes;
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings = getDefaultBodySettings( { "Earth" } );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                Eigen::Vector6d::Zero( ), "SSB", "J2000" );
+    bodySettings[ "Earth" ]->rotationModelSettings->resetOriginalFrame( "J2000" );
+    bodySettings[ "Earth" ]->atmosphereSettings = nullptr;
+    bodySettings[ "Earth" ]->shapeModelSettings = nullptr;
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+
+    // Create satellites, their accelerations and initial states.
+    double earthGravitationalParameter = bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( );
+    SelectedAccelerationMap accelerationMap;
+    std::vector< std::string > bodiesToPropagate;
+    std::vector< std::string > centralBodies;
+    Eigen::VectorXd systemInitialState = Eigen::VectorXd( 6 * numberOfSatellites );
+    for( unsigned int i = 0; i < numberOfSatellites; i++ )
+    {
+        std::string currentSatelliteName = "Satellite" + std::to_string( i );
+        bodyMap[ currentSatelliteName ] = std::make_shared< Body >( );
+
+        accelerationMap[ currentSatelliteName ][ "Earth" ].push_back(
+                    std::make_shared< SphericalHarmonicAccelerationSettings >( 4, 0 ) );
+        bodiesToPropagate.push_back( currentSatelliteName );
+        centralBodies.push_back( "Earth" );
+
+        Eigen::Vector6d keplerianElements;
+        keplerianElements << 23222.0E3 + 6378.1E3, 0.0, unit_conversions::convertDegreesToRadians( 56.0 ), 0.0,
+                static_cast< double >( i / numberOfSatellitesPerPlane ) * 2.0 * mathematical_constants::PI /
+                static_cast< double >( numberOfPlanes ),
+                static_cast< double >( i % numberOfSatellitesPerPlane ) * 2.0 * mathematical_constants::PI /
+                static_cast< double >( numberOfSatellitesPerPlane );
+        systemInitialState.segment( 6 * i, 6 ) = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    keplerianElements, earthGravitationalParameter );
+    }
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "J2000" );
+
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, systemInitialState, 3600.0 );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 30.0 );
+
+    std::shared_ptr< SingleArcDynamicsSimulator< > > dynamicsSimulator =
+            std::make_shared< SingleArcDynamicsSimulator< > >(
+                bodyMap, integratorSettings, propagatorSettings, false );
+    return [ = ]( )
+    {
+        dynamicsSimulator->integrateEquationsOfMotion( systemInitialState );
+        preventOptimization( dynamicsSimulator->getEquationsOfMotionNumericalSolution( ).rbegin( )->second( 0 ) );
+    };
+}
+
+//! Function to create the benchmark kernel for the propagation of the inner solar system.
+/*!
+ *  Function to create the benchmark kernel for the propagation of the inner solar system (Moon w.r.t. Earth, Earth and
+ *  Mars w.r.t. the Sun, with point-mass gravity of the Sun, Earth, Moon, Mars, Jupiter and Saturn), using an RKF7(8)
+ *  integrator for 30 days. Each iteration of the kernel performs the full propagation.
+ *  \return Benchmark kernel.
+ */
+BenchmarkKernel createInnerSolarSystemPropagationKernel( )
+{
+    using namespace simulation_setup;
+    using namespace propagators;
+    using namespace numerical_integrators;
+
+    const double initialEphemerisTime = 1.0E7;
+    const double finalEphemerisTime = initialEphemerisTime + 30.0 * physical_constants::JULIAN_DAY;
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    std::vector< std::string > bodyNames = { "Sun", "Earth", "Moon", "Mars", "Jupiter", "Saturn" };
+    NamedBodyMap bodyMap = createBodies(
+                getDefaultBodySettings( bodyNames, initialEphemerisTime - 3600.0, finalEphemerisTime + 3600.0 ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    std::vector< std::string > bodiesToPropagate = { "Moon", "Earth", "Mars" };
+    std::vector< std::string > centralBodies = { "Earth", "Sun", "Sun" };
+    SelectedAccelerationMap accelerationMap;
+    for( unsigned int i = 0; i < bodiesToPropagate.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < bodyNames.size( ); j++ )
+        {
+            if( bodyNames.at( j ) != bodiesToPropagate.at( i ) )
+            {
+                accelerationMap[ bodiesToPropagate.at( i ) ][ bodyNames.at( j ) ].push_back(
+                            std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+            }
+        }
+    }
+
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+    Eigen::VectorXd systemInitialState = getInitialStatesOfBodies(
+                bodiesToPropagate, centralBodies, bodyMap, initialEphemerisTime );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, systemInitialState, finalEphemerisTime );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                initialEphemerisTime, 3600.0, RungeKuttaCoefficients::rungeKuttaFehlberg78,
+                60.0, physical_constants::JULIAN_DAY, 1.0E-12, 1.0E-12 );
+
+    std::shared_ptr< SingleArcDynamicsSimulator< > > dynamicsSimulator =
+            std::make_shared< SingleArcDynamicsSimulator< > >(
+                bodyMap, integratorSettings, propagatorSettings, false );
+    return [ = ]( )
+    {
+        dynamicsSimulator->integrateEquationsOfMotion( systemInitialState );
+        preventOptimization( dynamicsSimulator->getEquationsOfMotionNumericalSolution( ).rbegin( )->second( 0 ) );
+    };
+}
+
+#endif
+
+//! Function to add the benchmarks of numerical integration and propagation to a suite.
+void addPropagationBenchmarks( BenchmarkSuite& benchmarkSuite )
+{
+    // Single RKF7(8) step for point-mass dynamics, with step size control.
+    benchmarkSuite.addBenchmark(
+                "propagation/rkf78_step_point_mass",
+                [ ]( )
+    {
+        const double earthGravitationalParameter = 3.986004418E14;
+        Eigen::VectorXd initialState = orbital_element_conversions::convertKeplerianToCartesianElements(
+                    ( Eigen::Vector6d( ) << 7.0E6, 0.05, 1.0, 0.5, 0.2, 0.0 ).finished( ),
+                    earthGravitationalParameter );
+        std::shared_ptr< numerical_integrators::RungeKuttaVariableStepSizeIntegratorXd > integrator =
+                std::make_shared< numerical_integrators::RungeKuttaVariableStepSizeIntegratorXd >(
+                    numerical_integrators::RungeKuttaCoefficients::get(
+                        numerical_integrators::RungeKuttaCoefficients::rungeKuttaFehlberg78 ),
+                    [ = ]( const double, const Eigen::VectorXd& state ) -> Eigen::VectorXd
+        {
+            Eigen::VectorXd stateDerivative( 6 );
+            stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+            stateDerivative.segment( 3, 3 ) = -earthGravitationalParameter * state.segment( 0, 3 ) /
+                    std::pow( state.segment( 0, 3 ).norm( ), 3 );
+            return stateDerivative;
+        }, 0.0, initialState, 1.0E-3, 1.0E4, 1.0E-12, 1.0E-12 );
+        std::shared_ptr< double > nextStepSize = std::make_shared< double >( 10.0 );
+        return [ = ]( )
+        {
+            preventOptimization( integrator->performIntegrationStep( *nextStepSize )( 0 ) );
+            *nextStepSize = integrator->getNextStepSize( );
+        };
+    }, 1000 );
+
+#if USE_CSPICE
+    benchmarkSuite.addBenchmark( "propagation/galileo_constellation", &createGalileoConstellationPropagationKernel );
+    benchmarkSuite.addBenchmark( "propagation/inner_solar_system", &createInnerSolarSystemPropagationKernel );
+#endif
+}
+
+} // namespace benchmarks
+
+} // namespace tudat
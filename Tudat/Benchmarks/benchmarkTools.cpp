@@ -0,0 +1,301 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+#include "Tudat/tudatVersion.h"
+#include "Tudat/Benchmarks/benchmarkTools.h"
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Number of heap allocations made by the program so far.
+static std::atomic< unsigned long long > numberOfAllocations( 0 );
+
+//! Number of bytes allocated on the heap by the program so far.
+static std::atomic< unsigned long long > numberOfAllocatedBytes( 0 );
+
+//! Variable to which values are written to prevent them from being optimized away.
+static volatile double optimizationBarrier = 0.0;
+
+//! Function to retrieve the number of heap allocations made by the program so far.
+unsigned long long getNumberOfAllocations( )
+{
+    return numberOfAllocations.load( std::memory_order_relaxed );
+}
+
+//! Function to retrieve the number of bytes allocated on the heap by the program so far.
+unsigned long long getNumberOfAllocatedBytes( )
+{
+    return numberOfAllocatedBytes.load( std::memory_order_relaxed );
+}
+
+//! Function to prevent the compiler from optimizing away the computation of a value in a benchmark kernel.
+void preventOptimization( const double value )
+{
+    optimizationBarrier = value;
+}
+
+//! Function to add a benchmark to the suite.
+void BenchmarkSuite::addBenchmark( const std::string& name,
+                                   const BenchmarkKernelCreator& kernelCreator,
+                                   const unsigned int numberOfIterationsPerRepetition )
+{
+    benchmarkNames_.push_back( name );
+    kernelCreators_.push_back( kernelCreator );
+    numberOfIterationsPerRepetition_.push_back( std::max( numberOfIterationsPerRepetition, 1u ) );
+}
+
+//! Function to run all selected benchmarks.
+void BenchmarkSuite::runBenchmarks( std::ostream& progressStream )
+{
+    benchmarkResults_.clear( );
+    for( unsigned int i = 0; i < benchmarkNames_.size( ); i++ )
+    {
+        if( !nameFilter_.empty( ) && benchmarkNames_.at( i ).find( nameFilter_ ) == std::string::npos )
+        {
+            continue;
+        }
+
+        BenchmarkResult currentResult;
+        currentResult.name_ = benchmarkNames_.at( i );
+        currentResult.numberOfRepetitions_ = std::max( numberOfRepetitions_, 1u );
+        currentResult.numberOfIterationsPerRepetition_ = numberOfIterationsPerRepetition_.at( i );
+
+        // Create scenario, and run kernel once to fill caches.
+        std::chrono::steady_clock::time_point setupStartTime = std::chrono::steady_clock::now( );
+        BenchmarkKernel benchmarkKernel = kernelCreators_.at( i )( );
+        benchmarkKernel( );
+        currentResult.setupTime_ = std::chrono::duration< double >(
+                    std::chrono::steady_clock::now( ) - setupStartTime ).count( );
+
+        // Perform timed repetitions.
+        std::vector< double > repetitionTimes;
+        repetitionTimes.reserve( currentResult.numberOfRepetitions_ );
+        unsigned long long initialNumberOfAllocations = getNumberOfAllocations( );
+        unsigned long long initialNumberOfAllocatedBytes = getNumberOfAllocatedBytes( );
+        for( unsigned int j = 0; j < currentResult.numberOfRepetitions_; j++ )
+        {
+            std::chrono::steady_clock::time_point repetitionStartTime = std::chrono::steady_clock::now( );
+            for( unsigned int k = 0; k < currentResult.numberOfIterationsPerRepetition_; k++ )
+            {
+                benchmarkKernel( );
+            }
+            repetitionTimes.push_back(
+                        std::chrono::duration< double >(
+                            std::chrono::steady_clock::now( ) - repetitionStartTime ).count( ) /
+                        static_cast< double >( currentResult.numberOfIterationsPerRepetition_ ) );
+        }
+        double totalNumberOfIterations = static_cast< double >(
+                    currentResult.numberOfRepetitions_ * currentResult.numberOfIterationsPerRepetition_ );
+        currentResult.numberOfAllocations_ =
+                static_cast< double >( getNumberOfAllocations( ) - initialNumberOfAllocations ) / totalNumberOfIterations;
+        currentResult.numberOfAllocatedBytes_ =
+                static_cast< double >( getNumberOfAllocatedBytes( ) - initialNumberOfAllocatedBytes ) /
+                totalNumberOfIterations;
+
+        // Compute statistics of timing.
+        std::sort( repetitionTimes.begin( ), repetitionTimes.end( ) );
+        currentResult.minimumTime_ = repetitionTimes.front( );
+        currentResult.medianTime_ = ( repetitionTimes.size( ) % 2 == 1 ) ?
+                    repetitionTimes.at( repetitionTimes.size( ) / 2 ) :
+                    0.5 * ( repetitionTimes.at( repetitionTimes.size( ) / 2 - 1 ) +
+                            repetitionTimes.at( repetitionTimes.size( ) / 2 ) );
+        currentResult.meanTime_ = 0.0;
+        for( unsigned int j = 0; j < repetitionTimes.size( ); j++ )
+        {
+            currentResult.meanTime_ += repetitionTimes.at( j ) / static_cast< double >( repetitionTimes.size( ) );
+        }
+
+        progressStream << std::left << std::setw( 60 ) << currentResult.name_ << std::right
+                       << " median: " << std::setw( 12 ) << currentResult.medianTime_ << " s"
+                       << "  allocations: " << std::setw( 10 ) << currentResult.numberOfAllocations_ << std::endl;
+
+        benchmarkResults_.push_back( currentResult );
+    }
+}
+
+//! Function to write the results of the benchmarks that have been run in JSON format.
+void BenchmarkSuite::writeBenchmarkResultsAsJson( std::ostream& outputStream )
+{
+#if defined( __clang__ )
+    std::string compilerName = "clang " __clang_version__;
+#elif defined( __GNUC__ )
+    std::string compilerName = "gcc " __VERSION__;
+#elif defined( _MSC_VER )
+    std::string compilerName = "msvc " + std::to_string( _MSC_VER );
+#else
+    std::string compilerName = "unknown";
+#endif
+
+#ifdef TUDAT_BENCHMARK_BUILD_TYPE
+    std::string buildType = TUDAT_BENCHMARK_BUILD_TYPE;
+#else
+    std::string buildType = "unknown";
+#endif
+
+    outputStream << std::setprecision( 10 );
+    outputStream << "{" << std::endl;
+    outputStream << "  \"tudatVersion\": \"" << TUDAT_VERSION_MAJOR << "." << TUDAT_VERSION_MINOR << "\"," << std::endl;
+    outputStream << "  \"compiler\": \"" << compilerName << "\"," << std::endl;
+    outputStream << "  \"buildType\": \"" << buildType << "\"," << std::endl;
+    outputStream << "  \"useSpice\": " << ( USE_CSPICE ? "true" : "false" ) << "," << std::endl;
+    outputStream << "  \"numberOfRepetitions\": " << numberOfRepetitions_ << "," << std::endl;
+    outputStream << "  \"benchmarks\": [" << std::endl;
+    for( unsigned int i = 0; i < benchmarkResults_.size( ); i++ )
+    {
+        const BenchmarkResult& currentResult = benchmarkResults_.at( i );
+        outputStream << "    {" << std::endl
+                     << "      \"name\": \"" << currentResult.name_ << "\"," << std::endl
+                     << "      \"repetitions\": " << currentResult.numberOfRepetitions_ << "," << std::endl
+                     << "      \"iterationsPerRepetition\": " << currentResult.numberOfIterationsPerRepetition_ << ","
+                     << std::endl
+                     << "      \"minimumTime\": " << currentResult.minimumTime_ << "," << std::endl
+                     << "      \"medianTime\": " << currentResult.medianTime_ << "," << std::endl
+                     << "      \"meanTime\": " << currentResult.meanTime_ << "," << std::endl
+                     << "      \"allocations\": " << currentResult.numberOfAllocations_ << "," << std::endl
+                     << "      \"allocatedBytes\": " << currentResult.numberOfAllocatedBytes_ << "," << std::endl
+                     << "      \"setupTime\": " << currentResult.setupTime_ << std::endl
+                     << "    }" << ( ( i + 1 < benchmarkResults_.size( ) ) ? "," : "" ) << std::endl;
+    }
+    outputStream << "  ]" << std::endl;
+    outputStream << "}" << std::endl;
+}
+
+} // namespace benchmarks
+
+} // namespace tudat
+
+#if defined( __GLIBC__ )
+
+// With glibc, allocations are counted by interposing malloc (and its aligned variants), so that allocations made
+// directly through malloc (e.g. by Eigen for dynamic-size matrices) are counted, in addition to those made through
+// operator new (including the aligned operator new, which uses aligned_alloc or posix_memalign).
+extern "C"
+{
+
+void* __libc_malloc( std::size_t size );
+void* __libc_calloc( std::size_t numberOfElements, std::size_t elementSize );
+void* __libc_realloc( void* memory, std::size_t size );
+void* __libc_memalign( std::size_t alignment, std::size_t size );
+
+//! Replacement of malloc, counting the number of allocations and allocated bytes.
+void* malloc( std::size_t size )
+{
+    tudat::benchmarks::numberOfAllocations.fetch_add( 1, std::memory_order_relaxed );
+    tudat::benchmarks::numberOfAllocatedBytes.fetch_add( size, std::memory_order_relaxed );
+    return __libc_malloc( size );
+}
+
+//! Replacement of calloc, counting the number of allocations and allocated bytes.
+void* calloc( std::size_t numberOfElements, std::size_t elementSize )
+{
+    tudat::benchmarks::numberOfAllocations.fetch_add( 1, std::memory_order_relaxed );
+    tudat::benchmarks::numberOfAllocatedBytes.fetch_add( numberOfElements * elementSize, std::memory_order_relaxed );
+    return __libc_calloc( numberOfElements, elementSize );
+}
+
+//! Replacement of realloc, counting the number of allocations and allocated bytes.
+void* realloc( void* memory, std::size_t size )
+{
+    tudat::benchmarks::numberOfAllocations.fetch_add( 1, std::memory_order_relaxed );
+    tudat::benchmarks::numberOfAllocatedBytes.fetch_add( size, std::memory_order_relaxed );
+    return __libc_realloc( memory, size );
+}
+
+//! Replacement of memalign, counting the number of allocations and allocated bytes.
+void* memalign( std::size_t alignment, std::size_t size )
+{
+    tudat::benchmarks::numberOfAllocations.fetch_add( 1, std::memory_order_relaxed );
+    tudat::benchmarks::numberOfAllocatedBytes.fetch_add( size, std::memory_order_relaxed );
+    return __libc_memalign( alignment, size );
+}
+
+//! Replacement of aligned_alloc, counting the number of allocations and allocated bytes.
+void* aligned_alloc( std::size_t alignment, std::size_t size )
+{
+    return memalign( alignment, size );
+}
+
+//! Replacement of posix_memalign, counting the number of allocations and allocated bytes.
+int posix_memalign( void** memory, std::size_t alignment, std::size_t size )
+{
+    if( alignment % sizeof( void* ) != 0 || ( alignment & ( alignment - 1 ) ) != 0 || alignment == 0 )
+    {
+        return EINVAL;
+    }
+
+    void* allocatedMemory = memalign( alignment, size );
+    if( allocatedMemory == nullptr )
+    {
+        return ENOMEM;
+    }
+    *memory = allocatedMemory;
+    return 0;
+}
+
+}
+
+#else
+
+// Without glibc, only allocations made through operator new are counted.
+
+//! Replacement of global operator new, counting the number of allocations and allocated bytes.
+void* operator new( std::size_t size )
+{
+    tudat::benchmarks::numberOfAllocations.fetch_add( 1, std::memory_order_relaxed );
+    tudat::benchmarks::numberOfAllocatedBytes.fetch_add( size, std::memory_order_relaxed );
+    if( void* allocatedMemory = std::malloc( size == 0 ? 1 : size ) )
+    {
+        return allocatedMemory;
+    }
+    throw std::bad_alloc( );
+}
+
+//! Replacement of global operator new for arrays, counting the number of allocations and allocated bytes.
+void* operator new[ ]( std::size_t size )
+{
+    return operator new( size );
+}
+
+//! Replacement of global operator delete, matching the replacement of operator new.
+void operator delete( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+//! Replacement of global operator delete for arrays, matching the replacement of operator new.
+void operator delete[ ]( void* memory ) noexcept
+{
+    std::free( memory );
+}
+
+//! Replacement of global sized operator delete, matching the replacement of operator new.
+void operator delete( void* memory, std::size_t ) noexcept
+{
+    std::free( memory );
+}
+
+//! Replacement of global sized operator delete for arrays, matching the replacement of operator new.
+void operator delete[ ]( void* memory, std::size_t ) noexcept
+{
+    std::free( memory );
+}
+
+#endif
@@ -0,0 +1,195 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BENCHMARKTOOLS_H
+#define TUDAT_BENCHMARKTOOLS_H
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Function to retrieve the number of heap allocations made by the program so far.
+/*!
+ *  Function to retrieve the number of heap allocations made by the program so far, as counted by the replacement of
+ *  malloc and its aligned variants (with glibc) or of the global operator new (otherwise) in benchmarkTools.cpp, which
+ *  must be compiled into the benchmark executable.
+ *  \return Number of heap allocations made by the program so far.
+ */
+unsigned long long getNumberOfAllocations( );
+
+//! Function to retrieve the number of bytes allocated on the heap by the program so far.
+/*!
+ *  Function to retrieve the number of bytes allocated on the heap by the program so far, as counted by the replacement
+ *  of malloc and its aligned variants (with glibc) or of the global operator new (otherwise) in benchmarkTools.cpp,
+ *  which must be compiled into the benchmark executable.
+ *  \return Number of bytes allocated on the heap by the program so far.
+ */
+unsigned long long getNumberOfAllocatedBytes( );
+
+//! Function to prevent the compiler from optimizing away the computation of a value in a benchmark kernel.
+/*!
+ *  Function to prevent the compiler from optimizing away the computation of a value in a benchmark kernel, by writing
+ *  it to a volatile variable.
+ *  \param value Value that is to be retained.
+ */
+void preventOptimization( const double value );
+
+//! Function that runs a single iteration of a benchmark.
+typedef std::function< void( ) > BenchmarkKernel;
+
+//! Function that sets up a benchmark scenario, and returns the function that runs a single iteration on it.
+typedef std::function< BenchmarkKernel( ) > BenchmarkKernelCreator;
+
+//! Results of a single benchmark, with all times and allocation counts given per iteration of the kernel.
+struct BenchmarkResult
+{
+    //! Name of the benchmark.
+    std::string name_;
+
+    //! Number of timed repetitions of the benchmark.
+    unsigned int numberOfRepetitions_;
+
+    //! Number of iterations of the kernel per repetition.
+    unsigned int numberOfIterationsPerRepetition_;
+
+    //! Minimum computation time (in seconds) per iteration over all repetitions.
+    double minimumTime_;
+
+    //! Median computation time (in seconds) per iteration over all repetitions.
+    double medianTime_;
+
+    //! Mean computation time (in seconds) per iteration over all repetitions.
+    double meanTime_;
+
+    //! Number of heap allocations per iteration (averaged over all repetitions).
+    double numberOfAllocations_;
+
+    //! Number of bytes allocated on the heap per iteration (averaged over all repetitions).
+    double numberOfAllocatedBytes_;
+
+    //! Time (in seconds) needed to set up the benchmark scenario (not included in the timing of the kernel).
+    double setupTime_;
+};
+
+//! Class to define, run and report a set of benchmarks.
+/*!
+ *  Class to define, run and report a set of benchmarks. Each benchmark is defined by a name, a function that creates
+ *  the scenario and the kernel, and the number of iterations of the kernel per repetition. The scenario is only created
+ *  if the benchmark is selected by the name filter, after which the kernel is run once (untimed), to fill any caches,
+ *  followed by the timed repetitions. The results can be written in JSON format, so that they can be compared between
+ *  releases, build configurations and machines.
+ */
+class BenchmarkSuite
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param numberOfRepetitions Number of timed repetitions of each benchmark.
+     *  \param nameFilter Only the benchmarks containing this string in their name are run (all if empty).
+     */
+    BenchmarkSuite( const unsigned int numberOfRepetitions = 5, const std::string& nameFilter = "" ):
+        numberOfRepetitions_( numberOfRepetitions ), nameFilter_( nameFilter ){ }
+
+    //! Function to add a benchmark to the suite.
+    /*!
+     *  Function to add a benchmark to the suite.
+     *  \param name Name of the benchmark, typically of the form "category/scenario".
+     *  \param kernelCreator Function that sets up the benchmark scenario, and returns the benchmark kernel.
+     *  \param numberOfIterationsPerRepetition Number of iterations of the kernel per timed repetition.
+     */
+    void addBenchmark( const std::string& name,
+                       const BenchmarkKernelCreator& kernelCreator,
+                       const unsigned int numberOfIterationsPerRepetition = 1 );
+
+    //! Function to run all selected benchmarks.
+    /*!
+     *  Function to run all selected benchmarks, storing the results in this object.
+     *  \param progressStream Stream to which a human-readable summary of each benchmark is written.
+     */
+    void runBenchmarks( std::ostream& progressStream = std::cout );
+
+    //! Function to retrieve the results of the benchmarks that have been run.
+    /*!
+     *  Function to retrieve the results of the benchmarks that have been run.
+     *  \return Results of the benchmarks that have been run.
+     */
+    std::vector< BenchmarkResult > getBenchmarkResults( )
+    {
+        return benchmarkResults_;
+    }
+
+    //! Function to write the results of the benchmarks that have been run in JSON format.
+    /*!
+     *  Function to write the results of the benchmarks that have been run in JSON format, together with the Tudat
+     *  version, compiler and build configuration.
+     *  \param outputStream Stream to which the results are written.
+     */
+    void writeBenchmarkResultsAsJson( std::ostream& outputStream );
+
+private:
+
+    //! Number of timed repetitions of each benchmark.
+    unsigned int numberOfRepetitions_;
+
+    //! Only the benchmarks containing this string in their name are run (all if empty).
+    std::string nameFilter_;
+
+    //! Names of the benchmarks.
+    std::vector< std::string > benchmarkNames_;
+
+    //! Functions that set up the benchmark scenarios, and return the benchmark kernels.
+    std::vector< BenchmarkKernelCreator > kernelCreators_;
+
+    //! Number of iterations of the kernel per timed repetition, per benchmark.
+    std::vector< unsigned int > numberOfIterationsPerRepetition_;
+
+    //! Results of the benchmarks that have been run.
+    std::vector< BenchmarkResult > benchmarkResults_;
+};
+
+//! Function to add the benchmarks of environment, mathematics and observation model kernels to a suite.
+/*!
+ *  Function to add the benchmarks of environment, mathematics and observation model kernels to a suite (Legendre
+ *  polynomial cache, spherical harmonic gravity, Lagrange interpolation, Kepler conversions, light time).
+ *  \param benchmarkSuite Suite to which the benchmarks are added.
+ */
+void addEnvironmentBenchmarks( BenchmarkSuite& benchmarkSuite );
+
+//! Function to add the benchmarks of numerical integration and propagation to a suite.
+/*!
+ *  Function to add the benchmarks of numerical integration and propagation to a suite (RKF7(8) stepping, Galileo
+ *  constellation and inner solar system propagation). The full propagation scenarios are only added if Tudat is
+ *  compiled with Spice.
+ *  \param benchmarkSuite Suite to which the benchmarks are added.
+ */
+void addPropagationBenchmarks( BenchmarkSuite& benchmarkSuite );
+
+//! Function to add the benchmarks of state estimation to a suite.
+/*!
+ *  Function to add the benchmarks of state estimation to a suite (single satellite and planetary estimation). The
+ *  benchmarks are only added if Tudat is compiled with Spice.
+ *  \param benchmarkSuite Suite to which the benchmarks are added.
+ */
+void addEstimationBenchmarks( BenchmarkSuite& benchmarkSuite );
+
+} // namespace benchmarks
+
+} // namespace tudat
+
+#endif // TUDAT_BENCHMARKTOOLS_H
@@ -0,0 +1,200 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/InputOutput/basicInputOutput.h"
+#include "Tudat/InputOutput/binaryHistoryFile.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_binary_history_file )
+
+//! Function to create the history that is written to file in the tests (two variables of size 3 and 2).
+std::map< double, Eigen::VectorXd > getTestHistory( )
+{
+    std::map< double, Eigen::VectorXd > testHistory;
+    for( unsigned int i = 0; i < 100; i++ )
+    {
+        double currentTime = 1.0E6 + 10.0 * static_cast< double >( i ) + 0.1;
+        Eigen::VectorXd currentValues = Eigen::VectorXd( 5 );
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            currentValues( j ) = std::sin( currentTime * static_cast< double >( j + 1 ) ) * 1.0E3;
+        }
+        testHistory[ currentTime ] = currentValues;
+    }
+    return testHistory;
+}
+
+// Test whether a history is correctly written to, and read back from, a binary history file
+BOOST_AUTO_TEST_CASE( testBinaryHistoryFileWriteAndRead )
+{
+    using namespace input_output;
+
+    std::string fileName = getTudatRootPath( ) + "InputOutput/UnitTests/binaryHistoryTest.bin";
+    std::map< double, Eigen::VectorXd > testHistory = getTestHistory( );
+
+    // Write history to file, with values provided in two parts for each record
+    {
+        BinaryHistoryWriter historyWriter(
+                    fileName, { BinaryHistoryVariable( "Position", 3, "m" ), BinaryHistoryVariable( "Angles", 2 ) } );
+        for( auto historyIterator : testHistory )
+        {
+            historyWriter.writeRecord( historyIterator.first, historyIterator.second.segment( 0, 3 ),
+                                       historyIterator.second.segment( 3, 2 ) );
+        }
+        BOOST_CHECK_EQUAL( historyWriter.getNumberOfRecords( ), testHistory.size( ) );
+        BOOST_CHECK_EQUAL( historyWriter.getNumberOfValuesPerRecord( ), 5 );
+
+        // Check that records of incorrect size are rejected
+        BOOST_CHECK_THROW( historyWriter.writeRecord( 0.0, Eigen::VectorXd::Zero( 4 ) ), std::runtime_error );
+    }
+
+    // Read file, and check header
+    BinaryHistoryReader historyReader( fileName );
+    BOOST_CHECK_EQUAL( historyReader.getNumberOfRecords( ), testHistory.size( ) );
+    BOOST_CHECK_EQUAL( historyReader.getNumberOfValuesPerRecord( ), 5 );
+    BOOST_CHECK_EQUAL( historyReader.getEpochUnit( ), "s since J2000 (TDB)" );
+
+    std::vector< BinaryHistoryVariable > variables = historyReader.getVariables( );
+    BOOST_CHECK_EQUAL( variables.size( ), 2 );
+    BOOST_CHECK_EQUAL( variables.at( 0 ).identifier_, "Position" );
+    BOOST_CHECK_EQUAL( variables.at( 0 ).unit_, "m" );
+    BOOST_CHECK_EQUAL( variables.at( 0 ).numberOfValues_, 3 );
+    BOOST_CHECK_EQUAL( variables.at( 1 ).identifier_, "Angles" );
+    BOOST_CHECK_EQUAL( variables.at( 1 ).unit_, "" );
+    BOOST_CHECK_EQUAL( variables.at( 1 ).numberOfValues_, 2 );
+    BOOST_CHECK_EQUAL( historyReader.getVariableStartIndex( "Angles" ), 3 );
+    BOOST_CHECK_EQUAL( historyReader.getVariableSize( "Angles" ), 2 );
+    BOOST_CHECK_THROW( historyReader.getVariableSize( "Velocity" ), std::runtime_error );
+
+    // Check that full and single-variable histories are retrieved exactly
+    std::map< double, Eigen::VectorXd > readHistory = historyReader.getHistory( );
+    std::map< double, Eigen::VectorXd > readAngleHistory = historyReader.getVariableHistory( "Angles" );
+    std::map< double, Eigen::Vector3d > readPositionHistory =
+            historyReader.getFixedSizeVariableHistory< 3 >( "Position" );
+    BOOST_CHECK_EQUAL( readHistory.size( ), testHistory.size( ) );
+    BOOST_CHECK_EQUAL( readAngleHistory.size( ), testHistory.size( ) );
+    BOOST_CHECK_EQUAL( readPositionHistory.size( ), testHistory.size( ) );
+    for( auto historyIterator : testHistory )
+    {
+        double currentTime = historyIterator.first;
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_EQUAL( readHistory.at( currentTime )( j ), historyIterator.second( j ) );
+        }
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( readPositionHistory.at( currentTime )( j ), historyIterator.second( j ) );
+        }
+        for( unsigned int j = 0; j < 2; j++ )
+        {
+            BOOST_CHECK_EQUAL( readAngleHistory.at( currentTime )( j ), historyIterator.second( j + 3 ) );
+        }
+    }
+    BOOST_CHECK_EQUAL( historyReader.getEpoch( 0 ), testHistory.begin( )->first );
+    BOOST_CHECK_THROW( historyReader.getFixedSizeVariableHistory< 3 >( "Angles" ), std::runtime_error );
+
+    std::remove( fileName.c_str( ) );
+}
+
+// Test whether a binary history file that was not closed properly can be read
+BOOST_AUTO_TEST_CASE( testBinaryHistoryFileInterruptedWriting )
+{
+    using namespace input_output;
+
+    std::string fileName = getTudatRootPath( ) + "InputOutput/UnitTests/binaryHistoryInterruptedTest.bin";
+    std::map< double, Eigen::VectorXd > testHistory = getTestHistory( );
+
+    // Write history to file
+    std::shared_ptr< BinaryHistoryWriter > historyWriter = std::make_shared< BinaryHistoryWriter >(
+                fileName, std::vector< BinaryHistoryVariable >{ BinaryHistoryVariable( "Values", 5 ) } );
+    for( auto historyIterator : testHistory )
+    {
+        historyWriter->writeRecord( historyIterator.first, historyIterator.second );
+    }
+
+    historyWriter->close( );
+    {
+        std::ifstream closedFile( fileName, std::ios::binary );
+        std::vector< char > fileContents( ( std::istreambuf_iterator< char >( closedFile ) ),
+                                          std::istreambuf_iterator< char >( ) );
+        closedFile.close( );
+
+        // Reset number of records in header to zero, as for a file that was not closed
+        for( unsigned int i = 16; i < 24; i++ )
+        {
+            fileContents[ i ] = 0;
+        }
+        std::ofstream interruptedFile( fileName, std::ios::binary | std::ios::trunc );
+        interruptedFile.write( fileContents.data( ), fileContents.size( ) );
+    }
+
+    // Check that all records are read
+    BinaryHistoryReader historyReader( fileName );
+    BOOST_CHECK_EQUAL( historyReader.getNumberOfRecords( ), testHistory.size( ) );
+    std::map< double, Eigen::VectorXd > readHistory = historyReader.getVariableHistory( "Values" );
+    for( auto historyIterator : testHistory )
+    {
+        for( unsigned int j = 0; j < 5; j++ )
+        {
+            BOOST_CHECK_EQUAL( readHistory.at( historyIterator.first )( j ), historyIterator.second( j ) );
+        }
+    }
+
+    std::remove( fileName.c_str( ) );
+}
+
+#if defined( __linux__ )
+// Test whether a failure to write records is detected
+BOOST_AUTO_TEST_CASE( testBinaryHistoryFileWriteFailure )
+{
+    using namespace input_output;
+
+    // Writing to /dev/full fails as soon as the stream buffer is flushed
+    std::map< double, Eigen::VectorXd > testHistory = getTestHistory( );
+    BinaryHistoryWriter historyWriter(
+                "/dev/full", std::vector< BinaryHistoryVariable >{ BinaryHistoryVariable( "Values", 5 ) } );
+    bool isExceptionCaught = false;
+    for( unsigned int i = 0; i < 100000 && !isExceptionCaught; i++ )
+    {
+        try
+        {
+            historyWriter.writeRecord( static_cast< double >( i ), testHistory.begin( )->second );
+        }
+        catch( const std::runtime_error& )
+        {
+            isExceptionCaught = true;
+        }
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+} // namespace tudat
@@ -0,0 +1,441 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TUDAT_BINARY_HISTORY_USE_MMAP 1
+#else
+#define TUDAT_BINARY_HISTORY_USE_MMAP 0
+#endif
+
+#include "Tudat/InputOutput/binaryHistoryFile.h"
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Identifier at the start of each binary history file.
+static const char binaryHistoryFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'H', 'S', 'T' };
+
+//! Version of the binary history file format.
+static const std::uint32_t binaryHistoryFileVersion = 1;
+
+//! Value written to the header to check the byte order of the file upon reading.
+static const std::uint32_t binaryHistoryByteOrderCheck = 0x01020304;
+
+//! Size (in bytes) of the buffer used by the file stream of the BinaryHistoryWriter.
+static const std::size_t binaryHistoryStreamBufferSize = 1 << 20;
+
+//! Function to write a single value to a binary output stream.
+template< typename ValueType >
+static void writeBinaryValue( std::ofstream& stream, const ValueType value )
+{
+    stream.write( reinterpret_cast< const char* >( &value ), sizeof( ValueType ) );
+}
+
+//! Function to write a string (preceded by its length) to a binary output stream.
+static void writeBinaryString( std::ofstream& stream, const std::string& value )
+{
+    writeBinaryValue( stream, static_cast< std::uint32_t >( value.size( ) ) );
+    stream.write( value.data( ), value.size( ) );
+}
+
+//! Constructor, opens the file and writes the header.
+BinaryHistoryWriter::BinaryHistoryWriter( const std::string& fileName,
+                                          const std::vector< BinaryHistoryVariable >& variables,
+                                          const std::string& epochUnit ):
+    fileName_( fileName ), streamBuffer_( binaryHistoryStreamBufferSize ), numberOfValuesPerRecord_( 0 ),
+    numberOfRecords_( 0 ), firstEpoch_( std::numeric_limits< double >::quiet_NaN( ) ),
+    lastEpoch_( std::numeric_limits< double >::quiet_NaN( ) )
+{
+    // Set stream buffer (before opening file) and open file.
+    fileStream_.rdbuf( )->pubsetbuf( streamBuffer_.data( ), streamBuffer_.size( ) );
+    fileStream_.open( fileName_, std::ios::binary | std::ios::out | std::ios::trunc );
+    if( !fileStream_.is_open( ) )
+    {
+        throw std::runtime_error( "Error, binary history file " + fileName_ + " could not be opened for writing." );
+    }
+
+    // Write file identification and record information (to be overwritten upon closing).
+    fileStream_.write( binaryHistoryFileIdentifier, sizeof( binaryHistoryFileIdentifier ) );
+    writeBinaryValue( fileStream_, binaryHistoryFileVersion );
+    writeBinaryValue( fileStream_, binaryHistoryByteOrderCheck );
+    recordInformationPosition_ = fileStream_.tellp( );
+    writeBinaryValue( fileStream_, static_cast< std::uint64_t >( 0 ) );
+    writeBinaryValue( fileStream_, firstEpoch_ );
+    writeBinaryValue( fileStream_, lastEpoch_ );
+
+    // Write description of variables.
+    writeBinaryString( fileStream_, epochUnit );
+    writeBinaryValue( fileStream_, static_cast< std::uint32_t >( variables.size( ) ) );
+    for( unsigned int i = 0; i < variables.size( ); i++ )
+    {
+        writeBinaryString( fileStream_, variables.at( i ).identifier_ );
+        writeBinaryString( fileStream_, variables.at( i ).unit_ );
+        writeBinaryValue( fileStream_, static_cast< std::uint32_t >( variables.at( i ).numberOfValues_ ) );
+        numberOfValuesPerRecord_ += variables.at( i ).numberOfValues_;
+    }
+
+    // Pad header, so that records are aligned to doubles.
+    while( static_cast< std::size_t >( fileStream_.tellp( ) ) % sizeof( double ) != 0 )
+    {
+        fileStream_.put( 0 );
+    }
+
+    if( fileStream_.fail( ) )
+    {
+        throw std::runtime_error( "Error when writing header of binary history file " + fileName_ );
+    }
+
+    recordBuffer_.resize( numberOfValuesPerRecord_ + 1 );
+}
+
+//! Destructor, closes the file.
+BinaryHistoryWriter::~BinaryHistoryWriter( )
+{
+    try
+    {
+        close( );
+    }
+    catch( const std::exception& caughtException )
+    {
+        std::cerr << caughtException.what( ) << std::endl;
+    }
+}
+
+//! Function to write a single record to the file.
+void BinaryHistoryWriter::writeRecord( const double epoch, const Eigen::VectorXd& values )
+{
+    if( static_cast< unsigned int >( values.rows( ) ) != numberOfValuesPerRecord_ )
+    {
+        throw std::runtime_error( "Error when writing binary history file " + fileName_ + ", record has " +
+                                  std::to_string( values.rows( ) ) + " values, expected " +
+                                  std::to_string( numberOfValuesPerRecord_ ) );
+    }
+
+    recordBuffer_[ 0 ] = epoch;
+    Eigen::Map< Eigen::VectorXd >( recordBuffer_.data( ) + 1, numberOfValuesPerRecord_ ) = values;
+    writeRecordBuffer( );
+
+    if( numberOfRecords_ == 1 )
+    {
+        firstEpoch_ = epoch;
+    }
+    lastEpoch_ = epoch;
+}
+
+//! Function to write a single record to the file, with the values of the variables provided in two parts.
+void BinaryHistoryWriter::writeRecord( const double epoch, const Eigen::VectorXd& firstValues,
+                                       const Eigen::VectorXd& secondValues )
+{
+    if( static_cast< unsigned int >( firstValues.rows( ) + secondValues.rows( ) ) != numberOfValuesPerRecord_ )
+    {
+        throw std::runtime_error( "Error when writing binary history file " + fileName_ + ", record has " +
+                                  std::to_string( firstValues.rows( ) + secondValues.rows( ) ) + " values, expected " +
+                                  std::to_string( numberOfValuesPerRecord_ ) );
+    }
+
+    recordBuffer_[ 0 ] = epoch;
+    Eigen::Map< Eigen::VectorXd >( recordBuffer_.data( ) + 1, firstValues.rows( ) ) = firstValues;
+    Eigen::Map< Eigen::VectorXd >( recordBuffer_.data( ) + 1 + firstValues.rows( ), secondValues.rows( ) ) =
+            secondValues;
+    writeRecordBuffer( );
+
+    if( numberOfRecords_ == 1 )
+    {
+        firstEpoch_ = epoch;
+    }
+    lastEpoch_ = epoch;
+}
+
+//! Function to write the values in the record buffer to the file.
+void BinaryHistoryWriter::writeRecordBuffer( )
+{
+    if( !fileStream_.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing binary history file " + fileName_ + ", file is closed." );
+    }
+
+    fileStream_.write( reinterpret_cast< const char* >( recordBuffer_.data( ) ),
+                       recordBuffer_.size( ) * sizeof( double ) );
+    if( fileStream_.fail( ) )
+    {
+        throw std::runtime_error( "Error when writing binary history file " + fileName_ + ", could not write record " +
+                                  std::to_string( numberOfRecords_ ) );
+    }
+    numberOfRecords_++;
+}
+
+//! Function to finalize the header and close the file.
+void BinaryHistoryWriter::close( )
+{
+    if( fileStream_.is_open( ) )
+    {
+        fileStream_.seekp( recordInformationPosition_ );
+        writeBinaryValue( fileStream_, static_cast< std::uint64_t >( numberOfRecords_ ) );
+        writeBinaryValue( fileStream_, firstEpoch_ );
+        writeBinaryValue( fileStream_, lastEpoch_ );
+        fileStream_.close( );
+
+        if( fileStream_.fail( ) )
+        {
+            throw std::runtime_error( "Error when closing binary history file " + fileName_ );
+        }
+    }
+}
+
+//! Function to read a single value from memory, and move the read position past it.
+template< typename ValueType >
+static ValueType readBinaryValue( const char* fileData, const std::size_t fileSize, std::size_t& position,
+                                  const std::string& fileName )
+{
+    if( position + sizeof( ValueType ) > fileSize )
+    {
+        throw std::runtime_error( "Error when reading binary history file " + fileName + ", header is incomplete." );
+    }
+
+    ValueType value;
+    std::memcpy( &value, fileData + position, sizeof( ValueType ) );
+    position += sizeof( ValueType );
+    return value;
+}
+
+//! Function to read a string (preceded by its length) from memory, and move the read position past it.
+static std::string readBinaryString( const char* fileData, const std::size_t fileSize, std::size_t& position,
+                                     const std::string& fileName )
+{
+    std::uint32_t stringLength = readBinaryValue< std::uint32_t >( fileData, fileSize, position, fileName );
+    if( position + stringLength > fileSize )
+    {
+        throw std::runtime_error( "Error when reading binary history file " + fileName + ", header is incomplete." );
+    }
+
+    std::string value( fileData + position, stringLength );
+    position += stringLength;
+    return value;
+}
+
+//! Constructor, opens (maps) the file and reads the header.
+BinaryHistoryReader::BinaryHistoryReader( const std::string& fileName ):
+    fileName_( fileName ), fileData_( nullptr ), fileSize_( 0 ), isFileMapped_( false )
+{
+    // Map file to memory or, if not supported, read it.
+#if TUDAT_BINARY_HISTORY_USE_MMAP
+    int fileDescriptor = ::open( fileName_.c_str( ), O_RDONLY );
+    if( fileDescriptor < 0 )
+    {
+        throw std::runtime_error( "Error, binary history file " + fileName_ + " could not be opened." );
+    }
+    struct stat fileStatus;
+    if( ::fstat( fileDescriptor, &fileStatus ) == 0 && fileStatus.st_size > 0 )
+    {
+        fileSize_ = static_cast< std::size_t >( fileStatus.st_size );
+        void* mappedData = ::mmap( nullptr, fileSize_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+        if( mappedData != MAP_FAILED )
+        {
+            fileData_ = static_cast< const char* >( mappedData );
+            isFileMapped_ = true;
+        }
+    }
+    ::close( fileDescriptor );
+#endif
+
+    if( !isFileMapped_ )
+    {
+        std::ifstream fileStream( fileName_, std::ios::binary | std::ios::ate );
+        if( !fileStream.is_open( ) )
+        {
+            throw std::runtime_error( "Error, binary history file " + fileName_ + " could not be opened." );
+        }
+        fileSize_ = static_cast< std::size_t >( fileStream.tellg( ) );
+        fileContents_.resize( fileSize_ );
+        fileStream.seekg( 0 );
+        fileStream.read( fileContents_.data( ), fileSize_ );
+        fileData_ = fileContents_.data( );
+    }
+
+    try
+    {
+        // Check file identification.
+        std::size_t position = 0;
+        if( fileSize_ < sizeof( binaryHistoryFileIdentifier ) ||
+                std::memcmp( fileData_, binaryHistoryFileIdentifier, sizeof( binaryHistoryFileIdentifier ) ) != 0 )
+        {
+            throw std::runtime_error( "Error, file " + fileName_ + " is not a binary history file." );
+        }
+        position += sizeof( binaryHistoryFileIdentifier );
+
+        std::uint32_t fileVersion = readBinaryValue< std::uint32_t >( fileData_, fileSize_, position, fileName_ );
+        if( fileVersion != binaryHistoryFileVersion )
+        {
+            throw std::runtime_error( "Error when reading binary history file " + fileName_ + ", format version " +
+                                      std::to_string( fileVersion ) + " is not supported." );
+        }
+        if( readBinaryValue< std::uint32_t >( fileData_, fileSize_, position, fileName_ ) !=
+                binaryHistoryByteOrderCheck )
+        {
+            throw std::runtime_error( "Error when reading binary history file " + fileName_ +
+                                      ", byte order of file is not supported." );
+        }
+
+        // Read record information and description of variables.
+        std::uint64_t numberOfRecordsInHeader =
+                readBinaryValue< std::uint64_t >( fileData_, fileSize_, position, fileName_ );
+        readBinaryValue< double >( fileData_, fileSize_, position, fileName_ );
+        readBinaryValue< double >( fileData_, fileSize_, position, fileName_ );
+        epochUnit_ = readBinaryString( fileData_, fileSize_, position, fileName_ );
+
+        std::uint32_t numberOfVariables = readBinaryValue< std::uint32_t >( fileData_, fileSize_, position, fileName_ );
+        numberOfValuesPerRecord_ = 0;
+        for( unsigned int i = 0; i < numberOfVariables; i++ )
+        {
+            std::string identifier = readBinaryString( fileData_, fileSize_, position, fileName_ );
+            std::string unit = readBinaryString( fileData_, fileSize_, position, fileName_ );
+            std::uint32_t numberOfValues = readBinaryValue< std::uint32_t >( fileData_, fileSize_, position, fileName_ );
+            variables_.push_back( BinaryHistoryVariable( identifier, numberOfValues, unit ) );
+            numberOfValuesPerRecord_ += numberOfValues;
+        }
+        dataOffset_ = ( ( position + sizeof( double ) - 1 ) / sizeof( double ) ) * sizeof( double );
+
+        // Determine number of records from file size, and check consistency with header.
+        std::size_t recordSize = ( numberOfValuesPerRecord_ + 1 ) * sizeof( double );
+        numberOfRecords_ = ( fileSize_ > dataOffset_ ) ? ( fileSize_ - dataOffset_ ) / recordSize : 0;
+        if( numberOfRecordsInHeader != 0 && numberOfRecordsInHeader != numberOfRecords_ )
+        {
+            throw std::runtime_error( "Error when reading binary history file " + fileName_ + ", header indicates " +
+                                      std::to_string( numberOfRecordsInHeader ) + " records, but file contains " +
+                                      std::to_string( numberOfRecords_ ) );
+        }
+    }
+    catch( ... )
+    {
+#if TUDAT_BINARY_HISTORY_USE_MMAP
+        if( isFileMapped_ )
+        {
+            ::munmap( const_cast< char* >( fileData_ ), fileSize_ );
+        }
+#endif
+        throw;
+    }
+}
+
+//! Destructor, unmaps the file.
+BinaryHistoryReader::~BinaryHistoryReader( )
+{
+#if TUDAT_BINARY_HISTORY_USE_MMAP
+    if( isFileMapped_ )
+    {
+        ::munmap( const_cast< char* >( fileData_ ), fileSize_ );
+    }
+#endif
+}
+
+//! Function to retrieve the epoch of a single record.
+double BinaryHistoryReader::getEpoch( const unsigned long long recordIndex )
+{
+    if( recordIndex >= numberOfRecords_ )
+    {
+        throw std::runtime_error( "Error when reading binary history file " + fileName_ + ", requested record " +
+                                  std::to_string( recordIndex ) + ", but file contains " +
+                                  std::to_string( numberOfRecords_ ) + " records." );
+    }
+
+    double epoch;
+    std::memcpy( &epoch, fileData_ + dataOffset_ + recordIndex * ( numberOfValuesPerRecord_ + 1 ) * sizeof( double ),
+                 sizeof( double ) );
+    return epoch;
+}
+
+//! Function to retrieve the values of all variables of a single record.
+Eigen::Map< const Eigen::VectorXd > BinaryHistoryReader::getRecordValues( const unsigned long long recordIndex )
+{
+    if( recordIndex >= numberOfRecords_ )
+    {
+        throw std::runtime_error( "Error when reading binary history file " + fileName_ + ", requested record " +
+                                  std::to_string( recordIndex ) + ", but file contains " +
+                                  std::to_string( numberOfRecords_ ) + " records." );
+    }
+
+    return Eigen::Map< const Eigen::VectorXd >(
+                reinterpret_cast< const double* >(
+                    fileData_ + dataOffset_ + ( recordIndex * ( numberOfValuesPerRecord_ + 1 ) + 1 ) * sizeof( double ) ),
+                numberOfValuesPerRecord_ );
+}
+
+//! Function to retrieve the index of the first value of a variable in a record.
+unsigned int BinaryHistoryReader::getVariableStartIndex( const std::string& identifier )
+{
+    unsigned int startIndex = 0;
+    for( unsigned int i = 0; i < variables_.size( ); i++ )
+    {
+        if( variables_.at( i ).identifier_ == identifier )
+        {
+            return startIndex;
+        }
+        startIndex += variables_.at( i ).numberOfValues_;
+    }
+
+    throw std::runtime_error( "Error when reading binary history file " + fileName_ + ", variable " + identifier +
+                              " not found." );
+}
+
+//! Function to retrieve the number of values of a variable.
+unsigned int BinaryHistoryReader::getVariableSize( const std::string& identifier )
+{
+    for( unsigned int i = 0; i < variables_.size( ); i++ )
+    {
+        if( variables_.at( i ).identifier_ == identifier )
+        {
+            return variables_.at( i ).numberOfValues_;
+        }
+    }
+
+    throw std::runtime_error( "Error when reading binary history file " + fileName_ + ", variable " + identifier +
+                              " not found." );
+}
+
+//! Function to retrieve the full history of all variables.
+std::map< double, Eigen::VectorXd > BinaryHistoryReader::getHistory( )
+{
+    std::map< double, Eigen::VectorXd > history;
+    for( unsigned long long i = 0; i < numberOfRecords_; i++ )
+    {
+        history[ getEpoch( i ) ] = getRecordValues( i );
+    }
+    return history;
+}
+
+//! Function to retrieve the history of a single variable.
+std::map< double, Eigen::VectorXd > BinaryHistoryReader::getVariableHistory( const std::string& identifier )
+{
+    unsigned int startIndex = getVariableStartIndex( identifier );
+    unsigned int variableSize = getVariableSize( identifier );
+
+    std::map< double, Eigen::VectorXd > variableHistory;
+    for( unsigned long long i = 0; i < numberOfRecords_; i++ )
+    {
+        variableHistory[ getEpoch( i ) ] = getRecordValues( i ).segment( startIndex, variableSize );
+    }
+    return variableHistory;
+}
+
+} // namespace input_output
+
+} // namespace tudat
@@ -0,0 +1,346 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Layout of a binary history file (all values in native byte order, which is checked upon reading):
+ *        - char[8]   identifier "TUDATHST"
+ *        - uint32    format version
+ *        - uint32    byte order check value (0x01020304)
+ *        - uint64    number of records (0 if file was not closed properly)
+ *        - double    first epoch
+ *        - double    last epoch
+ *        - string    unit of epochs
+ *        - uint32    number of variables
+ *        - per variable: string identifier, string unit, uint32 number of values
+ *        - zero padding up to a multiple of 8 bytes
+ *        - records, each consisting of the epoch, followed by the values of all variables (all as double)
+ *      Strings are stored as a uint32 length, followed by the characters.
+ *
+ */
+
+#ifndef TUDAT_BINARYHISTORYFILE_H
+#define TUDAT_BINARYHISTORYFILE_H
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace input_output
+{
+
+//! Class describing a single variable (i.e. a set of consecutive columns) in a binary history file.
+class BinaryHistoryVariable
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param identifier Identifier of the variable (e.g. "Translational state of Vehicle w.r.t. Earth").
+     *  \param numberOfValues Number of values (columns) of the variable.
+     *  \param unit Unit of the variable (empty if not specified).
+     */
+    BinaryHistoryVariable( const std::string& identifier, const unsigned int numberOfValues,
+                           const std::string& unit = "" ):
+        identifier_( identifier ), numberOfValues_( numberOfValues ), unit_( unit ){ }
+
+    //! Identifier of the variable.
+    std::string identifier_;
+
+    //! Number of values (columns) of the variable.
+    unsigned int numberOfValues_;
+
+    //! Unit of the variable (empty if not specified).
+    std::string unit_;
+};
+
+//! Class to write a history of vector-valued data to a binary history file, one record (epoch) at a time.
+/*!
+ *  Class to write a history of vector-valued data to a binary history file, one record (epoch) at a time, so that the
+ *  history does not need to be stored in memory before writing. The header (see notes at top of file) describes the
+ *  variables in each record, so that the file can be read back without any additional information. The number of
+ *  records and the first and last epoch are set in the header when the file is closed.
+ */
+class BinaryHistoryWriter
+{
+public:
+
+    //! Constructor, opens the file and writes the header.
+    /*!
+     *  Constructor, opens the file and writes the header.
+     *  \param fileName Name of the file that is to be written (overwritten if it exists).
+     *  \param variables Variables that are written in each record, in the order in which their values are provided.
+     *  \param epochUnit Unit of the epochs of the records.
+     */
+    BinaryHistoryWriter( const std::string& fileName,
+                         const std::vector< BinaryHistoryVariable >& variables,
+                         const std::string& epochUnit = "s since J2000 (TDB)" );
+
+    //! Destructor, closes the file.
+    ~BinaryHistoryWriter( );
+
+    //! Function to write a single record to the file.
+    /*!
+     *  Function to write a single record to the file. An exception is thrown if the record could not be written (e.g.
+     *  due to a full disk). Since the file stream is buffered, such a failure may only be detected when writing a later
+     *  record, or when closing the file.
+     *  \param epoch Epoch of the record.
+     *  \param values Values of all variables at the given epoch (in the order of the variables).
+     */
+    void writeRecord( const double epoch, const Eigen::VectorXd& values );
+
+    //! Function to write a single record to the file, with the values of the variables provided in two parts.
+    /*!
+     *  Function to write a single record to the file, with the values of the variables provided in two parts (e.g. the
+     *  propagated state and the dependent variables), which are written consecutively.
+     *  \param epoch Epoch of the record.
+     *  \param firstValues First part of the values of all variables at the given epoch.
+     *  \param secondValues Second part of the values of all variables at the given epoch.
+     */
+    void writeRecord( const double epoch, const Eigen::VectorXd& firstValues, const Eigen::VectorXd& secondValues );
+
+    //! Function to finalize the header and close the file. No more records can be written after calling this function.
+    void close( );
+
+    //! Function to retrieve the number of records written to the file.
+    /*!
+     *  Function to retrieve the number of records written to the file.
+     *  \return Number of records written to the file.
+     */
+    unsigned long long getNumberOfRecords( )
+    {
+        return numberOfRecords_;
+    }
+
+    //! Function to retrieve the number of values per record (excluding the epoch).
+    /*!
+     *  Function to retrieve the number of values per record (excluding the epoch).
+     *  \return Number of values per record (excluding the epoch).
+     */
+    unsigned int getNumberOfValuesPerRecord( )
+    {
+        return numberOfValuesPerRecord_;
+    }
+
+private:
+
+    //! Function to write the values in the record buffer to the file.
+    void writeRecordBuffer( );
+
+    //! Name of the file that is written.
+    std::string fileName_;
+
+    //! Buffer used by the file stream.
+    std::vector< char > streamBuffer_;
+
+    //! Stream to which the file is written.
+    std::ofstream fileStream_;
+
+    //! Number of values per record (excluding the epoch).
+    unsigned int numberOfValuesPerRecord_;
+
+    //! Position in the file of the number of records, and first and last epoch.
+    std::streampos recordInformationPosition_;
+
+    //! Buffer in which a single record (epoch and values) is set before being written.
+    std::vector< double > recordBuffer_;
+
+    //! Number of records written to the file.
+    unsigned long long numberOfRecords_;
+
+    //! Epoch of the first record written to the file.
+    double firstEpoch_;
+
+    //! Epoch of the last record written to the file.
+    double lastEpoch_;
+};
+
+//! Class to read a binary history file, as written by the BinaryHistoryWriter.
+/*!
+ *  Class to read a binary history file, as written by the BinaryHistoryWriter. Where supported (POSIX systems), the file
+ *  is memory-mapped, so that only the data that is accessed is read from disk. Otherwise, the file is read into memory
+ *  upon construction. If the file was not closed properly by the writer (e.g. due to an interrupted propagation), the
+ *  number of records is determined from the size of the file.
+ */
+class BinaryHistoryReader
+{
+public:
+
+    //! Constructor, opens (maps) the file and reads the header.
+    /*!
+     *  Constructor, opens (maps) the file and reads the header.
+     *  \param fileName Name of the file that is to be read.
+     */
+    BinaryHistoryReader( const std::string& fileName );
+
+    //! Destructor, unmaps the file.
+    ~BinaryHistoryReader( );
+
+    //! Function to retrieve the variables in each record.
+    /*!
+     *  Function to retrieve the variables in each record.
+     *  \return Variables in each record, in the order in which their values are stored.
+     */
+    std::vector< BinaryHistoryVariable > getVariables( )
+    {
+        return variables_;
+    }
+
+    //! Function to retrieve the unit of the epochs of the records.
+    /*!
+     *  Function to retrieve the unit of the epochs of the records.
+     *  \return Unit of the epochs of the records.
+     */
+    std::string getEpochUnit( )
+    {
+        return epochUnit_;
+    }
+
+    //! Function to retrieve the number of records in the file.
+    /*!
+     *  Function to retrieve the number of records in the file.
+     *  \return Number of records in the file.
+     */
+    unsigned long long getNumberOfRecords( )
+    {
+        return numberOfRecords_;
+    }
+
+    //! Function to retrieve the number of values per record (excluding the epoch).
+    /*!
+     *  Function to retrieve the number of values per record (excluding the epoch).
+     *  \return Number of values per record (excluding the epoch).
+     */
+    unsigned int getNumberOfValuesPerRecord( )
+    {
+        return numberOfValuesPerRecord_;
+    }
+
+    //! Function to retrieve the epoch of a single record.
+    /*!
+     *  Function to retrieve the epoch of a single record.
+     *  \param recordIndex Index of the record.
+     *  \return Epoch of the record.
+     */
+    double getEpoch( const unsigned long long recordIndex );
+
+    //! Function to retrieve the values of all variables of a single record.
+    /*!
+     *  Function to retrieve the values of all variables of a single record, without copying the data from the file.
+     *  \param recordIndex Index of the record.
+     *  \return Values of all variables of the record.
+     */
+    Eigen::Map< const Eigen::VectorXd > getRecordValues( const unsigned long long recordIndex );
+
+    //! Function to retrieve the index of the first value of a variable in a record.
+    /*!
+     *  Function to retrieve the index of the first value of a variable in a record (excluding the epoch). An exception
+     *  is thrown if the variable is not in the file.
+     *  \param identifier Identifier of the variable.
+     *  \return Index of the first value of the variable in a record.
+     */
+    unsigned int getVariableStartIndex( const std::string& identifier );
+
+    //! Function to retrieve the number of values of a variable.
+    /*!
+     *  Function to retrieve the number of values of a variable. An exception is thrown if the variable is not in the file.
+     *  \param identifier Identifier of the variable.
+     *  \return Number of values of the variable.
+     */
+    unsigned int getVariableSize( const std::string& identifier );
+
+    //! Function to retrieve the full history of all variables.
+    /*!
+     *  Function to retrieve the full history of all variables.
+     *  \return History of all variables (concatenated), with epoch as key.
+     */
+    std::map< double, Eigen::VectorXd > getHistory( );
+
+    //! Function to retrieve the history of a single variable.
+    /*!
+     *  Function to retrieve the history of a single variable.
+     *  \param identifier Identifier of the variable.
+     *  \return History of the variable, with epoch as key.
+     */
+    std::map< double, Eigen::VectorXd > getVariableHistory( const std::string& identifier );
+
+    //! Function to retrieve the history of a single variable of fixed size.
+    /*!
+     *  Function to retrieve the history of a single variable of fixed size, e.g. as a map of Eigen::Vector6d for the
+     *  creation of a TabulatedCartesianEphemeris. An exception is thrown if the size of the variable is not equal to the
+     *  template argument.
+     *  \param identifier Identifier of the variable.
+     *  \return History of the variable, with epoch as key.
+     */
+    template< int NumberOfValues >
+    std::map< double, Eigen::Matrix< double, NumberOfValues, 1 > > getFixedSizeVariableHistory(
+            const std::string& identifier )
+    {
+        unsigned int startIndex = getVariableStartIndex( identifier );
+        if( getVariableSize( identifier ) != NumberOfValues )
+        {
+            throw std::runtime_error( "Error when reading binary history file " + fileName_ + ", variable " + identifier +
+                                      " has size " + std::to_string( getVariableSize( identifier ) ) + ", expected " +
+                                      std::to_string( NumberOfValues ) );
+        }
+
+        std::map< double, Eigen::Matrix< double, NumberOfValues, 1 > > variableHistory;
+        for( unsigned long long i = 0; i < numberOfRecords_; i++ )
+        {
+            variableHistory[ getEpoch( i ) ] = getRecordValues( i ).template segment< NumberOfValues >( startIndex );
+        }
+        return variableHistory;
+    }
+
+private:
+
+    //! Name of the file that is read.
+    std::string fileName_;
+
+    //! Pointer to the start of the file contents in memory.
+    const char* fileData_;
+
+    //! Size of the file (in bytes).
+    std::size_t fileSize_;
+
+    //! File contents, if the file could not be memory-mapped.
+    std::vector< char > fileContents_;
+
+    //! Boolean denoting whether the file is memory-mapped.
+    bool isFileMapped_;
+
+    //! Unit of the epochs of the records.
+    std::string epochUnit_;
+
+    //! Variables in each record.
+    std::vector< BinaryHistoryVariable > variables_;
+
+    //! Number of values per record (excluding the epoch).
+    unsigned int numberOfValuesPerRecord_;
+
+    //! Number of records in the file.
+    unsigned long long numberOfRecords_;
+
+    //! Offset (in bytes) of the first record from the start of the file.
+    std::size_t dataOffset_;
+};
+
+} // namespace input_output
+
+} // namespace tudat
+
+#endif // TUDAT_BINARYHISTORYFILE_H
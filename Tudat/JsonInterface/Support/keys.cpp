@@ -489,6 +489,8 @@ const std::string Keys::Options::defaultValueUsedForMissingKey = "defaultValueUs
 const std::string Keys::Options::unusedKey = "unusedKey";
 const std::string Keys::Options::fullSettingsFile = "fullSettingsFile";
 const std::string Keys::Options::tagOutputFilesIfPropagationFails = "tagOutputFilesIfPropagationFails";
+const std::string Keys::Options::profilePropagation = "profilePropagation";
+const std::string Keys::Options::profilingResultsFile = "profilingResultsFile";
 
 
 // KEYPATH
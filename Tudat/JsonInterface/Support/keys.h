@@ -530,6 +530,8 @@ struct Keys
         static const std::string unusedKey;
         static const std::string fullSettingsFile;
         static const std::string tagOutputFilesIfPropagationFails;
+        static const std::string profilePropagation;
+        static const std::string profilingResultsFile;
     };
 };
 
@@ -32,6 +32,8 @@ void to_json( nlohmann::json& jsonObject, const std::shared_ptr< ApplicationOpti
     jsonObject[ K::unusedKey ] = applicationOptions->unusedKey_;
     assignIfNotEmpty( jsonObject, K::fullSettingsFile, applicationOptions->fullSettingsFile_ );
     jsonObject[ K::tagOutputFilesIfPropagationFails ] = applicationOptions->tagOutputFilesIfPropagationFails_;
+    jsonObject[ K::profilePropagation ] = applicationOptions->profilePropagation_;
+    assignIfNotEmpty( jsonObject, K::profilingResultsFile, applicationOptions->profilingResultsFile_ );
 }
 
 //! Create a shared pointer to a `ApplicationOptions` object from a `json` object.
@@ -55,6 +57,10 @@ void from_json( const nlohmann::json& jsonObject, std::shared_ptr< ApplicationOp
 
     updateFromJSONIfDefined( applicationOptions->tagOutputFilesIfPropagationFails_,
                              jsonObject, K::tagOutputFilesIfPropagationFails );
+
+    updateFromJSONIfDefined( applicationOptions->profilePropagation_, jsonObject, K::profilePropagation );
+
+    updateFromJSONIfDefined( applicationOptions->profilingResultsFile_, jsonObject, K::profilingResultsFile );
 }
 
 } // namespace json_interface
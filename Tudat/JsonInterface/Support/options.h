@@ -71,6 +71,13 @@ public:
     //! Whether the generated output files should contain the line "FAILURE" if the propagation terminates before
     //! reaching the termination condition.
     bool tagOutputFilesIfPropagationFails_ = true;
+
+    //! Whether the computation time spent in the separate models used in the propagation should be profiled.
+    bool profilePropagation_ = false;
+
+    //! Path where the profiling results are going to be saved (as json). Empty string if the results should be
+    //! printed instead. Only used if profilePropagation_ is true.
+    boost::filesystem::path profilingResultsFile_ = "";
 };
 
 //! Create a `json` object from a shared pointer to a `ApplicationOptions` object.
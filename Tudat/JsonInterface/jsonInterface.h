@@ -170,7 +170,8 @@ public:
      * If some of the keys in jsonObject_ haven't been used, a message may be printed or an error may be thrown
      * depending on applicationOptions_.
      * <br/>
-     * After running the simulation, a message will be printed if requested in applicationOptions_.
+     * After running the simulation, a message will be printed if requested in applicationOptions_, and the profiling
+     * results will be printed or exported if requested in applicationOptions_.
      */
     virtual void runPropagation( )
     {
@@ -213,6 +214,12 @@ public:
             }
         }
 
+        // Print or export profiling results if requested
+        if ( applicationOptions_->profilePropagation_ )
+        {
+            exportProfilingResults( applicationOptions_->profilingResultsFile_ );
+        }
+
         if ( profiling )
         {
             std::cout << "run: " << std::chrono::duration_cast< std::chrono::milliseconds >(
@@ -283,6 +290,46 @@ public:
         outputFile.close( );
     }
 
+    //! Export the profiling results of the last propagation.
+    /*!
+     * Export the profiling results of the last propagation, i.e. the total computation time and number of calls of
+     * each of the profiled models, to a JSON file, or print them if the provided path is empty.
+     * \param exportPath Path to which the profiling results are to be exported (empty to print them).
+     * \param tabSize Size of tabulations in the exported file (default = 2, i.e. 2 spaces).
+     */
+    void exportProfilingResults( const boost::filesystem::path& exportPath, const unsigned int tabSize = 2 )
+    {
+        std::shared_ptr< propagators::PropagationProfiler > propagationProfiler =
+                dynamicsSimulator_->getPropagationProfiler( );
+        if ( ! propagationProfiler )
+        {
+            return;
+        }
+
+        if ( exportPath.empty( ) )
+        {
+            propagationProfiler->printProfilingResults( );
+            return;
+        }
+
+        nlohmann::json jsonObject;
+        const std::map< std::string, std::pair< double, unsigned int > > profilingResults =
+                propagationProfiler->getProfilingResults( );
+        for ( auto const& entry : profilingResults )
+        {
+            jsonObject[ entry.first ][ "totalComputationTime" ] = entry.second.first;
+            jsonObject[ entry.first ][ "numberOfCalls" ] = entry.second.second;
+        }
+
+        if ( ! boost::filesystem::exists( exportPath.parent_path( ) ) )
+        {
+            boost::filesystem::create_directories( exportPath.parent_path( ) );
+        }
+        std::ofstream outputFile( exportPath.string( ) );
+        outputFile << jsonObject.dump( tabSize );
+        outputFile.close( );
+    }
+
     //! Get original JSON object (defined at construction or last time setInputFile was called).
     /*!
      * @copybrief getOriginalJsonObject
@@ -584,6 +631,11 @@ protected:
                 std::make_shared< propagators::SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
                     bodyMap_, integratorSettings_, propagatorSettings_, false, false, false, false, initialClockTime_ );
 
+        if ( applicationOptions_ && applicationOptions_->profilePropagation_ )
+        {
+            dynamicsSimulator_->setPropagationProfiler( std::make_shared< propagators::PropagationProfiler >( ) );
+        }
+
         if ( profiling )
         {
             std::cout << "resetDynamicsSimulator: " << std::chrono::duration_cast< std::chrono::milliseconds >(
@@ -0,0 +1,89 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/dualNumber.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::basic_mathematics;
+
+BOOST_AUTO_TEST_SUITE( test_dual_number )
+
+//! Test function, templated on scalar type.
+template< typename ScalarType >
+ScalarType computeTestFunction( const ScalarType& x, const ScalarType& y )
+{
+    using std::sin; using std::exp; using std::sqrt; using std::atan2; using std::pow; using std::log;
+    return sin( x ) * exp( y ) / sqrt( x * x + y * y ) + atan2( y, x ) - pow( x, 3.0 ) + 2.0 * log( y ) - 1.0 / x;
+}
+
+//! Test derivatives of elementary operations and functions
+BOOST_AUTO_TEST_CASE( testDualNumberDerivatives )
+{
+    double x = 0.7, y = 1.3;
+
+    // Analytical derivatives of test function
+    double radius = std::sqrt( x * x + y * y );
+    double expectedDerivativeX =
+            std::cos( x ) * std::exp( y ) / radius - std::sin( x ) * std::exp( y ) * x / ( radius * radius * radius ) -
+            y / ( radius * radius ) - 3.0 * x * x + 1.0 / ( x * x );
+    double expectedDerivativeY =
+            std::sin( x ) * std::exp( y ) / radius - std::sin( x ) * std::exp( y ) * y / ( radius * radius * radius ) +
+            x / ( radius * radius ) + 2.0 / y;
+
+    DualNumber< 2 > result = computeTestFunction(
+                DualNumber< 2 >::createIndependentVariable( x, 0 ), DualNumber< 2 >::createIndependentVariable( y, 1 ) );
+
+    BOOST_CHECK_CLOSE_FRACTION( result.getValue( ), computeTestFunction( x, y ), 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 0 ), expectedDerivativeX, 1.0E-14 );
+    BOOST_CHECK_CLOSE_FRACTION( result.getDerivatives( )( 1 ), expectedDerivativeY, 1.0E-14 );
+
+    // Check comparison on value only
+    BOOST_CHECK( DualNumber< 2 >::createIndependentVariable( x, 0 ) == x );
+    BOOST_CHECK( DualNumber< 2 >::createIndependentVariable( x, 0 ) < y );
+}
+
+//! Test use of dual number as Eigen scalar type
+BOOST_AUTO_TEST_CASE( testDualNumberEigenVectors )
+{
+    // Compute Jacobian of r / |r|^3 w.r.t. r
+    Eigen::Vector3d position( 1.0, -2.0, 0.5 );
+    Eigen::Matrix< DualNumber< 3 >, 3, 1 > dualPosition = createIndependentDualVector< 3, 3 >( position );
+    DualNumber< 3 > distance = dualPosition.norm( );
+    Eigen::Matrix< DualNumber< 3 >, 3, 1 > dualResult = dualPosition / ( distance * distance * distance );
+    dualResult = 2.0 * dualResult;
+
+    double positionNorm = position.norm( );
+    Eigen::Matrix3d expectedJacobian = 2.0 * ( Eigen::Matrix3d::Identity( ) / std::pow( positionNorm, 3.0 ) -
+            3.0 * position * position.transpose( ) / std::pow( positionNorm, 5.0 ) );
+
+    Eigen::Vector3d resultValue = getDualVectorValues( dualResult );
+    Eigen::Matrix3d resultJacobian = getDualVectorJacobian( dualResult );
+
+    BOOST_CHECK_SMALL( ( resultValue - 2.0 * position / std::pow( positionNorm, 3.0 ) ).norm( ), 1.0E-15 );
+    BOOST_CHECK_SMALL( ( resultJacobian - expectedJacobian ).norm( ) / expectedJacobian.norm( ), 1.0E-15 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -21,6 +21,9 @@
 
 #define BOOST_TEST_MAIN
 
+#include <algorithm>
+#include <cmath>
+
 #include <boost/test/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -158,6 +161,41 @@ BOOST_AUTO_TEST_CASE( test_GeodesyLegendrePolynomial )
 
 }
 
+//! Test explicit low degree/order Legendre polynomials against the recursive computation.
+BOOST_AUTO_TEST_CASE( test_ExplicitLegendrePolynomial )
+{
+    // Define polynomial parameters (including negative values, so that sign errors in odd terms are detected).
+    const Eigen::Vector4d polynomialParameters = ( Eigen::Vector4d( ) << -0.9, -0.35, 0.5, 0.8 ).finished( );
+
+    for( int parameterIndex = 0; parameterIndex < polynomialParameters.rows( ); parameterIndex++ )
+    {
+        const double polynomialParameter = polynomialParameters( parameterIndex );
+
+        // Compare all degrees and orders for which explicit polynomials are available.
+        for( int degree = 0; degree <= 4; degree++ )
+        {
+            for( int order = 0; order <= degree; order++ )
+            {
+                // Compare unnormalized explicit polynomial to recursion.
+                const double explicitPolynomial = basic_mathematics::computeLegendrePolynomialExplicit(
+                            degree, order, polynomialParameter );
+                const double recursivePolynomial = basic_mathematics::computeLegendrePolynomial(
+                            degree, order, polynomialParameter );
+                BOOST_CHECK_SMALL( explicitPolynomial - recursivePolynomial,
+                                   1.0E-14 * std::max( std::fabs( recursivePolynomial ), 1.0 ) );
+
+                // Compare normalized explicit polynomial to geodesy-normalized recursion.
+                const double normalizedExplicitPolynomial = explicitPolynomial *
+                        basic_mathematics::calculateLegendreGeodesyNormalizationFactor( degree, order );
+                const double recursiveGeodesyPolynomial = basic_mathematics::computeGeodesyLegendrePolynomial(
+                            degree, order, polynomialParameter );
+                BOOST_CHECK_SMALL( normalizedExplicitPolynomial - recursiveGeodesyPolynomial,
+                                   1.0E-14 * std::max( std::fabs( recursiveGeodesyPolynomial ), 1.0 ) );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE( test_LegendrePolynomialDerivative )
 {
     // Initialize test values vector.
@@ -0,0 +1,148 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cstdlib>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include "Tudat/Mathematics/BasicMathematics/sequentialNormalEquations.h"
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::linear_algebra;
+
+BOOST_AUTO_TEST_SUITE( test_sequential_normal_equations )
+
+//! Test whether sequentially processed observations reproduce full batch solution of linear problem
+BOOST_AUTO_TEST_CASE( testSequentialNormalEquationsLinearProblem )
+{
+    // Create linear problem: 4 parameters, observed in two batches.
+    std::srand( 42 );
+    Eigen::MatrixXd firstPartials = Eigen::MatrixXd::Random( 30, 4 );
+    Eigen::MatrixXd secondPartials = Eigen::MatrixXd::Random( 20, 4 );
+    Eigen::VectorXd firstWeights = Eigen::VectorXd::Constant( 30, 4.0 );
+    Eigen::VectorXd secondWeights = Eigen::VectorXd::Constant( 20, 0.5 );
+
+    Eigen::VectorXd trueParameters = ( Eigen::VectorXd( 4 ) << 1.0, -2.0, 0.5, 3.0 ).finished( );
+    Eigen::VectorXd firstObservations = firstPartials * trueParameters + 0.01 * Eigen::VectorXd::Random( 30 );
+    Eigen::VectorXd secondObservations = secondPartials * trueParameters + 0.01 * Eigen::VectorXd::Random( 20 );
+
+    Eigen::MatrixXd inverseAprioriCovariance = 0.1 * Eigen::MatrixXd::Identity( 4, 4 );
+
+    // Compute full batch solution, starting from zero parameters
+    Eigen::MatrixXd fullPartials( 50, 4 );
+    fullPartials << firstPartials, secondPartials;
+    Eigen::VectorXd fullObservations( 50 );
+    fullObservations << firstObservations, secondObservations;
+    Eigen::VectorXd fullWeights( 50 );
+    fullWeights << firstWeights, secondWeights;
+    Eigen::VectorXd batchSolution = performLeastSquaresAdjustmentFromInformationMatrix(
+                fullPartials, fullObservations, fullWeights, inverseAprioriCovariance ).first;
+
+    // Process first batch at zero parameters, second batch after moving linearization point.
+    SequentialNormalEquations normalEquations( Eigen::VectorXd::Zero( 4 ), inverseAprioriCovariance );
+    normalEquations.addObservations( firstPartials, firstObservations, firstWeights );
+    Eigen::VectorXd firstSolution = normalEquations.getParameterCorrection( );
+
+    normalEquations.setLinearizationPoint( firstSolution );
+    normalEquations.addObservations( secondPartials, secondObservations - secondPartials * firstSolution, secondWeights );
+    Eigen::VectorXd sequentialSolution = firstSolution + normalEquations.getParameterCorrection( );
+
+    BOOST_CHECK_EQUAL( normalEquations.getNumberOfProcessedObservations( ), 50 );
+    BOOST_CHECK_SMALL( ( sequentialSolution - batchSolution ).norm( ) / batchSolution.norm( ), 1.0E-12 );
+
+    // Check normal matrix
+    Eigen::MatrixXd fullNormalMatrix = calculateInverseOfUpdatedCovarianceMatrix(
+                fullPartials, fullWeights, inverseAprioriCovariance );
+    BOOST_CHECK_SMALL( ( normalEquations.getFullNormalMatrix( ) - fullNormalMatrix ).norm( ) / fullNormalMatrix.norm( ),
+                       1.0E-14 );
+
+    // Check that moving to solution gives zero correction
+    normalEquations.setLinearizationPoint( sequentialSolution );
+    BOOST_CHECK_SMALL( normalEquations.getParameterCorrection( ).norm( ), 1.0E-12 );
+}
+
+//! Test elimination of arc-wise parameters by Schur complement
+BOOST_AUTO_TEST_CASE( testSequentialNormalEquationsParameterElimination )
+{
+    // Parameter vector: 2 global parameters, 2 parameters for first arc, 2 parameters for second arc (first/second arc
+    // parameters only observed by first/second batch).
+    std::srand( 7 );
+    Eigen::MatrixXd firstPartials = Eigen::MatrixXd::Zero( 25, 6 );
+    firstPartials.block( 0, 0, 25, 4 ) = Eigen::MatrixXd::Random( 25, 4 );
+    Eigen::MatrixXd secondPartials = Eigen::MatrixXd::Zero( 25, 6 );
+    secondPartials.block( 0, 0, 25, 2 ) = Eigen::MatrixXd::Random( 25, 2 );
+    secondPartials.block( 0, 4, 25, 2 ) = Eigen::MatrixXd::Random( 25, 2 );
+
+    Eigen::VectorXd trueParameters = ( Eigen::VectorXd( 6 ) << 1.0, -2.0, 0.5, 3.0, -1.5, 0.25 ).finished( );
+    Eigen::VectorXd firstObservations = firstPartials * trueParameters + 0.01 * Eigen::VectorXd::Random( 25 );
+    Eigen::VectorXd secondObservations = secondPartials * trueParameters + 0.01 * Eigen::VectorXd::Random( 25 );
+    Eigen::VectorXd weights = Eigen::VectorXd::Constant( 25, 1.0 );
+
+    // Compute full batch solution
+    Eigen::MatrixXd fullPartials( 50, 6 );
+    fullPartials << firstPartials, secondPartials;
+    Eigen::VectorXd fullObservations( 50 );
+    fullObservations << firstObservations, secondObservations;
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > batchSolution = performLeastSquaresAdjustmentFromInformationMatrix(
+                fullPartials, fullObservations, Eigen::VectorXd::Constant( 50, 1.0 ), Eigen::MatrixXd::Zero( 6, 6 ) );
+
+    // Process first batch, eliminate first arc parameters, and process second batch
+    SequentialNormalEquations normalEquations( Eigen::VectorXd::Zero( 6 ) );
+    normalEquations.addObservations( firstPartials, firstObservations, weights );
+
+    std::vector< int > firstArcParameters = { 2, 3 };
+    normalEquations.eliminateParameters( firstArcParameters );
+    BOOST_CHECK_EQUAL( normalEquations.getActiveParameterIndices( ).size( ), 4 );
+    BOOST_CHECK_THROW( normalEquations.eliminateParameters( firstArcParameters ), std::runtime_error );
+
+    normalEquations.addObservations( secondPartials, secondObservations, weights );
+    Eigen::VectorXd sequentialSolution = normalEquations.getParameterCorrection( );
+
+    // Global and second arc parameters must match full solution, eliminated parameters have zero correction.
+    std::vector< int > retainedParameters = { 0, 1, 4, 5 };
+    for( unsigned int i = 0; i < retainedParameters.size( ); i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( sequentialSolution( retainedParameters.at( i ) ),
+                                    batchSolution.first( retainedParameters.at( i ) ), 1.0E-12 );
+    }
+    BOOST_CHECK_EQUAL( sequentialSolution( 2 ), 0.0 );
+    BOOST_CHECK_EQUAL( sequentialSolution( 3 ), 0.0 );
+
+    // Covariance of retained parameters must match marginal covariance of full solution.
+    Eigen::MatrixXd fullCovariance = batchSolution.second.inverse( );
+    Eigen::MatrixXd reducedCovariance = normalEquations.getNormalMatrix( ).inverse( );
+    for( unsigned int i = 0; i < retainedParameters.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < retainedParameters.size( ); j++ )
+        {
+            BOOST_CHECK_SMALL( reducedCovariance( i, j ) -
+                               fullCovariance( retainedParameters.at( i ), retainedParameters.at( j ) ),
+                               1.0E-12 * fullCovariance.norm( ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
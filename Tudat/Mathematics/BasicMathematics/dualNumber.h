@@ -0,0 +1,451 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Griewank A., Walther A. Evaluating Derivatives: Principles and Techniques of Algorithmic Differentiation.
+ *          SIAM, 2008.
+ *
+ */
+
+#ifndef TUDAT_DUALNUMBER_H
+#define TUDAT_DUALNUMBER_H
+
+#include <cmath>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace basic_mathematics
+{
+
+//! Scalar type for forward-mode automatic differentiation.
+/*!
+ *  Scalar type for forward-mode automatic differentiation, consisting of a value and a fixed-size vector of derivatives
+ *  of this value w.r.t. a set of independent variables. All arithmetic operations and elementary functions implemented
+ *  for this type propagate the derivatives by the chain rule, so that evaluating a function (templated on its scalar type)
+ *  with DualNumber input provides both the function value and its exact Jacobian in a single evaluation. Comparisons
+ *  are performed on the value only. The type can be used as the scalar type of Eigen matrices.
+ *  \tparam NumberOfDerivatives Number of independent variables w.r.t. which derivatives are computed.
+ */
+template< int NumberOfDerivatives >
+class DualNumber
+{
+public:
+
+    //! Typedef for vector of derivatives (unaligned, so that objects of this type can be stored in any container).
+    typedef Eigen::Matrix< double, NumberOfDerivatives, 1, Eigen::DontAlign > DerivativeVector;
+
+    //! Constructor for a constant (i.e. with zero derivatives).
+    /*!
+     *  Constructor for a constant (i.e. with zero derivatives). Not explicit, so that doubles are converted implicitly.
+     *  \param value Value of number.
+     */
+    DualNumber( const double value = 0.0 ):
+        value_( value ), derivatives_( DerivativeVector::Zero( ) ){ }
+
+    //! Constructor with value and derivatives.
+    /*!
+     *  Constructor with value and derivatives.
+     *  \param value Value of number.
+     *  \param derivatives Derivatives of number w.r.t. independent variables.
+     */
+    DualNumber( const double value, const DerivativeVector& derivatives ):
+        value_( value ), derivatives_( derivatives ){ }
+
+    //! Function to create an independent variable
+    /*!
+     *  Function to create an independent variable, with unit derivative w.r.t. itself and zero derivative w.r.t. all other
+     *  variables.
+     *  \param value Value of independent variable.
+     *  \param index Index of variable in list of independent variables.
+     *  \return Independent variable.
+     */
+    static DualNumber createIndependentVariable( const double value, const int index )
+    {
+        DualNumber independentVariable( value );
+        independentVariable.derivatives_( index ) = 1.0;
+        return independentVariable;
+    }
+
+    //! Function to retrieve the value of the number.
+    double getValue( ) const
+    {
+        return value_;
+    }
+
+    //! Function to retrieve the derivatives of the number w.r.t. the independent variables.
+    const DerivativeVector& getDerivatives( ) const
+    {
+        return derivatives_;
+    }
+
+    //! Addition-assignment operator.
+    DualNumber& operator+=( const DualNumber& other )
+    {
+        value_ += other.value_;
+        derivatives_ += other.derivatives_;
+        return *this;
+    }
+
+    //! Subtraction-assignment operator.
+    DualNumber& operator-=( const DualNumber& other )
+    {
+        value_ -= other.value_;
+        derivatives_ -= other.derivatives_;
+        return *this;
+    }
+
+    //! Multiplication-assignment operator.
+    DualNumber& operator*=( const DualNumber& other )
+    {
+        derivatives_ = other.value_ * derivatives_ + value_ * other.derivatives_;
+        value_ *= other.value_;
+        return *this;
+    }
+
+    //! Division-assignment operator.
+    DualNumber& operator/=( const DualNumber& other )
+    {
+        derivatives_ = ( derivatives_ - ( value_ / other.value_ ) * other.derivatives_ ) / other.value_;
+        value_ /= other.value_;
+        return *this;
+    }
+
+    //! Addition-assignment operator for double.
+    DualNumber& operator+=( const double other )
+    {
+        value_ += other;
+        return *this;
+    }
+
+    //! Subtraction-assignment operator for double.
+    DualNumber& operator-=( const double other )
+    {
+        value_ -= other;
+        return *this;
+    }
+
+    //! Multiplication-assignment operator for double.
+    DualNumber& operator*=( const double other )
+    {
+        value_ *= other;
+        derivatives_ *= other;
+        return *this;
+    }
+
+    //! Division-assignment operator for double.
+    DualNumber& operator/=( const double other )
+    {
+        value_ /= other;
+        derivatives_ /= other;
+        return *this;
+    }
+
+    //! Unary minus operator.
+    DualNumber operator-( ) const
+    {
+        return DualNumber( -value_, -derivatives_ );
+    }
+
+    //! Unary plus operator.
+    DualNumber operator+( ) const
+    {
+        return *this;
+    }
+
+private:
+
+    //! Value of number.
+    double value_;
+
+    //! Derivatives of number w.r.t. independent variables.
+    DerivativeVector derivatives_;
+};
+
+//! Addition operator.
+template< int N >
+DualNumber< N > operator+( DualNumber< N > first, const DualNumber< N >& second ){ return first += second; }
+
+//! Addition operator (dual, double).
+template< int N >
+DualNumber< N > operator+( DualNumber< N > first, const double second ){ return first += second; }
+
+//! Addition operator (double, dual).
+template< int N >
+DualNumber< N > operator+( const double first, DualNumber< N > second ){ return second += first; }
+
+//! Subtraction operator.
+template< int N >
+DualNumber< N > operator-( DualNumber< N > first, const DualNumber< N >& second ){ return first -= second; }
+
+//! Subtraction operator (dual, double).
+template< int N >
+DualNumber< N > operator-( DualNumber< N > first, const double second ){ return first -= second; }
+
+//! Subtraction operator (double, dual).
+template< int N >
+DualNumber< N > operator-( const double first, const DualNumber< N >& second ){ return ( -second ) += first; }
+
+//! Multiplication operator.
+template< int N >
+DualNumber< N > operator*( DualNumber< N > first, const DualNumber< N >& second ){ return first *= second; }
+
+//! Multiplication operator (dual, double).
+template< int N >
+DualNumber< N > operator*( DualNumber< N > first, const double second ){ return first *= second; }
+
+//! Multiplication operator (double, dual).
+template< int N >
+DualNumber< N > operator*( const double first, DualNumber< N > second ){ return second *= first; }
+
+//! Division operator.
+template< int N >
+DualNumber< N > operator/( DualNumber< N > first, const DualNumber< N >& second ){ return first /= second; }
+
+//! Division operator (dual, double).
+template< int N >
+DualNumber< N > operator/( DualNumber< N > first, const double second ){ return first /= second; }
+
+//! Division operator (double, dual).
+template< int N >
+DualNumber< N > operator/( const double first, const DualNumber< N >& second )
+{
+    return DualNumber< N >( first / second.getValue( ),
+                            ( -first / ( second.getValue( ) * second.getValue( ) ) ) * second.getDerivatives( ) );
+}
+
+//! Comparison operators, acting on value only.
+template< int N > bool operator==( const DualNumber< N >& first, const DualNumber< N >& second )
+{ return first.getValue( ) == second.getValue( ); }
+template< int N > bool operator!=( const DualNumber< N >& first, const DualNumber< N >& second )
+{ return first.getValue( ) != second.getValue( ); }
+template< int N > bool operator<( const DualNumber< N >& first, const DualNumber< N >& second )
+{ return first.getValue( ) < second.getValue( ); }
+template< int N > bool operator>( const DualNumber< N >& first, const DualNumber< N >& second )
+{ return first.getValue( ) > second.getValue( ); }
+template< int N > bool operator<=( const DualNumber< N >& first, const DualNumber< N >& second )
+{ return first.getValue( ) <= second.getValue( ); }
+template< int N > bool operator>=( const DualNumber< N >& first, const DualNumber< N >& second )
+{ return first.getValue( ) >= second.getValue( ); }
+
+template< int N > bool operator==( const DualNumber< N >& first, const double second ){ return first.getValue( ) == second; }
+template< int N > bool operator!=( const DualNumber< N >& first, const double second ){ return first.getValue( ) != second; }
+template< int N > bool operator<( const DualNumber< N >& first, const double second ){ return first.getValue( ) < second; }
+template< int N > bool operator>( const DualNumber< N >& first, const double second ){ return first.getValue( ) > second; }
+template< int N > bool operator<=( const DualNumber< N >& first, const double second ){ return first.getValue( ) <= second; }
+template< int N > bool operator>=( const DualNumber< N >& first, const double second ){ return first.getValue( ) >= second; }
+
+template< int N > bool operator==( const double first, const DualNumber< N >& second ){ return first == second.getValue( ); }
+template< int N > bool operator!=( const double first, const DualNumber< N >& second ){ return first != second.getValue( ); }
+template< int N > bool operator<( const double first, const DualNumber< N >& second ){ return first < second.getValue( ); }
+template< int N > bool operator>( const double first, const DualNumber< N >& second ){ return first > second.getValue( ); }
+template< int N > bool operator<=( const double first, const DualNumber< N >& second ){ return first <= second.getValue( ); }
+template< int N > bool operator>=( const double first, const DualNumber< N >& second ){ return first >= second.getValue( ); }
+
+//! Function to apply a scalar function with known derivative to a dual number (chain rule).
+template< int N >
+DualNumber< N > applyChainRule( const DualNumber< N >& argument, const double functionValue, const double functionDerivative )
+{
+    return DualNumber< N >( functionValue, functionDerivative * argument.getDerivatives( ) );
+}
+
+//! Elementary functions for dual numbers (found by argument-dependent lookup, also from within Eigen).
+template< int N > DualNumber< N > sqrt( const DualNumber< N >& argument )
+{
+    double value = std::sqrt( argument.getValue( ) );
+    return applyChainRule( argument, value, 0.5 / value );
+}
+
+template< int N > DualNumber< N > cbrt( const DualNumber< N >& argument )
+{
+    double value = std::cbrt( argument.getValue( ) );
+    return applyChainRule( argument, value, 1.0 / ( 3.0 * value * value ) );
+}
+
+template< int N > DualNumber< N > exp( const DualNumber< N >& argument )
+{
+    double value = std::exp( argument.getValue( ) );
+    return applyChainRule( argument, value, value );
+}
+
+template< int N > DualNumber< N > log( const DualNumber< N >& argument )
+{
+    return applyChainRule( argument, std::log( argument.getValue( ) ), 1.0 / argument.getValue( ) );
+}
+
+template< int N > DualNumber< N > sin( const DualNumber< N >& argument )
+{
+    return applyChainRule( argument, std::sin( argument.getValue( ) ), std::cos( argument.getValue( ) ) );
+}
+
+template< int N > DualNumber< N > cos( const DualNumber< N >& argument )
+{
+    return applyChainRule( argument, std::cos( argument.getValue( ) ), -std::sin( argument.getValue( ) ) );
+}
+
+template< int N > DualNumber< N > tan( const DualNumber< N >& argument )
+{
+    double value = std::tan( argument.getValue( ) );
+    return applyChainRule( argument, value, 1.0 + value * value );
+}
+
+template< int N > DualNumber< N > asin( const DualNumber< N >& argument )
+{
+    return applyChainRule( argument, std::asin( argument.getValue( ) ),
+                           1.0 / std::sqrt( 1.0 - argument.getValue( ) * argument.getValue( ) ) );
+}
+
+template< int N > DualNumber< N > acos( const DualNumber< N >& argument )
+{
+    return applyChainRule( argument, std::acos( argument.getValue( ) ),
+                           -1.0 / std::sqrt( 1.0 - argument.getValue( ) * argument.getValue( ) ) );
+}
+
+template< int N > DualNumber< N > atan( const DualNumber< N >& argument )
+{
+    return applyChainRule( argument, std::atan( argument.getValue( ) ),
+                           1.0 / ( 1.0 + argument.getValue( ) * argument.getValue( ) ) );
+}
+
+template< int N > DualNumber< N > atan2( const DualNumber< N >& y, const DualNumber< N >& x )
+{
+    double denominator = x.getValue( ) * x.getValue( ) + y.getValue( ) * y.getValue( );
+    return DualNumber< N >( std::atan2( y.getValue( ), x.getValue( ) ),
+                            ( x.getValue( ) * y.getDerivatives( ) - y.getValue( ) * x.getDerivatives( ) ) / denominator );
+}
+
+template< int N > DualNumber< N > pow( const DualNumber< N >& base, const double exponent )
+{
+    double value = std::pow( base.getValue( ), exponent );
+    return applyChainRule( base, value, exponent * std::pow( base.getValue( ), exponent - 1.0 ) );
+}
+
+template< int N > DualNumber< N > pow( const DualNumber< N >& base, const DualNumber< N >& exponent )
+{
+    return exp( exponent * log( base ) );
+}
+
+template< int N > DualNumber< N > abs( const DualNumber< N >& argument )
+{
+    return ( argument.getValue( ) < 0.0 ) ? -argument : argument;
+}
+
+template< int N > DualNumber< N > fabs( const DualNumber< N >& argument )
+{
+    return abs( argument );
+}
+
+template< int N > bool isfinite( const DualNumber< N >& argument )
+{
+    return std::isfinite( argument.getValue( ) );
+}
+
+template< int N > bool isnan( const DualNumber< N >& argument )
+{
+    return std::isnan( argument.getValue( ) );
+}
+
+template< int N > bool isinf( const DualNumber< N >& argument )
+{
+    return std::isinf( argument.getValue( ) );
+}
+
+//! Function to create a vector of independent variables.
+/*!
+ *  Function to create a vector of independent variables, the i-th entry of which has unit derivative w.r.t. independent
+ *  variable startIndex + i.
+ *  \param values Values of independent variables.
+ *  \param startIndex Index in list of independent variables of first entry of vector.
+ *  \return Vector of independent variables.
+ */
+template< int NumberOfDerivatives, int NumberOfRows >
+Eigen::Matrix< DualNumber< NumberOfDerivatives >, NumberOfRows, 1 > createIndependentDualVector(
+        const Eigen::Matrix< double, NumberOfRows, 1 >& values, const int startIndex = 0 )
+{
+    Eigen::Matrix< DualNumber< NumberOfDerivatives >, NumberOfRows, 1 > independentVector( values.rows( ) );
+    for( int i = 0; i < values.rows( ); i++ )
+    {
+        independentVector( i ) = DualNumber< NumberOfDerivatives >::createIndependentVariable( values( i ), startIndex + i );
+    }
+    return independentVector;
+}
+
+//! Function to retrieve the values of a vector of dual numbers.
+template< int NumberOfDerivatives, int NumberOfRows >
+Eigen::Matrix< double, NumberOfRows, 1 > getDualVectorValues(
+        const Eigen::Matrix< DualNumber< NumberOfDerivatives >, NumberOfRows, 1 >& dualVector )
+{
+    Eigen::Matrix< double, NumberOfRows, 1 > values( dualVector.rows( ) );
+    for( int i = 0; i < dualVector.rows( ); i++ )
+    {
+        values( i ) = dualVector( i ).getValue( );
+    }
+    return values;
+}
+
+//! Function to retrieve the Jacobian of a vector of dual numbers w.r.t. the independent variables.
+template< int NumberOfDerivatives, int NumberOfRows >
+Eigen::Matrix< double, NumberOfRows, NumberOfDerivatives > getDualVectorJacobian(
+        const Eigen::Matrix< DualNumber< NumberOfDerivatives >, NumberOfRows, 1 >& dualVector )
+{
+    Eigen::Matrix< double, NumberOfRows, NumberOfDerivatives > jacobian( dualVector.rows( ), NumberOfDerivatives );
+    for( int i = 0; i < dualVector.rows( ); i++ )
+    {
+        jacobian.row( i ) = dualVector( i ).getDerivatives( ).transpose( );
+    }
+    return jacobian;
+}
+
+} // namespace basic_mathematics
+
+} // namespace tudat
+
+namespace Eigen
+{
+
+//! Numerical traits of dual number, required for its use as scalar type of Eigen matrices.
+template< int N >
+struct NumTraits< tudat::basic_mathematics::DualNumber< N > >: NumTraits< double >
+{
+    typedef tudat::basic_mathematics::DualNumber< N > Real;
+    typedef tudat::basic_mathematics::DualNumber< N > NonInteger;
+    typedef tudat::basic_mathematics::DualNumber< N > Nested;
+    typedef tudat::basic_mathematics::DualNumber< N > Literal;
+
+    enum
+    {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = N + 1,
+        AddCost = N + 1,
+        MulCost = 2 * N + 1
+    };
+};
+
+//! Traits allowing binary operations between matrices of dual numbers and doubles.
+template< int N, typename BinaryOp >
+struct ScalarBinaryOpTraits< tudat::basic_mathematics::DualNumber< N >, double, BinaryOp >
+{
+    typedef tudat::basic_mathematics::DualNumber< N > ReturnType;
+};
+
+//! Traits allowing binary operations between doubles and matrices of dual numbers.
+template< int N, typename BinaryOp >
+struct ScalarBinaryOpTraits< double, tudat::basic_mathematics::DualNumber< N >, BinaryOp >
+{
+    typedef tudat::basic_mathematics::DualNumber< N > ReturnType;
+};
+
+} // namespace Eigen
+
+#endif // TUDAT_DUALNUMBER_H
@@ -497,7 +497,8 @@ double computeGeodesyLegendrePolynomialSecondDerivative( const int degree,
  *     P_{ 1, 0 }( u ) = u \\
  *     P_{ 1, 1 }( u ) = \sqrt{ 1 - u^2 }
  * \f}
- * Calculation up to \f$ n = 1 \f$ and \f$ m = 1 \f$ is supported by this function.
+ * Calculation up to \f$ n = 4 \f$ and \f$ m = 4 \f$ is supported by this function. As for the recursive
+ * functions, the Condon-Shortley phase factor is not included.
  * \param degree Degree of requested Legendre polynomial.
  * \param order Order of requested Legendre polynomial.
  * \param polynomialParameter Free variable of requested Legendre polynomial.
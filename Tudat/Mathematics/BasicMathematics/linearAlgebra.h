@@ -199,6 +199,58 @@ bool doesMatrixHaveNanEntries( const Eigen::Matrix< StateScalarType, NumberOfRow
     return areNanEntriesPresent;
 }
 
+//! Function to perform a rank-one update of a lower-triangular Cholesky factor
+/*!
+ *  Function to perform a rank-one update of a lower-triangular Cholesky factor, such that the factor L of a matrix
+ *  \f$ P = L L^{T} \f$ is replaced by the factor of \f$ P + w v v^{T} \f$, without recomputing the full decomposition.
+ *  A negative weight results in a downdate, which fails if the updated matrix is not positive definite.
+ *  \param choleskyFactor Lower-triangular Cholesky factor, with non-negative diagonal entries (modified in place)
+ *  \param updateVector Vector v with which the factor is updated
+ *  \param updateWeight Weight w of the update (negative for a downdate)
+ *  \return True if the update was successful, false if the updated matrix is not positive definite (in which case
+ *  the contents of the Cholesky factor are undefined)
+ */
+template< typename ScalarType >
+bool updateCholeskyFactor( Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic >& choleskyFactor,
+                           const Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 >& updateVector,
+                           const ScalarType updateWeight )
+{
+    const int matrixSize = choleskyFactor.rows( );
+    const ScalarType updateSign = ( updateWeight < static_cast< ScalarType >( 0.0 ) ) ?
+                static_cast< ScalarType >( -1.0 ) : static_cast< ScalarType >( 1.0 );
+    Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > workVector =
+            std::sqrt( updateSign * updateWeight ) * updateVector;
+
+    for( int k = 0; k < matrixSize; k++ )
+    {
+        // Compute rotation that annihilates the current entry of the work vector
+        const ScalarType currentDiagonal = choleskyFactor( k, k );
+        const ScalarType squaredNewDiagonal = currentDiagonal * currentDiagonal +
+                updateSign * workVector( k ) * workVector( k );
+        if( !( squaredNewDiagonal > static_cast< ScalarType >( 0.0 ) ) ||
+                currentDiagonal == static_cast< ScalarType >( 0.0 ) )
+        {
+            return false;
+        }
+        const ScalarType newDiagonal = std::sqrt( squaredNewDiagonal );
+        const ScalarType cosine = newDiagonal / currentDiagonal;
+        const ScalarType sine = workVector( k ) / currentDiagonal;
+        choleskyFactor( k, k ) = newDiagonal;
+
+        // Apply rotation to remainder of column, and to work vector
+        if( k < matrixSize - 1 )
+        {
+            const int remainingSize = matrixSize - k - 1;
+            choleskyFactor.col( k ).tail( remainingSize ) =
+                    ( choleskyFactor.col( k ).tail( remainingSize ) +
+                      updateSign * sine * workVector.tail( remainingSize ) ) / cosine;
+            workVector.tail( remainingSize ) = cosine * workVector.tail( remainingSize ) -
+                    sine * choleskyFactor.col( k ).tail( remainingSize );
+        }
+    }
+    return true;
+}
+
 //! Function to compute the root mean square value of the entries in an Eigen vector
 /*!
  *  Function to compute the root mean square (RMS) value of the entries in an Eigen vector
@@ -0,0 +1,259 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <Eigen/SVD>
+
+#include "Tudat/Mathematics/BasicMathematics/sequentialNormalEquations.h"
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Constructor
+SequentialNormalEquations::SequentialNormalEquations(
+        const Eigen::VectorXd& linearizationPoint,
+        const Eigen::MatrixXd& inverseOfAprioriCovariance ):
+    numberOfParameters_( linearizationPoint.rows( ) ),
+    linearizationPoint_( linearizationPoint ),
+    numberOfProcessedObservations_( 0 )
+{
+    if( inverseOfAprioriCovariance.rows( ) == 0 )
+    {
+        normalMatrix_ = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+    }
+    else if( ( inverseOfAprioriCovariance.rows( ) != numberOfParameters_ ) ||
+             ( inverseOfAprioriCovariance.cols( ) != numberOfParameters_ ) )
+    {
+        throw std::runtime_error( "Error when creating sequential normal equations, a priori covariance size is inconsistent" );
+    }
+    else
+    {
+        normalMatrix_ = inverseOfAprioriCovariance;
+    }
+
+    rightHandSide_ = Eigen::VectorXd::Zero( numberOfParameters_ );
+    for( int i = 0; i < numberOfParameters_; i++ )
+    {
+        activeParameterIndices_.push_back( i );
+    }
+}
+
+//! Function to add a block of observations to the normal equations
+void SequentialNormalEquations::addObservations(
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& residuals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix )
+{
+    if( informationMatrix.cols( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of partials (" +
+                                  std::to_string( informationMatrix.cols( ) ) + ") is inconsistent with number of parameters (" +
+                                  std::to_string( numberOfParameters_ ) + ")" );
+    }
+
+    if( ( informationMatrix.rows( ) != residuals.rows( ) ) || ( informationMatrix.rows( ) != diagonalOfWeightMatrix.rows( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, number of observations is inconsistent" );
+    }
+
+    // Retrieve partials w.r.t. active parameters only
+    int numberOfActiveParameters = activeParameterIndices_.size( );
+    Eigen::MatrixXd activeInformationMatrix;
+    if( numberOfActiveParameters == numberOfParameters_ )
+    {
+        activeInformationMatrix = informationMatrix;
+    }
+    else
+    {
+        activeInformationMatrix.resize( informationMatrix.rows( ), numberOfActiveParameters );
+        for( int i = 0; i < numberOfActiveParameters; i++ )
+        {
+            activeInformationMatrix.col( i ) = informationMatrix.col( activeParameterIndices_.at( i ) );
+        }
+    }
+
+    // Add contribution of current observations
+    Eigen::MatrixXd weightedInformationMatrix = multiplyInformationMatrixByDiagonalWeightMatrix(
+                activeInformationMatrix, diagonalOfWeightMatrix );
+    normalMatrix_.noalias( ) += activeInformationMatrix.transpose( ) * weightedInformationMatrix;
+    rightHandSide_.noalias( ) += weightedInformationMatrix.transpose( ) * residuals;
+
+    numberOfProcessedObservations_ += informationMatrix.rows( );
+}
+
+//! Function to change the point at which the normal equations are linearized
+void SequentialNormalEquations::setLinearizationPoint( const Eigen::VectorXd& newLinearizationPoint )
+{
+    if( newLinearizationPoint.rows( ) != numberOfParameters_ )
+    {
+        throw std::runtime_error( "Error when resetting linearization point of normal equations, size is inconsistent" );
+    }
+
+    Eigen::VectorXd activeParameterChange = Eigen::VectorXd( activeParameterIndices_.size( ) );
+    for( unsigned int i = 0; i < activeParameterIndices_.size( ); i++ )
+    {
+        int parameterIndex = activeParameterIndices_.at( i );
+        activeParameterChange( i ) = newLinearizationPoint( parameterIndex ) - linearizationPoint_( parameterIndex );
+        linearizationPoint_( parameterIndex ) = newLinearizationPoint( parameterIndex );
+    }
+    rightHandSide_.noalias( ) -= normalMatrix_ * activeParameterChange;
+}
+
+//! Function to eliminate parameters from the normal equations, by means of a Schur complement
+void SequentialNormalEquations::eliminateParameters( const std::vector< int >& parameterIndices )
+{
+    // Determine indices (in active parameter list) of parameters to retain and to eliminate
+    std::vector< int > retainedIndices, eliminatedIndices;
+    for( unsigned int i = 0; i < activeParameterIndices_.size( ); i++ )
+    {
+        if( std::find( parameterIndices.begin( ), parameterIndices.end( ), activeParameterIndices_.at( i ) ) !=
+                parameterIndices.end( ) )
+        {
+            eliminatedIndices.push_back( i );
+        }
+        else
+        {
+            retainedIndices.push_back( i );
+        }
+    }
+
+    if( eliminatedIndices.size( ) != parameterIndices.size( ) )
+    {
+        throw std::runtime_error( "Error when eliminating parameters from normal equations, parameter is not active" );
+    }
+
+    if( eliminatedIndices.size( ) == 0 )
+    {
+        return;
+    }
+
+    // Partition normal equations
+    int numberOfRetainedParameters = retainedIndices.size( );
+    int numberOfEliminatedParameters = eliminatedIndices.size( );
+
+    Eigen::MatrixXd retainedBlock( numberOfRetainedParameters, numberOfRetainedParameters );
+    Eigen::MatrixXd crossBlock( numberOfEliminatedParameters, numberOfRetainedParameters );
+    Eigen::MatrixXd eliminatedBlock( numberOfEliminatedParameters, numberOfEliminatedParameters );
+    Eigen::VectorXd retainedRightHandSide( numberOfRetainedParameters );
+    Eigen::VectorXd eliminatedRightHandSide( numberOfEliminatedParameters );
+
+    for( int i = 0; i < numberOfRetainedParameters; i++ )
+    {
+        retainedRightHandSide( i ) = rightHandSide_( retainedIndices.at( i ) );
+        for( int j = 0; j < numberOfRetainedParameters; j++ )
+        {
+            retainedBlock( i, j ) = normalMatrix_( retainedIndices.at( i ), retainedIndices.at( j ) );
+        }
+        for( int j = 0; j < numberOfEliminatedParameters; j++ )
+        {
+            crossBlock( j, i ) = normalMatrix_( eliminatedIndices.at( j ), retainedIndices.at( i ) );
+        }
+    }
+    for( int i = 0; i < numberOfEliminatedParameters; i++ )
+    {
+        eliminatedRightHandSide( i ) = rightHandSide_( eliminatedIndices.at( i ) );
+        for( int j = 0; j < numberOfEliminatedParameters; j++ )
+        {
+            eliminatedBlock( i, j ) = normalMatrix_( eliminatedIndices.at( i ), eliminatedIndices.at( j ) );
+        }
+    }
+
+    // Compute Schur complement (SVD used to allow unobserved eliminated parameters)
+    Eigen::JacobiSVD< Eigen::MatrixXd > eliminatedBlockDecomposition =
+            eliminatedBlock.jacobiSvd( Eigen::ComputeThinU | Eigen::ComputeThinV );
+    Eigen::MatrixXd reducedCrossBlock = eliminatedBlockDecomposition.solve( crossBlock );
+    Eigen::VectorXd reducedEliminatedRightHandSide = eliminatedBlockDecomposition.solve( eliminatedRightHandSide );
+
+    normalMatrix_ = retainedBlock - crossBlock.transpose( ) * reducedCrossBlock;
+    rightHandSide_ = retainedRightHandSide - crossBlock.transpose( ) * reducedEliminatedRightHandSide;
+
+    std::vector< int > newActiveParameterIndices;
+    for( int i = 0; i < numberOfRetainedParameters; i++ )
+    {
+        newActiveParameterIndices.push_back( activeParameterIndices_.at( retainedIndices.at( i ) ) );
+    }
+    activeParameterIndices_ = newActiveParameterIndices;
+}
+
+//! Function to solve the normal equations for the correction to the current linearization point
+Eigen::VectorXd SequentialNormalEquations::getParameterCorrection(
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber ) const
+{
+    // Select constrained parameters, and scale system by square root of diagonal.
+    std::vector< int > constrainedIndices;
+    for( unsigned int i = 0; i < activeParameterIndices_.size( ); i++ )
+    {
+        if( normalMatrix_( i, i ) > 0.0 )
+        {
+            constrainedIndices.push_back( i );
+        }
+    }
+
+    int numberOfConstrainedParameters = constrainedIndices.size( );
+    Eigen::VectorXd scalingTerms( numberOfConstrainedParameters );
+    for( int i = 0; i < numberOfConstrainedParameters; i++ )
+    {
+        scalingTerms( i ) = std::sqrt( normalMatrix_( constrainedIndices.at( i ), constrainedIndices.at( i ) ) );
+    }
+
+    Eigen::MatrixXd scaledNormalMatrix( numberOfConstrainedParameters, numberOfConstrainedParameters );
+    Eigen::VectorXd scaledRightHandSide( numberOfConstrainedParameters );
+    for( int i = 0; i < numberOfConstrainedParameters; i++ )
+    {
+        scaledRightHandSide( i ) = rightHandSide_( constrainedIndices.at( i ) ) / scalingTerms( i );
+        for( int j = 0; j < numberOfConstrainedParameters; j++ )
+        {
+            scaledNormalMatrix( i, j ) = normalMatrix_( constrainedIndices.at( i ), constrainedIndices.at( j ) ) /
+                    ( scalingTerms( i ) * scalingTerms( j ) );
+        }
+    }
+
+    // Solve scaled system, and map to full parameter vector
+    Eigen::VectorXd parameterCorrection = Eigen::VectorXd::Zero( numberOfParameters_ );
+    if( numberOfConstrainedParameters > 0 )
+    {
+        Eigen::VectorXd scaledCorrection = solveSystemOfEquationsWithSvd(
+                    scaledNormalMatrix, scaledRightHandSide, checkConditionNumber, maximumAllowedConditionNumber );
+        for( int i = 0; i < numberOfConstrainedParameters; i++ )
+        {
+            parameterCorrection( activeParameterIndices_.at( constrainedIndices.at( i ) ) ) =
+                    scaledCorrection( i ) / scalingTerms( i );
+        }
+    }
+    return parameterCorrection;
+}
+
+//! Function to retrieve the normal matrix for the full parameter vector
+Eigen::MatrixXd SequentialNormalEquations::getFullNormalMatrix( ) const
+{
+    Eigen::MatrixXd fullNormalMatrix = Eigen::MatrixXd::Zero( numberOfParameters_, numberOfParameters_ );
+    for( unsigned int i = 0; i < activeParameterIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < activeParameterIndices_.size( ); j++ )
+        {
+            fullNormalMatrix( activeParameterIndices_.at( i ), activeParameterIndices_.at( j ) ) = normalMatrix_( i, j );
+        }
+    }
+    return fullNormalMatrix;
+}
+
+} // namespace linear_algebra
+
+} // namespace tudat
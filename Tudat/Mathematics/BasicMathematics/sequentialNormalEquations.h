@@ -0,0 +1,179 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Montenbruck O., Gill E. Satellite Orbits: Models, Methods and Applications. Springer, 2000.
+ *
+ */
+
+#ifndef TUDAT_SEQUENTIALNORMALEQUATIONS_H
+#define TUDAT_SEQUENTIALNORMALEQUATIONS_H
+
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace linear_algebra
+{
+
+//! Class to accumulate the normal equations of a least squares problem, as observations are added sequentially.
+/*!
+ *  Class to accumulate the normal equations N * dx = b of a (linearized) least squares problem, with N = A^T W A + P^-1 and
+ *  b = A^T W r (with A the information matrix, W the diagonal weight matrix, r the residuals and P the a priori
+ *  covariance), as blocks of observations are added sequentially. The cost of adding a block of observations is
+ *  proportional to its number of rows, so that previously processed observations need not be reprocessed.
+ *  The normal equations are referenced to a linearization point (the parameter values at which the residuals were
+ *  computed); moving this point updates the right-hand side to first order (b -> b - N * delta), so that observations
+ *  processed at different linearization points can be combined. Parameters that are no longer observed (e.g. initial
+ *  states of expired arcs) may be eliminated from the system by a Schur complement, after which the normal equations
+ *  constrain only the remaining (active) parameters. Eliminated parameters keep the values they had at elimination.
+ */
+class SequentialNormalEquations
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor, initializes normal equations with a priori information only.
+     * \param linearizationPoint Initial parameter values, at which the a priori estimate is taken
+     * \param inverseOfAprioriCovariance Inverse of a priori covariance matrix (zero/no a priori information if empty).
+     */
+    SequentialNormalEquations( const Eigen::VectorXd& linearizationPoint,
+                               const Eigen::MatrixXd& inverseOfAprioriCovariance = Eigen::MatrixXd::Zero( 0, 0 ) );
+
+    //! Function to add a block of observations to the normal equations
+    /*!
+     * Function to add a block of observations to the normal equations. The residuals and partials must have been computed
+     * at the current linearization point. The partials w.r.t. eliminated parameters are ignored, and must be zero
+     * for the observations to be processed consistently.
+     * \param informationMatrix Partials of observations w.r.t. full (incl. eliminated) parameter vector
+     * \param residuals Observation residuals (observed minus computed)
+     * \param diagonalOfWeightMatrix Observation weights
+     */
+    void addObservations( const Eigen::MatrixXd& informationMatrix,
+                          const Eigen::VectorXd& residuals,
+                          const Eigen::VectorXd& diagonalOfWeightMatrix );
+
+    //! Function to change the point at which the normal equations are linearized
+    /*!
+     * Function to change the point at which the normal equations are linearized, updating the right-hand side of the
+     * equations accordingly. Entries of the new linearization point for eliminated parameters are ignored.
+     * \param newLinearizationPoint New linearization point (full parameter vector).
+     */
+    void setLinearizationPoint( const Eigen::VectorXd& newLinearizationPoint );
+
+    //! Function to eliminate parameters from the normal equations, by means of a Schur complement
+    /*!
+     * Function to eliminate parameters from the normal equations, by means of a Schur complement:
+     * N_kk -> N_kk - N_ke N_ee^-1 N_ek and b_k -> b_k - N_ke N_ee^-1 b_e (with k and e the retained and eliminated
+     * parameters, respectively). The information that the processed observations contain on the retained
+     * parameters is preserved, while the size of the system is reduced.
+     * \param parameterIndices Indices (in full parameter vector) of parameters that are to be eliminated.
+     */
+    void eliminateParameters( const std::vector< int >& parameterIndices );
+
+    //! Function to solve the normal equations for the correction to the current linearization point
+    /*!
+     * Function to solve the normal equations for the correction to the current linearization point. The system is scaled
+     * by the square root of its diagonal before being solved by SVD. Active parameters that are not constrained by
+     * observations or a priori information (zero diagonal entry) receive no correction, as do eliminated parameters.
+     * \param checkConditionNumber Boolean denoting whether the condition number of the (scaled) system is to be checked
+     * \param maximumAllowedConditionNumber Condition number above which a warning is printed.
+     * \return Correction to the linearization point (full parameter vector)
+     */
+    Eigen::VectorXd getParameterCorrection( const bool checkConditionNumber = true,
+                                            const double maximumAllowedConditionNumber = 1.0E8 ) const;
+
+    //! Function to retrieve the normal matrix for the full parameter vector
+    /*!
+     * Function to retrieve the normal matrix (inverse of the unnormalized covariance matrix) for the full parameter
+     * vector, with zero rows/columns for eliminated parameters.
+     * \return Normal matrix for the full parameter vector
+     */
+    Eigen::MatrixXd getFullNormalMatrix( ) const;
+
+    //! Function to retrieve the normal matrix for the active parameters
+    /*!
+     * Function to retrieve the normal matrix for the active parameters
+     * \return Normal matrix for the active parameters (in order of getActiveParameterIndices)
+     */
+    Eigen::MatrixXd getNormalMatrix( ) const
+    {
+        return normalMatrix_;
+    }
+
+    //! Function to retrieve the right-hand side of the normal equations for the active parameters
+    /*!
+     * Function to retrieve the right-hand side of the normal equations for the active parameters
+     * \return Right-hand side of the normal equations for the active parameters (in order of getActiveParameterIndices)
+     */
+    Eigen::VectorXd getRightHandSide( ) const
+    {
+        return rightHandSide_;
+    }
+
+    //! Function to retrieve the current linearization point
+    /*!
+     * Function to retrieve the current linearization point
+     * \return Current linearization point (full parameter vector)
+     */
+    Eigen::VectorXd getLinearizationPoint( ) const
+    {
+        return linearizationPoint_;
+    }
+
+    //! Function to retrieve the indices (in full parameter vector) of the active (non-eliminated) parameters
+    /*!
+     * Function to retrieve the indices (in full parameter vector) of the active (non-eliminated) parameters
+     * \return Indices of active parameters
+     */
+    std::vector< int > getActiveParameterIndices( ) const
+    {
+        return activeParameterIndices_;
+    }
+
+    //! Function to retrieve the total number of observations that have been added to the normal equations
+    /*!
+     * Function to retrieve the total number of observations that have been added to the normal equations
+     * \return Total number of observations that have been added to the normal equations
+     */
+    int getNumberOfProcessedObservations( ) const
+    {
+        return numberOfProcessedObservations_;
+    }
+
+private:
+
+    //! Size of full parameter vector (including eliminated parameters)
+    int numberOfParameters_;
+
+    //! Indices (in full parameter vector) of the active (non-eliminated) parameters
+    std::vector< int > activeParameterIndices_;
+
+    //! Normal matrix of the active parameters
+    Eigen::MatrixXd normalMatrix_;
+
+    //! Right-hand side of normal equations of the active parameters
+    Eigen::VectorXd rightHandSide_;
+
+    //! Current linearization point (full parameter vector)
+    Eigen::VectorXd linearizationPoint_;
+
+    //! Total number of observations that have been added to the normal equations
+    int numberOfProcessedObservations_;
+};
+
+} // namespace linear_algebra
+
+} // namespace tudat
+
+#endif // TUDAT_SEQUENTIALNORMALEQUATIONS_H
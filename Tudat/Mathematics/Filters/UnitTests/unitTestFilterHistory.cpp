@@ -0,0 +1,180 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+
+#include "Tudat/Mathematics/Filters/createFilter.h"
+#include "Tudat/Mathematics/Filters/filterHistory.h"
+#include "Tudat/Mathematics/Filters/linearKalmanFilter.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_filter_history )
+
+// Test storage of filter history with different history policies.
+BOOST_AUTO_TEST_CASE( testFilterHistoryPolicies )
+{
+    using namespace tudat::filters;
+
+    // Set up linear system (constant acceleration, with position measurements)
+    const double initialTime = 0.0;
+    const double timeStep = 0.1;
+    const unsigned int numberOfTimeSteps = 40;
+
+    Eigen::VectorXd initialEstimatedStateVector = Eigen::Vector3d( 1.0, 0.5, -0.2 );
+    Eigen::MatrixXd initialEstimatedStateCovarianceMatrix = Eigen::MatrixXd::Zero( 3, 3 );
+    initialEstimatedStateCovarianceMatrix << 1.0, 0.1, 0.05, 0.1, 2.0, 0.2, 0.05, 0.2, 3.0;
+
+    Eigen::MatrixXd stateTransitionMatrix = Eigen::MatrixXd::Identity( 3, 3 );
+    stateTransitionMatrix( 0, 1 ) = timeStep;
+    stateTransitionMatrix( 1, 2 ) = timeStep;
+    Eigen::MatrixXd controlMatrix = Eigen::MatrixXd::Zero( 3, 3 );
+    Eigen::MatrixXd measurementMatrix = Eigen::MatrixXd::Zero( 1, 3 );
+    measurementMatrix( 0, 0 ) = 1.0;
+
+    Eigen::MatrixXd systemUncertainty = 0.01 * Eigen::MatrixXd::Identity( 3, 3 );
+    Eigen::MatrixXd measurementUncertainty = Eigen::MatrixXd::Constant( 1, 1, 0.5 );
+
+    // Create filters with different history policies
+    const std::string historyFileName = input_output::getTudatRootPath( ) +
+            "/Mathematics/Filters/UnitTests/filterHistoryTest.dat";
+    std::vector< std::shared_ptr< FilterHistorySettings > > historySettings;
+    historySettings.push_back( std::make_shared< FilterHistorySettings >( keep_full_history ) );
+    historySettings.push_back( std::make_shared< FilterHistorySettings >( keep_last_history_entries, 5 ) );
+    historySettings.push_back( std::make_shared< FilterHistorySettings >( keep_decimated_history, 4 ) );
+    historySettings.push_back( std::make_shared< FilterHistorySettings >( stream_history_to_file, 0, historyFileName ) );
+
+    std::vector< KalmanFilterDoublePointer > linearFilters;
+    for ( unsigned int i = 0; i < historySettings.size( ); i++ )
+    {
+        linearFilters.push_back( std::make_shared< LinearKalmanFilterDouble >(
+                                     [ & ]( const double, const Eigen::VectorXd& ){ return stateTransitionMatrix; },
+                                     [ & ]( const double, const Eigen::VectorXd& ){ return controlMatrix; },
+                                     [ & ]( const double, const Eigen::VectorXd& ){ return measurementMatrix; },
+                                     systemUncertainty, measurementUncertainty, timeStep,
+                                     initialTime, initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix ) );
+        linearFilters.at( i )->setHistorySettings( historySettings.at( i ) );
+    }
+
+    // Run filters and check size of history in memory
+    for ( unsigned int i = 0; i < numberOfTimeSteps; i++ )
+    {
+        Eigen::VectorXd currentMeasurementVector = Eigen::VectorXd::Constant( 1, std::sin( 0.1 * i ) );
+        for ( unsigned int j = 0; j < linearFilters.size( ); j++ )
+        {
+            linearFilters.at( j )->updateFilter( currentMeasurementVector );
+            linearFilters.at( j )->produceSystemNoise( );
+        }
+
+        BOOST_CHECK_EQUAL( linearFilters.at( 0 )->getEstimatedStateHistory( ).size( ), i + 2 );
+        BOOST_CHECK_EQUAL( linearFilters.at( 1 )->getEstimatedStateHistory( ).size( ), std::min( i + 2, 5u ) );
+        BOOST_CHECK_EQUAL( linearFilters.at( 1 )->getEstimatedCovarianceHistory( ).size( ), std::min( i + 2, 5u ) );
+        BOOST_CHECK( linearFilters.at( 3 )->getEstimatedStateHistory( ).size( ) <= 2 );
+        BOOST_CHECK( linearFilters.at( 3 )->getEstimatedCovarianceHistory( ).size( ) <= 2 );
+    }
+    BOOST_CHECK_EQUAL( linearFilters.at( 0 )->getNoiseHistory( ).first.size( ), numberOfTimeSteps );
+    BOOST_CHECK_EQUAL( linearFilters.at( 1 )->getNoiseHistory( ).first.size( ), 5 );
+    BOOST_CHECK_EQUAL( linearFilters.at( 2 )->getNoiseHistory( ).first.size( ), 2 );
+
+    // Check that retained entries are identical to those of the full history
+    std::map< double, Eigen::VectorXd > fullStateHistory = linearFilters.at( 0 )->getEstimatedStateHistory( );
+    std::map< double, Eigen::MatrixXd > fullCovarianceHistory = linearFilters.at( 0 )->getEstimatedCovarianceHistory( );
+    for ( unsigned int j = 1; j < 3; j++ )
+    {
+        std::map< double, Eigen::VectorXd > stateHistory = linearFilters.at( j )->getEstimatedStateHistory( );
+        for ( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = stateHistory.begin( );
+              stateIterator != stateHistory.end( ); stateIterator++ )
+        {
+            BOOST_CHECK( stateIterator->second == fullStateHistory.at( stateIterator->first ) );
+            BOOST_CHECK( linearFilters.at( j )->getEstimatedCovarianceHistory( ).at( stateIterator->first ) ==
+                         fullCovarianceHistory.at( stateIterator->first ) );
+        }
+    }
+
+    // Check decimated history: every fourth entry, plus the two most recent entries
+    std::map< double, Eigen::VectorXd > decimatedStateHistory = linearFilters.at( 2 )->getEstimatedStateHistory( );
+    BOOST_CHECK_EQUAL( decimatedStateHistory.size( ), ( numberOfTimeSteps - 2 ) / 4 + 1 + 2 );
+    unsigned int entryIndex = 0;
+    for ( std::map< double, Eigen::MatrixXd >::const_iterator covarianceIterator = fullCovarianceHistory.begin( );
+          covarianceIterator != fullCovarianceHistory.end( ); covarianceIterator++, entryIndex++ )
+    {
+        bool isEntryExpected = ( entryIndex % 4 == 0 ) || ( entryIndex + 2 > numberOfTimeSteps );
+        BOOST_CHECK_EQUAL( decimatedStateHistory.count( covarianceIterator->first ), isEntryExpected );
+    }
+
+    // Check that the filters can revert a single step
+    const double finalTime = linearFilters.at( 0 )->getCurrentTime( );
+    for ( unsigned int j = 0; j < linearFilters.size( ); j++ )
+    {
+        linearFilters.at( j )->revertToPreviousTimeStep( finalTime );
+        BOOST_CHECK( linearFilters.at( j )->getCurrentStateEstimate( ) == std::next( fullStateHistory.rbegin( ) )->second );
+        linearFilters.at( j )->updateFilter( Eigen::VectorXd::Constant( 1, std::sin( 0.1 * ( numberOfTimeSteps - 1 ) ) ) );
+        BOOST_CHECK( linearFilters.at( j )->getCurrentStateEstimate( ) == fullStateHistory.rbegin( )->second );
+    }
+
+    // Check streamed history, after destroying filter (such that all entries are written)
+    linearFilters.pop_back( );
+    std::map< double, Eigen::VectorXd > streamedStateHistory;
+    std::map< double, Eigen::MatrixXd > streamedCovarianceHistory;
+    readFilterHistoryFromFile( historyFileName, streamedStateHistory, streamedCovarianceHistory );
+    BOOST_CHECK_EQUAL( streamedStateHistory.size( ), numberOfTimeSteps + 1 );
+    for ( std::map< double, Eigen::VectorXd >::const_iterator stateIterator = fullStateHistory.begin( );
+          stateIterator != fullStateHistory.end( ); stateIterator++ )
+    {
+        BOOST_CHECK( streamedStateHistory.at( stateIterator->first ) == stateIterator->second );
+        const Eigen::MatrixXd& fullCovariance = fullCovarianceHistory.at( stateIterator->first );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( streamedCovarianceHistory.at( stateIterator->first ),
+                                           Eigen::MatrixXd( 0.5 * ( fullCovariance + fullCovariance.transpose( ) ) ), 1.0e-14 );
+    }
+    std::remove( historyFileName.c_str( ) );
+
+    // Check history policy set through filter settings, including derived class-specific history
+    std::shared_ptr< UnscentedKalmanFilterSettings< > > unscentedFilterSettings =
+            std::make_shared< UnscentedKalmanFilterSettings< > >(
+                systemUncertainty, measurementUncertainty, timeStep, initialTime,
+                initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix );
+    unscentedFilterSettings->historySettings_ = historySettings.at( 1 );
+    std::shared_ptr< FilterBase< > > unscentedFilter = createFilter< double, double >(
+                unscentedFilterSettings,
+                [ & ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( stateTransitionMatrix * state ); },
+                [ & ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( measurementMatrix * state ); } );
+    for ( unsigned int i = 0; i < numberOfTimeSteps; i++ )
+    {
+        unscentedFilter->updateFilter( Eigen::VectorXd::Constant( 1, std::sin( 0.1 * i ) ) );
+    }
+    BOOST_CHECK_EQUAL( unscentedFilter->getEstimatedStateHistory( ).size( ), 5 );
+    BOOST_CHECK( std::dynamic_pointer_cast< UnscentedKalmanFilter< > >( unscentedFilter )->
+                 getHistoryOfSigmaPoints( ).size( ) <= 5 );
+
+    // Check that invalid settings are rejected
+    BOOST_CHECK_THROW( std::make_shared< FilterHistorySettings >( keep_last_history_entries, 1 ), std::runtime_error );
+    BOOST_CHECK_THROW( std::make_shared< FilterHistorySettings >( keep_decimated_history, 0 ), std::runtime_error );
+    BOOST_CHECK_THROW( std::make_shared< FilterHistorySettings >( stream_history_to_file ), std::runtime_error );
+    BOOST_CHECK_THROW( linearFilters.at( 0 )->setHistorySettings( nullptr ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,147 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/testMacros.h"
+
+#include "Tudat/Mathematics/Filters/createFilter.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_rauch_tung_striebel_smoother )
+
+// Test implementation of Rauch-Tung-Striebel smoother class.
+BOOST_AUTO_TEST_CASE( testRauchTungStriebelSmoother )
+{
+    using namespace tudat::filters;
+
+    // Set up linear system (constant acceleration, with position measurements)
+    const double initialTime = 0.0;
+    const double timeStep = 0.1;
+    const unsigned int numberOfTimeSteps = 40;
+
+    Eigen::VectorXd initialEstimatedStateVector = Eigen::Vector3d( 1.0, 0.5, -0.2 );
+    Eigen::MatrixXd initialEstimatedStateCovarianceMatrix = Eigen::MatrixXd::Zero( 3, 3 );
+    initialEstimatedStateCovarianceMatrix << 1.0, 0.1, 0.05, 0.1, 2.0, 0.2, 0.05, 0.2, 3.0;
+
+    Eigen::MatrixXd stateTransitionMatrix = Eigen::MatrixXd::Identity( 3, 3 );
+    stateTransitionMatrix( 0, 1 ) = timeStep;
+    stateTransitionMatrix( 1, 2 ) = timeStep;
+    Eigen::MatrixXd measurementMatrix = Eigen::MatrixXd::Zero( 1, 3 );
+    measurementMatrix( 0, 0 ) = 1.0;
+
+    Eigen::MatrixXd measurementUncertainty = Eigen::MatrixXd::Constant( 1, 1, 0.5 );
+
+    // Set system and measurement functions
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > systemFunction =
+            [ & ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( stateTransitionMatrix * state ); };
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > measurementFunction =
+            [ & ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( measurementMatrix * state ); };
+    std::function< Eigen::MatrixXd( const double, const Eigen::VectorXd& ) > stateJacobianFunction =
+            [ & ]( const double, const Eigen::VectorXd& ){ return stateTransitionMatrix; };
+    std::function< Eigen::MatrixXd( const double, const Eigen::VectorXd& ) > stateNoiseJacobianFunction =
+            [ & ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 3, 3 ); };
+    std::function< Eigen::MatrixXd( const double, const Eigen::VectorXd& ) > measurementJacobianFunction =
+            [ & ]( const double, const Eigen::VectorXd& ){ return measurementMatrix; };
+    std::function< Eigen::MatrixXd( const double, const Eigen::VectorXd& ) > measurementNoiseJacobianFunction =
+            [ & ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 1, 1 ); };
+
+    // Test both with and without system noise
+    for ( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        Eigen::MatrixXd systemUncertainty = ( testCase == 0 ) ? Eigen::MatrixXd( 0.01 * Eigen::MatrixXd::Identity( 3, 3 ) ) :
+                                                                Eigen::MatrixXd( Eigen::MatrixXd::Zero( 3, 3 ) );
+
+        // Create smoother
+        std::shared_ptr< FilterBase< > > smoother = createFilter< double, double >(
+                    std::make_shared< RauchTungStriebelSmootherSettings< > >(
+                        systemUncertainty, measurementUncertainty, timeStep, initialTime,
+                        initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix ),
+                    systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                    measurementJacobianFunction, measurementNoiseJacobianFunction );
+        RauchTungStriebelSmootherDoublePointer rauchTungStriebelSmoother =
+                std::dynamic_pointer_cast< RauchTungStriebelSmootherDouble >( smoother );
+
+        // Run forward pass and smooth estimates
+        for ( unsigned int i = 0; i < numberOfTimeSteps; i++ )
+        {
+            smoother->updateFilter( Eigen::VectorXd::Constant( 1, std::sin( 0.1 * i ) ) );
+        }
+        rauchTungStriebelSmoother->performSmoothing( );
+        std::map< double, Eigen::VectorXd > filteredStateHistory = smoother->getEstimatedStateHistory( );
+        std::map< double, Eigen::MatrixXd > filteredCovarianceHistory = smoother->getEstimatedCovarianceHistory( );
+        std::map< double, Eigen::VectorXd > smoothedStateHistory = rauchTungStriebelSmoother->getSmoothedStateHistory( );
+        std::map< double, Eigen::MatrixXd > smoothedCovarianceHistory = rauchTungStriebelSmoother->getSmoothedCovarianceHistory( );
+        BOOST_CHECK_EQUAL( smoothedStateHistory.size( ), numberOfTimeSteps + 1 );
+        BOOST_CHECK_EQUAL( smoothedCovarianceHistory.size( ), numberOfTimeSteps + 1 );
+
+        // Check that final smoothed estimates are equal to the filtered estimates
+        BOOST_CHECK( smoothedStateHistory.rbegin( )->second == filteredStateHistory.rbegin( )->second );
+        BOOST_CHECK( smoothedCovarianceHistory.rbegin( )->second == filteredCovarianceHistory.rbegin( )->second );
+
+        // Check that smoothing does not increase the variances
+        for ( std::map< double, Eigen::MatrixXd >::const_iterator covarianceIterator = smoothedCovarianceHistory.begin( );
+              covarianceIterator != smoothedCovarianceHistory.end( ); covarianceIterator++ )
+        {
+            const Eigen::MatrixXd& filteredCovariance = filteredCovarianceHistory.at( covarianceIterator->first );
+            for ( int i = 0; i < 3; i++ )
+            {
+                BOOST_CHECK( covarianceIterator->second( i, i ) <= filteredCovariance( i, i ) * ( 1.0 + 1.0e-12 ) );
+            }
+        }
+
+        // Without system noise, smoothed states must be the final estimate mapped back with the state transition matrix
+        if ( testCase == 1 )
+        {
+            Eigen::VectorXd expectedSmoothedState = filteredStateHistory.rbegin( )->second;
+            Eigen::MatrixXd expectedSmoothedCovariance = filteredCovarianceHistory.rbegin( )->second;
+            Eigen::MatrixXd inverseStateTransitionMatrix = stateTransitionMatrix.inverse( );
+            for ( std::map< double, Eigen::VectorXd >::const_reverse_iterator stateIterator = smoothedStateHistory.rbegin( );
+                  stateIterator != smoothedStateHistory.rend( ); stateIterator++ )
+            {
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( stateIterator->second, expectedSmoothedState, 1.0e-10 );
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION( smoothedCovarianceHistory.at( stateIterator->first ),
+                                                   expectedSmoothedCovariance, 1.0e-8 );
+                expectedSmoothedState = inverseStateTransitionMatrix * expectedSmoothedState;
+                expectedSmoothedCovariance = inverseStateTransitionMatrix * expectedSmoothedCovariance *
+                        inverseStateTransitionMatrix.transpose( );
+            }
+        }
+    }
+
+    // Check that smoothing is rejected if the full history is not available
+    std::shared_ptr< RauchTungStriebelSmootherSettings< > > smootherSettings =
+            std::make_shared< RauchTungStriebelSmootherSettings< > >(
+                Eigen::MatrixXd::Zero( 3, 3 ), measurementUncertainty, timeStep, initialTime,
+                initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix );
+    smootherSettings->historySettings_ = std::make_shared< FilterHistorySettings >( keep_last_history_entries, 5 );
+    RauchTungStriebelSmootherDoublePointer rauchTungStriebelSmoother =
+            std::dynamic_pointer_cast< RauchTungStriebelSmootherDouble >(
+                createFilter< double, double >( smootherSettings, systemFunction, measurementFunction, stateJacobianFunction,
+                                                stateNoiseJacobianFunction, measurementJacobianFunction,
+                                                measurementNoiseJacobianFunction ) );
+    rauchTungStriebelSmoother->updateFilter( Eigen::VectorXd::Zero( 1 ) );
+    BOOST_CHECK_THROW( rauchTungStriebelSmoother->performSmoothing( ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,126 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/testMacros.h"
+
+#include "Tudat/Mathematics/Filters/createFilter.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_square_root_information_filter )
+
+// Test that square-root information filter provides the same estimates as the extended Kalman filter for a linear system.
+BOOST_AUTO_TEST_CASE( testSquareRootInformationFilter )
+{
+    using namespace tudat::filters;
+
+    // Set up linear system (constant acceleration, with position and velocity measurements)
+    const double initialTime = 0.0;
+    const double timeStep = 0.1;
+    const unsigned int numberOfTimeSteps = 50;
+
+    Eigen::VectorXd initialEstimatedStateVector = Eigen::Vector3d( 1.0, 0.5, -0.2 );
+    Eigen::MatrixXd initialEstimatedStateCovarianceMatrix = Eigen::MatrixXd::Zero( 3, 3 );
+    initialEstimatedStateCovarianceMatrix << 1.0, 0.1, 0.05, 0.1, 2.0, 0.2, 0.05, 0.2, 3.0;
+
+    Eigen::MatrixXd stateTransitionMatrix = Eigen::MatrixXd::Identity( 3, 3 );
+    stateTransitionMatrix( 0, 1 ) = timeStep;
+    stateTransitionMatrix( 0, 2 ) = 0.5 * timeStep * timeStep;
+    stateTransitionMatrix( 1, 2 ) = timeStep;
+    Eigen::MatrixXd measurementMatrix = Eigen::MatrixXd::Zero( 2, 3 );
+    measurementMatrix( 0, 0 ) = 1.0;
+    measurementMatrix( 1, 1 ) = 1.0;
+
+    Eigen::MatrixXd measurementUncertainty = Eigen::MatrixXd::Zero( 2, 2 );
+    measurementUncertainty << 0.5, 0.1, 0.1, 0.2;
+
+    // Set system and measurement functions
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > systemFunction =
+            [ & ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( stateTransitionMatrix * state ); };
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > measurementFunction =
+            [ & ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( measurementMatrix * state ); };
+    std::function< Eigen::MatrixXd( const double, const Eigen::VectorXd& ) > stateJacobianFunction =
+            [ & ]( const double, const Eigen::VectorXd& ){ return stateTransitionMatrix; };
+    std::function< Eigen::MatrixXd( const double, const Eigen::VectorXd& ) > stateNoiseJacobianFunction =
+            [ & ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 3, 3 ); };
+    std::function< Eigen::MatrixXd( const double, const Eigen::VectorXd& ) > measurementJacobianFunction =
+            [ & ]( const double, const Eigen::VectorXd& ){ return measurementMatrix; };
+    std::function< Eigen::MatrixXd( const double, const Eigen::VectorXd& ) > measurementNoiseJacobianFunction =
+            [ & ]( const double, const Eigen::VectorXd& ){ return Eigen::MatrixXd::Identity( 2, 2 ); };
+
+    // Test both with and without system noise
+    for ( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        Eigen::MatrixXd systemUncertainty = ( testCase == 0 ) ? Eigen::MatrixXd( 0.01 * Eigen::MatrixXd::Identity( 3, 3 ) ) :
+                                                                Eigen::MatrixXd( Eigen::MatrixXd::Zero( 3, 3 ) );
+
+        // Create filters
+        std::shared_ptr< FilterBase< > > extendedFilter = createFilter< double, double >(
+                    std::make_shared< ExtendedKalmanFilterSettings< > >(
+                        systemUncertainty, measurementUncertainty, timeStep, initialTime,
+                        initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix ),
+                    systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                    measurementJacobianFunction, measurementNoiseJacobianFunction );
+        std::shared_ptr< FilterBase< > > squareRootFilter = createFilter< double, double >(
+                    std::make_shared< SquareRootInformationFilterSettings< > >(
+                        systemUncertainty, measurementUncertainty, timeStep, initialTime,
+                        initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix ),
+                    systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                    measurementJacobianFunction, measurementNoiseJacobianFunction );
+
+        // Run filters and compare estimates
+        for ( unsigned int i = 0; i < numberOfTimeSteps; i++ )
+        {
+            Eigen::VectorXd currentMeasurementVector = Eigen::Vector2d( std::sin( 0.1 * i ), std::cos( 0.3 * i ) );
+            extendedFilter->updateFilter( currentMeasurementVector );
+            squareRootFilter->updateFilter( currentMeasurementVector );
+
+            BOOST_CHECK_EQUAL( extendedFilter->getCurrentTime( ), squareRootFilter->getCurrentTime( ) );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( extendedFilter->getCurrentStateEstimate( ),
+                                               squareRootFilter->getCurrentStateEstimate( ), 1.0e-10 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION( extendedFilter->getCurrentCovarianceEstimate( ),
+                                               squareRootFilter->getCurrentCovarianceEstimate( ), 1.0e-10 );
+        }
+
+        // Check square-root information matrix
+        Eigen::MatrixXd squareRootInformationMatrix = std::dynamic_pointer_cast< SquareRootInformationFilterDouble >(
+                    squareRootFilter )->getCurrentSquareRootInformationMatrix( );
+        BOOST_CHECK( squareRootInformationMatrix.isUpperTriangular( ) );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::MatrixXd( squareRootInformationMatrix.transpose( ) *
+                                                            squareRootInformationMatrix ),
+                                           Eigen::MatrixXd( squareRootFilter->getCurrentCovarianceEstimate( ).inverse( ) ),
+                                           1.0e-10 );
+    }
+
+    // Check that an invalid measurement uncertainty is rejected
+    std::shared_ptr< FilterBase< > > squareRootFilter = createFilter< double, double >(
+                std::make_shared< SquareRootInformationFilterSettings< > >(
+                    Eigen::MatrixXd::Zero( 3, 3 ), Eigen::MatrixXd::Zero( 2, 2 ), timeStep, initialTime,
+                    initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix ),
+                systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                measurementJacobianFunction, measurementNoiseJacobianFunction );
+    BOOST_CHECK_THROW( squareRootFilter->updateFilter( Eigen::Vector2d::Zero( ) ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
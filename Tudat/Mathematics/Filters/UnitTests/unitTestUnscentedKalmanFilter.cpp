@@ -20,6 +20,7 @@
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 
 #include "Tudat/Mathematics/Statistics/basicStatistics.h"
+#include "Tudat/Mathematics/Filters/createFilter.h"
 #include "Tudat/Mathematics/Filters/unscentedKalmanFilter.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 
@@ -391,6 +392,162 @@ BOOST_AUTO_TEST_CASE( testUnscentedKalmanFilterThirdCase )
     }
 }
 
+// Test parallel propagation of sigma points and square-root formulation of unscented Kalman filter.
+BOOST_AUTO_TEST_CASE( testUnscentedKalmanFilterParallelAndSquareRoot )
+{
+    using namespace tudat::filters;
+
+    // Set initial conditions (as in third test case)
+    const double initialTime = 0.0;
+    const double timeStep = 0.1;
+    const unsigned int numberOfTimeSteps = 300;
+
+    Eigen::Vector3d initialStateVector;
+    initialStateVector << 200000.0, -6000.0, 500.0;
+    Eigen::Vector3d initialEstimatedStateVector;
+    initialEstimatedStateVector << 200025.0, -6150.0, 800.0;
+    Eigen::Matrix3d initialEstimatedStateCovarianceMatrix = Eigen::Matrix3d::Zero( );
+    initialEstimatedStateCovarianceMatrix.diagonal( ) << std::pow( 1000.0, 2 ), 20000.0, std::pow( 300.0, 2 );
+
+    Eigen::Matrix3d systemUncertainty = Eigen::Matrix3d::Zero( );
+    systemUncertainty.diagonal( ) << std::pow( 100.0, 2 ), std::pow( 10.0, 2 ), std::pow( 1.0, 2 );
+    Eigen::Vector1d measurementUncertainty = Eigen::Vector1d::Constant( std::pow( 25.0, 2 ) );
+
+    std::shared_ptr< numerical_integrators::IntegratorSettings< > > integratorSettings =
+            std::make_shared< numerical_integrators::IntegratorSettings< > > (
+                numerical_integrators::euler, initialTime, timeStep );
+
+    std::shared_ptr< ControlWrapper< double, double, 3 > > control =
+            std::make_shared< ControlWrapper< double, double, 3 > >(
+                [ & ]( const double, const Eigen::Vector3d& ){ return Eigen::Vector3d::Zero( ); } );
+
+    // Create filters with serial and parallel propagation of the sigma points
+    std::vector< UnscentedKalmanFilterDoublePointer > unscentedFilters;
+    for ( unsigned int numberOfThreads = 1; numberOfThreads <= 4; numberOfThreads *= 4 )
+    {
+        unscentedFilters.push_back( std::make_shared< UnscentedKalmanFilterDouble >(
+                                        std::bind( &stateFunction3, std::placeholders::_1, std::placeholders::_2,
+                                                   std::bind( &ControlWrapper< double, double, 3 >::getCurrentControlVector,
+                                                              control ) ),
+                                        std::bind( &measurementFunction3, std::placeholders::_1, std::placeholders::_2 ),
+                                        systemUncertainty, measurementUncertainty, timeStep,
+                                        initialTime, initialEstimatedStateVector, initialEstimatedStateCovarianceMatrix,
+                                        integratorSettings, reference_Wan_and_Van_der_Merwe,
+                                        std::make_pair( TUDAT_NAN, TUDAT_NAN ), numberOfThreads ) );
+    }
+    BOOST_CHECK_EQUAL( unscentedFilters.at( 1 )->getNumberOfThreads( ), 4 );
+
+    // Load noise from file
+    Eigen::MatrixXd systemNoise = input_output::readMatrixFromFile( tudat::input_output::getTudatRootPath( ) +
+                                                                    "/Mathematics/Filters/UnitTests/noiseData/ukfSystemNoise3.dat" );
+    Eigen::MatrixXd measurementNoise = input_output::readMatrixFromFile(
+                tudat::input_output::getTudatRootPath( ) + "/Mathematics/Filters/UnitTests/noiseData/ukfMeasurementNoise3.dat" );
+
+    // Loop over each time step
+    double currentTime = initialTime;
+    Eigen::Vector3d currentActualStateVector = initialStateVector;
+    for ( unsigned int i = 0; i < numberOfTimeSteps; i++ )
+    {
+        currentActualStateVector += ( stateFunction3( currentTime, currentActualStateVector, Eigen::Vector3d::Zero( ) ) +
+                                      systemNoise.col( i ) ) * timeStep;
+        Eigen::Vector1d currentMeasurementVector =
+                measurementFunction3( currentTime, currentActualStateVector ) + measurementNoise.col( i );
+
+        control->setCurrentControlVector( currentTime, unscentedFilters.at( 0 )->getCurrentStateEstimate( ) );
+        for ( unsigned int j = 0; j < unscentedFilters.size( ); j++ )
+        {
+            unscentedFilters.at( j )->updateFilter( currentMeasurementVector );
+        }
+        currentTime = unscentedFilters.at( 0 )->getCurrentTime( );
+
+        // Check that parallel propagation gives the same result as serial propagation
+        for ( int k = 0; k < 3; k++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( unscentedFilters.at( 1 )->getCurrentStateEstimate( )[ k ],
+                                        unscentedFilters.at( 0 )->getCurrentStateEstimate( )[ k ], 1.0e-14 );
+        }
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( unscentedFilters.at( 1 )->getCurrentCovarianceEstimate( ),
+                                           unscentedFilters.at( 0 )->getCurrentCovarianceEstimate( ), 1.0e-14 );
+    }
+
+    // Check that final state is as in third test case
+    Eigen::Vector3d expectedFinalState = Eigen::Vector3d::Zero( );
+    expectedFinalState << 25200.383066001908, -3334.8971957588378, 502.3444368942321;
+    for ( int i = 0; i < expectedFinalState.rows( ); i++ )
+    {
+        BOOST_CHECK_SMALL( unscentedFilters.at( 1 )->getCurrentStateEstimate( )[ i ] - expectedFinalState[ i ], 1.0e-10 );
+    }
+
+    // Check contiguous storage of sigma points
+    std::map< double, Eigen::MatrixXd > historyOfSigmaPoints = unscentedFilters.at( 1 )->getHistoryOfSigmaPoints( );
+    BOOST_CHECK_EQUAL( historyOfSigmaPoints.size( ), numberOfTimeSteps );
+    BOOST_CHECK_EQUAL( historyOfSigmaPoints.begin( )->second.rows( ), 7 );
+    BOOST_CHECK_EQUAL( historyOfSigmaPoints.begin( )->second.cols( ), 15 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( historyOfSigmaPoints.begin( )->second.block( 0, 0, 3, 1 ),
+                                       initialEstimatedStateVector, 1.0e-15 );
+
+    // Compare square-root and standard formulation for a system with uncorrelated components, for which the Cholesky factor
+    // and the matrix square-root of the covariance coincide (such that both formulations use the same sigma points). The
+    // filter is created from settings, and uses multiple threads
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > linearSystemFunction =
+            [ ]( const double, const Eigen::VectorXd& state )
+    {
+        return Eigen::VectorXd( Eigen::Vector2d( 0.99, 1.01 ).asDiagonal( ) * state );
+    };
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > linearMeasurementFunction =
+            [ ]( const double, const Eigen::VectorXd& state )
+    {
+        return state;
+    };
+
+    Eigen::MatrixXd linearSystemUncertainty = Eigen::Vector2d( 1.0E-4, 2.0E-4 ).asDiagonal( );
+    Eigen::MatrixXd linearMeasurementUncertainty = Eigen::Vector2d( 0.01, 0.02 ).asDiagonal( );
+    Eigen::VectorXd linearInitialState = Eigen::Vector2d( 0.5, -0.2 );
+    Eigen::MatrixXd linearInitialCovariance = Eigen::Vector2d( 1.0, 0.5 ).asDiagonal( );
+
+    std::vector< std::shared_ptr< FilterBase< > > > linearFilters;
+    for ( unsigned int useSquareRootFormulation = 0; useSquareRootFormulation < 2; useSquareRootFormulation++ )
+    {
+        linearFilters.push_back( createFilter< double, double >(
+                                     std::make_shared< UnscentedKalmanFilterSettings< > >(
+                                         linearSystemUncertainty, linearMeasurementUncertainty, timeStep, initialTime,
+                                         linearInitialState, linearInitialCovariance, nullptr,
+                                         reference_Wan_and_Van_der_Merwe, std::make_pair( TUDAT_NAN, TUDAT_NAN ),
+                                         2, useSquareRootFormulation == 1 ),
+                                     linearSystemFunction, linearMeasurementFunction ) );
+    }
+
+    for ( unsigned int i = 0; i < 100; i++ )
+    {
+        Eigen::VectorXd currentMeasurementVector = Eigen::Vector2d( std::sin( 0.1 * i ), std::cos( 0.1 * i ) );
+        for ( unsigned int j = 0; j < linearFilters.size( ); j++ )
+        {
+            linearFilters.at( j )->updateFilter( currentMeasurementVector );
+        }
+    }
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( linearFilters.at( 1 )->getCurrentStateEstimate( ),
+                                       linearFilters.at( 0 )->getCurrentStateEstimate( ), 1.0e-10 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( linearFilters.at( 1 )->getCurrentCovarianceEstimate( ).diagonal( ),
+                                       linearFilters.at( 0 )->getCurrentCovarianceEstimate( ).diagonal( ), 1.0e-10 );
+    BOOST_CHECK_SMALL( linearFilters.at( 1 )->getCurrentCovarianceEstimate( )( 0, 1 ), 1.0e-15 );
+
+    // Check that Cholesky factor is consistent with covariance, also after modification of the covariance
+    std::shared_ptr< UnscentedKalmanFilterDouble > squareRootFilter =
+            std::dynamic_pointer_cast< UnscentedKalmanFilterDouble >( linearFilters.at( 1 ) );
+    Eigen::MatrixXd covarianceSquareRoot = squareRootFilter->getCurrentCovarianceSquareRoot( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::MatrixXd( covarianceSquareRoot * covarianceSquareRoot.transpose( ) ),
+                                       squareRootFilter->getCurrentCovarianceEstimate( ), 1.0e-14 );
+    BOOST_CHECK_EQUAL( covarianceSquareRoot( 0, 1 ), 0.0 );
+
+    Eigen::MatrixXd modifiedCovariance = ( Eigen::MatrixXd( 2, 2 ) << 1.0, 0.1, 0.1, 0.5 ).finished( );
+    squareRootFilter->modifyCurrentStateAndCovarianceEstimates( linearInitialState, modifiedCovariance );
+    covarianceSquareRoot = squareRootFilter->getCurrentCovarianceSquareRoot( );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( Eigen::MatrixXd( covarianceSquareRoot * covarianceSquareRoot.transpose( ) ),
+                                       modifiedCovariance, 1.0e-14 );
+    BOOST_CHECK_THROW( std::dynamic_pointer_cast< UnscentedKalmanFilterDouble >( linearFilters.at( 0 ) )->
+                       getCurrentCovarianceSquareRoot( ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
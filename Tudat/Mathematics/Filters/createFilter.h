@@ -22,6 +22,8 @@
 
 #include "Tudat/Mathematics/Filters/extendedKalmanFilter.h"
 #include "Tudat/Mathematics/Filters/linearKalmanFilter.h"
+#include "Tudat/Mathematics/Filters/rauchTungStriebelSmoother.h"
+#include "Tudat/Mathematics/Filters/squareRootInformationFilter.h"
 #include "Tudat/Mathematics/Filters/unscentedKalmanFilter.h"
 
 namespace tudat
@@ -35,7 +37,9 @@ enum AvailableFilteringTechniques
 {
     linear_kalman_filter = 0,
     extended_kalman_filter = 1,
-    unscented_kalman_filter = 2
+    unscented_kalman_filter = 2,
+    square_root_information_filter = 3,
+    rauch_tung_striebel_smoother = 4
 };
 
 //! Filter settings.
@@ -83,7 +87,7 @@ public:
         filteringTechnique_( filteringTechnique ), systemUncertainty_( systemUncertainty ),
         measurementUncertainty_( measurementUncertainty ), filteringStepSize_( filteringStepSize ), initialTime_( initialTime ),
         initialStateEstimate_( initialStateVector ), initialCovarianceEstimate_( initialCovarianceMatrix ),
-        integratorSettings_( integratorSettings )
+        integratorSettings_( integratorSettings ), historySettings_( nullptr )
     { }
 
     //! Default destructor.
@@ -127,6 +131,13 @@ public:
      */
     const std::shared_ptr< IntegratorSettings > integratorSettings_;
 
+    //! Pointer to the settings for the storage of the history of estimates.
+    /*!
+     *  Pointer to the settings for the storage of the history of estimates. This variable may be set after construction of the
+     *  filter settings, and is applied by the createFilter function. If it is a nullptr, the full history is kept in memory.
+     */
+    std::shared_ptr< FilterHistorySettings > historySettings_;
+
 };
 
 //! Extended Kalman filter settings.
@@ -174,6 +185,96 @@ public:
 
 };
 
+//! Square-root information filter settings.
+/*!
+ *  Square-root information filter settings.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class SquareRootInformationFilterSettings : public FilterSettings< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor. The state and measurement functions, and their respective Jacobian functions, are provided to
+     *  the createFilter function.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system. It is used as first
+     *      a-priori estimate of the state vector.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. It is used as first
+     *      a-priori estimate of the covariance matrix.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     */
+    SquareRootInformationFilterSettings( const DependentMatrix& systemUncertainty,
+                                         const DependentMatrix& measurementUncertainty,
+                                         const IndependentVariableType filteringStepSize,
+                                         const IndependentVariableType initialTime,
+                                         const DependentVector& initialStateVector,
+                                         const DependentMatrix& initialCovarianceMatrix,
+                                         const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr ) :
+        FilterSettings< IndependentVariableType, DependentVariableType >( square_root_information_filter,
+                                                                          systemUncertainty, measurementUncertainty,
+                                                                          filteringStepSize, initialTime, initialStateVector,
+                                                                          initialCovarianceMatrix, integratorSettings )
+    { }
+
+};
+
+//! Rauch-Tung-Striebel smoother settings.
+/*!
+ *  Rauch-Tung-Striebel smoother settings.
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class RauchTungStriebelSmootherSettings : public FilterSettings< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename FilterSettings< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor. The state and measurement functions, and their respective Jacobian functions, are provided to
+     *  the createFilter function.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system. It is used as first
+     *      a-priori estimate of the state vector.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. It is used as first
+     *      a-priori estimate of the covariance matrix.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     */
+    RauchTungStriebelSmootherSettings( const DependentMatrix& systemUncertainty,
+                                       const DependentMatrix& measurementUncertainty,
+                                       const IndependentVariableType filteringStepSize,
+                                       const IndependentVariableType initialTime,
+                                       const DependentVector& initialStateVector,
+                                       const DependentMatrix& initialCovarianceMatrix,
+                                       const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr ) :
+        FilterSettings< IndependentVariableType, DependentVariableType >( rauch_tung_striebel_smoother,
+                                                                          systemUncertainty, measurementUncertainty,
+                                                                          filteringStepSize, initialTime, initialStateVector,
+                                                                          initialCovarianceMatrix, integratorSettings )
+    { }
+
+};
+
 //! Unscented Kalman filter settings.
 /*!
  *  Unscented Kalman filter settings.
@@ -207,6 +308,8 @@ public:
      *      variable has to be part of the ConstantParameterReferences enumeration (custom parameters are supported).
      *  \param customConstantParameters Values of the constant parameters \f$ \alpha \f$ and \f$ \kappa \f$, in case the custom_parameters
      *      enumeration is used in the previous field.
+     *  \param numberOfThreads Number of threads used for the propagation of the sigma points (0 for default number of threads).
+     *  \param useSquareRootFormulation Boolean denoting whether the square-root formulation of the filter is to be used.
      */
     UnscentedKalmanFilterSettings( const DependentMatrix& systemUncertainty,
                                    const DependentMatrix& measurementUncertainty,
@@ -218,12 +321,15 @@ public:
                                    const ConstantParameterReferences constantValueReference = reference_Wan_and_Van_der_Merwe,
                                    const std::pair< DependentVariableType, DependentVariableType > customConstantParameters =
             std::make_pair( static_cast< DependentVariableType >( TUDAT_NAN ),
-                            static_cast< DependentVariableType >( TUDAT_NAN ) ) ) :
+                            static_cast< DependentVariableType >( TUDAT_NAN ) ),
+                                   const unsigned int numberOfThreads = 1,
+                                   const bool useSquareRootFormulation = false ) :
         FilterSettings< IndependentVariableType, DependentVariableType >( unscented_kalman_filter,
                                                                           systemUncertainty, measurementUncertainty,
                                                                           filteringStepSize, initialTime, initialStateVector,
                                                                           initialCovarianceMatrix, integratorSettings ),
-        constantValueReference_( constantValueReference ), customConstantParameters_( customConstantParameters )
+        constantValueReference_( constantValueReference ), customConstantParameters_( customConstantParameters ),
+        numberOfThreads_( numberOfThreads ), useSquareRootFormulation_( useSquareRootFormulation )
     { }
 
     //! Enumeration denoting the reference to use for the alpha and kappa paramters.
@@ -232,6 +338,12 @@ public:
     //! Custom value of the alpha and kappa paramters.
     const std::pair< DependentVariableType, DependentVariableType > customConstantParameters_;
 
+    //! Number of threads used for the propagation of the sigma points (0 for default number of threads).
+    const unsigned int numberOfThreads_;
+
+    //! Boolean denoting whether the square-root formulation of the filter is to be used.
+    const bool useSquareRootFormulation_;
+
 };
 
 //! Function to create a filter object with the use of filter settings.
@@ -333,7 +445,76 @@ createFilter( const std::shared_ptr< FilterSettings< IndependentVariableType, De
                     unscentedKalmanFilterSettings->filteringStepSize_, unscentedKalmanFilterSettings->initialTime_,
                     unscentedKalmanFilterSettings->initialStateEstimate_, unscentedKalmanFilterSettings->initialCovarianceEstimate_,
                     unscentedKalmanFilterSettings->integratorSettings_, unscentedKalmanFilterSettings->constantValueReference_,
-                    unscentedKalmanFilterSettings->customConstantParameters_ );
+                    unscentedKalmanFilterSettings->customConstantParameters_,
+                    unscentedKalmanFilterSettings->numberOfThreads_,
+                    unscentedKalmanFilterSettings->useSquareRootFormulation_ );
+        break;
+    }
+    case square_root_information_filter:
+    {
+        // Cast filter settings to square-root information filter
+        std::shared_ptr< SquareRootInformationFilterSettings< IndependentVariableType, DependentVariableType > >
+                squareRootInformationFilterSettings = std::dynamic_pointer_cast<
+                SquareRootInformationFilterSettings< IndependentVariableType, DependentVariableType > >( filterSettings );
+        if ( squareRootInformationFilterSettings == nullptr )
+        {
+            throw std::runtime_error( "Error while creating square-root information filter object. Type of filter settings "
+                                      "(SquareRootInformationFilter) not compatible with selected filter (derived class of "
+                                      "FilterSettings must be SquareRootInformationFilterSettings for this type)." );
+        }
+
+        // Check that optional inputs are present
+        if ( ( stateJacobianFunction == nullptr ) || ( stateNoiseJacobianFunction == nullptr ) ||
+             ( measurementJacobianFunction == nullptr ) || ( measurementNoiseJacobianFunction == nullptr ) )
+        {
+            throw std::runtime_error( "Error while creating square-root information filter object. A SquareRootInformationFilter "
+                                      "object requires the input of the four Jacobian functions for state and measurement "
+                                      "(including noise)." );
+        }
+
+        // Create filter
+        createdFilter = std::make_shared< SquareRootInformationFilter< IndependentVariableType, DependentVariableType > >(
+                    systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                    measurementJacobianFunction, measurementNoiseJacobianFunction,
+                    squareRootInformationFilterSettings->systemUncertainty_,
+                    squareRootInformationFilterSettings->measurementUncertainty_,
+                    squareRootInformationFilterSettings->filteringStepSize_, squareRootInformationFilterSettings->initialTime_,
+                    squareRootInformationFilterSettings->initialStateEstimate_,
+                    squareRootInformationFilterSettings->initialCovarianceEstimate_,
+                    squareRootInformationFilterSettings->integratorSettings_ );
+        break;
+    }
+    case rauch_tung_striebel_smoother:
+    {
+        // Cast filter settings to Rauch-Tung-Striebel smoother
+        std::shared_ptr< RauchTungStriebelSmootherSettings< IndependentVariableType, DependentVariableType > >
+                rauchTungStriebelSmootherSettings = std::dynamic_pointer_cast<
+                RauchTungStriebelSmootherSettings< IndependentVariableType, DependentVariableType > >( filterSettings );
+        if ( rauchTungStriebelSmootherSettings == nullptr )
+        {
+            throw std::runtime_error( "Error while creating Rauch-Tung-Striebel smoother object. Type of filter settings "
+                                      "(RauchTungStriebelSmoother) not compatible with selected filter (derived class of "
+                                      "FilterSettings must be RauchTungStriebelSmootherSettings for this type)." );
+        }
+
+        // Check that optional inputs are present
+        if ( ( stateJacobianFunction == nullptr ) || ( stateNoiseJacobianFunction == nullptr ) ||
+             ( measurementJacobianFunction == nullptr ) || ( measurementNoiseJacobianFunction == nullptr ) )
+        {
+            throw std::runtime_error( "Error while creating Rauch-Tung-Striebel smoother object. A RauchTungStriebelSmoother "
+                                      "object requires the input of the four Jacobian functions for state and measurement "
+                                      "(including noise)." );
+        }
+
+        // Create filter
+        createdFilter = std::make_shared< RauchTungStriebelSmoother< IndependentVariableType, DependentVariableType > >(
+                    systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+                    measurementJacobianFunction, measurementNoiseJacobianFunction,
+                    rauchTungStriebelSmootherSettings->systemUncertainty_, rauchTungStriebelSmootherSettings->measurementUncertainty_,
+                    rauchTungStriebelSmootherSettings->filteringStepSize_, rauchTungStriebelSmootherSettings->initialTime_,
+                    rauchTungStriebelSmootherSettings->initialStateEstimate_,
+                    rauchTungStriebelSmootherSettings->initialCovarianceEstimate_,
+                    rauchTungStriebelSmootherSettings->integratorSettings_ );
         break;
     }
     default:
@@ -346,6 +527,12 @@ createFilter( const std::shared_ptr< FilterSettings< IndependentVariableType, De
         throw std::runtime_error( "Error while creating filter. The resulting filter pointer is null." );
     }
 
+    // Set history policy
+    if ( filterSettings->historySettings_ != nullptr )
+    {
+        createdFilter->setHistorySettings( filterSettings->historySettings_ );
+    }
+
     // Give output
     return createdFilter;
 }
@@ -107,20 +107,10 @@ public:
     {
         // Prediction step
         DependentVector aPrioriStateEstimate = this->predictState( );
-        DependentMatrix currentStateJacobianMatrix;
-        DependentMatrix currentStateNoiseJacobianMatrix;
-        if ( this->isStateToBeIntegrated_ )
-        {
-            std::pair< DependentMatrix, DependentMatrix > discreteTimeJacobians =
-                    discreteTimeStateJacobians_( aPrioriStateEstimate );
-            currentStateJacobianMatrix = discreteTimeJacobians.first;
-            currentStateNoiseJacobianMatrix = discreteTimeJacobians.second;
-        }
-        else
-        {
-            currentStateJacobianMatrix = stateJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
-            currentStateNoiseJacobianMatrix = stateNoiseJacobianFunction_( this->currentTime_, aPrioriStateEstimate );
-        }
+        std::pair< DependentMatrix, DependentMatrix > currentStateJacobianMatrices =
+                computeDiscreteTimeStateJacobians( aPrioriStateEstimate );
+        DependentMatrix currentStateJacobianMatrix = currentStateJacobianMatrices.first;
+        DependentMatrix currentStateNoiseJacobianMatrix = currentStateJacobianMatrices.second;
         DependentVector measurementEstimate = this->measurementFunction_( this->currentTime_, aPrioriStateEstimate );
 
         // Compute remaining Jacobians
@@ -140,10 +130,58 @@ public:
 
         // Correction step
         this->currentTime_ += this->filteringStepSize_;
+        storePredictionStep( aPrioriStateEstimate, aPrioriCovarianceEstimate, currentStateJacobianMatrix );
         this->correctState( aPrioriStateEstimate, currentMeasurementVector, measurementEstimate, kalmanGain );
         this->correctCovariance( aPrioriCovarianceEstimate, currentMeasurementJacobianMatrix, kalmanGain );
     }
 
+protected:
+
+    //! Function to compute the discrete-time Jacobians of the system w.r.t. the state and the state noise.
+    /*!
+     *  Function to compute the discrete-time Jacobians of the system w.r.t. the state and the state noise. If the state is
+     *  integrated, the continuous-time Jacobians are converted to discrete-time, otherwise the Jacobian functions input by the
+     *  user are used directly.
+     *  \param currentStateVector Vector representing the state at which the Jacobians are to be evaluated.
+     *  \return Pair of discrete-time state and noise Jacobians.
+     */
+    std::pair< DependentMatrix, DependentMatrix > computeDiscreteTimeStateJacobians( const DependentVector& currentStateVector )
+    {
+        if ( this->isStateToBeIntegrated_ )
+        {
+            return discreteTimeStateJacobians_( currentStateVector );
+        }
+        else
+        {
+            return std::make_pair( stateJacobianFunction_( this->currentTime_, currentStateVector ),
+                                   stateNoiseJacobianFunction_( this->currentTime_, currentStateVector ) );
+        }
+    }
+
+    //! Function to store the results of the prediction step, for use by derived classes.
+    /*!
+     *  Function to store the results of the prediction step, called at each update of the filter after the current time has been
+     *  moved to the new time step, and before the correction step. This function can be overwritten in a derived class (e.g., by
+     *  a smoother, which requires the a-priori estimates).
+     *  \param aPrioriStateEstimate Vector denoting the a-priori state estimate.
+     *  \param aPrioriCovarianceEstimate Matrix denoting the a-priori covariance estimate.
+     *  \param stateJacobianMatrix Matrix denoting the discrete-time state Jacobian used for the prediction step.
+     */
+    virtual void storePredictionStep( const DependentVector& aPrioriStateEstimate,
+                                      const DependentMatrix& aPrioriCovarianceEstimate,
+                                      const DependentMatrix& stateJacobianMatrix )
+    {
+        TUDAT_UNUSED_PARAMETER( aPrioriStateEstimate );
+        TUDAT_UNUSED_PARAMETER( aPrioriCovarianceEstimate );
+        TUDAT_UNUSED_PARAMETER( stateJacobianMatrix );
+    }
+
+    //! Function to retrieve the measurement Jacobian matrix function.
+    MatrixFunction getMeasurementJacobianFunction( ) { return measurementJacobianFunction_; }
+
+    //! Function to retrieve the measurement noise Jacobian matrix function.
+    MatrixFunction getMeasurementNoiseJacobianFunction( ) { return measurementNoiseJacobianFunction_; }
+
 private:
 
     //! Function to create the function that defines the system model.
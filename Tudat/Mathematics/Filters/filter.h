@@ -21,10 +21,12 @@
 #include <Eigen/LU>
 #include <unsupported/Eigen/MatrixFunctions>
 
+#include <deque>
 #include <memory>
 #include <functional>
 
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/Filters/filterHistory.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/Statistics/randomVariableGenerator.h"
 
@@ -127,12 +129,43 @@ public:
         identityMatrix_ = DependentMatrix::Identity( systemUncertainty_.rows( ), systemUncertainty_.cols( ) );
 
         // Add initial values to history
+        historySettings_ = std::make_shared< FilterHistorySettings >( );
+        numberOfHistoryEntries_ = 0;
         historyOfStateEstimates_[ initialTime ] = aPosterioriStateEstimate_;
-        historyOfCovarianceEstimates_[ initialTime ] = aPosterioriCovarianceEstimate_;
+        storeCovarianceEstimateInHistory( );
     }
 
     //! Destructor.
-    virtual ~FilterBase( ){ }
+    /*!
+     *  Destructor. If the history is streamed to a file, the estimates that are still stored in memory are written to the
+     *  file as well. Since exceptions may not propagate out of the destructor, a failure to write these estimates results
+     *  in a warning only.
+     */
+    virtual ~FilterBase( )
+    {
+        if ( historyFileWriter_ != nullptr )
+        {
+            try
+            {
+                for ( typename std::map< IndependentVariableType, DependentMatrix >::const_iterator covarianceIterator =
+                      historyOfCovarianceEstimates_.begin( ); covarianceIterator != historyOfCovarianceEstimates_.end( );
+                      covarianceIterator++ )
+                {
+                    if ( historyOfStateEstimates_.count( covarianceIterator->first ) != 0 )
+                    {
+                        historyFileWriter_->writeEstimate( covarianceIterator->first,
+                                                           historyOfStateEstimates_.at( covarianceIterator->first ),
+                                                           covarianceIterator->second );
+                    }
+                }
+            }
+            catch ( const std::exception& caughtException )
+            {
+                std::cerr << "Warning in filter. Could not write remaining estimates to history file: "
+                          << caughtException.what( ) << std::endl;
+            }
+        }
+    }
 
     //! Function to update the filter with the data from the new time step.
     /*!
@@ -165,6 +198,7 @@ public:
 
         // Give back noise
         systemNoiseHistory_.push_back( systemNoise );
+        limitNoiseHistory( systemNoiseHistory_ );
         return systemNoise;
     }
 
@@ -191,6 +225,7 @@ public:
 
         // Give back noise
         measurementNoiseHistory_.push_back( measurementNoise );
+        limitNoiseHistory( measurementNoiseHistory_ );
         return measurementNoise;
     }
 
@@ -249,6 +284,50 @@ public:
         return std::make_pair( systemNoiseHistory_, measurementNoiseHistory_ );
     }
 
+    //! Function to set the policy for the storage of the history of estimates.
+    /*!
+     *  Function to set the policy for the storage of the history of estimates (see FilterHistorySettings). The policy is
+     *  immediately applied to the history stored so far. If the history is to be streamed to a file, the file is (re-)created.
+     *  \param historySettings Settings for the storage of the history of estimates (may not be a nullptr).
+     */
+    void setHistorySettings( const std::shared_ptr< FilterHistorySettings > historySettings )
+    {
+        if ( historySettings == nullptr )
+        {
+            throw std::runtime_error( "Error in filter. No history settings provided; to store the full history, use "
+                                      "the keep_full_history policy." );
+        }
+        historySettings_ = historySettings;
+
+        // Create file writer, if needed
+        historyFileWriter_ = nullptr;
+        if ( historySettings_->historyPolicy_ == stream_history_to_file )
+        {
+            historyFileWriter_ = std::make_shared< FilterHistoryFileWriter< IndependentVariableType, DependentVariableType > >(
+                        historySettings_->historyFileName_, aPosterioriStateEstimate_.rows( ) );
+        }
+
+        // Apply policy to current history
+        std::vector< IndependentVariableType > historyTimes;
+        for ( typename std::map< IndependentVariableType, DependentMatrix >::const_iterator covarianceIterator =
+              historyOfCovarianceEstimates_.begin( ); covarianceIterator != historyOfCovarianceEstimates_.end( );
+              covarianceIterator++ )
+        {
+            historyTimes.push_back( covarianceIterator->first );
+        }
+        recentHistoryEntries_.clear( );
+        numberOfHistoryEntries_ = 0;
+        for ( unsigned int i = 0; i < historyTimes.size( ); i++ )
+        {
+            processNewHistoryEntry( historyTimes.at( i ) );
+        }
+        limitNoiseHistory( systemNoiseHistory_ );
+        limitNoiseHistory( measurementNoiseHistory_ );
+    }
+
+    //! Function to retrieve the settings for the storage of the history of estimates.
+    std::shared_ptr< FilterHistorySettings > getHistorySettings( ) { return historySettings_; }
+
     //! Function to modify the step size for filtering.
     /*!
      *  Function to modify the step size for filtering, without interrupting the filtering process.
@@ -296,18 +375,25 @@ public:
     {
         historyOfStateEstimates_.clear( );
         historyOfCovarianceEstimates_.clear( );
+        recentHistoryEntries_.clear( );
         clearSpecificFilterHistory( );
     }
 
     //! Function to revert to the previous time step.
     /*!
-     *  Function to revert to the previous time step.
+     *  Function to revert to the previous time step. Note that, unless the full history is kept in memory, only a single
+     *  step can be reverted (see FilterHistorySettings).
      *  \param timeToBeRemoved Double denoting the current time, i.e., the instant that has to be discarded.
      */
     void revertToPreviousTimeStep( const double timeToBeRemoved )
     {
         // Revert to previous time
         currentTime_ -= filteringStepSize_;
+        if ( !recentHistoryEntries_.empty( ) && recentHistoryEntries_.back( ).first == timeToBeRemoved )
+        {
+            recentHistoryEntries_.pop_back( );
+            numberOfHistoryEntries_--;
+        }
 
         // Erase state estimate corresponding to current time
         if ( historyOfStateEstimates_.count( timeToBeRemoved ) != 0 )
@@ -339,6 +425,47 @@ public:
 
 protected:
 
+    //! Function to create a numerical integrator for propagation of the state.
+    /*!
+     *  Function to create a numerical integrator for propagation of the state, based on the integrator settings provided
+     *  by the user, and using the input function as differential equation. Next to the integrator_ used by the filter itself,
+     *  this function can be used by derived classes to create additional integrators (e.g., one for each thread).
+     *  \param differentialEquation Function to be used as the differential equation of the integrator.
+     *  \return Pointer to the integrator.
+     */
+    std::shared_ptr< Integrator > createFilterIntegrator( const Function& differentialEquation )
+    {
+        // Check that integration time-step matches filtering time-step
+        if ( filteringStepSize_ != integratorSettings_->initialTimeStep_ )
+        {
+            throw std::runtime_error( "Error while setting up filter. The filtering and integration step sizes do not match." );
+        }
+
+        // Generate integrator
+        std::shared_ptr< Integrator > integrator;
+        switch ( integratorSettings_->integratorType_ )
+        {
+        case numerical_integrators::euler:
+        case numerical_integrators::rungeKutta4:
+        {
+            integrator = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
+                        differentialEquation, aPosterioriStateEstimate_, integratorSettings_ );
+            break;
+        }
+        case numerical_integrators::rungeKuttaVariableStepSize:
+        {
+            // Create integrator object and turn off step-size control
+            integrator = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
+                        differentialEquation, aPosterioriStateEstimate_, integratorSettings_ );
+            integrator->setStepSizeControl( false );
+            break;
+        }
+        default:
+            throw std::runtime_error( "Error in setting up filter. Only Euler and Runge-Kutta integrators are supported." );
+        }
+        return integrator;
+    }
+
     //! Function to create the function that defines the system model.
     /*!
      *  Function to create the function that defines the system model. The output of this function is then bound
@@ -385,6 +512,18 @@ protected:
         historyOfStateEstimates_[ currentTime_ ] = aPosterioriStateEstimate_;
     }
 
+    //! Function to store the current covariance estimate in the history.
+    /*!
+     *  Function to store the current covariance estimate in the history, after which the history policy is applied. Since the
+     *  covariance is corrected after the state, this function is to be called by the derived classes once both estimates for
+     *  the current time have been computed.
+     */
+    void storeCovarianceEstimateInHistory( )
+    {
+        historyOfCovarianceEstimates_[ currentTime_ ] = aPosterioriCovarianceEstimate_;
+        processNewHistoryEntry( currentTime_ );
+    }
+
     //! Function to correct the covariance for the next time step.
     /*!
      *  Function to predict the state for the next time step, by overwriting previous state, with the either the use of
@@ -408,6 +547,17 @@ protected:
      */
     virtual void specificRevertToPreviousTimeStep( const double timeToBeRemoved ) { TUDAT_UNUSED_PARAMETER( timeToBeRemoved ); }
 
+    //! Function to remove an entry from the history of derived class-specific variables.
+    /*!
+     *  Function to remove an entry from the history of derived class-specific variables, called when the estimates at the same
+     *  time are removed from memory due to the history policy. This function can be overwritten in a derived class.
+     *  \param timeToBeRemoved Time of the entry that is to be removed.
+     */
+    virtual void removeSpecificHistoryEntry( const IndependentVariableType timeToBeRemoved )
+    {
+        TUDAT_UNUSED_PARAMETER( timeToBeRemoved );
+    }
+
     //! System function.
     /*!
      *  System function that will be used to retrieve the a-priori estimated state for the next step.
@@ -453,6 +603,9 @@ protected:
     //! Boolean specifying whether the state needs to be integrated.
     bool isStateToBeIntegrated_;
 
+    //! Pointer to the integrator settings (nullptr if the state is not integrated).
+    std::shared_ptr< IntegratorSettings > integratorSettings_;
+
     //! Pointer to the integrator.
     /*!
      *  Pointer to the integrator, which is used to propagate the state to the new time step.
@@ -471,8 +624,106 @@ protected:
     //! Map of estimated covariance matrices history.
     std::map< IndependentVariableType, DependentMatrix > historyOfCovarianceEstimates_;
 
+    //! Settings for the storage of the history of estimates.
+    std::shared_ptr< FilterHistorySettings > historySettings_;
+
+    //! Object to write the history of estimates to a file (nullptr if history is not streamed).
+    std::shared_ptr< FilterHistoryFileWriter< IndependentVariableType, DependentVariableType > > historyFileWriter_;
+
+    //! Times and indices of the (at most two) most recent history entries, which are always kept in memory.
+    std::deque< std::pair< IndependentVariableType, unsigned int > > recentHistoryEntries_;
+
+    //! Number of history entries processed so far (used for decimation).
+    unsigned int numberOfHistoryEntries_;
+
 private:
 
+    //! Function to apply the history policy after a new entry has been added to the history.
+    /*!
+     *  Function to apply the history policy after a new entry has been added to the history. The two most recent entries are
+     *  always kept in memory. Older entries are removed (for keep_last_history_entries), removed unless their index is a multiple
+     *  of the decimation factor (for keep_decimated_history), or written to file and removed (for stream_history_to_file).
+     *  \param newEntryTime Time of the entry that has been added.
+     */
+    void processNewHistoryEntry( const IndependentVariableType newEntryTime )
+    {
+        recentHistoryEntries_.push_back( std::make_pair( newEntryTime, numberOfHistoryEntries_++ ) );
+        if ( recentHistoryEntries_.size( ) <= 2 )
+        {
+            return;
+        }
+
+        // Process entry that is no longer among the most recent entries
+        std::pair< IndependentVariableType, unsigned int > oldestEntry = recentHistoryEntries_.front( );
+        recentHistoryEntries_.pop_front( );
+        switch ( historySettings_->historyPolicy_ )
+        {
+        case keep_full_history:
+            break;
+        case keep_last_history_entries:
+        {
+            while ( historyOfCovarianceEstimates_.size( ) > historySettings_->historyPolicyParameter_ )
+            {
+                removeHistoryEntry( historyOfCovarianceEstimates_.begin( )->first );
+            }
+            break;
+        }
+        case keep_decimated_history:
+        {
+            if ( oldestEntry.second % historySettings_->historyPolicyParameter_ != 0 )
+            {
+                removeHistoryEntry( oldestEntry.first );
+            }
+            break;
+        }
+        case stream_history_to_file:
+        {
+            if ( historyOfStateEstimates_.count( oldestEntry.first ) != 0 &&
+                 historyOfCovarianceEstimates_.count( oldestEntry.first ) != 0 )
+            {
+                historyFileWriter_->writeEstimate( oldestEntry.first, historyOfStateEstimates_.at( oldestEntry.first ),
+                                                   historyOfCovarianceEstimates_.at( oldestEntry.first ) );
+            }
+            removeHistoryEntry( oldestEntry.first );
+            break;
+        }
+        default:
+            throw std::runtime_error( "Error in filter. History policy not recognized." );
+        }
+    }
+
+    //! Function to remove the estimates at a given time from the history.
+    /*!
+     *  Function to remove the estimates at a given time from the history, including the derived class-specific variables.
+     *  \param timeToBeRemoved Time of the entry that is to be removed.
+     */
+    void removeHistoryEntry( const IndependentVariableType timeToBeRemoved )
+    {
+        historyOfStateEstimates_.erase( timeToBeRemoved );
+        historyOfCovarianceEstimates_.erase( timeToBeRemoved );
+        removeSpecificHistoryEntry( timeToBeRemoved );
+    }
+
+    //! Function to limit the size of a history of noise vectors, according to the history policy.
+    /*!
+     *  Function to limit the size of a history of noise vectors, according to the history policy. The full history is kept only
+     *  for the keep_full_history policy. For keep_last_history_entries, the same number of noise vectors as estimates is kept,
+     *  whereas only the two most recent noise vectors are kept for the other policies.
+     *  \param noiseHistory History of noise vectors (modified in place).
+     */
+    void limitNoiseHistory( std::vector< DependentVector >& noiseHistory )
+    {
+        if ( historySettings_->historyPolicy_ != keep_full_history )
+        {
+            const unsigned int maximumHistorySize = ( historySettings_->historyPolicy_ == keep_last_history_entries ) ?
+                        historySettings_->historyPolicyParameter_ : 2;
+            if ( noiseHistory.size( ) > maximumHistorySize )
+            {
+                noiseHistory.erase( noiseHistory.begin( ), noiseHistory.end( ) - maximumHistorySize );
+            }
+        }
+    }
+
     //! Function to generate the noise distributions for both system and measurement modeling.
     /*!
      *  Function to generate the noise distributions for both system and measurement modeling, which uses
@@ -527,39 +778,16 @@ private:
      */
     void generateNumericalIntegrator( const std::shared_ptr< IntegratorSettings > integratorSettings )
     {
-        // Check that integration time-step matches filtering time-step
-        if ( filteringStepSize_ != integratorSettings->initialTimeStep_ )
-        {
-            throw std::runtime_error( "Error while setting up filter. The filtering and integration step sizes do not match." );
-        }
-
-        // Generate integrator
-        switch ( integratorSettings->integratorType_ )
-        {
-        case numerical_integrators::euler:
-        case numerical_integrators::rungeKutta4:
-        {
-            integrator_ = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
-                        systemFunction_, aPosterioriStateEstimate_, integratorSettings );
-            break;
-        }
-        case numerical_integrators::rungeKuttaVariableStepSize:
+        // Warn user of changes that will be made
+        if ( integratorSettings->integratorType_ == numerical_integrators::rungeKuttaVariableStepSize )
         {
-            // Warn user of changes that will be made
             std::cerr << "Warning in setting up filter. Integrator requested is variable step-size, but only constant "
                          "step-size integrators are supported. Step-size control will be turned off." << std::endl;
-
-            // Create integrator object
-            integrator_ = numerical_integrators::createIntegrator< IndependentVariableType, DependentVector >(
-                        systemFunction_, aPosterioriStateEstimate_, integratorSettings );
-
-            // Turn off step-size control
-            integrator_->setStepSizeControl( false );
-            break;
-        }
-        default:
-            throw std::runtime_error( "Error in setting up filter. Only Euler and Runge-Kutta integrators are supported." );
         }
+
+        // Generate integrator
+        integratorSettings_ = integratorSettings;
+        integrator_ = createFilterIntegrator( systemFunction_ );
     }
 
     //! Vector where the system noise generators are stored.
@@ -0,0 +1,280 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_FILTER_HISTORY_H
+#define TUDAT_FILTER_HISTORY_H
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! Enumeration of available policies for the storage of the history of filter estimates.
+enum FilterHistoryPolicy
+{
+    keep_full_history = 0,
+    keep_last_history_entries = 1,
+    keep_decimated_history = 2,
+    stream_history_to_file = 3
+};
+
+//! Class defining how the history of state and covariance estimates of a filter is stored.
+/*!
+ *  Class defining how the history of state and covariance estimates of a filter is stored. By default, all estimates are kept
+ *  in memory, which makes the memory use of the filter grow without bound for long runs. Alternatively, only the last N
+ *  estimates can be kept, only every N-th estimate can be kept, or all estimates can be written to a binary file as soon as
+ *  they are no longer needed in memory (see FilterHistoryFileWriter for the file format). For all policies, the two most recent
+ *  estimates are kept in memory, such that the filter can revert to the previous time step.
+ */
+class FilterHistorySettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param historyPolicy Policy to be used for the storage of the history of estimates.
+     *  \param historyPolicyParameter Number of estimates that is to be kept (for keep_last_history_entries, at least 2), or
+     *      decimation factor (for keep_decimated_history, at least 1). Not used for other policies.
+     *  \param historyFileName Name of the binary file to which the estimates are written (for stream_history_to_file).
+     */
+    FilterHistorySettings( const FilterHistoryPolicy historyPolicy = keep_full_history,
+                           const unsigned int historyPolicyParameter = 0,
+                           const std::string& historyFileName = "" ):
+        historyPolicy_( historyPolicy ), historyPolicyParameter_( historyPolicyParameter ),
+        historyFileName_( historyFileName )
+    {
+        switch( historyPolicy_ )
+        {
+        case keep_full_history:
+            break;
+        case keep_last_history_entries:
+            if( historyPolicyParameter_ < 2 )
+            {
+                throw std::runtime_error( "Error in filter history settings. At least two estimates must be kept in memory." );
+            }
+            break;
+        case keep_decimated_history:
+            if( historyPolicyParameter_ < 1 )
+            {
+                throw std::runtime_error( "Error in filter history settings. The decimation factor must be at least 1." );
+            }
+            break;
+        case stream_history_to_file:
+            if( historyFileName_ == "" )
+            {
+                throw std::runtime_error( "Error in filter history settings. No file name provided to stream history to." );
+            }
+            break;
+        default:
+            throw std::runtime_error( "Error in filter history settings. Policy not recognized." );
+        }
+    }
+
+    //! Policy to be used for the storage of the history of estimates.
+    const FilterHistoryPolicy historyPolicy_;
+
+    //! Number of estimates that is to be kept, or decimation factor.
+    const unsigned int historyPolicyParameter_;
+
+    //! Name of the binary file to which the estimates are written.
+    const std::string historyFileName_;
+};
+
+//! Class to write the history of filter estimates to a binary file, one estimate at a time.
+/*!
+ *  Class to write the history of filter estimates to a binary file, one estimate at a time, such that the memory use does not
+ *  grow with the length of the history. The file starts with a header, consisting of the characters "TFH1", the size (in bytes)
+ *  of the independent and dependent variable types, and the state dimension (all as 32-bit unsigned integers). It is followed
+ *  by one record per estimate, consisting of the time, the state vector, and the upper triangle of the (symmetric) covariance
+ *  matrix, stored row by row. All values are written in the native binary representation of the machine.
+ *  \tparam IndependentVariableType Type of independent variable.
+ *  \tparam DependentVariableType Type of dependent variable.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class FilterHistoryFileWriter
+{
+public:
+
+    //! Typedef of the state vector.
+    typedef Eigen::Matrix< DependentVariableType, Eigen::Dynamic, 1 > DependentVector;
+
+    //! Typedef of the covariance matrix.
+    typedef Eigen::Matrix< DependentVariableType, Eigen::Dynamic, Eigen::Dynamic > DependentMatrix;
+
+    //! Constructor, opens the file and writes the header.
+    /*!
+     *  Constructor, opens the file (overwriting any existing file) and writes the header.
+     *  \param fileName Name of the file to which the estimates are written.
+     *  \param stateDimension Size of the state vector.
+     */
+    FilterHistoryFileWriter( const std::string& fileName, const unsigned int stateDimension ):
+        stateDimension_( stateDimension ), recordBuffer_( stateDimension * ( stateDimension + 3 ) / 2 )
+    {
+        fileStream_.open( fileName.c_str( ), std::ios::binary | std::ios::trunc );
+        if( !fileStream_.is_open( ) )
+        {
+            throw std::runtime_error( "Error when opening filter history file " + fileName + " for writing." );
+        }
+
+        fileStream_.write( "TFH1", 4 );
+        const uint32_t header[ 3 ] = { static_cast< uint32_t >( sizeof( IndependentVariableType ) ),
+                                       static_cast< uint32_t >( sizeof( DependentVariableType ) ),
+                                       static_cast< uint32_t >( stateDimension_ ) };
+        fileStream_.write( reinterpret_cast< const char* >( header ), sizeof( header ) );
+    }
+
+    //! Destructor, closes the file.
+    ~FilterHistoryFileWriter( )
+    {
+        fileStream_.close( );
+    }
+
+    //! Function to write a single estimate to the file.
+    /*!
+     *  Function to write a single estimate to the file.
+     *  \param time Time of the estimate.
+     *  \param stateEstimate State estimate.
+     *  \param covarianceEstimate Covariance estimate (only its upper triangle is written).
+     */
+    void writeEstimate( const IndependentVariableType time, const DependentVector& stateEstimate,
+                        const DependentMatrix& covarianceEstimate )
+    {
+        if( static_cast< unsigned int >( stateEstimate.rows( ) ) != stateDimension_ ||
+                static_cast< unsigned int >( covarianceEstimate.rows( ) ) != stateDimension_ ||
+                static_cast< unsigned int >( covarianceEstimate.cols( ) ) != stateDimension_ )
+        {
+            throw std::runtime_error( "Error when writing filter history to file, size of estimate is inconsistent with file." );
+        }
+
+        // Collect state and upper triangle of covariance in a single buffer
+        unsigned int bufferIndex = 0;
+        for( unsigned int i = 0; i < stateDimension_; i++ )
+        {
+            recordBuffer_[ bufferIndex++ ] = stateEstimate( i );
+        }
+        for( unsigned int i = 0; i < stateDimension_; i++ )
+        {
+            for( unsigned int j = i; j < stateDimension_; j++ )
+            {
+                recordBuffer_[ bufferIndex++ ] = covarianceEstimate( i, j );
+            }
+        }
+
+        fileStream_.write( reinterpret_cast< const char* >( &time ), sizeof( IndependentVariableType ) );
+        fileStream_.write( reinterpret_cast< const char* >( recordBuffer_.data( ) ),
+                           recordBuffer_.size( ) * sizeof( DependentVariableType ) );
+    }
+
+    //! Function to flush the data written so far to the file.
+    void flush( )
+    {
+        fileStream_.flush( );
+    }
+
+private:
+
+    //! Size of the state vector.
+    unsigned int stateDimension_;
+
+    //! Output file stream.
+    std::ofstream fileStream_;
+
+    //! Buffer in which a single record is collected before writing.
+    std::vector< DependentVariableType > recordBuffer_;
+};
+
+//! Function to read the history of filter estimates from a binary file.
+/*!
+ *  Function to read the history of filter estimates from a binary file, as written by the FilterHistoryFileWriter class.
+ *  \param fileName Name of the file from which the estimates are read.
+ *  \param stateHistory History of state estimates (returned by reference).
+ *  \param covarianceHistory History of covariance estimates (returned by reference).
+ *  \tparam IndependentVariableType Type of independent variable (must match the type used when writing the file).
+ *  \tparam DependentVariableType Type of dependent variable (must match the type used when writing the file).
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+void readFilterHistoryFromFile(
+        const std::string& fileName,
+        std::map< IndependentVariableType, Eigen::Matrix< DependentVariableType, Eigen::Dynamic, 1 > >& stateHistory,
+        std::map< IndependentVariableType, Eigen::Matrix< DependentVariableType, Eigen::Dynamic, Eigen::Dynamic > >&
+        covarianceHistory )
+{
+    std::ifstream fileStream( fileName.c_str( ), std::ios::binary );
+    if( !fileStream.is_open( ) )
+    {
+        throw std::runtime_error( "Error when opening filter history file " + fileName + " for reading." );
+    }
+
+    // Read and check header
+    char fileIdentifier[ 4 ];
+    uint32_t header[ 3 ];
+    fileStream.read( fileIdentifier, 4 );
+    fileStream.read( reinterpret_cast< char* >( header ), sizeof( header ) );
+    if( !fileStream || std::strncmp( fileIdentifier, "TFH1", 4 ) != 0 )
+    {
+        throw std::runtime_error( "Error when reading filter history file " + fileName + ", file format not recognized." );
+    }
+    if( header[ 0 ] != sizeof( IndependentVariableType ) || header[ 1 ] != sizeof( DependentVariableType ) )
+    {
+        throw std::runtime_error( "Error when reading filter history file " + fileName + ", variable types do not match." );
+    }
+    const unsigned int stateDimension = header[ 2 ];
+
+    // Read records until end of file
+    stateHistory.clear( );
+    covarianceHistory.clear( );
+    IndependentVariableType time;
+    std::vector< DependentVariableType > recordBuffer( stateDimension * ( stateDimension + 3 ) / 2 );
+    while( fileStream.read( reinterpret_cast< char* >( &time ), sizeof( IndependentVariableType ) ) )
+    {
+        if( !fileStream.read( reinterpret_cast< char* >( recordBuffer.data( ) ),
+                              recordBuffer.size( ) * sizeof( DependentVariableType ) ) )
+        {
+            throw std::runtime_error( "Error when reading filter history file " + fileName + ", last record is incomplete." );
+        }
+
+        Eigen::Matrix< DependentVariableType, Eigen::Dynamic, 1 > stateEstimate( stateDimension );
+        Eigen::Matrix< DependentVariableType, Eigen::Dynamic, Eigen::Dynamic > covarianceEstimate(
+                    stateDimension, stateDimension );
+        unsigned int bufferIndex = 0;
+        for( unsigned int i = 0; i < stateDimension; i++ )
+        {
+            stateEstimate( i ) = recordBuffer[ bufferIndex++ ];
+        }
+        for( unsigned int i = 0; i < stateDimension; i++ )
+        {
+            for( unsigned int j = i; j < stateDimension; j++ )
+            {
+                covarianceEstimate( i, j ) = recordBuffer[ bufferIndex ];
+                covarianceEstimate( j, i ) = recordBuffer[ bufferIndex++ ];
+            }
+        }
+        stateHistory[ time ] = stateEstimate;
+        covarianceHistory[ time ] = covarianceEstimate;
+    }
+}
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_FILTER_HISTORY_H
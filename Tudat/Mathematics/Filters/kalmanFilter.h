@@ -107,7 +107,7 @@ protected:
         this->aPosterioriCovarianceEstimate_ = ( this->identityMatrix_ - kalmanGain * currentMeasurementMatrix ) *
                 aPrioriCovarianceEstimate * ( this->identityMatrix_ - kalmanGain * currentMeasurementMatrix ).transpose( ) +
                 kalmanGain * this->measurementUncertainty_ * kalmanGain.transpose( );
-        this->historyOfCovarianceEstimates_[ this->currentTime_ ] = this->aPosterioriCovarianceEstimate_;
+        this->storeCovarianceEstimateInHistory( );
     }
 
 private:
@@ -0,0 +1,256 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Rauch, H.E., Tung, F., and Striebel, C.T., Maximum Likelihood Estimates of Linear Dynamic Systems, AIAA Journal,
+ *          Vol. 3, No. 8, 1965.
+ */
+
+#ifndef TUDAT_RAUCH_TUNG_STRIEBEL_SMOOTHER_H
+#define TUDAT_RAUCH_TUNG_STRIEBEL_SMOOTHER_H
+
+#include <Eigen/Cholesky>
+
+#include "Tudat/Mathematics/Filters/extendedKalmanFilter.h"
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! Rauch-Tung-Striebel smoother class.
+/*!
+ *  Class for the set up and use of the (extended) Rauch-Tung-Striebel (RTS) fixed-interval smoother. The forward pass is
+ *  identical to the ExtendedKalmanFilter class, with the addition that the a-priori state and covariance estimates and the state
+ *  Jacobians are stored at each time step. Once all measurements have been processed, the backward pass is run over the stored
+ *  history with the performSmoothing function, after which the smoothed estimates can be retrieved. Since the backward pass
+ *  requires all estimates, the smoother can only be used when the full history is kept in memory (see FilterHistorySettings).
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class RauchTungStriebelSmoother: public ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::Function Function;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::MatrixFunction MatrixFunction;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::Integrator Integrator;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor. This constructor takes state and measurement functions and their respective
+     *  Jacobian functions as inputs. These functions can be a function of time and state vector.
+     *  \param systemFunction Function returning the state as a function of time and state vector. Can be a differential
+     *      equation if the integratorSettings is set (i.e., if it is not a nullptr).
+     *  \param measurementFunction Function returning the measurement as a function of time and state.
+     *  \param stateJacobianFunction Function returning the Jacobian of the system w.r.t. the state. The input values can
+     *      be time and state vector.
+     *  \param stateNoiseJacobianFunction Function returning the Jacobian of the system function w.r.t. the system noise. The
+     *      input values can be time and state vector.
+     *  \param measurementJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the state. The input
+     *      values can be time and state vector.
+     *  \param measurementNoiseJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the measurement
+     *      noise. The input values can be time and state vector.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system. It is used as first
+     *      a-priori estimate of the state vector.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. It is used as first
+     *      a-priori estimate of the covariance matrix.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     */
+    RauchTungStriebelSmoother( const Function& systemFunction,
+                               const Function& measurementFunction,
+                               const MatrixFunction& stateJacobianFunction,
+                               const MatrixFunction& stateNoiseJacobianFunction,
+                               const MatrixFunction& measurementJacobianFunction,
+                               const MatrixFunction& measurementNoiseJacobianFunction,
+                               const DependentMatrix& systemUncertainty,
+                               const DependentMatrix& measurementUncertainty,
+                               const IndependentVariableType filteringStepSize,
+                               const IndependentVariableType initialTime,
+                               const DependentVector& initialStateVector,
+                               const DependentMatrix& initialCovarianceMatrix,
+                               const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr ) :
+        ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >(
+            systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+            measurementJacobianFunction, measurementNoiseJacobianFunction, systemUncertainty, measurementUncertainty,
+            filteringStepSize, initialTime, initialStateVector, initialCovarianceMatrix, integratorSettings )
+    { }
+
+    //! Destructor.
+    ~RauchTungStriebelSmoother( ){ }
+
+    //! Function to run the backward (smoothing) pass over the stored history.
+    /*!
+     *  Function to run the backward (smoothing) pass over the stored history of estimates. Starting from the final a-posteriori
+     *  estimates, the smoothed estimates at each previous time step k are computed from:
+     *  \f[ C_{k} = P_{k} \Phi_{k+1}^{T} ( P^{-}_{k+1} )^{-1} \f]
+     *  \f[ \hat{x}^{s}_{k} = \hat{x}_{k} + C_{k} ( \hat{x}^{s}_{k+1} - \hat{x}^{-}_{k+1} ) \f]
+     *  \f[ P^{s}_{k} = P_{k} + C_{k} ( P^{s}_{k+1} - P^{-}_{k+1} ) C_{k}^{T} \f]
+     *  where \f$ \Phi_{k+1} \f$ is the state Jacobian used to predict the estimates from step k to step k+1. Any previously
+     *  computed smoothed estimates are overwritten.
+     */
+    void performSmoothing( )
+    {
+        // Check that full history is available
+        if ( this->historySettings_->historyPolicy_ != keep_full_history )
+        {
+            throw std::runtime_error( "Error in Rauch-Tung-Striebel smoother. Smoothing requires the full history of estimates." );
+        }
+        if ( this->historyOfStateEstimates_.empty( ) )
+        {
+            throw std::runtime_error( "Error in Rauch-Tung-Striebel smoother. No estimates are available for smoothing." );
+        }
+
+        // Initialize smoothed history with final estimates
+        smoothedStateHistory_.clear( );
+        smoothedCovarianceHistory_.clear( );
+        typename std::map< IndependentVariableType, DependentVector >::const_reverse_iterator stateIterator =
+                this->historyOfStateEstimates_.rbegin( );
+        IndependentVariableType nextTime = stateIterator->first;
+        DependentVector nextSmoothedState = stateIterator->second;
+        DependentMatrix nextSmoothedCovariance = this->historyOfCovarianceEstimates_.at( nextTime );
+        smoothedStateHistory_[ nextTime ] = nextSmoothedState;
+        smoothedCovarianceHistory_[ nextTime ] = nextSmoothedCovariance;
+
+        // Run backward pass
+        for ( stateIterator++; stateIterator != this->historyOfStateEstimates_.rend( ); stateIterator++ )
+        {
+            if ( historyOfAPrioriStateEstimates_.count( nextTime ) == 0 )
+            {
+                throw std::runtime_error( "Error in Rauch-Tung-Striebel smoother. Prediction step not found in history." );
+            }
+            const DependentMatrix& currentCovariance = this->historyOfCovarianceEstimates_.at( stateIterator->first );
+            const DependentMatrix& nextAPrioriCovariance = historyOfAPrioriCovarianceEstimates_.at( nextTime );
+
+            // Compute smoother gain and smoothed estimates
+            DependentMatrix smootherGain = nextAPrioriCovariance.ldlt( ).solve(
+                        historyOfStateJacobians_.at( nextTime ) * currentCovariance ).transpose( );
+            nextSmoothedState = stateIterator->second + smootherGain * (
+                        nextSmoothedState - historyOfAPrioriStateEstimates_.at( nextTime ) );
+            nextSmoothedCovariance = currentCovariance + smootherGain * (
+                        nextSmoothedCovariance - nextAPrioriCovariance ) * smootherGain.transpose( );
+
+            nextTime = stateIterator->first;
+            smoothedStateHistory_[ nextTime ] = nextSmoothedState;
+            smoothedCovarianceHistory_[ nextTime ] = nextSmoothedCovariance;
+        }
+    }
+
+    //! Function to retrieve the history of smoothed states.
+    /*!
+     *  Function to retrieve the history of smoothed states. The smoothed states need to first be computed by the
+     *  performSmoothing function.
+     *  \return History of smoothed states for each time step.
+     */
+    std::map< IndependentVariableType, DependentVector > getSmoothedStateHistory( )
+    {
+        return smoothedStateHistory_;
+    }
+
+    //! Function to retrieve the history of smoothed covariance matrices.
+    /*!
+     *  Function to retrieve the history of smoothed covariance matrices. The smoothed covariance matrices need to first be
+     *  computed by the performSmoothing function.
+     *  \return History of smoothed covariance matrices for each time step.
+     */
+    std::map< IndependentVariableType, DependentMatrix > getSmoothedCovarianceHistory( )
+    {
+        return smoothedCovarianceHistory_;
+    }
+
+protected:
+
+    //! Function to store the results of the prediction step.
+    /*!
+     *  Function to store the results of the prediction step, which are needed for the backward pass of the smoother.
+     *  \param aPrioriStateEstimate Vector denoting the a-priori state estimate.
+     *  \param aPrioriCovarianceEstimate Matrix denoting the a-priori covariance estimate.
+     *  \param stateJacobianMatrix Matrix denoting the discrete-time state Jacobian used for the prediction step.
+     */
+    void storePredictionStep( const DependentVector& aPrioriStateEstimate,
+                              const DependentMatrix& aPrioriCovarianceEstimate,
+                              const DependentMatrix& stateJacobianMatrix )
+    {
+        historyOfAPrioriStateEstimates_[ this->currentTime_ ] = aPrioriStateEstimate;
+        historyOfAPrioriCovarianceEstimates_[ this->currentTime_ ] = aPrioriCovarianceEstimate;
+        historyOfStateJacobians_[ this->currentTime_ ] = stateJacobianMatrix;
+    }
+
+private:
+
+    //! Function to clear the history of stored variables for derived class-specific variables.
+    void clearSpecificFilterHistory( )
+    {
+        historyOfAPrioriStateEstimates_.clear( );
+        historyOfAPrioriCovarianceEstimates_.clear( );
+        historyOfStateJacobians_.clear( );
+        smoothedStateHistory_.clear( );
+        smoothedCovarianceHistory_.clear( );
+    }
+
+    //! Function to revert to the previous time step for derived class-specific variables.
+    /*!
+     *  Function to revert to the previous time step for derived class-specific variables.
+     *  \param timeToBeRemoved Double denoting the current time, i.e., the instant that has to be discarded.
+     */
+    void specificRevertToPreviousTimeStep( const double timeToBeRemoved )
+    {
+        removeSpecificHistoryEntry( static_cast< IndependentVariableType >( timeToBeRemoved ) );
+    }
+
+    //! Function to remove an entry from the history of derived class-specific variables.
+    /*!
+     *  Function to remove an entry from the history of derived class-specific variables.
+     *  \param timeToBeRemoved Time of the entry that is to be removed.
+     */
+    void removeSpecificHistoryEntry( const IndependentVariableType timeToBeRemoved )
+    {
+        historyOfAPrioriStateEstimates_.erase( timeToBeRemoved );
+        historyOfAPrioriCovarianceEstimates_.erase( timeToBeRemoved );
+        historyOfStateJacobians_.erase( timeToBeRemoved );
+    }
+
+    //! Map of a-priori estimated state vectors history.
+    std::map< IndependentVariableType, DependentVector > historyOfAPrioriStateEstimates_;
+
+    //! Map of a-priori estimated covariance matrices history.
+    std::map< IndependentVariableType, DependentMatrix > historyOfAPrioriCovarianceEstimates_;
+
+    //! Map of discrete-time state Jacobians history (used to predict the estimates up to the time of the key).
+    std::map< IndependentVariableType, DependentMatrix > historyOfStateJacobians_;
+
+    //! Map of smoothed state vectors history.
+    std::map< IndependentVariableType, DependentVector > smoothedStateHistory_;
+
+    //! Map of smoothed covariance matrices history.
+    std::map< IndependentVariableType, DependentMatrix > smoothedCovarianceHistory_;
+
+};
+
+//! Typedef for a smoother with double data type.
+typedef RauchTungStriebelSmoother< > RauchTungStriebelSmootherDouble;
+
+//! Typedef for a shared-pointer to a smoother with double data type.
+typedef std::shared_ptr< RauchTungStriebelSmootherDouble > RauchTungStriebelSmootherDoublePointer;
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_RAUCH_TUNG_STRIEBEL_SMOOTHER_H
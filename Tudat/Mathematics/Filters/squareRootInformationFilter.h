@@ -0,0 +1,284 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References:
+ *      Bierman, G.J., Factorization Methods for Discrete Sequential Estimation, Academic Press, 1977.
+ */
+
+#ifndef TUDAT_SQUARE_ROOT_INFORMATION_FILTER_H
+#define TUDAT_SQUARE_ROOT_INFORMATION_FILTER_H
+
+#include <Eigen/Cholesky>
+#include <Eigen/QR>
+
+#include "Tudat/Mathematics/Filters/extendedKalmanFilter.h"
+
+namespace tudat
+{
+
+namespace filters
+{
+
+//! Square-root information filter class.
+/*!
+ *  Class for the set up and use of the (extended) square-root information filter (SRIF). Instead of the covariance matrix P,
+ *  the filter propagates the upper-triangular square-root information matrix R, with \f$ P^{-1} = R^{T} R \f$. Both the time
+ *  and measurement updates are performed by Householder triangularization of a stacked matrix, which avoids the explicit
+ *  inversion of the innovation covariance and results in better numerical conditioning than the standard Kalman filter update.
+ *  The system and measurement models (and their Jacobians) are defined in the same way as for the ExtendedKalmanFilter class,
+ *  such that both filters provide the same estimates (up to round-off) for linear systems. The state Jacobian needs to be
+ *  invertible, the measurement uncertainty needs to be positive definite, and the system uncertainty needs to be either
+ *  positive definite or zero (in which case the system is assumed to be noise-free).
+ *  \tparam IndependentVariableType Type of independent variable. Default is double.
+ *  \tparam DependentVariableType Type of dependent variable. Default is double.
+ */
+template< typename IndependentVariableType = double, typename DependentVariableType = double >
+class SquareRootInformationFilter: public ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >
+{
+public:
+
+    //! Inherit typedefs from base class.
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::DependentVector DependentVector;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::DependentMatrix DependentMatrix;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::Function Function;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::MatrixFunction MatrixFunction;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::IntegratorSettings IntegratorSettings;
+    typedef typename ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >::Integrator Integrator;
+
+    //! Default constructor.
+    /*!
+     *  Default constructor. This constructor takes state and measurement functions and their respective
+     *  Jacobian functions as inputs. These functions can be a function of time and state vector.
+     *  \param systemFunction Function returning the state as a function of time and state vector. Can be a differential
+     *      equation if the integratorSettings is set (i.e., if it is not a nullptr).
+     *  \param measurementFunction Function returning the measurement as a function of time and state.
+     *  \param stateJacobianFunction Function returning the Jacobian of the system w.r.t. the state. The input values can
+     *      be time and state vector.
+     *  \param stateNoiseJacobianFunction Function returning the Jacobian of the system function w.r.t. the system noise. The
+     *      input values can be time and state vector.
+     *  \param measurementJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the state. The input
+     *      values can be time and state vector.
+     *  \param measurementNoiseJacobianFunction Function returning the Jacobian of the measurement function w.r.t. the measurement
+     *      noise. The input values can be time and state vector.
+     *  \param systemUncertainty Matrix defining the uncertainty in modeling of the system.
+     *  \param measurementUncertainty Matrix defining the uncertainty in modeling of the measurements.
+     *  \param filteringStepSize Scalar representing the value of the constant filtering time step.
+     *  \param initialTime Scalar representing the value of the initial time.
+     *  \param initialStateVector Vector representing the initial (estimated) state of the system. It is used as first
+     *      a-priori estimate of the state vector.
+     *  \param initialCovarianceMatrix Matrix representing the initial (estimated) covariance of the system. It is used as first
+     *      a-priori estimate of the covariance matrix.
+     *  \param integratorSettings Pointer to integration settings defining the integrator to be used to propagate the state.
+     */
+    SquareRootInformationFilter( const Function& systemFunction,
+                                 const Function& measurementFunction,
+                                 const MatrixFunction& stateJacobianFunction,
+                                 const MatrixFunction& stateNoiseJacobianFunction,
+                                 const MatrixFunction& measurementJacobianFunction,
+                                 const MatrixFunction& measurementNoiseJacobianFunction,
+                                 const DependentMatrix& systemUncertainty,
+                                 const DependentMatrix& measurementUncertainty,
+                                 const IndependentVariableType filteringStepSize,
+                                 const IndependentVariableType initialTime,
+                                 const DependentVector& initialStateVector,
+                                 const DependentMatrix& initialCovarianceMatrix,
+                                 const std::shared_ptr< IntegratorSettings > integratorSettings = nullptr ) :
+        ExtendedKalmanFilter< IndependentVariableType, DependentVariableType >(
+            systemFunction, measurementFunction, stateJacobianFunction, stateNoiseJacobianFunction,
+            measurementJacobianFunction, measurementNoiseJacobianFunction, systemUncertainty, measurementUncertainty,
+            filteringStepSize, initialTime, initialStateVector, initialCovarianceMatrix, integratorSettings )
+    {
+        // Compute inverse square root of system uncertainty (if system is not noise-free)
+        isSystemNoiseFree_ = systemUncertainty.isZero( );
+        if ( !isSystemNoiseFree_ )
+        {
+            inverseSquareRootOfSystemUncertainty_ = computeInverseSquareRoot( systemUncertainty );
+        }
+
+        // Compute square-root information matrix of initial covariance
+        updateSquareRootInformationMatrix( );
+    }
+
+    //! Destructor.
+    ~SquareRootInformationFilter( ){ }
+
+    //! Function to update the filter with the new step data.
+    /*!
+     *  Function to update the filter with the new step data. The time update triangularizes the matrix
+     *  \f$ [ R_w, 0; -R \Phi^{-1} G, R \Phi^{-1} ] \f$, with \f$ R_w \f$ the inverse square root of the system uncertainty,
+     *  \f$ \Phi \f$ the state Jacobian and G the noise Jacobian. The measurement update triangularizes the matrix
+     *  \f$ [ R^{-}, z^{-}; \tilde{H}, \tilde{y} ] \f$, with \f$ z^{-} = R^{-} x^{-} \f$, and \f$ \tilde{H} \f$ and
+     *  \f$ \tilde{y} \f$ the whitened (linearized) measurement matrix and measurement.
+     *  \param currentMeasurementVector Vector representing current measurement.
+     */
+    void updateFilter( const DependentVector& currentMeasurementVector )
+    {
+        // Recompute square-root information matrix, if covariance has been modified externally
+        updateSquareRootInformationMatrix( );
+        const unsigned int stateDimension = this->aPosterioriStateEstimate_.rows( );
+
+        // Prediction step
+        DependentVector aPrioriStateEstimate = this->predictState( );
+        std::pair< DependentMatrix, DependentMatrix > stateJacobianMatrices =
+                this->computeDiscreteTimeStateJacobians( aPrioriStateEstimate );
+        DependentMatrix mappedSquareRootInformationMatrix = stateJacobianMatrices.first.transpose( ).partialPivLu( ).solve(
+                    squareRootInformationMatrix_.transpose( ) ).transpose( );
+        DependentMatrix aPrioriSquareRootInformationMatrix;
+        if ( isSystemNoiseFree_ )
+        {
+            aPrioriSquareRootInformationMatrix = triangularizeMatrix( mappedSquareRootInformationMatrix );
+        }
+        else
+        {
+            const unsigned int noiseDimension = stateJacobianMatrices.second.cols( );
+            DependentMatrix timeUpdateMatrix = DependentMatrix::Zero( noiseDimension + stateDimension,
+                                                                      noiseDimension + stateDimension );
+            timeUpdateMatrix.topLeftCorner( noiseDimension, noiseDimension ) = inverseSquareRootOfSystemUncertainty_;
+            timeUpdateMatrix.bottomLeftCorner( stateDimension, noiseDimension ) =
+                    -mappedSquareRootInformationMatrix * stateJacobianMatrices.second;
+            timeUpdateMatrix.bottomRightCorner( stateDimension, stateDimension ) = mappedSquareRootInformationMatrix;
+            aPrioriSquareRootInformationMatrix = triangularizeMatrix( timeUpdateMatrix ).bottomRightCorner(
+                        stateDimension, stateDimension );
+        }
+
+        // Compute whitened measurement matrix and measurement (linearized about a-priori state)
+        DependentVector measurementEstimate = this->measurementFunction_( this->currentTime_, aPrioriStateEstimate );
+        DependentMatrix currentMeasurementJacobianMatrix =
+                this->getMeasurementJacobianFunction( )( this->currentTime_, aPrioriStateEstimate );
+        DependentMatrix currentMeasurementNoiseJacobianMatrix =
+                this->getMeasurementNoiseJacobianFunction( )( this->currentTime_, aPrioriStateEstimate );
+        DependentMatrix inverseSquareRootOfMeasurementUncertainty = computeInverseSquareRoot(
+                    currentMeasurementNoiseJacobianMatrix * this->measurementUncertainty_ *
+                    currentMeasurementNoiseJacobianMatrix.transpose( ) );
+        const unsigned int measurementDimension = measurementEstimate.rows( );
+
+        // Correction step
+        DependentMatrix measurementUpdateMatrix = DependentMatrix::Zero( stateDimension + measurementDimension,
+                                                                         stateDimension + 1 );
+        measurementUpdateMatrix.topLeftCorner( stateDimension, stateDimension ) = aPrioriSquareRootInformationMatrix;
+        measurementUpdateMatrix.topRightCorner( stateDimension, 1 ) = aPrioriSquareRootInformationMatrix * aPrioriStateEstimate;
+        measurementUpdateMatrix.bottomLeftCorner( measurementDimension, stateDimension ) =
+                inverseSquareRootOfMeasurementUncertainty * currentMeasurementJacobianMatrix;
+        measurementUpdateMatrix.bottomRightCorner( measurementDimension, 1 ) = inverseSquareRootOfMeasurementUncertainty * (
+                    currentMeasurementVector - measurementEstimate + currentMeasurementJacobianMatrix * aPrioriStateEstimate );
+        DependentMatrix triangularizedMeasurementUpdateMatrix = triangularizeMatrix( measurementUpdateMatrix );
+
+        // Extract a-posteriori estimates
+        this->currentTime_ += this->filteringStepSize_;
+        squareRootInformationMatrix_ = triangularizedMeasurementUpdateMatrix.topLeftCorner( stateDimension, stateDimension );
+        correctStateAndCovariance(
+                    squareRootInformationMatrix_.template triangularView< Eigen::Upper >( ).solve(
+                        DependentVector( triangularizedMeasurementUpdateMatrix.topRightCorner( stateDimension, 1 ) ) ) );
+    }
+
+    //! Function to retrieve the current square-root information matrix.
+    /*!
+     *  Function to retrieve the current square-root information matrix, i.e., the upper-triangular matrix R for which the
+     *  inverse of the current covariance estimate is given by \f$ R^{T} R \f$.
+     *  \return Current square-root information matrix.
+     */
+    DependentMatrix getCurrentSquareRootInformationMatrix( )
+    {
+        updateSquareRootInformationMatrix( );
+        return squareRootInformationMatrix_;
+    }
+
+private:
+
+    //! Function to compute the inverse of the (lower-triangular) Cholesky factor of a matrix.
+    /*!
+     *  Function to compute the inverse of the (lower-triangular) Cholesky factor L of a matrix, such that the inverse of the
+     *  input matrix is given by \f$ L^{-T} L^{-1} \f$.
+     *  \param matrixToDecompose Symmetric, positive-definite matrix to be decomposed.
+     *  \return Inverse of the Cholesky factor of the input matrix.
+     */
+    DependentMatrix computeInverseSquareRoot( const DependentMatrix& matrixToDecompose )
+    {
+        Eigen::LLT< DependentMatrix > choleskyDecomposition( matrixToDecompose );
+        if ( choleskyDecomposition.info( ) != Eigen::Success )
+        {
+            throw std::runtime_error( "Error in square-root information filter. Uncertainty matrix is not positive definite." );
+        }
+        return choleskyDecomposition.matrixL( ).solve( DependentMatrix::Identity( matrixToDecompose.rows( ),
+                                                                                   matrixToDecompose.cols( ) ) );
+    }
+
+    //! Function to triangularize a matrix with Householder transformations.
+    /*!
+     *  Function to triangularize a matrix with Householder transformations, i.e., to compute the upper-triangular matrix T for
+     *  which the input matrix A can be written as \f$ A = Q T \f$, with Q orthogonal.
+     *  \param matrixToTriangularize Matrix to be triangularized.
+     *  \return Upper-triangular matrix with the same number of rows and columns as the input matrix.
+     */
+    DependentMatrix triangularizeMatrix( const DependentMatrix& matrixToTriangularize )
+    {
+        Eigen::HouseholderQR< DependentMatrix > householderDecomposition( matrixToTriangularize );
+        return householderDecomposition.matrixQR( ).template triangularView< Eigen::Upper >( );
+    }
+
+    //! Function to set the a-posteriori state and covariance estimates from the square-root information matrix.
+    /*!
+     *  Function to set the a-posteriori state and covariance estimates from the square-root information matrix, and to store
+     *  them in the history.
+     *  \param aPosterioriStateEstimate Vector denoting the a-posteriori state estimate.
+     */
+    void correctStateAndCovariance( const DependentVector& aPosterioriStateEstimate )
+    {
+        this->aPosterioriStateEstimate_ = aPosterioriStateEstimate;
+        this->historyOfStateEstimates_[ this->currentTime_ ] = this->aPosterioriStateEstimate_;
+
+        DependentMatrix inverseSquareRootInformationMatrix =
+                squareRootInformationMatrix_.template triangularView< Eigen::Upper >( ).solve( this->identityMatrix_ );
+        this->aPosterioriCovarianceEstimate_ = inverseSquareRootInformationMatrix * inverseSquareRootInformationMatrix.transpose( );
+        covarianceOfSquareRootInformationMatrix_ = this->aPosterioriCovarianceEstimate_;
+        this->storeCovarianceEstimateInHistory( );
+    }
+
+    //! Function to recompute the square-root information matrix, if the covariance estimate has been modified externally.
+    /*!
+     *  Function to recompute the square-root information matrix from the a-posteriori covariance estimate, if the latter has
+     *  been modified since the last update of the filter (e.g., by modifyCurrentStateAndCovarianceEstimates, or by
+     *  revertToPreviousTimeStep).
+     */
+    void updateSquareRootInformationMatrix( )
+    {
+        if ( squareRootInformationMatrix_.rows( ) == 0 ||
+             covarianceOfSquareRootInformationMatrix_ != this->aPosterioriCovarianceEstimate_ )
+        {
+            squareRootInformationMatrix_ = triangularizeMatrix(
+                        computeInverseSquareRoot( this->aPosterioriCovarianceEstimate_ ) );
+            covarianceOfSquareRootInformationMatrix_ = this->aPosterioriCovarianceEstimate_;
+        }
+    }
+
+    //! Boolean denoting whether the system uncertainty is zero.
+    bool isSystemNoiseFree_;
+
+    //! Matrix denoting the inverse of the Cholesky factor of the system uncertainty.
+    DependentMatrix inverseSquareRootOfSystemUncertainty_;
+
+    //! Matrix denoting the (upper-triangular) square-root information matrix.
+    DependentMatrix squareRootInformationMatrix_;
+
+    //! Covariance matrix corresponding to the current square-root information matrix.
+    DependentMatrix covarianceOfSquareRootInformationMatrix_;
+
+};
+
+//! Typedef for a filter with double data type.
+typedef SquareRootInformationFilter< > SquareRootInformationFilterDouble;
+
+//! Typedef for a shared-pointer to a filter with double data type.
+typedef std::shared_ptr< SquareRootInformationFilterDouble > SquareRootInformationFilterDoublePointer;
+
+} // namespace filters
+
+} // namespace tudat
+
+#endif // TUDAT_SQUARE_ROOT_INFORMATION_FILTER_H
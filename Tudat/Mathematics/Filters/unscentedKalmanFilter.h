@@ -16,6 +16,8 @@
  *          November–December 2008.
  *      Challa, M., Moore, J., and Rogers, D., “A Simple Attitude Unscented Kalman Filter: Theory and Evaluation in
  *          a Magnetometer-Only Spacecraft Scenario,” IEEE Access, vol. 4, pp. 1845–1858, 2016.
+ *      Van der Merwe, R. and Wan, E., “The Square-Root Unscented Kalman Filter for State and Parameter-Estimation,” in
+ *          IEEE International Conference on Acoustics, Speech, and Signal Processing, vol. 6, 2001, pp. 3461–3464.
  *      Vittaldev, V. (2010). The unified state model: Derivation and application in astrodynamics
  *          and navigation. Master's thesis, Delft University of Technology.
  */
@@ -23,6 +25,11 @@
 #ifndef TUDAT_UNSCENTED_KALMAN_FILTER_H
 #define TUDAT_UNSCENTED_KALMAN_FILTER_H
 
+#include <Eigen/Cholesky>
+#include <Eigen/QR>
+
+#include "Tudat/Basics/parallelExecution.h"
+#include "Tudat/Mathematics/BasicMathematics/linearAlgebra.h"
 #include "Tudat/Mathematics/Filters/kalmanFilter.h"
 
 namespace tudat
@@ -52,7 +59,10 @@ enum ConstantParameterReferences
 
 //! Unscented Kalman filter class.
 /*!
- *  Class for the set up and use of the unscented Kalman filter.
+ *  Class for the set up and use of the unscented Kalman filter. The propagation of the sigma points (and the evaluation of
+ *  the measurement function for each sigma point) can be distributed over multiple threads, in which case each thread
+ *  uses its own integrator. Optionally, the square-root formulation of the filter can be used [Van der Merwe, R., et al.],
+ *  in which the Cholesky factor of the covariance matrix is updated directly.
  *  \tparam IndependentVariableType Type of independent variable. Default is double.
  *  \tparam DependentVariableType Type of dependent variable. Default is double.
  */
@@ -88,6 +98,12 @@ public:
      *      variable has to be part of the ConstantParameterReferences enumeration (custom parameters are supported).
      *  \param customConstantParameters Values of the constant parameters \f$ \alpha \f$ and \f$ \kappa \f$, in case the custom_parameters
      *      enumeration is used in the previous field.
+     *  \param numberOfThreads Number of threads over which the propagation of the sigma points, and the evaluation of the
+     *      measurement function, are distributed (0 to use the default number of threads). If different from 1, the system and
+     *      measurement functions must be safe to call concurrently. Each thread uses its own integrator.
+     *  \param useSquareRootFormulation Boolean denoting whether the square-root formulation of the filter is to be used, in which
+     *      the Cholesky factor of the covariance matrix is propagated and updated directly, instead of being recomputed from the
+     *      covariance matrix at each step.
      */
     UnscentedKalmanFilter( const Function& systemFunction,
                            const Function& measurementFunction,
@@ -101,11 +117,15 @@ public:
                            const ConstantParameterReferences constantValueReference = reference_Wan_and_Van_der_Merwe,
                            const std::pair< DependentVariableType, DependentVariableType > customConstantParameters =
             std::make_pair( static_cast< DependentVariableType >( TUDAT_NAN ),
-                            static_cast< DependentVariableType >( TUDAT_NAN ) ) ) :
+                            static_cast< DependentVariableType >( TUDAT_NAN ) ),
+                           const unsigned int numberOfThreads = 1,
+                           const bool useSquareRootFormulation = false ) :
         KalmanFilterBase< IndependentVariableType, DependentVariableType >( systemUncertainty, measurementUncertainty,
                                                                             filteringStepSize, initialTime, initialStateVector,
                                                                             initialCovarianceMatrix, integratorSettings ),
-        inputSystemFunction_( systemFunction ), inputMeasurementFunction_( measurementFunction )
+        inputSystemFunction_( systemFunction ), inputMeasurementFunction_( measurementFunction ),
+        numberOfThreads_( ( numberOfThreads == 0 ) ? utilities::getDefaultNumberOfThreads( ) : numberOfThreads ),
+        useSquareRootFormulation_( useSquareRootFormulation )
     {
         // Set dimensions
         stateDimension_ = systemUncertainty.rows( );
@@ -123,6 +143,37 @@ public:
         augmentedCovarianceMatrix_.block( stateDimension_, stateDimension_, stateDimension_, stateDimension_ ) = systemUncertainty;
         augmentedCovarianceMatrix_.block( 2 * stateDimension_, 2 * stateDimension_,
                                           measurementDimension_, measurementDimension_ ) = measurementUncertainty;
+        sigmaPoints_ = DependentMatrix::Zero( augmentedStateDimension_, numberOfSigmaPoints_ );
+
+        // Create square-root of augmented covariance matrix, where the noise blocks are constant
+        if ( useSquareRootFormulation_ )
+        {
+            if ( !( covarianceEstimationWeights_.at( 1 ) > static_cast< DependentVariableType >( 0.0 ) ) )
+            {
+                throw std::runtime_error( "Error in unscented Kalman filter. The square-root formulation requires positive "
+                                          "covariance weights for all but the first sigma point." );
+            }
+            augmentedCovarianceMatrixSquareRoot_ = DependentMatrix::Zero( augmentedStateDimension_, augmentedStateDimension_ );
+            augmentedCovarianceMatrixSquareRoot_.block( stateDimension_, stateDimension_, stateDimension_, stateDimension_ ) =
+                    computeCholeskyFactor( systemUncertainty );
+            augmentedCovarianceMatrixSquareRoot_.block( 2 * stateDimension_, 2 * stateDimension_,
+                                                        measurementDimension_, measurementDimension_ ) =
+                    computeCholeskyFactor( measurementUncertainty );
+        }
+
+        // Create one integrator per thread, where the first thread uses the integrator of the base class
+        threadSigmaPointIndices_.resize( numberOfThreads_, 0 );
+        if ( this->isStateToBeIntegrated_ )
+        {
+            threadIntegrators_.push_back( this->integrator_ );
+            for ( unsigned int i = 1; i < numberOfThreads_; i++ )
+            {
+                threadIntegrators_.push_back( this->createFilterIntegrator(
+                                                  std::bind( &UnscentedKalmanFilter< IndependentVariableType,
+                                                             DependentVariableType >::computeSystemFunctionForThread,
+                                                             this, std::placeholders::_1, std::placeholders::_2, i ) ) );
+            }
+        }
     }
 
     //! Destructor.
@@ -136,40 +187,57 @@ public:
     void updateFilter( const DependentVector& currentMeasurementVector )
     {
         // Compute sigma points
-        computeSigmaPoints( this->aPosterioriStateEstimate_, this->aPosterioriCovarianceEstimate_ );
-        historyOfSigmaPoints_[ this->currentTime_ ] = mapOfSigmaPoints_; // store points
+        if ( useSquareRootFormulation_ )
+        {
+            updateCovarianceSquareRoot( );
+            computeSigmaPointsFromSquareRoot( this->aPosterioriStateEstimate_, aPosterioriCovarianceSquareRoot_ );
+        }
+        else
+        {
+            computeSigmaPoints( this->aPosterioriStateEstimate_, this->aPosterioriCovarianceEstimate_ );
+        }
+        historyOfSigmaPoints_[ this->currentTime_ ] = sigmaPoints_; // store points
 
         // Prediction step
         // Compute series of state estimates based on sigma points
-        std::map< unsigned int, DependentVector > sigmaPointsStateEstimates;
-        for ( sigmaPointConstantIterator_ = mapOfSigmaPoints_.begin( );
-              sigmaPointConstantIterator_ != mapOfSigmaPoints_.end( ); sigmaPointConstantIterator_++ )
+        DependentMatrix sigmaPointsStateEstimates( stateDimension_, numberOfSigmaPoints_ );
+        utilities::executeParallelForLoop(
+                    numberOfSigmaPoints_, [ & ]( const unsigned int sigmaPointIndex, const unsigned int threadIndex )
         {
-            currentSigmaPoint_ = sigmaPointConstantIterator_->first;
-            sigmaPointsStateEstimates[ currentSigmaPoint_ ] = this->predictState(
-                        sigmaPointConstantIterator_->second.segment( 0, stateDimension_ ) );
-        }
+            sigmaPointsStateEstimates.col( sigmaPointIndex ) = predictSigmaPointState( sigmaPointIndex, threadIndex );
+        }, numberOfThreads_ );
 
         // Compute the weighted average to find the a-priori state vector
         DependentVector aPrioriStateEstimate = DependentVector::Zero( stateDimension_ );
         computeWeightedAverageFromSigmaPointEstimates( aPrioriStateEstimate, sigmaPointsStateEstimates );
 
-        // Compute the weighted average to find the a-priori covariance matrix
+        // Compute the weighted average to find the a-priori covariance matrix, and re-compute sigma points
         DependentMatrix aPrioriCovarianceEstimate = DependentMatrix::Zero( stateDimension_, stateDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( aPrioriCovarianceEstimate, aPrioriStateEstimate, sigmaPointsStateEstimates );
-
-        // Re-compute sigma points
-        computeSigmaPoints( aPrioriStateEstimate, aPrioriCovarianceEstimate );
+        DependentMatrix aPrioriCovarianceSquareRoot;
+        if ( useSquareRootFormulation_ )
+        {
+            computeSquareRootOfWeightedAverageFromSigmaPointEstimates( aPrioriCovarianceSquareRoot, aPrioriStateEstimate,
+                                                                       sigmaPointsStateEstimates );
+            aPrioriCovarianceEstimate = aPrioriCovarianceSquareRoot * aPrioriCovarianceSquareRoot.transpose( );
+            computeSigmaPointsFromSquareRoot( aPrioriStateEstimate, aPrioriCovarianceSquareRoot );
+        }
+        else
+        {
+            computeWeightedAverageFromSigmaPointEstimates( aPrioriCovarianceEstimate, aPrioriStateEstimate,
+                                                           sigmaPointsStateEstimates );
+            computeSigmaPoints( aPrioriStateEstimate, aPrioriCovarianceEstimate );
+        }
 
         // Compute series of measurement estimates based on sigma points
-        std::map< unsigned int, DependentVector > sigmaPointsMeasurementEstimates;
-        for ( sigmaPointConstantIterator_ = mapOfSigmaPoints_.begin( );
-              sigmaPointConstantIterator_ != mapOfSigmaPoints_.end( ); sigmaPointConstantIterator_++ )
+        DependentMatrix sigmaPointsMeasurementEstimates( measurementDimension_, numberOfSigmaPoints_ );
+        utilities::executeParallelForLoop(
+                    numberOfSigmaPoints_, [ & ]( const unsigned int sigmaPointIndex, const unsigned int threadIndex )
         {
-            currentSigmaPoint_ = sigmaPointConstantIterator_->first;
-            sigmaPointsMeasurementEstimates[ currentSigmaPoint_ ] = this->measurementFunction_(
-                        this->currentTime_, sigmaPointConstantIterator_->second.segment( 0, stateDimension_ ) );
-        }
+            TUDAT_UNUSED_PARAMETER( threadIndex );
+            sigmaPointsMeasurementEstimates.col( sigmaPointIndex ) = inputMeasurementFunction_(
+                        this->currentTime_, sigmaPoints_.block( 0, sigmaPointIndex, stateDimension_, 1 ) ) +
+                    sigmaPoints_.block( 2 * stateDimension_, sigmaPointIndex, measurementDimension_, 1 ); // add measurement noise
+        }, numberOfThreads_ );
 
         // Compute the weighted average to find the expected measurement vector
         DependentVector measurementEstimate = DependentVector::Zero( measurementDimension_ );
@@ -177,49 +245,86 @@ public:
 
         // Compute innovation and cross-correlation matrices
         DependentMatrix innovationMatrix = DependentMatrix::Zero( measurementDimension_, measurementDimension_ );
-        computeWeightedAverageFromSigmaPointEstimates( innovationMatrix, measurementEstimate, sigmaPointsMeasurementEstimates );
+        DependentMatrix innovationSquareRoot;
+        if ( useSquareRootFormulation_ )
+        {
+            computeSquareRootOfWeightedAverageFromSigmaPointEstimates( innovationSquareRoot, measurementEstimate,
+                                                                       sigmaPointsMeasurementEstimates );
+            innovationMatrix = innovationSquareRoot * innovationSquareRoot.transpose( );
+        }
+        else
+        {
+            computeWeightedAverageFromSigmaPointEstimates( innovationMatrix, measurementEstimate, sigmaPointsMeasurementEstimates );
+        }
         DependentMatrix crossCorrelationMatrix = DependentMatrix::Zero( stateDimension_, measurementDimension_ );
-        for ( sigmaPointConstantIterator_ = sigmaPointsStateEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointsStateEstimates.end( ); sigmaPointConstantIterator_++ )
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
         {
-            crossCorrelationMatrix += covarianceEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    ( sigmaPointConstantIterator_->second - aPrioriStateEstimate ) *
-                    ( sigmaPointsMeasurementEstimates[ sigmaPointConstantIterator_->first ] - measurementEstimate ).transpose( );
+            crossCorrelationMatrix += covarianceEstimationWeights_.at( i ) *
+                    ( sigmaPointsStateEstimates.col( i ) - aPrioriStateEstimate ) *
+                    ( sigmaPointsMeasurementEstimates.col( i ) - measurementEstimate ).transpose( );
         }
 
-        // Compute Kalman gain
-        DependentMatrix kalmanGain = crossCorrelationMatrix * innovationMatrix.inverse( );
+        // Compute Kalman gain (with two triangular solves, if the square-root of the innovation matrix is available)
+        DependentMatrix kalmanGain;
+        if ( useSquareRootFormulation_ )
+        {
+            kalmanGain = innovationSquareRoot.transpose( ).template triangularView< Eigen::Upper >( ).solve(
+                        innovationSquareRoot.template triangularView< Eigen::Lower >( ).solve(
+                            crossCorrelationMatrix.transpose( ) ) ).transpose( );
+        }
+        else
+        {
+            kalmanGain = crossCorrelationMatrix * innovationMatrix.inverse( );
+        }
 
         // Correction step
         this->currentTime_ += this->filteringStepSize_;
         this->correctState( aPrioriStateEstimate, currentMeasurementVector, measurementEstimate, kalmanGain );
-        correctCovariance( aPrioriCovarianceEstimate, innovationMatrix, kalmanGain );
+        if ( useSquareRootFormulation_ )
+        {
+            correctCovarianceSquareRoot( aPrioriCovarianceSquareRoot, innovationSquareRoot, kalmanGain );
+        }
+        else
+        {
+            correctCovariance( aPrioriCovarianceEstimate, innovationMatrix, kalmanGain );
+        }
     }
 
     //! Function to return the history of sigma points.
     /*!
      *  Function to return the history of sigma points.
-     *  \return History of map of sigma points for each time step.
+     *  \return History of matrix of sigma points (one sigma point per column) for each time step.
      */
     std::map< IndependentVariableType, DependentMatrix > getHistoryOfSigmaPoints( )
     {
-        // Convert map of maps into map of Eigen::Matrix
-        DependentVector vectorOfSigmaPoints;
-        std::map< IndependentVariableType, DependentMatrix > mapOfSigmaPointsHistory;
-        for ( typename std::map< IndependentVariableType, std::map< unsigned int, DependentVector > >::const_iterator
-              mapIterator = historyOfSigmaPoints_.begin( ); mapIterator != historyOfSigmaPoints_.end( ); mapIterator++ )
-        {
-            // Extract current map of sigma points and turn it into a vector
-            vectorOfSigmaPoints = utilities::createConcatenatedEigenMatrixFromMapValues( mapIterator->second );
-
-            // Reshape the vector into a matrix and store it into the output map
-            Eigen::Map< Eigen::MatrixXd > matrixOfSigmaPoints( vectorOfSigmaPoints.data( ),
-                                                               augmentedStateDimension_, numberOfSigmaPoints_ );
-            mapOfSigmaPointsHistory[ mapIterator->first ] = matrixOfSigmaPoints;
-        }
+        return historyOfSigmaPoints_;
+    }
 
-        // Give output
-        return mapOfSigmaPointsHistory;
+    //! Function to retrieve the number of threads used for the propagation of the sigma points.
+    /*!
+     *  Function to retrieve the number of threads used for the propagation of the sigma points.
+     *  \return Number of threads used for the propagation of the sigma points.
+     */
+    unsigned int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
+    //! Function to retrieve the Cholesky factor of the current a-posteriori covariance estimate.
+    /*!
+     *  Function to retrieve the (lower-triangular) Cholesky factor of the current a-posteriori covariance estimate. Only
+     *  available if the square-root formulation is used.
+     *  \return Cholesky factor of current a-posteriori covariance estimate.
+     */
+    DependentMatrix getCurrentCovarianceSquareRoot( )
+    {
+        if ( !useSquareRootFormulation_ )
+        {
+            throw std::runtime_error( "Error in unscented Kalman filter. The Cholesky factor of the covariance is only "
+                                      "available when the square-root formulation is used." );
+        }
+        updateCovarianceSquareRoot( );
+        return aPosterioriCovarianceSquareRoot_;
     }
 
 private:
@@ -227,7 +332,8 @@ private:
     //! Function to create the function that defines the system model.
     /*!
      *  Function to create the function that defines the system model. The output of this function is then bound
-     *  to the systemFunction_ variable, via the std::bind command.
+     *  to the systemFunction_ variable, via the std::bind command. This function is used by the integrator of the
+     *  first thread.
      *  \param currentTime Scalar representing the current time.
      *  \param currentStateVector Vector representing the current state.
      *  \return Vector representing the estimated state.
@@ -235,8 +341,7 @@ private:
     DependentVector createSystemFunction( const IndependentVariableType currentTime,
                                           const DependentVector& currentStateVector )
     {
-        return inputSystemFunction_( currentTime, currentStateVector ) +
-                mapOfSigmaPoints_[ currentSigmaPoint_ ].segment( stateDimension_, stateDimension_ ); // add system noise
+        return computeSystemFunctionForThread( currentTime, currentStateVector, 0 );
     }
 
     //! Function to create the function that defines the system model.
@@ -251,7 +356,51 @@ private:
                                                const DependentVector& currentStateVector )
     {
         return inputMeasurementFunction_( currentTime, currentStateVector ) +
-                mapOfSigmaPoints_[ currentSigmaPoint_ ].segment( 2 * stateDimension_, measurementDimension_ ); // add measurement noise
+                sigmaPoints_.block( 2 * stateDimension_, threadSigmaPointIndices_.at( 0 ),
+                                    measurementDimension_, 1 ); // add measurement noise
+    }
+
+    //! Function to evaluate the system model for the sigma point currently processed by a given thread.
+    /*!
+     *  Function to evaluate the system model for the sigma point currently processed by a given thread, i.e., the system
+     *  function input by the user, to which the system noise of the sigma point is added.
+     *  \param currentTime Scalar representing the current time.
+     *  \param currentStateVector Vector representing the current state.
+     *  \param threadIndex Index of the thread by which the function is evaluated.
+     *  \return Vector representing the estimated state.
+     */
+    DependentVector computeSystemFunctionForThread( const IndependentVariableType currentTime,
+                                                    const DependentVector& currentStateVector,
+                                                    const unsigned int threadIndex )
+    {
+        return inputSystemFunction_( currentTime, currentStateVector ) +
+                sigmaPoints_.block( stateDimension_, threadSigmaPointIndices_[ threadIndex ],
+                                    stateDimension_, 1 ); // add system noise
+    }
+
+    //! Function to predict the state of a sigma point at the next time step.
+    /*!
+     *  Function to predict the state of a sigma point at the next time step, with the either the use of the integrator of the
+     *  thread, or the system function input by the user.
+     *  \param sigmaPointIndex Index of the sigma point that is to be propagated.
+     *  \param threadIndex Index of the thread by which the sigma point is propagated.
+     *  \return Propagated state of the sigma point.
+     */
+    DependentVector predictSigmaPointState( const unsigned int sigmaPointIndex, const unsigned int threadIndex )
+    {
+        threadSigmaPointIndices_[ threadIndex ] = sigmaPointIndex;
+        if ( this->isStateToBeIntegrated_ )
+        {
+            // Reset time and state, and integrate equations
+            threadIntegrators_[ threadIndex ]->modifyCurrentIntegrationVariables(
+                        sigmaPoints_.block( 0, sigmaPointIndex, stateDimension_, 1 ), this->currentTime_ );
+            return threadIntegrators_[ threadIndex ]->performIntegrationStep( this->filteringStepSize_ );
+        }
+        else
+        {
+            return computeSystemFunctionForThread( this->currentTime_, sigmaPoints_.block( 0, sigmaPointIndex, stateDimension_, 1 ),
+                                                   threadIndex );
+        }
     }
 
     //! Function to clear the history of stored variables for derived class-specific variables.
@@ -275,6 +424,17 @@ private:
         }
     }
 
+    //! Function to remove an entry from the history of derived class-specific variables.
+    /*!
+     *  Function to remove an entry from the history of derived class-specific variables. This function adds to the list of
+     *  elements to be removed, the sigma points at the same time.
+     *  \param timeToBeRemoved Time of the entry that is to be removed.
+     */
+    void removeSpecificHistoryEntry( const IndependentVariableType timeToBeRemoved )
+    {
+        historyOfSigmaPoints_.erase( timeToBeRemoved );
+    }
+
     //! Function to set the values of the constant parameters.
     /*!
      *  Function to set the values of the constant parameters, used by the unscented Kalman filter for various purposes.
@@ -340,23 +500,44 @@ private:
             }
         }
 
-        // Loop over sigma points and assign value
-        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
+        // Assign values to sigma points
+        setSigmaPoints( augmentedCovarianceMatrixSquareRoot );
+    }
+
+    //! Function to compute the sigma points, based on the current state vector and Cholesky factor of the covariance matrix.
+    /*!
+     *  Function to compute the sigma points, based on the current state vector and Cholesky factor of the covariance matrix,
+     *  as used in the square-root formulation of the filter. Since the noise blocks of the augmented covariance matrix are
+     *  constant, no matrix square-root needs to be computed.
+     *  \param currentStateEstimate Vector representing the current state estimate.
+     *  \param currentCovarianceSquareRoot Lower-triangular Cholesky factor of the current covariance estimate.
+     */
+    void computeSigmaPointsFromSquareRoot( const DependentVector& currentStateEstimate,
+                                           const DependentMatrix& currentCovarianceSquareRoot )
+    {
+        // Update augmented state and square-root of covariance matrix to new values
+        augmentedStateVector_.segment( 0, stateDimension_ ) = currentStateEstimate;
+        augmentedCovarianceMatrixSquareRoot_.topLeftCorner( stateDimension_, stateDimension_ ) = currentCovarianceSquareRoot;
+
+        // Assign values to sigma points
+        setSigmaPoints( augmentedCovarianceMatrixSquareRoot_ );
+    }
+
+    //! Function to assign the values of the sigma points, based on the square-root of the augmented covariance matrix.
+    /*!
+     *  Function to assign the values of the sigma points, based on the current augmented state vector and the square-root
+     *  of the augmented covariance matrix. The sigma points are stored as columns of the sigmaPoints_ matrix.
+     *  \param augmentedCovarianceMatrixSquareRoot Square-root of the augmented covariance matrix.
+     */
+    void setSigmaPoints( const DependentMatrix& augmentedCovarianceMatrixSquareRoot )
+    {
+        sigmaPoints_.col( 0 ) = augmentedStateVector_;
+        for ( unsigned int i = 0; i < augmentedStateDimension_; i++ )
         {
-            if ( i == 0 )
-            {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_;
-            }
-            else if ( i < ( augmentedCovarianceMatrixSquareRoot.cols( ) + 1 ) )
-            {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_ + constantParameters_.at( gamma_index ) *
-                        augmentedCovarianceMatrixSquareRoot.col( i - 1 );
-            }
-            else
-            {
-                mapOfSigmaPoints_[ i ] = augmentedStateVector_ - constantParameters_.at( gamma_index ) *
-                        augmentedCovarianceMatrixSquareRoot.col( ( i - 1 ) - augmentedCovarianceMatrixSquareRoot.cols( ) );
-            }
+            sigmaPoints_.col( i + 1 ) = augmentedStateVector_ + constantParameters_.at( gamma_index ) *
+                    augmentedCovarianceMatrixSquareRoot.col( i );
+            sigmaPoints_.col( i + 1 + augmentedStateDimension_ ) = augmentedStateVector_ - constantParameters_.at( gamma_index ) *
+                    augmentedCovarianceMatrixSquareRoot.col( i );
         }
     }
 
@@ -364,19 +545,17 @@ private:
     /*!
      *  Function to compute the weighted average of the state and measurement vectors.
      *  \param weightedAverageVector Vector to which the weighted average is added (initially set to zero).
-     *  \param sigmaPointEstimates Map of the sigma points generated by the computeSigmaPoints function.
+     *  \param sigmaPointEstimates Matrix of propagated sigma points (or their measurements), one per column.
      *  \return Weighted average of the state or measurement vector, i.e., the new a-priori state and the
      *      measurement estimates (returned by reference).
      */
     void computeWeightedAverageFromSigmaPointEstimates( DependentVector& weightedAverageVector,
-                                                        const std::map< unsigned int, DependentVector >& sigmaPointEstimates )
+                                                        const DependentMatrix& sigmaPointEstimates )
     {
         // Loop over each sigma point
-        for ( sigmaPointConstantIterator_ = sigmaPointEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointEstimates.end( ); sigmaPointConstantIterator_++ )
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
         {
-            weightedAverageVector += stateEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    sigmaPointConstantIterator_->second;
+            weightedAverageVector += stateEstimationWeights_.at( i ) * sigmaPointEstimates.col( i );
         }
     }
 
@@ -385,21 +564,105 @@ private:
      *  Function to compute the weighted average of the covariance and innovation matrices.
      *  \param weightedAverageMatrix Matrix to which the weighted average is added (initially set to zero).
      *  \param referenceVector Vector representing the a-priori state or measurement estimates.
-     *  \param sigmaPointEstimates Map of the sigma points generated by the computeSigmaPoints function.
+     *  \param sigmaPointEstimates Matrix of propagated sigma points (or their measurements), one per column.
      *  \return Weighted average of the covariance and innovation matrices, i.e., the new a-priori covariance and the
      *      innovation estimates (returned by reference).
      */
     void computeWeightedAverageFromSigmaPointEstimates( DependentMatrix& weightedAverageMatrix,
                                                         const DependentVector& referenceVector,
-                                                        const std::map< unsigned int, DependentVector >& sigmaPointEstimates )
+                                                        const DependentMatrix& sigmaPointEstimates )
     {
         // Loop over each sigma point
-        for ( sigmaPointConstantIterator_ = sigmaPointEstimates.begin( );
-              sigmaPointConstantIterator_ != sigmaPointEstimates.end( ); sigmaPointConstantIterator_++ )
+        for ( unsigned int i = 0; i < numberOfSigmaPoints_; i++ )
+        {
+            weightedAverageMatrix += covarianceEstimationWeights_.at( i ) *
+                    ( sigmaPointEstimates.col( i ) - referenceVector ) *
+                    ( sigmaPointEstimates.col( i ) - referenceVector ).transpose( );
+        }
+    }
+
+    //! Function to compute the Cholesky factor of the weighted average of the covariance and innovation matrices.
+    /*!
+     *  Function to compute the (lower-triangular) Cholesky factor of the weighted average of the covariance and innovation
+     *  matrices, without forming the matrices themselves. The factor is obtained from a QR decomposition of the weighted
+     *  deviations of all but the first sigma point, after which it is updated (or downdated, for a negative weight) with the
+     *  deviation of the first sigma point.
+     *  \param weightedAverageSquareRoot Cholesky factor of the weighted average (returned by reference).
+     *  \param referenceVector Vector representing the a-priori state or measurement estimates.
+     *  \param sigmaPointEstimates Matrix of propagated sigma points (or their measurements), one per column.
+     */
+    void computeSquareRootOfWeightedAverageFromSigmaPointEstimates( DependentMatrix& weightedAverageSquareRoot,
+                                                                    const DependentVector& referenceVector,
+                                                                    const DependentMatrix& sigmaPointEstimates )
+    {
+        const unsigned int vectorSize = referenceVector.rows( );
+
+        // Compute triangular factor from QR decomposition of weighted deviations
+        DependentMatrix weightedDeviations( numberOfSigmaPoints_ - 1, vectorSize );
+        for ( unsigned int i = 1; i < numberOfSigmaPoints_; i++ )
+        {
+            weightedDeviations.row( i - 1 ) = std::sqrt( covarianceEstimationWeights_.at( i ) ) *
+                    ( sigmaPointEstimates.col( i ) - referenceVector ).transpose( );
+        }
+        Eigen::HouseholderQR< DependentMatrix > qrDecomposition( weightedDeviations );
+        weightedAverageSquareRoot = qrDecomposition.matrixQR( ).topRows( vectorSize ).template
+                triangularView< Eigen::Upper >( ).transpose( );
+
+        // Ensure diagonal entries are non-negative
+        for ( unsigned int i = 0; i < vectorSize; i++ )
+        {
+            if ( weightedAverageSquareRoot( i, i ) < static_cast< DependentVariableType >( 0.0 ) )
+            {
+                weightedAverageSquareRoot.col( i ) *= static_cast< DependentVariableType >( -1.0 );
+            }
+        }
+
+        // Include contribution of first sigma point
+        if ( !linear_algebra::updateCholeskyFactor< DependentVariableType >(
+                 weightedAverageSquareRoot, sigmaPointEstimates.col( 0 ) - referenceVector,
+                 covarianceEstimationWeights_.at( 0 ) ) )
         {
-            weightedAverageMatrix += covarianceEstimationWeights_.at( sigmaPointConstantIterator_->first ) *
-                    ( sigmaPointConstantIterator_->second - referenceVector ) *
-                    ( sigmaPointConstantIterator_->second - referenceVector ).transpose( );
+            throw std::runtime_error( "Error in unscented Kalman filter. Weighted covariance of sigma points is not positive "
+                                      "definite. Its Cholesky factor cannot be computed." );
+        }
+    }
+
+    //! Function to compute the Cholesky factor of a covariance matrix.
+    /*!
+     *  Function to compute the (lower-triangular) Cholesky factor of a covariance matrix. For diagonal matrices, the square-root
+     *  of the diagonal is taken directly, such that zero diagonal entries are supported.
+     *  \param covarianceMatrix Covariance matrix for which the Cholesky factor is to be computed.
+     *  \return Cholesky factor of covariance matrix.
+     */
+    DependentMatrix computeCholeskyFactor( const DependentMatrix& covarianceMatrix )
+    {
+        if ( covarianceMatrix.isDiagonal( static_cast< DependentVariableType >( 0.0 ) ) )
+        {
+            return DependentMatrix( covarianceMatrix.diagonal( ).array( ).sqrt( ).matrix( ).asDiagonal( ) );
+        }
+
+        Eigen::LLT< DependentMatrix > choleskyDecomposition( covarianceMatrix );
+        if ( choleskyDecomposition.info( ) != Eigen::Success )
+        {
+            throw std::runtime_error( "Error in unscented Kalman filter. Covariance matrix is not positive definite. "
+                                      "Its Cholesky factor cannot be computed." );
+        }
+        return choleskyDecomposition.matrixL( );
+    }
+
+    //! Function to make the Cholesky factor consistent with the current a-posteriori covariance estimate.
+    /*!
+     *  Function to make the Cholesky factor consistent with the current a-posteriori covariance estimate. The factor is only
+     *  recomputed if the covariance has been modified outside of the filter update (e.g., when modifying the estimates or
+     *  reverting to a previous time step).
+     */
+    void updateCovarianceSquareRoot( )
+    {
+        if ( !( this->aPosterioriCovarianceEstimate_.rows( ) == covarianceOfSquareRoot_.rows( ) &&
+                this->aPosterioriCovarianceEstimate_ == covarianceOfSquareRoot_ ) )
+        {
+            aPosterioriCovarianceSquareRoot_ = computeCholeskyFactor( this->aPosterioriCovarianceEstimate_ );
+            covarianceOfSquareRoot_ = this->aPosterioriCovarianceEstimate_;
         }
     }
 
@@ -414,7 +677,36 @@ private:
                             const DependentMatrix& innovationMatrix, const DependentMatrix& kalmanGain )
     {
         this->aPosterioriCovarianceEstimate_ = aPrioriCovarianceEstimate - kalmanGain * innovationMatrix * kalmanGain.transpose( );
-        this->historyOfCovarianceEstimates_[ this->currentTime_ ] = this->aPosterioriCovarianceEstimate_;
+        this->storeCovarianceEstimateInHistory( );
+    }
+
+    //! Function to correct the Cholesky factor of the covariance for the next time step.
+    /*!
+     *  Function to correct the Cholesky factor of the covariance for the next time step, as used in the square-root formulation
+     *  of the filter. The a-priori factor is downdated with each column of the product of the Kalman gain and the Cholesky factor
+     *  of the innovation matrix.
+     *  \param aPrioriCovarianceSquareRoot Matrix denoting the Cholesky factor of the a-priori covariance estimate.
+     *  \param innovationSquareRoot Matrix denoting the Cholesky factor of the innovation matrix.
+     *  \param kalmanGain Matrix denoting the Kalman gain, to be used to correct the state estimate with the external measurement data.
+     */
+    void correctCovarianceSquareRoot( const DependentMatrix& aPrioriCovarianceSquareRoot,
+                                      const DependentMatrix& innovationSquareRoot, const DependentMatrix& kalmanGain )
+    {
+        aPosterioriCovarianceSquareRoot_ = aPrioriCovarianceSquareRoot;
+        DependentMatrix updateMatrix = kalmanGain * innovationSquareRoot;
+        for ( unsigned int i = 0; i < measurementDimension_; i++ )
+        {
+            if ( !linear_algebra::updateCholeskyFactor< DependentVariableType >(
+                     aPosterioriCovarianceSquareRoot_, updateMatrix.col( i ), static_cast< DependentVariableType >( -1.0 ) ) )
+            {
+                throw std::runtime_error( "Error in unscented Kalman filter. Corrected covariance matrix is not positive "
+                                          "definite. Its Cholesky factor cannot be updated." );
+            }
+        }
+
+        this->aPosterioriCovarianceEstimate_ = aPosterioriCovarianceSquareRoot_ * aPosterioriCovarianceSquareRoot_.transpose( );
+        covarianceOfSquareRoot_ = this->aPosterioriCovarianceEstimate_;
+        this->storeCovarianceEstimateInHistory( );
     }
 
     //! System function input by user.
@@ -423,6 +715,12 @@ private:
     //! Measurement function input by user.
     Function inputMeasurementFunction_;
 
+    //! Number of threads used for the propagation of the sigma points.
+    unsigned int numberOfThreads_;
+
+    //! Boolean denoting whether the square-root formulation of the filter is used.
+    bool useSquareRootFormulation_;
+
     //! Integer specifying length of state vector.
     unsigned int stateDimension_;
 
@@ -462,26 +760,34 @@ private:
      */
     DependentMatrix augmentedCovarianceMatrix_;
 
-    //! Map of sigma points.
+    //! Cholesky factor of augmented covariance matrix (only used in square-root formulation).
+    DependentMatrix augmentedCovarianceMatrixSquareRoot_;
+
+    //! Cholesky factor of a-posteriori covariance estimate (only used in square-root formulation).
+    DependentMatrix aPosterioriCovarianceSquareRoot_;
+
+    //! Covariance matrix corresponding to aPosterioriCovarianceSquareRoot_ (only used in square-root formulation).
+    DependentMatrix covarianceOfSquareRoot_;
+
+    //! Matrix of sigma points.
     /*!
-     *  Map of sigma points, as output by the computeSigmaPoints function. See the description of this function for more
-     *  details of the sigma points and their use.
+     *  Matrix of sigma points (one sigma point per column), as output by the computeSigmaPoints function. See the description
+     *  of this function for more details of the sigma points and their use.
      */
-    std::map< unsigned int, DependentVector > mapOfSigmaPoints_;
+    DependentMatrix sigmaPoints_;
 
-    //! Map of map of sigma points, used to store the history of sigma points.
-    std::map< IndependentVariableType, std::map< unsigned int, DependentVector > > historyOfSigmaPoints_;
+    //! Map of matrix of sigma points, used to store the history of sigma points.
+    std::map< IndependentVariableType, DependentMatrix > historyOfSigmaPoints_;
 
-    //! Constant iterator to loop over sigma points (introduced for convenience).
-    typename std::map< unsigned int, DependentVector >::const_iterator sigmaPointConstantIterator_;
+    //! Integrators used for the propagation of the sigma points, one per thread.
+    std::vector< std::shared_ptr< Integrator > > threadIntegrators_;
 
-    //! Integer specifying current sigma point.
+    //! Indices of sigma points currently processed by each thread.
     /*!
-     *  Integer specifying current sigma point, while iterating over the mapOfSigmaPoints_. This parameter is specifically used
-     *  when evaluating the systemFunction_ and measurementFunction_, such that the correct value of system and measurement
-     *  noise can be added.
+     *  Indices of sigma points currently processed by each thread. These indices are specifically used when evaluating the
+     *  system function in the integrator of each thread, such that the correct value of system noise can be added.
      */
-    unsigned int currentSigmaPoint_;
+    std::vector< unsigned int > threadSigmaPointIndices_;
 
 };
 
@@ -647,22 +647,40 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
                     RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType, DependentVariableType > >(
                         variableStepIntegratorSettings );
 
-            // Check input consistency
-            if ( vectorTolerancesIntegratorSettings == nullptr )
+            // Settings with dynamic-size vector tolerances (e.g. for propagation with a fixed-size state)
+            std::shared_ptr< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType > >
+                    dynamicSizeVectorTolerancesIntegratorSettings = std::dynamic_pointer_cast<
+                    RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType > >(
+                        variableStepIntegratorSettings );
+
+            // Retrieve tolerances and check input consistency
+            Eigen::Matrix< typename DependentVariableType::Scalar, Eigen::Dynamic, Eigen::Dynamic > relativeErrorToleranceMatrix;
+            Eigen::Matrix< typename DependentVariableType::Scalar, Eigen::Dynamic, Eigen::Dynamic > absoluteErrorToleranceMatrix;
+            if ( vectorTolerancesIntegratorSettings != nullptr )
+            {
+                relativeErrorToleranceMatrix = vectorTolerancesIntegratorSettings->relativeErrorTolerance_.template cast<
+                        typename DependentVariableType::Scalar >( );
+                absoluteErrorToleranceMatrix = vectorTolerancesIntegratorSettings->absoluteErrorTolerance_.template cast<
+                        typename DependentVariableType::Scalar >( );
+            }
+            else if ( dynamicSizeVectorTolerancesIntegratorSettings != nullptr )
+            {
+                relativeErrorToleranceMatrix = dynamicSizeVectorTolerancesIntegratorSettings->relativeErrorTolerance_.template cast<
+                        typename DependentVariableType::Scalar >( );
+                absoluteErrorToleranceMatrix = dynamicSizeVectorTolerancesIntegratorSettings->absoluteErrorTolerance_.template cast<
+                        typename DependentVariableType::Scalar >( );
+            }
+            else
             {
                 throw std::runtime_error( "Error while creating Runge-Kutta variable step size integrator. Input class must be of "
                                           "RungeKuttaVariableStepSizeSettingsVectorTolerances type." );
             }
 
             // Check that sizes of tolerances and initial state match
-            DependentVariableType relativeErrorTolerance = vectorTolerancesIntegratorSettings->relativeErrorTolerance_.template cast<
-                    typename DependentVariableType::Scalar >( );
-            DependentVariableType absoluteErrorTolerance = vectorTolerancesIntegratorSettings->absoluteErrorTolerance_.template cast<
-                    typename DependentVariableType::Scalar >( );
-            if ( ( relativeErrorTolerance.rows( ) != initialState.rows( ) ) ||
-                 ( relativeErrorTolerance.cols( ) != initialState.cols( ) ) ||
-                 ( absoluteErrorTolerance.rows( ) != initialState.rows( ) ) ||
-                 ( absoluteErrorTolerance.cols( ) != initialState.cols( ) ) )
+            if ( ( relativeErrorToleranceMatrix.rows( ) != initialState.rows( ) ) ||
+                 ( relativeErrorToleranceMatrix.cols( ) != initialState.cols( ) ) ||
+                 ( absoluteErrorToleranceMatrix.rows( ) != initialState.rows( ) ) ||
+                 ( absoluteErrorToleranceMatrix.cols( ) != initialState.cols( ) ) )
             {
                 throw std::runtime_error( "Error while creating Runge-Kutta variable step size integrator. The sizes of the "
                                           "relative and absolute tolerance vectors do not match the size of the initial state. "
@@ -671,15 +689,17 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
             }
 
             // Create Runge-Kutta integrator with vector tolerances
+            DependentVariableType relativeErrorTolerance = relativeErrorToleranceMatrix;
+            DependentVariableType absoluteErrorTolerance = absoluteErrorToleranceMatrix;
             integrator = std::make_shared< RungeKuttaVariableStepSizeIntegrator
                     < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
                     ( coefficients, stateDerivativeFunction, integratorSettings->initialTime_, initialState,
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->minimumStepSize_ ),
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->maximumStepSize_ ),
+                      static_cast< IndependentVariableStepType >( variableStepIntegratorSettings->minimumStepSize_ ),
+                      static_cast< IndependentVariableStepType >( variableStepIntegratorSettings->maximumStepSize_ ),
                       relativeErrorTolerance, absoluteErrorTolerance,
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->safetyFactorForNextStepSize_ ),
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
-                      static_cast< IndependentVariableStepType >( vectorTolerancesIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
+                      static_cast< IndependentVariableStepType >( variableStepIntegratorSettings->safetyFactorForNextStepSize_ ),
+                      static_cast< IndependentVariableStepType >( variableStepIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
+                      static_cast< IndependentVariableStepType >( variableStepIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
         }
         break;
     }
@@ -129,6 +129,24 @@ public:
         throw std::runtime_error( "Function getPreviousState not implemented in this integrator" );
     }
 
+    //! Get state derivatives at the start and end of the last step.
+    /*!
+     * Retrieves the state derivatives at the start and end of the last step, as evaluated while performing the step
+     * (i.e. without additional state derivative evaluations), for instance to interpolate the state within the step.
+     * Derived classes should override this if these derivatives are available. The state derivative at the end of the
+     * step may be an approximation (e.g. evaluated at an intermediate state of the last stage).
+     * \param initialStateDerivative State derivative at the start of the last step (returned by reference).
+     * \param finalStateDerivative State derivative at the end of the last step (returned by reference).
+     * \return True if the state derivatives are available, false otherwise.
+     */
+    virtual bool getLastStepBoundaryStateDerivatives( StateDerivativeType& initialStateDerivative,
+                                                      StateDerivativeType& finalStateDerivative )
+    {
+        TUDAT_UNUSED_PARAMETER( initialStateDerivative );
+        TUDAT_UNUSED_PARAMETER( finalStateDerivative );
+        return false;
+    }
+
     //! Perform an integration to a specified independent variable value.
     /*!
      * Performs an integration to independentVariableEnd with initial state and initial independent
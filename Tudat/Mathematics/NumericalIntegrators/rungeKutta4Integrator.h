@@ -153,6 +153,10 @@ public:
         currentIndependentVariable_ += stepSize_;
         currentState_ += ( k1 + 2.0 * k2 + 2.0 * k3 + k4 ) / 6.0;
 
+        // Store state derivatives at start and (approximately) end of step.
+        lastStepInitialStateDerivative_ = k1 / stepSize;
+        lastStepFinalStateDerivative_ = k4 / stepSize;
+
         // Return the integration result.
         return currentState_;
     }
@@ -197,6 +201,27 @@ public:
         return lastState_;
     }
 
+    //! Get state derivatives at the start and end of the last step.
+    /*!
+     * Retrieves the state derivatives at the start and end of the last step, as evaluated while performing the step. The
+     * derivative at the start of the step is k1, the derivative at the end of the step is k4 (evaluated at the
+     * intermediate state y_{n} + k3, so it is an approximation).
+     * \param initialStateDerivative State derivative at the start of the last step (returned by reference).
+     * \param finalStateDerivative State derivative at the end of the last step (returned by reference).
+     * \return True if the state derivatives are available, false otherwise.
+     */
+    bool getLastStepBoundaryStateDerivatives( StateDerivativeType& initialStateDerivative,
+                                              StateDerivativeType& finalStateDerivative )
+    {
+        if( currentIndependentVariable_ == lastIndependentVariable_ )
+        {
+            return false;
+        }
+        initialStateDerivative = lastStepInitialStateDerivative_;
+        finalStateDerivative = lastStepFinalStateDerivative_;
+        return true;
+    }
+
     //! Replace the state with a new value.
     /*!
      * Replace the state with a new value. This allows for discrete jumps in the state, often
@@ -266,6 +291,12 @@ protected:
      */
     StateType lastState_;
 
+    //! State derivative at the start of the last step (k1 of last step, divided by step size).
+    StateDerivativeType lastStepInitialStateDerivative_;
+
+    //! State derivative at the end of the last step (k4 of last step, divided by step size).
+    StateDerivativeType lastStepFinalStateDerivative_;
+
 };
 
 extern template class RungeKutta4Integrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -294,6 +294,37 @@ public:
         return this->lastState_;
     }
 
+    //! Get state derivatives at the start and end of the last step.
+    /*!
+     * Retrieves the state derivatives at the start and end of the last step, as evaluated while performing the step. The
+     * derivative at the start of the step is the first stage evaluation, the derivative at the end of the step is the
+     * last stage evaluation at the end of the step (which is evaluated at an intermediate state, so it is an
+     * approximation). If the Butcher tableau has no stage at the end of the step, no derivatives are returned.
+     * \param initialStateDerivative State derivative at the start of the last step (returned by reference).
+     * \param finalStateDerivative State derivative at the end of the last step (returned by reference).
+     * \return True if the state derivatives are available, false otherwise.
+     */
+    bool getLastStepBoundaryStateDerivatives( StateDerivativeType& initialStateDerivative,
+                                              StateDerivativeType& finalStateDerivative )
+    {
+        if( this->currentIndependentVariable_ == this->lastIndependentVariable_ ||
+                static_cast< int >( currentStateDerivatives_.size( ) ) != this->coefficients_.cCoefficients.rows( ) )
+        {
+            return false;
+        }
+
+        for( int stage = this->coefficients_.cCoefficients.rows( ) - 1; stage > 0; stage-- )
+        {
+            if( this->coefficients_.cCoefficients( stage ) == 1.0 )
+            {
+                initialStateDerivative = currentStateDerivatives_[ 0 ];
+                finalStateDerivative = currentStateDerivatives_[ stage ];
+                return true;
+            }
+        }
+        return false;
+    }
+
     //! Replace the state with a new value.
     /*!
      * Replace the state with a new value. This allows for discrete jumps in the state, often
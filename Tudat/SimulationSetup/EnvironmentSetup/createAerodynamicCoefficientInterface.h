@@ -16,6 +16,7 @@
 
 #include "Tudat/Astrodynamics/Aerodynamics/aerodynamicCoefficientInterface.h"
 #include "Tudat/Astrodynamics/Aerodynamics/customAerodynamicCoefficientInterface.h"
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedAerodynamicCoefficientInterface.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/createAerodynamicControlSurfaces.h"
 #include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
@@ -1059,7 +1060,10 @@ createConstantCoefficientAerodynamicCoefficientInterface(
 
 //! Factory function for tabulated (N-D independent variables) aerodynamic coefficient interface.
 /*!
- *  Factory function for tabulated (N-D independent variables) aerodynamic coefficient interface.
+ *  Factory function for tabulated (N-D independent variables) aerodynamic coefficient interface. For multi-linear
+ *  interpolation with boundary values or extrapolation outside of the tabulated domain (including the default
+ *  settings), a TabulatedAerodynamicCoefficientInterface is created, which interpolates the force and moment
+ *  coefficients simultaneously. For other interpolator settings, separate interpolators are used.
  *  \param independentVariables Values of indepependent variables at which the coefficients
  *  in the input multi arrays are defined.
  *  \param forceCoefficients Values of force coefficients at independent variables defined
@@ -1116,6 +1120,40 @@ createTabulatedCoefficientAerodynamicCoefficientInterface(
                                   "inconsistent variable name vector dimensioning" );
     }
 
+    // Retrieve boundary handling for multi-linear interpolation (if applicable).
+    std::vector< BoundaryInterpolationType > boundaryHandling;
+    if( interpolatorSettings == nullptr )
+    {
+        boundaryHandling = std::vector< BoundaryInterpolationType >( NumberOfDimensions, use_boundary_value );
+    }
+    else if( interpolatorSettings->getInterpolatorType( ) == multi_linear_interpolator )
+    {
+        boundaryHandling = interpolatorSettings->getBoundaryHandling( );
+        if( boundaryHandling.empty( ) )
+        {
+            boundaryHandling = std::vector< BoundaryInterpolationType >( NumberOfDimensions, extrapolate_at_boundary );
+        }
+    }
+
+    // Check if force and moment coefficients can be interpolated simultaneously by dedicated interpolator.
+    bool useTabulatedCoefficientInterface = ( boundaryHandling.size( ) == NumberOfDimensions );
+    for( unsigned int i = 0; i < boundaryHandling.size( ); i++ )
+    {
+        if( boundaryHandling.at( i ) != use_boundary_value && boundaryHandling.at( i ) != extrapolate_at_boundary )
+        {
+            useTabulatedCoefficientInterface = false;
+        }
+    }
+
+    if( useTabulatedCoefficientInterface )
+    {
+        return std::make_shared< aerodynamics::TabulatedAerodynamicCoefficientInterface< NumberOfDimensions > >(
+                    independentVariables, forceCoefficients, momentCoefficients, boundaryHandling,
+                    referenceLength, referenceArea, lateralReferenceLength, momentReferencePoint,
+                    independentVariableNames,
+                    areCoefficientsInAerodynamicFrame, areCoefficientsInNegativeAxisDirection );
+    }
+
     // Create interpolators for coefficients.
     std::shared_ptr< MultiDimensionalInterpolator < double, Eigen::Vector3d, NumberOfDimensions > > forceInterpolator;
     std::shared_ptr< MultiDimensionalInterpolator< double, Eigen::Vector3d, NumberOfDimensions > > momentInterpolator;
@@ -18,6 +18,7 @@
 
 #include "Tudat/InputOutput/aerodynamicCoefficientReader.h"
 #include "Tudat/Astrodynamics/Aerodynamics/controlSurfaceAerodynamicCoefficientInterface.h"
+#include "Tudat/Astrodynamics/Aerodynamics/tabulatedAerodynamicCoefficientInterface.h"
 #include "Tudat/Mathematics/Interpolators/multiLinearInterpolator.h"
 
 namespace tudat
@@ -380,27 +381,11 @@ createTabulatedControlSurfaceIncrementAerodynamicCoefficientInterface(
 
     }
 
-    // Create interpolators for coefficients.
-    std::shared_ptr< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > > forceInterpolator =
-            std::make_shared< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, forceCoefficients );
-    std::shared_ptr< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > > momentInterpolator =
-            std::make_shared< interpolators::MultiLinearInterpolator
-            < double, Eigen::Vector3d, NumberOfDimensions > >(
-                independentVariables, momentCoefficients );
-
-    // Create aerodynamic coefficient interface.
-    return  std::make_shared< aerodynamics::CustomControlSurfaceIncrementAerodynamicInterface >(
-                std::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                             forceInterpolator, std::placeholders::_1 ),
-                std::bind( &interpolators::MultiLinearInterpolator
-                             < double, Eigen::Vector3d, NumberOfDimensions >::interpolate,
-                             momentInterpolator, std::placeholders::_1 ),
-                independentVariableNames );
+    // Create aerodynamic coefficient interface, interpolating force and moment increments simultaneously.
+    return std::make_shared< aerodynamics::TabulatedControlSurfaceIncrementAerodynamicInterface< NumberOfDimensions > >(
+                independentVariables, forceCoefficients, momentCoefficients, independentVariableNames,
+                std::vector< interpolators::BoundaryInterpolationType >(
+                    NumberOfDimensions, interpolators::extrapolate_at_boundary ) );
 }
 
 //! Function to create tabulated control surface aerodynamic coefficients from associated settings object
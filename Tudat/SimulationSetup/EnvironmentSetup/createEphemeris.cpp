@@ -13,6 +13,7 @@
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
 #endif
 
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/customEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/multiArcEphemeris.h"
@@ -138,6 +139,45 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             break;
         }
+        case chebyshev_spice_ephemeris:
+        {
+            // Check consistency of type and class.
+            std::shared_ptr< ChebyshevSpiceEphemerisSettings > chebyshevEphemerisSettings =
+                    std::dynamic_pointer_cast< ChebyshevSpiceEphemerisSettings >(
+                        ephemerisSettings );
+            if( chebyshevEphemerisSettings == nullptr )
+            {
+                throw std::runtime_error(
+                            "Error, expected Chebyshev spice ephemeris settings for body " + bodyName );
+            }
+            else
+            {
+                // Since only the barycenters of planetary systems are included in the standard DE
+                // ephemerides, append 'Barycenter' to body name.
+                std::string inputName;
+                inputName = bodyName;
+                if( bodyName == "Mars" ||
+                        bodyName == "Jupiter"  || bodyName == "Saturn" ||
+                        bodyName == "Uranus" || bodyName == "Neptune" )
+                {
+                    inputName += " Barycenter";
+                    std::cerr << "Warning, position of " << bodyName << " taken as barycenter of that body's "
+                              << "planetary system." << std::endl;
+                }
+
+                // Create corresponding ephemeris object.
+                ephemeris = createChebyshevEphemerisFromSpice(
+                            inputName,
+                            chebyshevEphemerisSettings->getInitialTime( ),
+                            chebyshevEphemerisSettings->getFinalTime( ),
+                            chebyshevEphemerisSettings->getSegmentDuration( ),
+                            chebyshevEphemerisSettings->getPolynomialDegree( ),
+                            chebyshevEphemerisSettings->getFrameOrigin( ),
+                            chebyshevEphemerisSettings->getFrameOrientation( ),
+                            chebyshevEphemerisSettings->getPositionTolerance( ) );
+            }
+            break;
+        }
 #endif
         case tabulated_ephemeris:
         {
@@ -315,6 +355,45 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
 
 }
 
+#if USE_CSPICE
+//! Function to create a piecewise Chebyshev ephemeris using data from Spice.
+std::shared_ptr< ephemerides::Ephemeris > createChebyshevEphemerisFromSpice(
+        const std::string& body,
+        const double initialTime,
+        const double finalTime,
+        const double segmentDuration,
+        const int polynomialDegree,
+        const std::string& observerName,
+        const std::string& referenceFrameName,
+        const double positionTolerance )
+{
+    std::function< Eigen::Vector6d( const double ) > spiceStateFunction =
+            std::bind( &spice_interface::getBodyCartesianStateAtEpoch,
+                       body, observerName, referenceFrameName, std::string( "none" ), std::placeholders::_1 );
+
+    // Fit Chebyshev segments to Spice data.
+    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = std::make_shared< ChebyshevEphemeris >(
+                spiceStateFunction, initialTime, finalTime, segmentDuration, polynomialDegree,
+                observerName, referenceFrameName );
+
+    // Check accuracy of approximation, if required.
+    if( positionTolerance == positionTolerance )
+    {
+        double maximumPositionError = chebyshevEphemeris->getMaximumApproximationError(
+                    spiceStateFunction ).first;
+        if( maximumPositionError > positionTolerance )
+        {
+            throw std::runtime_error(
+                        "Error when creating Chebyshev ephemeris for " + body + ", maximum position error w.r.t. Spice (" +
+                        std::to_string( maximumPositionError ) + " m) exceeds tolerance (" +
+                        std::to_string( positionTolerance ) + " m); decrease segment duration or increase degree." );
+        }
+    }
+
+    return chebyshevEphemeris;
+}
+#endif
+
 //! Function that retrieves the time interval at which an ephemeris can be safely interrogated
 std::pair< double, double > getSafeInterpolationInterval( const std::shared_ptr< ephemerides::Ephemeris > ephemerisModel )
 {
@@ -327,6 +406,14 @@ std::pair< double, double > getSafeInterpolationInterval( const std::shared_ptr<
     {
         safeInterval = getTabulatedEphemerisSafeInterval( ephemerisModel );
     }
+    // Check if model is Chebyshev, and retrieve interval of validity from model
+    else if( std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( ephemerisModel ) != nullptr )
+    {
+        std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemerisModel  =
+                std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( ephemerisModel );
+        safeInterval = std::make_pair( chebyshevEphemerisModel->getInitialTime( ),
+                                       chebyshevEphemerisModel->getFinalTime( ) );
+    }
     // Check if model is multi-arc, and retrieve safe intervals from first and last arc.
     else if( std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( ephemerisModel ) != nullptr )
     {
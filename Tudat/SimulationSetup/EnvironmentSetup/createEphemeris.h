@@ -45,7 +45,8 @@ enum EphemerisType
     interpolated_spice,
     constant_ephemeris,
     kepler_ephemeris,
-    custom_ephemeris
+    custom_ephemeris,
+    chebyshev_spice_ephemeris
 };
 
 //! Class for providing settings for ephemeris model.
@@ -325,6 +326,99 @@ private:
     bool useLongDoubleStates_;
 };
 
+//! EphemerisSettings derived class for defining settings of a piecewise Chebyshev ephemeris fitted
+//! to Spice data.
+/*!
+ *  EphemerisSettings derived class for defining settings of a piecewise Chebyshev ephemeris fitted
+ *  to Spice data. Spice is sampled once at the Chebyshev nodes of a set of equal-duration segments
+ *  spanning the time interval of interest, and the resulting coefficients are stored in a single
+ *  contiguous array (see ChebyshevEphemeris). Compared to InterpolatedSpiceEphemerisSettings, state
+ *  retrieval requires no interpolator search, and the number of Spice calls needed to reach a given
+ *  accuracy is typically much smaller. Upon creation, the approximation is compared to Spice and an
+ *  exception is thrown if the position error exceeds the user-defined tolerance.
+ */
+class ChebyshevSpiceEphemerisSettings: public DirectSpiceEphemerisSettings
+{
+public:
+
+    //! Constructor.
+    /*! Constructor, sets the properties from which the Chebyshev ephemeris is to be created.
+     * \param initialTime Initial time from which Chebyshev ephemeris should be created.
+     * \param finalTime Final time up to which Chebyshev ephemeris should be created.
+     * \param segmentDuration (Maximum) duration of a single Chebyshev segment (optional 1 day by default).
+     * \param polynomialDegree Degree of Chebyshev series on each segment (optional 12 by default).
+     * \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *        (optional "SSB" by default).
+     * \param frameOrientation Orientatioan of the reference frame in which the epehemeris is to be
+     *          calculated (optional "ECLIPJ2000" by default).
+     * \param positionTolerance Maximum allowed position difference w.r.t. Spice, checked upon creation
+     *          of the ephemeris. If NaN, no check is performed (optional 1 mm by default).
+     */
+    ChebyshevSpiceEphemerisSettings( const double initialTime,
+                                     const double finalTime,
+                                     const double segmentDuration = 86400.0,
+                                     const int polynomialDegree = 12,
+                                     const std::string frameOrigin = "SSB",
+                                     const std::string frameOrientation = "ECLIPJ2000",
+                                     const double positionTolerance = 1.0E-3 ):
+        DirectSpiceEphemerisSettings( frameOrigin, frameOrientation, 0, 0, 0,
+                                      chebyshev_spice_ephemeris ),
+        initialTime_( initialTime ), finalTime_( finalTime ), segmentDuration_( segmentDuration ),
+        polynomialDegree_( polynomialDegree ), positionTolerance_( positionTolerance ){ }
+
+    //! Function to return initial time from which Chebyshev ephemeris should be created.
+    /*!
+     *  Function to return initial time from which Chebyshev ephemeris should be created.
+     *  \return Initial time from which Chebyshev ephemeris should be created.
+     */
+    double getInitialTime( ){ return initialTime_; }
+
+    //! Function to return final time up to which Chebyshev ephemeris should be created.
+    /*!
+     *  Function to return final time up to which Chebyshev ephemeris should be created.
+     *  \return Final time up to which Chebyshev ephemeris should be created.
+     */
+    double getFinalTime( ){ return finalTime_; }
+
+    //! Function to return (maximum) duration of a single Chebyshev segment.
+    /*!
+     *  Function to return (maximum) duration of a single Chebyshev segment.
+     *  \return (Maximum) duration of a single Chebyshev segment.
+     */
+    double getSegmentDuration( ){ return segmentDuration_; }
+
+    //! Function to return degree of Chebyshev series on each segment.
+    /*!
+     *  Function to return degree of Chebyshev series on each segment.
+     *  \return Degree of Chebyshev series on each segment.
+     */
+    int getPolynomialDegree( ){ return polynomialDegree_; }
+
+    //! Function to return maximum allowed position difference w.r.t. Spice.
+    /*!
+     *  Function to return maximum allowed position difference w.r.t. Spice (NaN if no check is performed).
+     *  \return Maximum allowed position difference w.r.t. Spice.
+     */
+    double getPositionTolerance( ){ return positionTolerance_; }
+
+private:
+
+    //! Initial time from which Chebyshev ephemeris should be created.
+    double initialTime_;
+
+    //! Final time up to which Chebyshev ephemeris should be created.
+    double finalTime_;
+
+    //! (Maximum) duration of a single Chebyshev segment.
+    double segmentDuration_;
+
+    //! Degree of Chebyshev series on each segment.
+    int polynomialDegree_;
+
+    //! Maximum allowed position difference w.r.t. Spice (NaN if no check is performed).
+    double positionTolerance_;
+};
+
 //! EphemerisSettings derived class for defining settings of an approximate ephemeris for major
 //! planets.
 /*!
@@ -681,6 +775,33 @@ std::shared_ptr< ephemerides::Ephemeris > createTabulatedEphemerisFromSpice(
     return std::make_shared< ephemerides::TabulatedCartesianEphemeris< StateScalarType, TimeType > >(
                 interpolator, observerName, referenceFrameName );
 }
+
+//! Function to create a piecewise Chebyshev ephemeris using data from Spice.
+/*!
+ *  Function to create a piecewise Chebyshev ephemeris using data from Spice. Spice is called only at the
+ *  Chebyshev nodes of each segment (and, if requested, at a small number of test points per segment to
+ *  verify the accuracy of the approximation). Subsequent state retrievals do not call Spice.
+ * \param body Name of body for which ephemeris data is to be retrieved.
+ * \param initialTime Initial time from which Chebyshev ephemeris should be created.
+ * \param finalTime Final time up to which Chebyshev ephemeris should be created.
+ * \param segmentDuration (Maximum) duration of a single Chebyshev segment.
+ * \param polynomialDegree Degree of Chebyshev series on each segment.
+ * \param observerName Name of body relative to which the ephemeris is to be calculated.
+ * \param referenceFrameName Orientatioan of the reference frame in which the epehemeris is to be
+ *          calculated.
+ * \param positionTolerance Maximum allowed position difference w.r.t. Spice; an exception is thrown if
+ *          this value is exceeded. If NaN, no check is performed.
+ * \return Chebyshev ephemeris using data from Spice.
+ */
+std::shared_ptr< ephemerides::Ephemeris > createChebyshevEphemerisFromSpice(
+        const std::string& body,
+        const double initialTime,
+        const double finalTime,
+        const double segmentDuration,
+        const int polynomialDegree,
+        const std::string& observerName,
+        const std::string& referenceFrameName,
+        const double positionTolerance = TUDAT_NAN );
 #endif
 
 //! Function to create a ephemeris model.
@@ -57,9 +57,17 @@ std::shared_ptr< EphemerisSettings > getDefaultEphemerisSettings(
         const std::string& bodyName,
         const double initialTime,
         const double finalTime,
-        const double timeStep )
+        const double timeStep,
+        const bool useChebyshevEphemerides )
 {
 #if USE_CSPICE
+    if( useChebyshevEphemerides )
+    {
+        // Create settings for a Chebyshev Spice ephemeris.
+        return std::make_shared< ChebyshevSpiceEphemerisSettings >(
+                    initialTime, finalTime );
+    }
+
     // Create settings for an interpolated Spice ephemeris.
     return std::make_shared< InterpolatedSpiceEphemerisSettings >(
                 initialTime, finalTime, timeStep, "SSB", "ECLIPJ2000" );
@@ -138,7 +146,8 @@ std::shared_ptr< BodySettings > getDefaultSingleBodySettings(
         const std::string& bodyName,
         const double initialTime,
         const double finalTime,
-        const double timeStep )
+        const double timeStep,
+        const bool useChebyshevEphemerides )
 {
     std::shared_ptr< BodySettings > singleBodySettings = std::make_shared< BodySettings >( );
 
@@ -161,7 +170,7 @@ std::shared_ptr< BodySettings > getDefaultSingleBodySettings(
     else
     {
         singleBodySettings->ephemerisSettings = getDefaultEphemerisSettings(
-                    bodyName, initialTime, finalTime, timeStep );
+                    bodyName, initialTime, finalTime, timeStep, useChebyshevEphemerides );
     }
     singleBodySettings->gravityFieldSettings = getDefaultGravityFieldSettings(
                 bodyName, initialTime, finalTime );
@@ -177,7 +186,8 @@ std::map< std::string, std::shared_ptr< BodySettings > > getDefaultBodySettings(
         const std::vector< std::string >& bodies,
         const double initialTime,
         const double finalTime,
-        const double timeStep )
+        const double timeStep,
+        const bool useChebyshevEphemerides )
 {
     std::map< std::string, std::shared_ptr< BodySettings > > settingsMap;
 
@@ -185,7 +195,7 @@ std::map< std::string, std::shared_ptr< BodySettings > > getDefaultBodySettings(
     for( unsigned int i = 0; i < bodies.size( ); i++ )
     {
         settingsMap[ bodies.at( i ) ] = getDefaultSingleBodySettings(
-                    bodies.at( i ), initialTime, finalTime, timeStep );
+                    bodies.at( i ), initialTime, finalTime, timeStep, useChebyshevEphemerides );
 
     }
     return settingsMap;
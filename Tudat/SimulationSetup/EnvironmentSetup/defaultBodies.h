@@ -48,18 +48,23 @@ std::shared_ptr< EphemerisSettings > getDefaultEphemerisSettings(
 //! Function to create default settings for a body's ephemeris.
 /*!
  *  Function to create default settings for a body's ephemeris. Currently set to a
- *  creating a 6th order Lagrange interpolator from Spice.
+ *  creating a 6th order Lagrange interpolator from Spice, or (if requested) a piecewise Chebyshev
+ *  approximation of Spice data with default segment duration and degree.
  *  \param bodyName Name of body for which default ephemeris settings are to be retrieved.
  *  \param initialTime Start time at which ephemeris is to be created.
  *  \param finalTime End time up to which ephemeris is to be created.
- *  \param timeStep Time step with which interpolated data from Spice should be created.
+ *  \param timeStep Time step with which interpolated data from Spice should be created (not used if
+ *  useChebyshevEphemerides is true).
+ *  \param useChebyshevEphemerides Boolean denoting whether a Chebyshev ephemeris is to be used instead of
+ *  an interpolated ephemeris (see ChebyshevSpiceEphemerisSettings).
  *  \return Default settings for a body's ephemeris.
  */
 std::shared_ptr< EphemerisSettings > getDefaultEphemerisSettings(
         const std::string& bodyName,
         const double initialTime,
         const double finalTime,
-        const double timeStep = 300.0 );
+        const double timeStep = 300.0,
+        const bool useChebyshevEphemerides = false );
 
 //! Function to create default settings for a body's gravity field model.
 /*!
@@ -122,12 +127,15 @@ std::shared_ptr< BodyShapeSettings > getDefaultBodyShapeSettings(
  *  (included as some environment models require e.g., interpolators to be created over
  *  a certain time period).
  *  \param timeStep Time step with which interpolated data from Spice should be created.
+ *  \param useChebyshevEphemerides Boolean denoting whether a Chebyshev ephemeris is to be used instead of
+ *  an interpolated ephemeris.
  */
 std::shared_ptr< BodySettings > getDefaultSingleBodySettings(
         const std::string& body,
         const double initialTime,
         const double finalTime,
-        const double timeStep = 300.0 );
+        const double timeStep = 300.0,
+        const bool useChebyshevEphemerides = false );
 
 //! Function to create default settings from which to create a set of body objects.
 /*!
@@ -143,13 +151,16 @@ std::shared_ptr< BodySettings > getDefaultSingleBodySettings(
  *  (included as some environment models require e.g., interpolators to be created over
  *  a certain time period).
  *  \param timeStep Time step with which interpolated data from Spice should be created.
+ *  \param useChebyshevEphemerides Boolean denoting whether a Chebyshev ephemeris is to be used instead of
+ *  an interpolated ephemeris.
  *  \return Default settings from which to create a set of body objects.
  */
 std::map< std::string, std::shared_ptr< BodySettings > > getDefaultBodySettings(
         const std::vector< std::string >& bodies,
         const double initialTime,
         const double finalTime,
-        const double timeStep = 300.0 );
+        const double timeStep = 300.0,
+        const bool useChebyshevEphemerides = false );
 
 //! Function to create default settings from which to create a set of body objects, without stringent limitations on
 //! time-interval of validity of environment.
@@ -17,6 +17,7 @@
 
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
+#include "Tudat/Mathematics/BasicMathematics/sequentialNormalEquations.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationManager.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/podInputOutputTypes.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/initialTranslationalState.h"
@@ -327,6 +328,62 @@ public:
 
 
 
+    //! Function to calculate the observation partials matrix and residuals, from a flat observation collection
+    /*!
+     *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
+     *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
+     *  Partials and observations are calculated by the observationManagers_. The row ranges of each observable type/link
+     *  ends are taken directly from the collection.
+     *  \param observationCollection Observable values and associated time tags, per observable type and set of link ends.
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param residualsAndPartials Pair of residuals of computed w.r.t. input observable values and partials of
+     *  observables w.r.t. parameter vector (return by reference).
+     */
+    void calculateObservationMatrixAndResiduals(
+            const observation_models::ObservationCollection< ObservationScalarType, TimeType >& observationCollection,
+            const int parameterVectorSize,
+            std::pair< Eigen::VectorXd, Eigen::MatrixXd >& residualsAndPartials  )
+    {
+        // Initialize return data.
+        int totalObservationSize = observationCollection.getNumberOfObservations( );
+        residualsAndPartials.second = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
+        residualsAndPartials.first = Eigen::VectorXd::Zero( totalObservationSize );
+
+        const std::vector< observation_models::ObservationSetIndices >& observationSets =
+                observationCollection.getObservationSets( );
+
+        // Iterate over all sets of observable type and link ends
+        for( unsigned int i = 0; i < observationSets.size( ); i++ )
+        {
+            const observation_models::ObservationSetIndices& currentSet = observationSets.at( i );
+
+            // Compute estimated observations and partials from current parameter estimate.
+            std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                    observationManagers_.at( currentSet.observableType_ )->computeObservationsWithPartials(
+                        observationCollection.getObservationSetTimes( i ),
+                        observationCollection.getLinkEnds( currentSet.linkEndsId_ ), currentSet.referenceLinkEnd_ );
+
+            // Set residuals and partials for current set in full vector/matrix
+            residualsAndPartials.first.segment( currentSet.startIndex_, currentSet.numberOfRows_ ) =
+                    ( observationCollection.getObservationVector( ).segment(
+                          currentSet.startIndex_, currentSet.numberOfRows_ ) -
+                      observationsWithPartials.first ).template cast< double >( );
+            residualsAndPartials.second.block( currentSet.startIndex_, 0, currentSet.numberOfRows_, parameterVectorSize ) =
+                    observationsWithPartials.second;
+
+            // Check residuals of observable after last set of current observable
+            if( ( i + 1 == observationSets.size( ) ) ||
+                    ( observationSets.at( i + 1 ).observableType_ != currentSet.observableType_ ) )
+            {
+                std::pair< int, int > observableRange =
+                        observationCollection.getObservableRange( currentSet.observableType_ );
+                observation_models::checkObservationResidualDiscontinuities(
+                            residualsAndPartials.first.block( observableRange.first, 0, observableRange.second, 1 ),
+                            currentSet.observableType_ );
+            }
+        }
+    }
+
     //! Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
     /*!
      * Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
@@ -407,11 +464,14 @@ public:
     {
         currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
 
-        // Get size of parameter vector and number of observations (total and per type)
+        // Create flat observation collection (with precomputed row ranges and concatenated weights) from input
+        std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+                observationCollection = podInput->getObservationCollection( );
+        const Eigen::VectorXd weightsMatrixDiagonal = observationCollection->getWeightsVector( );
+
+        // Get size of parameter vector and number of observations
         int parameterVectorSize = currentParameterEstimate_.size( );
-        std::pair< std::map< observation_models::ObservableType, int >, int > observationNumberPair =
-                getNumberOfObservationsPerObservable( podInput->getObservationsAndTimes( ) );
-        int totalNumberOfObservations = observationNumberPair.second;
+        int totalNumberOfObservations = observationCollection->getNumberOfObservations( );
 
         // Declare variables to be returned (i.e. results from best iteration)
         double bestResidual = TUDAT_NAN;
@@ -478,7 +538,7 @@ public:
             // Calculate residuals and observation matrix for current parameter estimate.
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
             calculateObservationMatrixAndResiduals(
-                        podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations, residualsAndPartials );
+                        *observationCollection, parameterVectorSize, residualsAndPartials );
 
             Eigen::VectorXd transformationData = normalizeObservationMatrix( residualsAndPartials.second );
 
@@ -505,7 +565,7 @@ public:
                 leastSquaresOutput =
                         std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
                                        residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
-                                       residualsAndPartials.first, getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ),
+                                       residualsAndPartials.first, weightsMatrixDiagonal,
                                        normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
 
                 if( constraintStateMultiplier.rows( ) > 0 )
@@ -571,7 +631,7 @@ public:
                 {
                     bestInformationMatrix = std::move( residualsAndPartials.second );
                 }
-                bestWeightsMatrixDiagonal = std::move( getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ) );
+                bestWeightsMatrixDiagonal = weightsMatrixDiagonal;
                 bestTransformationData = std::move( transformationData );
                 bestInverseNormalizedCovarianceMatrix = std::move( leastSquaresOutput.second );
             }
@@ -604,6 +664,186 @@ public:
         return podOutput;
     }
 
+    //! Function to perform sequential parameter estimation, adding new measurement data to previously processed data.
+    /*!
+     *  Function to perform sequential (batch) parameter estimation, in which only new measurement data is processed, and
+     *  combined with the accumulated normal equations of all previously processed data. The partials and residuals of the
+     *  previous data are not recomputed: their normal equations are moved to the current parameter estimate to first order.
+     *  On each iteration, the residuals and partials of the new data are computed, added to a copy of the accumulated
+     *  normal equations, and the resulting system is solved. Upon termination, the accumulated normal equations are
+     *  updated with the new data (as linearized at the best iteration), so that the next batch of data can be processed.
+     *  Parameters that are no longer observed (e.g. initial states of expired arcs) may be removed from the accumulated
+     *  normal equations by SequentialNormalEquations::eliminateParameters between calls to this function.
+     *  A priori information is to be included in the accumulated normal equations when creating them; the a priori
+     *  covariance in the podInput is not used. Constraints on the parameters are not supported in this mode.
+     *  \param podInput Object containing the new measurement data, associated metadata, including measurement weight, and
+     *  initial parameter adjustment.
+     *  \param accumulatedNormalEquations Normal equations of all previously processed measurement data (updated by this
+     *  function to include the new data).
+     *  \param convergenceChecker Object used to check convergence/termination of algorithm
+     *  \return Object containing estimated parameter value and associateed data, such as residuals and observation partials
+     *  of the new data. The covariance data in this object includes all processed data.
+     */
+    std::shared_ptr< PodOutput< ObservationScalarType, TimeType > > estimateParametersSequentially(
+            const std::shared_ptr< PodInput< ObservationScalarType, TimeType > > podInput,
+            const std::shared_ptr< linear_algebra::SequentialNormalEquations > accumulatedNormalEquations,
+            std::shared_ptr< EstimationConvergenceChecker > convergenceChecker =
+            std::make_shared< EstimationConvergenceChecker >( ) )
+    {
+        currentParameterEstimate_ = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
+
+        Eigen::MatrixXd constraintStateMultiplier;
+        Eigen::VectorXd constraintRightHandSide;
+        parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
+        if( constraintStateMultiplier.rows( ) > 0 )
+        {
+            throw std::runtime_error( "Error, parameter constraints not supported in sequential estimation" );
+        }
+
+        // Create flat observation collection of new data
+        std::shared_ptr< observation_models::ObservationCollection< ObservationScalarType, TimeType > >
+                observationCollection = podInput->getObservationCollection( );
+        const Eigen::VectorXd weightsMatrixDiagonal = observationCollection->getWeightsVector( );
+
+        int parameterVectorSize = currentParameterEstimate_.size( );
+        int totalNumberOfObservations = observationCollection->getNumberOfObservations( );
+        if( accumulatedNormalEquations->getLinearizationPoint( ).rows( ) != parameterVectorSize )
+        {
+            throw std::runtime_error( "Error in sequential estimation, size of accumulated normal equations is inconsistent" );
+        }
+
+        // Declare variables to be returned (i.e. results from best iteration)
+        double bestResidual = TUDAT_NAN;
+        ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( parameterVectorSize, TUDAT_NAN );
+        Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
+        Eigen::MatrixXd bestInformationMatrix = Eigen::MatrixXd::Constant(
+                    totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
+        std::shared_ptr< linear_algebra::SequentialNormalEquations > bestNormalEquations;
+
+        std::vector< Eigen::VectorXd > residualHistory;
+        std::vector< Eigen::VectorXd > parameterHistory;
+        std::vector< double > rmsResidualHistory;
+
+        ParameterVectorType newParameterEstimate = currentParameterEstimate_ +
+                podInput->getInitialParameterDeviationEstimate( );
+        ParameterVectorType oldParameterEstimate = currentParameterEstimate_;
+
+        bool exceptionDuringPropagation = false;
+        int numberOfIterations = 0;
+        do
+        {
+            try
+            {
+                // Re-integrate equations of motion and variational equations with new parameter estimate.
+                if( ( numberOfIterations > 0 ) ||( podInput->getReintegrateEquationsOnFirstIteration( ) ) )
+                {
+                    resetParameterEstimate( newParameterEstimate, podInput->getReintegrateVariationalEquations( ) );
+                }
+            }
+            catch( std::runtime_error& error )
+            {
+                std::cerr<<"Error when resetting parameters during sequential parameter estimation: "<<std::endl<<
+                           error.what( )<<std::endl<<"Terminating estimation"<<std::endl;
+                exceptionDuringPropagation = true;
+                break;
+            }
+
+            oldParameterEstimate = newParameterEstimate;
+
+            // Calculate residuals and observation matrix of new data for current parameter estimate.
+            std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
+            calculateObservationMatrixAndResiduals( *observationCollection, parameterVectorSize, residualsAndPartials );
+
+            // Add new data to accumulated normal equations, linearized at current estimate, and solve
+            std::shared_ptr< linear_algebra::SequentialNormalEquations > currentNormalEquations =
+                    std::make_shared< linear_algebra::SequentialNormalEquations >( *accumulatedNormalEquations );
+            currentNormalEquations->setLinearizationPoint( oldParameterEstimate.template cast< double >( ) );
+            currentNormalEquations->addObservations(
+                        residualsAndPartials.second, residualsAndPartials.first, weightsMatrixDiagonal );
+
+            ParameterVectorType parameterAddition =
+                    currentNormalEquations->getParameterCorrection( ).template cast< ObservationScalarType >( );
+
+            // Update value of parameter vector
+            newParameterEstimate = oldParameterEstimate + parameterAddition;
+            parametersToEstimate_->template resetParameterValues< ObservationScalarType >( newParameterEstimate );
+            newParameterEstimate = parametersToEstimate_->template getFullParameterValues< ObservationScalarType >( );
+
+            if( podInput->getSaveResidualsAndParametersFromEachIteration( ) )
+            {
+                residualHistory.push_back( residualsAndPartials.first );
+                if( numberOfIterations == 0 )
+                {
+                    parameterHistory.push_back( oldParameterEstimate.template cast< double >( ) );
+                }
+                parameterHistory.push_back( newParameterEstimate.template cast< double >( ) );
+            }
+
+            if( podInput->getPrintOutput( ) )
+            {
+                std::cout << "Parameter update" << parameterAddition.transpose( ) << std::endl;
+            }
+
+            // Calculate mean residual of new data for current iteration.
+            double residualRms = linear_algebra::getVectorEntryRootMeanSquare( residualsAndPartials.first );
+            rmsResidualHistory.push_back( residualRms );
+            if( podInput->getPrintOutput( ) )
+            {
+                std::cout << "Current residual: " << residualRms << std::endl;
+            }
+
+            // If current iteration is better than previous one, update 'best' data.
+            if( residualRms < bestResidual || !( bestResidual == bestResidual ) )
+            {
+                bestResidual = residualRms;
+                bestParameterEstimate = newParameterEstimate;
+                bestResiduals = std::move( residualsAndPartials.first );
+                if( podInput->getSaveInformationMatrix( ) )
+                {
+                    bestInformationMatrix = std::move( residualsAndPartials.second );
+                }
+                bestNormalEquations = currentNormalEquations;
+            }
+
+            numberOfIterations++;
+
+        } while( convergenceChecker->isEstimationConverged( numberOfIterations, rmsResidualHistory ) == false );
+
+        // Normalize full normal matrix for output, consistent with non-sequential estimation output.
+        Eigen::MatrixXd normalizedInverseCovarianceMatrix;
+        Eigen::VectorXd transformationData = Eigen::VectorXd::Ones( parameterVectorSize );
+        if( bestNormalEquations != nullptr )
+        {
+            // Store new data in accumulated normal equations
+            *accumulatedNormalEquations = *bestNormalEquations;
+
+            normalizedInverseCovarianceMatrix = accumulatedNormalEquations->getFullNormalMatrix( );
+            for( int i = 0; i < parameterVectorSize; i++ )
+            {
+                if( normalizedInverseCovarianceMatrix( i, i ) > 0.0 )
+                {
+                    transformationData( i ) = std::sqrt( normalizedInverseCovarianceMatrix( i, i ) );
+                }
+            }
+            normalizedInverseCovarianceMatrix = transformationData.cwiseInverse( ).asDiagonal( ) *
+                    normalizedInverseCovarianceMatrix * transformationData.cwiseInverse( ).asDiagonal( );
+        }
+        else
+        {
+            normalizedInverseCovarianceMatrix = Eigen::MatrixXd::Constant( parameterVectorSize, parameterVectorSize, TUDAT_NAN );
+        }
+
+        if( podInput->getPrintOutput( ) )
+        {
+            std::cout << "Final residual of new data: " << bestResidual << std::endl;
+        }
+
+        return std::make_shared< PodOutput< ObservationScalarType, TimeType > >(
+                    bestParameterEstimate, bestResiduals, bestInformationMatrix, weightsMatrixDiagonal, transformationData,
+                    normalizedInverseCovarianceMatrix, bestResidual, residualHistory, parameterHistory, false,
+                    exceptionDuringPropagation );
+    }
+
     //! Function to reset the current parameter estimate.
     /*!
      *  Function to reset the current parameter estimate; reintegrates the variational equations and equations of motion with new estimate.
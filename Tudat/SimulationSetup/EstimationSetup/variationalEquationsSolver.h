@@ -11,6 +11,8 @@
 #ifndef TUDAT_VARIATIONALEQUATIONSSOLVER_H
 #define TUDAT_VARIATIONALEQUATIONSSOLVER_H
 
+#include <iterator>
+
 #include <boost/make_shared.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <boost/tuple/tuple_comparison.hpp>
@@ -20,6 +22,7 @@
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
 #include "Tudat/Mathematics/Interpolators/interpolator.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
 #include "Tudat/Mathematics/BasicMathematics/linearAlgebra.h"
 
 #include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/estimatableParameter.h"
@@ -147,9 +150,11 @@ protected:
      *  [Phi;S;y], with Phi the state transition matrix, S the sensitivity matrix y the state vector.
      *  \param initialStateEstimate vector of initial state (position/velocity) of bodies to be integrated numerically.
      *  order determined by order of bodiesToIntegrate_.
+     *  \param includeSensitivityMatrix Boolean denoting whether the sensitivity matrix S is to be included (if false,
+     *  structure is [Phi;y]).
      *  \return Initial matrix of numerical soluation to variation + state equations.
      */
-    MatrixType createInitialConditions( const VectorType initialStateEstimate )
+    MatrixType createInitialConditions( const VectorType initialStateEstimate, const bool includeSensitivityMatrix = true )
     {
         if( stateTransitionMatrixSize_ != initialStateEstimate.rows( ) )
         {
@@ -157,14 +162,15 @@ protected:
         }
 
         // Initialize initial conditions to zeros.
+        int numberOfVariationalColumns = ( includeSensitivityMatrix ? parameterVectorSize_ : stateTransitionMatrixSize_ );
         MatrixType varSystemInitialState = MatrixType( stateTransitionMatrixSize_,
-                                                       parameterVectorSize_ + 1 ).setZero( );
+                                                       numberOfVariationalColumns + 1 ).setZero( );
 
         // Set initial state transition matrix to identity
         varSystemInitialState.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ).setIdentity( );
 
         // Set initial body states to current estimate of initial body states.
-        varSystemInitialState.block( 0, parameterVectorSize_,
+        varSystemInitialState.block( 0, numberOfVariationalColumns,
                                      stateTransitionMatrixSize_, 1 ) = initialStateEstimate;
 
         return varSystemInitialState;
@@ -174,13 +180,15 @@ protected:
     /*!
      *  Create initial matrix of numerical soluation to variational equations, with structure [Phi;S]. Initial state
      *  transition matrix Phi is identity matrix. Initial sensitivity matrix S is all zeros.
+     *  \param includeSensitivityMatrix Boolean denoting whether the sensitivity matrix S is to be included.
      *  \return Initial matrix solution to variational equations.
      */
-    Eigen::MatrixXd createInitialVariationalEquationsSolution( )
+    Eigen::MatrixXd createInitialVariationalEquationsSolution( const bool includeSensitivityMatrix = true )
     {
         // Initialize initial conditions to zeros.
         Eigen::MatrixXd varSystemInitialState = Eigen::MatrixXd::Zero(
-                    stateTransitionMatrixSize_, parameterVectorSize_ );
+                    stateTransitionMatrixSize_,
+                    ( includeSensitivityMatrix ? parameterVectorSize_ : stateTransitionMatrixSize_ ) );
 
         // Set initial state transition matrix to identity
         varSystemInitialState.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ).setIdentity( );
@@ -597,6 +605,9 @@ public:
      *  end of this contructor (default true).
      *  \param setIntegratedResult Boolean to determine whether to automatically use the integrated results to set
      *  ephemerides (default true).
+     *  \param computeSensitivityMatrixByQuadrature Boolean to determine whether only the state transition matrix is to be
+     *  numerically integrated, with the sensitivity matrix computed (lazily) by quadrature from the state transition matrix
+     *  and the partials w.r.t. the parameters (default false). See SingleArcQuadratureSensitivityMatrixInterface.
      */
     SingleArcVariationalEquationsSolver(
             const simulation_setup::NamedBodyMap& bodyMap,
@@ -608,12 +619,14 @@ public:
             = std::shared_ptr< numerical_integrators::IntegratorSettings< double > >( ),
             const bool clearNumericalSolution = true,
             const bool integrateEquationsOnCreation = true,
-            const bool setIntegratedResult = true ):
+            const bool setIntegratedResult = true,
+            const bool computeSensitivityMatrixByQuadrature = false ):
         VariationalEquationsSolver< StateScalarType, TimeType >(
             bodyMap, parametersToEstimate, clearNumericalSolution ),
         integratorSettings_( integratorSettings ),
         propagatorSettings_( std::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType > >(propagatorSettings ) ),
-        variationalOnlyIntegratorSettings_( variationalOnlyIntegratorSettings )
+        variationalOnlyIntegratorSettings_( variationalOnlyIntegratorSettings ),
+        computeSensitivityMatrixByQuadrature_( computeSensitivityMatrixByQuadrature )
     {
         if( std::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType >  >( propagatorSettings ) == nullptr )
         {
@@ -661,6 +674,7 @@ public:
             variationalEquationsObject_ = std::make_shared< VariationalEquations >(
                         stateDerivativePartials, parametersToEstimate_,
                         dynamicsStateDerivative_->getStateTypeStartIndices( ) );
+            variationalEquationsObject_->setIntegrateSensitivityMatrix( !computeSensitivityMatrixByQuadrature_ );
             dynamicsStateDerivative_->addVariationalEquations( variationalEquationsObject_ );
 
             // Resize solution of variational equations to 2 (state transition and sensitivity matrices)
@@ -678,6 +692,12 @@ public:
                     integrateVariationalAndDynamicalEquations( propagatorSettings_->getInitialStates( ), false );
                 }
             }
+            else if( computeSensitivityMatrixByQuadrature_ )
+            {
+                stateTransitionInterface_ = std::make_shared< SingleArcQuadratureSensitivityMatrixInterface >(
+                            nullptr, std::map< double, Eigen::MatrixXd >( ), std::map< double, Eigen::MatrixXd >( ),
+                            propagatorSettings_->getConventionalStateSize( ), parameterVectorSize_ );
+            }
             else
             {
                 stateTransitionInterface_ = std::make_shared< SingleArcCombinedStateTransitionAndSensitivityMatrixInterface >(
@@ -720,12 +740,16 @@ public:
         variationalEquationsSolution_[ 0 ].clear( );
         variationalEquationsSolution_[ 1 ].clear( );
 
+        // Retrieve number of integrated columns of sensitivity matrix (none if computed by quadrature).
+        int integratedParameterVectorSize = variationalEquationsObject_->getNumberOfIntegratedColumns( );
+
         if( integrateEquationsConcurrently )
         {
             // Create initial conditions from new estimate.
             MatrixType initialVariationalState = this->createInitialConditions(
                         dynamicsStateDerivative_->convertFromOutputSolution(
-                            initialStateEstimate, integratorSettings_->initialTime_ ) );
+                            initialStateEstimate, integratorSettings_->initialTime_ ),
+                        !computeSensitivityMatrixByQuadrature_ );
 
             // Integrate variational and state equations.
             dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 1 );
@@ -744,7 +768,17 @@ public:
                         cumulativeComputationTimeHistory,
                         dynamicsSimulator_->getDependentVariablesFunctions( ),
                         statePostProcessingFunction_,
-                        propagatorSettings_->getPrintInterval( ) );
+                        propagatorSettings_->getPrintInterval( ),
+                        std::chrono::steady_clock::now( ),
+                        std::function< void( const TimeType, const MatrixType&, const Eigen::VectorXd& ) >( ),
+                        true, nullptr,
+                        std::function< void( const TimeType, const MatrixType&, const TimeType, MatrixType&,
+                                             const MatrixType&, const MatrixType& ) >( ),
+                        getParameterPartialSavingFunction< TimeType >( ) );
+            if( computeSensitivityMatrixByQuadrature_ )
+            {
+                setParameterPartialHistory< TimeType, MatrixType >( rawNumericalSolution );
+            }
             simulation_setup::setAreBodiesInPropagation( bodyMap_, false );
 
             std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRaw;
@@ -752,7 +786,7 @@ public:
 
             utilities::createVectorBlockMatrixHistory(
                         rawNumericalSolution, equationsOfMotionNumericalSolutionRaw,
-                        std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
+                        std::make_pair( 0, integratedParameterVectorSize ), stateTransitionMatrixSize_ );
 
             convertNumericalStateSolutionsToOutputSolutions(
                         equationsOfMotionNumericalSolution, equationsOfMotionNumericalSolutionRaw, dynamicsStateDerivative_ );
@@ -763,7 +797,7 @@ public:
             setVariationalEquationsSolution< TimeType, StateScalarType >(
                         rawNumericalSolution, variationalEquationsSolution_,
                         std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
-                        stateTransitionMatrixSize_, parameterVectorSize_ );
+                        stateTransitionMatrixSize_, integratedParameterVectorSize );
         }
         else
         {
@@ -774,7 +808,8 @@ public:
             dynamicsStateDerivative_->setPropagationSettings( { translational_state }, 0, 1 );
             dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
 
-            Eigen::MatrixXd initialVariationalState = this->createInitialVariationalEquationsSolution( );
+            Eigen::MatrixXd initialVariationalState = this->createInitialVariationalEquationsSolution(
+                        !computeSensitivityMatrixByQuadrature_ );
             std::map< double, Eigen::MatrixXd > rawNumericalSolution;
             std::map< double, Eigen::VectorXd > dependentVariableHistory;
             std::map< double, double > cumulativeComputationTimeHistory;
@@ -784,13 +819,24 @@ public:
                         dynamicsSimulator_->getDoubleStateDerivativeFunction( ), rawNumericalSolution, initialVariationalState,
                         variationalOnlyIntegratorSettings_,
                         dynamicsSimulator_->getPropagationTerminationCondition( ),
-                        dependentVariableHistory, cumulativeComputationTimeHistory );
+                        dependentVariableHistory, cumulativeComputationTimeHistory,
+                        std::function< Eigen::VectorXd( ) >( ), std::function< void( Eigen::MatrixXd& ) >( ),
+                        TUDAT_NAN, std::chrono::steady_clock::now( ),
+                        std::function< void( const double, const Eigen::MatrixXd&, const Eigen::VectorXd& ) >( ),
+                        true, nullptr,
+                        std::function< void( const double, const Eigen::MatrixXd&, const double, Eigen::MatrixXd&,
+                                             const Eigen::MatrixXd&, const Eigen::MatrixXd& ) >( ),
+                        getParameterPartialSavingFunction< double >( ) );
+            if( computeSensitivityMatrixByQuadrature_ )
+            {
+                setParameterPartialHistory< double, Eigen::MatrixXd >( rawNumericalSolution );
+            }
             simulation_setup::setAreBodiesInPropagation( bodyMap_, false );
 
             setVariationalEquationsSolution< double, double >(
                         rawNumericalSolution, variationalEquationsSolution_, std::make_pair( 0, 0 ),
                         std::make_pair( 0, stateTransitionMatrixSize_ ),
-                        stateTransitionMatrixSize_, parameterVectorSize_ );
+                        stateTransitionMatrixSize_, integratedParameterVectorSize );
 
         }
 
@@ -880,6 +926,12 @@ private:
         using namespace interpolators;
         using namespace utilities;
 
+        if( computeSensitivityMatrixByQuadrature_ )
+        {
+            resetQuadratureSensitivityMatrixInterface( );
+            return;
+        }
+
         // Create interpolators.
         std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
                 stateTransitionMatrixInterpolator;
@@ -904,6 +956,103 @@ private:
         }
     }
 
+    //! Reset state transition interface for sensitivity matrix computed by quadrature.
+    /*!
+     *  Reset state transition interface for sensitivity matrix computed by quadrature, using the numerically integrated
+     *  state transition matrix history and the parameterPartialHistory_ member.
+     */
+    void resetQuadratureSensitivityMatrixInterface( )
+    {
+        // Create interpolator for state transition matrix.
+        std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
+                stateTransitionMatrixInterpolator =
+                std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
+                    utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( variationalEquationsSolution_[ 0 ] ),
+                    utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( variationalEquationsSolution_[ 0 ] ), 4 );
+
+        // Create (if non-existent) or reset state transition matrix interface
+        if( stateTransitionInterface_ == nullptr )
+        {
+            stateTransitionInterface_ = std::make_shared< SingleArcQuadratureSensitivityMatrixInterface >(
+                        stateTransitionMatrixInterpolator, variationalEquationsSolution_[ 0 ], parameterPartialHistory_,
+                        propagatorSettings_->getConventionalStateSize( ), parameterVectorSize_ );
+        }
+        else
+        {
+            std::dynamic_pointer_cast< SingleArcQuadratureSensitivityMatrixInterface >(
+                        stateTransitionInterface_ )->updateMatrixHistories(
+                        stateTransitionMatrixInterpolator, variationalEquationsSolution_[ 0 ], parameterPartialHistory_ );
+        }
+
+        if( this->clearNumericalSolution_ )
+        {
+            variationalEquationsSolution_[ 0 ].clear( );
+            variationalEquationsSolution_[ 1 ].clear( );
+            parameterPartialHistory_.clear( );
+        }
+    }
+
+    //! Function to retrieve the function that saves the partials w.r.t. parameters at each saved integration step.
+    /*!
+     *  Function to retrieve the function that saves the partials of the state derivative w.r.t. parameters at each saved
+     *  integration step, which is passed to the numerical integration as savedStepStateDerivativeFunction (see
+     *  integrateEquationsFromIntegrator). The partials are retrieved from the variational equations object directly after
+     *  the state derivative has been evaluated at the accepted state of the integrator, so that they are computed without
+     *  additional evaluations of the state derivative, and are not affected by the states at intermediate stages or
+     *  rejected steps of the integrator. The partials are stored in the currentParameterPartialHistory_ member.
+     *  \return Function that saves the partials w.r.t. parameters at a given time (empty function if the sensitivity
+     *  matrix is not computed by quadrature, or if no parameters other than initial states are estimated).
+     */
+    template< typename SolutionTimeType >
+    std::function< void( const SolutionTimeType ) > getParameterPartialSavingFunction( )
+    {
+        currentParameterPartialHistory_.clear( );
+        std::function< void( const SolutionTimeType ) > parameterPartialSavingFunction;
+        if( computeSensitivityMatrixByQuadrature_ && ( parameterVectorSize_ > stateTransitionMatrixSize_ ) )
+        {
+            parameterPartialSavingFunction = [ = ]( const SolutionTimeType currentTime )
+            {
+                currentParameterPartialHistory_[ static_cast< double >( currentTime ) ] =
+                        variationalEquationsObject_->getCurrentParameterPartialMatrix( );
+            };
+        }
+        return parameterPartialSavingFunction;
+    }
+
+    //! Function to set the history of partials w.r.t. parameters at the epochs of the numerical solution.
+    /*!
+     *  Function to set the history of partials of the state derivative w.r.t. parameters (parameterPartialHistory_ member)
+     *  at the epochs of the numerical solution, from the partials that were saved during the numerical integration (see
+     *  getParameterPartialSavingFunction).
+     *  \param rawNumericalSolution Raw numerical solution of the variational equations (and, if applicable, dynamics).
+     */
+    template< typename SolutionTimeType, typename SolutionMatrixType >
+    void setParameterPartialHistory(
+            const std::map< SolutionTimeType, SolutionMatrixType >& rawNumericalSolution )
+    {
+        parameterPartialHistory_.clear( );
+        for( typename std::map< SolutionTimeType, SolutionMatrixType >::const_iterator solutionIterator =
+             rawNumericalSolution.begin( ); solutionIterator != rawNumericalSolution.end( ); solutionIterator++ )
+        {
+            double currentTime = static_cast< double >( solutionIterator->first );
+            if( parameterVectorSize_ == stateTransitionMatrixSize_ )
+            {
+                parameterPartialHistory_[ currentTime ] = Eigen::MatrixXd::Zero( stateTransitionMatrixSize_, 0 );
+            }
+            else if( currentParameterPartialHistory_.count( currentTime ) == 0 )
+            {
+                throw std::runtime_error(
+                            "Error when setting parameter partial history, no partials saved at t=" +
+                            std::to_string( currentTime ) );
+            }
+            else
+            {
+                parameterPartialHistory_[ currentTime ] = currentParameterPartialHistory_.at( currentTime );
+            }
+        }
+        currentParameterPartialHistory_.clear( );
+    }
+
     //! Object used for numerically propagating and managing the solution of the equations of motion.
     std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator_;
 
@@ -929,6 +1078,16 @@ private:
     //! Settings for numerical integrator when integrating only variational equations.
     std::shared_ptr< numerical_integrators::IntegratorSettings< double > > variationalOnlyIntegratorSettings_;
 
+    //! Boolean denoting whether only the state transition matrix is integrated, and sensitivity matrix found by quadrature.
+    bool computeSensitivityMatrixByQuadrature_;
+
+    //! History of partials of state derivative w.r.t. parameters, used when sensitivity matrix is computed by quadrature.
+    std::map< double, Eigen::MatrixXd > parameterPartialHistory_;
+
+    //! History of partials of state derivative w.r.t. parameters, as saved during the current numerical integration
+    //! (may contain epochs that are not in the final numerical solution).
+    std::map< double, Eigen::MatrixXd > currentParameterPartialHistory_;
+
     //! Object used to compute the full state derivative in equations of motion and variational equations.
     /*!
      *  Object used to compute the full state derivative in equations of motion and variational equations,
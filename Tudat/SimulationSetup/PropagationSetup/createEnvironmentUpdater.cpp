@@ -8,6 +8,8 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModelTypes.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModelTypes.h"
 #include "Tudat/SimulationSetup/PropagationSetup/createEnvironmentUpdater.h"
@@ -494,6 +496,74 @@ createTranslationalEquationsOfMotionEnvironmentUpdaterSettings(
     return environmentModelsToUpdate;
 }
 
+//! Get lists of required environment model update settings from the slow and other accelerations of a multi-rate evaluation
+void createMultiRateTranslationalEquationsOfMotionEnvironmentUpdaterSettings(
+        const basic_astrodynamics::AccelerationMap& translationalAccelerationModels,
+        const std::shared_ptr< MultiRateAccelerationSettings > multiRateSettings,
+        const simulation_setup::NamedBodyMap& bodyMap,
+        std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >& slowAccelerationUpdates,
+        std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >& otherAccelerationUpdates )
+{
+    using namespace basic_astrodynamics;
+
+    // Split acceleration models into slow and other models (all accelerated bodies are retained as keys, as they are
+    // used to identify the propagated bodies).
+    AccelerationMap slowAccelerationModels;
+    AccelerationMap otherAccelerationModels;
+    AccelerationMap companionAccelerationModels;
+    for( AccelerationMap::const_iterator acceleratedBodyIterator = translationalAccelerationModels.begin( );
+         acceleratedBodyIterator != translationalAccelerationModels.end( ); acceleratedBodyIterator++ )
+    {
+        slowAccelerationModels[ acceleratedBodyIterator->first ];
+        otherAccelerationModels[ acceleratedBodyIterator->first ];
+        companionAccelerationModels[ acceleratedBodyIterator->first ];
+
+        for( SingleBodyAccelerationMap::const_iterator accelerationModelIterator = acceleratedBodyIterator->second.begin( );
+             accelerationModelIterator != acceleratedBodyIterator->second.end( ); accelerationModelIterator++ )
+        {
+            for( unsigned int i = 0; i < accelerationModelIterator->second.size( ); i++ )
+            {
+                AvailableAcceleration currentAccelerationModelType =
+                        getAccelerationModelType( accelerationModelIterator->second.at( i ) );
+                if( std::find( multiRateSettings->slowAccelerationTypes_.begin( ),
+                               multiRateSettings->slowAccelerationTypes_.end( ),
+                               currentAccelerationModelType ) == multiRateSettings->slowAccelerationTypes_.end( ) )
+                {
+                    otherAccelerationModels[ acceleratedBodyIterator->first ][ accelerationModelIterator->first ].
+                            push_back( accelerationModelIterator->second.at( i ) );
+                }
+                else
+                {
+                    slowAccelerationModels[ acceleratedBodyIterator->first ][ accelerationModelIterator->first ].
+                            push_back( accelerationModelIterator->second.at( i ) );
+
+                    // Low-degree spherical harmonic terms are evaluated at each call
+                    if( currentAccelerationModelType == spherical_harmonic_gravity &&
+                            multiRateSettings->fastSphericalHarmonicsDegree_ >= 0 )
+                    {
+                        companionAccelerationModels[ acceleratedBodyIterator->first ][ accelerationModelIterator->first ].
+                                push_back( accelerationModelIterator->second.at( i ) );
+                    }
+                }
+            }
+        }
+    }
+
+    addEnvironmentUpdates(
+                slowAccelerationUpdates,
+                createTranslationalEquationsOfMotionEnvironmentUpdaterSettings( slowAccelerationModels, bodyMap ) );
+    addEnvironmentUpdates(
+                otherAccelerationUpdates,
+                createTranslationalEquationsOfMotionEnvironmentUpdaterSettings( otherAccelerationModels, bodyMap ) );
+
+    // Companion models of spherical harmonic accelerations require the same updates as the full model, except for the
+    // gravity field coefficients, which are cached by the full model at each full evaluation.
+    std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > > companionAccelerationUpdates =
+            createTranslationalEquationsOfMotionEnvironmentUpdaterSettings( companionAccelerationModels, bodyMap );
+    companionAccelerationUpdates.erase( spherical_harmonic_gravity_field_update );
+    addEnvironmentUpdates( otherAccelerationUpdates, companionAccelerationUpdates );
+}
+
 //! Get list of required environment model update settings from mass rate models.
 std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >
 createMassPropagationEnvironmentUpdaterSettings(
@@ -71,6 +71,25 @@ createTranslationalEquationsOfMotionEnvironmentUpdaterSettings(
         const basic_astrodynamics::AccelerationMap& translationalAccelerationModels,
         const simulation_setup::NamedBodyMap& bodyMap );
 
+//! Get lists of required environment model update settings from the slow and other accelerations of a multi-rate evaluation
+/*!
+ * Get lists of required environment model update settings from the slow and other translational accelerations of a
+ * multi-rate evaluation (see MultiRateAccelerationSettings). The updates required by the companion (low-degree)
+ * models of slow spherical harmonic accelerations, which are evaluated at each call, are added to the other updates.
+ * \param translationalAccelerationModels List of acceleration models used in simulation.
+ * \param multiRateSettings Settings for the multi-rate evaluation of the accelerations.
+ * \param bodyMap List of body objects used in the simulations.
+ * \param slowAccelerationUpdates List of updates required by the slow accelerations (extended by this function).
+ * \param otherAccelerationUpdates List of updates required by the accelerations that are evaluated at each call
+ * (extended by this function).
+ */
+void createMultiRateTranslationalEquationsOfMotionEnvironmentUpdaterSettings(
+        const basic_astrodynamics::AccelerationMap& translationalAccelerationModels,
+        const std::shared_ptr< MultiRateAccelerationSettings > multiRateSettings,
+        const simulation_setup::NamedBodyMap& bodyMap,
+        std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >& slowAccelerationUpdates,
+        std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > >& otherAccelerationUpdates );
+
 //! Get list of required environment model update settings from mass rate models.
 /*!
  * Get list of required environment model update settings from mass rate models.
@@ -249,6 +268,84 @@ std::vector< std::string > > createEnvironmentUpdaterSettings(
 
 }
 
+//! Get list of environment model updates that are only required by the slow accelerations of a multi-rate evaluation.
+/*!
+* Get list of environment model updates that are only required by the slow accelerations of a multi-rate evaluation
+* (see MultiRateAccelerationSettings). These updates need only be performed at the state derivative evaluations at
+* which the slow accelerations are fully evaluated (see EnvironmentUpdater::setDeferredUpdates). Updates that are also
+* required by any other acceleration, other type of dynamics, dependent variable or termination condition are not
+* included.
+* \param propagatorSettings Object providing the full settings for the dynamics that are to be propagated.
+* \param bodyMap List of body objects used in the simulations.
+* \return List of updates that are only required by the slow accelerations (empty if no multi-rate evaluation is used).
+*/
+template< typename StateScalarType >
+std::map< propagators::EnvironmentModelsToUpdate,
+std::vector< std::string > > createMultiRateDeferredEnvironmentUpdaterSettings(
+        const std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > propagatorSettings,
+        const simulation_setup::NamedBodyMap& bodyMap )
+{
+    std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > > slowAccelerationUpdates;
+    std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > > otherUpdates;
+
+    // Retrieve settings for each type of dynamics
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > > singleTypePropagatorSettings;
+    if( propagatorSettings->getStateType( ) == hybrid )
+    {
+        std::shared_ptr< MultiTypePropagatorSettings< StateScalarType > > multiTypePropagatorSettings =
+                std::dynamic_pointer_cast< MultiTypePropagatorSettings< StateScalarType > >( propagatorSettings );
+        for( typename std::map< IntegratedStateType,
+             std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > > >::const_iterator
+             typeIterator = multiTypePropagatorSettings->propagatorSettingsMap_.begin( );
+             typeIterator != multiTypePropagatorSettings->propagatorSettingsMap_.end( ); typeIterator++ )
+        {
+            singleTypePropagatorSettings.insert(
+                        singleTypePropagatorSettings.end( ), typeIterator->second.begin( ), typeIterator->second.end( ) );
+        }
+
+        addEnvironmentUpdates( otherUpdates, createEnvironmentUpdaterSettings(
+                                   propagatorSettings->getDependentVariablesToSave( ), bodyMap ) );
+        addEnvironmentUpdates( otherUpdates, createEnvironmentUpdaterSettings(
+                                   propagatorSettings->getTerminationSettings( ), bodyMap ) );
+    }
+    else
+    {
+        singleTypePropagatorSettings.push_back( propagatorSettings );
+    }
+
+    // Split updates into those required only by slow accelerations, and all others
+    for( unsigned int i = 0; i < singleTypePropagatorSettings.size( ); i++ )
+    {
+        std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType > > translationalPropagatorSettings =
+                std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType > >(
+                    singleTypePropagatorSettings.at( i ) );
+        if( translationalPropagatorSettings != nullptr &&
+                translationalPropagatorSettings->multiRateAccelerationSettings_ != nullptr )
+        {
+            createMultiRateTranslationalEquationsOfMotionEnvironmentUpdaterSettings(
+                        translationalPropagatorSettings->getAccelerationsMap( ),
+                        translationalPropagatorSettings->multiRateAccelerationSettings_,
+                        bodyMap, slowAccelerationUpdates, otherUpdates );
+
+            // States of central bodies are required at each call
+            addEnvironmentUpdates( otherUpdates, { { body_translational_state_update,
+                                                     translationalPropagatorSettings->centralBodies_ } } );
+            addEnvironmentUpdates( otherUpdates, createEnvironmentUpdaterSettings(
+                                       translationalPropagatorSettings->getDependentVariablesToSave( ), bodyMap ) );
+            addEnvironmentUpdates( otherUpdates, createEnvironmentUpdaterSettings(
+                                       translationalPropagatorSettings->getTerminationSettings( ), bodyMap ) );
+        }
+        else
+        {
+            addEnvironmentUpdates( otherUpdates, createEnvironmentUpdaterSettings< StateScalarType >(
+                                       singleTypePropagatorSettings.at( i ), bodyMap, true ) );
+        }
+    }
+
+    removeEnvironmentUpdates( slowAccelerationUpdates, otherUpdates );
+    return slowAccelerationUpdates;
+}
+
 //! Function to create 'brute-force' update settings, in which each environment model is updated.
 /*!
  * Function to create 'brute-force' update settings, in which each
@@ -248,6 +248,13 @@ createTranslationalStateDerivativeModel(
         throw std::runtime_error( "Error, did not recognize translational state propagation type: " +
                                   std::to_string( translationPropagatorSettings->propagator_ ) );
     }
+
+    // Set multi-rate evaluation of accelerations, if required.
+    if( translationPropagatorSettings->multiRateAccelerationSettings_ != nullptr )
+    {
+        std::dynamic_pointer_cast< NBodyStateDerivative< StateScalarType, TimeType > >( stateDerivativeModel )->
+                setMultiRateAccelerationSettings( translationPropagatorSettings->multiRateAccelerationSettings_ );
+    }
     return stateDerivativeModel;
 }
 
@@ -302,6 +309,13 @@ std::shared_ptr< SingleStateTypeDerivative< StateScalarType, TimeType > > create
                                   std::to_string( rotationPropagatorSettings->propagator_ ) );
     }
 
+    // Set sub-cycling of rotational dynamics, if required.
+    if( rotationPropagatorSettings->subCyclingSettings_ != nullptr )
+    {
+        std::dynamic_pointer_cast< RotationalMotionStateDerivative< StateScalarType, TimeType > >( stateDerivativeModel )->
+                setSubCyclingSettings( rotationPropagatorSettings->subCyclingSettings_ );
+    }
+
     return stateDerivativeModel;
 }
 
@@ -19,6 +19,7 @@
 
 #include "Tudat/Basics/tudatTypeTraits.h"
 #include "Tudat/Basics/utilities.h"
+#include "Tudat/InputOutput/binaryHistoryFile.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
 #include "Tudat/Astrodynamics/Ephemerides/frameManager.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
@@ -26,6 +27,7 @@
 #include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
 #include "Tudat/SimulationSetup/PropagationSetup/createStateDerivativeModel.h"
 #include "Tudat/SimulationSetup/PropagationSetup/createEnvironmentUpdater.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationEvents.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationTermination.h"
 #include "Tudat/Astrodynamics/Propagators/dynamicsStateDerivativeModel.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
@@ -407,7 +409,8 @@ public:
             std::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType > >( propagatorSettings ) ),
         initialPropagationTime_( integratorSettings_->initialTime_ ),
         printNumberOfFunctionEvaluations_( printNumberOfFunctionEvaluations ), initialClockTime_( initialClockTime ),
-        propagationTerminationReason_( std::make_shared< PropagationTerminationDetails >( propagation_never_run ) )
+        propagationTerminationReason_( std::make_shared< PropagationTerminationDetails >( propagation_never_run ) ),
+        saveHistoryInMemory_( true )
     {
         if( propagatorSettings == nullptr )
         {
@@ -449,6 +452,24 @@ public:
                                      environmentUpdater_, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3 ) );
         }
 
+        // Only perform environment updates required by slow accelerations of multi-rate evaluation when these are
+        // fully evaluated (weak pointer used, as the environment updater is owned by the state derivative model)
+        std::map< propagators::EnvironmentModelsToUpdate, std::vector< std::string > > deferredEnvironmentUpdates =
+                createMultiRateDeferredEnvironmentUpdaterSettings< StateScalarType >( propagatorSettings_, bodyMap_ );
+        if( deferredEnvironmentUpdates.size( ) > 0 )
+        {
+            std::weak_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative =
+                    dynamicsStateDerivative_;
+            environmentUpdater_->setDeferredUpdates(
+                        deferredEnvironmentUpdates, [ dynamicsStateDerivative ]( const TimeType currentTime )
+            {
+                std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > lockedStateDerivative =
+                        dynamicsStateDerivative.lock( );
+                return ( lockedStateDerivative == nullptr ) ||
+                        lockedStateDerivative->areSlowAccelerationEnvironmentUpdatesRequired( currentTime );
+            } );
+        }
+
         propagationTerminationCondition_ = createPropagationTerminationConditions(
                     propagatorSettings_->getTerminationSettings( ), bodyMap_, integratorSettings->initialTimeStep_ );
 
@@ -510,7 +531,20 @@ public:
         // Reset functions
         dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
         dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
+
+        // Slow accelerations of multi-rate evaluation are only fully evaluated at accepted steps (see
+        // createAcceptedStepFunction)
+        if( dynamicsStateDerivative_->isMultiRateAccelerationEvaluationUsed( ) )
+        {
+            dynamicsStateDerivative_->resetMultiRateAccelerationEvaluators( true );
+        }
         dynamicsStateDerivative_->resetCumulativeFunctionEvaluationCounter( );
+        if( propagationProfiler_ != nullptr )
+        {
+            propagationProfiler_->resetProfilingData( );
+        }
+        binaryHistoryWriter_ = nullptr;
+        propagationEventHistory_.clear( );
 
         // Reset initial time to ensure consistency with multi-arc propagation.
         integratorSettings_->initialTime_ = this->initialPropagationTime_;
@@ -518,20 +552,51 @@ public:
         // Integrate equations of motion numerically.
         resetPropagationTerminationConditions( );
         simulation_setup::setAreBodiesInPropagation( bodyMap_, true );
-        propagationTerminationReason_ =
-                EquationIntegrationInterface< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType >::integrateEquations(
-                    stateDerivativeFunction_, equationsOfMotionNumericalSolutionRaw_,
-                    dynamicsStateDerivative_->convertFromOutputSolution(
-                        initialStates, this->initialPropagationTime_ ), integratorSettings_,
-                    propagationTerminationCondition_,
-                    dependentVariableHistory_,
-                    cumulativeComputationTimeHistory_,
-                    dependentVariablesFunctions_,
-                    statePostProcessingFunction_,
-                    propagatorSettings_->getPrintInterval( ),
-                    initialClockTime_ );
+        switch( getFixedPropagatedStateSize( ) )
+        {
+        case 6:
+            integrateEquationsOfMotionWithFixedSizeState< 6 >( initialStates );
+            break;
+        case 7:
+            integrateEquationsOfMotionWithFixedSizeState< 7 >( initialStates );
+            break;
+        default:
+            propagationTerminationReason_ =
+                    EquationIntegrationInterface< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType >::integrateEquations(
+                        stateDerivativeFunction_, equationsOfMotionNumericalSolutionRaw_,
+                        dynamicsStateDerivative_->convertFromOutputSolution(
+                            initialStates, this->initialPropagationTime_ ), integratorSettings_,
+                        propagationTerminationCondition_,
+                        dependentVariableHistory_,
+                        cumulativeComputationTimeHistory_,
+                        dependentVariablesFunctions_,
+                        statePostProcessingFunction_,
+                        propagatorSettings_->getPrintInterval( ),
+                        initialClockTime_,
+                        createSavedStepOutputFunction< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
+                        saveHistoryInMemory_,
+                        createPropagationEventDetector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
+                        createSubCycledStateUpdateFunction( ),
+                        std::function< void( const TimeType ) >( ),
+                        createAcceptedStepFunction( ) );
+            break;
+        }
         simulation_setup::setAreBodiesInPropagation( bodyMap_, false );
 
+        // Finalize binary history file
+        if( binaryHistoryWriter_ != nullptr )
+        {
+            binaryHistoryWriter_->close( );
+            binaryHistoryWriter_ = nullptr;
+        }
+
+        // Retrieve events that occurred during propagation
+        if( retrieveEventHistoryFunction_ != nullptr )
+        {
+            propagationEventHistory_ = retrieveEventHistoryFunction_( );
+            retrieveEventHistoryFunction_ = nullptr;
+        }
+
         // Convert numerical solution to conventional state
         dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
                     equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionRaw_ );
@@ -721,6 +786,91 @@ public:
         return dynamicsStateDerivative_;
     }
 
+    //! Function to set the object used to profile the computation time of the models used in the propagation.
+    /*!
+     * Function to set the object used to profile the computation time of the models used in the propagation (environment
+     * updates, acceleration, torque and mass rate models and variational equations). The profiling data is reset at the
+     * start of each propagation.
+     * \param propagationProfiler Object used to profile the computation time (nullptr to disable profiling).
+     */
+    void setPropagationProfiler( const std::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        propagationProfiler_ = propagationProfiler;
+        environmentUpdater_->setPropagationProfiler( propagationProfiler );
+        dynamicsStateDerivative_->setPropagationProfiler( propagationProfiler );
+    }
+
+    //! Function to retrieve the object used to profile the computation time of the models used in the propagation.
+    /*!
+     * Function to retrieve the object used to profile the computation time of the models used in the propagation.
+     * \return Object used to profile the computation time (nullptr if not profiled).
+     */
+    std::shared_ptr< PropagationProfiler > getPropagationProfiler( )
+    {
+        return propagationProfiler_;
+    }
+
+    //! Function to retrieve the computation time breakdown of the last propagation.
+    /*!
+     * Function to retrieve the computation time breakdown of the last propagation, as obtained from the object set by
+     * the setPropagationProfiler function.
+     * \return Map with, per profiled computation, the total computation time (in seconds) and number of calls.
+     */
+    std::map< std::string, std::pair< double, unsigned int > > getProfilingResults( )
+    {
+        if( propagationProfiler_ == nullptr )
+        {
+            throw std::runtime_error( "Error when retrieving profiling results, no profiler has been set" );
+        }
+        return propagationProfiler_->getProfilingResults( );
+    }
+
+    //! Function to set a binary history file to which the propagation results are streamed during the propagation.
+    /*!
+     * Function to set a binary history file to which the propagation results are streamed during the propagation, with
+     * one record per saved step, containing the state (in conventional form, as in
+     * getEquationsOfMotionNumericalSolution) and the dependent variables. The file is overwritten by each propagation,
+     * and can be read with the input_output::BinaryHistoryReader.
+     * \param binaryHistoryFileName Name of the file to which the results are streamed (empty to disable streaming).
+     * \param saveHistoryInMemory Boolean denoting whether the state and dependent variable histories are also to be
+     * retained in memory. If false, only the final saved step is retained in memory (which is not compatible with
+     * setting the integrated result in the environment).
+     */
+    void setBinaryHistoryOutput( const std::string& binaryHistoryFileName, const bool saveHistoryInMemory = true )
+    {
+        if( !saveHistoryInMemory && binaryHistoryFileName != "" && this->setIntegratedResult_ )
+        {
+            throw std::runtime_error( "Error when setting binary history output, histories must be retained in memory "
+                                      "when setting integrated result in environment." );
+        }
+        binaryHistoryFileName_ = binaryHistoryFileName;
+        saveHistoryInMemory_ = ( binaryHistoryFileName == "" ) || saveHistoryInMemory;
+    }
+
+    //! Function to set the events that are to be detected during the propagation.
+    /*!
+     * Function to set the events that are to be detected during the propagation. The epoch of each event is determined
+     * by root finding on an interpolation of the state within the step in which it occurred. Events are logged in the
+     * event history, and may terminate the propagation exactly at the event (in addition to the regular termination
+     * conditions). The events are created at the start of each propagation.
+     * \param propagationEventSettings Settings for the events that are to be detected (empty to disable event detection).
+     */
+    void setPropagationEvents(
+            const std::vector< std::shared_ptr< PropagationEventSettings > >& propagationEventSettings )
+    {
+        propagationEventSettings_ = propagationEventSettings;
+    }
+
+    //! Function to retrieve the events that occurred during the last propagation.
+    /*!
+     * Function to retrieve the events that occurred during the last propagation, in chronological order.
+     * \return Events that occurred during the last propagation.
+     */
+    std::vector< PropagationEventOccurrence > getPropagationEventHistory( )
+    {
+        return propagationEventHistory_;
+    }
+
     //! Function to retrieve the object defining when the propagation is to be terminated.
     /*!
      * Function to retrieve the object defining when the propagation is to be terminated.
@@ -858,6 +1008,313 @@ protected:
     //! Interface object that updates current environment and returns state derivative from single function call.
     std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative_;
 
+    //! Object used to profile the computation time of the models used in the propagation (nullptr if not profiled).
+    std::shared_ptr< PropagationProfiler > propagationProfiler_;
+
+    //! Function to retrieve the description of the variables in each record of the binary history file.
+    /*!
+     *  Function to retrieve the description of the variables in each record of the binary history file, i.e. the
+     *  propagated states (per state type and body), followed by the dependent variables.
+     *  \param dependentVariablesSize Total size of the dependent variables.
+     *  \return Description of the variables in each record of the binary history file.
+     */
+    std::vector< input_output::BinaryHistoryVariable > getBinaryHistoryVariables( const int dependentVariablesSize )
+    {
+        std::vector< input_output::BinaryHistoryVariable > binaryHistoryVariables;
+
+        // Add propagated states
+        int totalStateSize = propagatorSettings_->getConventionalStateSize( );
+        int currentStateSize = 0;
+        std::map< IntegratedStateType, std::vector< std::pair< std::string, std::string > > > integratedStateList =
+                getIntegratedTypeAndBodyList( propagatorSettings_ );
+        for( auto typeIterator : integratedStateList )
+        {
+            for( unsigned int i = 0; i < typeIterator.second.size( ); i++ )
+            {
+                switch( typeIterator.first )
+                {
+                case translational_state:
+                    binaryHistoryVariables.push_back( input_output::BinaryHistoryVariable(
+                                                          "Translational state of " + typeIterator.second.at( i ).first,
+                                                          6, "m, m/s" ) );
+                    break;
+                case rotational_state:
+                    binaryHistoryVariables.push_back( input_output::BinaryHistoryVariable(
+                                                          "Rotational state of " + typeIterator.second.at( i ).first,
+                                                          7, "-, rad/s" ) );
+                    break;
+                case body_mass_state:
+                    binaryHistoryVariables.push_back( input_output::BinaryHistoryVariable(
+                                                          "Mass of " + typeIterator.second.at( i ).first, 1, "kg" ) );
+                    break;
+                default:
+                    // Size of other states is not known a priori, add remaining state entries as single variable.
+                    binaryHistoryVariables.push_back( input_output::BinaryHistoryVariable(
+                                                          "Custom state", totalStateSize - currentStateSize ) );
+                    break;
+                }
+                currentStateSize += binaryHistoryVariables.back( ).numberOfValues_;
+            }
+        }
+        if( currentStateSize != totalStateSize )
+        {
+            throw std::runtime_error( "Error when creating binary history file, inconsistent state size: " +
+                                      std::to_string( currentStateSize ) + ", " + std::to_string( totalStateSize ) );
+        }
+
+        // Add dependent variables
+        for( auto variableIterator = dependentVariableIds_.begin( ); variableIterator != dependentVariableIds_.end( );
+             variableIterator++ )
+        {
+            int nextStartIndex = ( std::next( variableIterator ) != dependentVariableIds_.end( ) ) ?
+                        std::next( variableIterator )->first : dependentVariablesSize;
+            binaryHistoryVariables.push_back( input_output::BinaryHistoryVariable(
+                                                  variableIterator->second, nextStartIndex - variableIterator->first ) );
+        }
+
+        return binaryHistoryVariables;
+    }
+
+    //! Function to create the function that streams each saved step of the propagation to the binary history file.
+    /*!
+     *  Function to create the function that streams each saved step of the propagation to the binary history file. The
+     *  file is created upon the first saved step, when the size of the dependent variables is known.
+     *  \return Function that streams each saved step of the propagation to the binary history file (empty if no file
+     *  has been set).
+     */
+    template< typename StateType >
+    std::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) > createSavedStepOutputFunction( )
+    {
+        if( binaryHistoryFileName_ == "" )
+        {
+            return std::function< void( const TimeType, const StateType&, const Eigen::VectorXd& ) >( );
+        }
+
+        return [ = ]( const TimeType time, const StateType& state, const Eigen::VectorXd& dependentVariables )
+        {
+            if( binaryHistoryWriter_ == nullptr )
+            {
+                binaryHistoryWriter_ = std::make_shared< input_output::BinaryHistoryWriter >(
+                            binaryHistoryFileName_, getBinaryHistoryVariables( dependentVariables.rows( ) ) );
+            }
+            binaryHistoryWriter_->writeRecord(
+                        static_cast< double >( time ),
+                        dynamicsStateDerivative_->convertToOutputSolution(
+                            Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >( state ), time ).template cast< double >( ),
+                        dependentVariables );
+        };
+    }
+
+    //! Function to retrieve the start index in the conventional state, and the central body, of each translationally
+    //! propagated body.
+    /*!
+     *  Function to retrieve the start index in the conventional state, and the central body, of each translationally
+     *  propagated body, as required for the creation of the propagation events.
+     *  \return Start index in the conventional state, and central body, of each translationally propagated body.
+     */
+    std::map< std::string, std::pair< int, std::string > > getTranslationalStateIndices( )
+    {
+        // Retrieve translational propagator settings (translational state is first in conventional state vector)
+        std::vector< std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType > > >
+                translationalPropagatorSettingsList;
+        if( propagatorSettings_->getStateType( ) == translational_state )
+        {
+            translationalPropagatorSettingsList.push_back(
+                        std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType > >(
+                            propagatorSettings_ ) );
+        }
+        else if( propagatorSettings_->getStateType( ) == hybrid )
+        {
+            std::shared_ptr< MultiTypePropagatorSettings< StateScalarType > > multiTypePropagatorSettings =
+                    std::dynamic_pointer_cast< MultiTypePropagatorSettings< StateScalarType > >( propagatorSettings_ );
+            if( multiTypePropagatorSettings->propagatorSettingsMap_.count( translational_state ) != 0 )
+            {
+                for( auto settingsIterator :
+                     multiTypePropagatorSettings->propagatorSettingsMap_.at( translational_state ) )
+                {
+                    translationalPropagatorSettingsList.push_back(
+                                std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType > >(
+                                    settingsIterator ) );
+                }
+            }
+        }
+
+        std::map< std::string, std::pair< int, std::string > > translationalStateIndices;
+        int currentStartIndex = 0;
+        for( unsigned int i = 0; i < translationalPropagatorSettingsList.size( ); i++ )
+        {
+            if( translationalPropagatorSettingsList.at( i ) == nullptr )
+            {
+                throw std::runtime_error( "Error when retrieving translational state indices, settings are inconsistent." );
+            }
+            for( unsigned int j = 0; j < translationalPropagatorSettingsList.at( i )->bodiesToIntegrate_.size( ); j++ )
+            {
+                translationalStateIndices[ translationalPropagatorSettingsList.at( i )->bodiesToIntegrate_.at( j ) ] =
+                        std::make_pair( currentStartIndex, translationalPropagatorSettingsList.at( i )->centralBodies_.at( j ) );
+                currentStartIndex += 6;
+            }
+        }
+        return translationalStateIndices;
+    }
+
+    //! Function to create the object detecting the propagation events during the propagation.
+    /*!
+     *  Function to create the object detecting the propagation events during the propagation, and to set the function
+     *  retrieving the event history from it after the propagation.
+     *  \return Object detecting the propagation events (nullptr if no events have been set).
+     */
+    template< typename StateType >
+    std::shared_ptr< PropagationEventDetector< StateType, TimeType, typename std::conditional<
+    std::is_same< TimeType, Time >::value, long double, TimeType >::type > > createPropagationEventDetector( )
+    {
+        typedef PropagationEventDetector< StateType, TimeType, typename std::conditional<
+                std::is_same< TimeType, Time >::value, long double, TimeType >::type > EventDetectorType;
+        if( propagationEventSettings_.size( ) == 0 )
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr< EventDetectorType > eventDetector = std::make_shared< EventDetectorType >(
+                    createPropagationEvents( propagationEventSettings_, bodyMap_, getTranslationalStateIndices( ) ),
+                    [ = ]( const TimeType time, const StateType& state )
+        {
+            return dynamicsStateDerivative_->convertToOutputSolution(
+                        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >( state ), time ).template cast< double >( );
+        } );
+        retrieveEventHistoryFunction_ = std::bind( &EventDetectorType::getEventHistory, eventDetector );
+        return eventDetector;
+    }
+
+    //! Function to retrieve the size of the propagated state, if a fixed-size state is to be used in the propagation.
+    /*!
+     *  Function to retrieve the size of the propagated state, if a fixed-size state is to be used in the propagation, i.e.
+     *  if the useFixedSizeState_ flag of the TranslationalStatePropagatorSettings is set.
+     *  \return Size of the propagated state (6 or 7) if a fixed-size state is to be used, 0 otherwise.
+     */
+    int getFixedPropagatedStateSize( )
+    {
+        std::shared_ptr< TranslationalStatePropagatorSettings< StateScalarType > > translationalPropagatorSettings =
+                std::dynamic_pointer_cast< TranslationalStatePropagatorSettings< StateScalarType > >( propagatorSettings_ );
+        if( translationalPropagatorSettings == nullptr || !translationalPropagatorSettings->useFixedSizeState_ )
+        {
+            return 0;
+        }
+
+        int propagatedStateSize = translationalPropagatorSettings->getPropagatedStateSize( );
+        if( translationalPropagatorSettings->bodiesToIntegrate_.size( ) != 1 ||
+                ( propagatedStateSize != 6 && propagatedStateSize != 7 ) )
+        {
+            throw std::runtime_error( "Error in dynamics simulator, fixed-size state can only be used when propagating a "
+                                      "single body, found propagated state of size " + std::to_string( propagatedStateSize ) );
+        }
+        return propagatedStateSize;
+    }
+
+    //! Function to create the function that updates the sub-cycled states after each integration step.
+    /*!
+     *  Function to create the function that updates the sub-cycled states after each integration step, which is passed to
+     *  the numerical integration. Currently, only the rotational state can be sub-cycled (see
+     *  RotationalSubCyclingSettings).
+     *  \return Function updating the sub-cycled states after each integration step (empty if no states are sub-cycled).
+     */
+    std::function< void( const TimeType, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&,
+                         const TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&,
+                         const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&,
+                         const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& ) > createSubCycledStateUpdateFunction( )
+    {
+        std::function< void( const TimeType, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&,
+                             const TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&,
+                             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >&,
+                             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& ) > subCycledStateUpdateFunction;
+        if( dynamicsStateDerivative_->isRotationalStateSubCycled( ) )
+        {
+            subCycledStateUpdateFunction =
+                    std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::updateSubCycledRotationalState,
+                               dynamicsStateDerivative_, std::placeholders::_1, std::placeholders::_2,
+                               std::placeholders::_3, std::placeholders::_4, std::placeholders::_5,
+                               std::placeholders::_6 );
+        }
+        return subCycledStateUpdateFunction;
+    }
+
+    //! Function to create the function that is called after each accepted integration step.
+    /*!
+     *  Function to create the function that is called after each accepted integration step, which is passed to the
+     *  numerical integration. It signals the accepted step to the multi-rate acceleration evaluators (see
+     *  MultiRateAccelerationEvaluator::signalAcceptedStep), so that the slow accelerations are only fully evaluated at
+     *  accepted states, without any additional state derivative evaluations.
+     *  \return Function called after each accepted integration step (empty if multi-rate acceleration evaluation is not
+     *  used).
+     */
+    std::function< void( const TimeType ) > createAcceptedStepFunction( )
+    {
+        std::function< void( const TimeType ) > acceptedStepFunction;
+        if( dynamicsStateDerivative_->isMultiRateAccelerationEvaluationUsed( ) )
+        {
+            std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > dynamicsStateDerivative =
+                    dynamicsStateDerivative_;
+            acceptedStepFunction = [ dynamicsStateDerivative ]( const TimeType )
+            {
+                dynamicsStateDerivative->signalAcceptedStepToMultiRateAccelerationEvaluators( );
+            };
+        }
+        return acceptedStepFunction;
+    }
+
+    //! Function to numerically integrate the equations of motion with a fixed-size state vector.
+    /*!
+     *  Function to numerically integrate the equations of motion with a fixed-size state vector, so that the integrator
+     *  performs its state arithmetic on fixed-size vectors. The state derivative is evaluated on dynamic-size vectors,
+     *  through computeFixedSizeStateDerivative. The resulting (raw) numerical solution is converted to the
+     *  dynamic-size equationsOfMotionNumericalSolutionRaw_ map upon completion of the propagation.
+     *  \param initialStates Initial state vector that is to be used for numerical integration.
+     */
+    template< int StateSize >
+    void integrateEquationsOfMotionWithFixedSizeState(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& initialStates )
+    {
+        typedef Eigen::Matrix< StateScalarType, StateSize, 1 > FixedSizeStateType;
+
+        // Create fixed-size state derivative and post-processing functions
+        std::function< FixedSizeStateType( const TimeType, const FixedSizeStateType& ) > fixedSizeStateDerivativeFunction =
+                std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::template
+                           computeFixedSizeStateDerivative< StateSize >,
+                           dynamicsStateDerivative_, std::placeholders::_1, std::placeholders::_2 );
+        std::function< void( FixedSizeStateType& ) > fixedSizeStatePostProcessingFunction =
+                std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::template
+                           postProcessFixedSizeState< StateSize >,
+                           dynamicsStateDerivative_, std::placeholders::_1 );
+
+        // Integrate equations of motion numerically.
+        std::map< TimeType, FixedSizeStateType > fixedSizeNumericalSolution;
+        propagationTerminationReason_ =
+                EquationIntegrationInterface< FixedSizeStateType, TimeType >::integrateEquations(
+                    fixedSizeStateDerivativeFunction, fixedSizeNumericalSolution,
+                    FixedSizeStateType( dynamicsStateDerivative_->convertFromOutputSolution(
+                                            initialStates, this->initialPropagationTime_ ) ), integratorSettings_,
+                    propagationTerminationCondition_,
+                    dependentVariableHistory_,
+                    cumulativeComputationTimeHistory_,
+                    dependentVariablesFunctions_,
+                    fixedSizeStatePostProcessingFunction,
+                    propagatorSettings_->getPrintInterval( ),
+                    initialClockTime_,
+                    createSavedStepOutputFunction< FixedSizeStateType >( ),
+                    saveHistoryInMemory_,
+                    createPropagationEventDetector< FixedSizeStateType >( ),
+                    std::function< void( const TimeType, const FixedSizeStateType&, const TimeType, FixedSizeStateType&,
+                                         const FixedSizeStateType&, const FixedSizeStateType& ) >( ),
+                    std::function< void( const TimeType ) >( ),
+                    createAcceptedStepFunction( ) );
+
+        // Set numerical solution in dynamic-size map
+        for( typename std::map< TimeType, FixedSizeStateType >::const_iterator stateIterator =
+             fixedSizeNumericalSolution.begin( ); stateIterator != fixedSizeNumericalSolution.end( ); stateIterator++ )
+        {
+            equationsOfMotionNumericalSolutionRaw_[ stateIterator->first ] = stateIterator->second;
+        }
+    }
+
     //! Function that performs a single state derivative function evaluation.
     /*!
      *  Function that performs a single state derivative function evaluation, will typically be set to
@@ -937,6 +1394,24 @@ protected:
     //! Event that triggered the termination of the propagation
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason_;
 
+    //! Name of the file to which the results are streamed during the propagation (empty if not streamed).
+    std::string binaryHistoryFileName_;
+
+    //! Boolean denoting whether the state and dependent variable histories are retained in memory.
+    bool saveHistoryInMemory_;
+
+    //! Object writing the results to the binary history file during the propagation.
+    std::shared_ptr< input_output::BinaryHistoryWriter > binaryHistoryWriter_;
+
+    //! Settings for the events that are to be detected during the propagation.
+    std::vector< std::shared_ptr< PropagationEventSettings > > propagationEventSettings_;
+
+    //! Function retrieving the event history from the event detector of the current propagation.
+    std::function< std::vector< PropagationEventOccurrence >( ) > retrieveEventHistoryFunction_;
+
+    //! Events that occurred during the last propagation, in chronological order.
+    std::vector< PropagationEventOccurrence > propagationEventHistory_;
+
 };
 
 //! Function to get a vector of initial states from a vector of propagator settings
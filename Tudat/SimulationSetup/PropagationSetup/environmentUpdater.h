@@ -11,6 +11,7 @@
 #ifndef TUDAT_ENVIRONMENTUPDATER_H
 #define TUDAT_ENVIRONMENTUPDATER_H
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <map>
@@ -25,6 +26,7 @@
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
 #include "Tudat/Astrodynamics/Propagators/environmentUpdateTypes.h"
+#include "Tudat/Astrodynamics/Propagators/propagationProfiler.h"
 
 namespace tudat
 {
@@ -114,14 +116,80 @@ public:
         // Set current state from environment for override settings setIntegratedStatesFromEnvironment
         setStatesFromEnvironment( setIntegratedStatesFromEnvironment, currentTime );
 
+        // Check whether deferred updates (if any) are to be performed
+        const bool skipDeferredUpdates = !( areDeferredUpdatesRequiredFunction_ == nullptr ) &&
+                !areDeferredUpdatesRequiredFunction_( currentTime );
+
         // Evaluate time-dependent update functions (dependent variables of state and time)
         // determined by setUpdateFunctions
+        PropagationProfiler* profiler = propagationProfiler_.get( );
         for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
         {
+            if( skipDeferredUpdates && isUpdateDeferred_.at( i ) )
+            {
+                continue;
+            }
+
+            ScopedProfilingTimer profilingTimer( profiler, getProfilingIndex( profiler, updateProfilingIndices_, i ) );
             updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
         }
     }
 
+    //! Function to set the environment updates that are only to be performed when required.
+    /*!
+     * Function to set the environment updates that are only to be performed when required, e.g. the updates that are
+     * only needed by accelerations that are evaluated at a reduced rate (see MultiRateAccelerationEvaluator). The
+     * deferred updates are skipped by updateEnvironment if the areDeferredUpdatesRequiredFunction returns false for the
+     * current time. Deferred updates that are not in the list of updates of this object are ignored.
+     * \param deferredUpdateSettings List of environment updates that are deferred. The list defines per model type (key)
+     * the bodies for which this environment model update is deferred (values).
+     * \param areDeferredUpdatesRequiredFunction Function returning whether the deferred updates are to be performed at
+     * the current time (nullptr to always perform all updates).
+     */
+    void setDeferredUpdates(
+            const std::map< EnvironmentModelsToUpdate, std::vector< std::string > >& deferredUpdateSettings,
+            const std::function< bool( const TimeType ) > areDeferredUpdatesRequiredFunction )
+    {
+        areDeferredUpdatesRequiredFunction_ = areDeferredUpdatesRequiredFunction;
+        isUpdateDeferred_.assign( updateFunctionVector_.size( ), false );
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            if( deferredUpdateSettings.count( updateFunctionVector_.at( i ).template get< 0 >( ) ) > 0 )
+            {
+                const std::vector< std::string >& deferredBodies =
+                        deferredUpdateSettings.at( updateFunctionVector_.at( i ).template get< 0 >( ) );
+                isUpdateDeferred_[ i ] = ( std::find( deferredBodies.begin( ), deferredBodies.end( ),
+                                                      updateFunctionVector_.at( i ).template get< 1 >( ) ) !=
+                        deferredBodies.end( ) );
+            }
+        }
+    }
+
+    //! Function to set the object used to profile the computation time of the environment update functions.
+    /*!
+     * Function to set the object used to profile the computation time of the environment update functions. Each
+     * update function is registered separately, by its type and the body to which it applies.
+     * \param propagationProfiler Object used to profile the computation time (nullptr to disable profiling).
+     */
+    void setPropagationProfiler( const std::shared_ptr< PropagationProfiler > propagationProfiler )
+    {
+        propagationProfiler_ = propagationProfiler;
+        updateProfilingIndices_.clear( );
+        if( propagationProfiler == nullptr )
+        {
+            return;
+        }
+
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            updateProfilingIndices_.push_back(
+                        propagationProfiler->registerComputation(
+                            "Environment update: " + getEnvironmentUpdateTypeName(
+                                updateFunctionVector_.at( i ).template get< 0 >( ) ) +
+                            "of " + updateFunctionVector_.at( i ).template get< 1 >( ) ) );
+        }
+    }
+
 private:
 
     //! Function to set numerically integrated states in environment.
@@ -682,6 +750,18 @@ private:
     //! time step).
     std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, std::function< void( ) > > > resetFunctionVector_;
 
+    //! Object used to profile the computation time of the update functions (nullptr if not profiled).
+    std::shared_ptr< PropagationProfiler > propagationProfiler_;
+
+    //! Profiling index of each entry of updateFunctionVector_ (empty if not profiled).
+    std::vector< int > updateProfilingIndices_;
+
+    //! Boolean denoting for each entry of updateFunctionVector_ whether it is a deferred update (see setDeferredUpdates).
+    std::vector< bool > isUpdateDeferred_;
+
+    //! Function returning whether the deferred updates are to be performed at the current time (nullptr if none deferred).
+    std::function< bool( const TimeType ) > areDeferredUpdatesRequiredFunction_;
+
 
 
 
@@ -0,0 +1,296 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONEVENTSETTINGS_H
+#define TUDAT_PROPAGATIONEVENTSETTINGS_H
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/RootFinders/createRootFinder.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Enum listing the available types of propagation events.
+enum PropagationEventTypes
+{
+    altitude_crossing_event = 0,
+    node_crossing_event = 1,
+    apsis_event = 2,
+    eclipse_event = 3,
+    custom_event = 4
+};
+
+//! Enum listing the directions of the zero crossing of an event function for which an event is detected.
+enum PropagationEventDirection
+{
+    any_event_crossing = 0,
+    increasing_event_crossing = 1,
+    decreasing_event_crossing = 2
+};
+
+//! Base class for defining propagation event settings.
+/*!
+ *  Base class for defining propagation event settings. An event is defined by a scalar event function of time and
+ *  propagated state, and occurs when this function crosses zero (in the requested direction). Events are detected
+ *  after each accepted integration step, and their epoch is determined by root finding on an interpolation of the
+ *  state within the step (so that no additional propagation is required). Upon occurrence, an event is logged, and
+ *  may terminate the propagation (exactly at the event). Each type of event requires a different derived class.
+ */
+class PropagationEventSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventType Type of event.
+     * \param eventName Name of the event, used to identify its occurrences in the event history.
+     * \param eventDirection Direction of zero crossing of the event function for which the event is detected.
+     * \param terminatePropagation Boolean denoting whether the propagation is to terminate upon the first occurrence of
+     * the event (if false, the event is only logged).
+     * \param rootFinderSettings Settings for root finder used to determine the epoch of the event within a step (with the
+     * time since the start of the step as independent variable).
+     */
+    PropagationEventSettings(
+            const PropagationEventTypes eventType,
+            const std::string& eventName,
+            const PropagationEventDirection eventDirection = any_event_crossing,
+            const bool terminatePropagation = false,
+            const std::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings =
+            std::make_shared< root_finders::RootFinderSettings >( root_finders::bisection_root_finder, 1.0E-8, 200 ) ):
+        eventType_( eventType ), eventName_( eventName ), eventDirection_( eventDirection ),
+        terminatePropagation_( terminatePropagation ), rootFinderSettings_( rootFinderSettings ){ }
+
+    //! Destructor
+    virtual ~PropagationEventSettings( ){ }
+
+    //! Type of event.
+    PropagationEventTypes eventType_;
+
+    //! Name of the event, used to identify its occurrences in the event history.
+    std::string eventName_;
+
+    //! Direction of zero crossing of the event function for which the event is detected.
+    PropagationEventDirection eventDirection_;
+
+    //! Boolean denoting whether the propagation is to terminate upon the first occurrence of the event.
+    bool terminatePropagation_;
+
+    //! Settings for root finder used to determine the epoch of the event within a step.
+    std::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings_;
+};
+
+//! Class for defining an event at which a propagated body crosses a given altitude.
+/*!
+ *  Class for defining an event at which a propagated body crosses a given altitude w.r.t. the average radius of the
+ *  shape model of its central body (the event function is the altitude minus the threshold altitude, so that an
+ *  increasing crossing denotes an ascent through the threshold).
+ */
+class AltitudeCrossingEventSettings: public PropagationEventSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event, used to identify its occurrences in the event history.
+     * \param bodyName Name of the (translationally) propagated body.
+     * \param thresholdAltitude Altitude at which the event occurs.
+     * \param eventDirection Direction of zero crossing of the event function for which the event is detected.
+     * \param terminatePropagation Boolean denoting whether the propagation is to terminate upon the first occurrence of
+     * the event (if false, the event is only logged).
+     */
+    AltitudeCrossingEventSettings(
+            const std::string& eventName,
+            const std::string& bodyName,
+            const double thresholdAltitude,
+            const PropagationEventDirection eventDirection = any_event_crossing,
+            const bool terminatePropagation = false ):
+        PropagationEventSettings( altitude_crossing_event, eventName, eventDirection, terminatePropagation ),
+        bodyName_( bodyName ), thresholdAltitude_( thresholdAltitude ){ }
+
+    //! Destructor
+    ~AltitudeCrossingEventSettings( ){ }
+
+    //! Name of the (translationally) propagated body.
+    std::string bodyName_;
+
+    //! Altitude at which the event occurs.
+    double thresholdAltitude_;
+};
+
+//! Class for defining an event at which a propagated body crosses the xy-plane of the propagation frame.
+/*!
+ *  Class for defining an event at which a propagated body crosses the xy-plane of the propagation frame (centered on
+ *  its central body), i.e. a node crossing w.r.t. the equator or ecliptic of the global frame orientation. The event
+ *  function is the z-component of the position, so that an increasing crossing denotes an ascending node.
+ */
+class NodeCrossingEventSettings: public PropagationEventSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event, used to identify its occurrences in the event history.
+     * \param bodyName Name of the (translationally) propagated body.
+     * \param eventDirection Direction of zero crossing of the event function for which the event is detected
+     * (increasing for ascending node, decreasing for descending node).
+     * \param terminatePropagation Boolean denoting whether the propagation is to terminate upon the first occurrence of
+     * the event (if false, the event is only logged).
+     */
+    NodeCrossingEventSettings(
+            const std::string& eventName,
+            const std::string& bodyName,
+            const PropagationEventDirection eventDirection = any_event_crossing,
+            const bool terminatePropagation = false ):
+        PropagationEventSettings( node_crossing_event, eventName, eventDirection, terminatePropagation ),
+        bodyName_( bodyName ){ }
+
+    //! Destructor
+    ~NodeCrossingEventSettings( ){ }
+
+    //! Name of the (translationally) propagated body.
+    std::string bodyName_;
+};
+
+//! Class for defining an event at which a propagated body passes an apsis of its orbit around its central body.
+/*!
+ *  Class for defining an event at which a propagated body passes an apsis of its orbit around its central body. The
+ *  event function is the inner product of the relative position and velocity, so that an increasing crossing denotes
+ *  a periapsis, and a decreasing crossing an apoapsis.
+ */
+class ApsisEventSettings: public PropagationEventSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event, used to identify its occurrences in the event history.
+     * \param bodyName Name of the (translationally) propagated body.
+     * \param eventDirection Direction of zero crossing of the event function for which the event is detected
+     * (increasing for periapsis, decreasing for apoapsis).
+     * \param terminatePropagation Boolean denoting whether the propagation is to terminate upon the first occurrence of
+     * the event (if false, the event is only logged).
+     */
+    ApsisEventSettings(
+            const std::string& eventName,
+            const std::string& bodyName,
+            const PropagationEventDirection eventDirection = any_event_crossing,
+            const bool terminatePropagation = false ):
+        PropagationEventSettings( apsis_event, eventName, eventDirection, terminatePropagation ),
+        bodyName_( bodyName ){ }
+
+    //! Destructor
+    ~ApsisEventSettings( ){ }
+
+    //! Name of the (translationally) propagated body.
+    std::string bodyName_;
+};
+
+//! Class for defining an event at which a propagated body enters or exits the shadow of an occulting body.
+/*!
+ *  Class for defining an event at which a propagated body enters or exits the shadow of an occulting body, as
+ *  determined by the shadow function (1 if fully illuminated, 0 if in umbra) of the source body. The event function is
+ *  the shadow function minus a threshold value, so that a decreasing crossing denotes the entry into shadow. The
+ *  positions of the source and occulting bodies are obtained from their ephemerides, and their radii from their shape
+ *  models.
+ */
+class EclipseEventSettings: public PropagationEventSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event, used to identify its occurrences in the event history.
+     * \param bodyName Name of the (translationally) propagated body.
+     * \param occultingBodyName Name of the body casting the shadow.
+     * \param sourceBodyName Name of the body emitting the light.
+     * \param shadowFunctionThreshold Value of shadow function at which the event occurs (e.g. close to 1 for penumbra
+     * entry, close to 0 for umbra entry).
+     * \param eventDirection Direction of zero crossing of the event function for which the event is detected
+     * (decreasing for shadow entry, increasing for shadow exit).
+     * \param terminatePropagation Boolean denoting whether the propagation is to terminate upon the first occurrence of
+     * the event (if false, the event is only logged).
+     */
+    EclipseEventSettings(
+            const std::string& eventName,
+            const std::string& bodyName,
+            const std::string& occultingBodyName,
+            const std::string& sourceBodyName = "Sun",
+            const double shadowFunctionThreshold = 0.5,
+            const PropagationEventDirection eventDirection = any_event_crossing,
+            const bool terminatePropagation = false ):
+        PropagationEventSettings( eclipse_event, eventName, eventDirection, terminatePropagation ),
+        bodyName_( bodyName ), occultingBodyName_( occultingBodyName ), sourceBodyName_( sourceBodyName ),
+        shadowFunctionThreshold_( shadowFunctionThreshold ){ }
+
+    //! Destructor
+    ~EclipseEventSettings( ){ }
+
+    //! Name of the (translationally) propagated body.
+    std::string bodyName_;
+
+    //! Name of the body casting the shadow.
+    std::string occultingBodyName_;
+
+    //! Name of the body emitting the light.
+    std::string sourceBodyName_;
+
+    //! Value of shadow function at which the event occurs.
+    double shadowFunctionThreshold_;
+};
+
+//! Class for defining an event from a user-defined event function.
+class CustomEventSettings: public PropagationEventSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event, used to identify its occurrences in the event history.
+     * \param eventFunction Event function, with the time and the propagated state (in conventional form, as in the
+     * numerical solution of the dynamics simulator) as input. Should be continuous, and should not depend on the current
+     * state of the environment (which is not updated to the epochs at which the function is evaluated).
+     * \param eventDirection Direction of zero crossing of the event function for which the event is detected.
+     * \param terminatePropagation Boolean denoting whether the propagation is to terminate upon the first occurrence of
+     * the event (if false, the event is only logged).
+     */
+    CustomEventSettings(
+            const std::string& eventName,
+            const std::function< double( const double, const Eigen::VectorXd& ) > eventFunction,
+            const PropagationEventDirection eventDirection = any_event_crossing,
+            const bool terminatePropagation = false ):
+        PropagationEventSettings( custom_event, eventName, eventDirection, terminatePropagation ),
+        eventFunction_( eventFunction ){ }
+
+    //! Destructor
+    ~CustomEventSettings( ){ }
+
+    //! Event function, with the time and the propagated state (in conventional form) as input.
+    std::function< double( const double, const Eigen::VectorXd& ) > eventFunction_;
+};
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONEVENTSETTINGS_H
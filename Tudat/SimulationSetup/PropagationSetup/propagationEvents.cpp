@@ -0,0 +1,209 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/missionGeometry.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationEvents.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Function to retrieve the position of a body in the global frame from its ephemeris.
+/*!
+ * Function to retrieve the position of a body in the global frame from its ephemeris, by recursively adding the
+ * position of the origin of its ephemeris. Contrary to Body::getStateInBaseFrameFromEphemeris, the current state of the
+ * body is not modified. Bodies that are not in the body map (e.g. the SSB) are assumed to be at the global origin.
+ * \param bodyMap List of body objects.
+ * \param bodyName Name of body for which the position is to be retrieved.
+ * \param time Time at which the position is to be retrieved.
+ * \return Position of the body in the global frame.
+ */
+Eigen::Vector3d getBodyPositionFromEphemeris( const simulation_setup::NamedBodyMap& bodyMap,
+                                              const std::string& bodyName,
+                                              const double time )
+{
+    Eigen::Vector3d bodyPosition = Eigen::Vector3d::Zero( );
+    std::string currentBodyName = bodyName;
+    for( unsigned int i = 0; i < bodyMap.size( ) && bodyMap.count( currentBodyName ) != 0; i++ )
+    {
+        std::shared_ptr< ephemerides::Ephemeris > currentEphemeris = bodyMap.at( currentBodyName )->getEphemeris( );
+        if( currentEphemeris == nullptr )
+        {
+            throw std::runtime_error( "Error when retrieving position of " + bodyName + " for propagation event, " +
+                                      currentBodyName + " has no ephemeris." );
+        }
+        bodyPosition += currentEphemeris->getCartesianState( time ).segment( 0, 3 );
+        currentBodyName = currentEphemeris->getReferenceFrameOrigin( );
+    }
+    return bodyPosition;
+}
+
+//! Function to retrieve the average radius of a body from its shape model.
+double getEventBodyRadius( const simulation_setup::NamedBodyMap& bodyMap, const std::string& bodyName,
+                           const std::string& eventName )
+{
+    if( bodyMap.count( bodyName ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating event " + eventName + ", body " + bodyName + " not found." );
+    }
+    else if( bodyMap.at( bodyName )->getShapeModel( ) == nullptr )
+    {
+        throw std::runtime_error( "Error when creating event " + eventName + ", body " + bodyName +
+                                  " has no shape model." );
+    }
+    return bodyMap.at( bodyName )->getShapeModel( )->getAverageRadius( );
+}
+
+//! Function to retrieve the start index in the propagated state and the central body of a propagated body.
+std::pair< int, std::string > getEventBodyStateIndex(
+        const std::map< std::string, std::pair< int, std::string > >& translationalStateIndices,
+        const std::string& bodyName, const std::string& eventName )
+{
+    if( translationalStateIndices.count( bodyName ) == 0 )
+    {
+        throw std::runtime_error( "Error when creating event " + eventName + ", translational state of body " +
+                                  bodyName + " is not propagated." );
+    }
+    return translationalStateIndices.at( bodyName );
+}
+
+//! Function to create a propagation event from its settings.
+std::shared_ptr< PropagationEvent > createPropagationEvent(
+        const std::shared_ptr< PropagationEventSettings > eventSettings,
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::map< std::string, std::pair< int, std::string > >& translationalStateIndices )
+{
+    std::function< double( const double, const Eigen::VectorXd& ) > eventFunction;
+    std::string eventName = eventSettings->eventName_;
+
+    // Create event function
+    switch( eventSettings->eventType_ )
+    {
+    case altitude_crossing_event:
+    {
+        std::shared_ptr< AltitudeCrossingEventSettings > altitudeEventSettings =
+                std::dynamic_pointer_cast< AltitudeCrossingEventSettings >( eventSettings );
+        if( altitudeEventSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected altitude crossing event settings for event " + eventName );
+        }
+
+        std::pair< int, std::string > stateIndex = getEventBodyStateIndex(
+                    translationalStateIndices, altitudeEventSettings->bodyName_, eventName );
+        double thresholdDistance = getEventBodyRadius( bodyMap, stateIndex.second, eventName ) +
+                altitudeEventSettings->thresholdAltitude_;
+        eventFunction = [ = ]( const double, const Eigen::VectorXd& state )
+        {
+            return state.segment( stateIndex.first, 3 ).norm( ) - thresholdDistance;
+        };
+        break;
+    }
+    case node_crossing_event:
+    {
+        std::shared_ptr< NodeCrossingEventSettings > nodeEventSettings =
+                std::dynamic_pointer_cast< NodeCrossingEventSettings >( eventSettings );
+        if( nodeEventSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected node crossing event settings for event " + eventName );
+        }
+
+        int stateIndex = getEventBodyStateIndex(
+                    translationalStateIndices, nodeEventSettings->bodyName_, eventName ).first;
+        eventFunction = [ = ]( const double, const Eigen::VectorXd& state )
+        {
+            return state( stateIndex + 2 );
+        };
+        break;
+    }
+    case apsis_event:
+    {
+        std::shared_ptr< ApsisEventSettings > apsisEventSettings =
+                std::dynamic_pointer_cast< ApsisEventSettings >( eventSettings );
+        if( apsisEventSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected apsis event settings for event " + eventName );
+        }
+
+        int stateIndex = getEventBodyStateIndex(
+                    translationalStateIndices, apsisEventSettings->bodyName_, eventName ).first;
+        eventFunction = [ = ]( const double, const Eigen::VectorXd& state )
+        {
+            return state.segment( stateIndex, 3 ).dot( state.segment( stateIndex + 3, 3 ) );
+        };
+        break;
+    }
+    case eclipse_event:
+    {
+        std::shared_ptr< EclipseEventSettings > eclipseEventSettings =
+                std::dynamic_pointer_cast< EclipseEventSettings >( eventSettings );
+        if( eclipseEventSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected eclipse event settings for event " + eventName );
+        }
+
+        std::pair< int, std::string > stateIndex = getEventBodyStateIndex(
+                    translationalStateIndices, eclipseEventSettings->bodyName_, eventName );
+        std::string occultingBodyName = eclipseEventSettings->occultingBodyName_;
+        std::string sourceBodyName = eclipseEventSettings->sourceBodyName_;
+        double occultingBodyRadius = getEventBodyRadius( bodyMap, occultingBodyName, eventName );
+        double sourceBodyRadius = getEventBodyRadius( bodyMap, sourceBodyName, eventName );
+        double shadowFunctionThreshold = eclipseEventSettings->shadowFunctionThreshold_;
+
+        eventFunction = [ = ]( const double time, const Eigen::VectorXd& state )
+        {
+            Eigen::Vector3d bodyPosition = getBodyPositionFromEphemeris( bodyMap, stateIndex.second, time ) +
+                    state.segment( stateIndex.first, 3 );
+            return mission_geometry::computeShadowFunction(
+                        getBodyPositionFromEphemeris( bodyMap, sourceBodyName, time ), sourceBodyRadius,
+                        getBodyPositionFromEphemeris( bodyMap, occultingBodyName, time ), occultingBodyRadius,
+                        bodyPosition ) - shadowFunctionThreshold;
+        };
+        break;
+    }
+    case custom_event:
+    {
+        std::shared_ptr< CustomEventSettings > customEventSettings =
+                std::dynamic_pointer_cast< CustomEventSettings >( eventSettings );
+        if( customEventSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, expected custom event settings for event " + eventName );
+        }
+        eventFunction = customEventSettings->eventFunction_;
+        break;
+    }
+    default:
+        throw std::runtime_error( "Error when creating propagation event " + eventName + ", event type " +
+                                  std::to_string( eventSettings->eventType_ ) + " not recognized." );
+    }
+
+    return std::make_shared< PropagationEvent >(
+                eventName, eventFunction, eventSettings->eventDirection_, eventSettings->terminatePropagation_,
+                eventSettings->rootFinderSettings_ );
+}
+
+//! Function to create a list of propagation events from their settings.
+std::vector< std::shared_ptr< PropagationEvent > > createPropagationEvents(
+        const std::vector< std::shared_ptr< PropagationEventSettings > >& eventSettings,
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::map< std::string, std::pair< int, std::string > >& translationalStateIndices )
+{
+    std::vector< std::shared_ptr< PropagationEvent > > propagationEvents;
+    for( unsigned int i = 0; i < eventSettings.size( ); i++ )
+    {
+        propagationEvents.push_back( createPropagationEvent( eventSettings.at( i ), bodyMap, translationalStateIndices ) );
+    }
+    return propagationEvents;
+}
+
+} // namespace propagators
+
+} // namespace tudat
@@ -0,0 +1,516 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROPAGATIONEVENTS_H
+#define TUDAT_PROPAGATIONEVENTS_H
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h"
+#include "Tudat/Mathematics/RootFinders/createRootFinder.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationEventSettings.h"
+#include "Tudat/SimulationSetup/PropagationSetup/propagationTermination.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class for evaluating a single propagation event function, and detecting its zero crossings.
+class PropagationEvent
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event, used to identify its occurrences in the event history.
+     * \param eventFunction Event function, with the time and the propagated state (in conventional form) as input.
+     * \param eventDirection Direction of zero crossing of the event function for which the event is detected.
+     * \param terminatePropagation Boolean denoting whether the propagation is to terminate upon the first occurrence of
+     * the event.
+     * \param rootFinderSettings Settings for root finder used to determine the epoch of the event within a step.
+     */
+    PropagationEvent( const std::string& eventName,
+                      const std::function< double( const double, const Eigen::VectorXd& ) > eventFunction,
+                      const PropagationEventDirection eventDirection,
+                      const bool terminatePropagation,
+                      const std::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings ):
+        eventName_( eventName ), eventFunction_( eventFunction ), eventDirection_( eventDirection ),
+        terminatePropagation_( terminatePropagation ), rootFinderSettings_( rootFinderSettings ){ }
+
+    //! Function to evaluate the event function
+    /*!
+     * Function to evaluate the event function
+     * \param time Time at which the event function is to be evaluated.
+     * \param state Propagated state (in conventional form) at given time.
+     * \return Value of event function.
+     */
+    double evaluateEventFunction( const double time, const Eigen::VectorXd& state )
+    {
+        return eventFunction_( time, state );
+    }
+
+    //! Function to check whether the event function crossed zero (in the requested direction) between two evaluations.
+    /*!
+     * Function to check whether the event function crossed zero (in the requested direction) between two evaluations.
+     * A crossing is only detected if the function is non-zero at the first evaluation, so that an event at which the
+     * function is exactly zero at the end of a step is not detected again in the next step.
+     * \param previousValue Value of event function at the start of the step.
+     * \param currentValue Value of event function at the end of the step.
+     * \return True if the event occurred between the two evaluations.
+     */
+    bool isEventCrossed( const double previousValue, const double currentValue )
+    {
+        bool isIncreasingCrossing = ( previousValue < 0.0 ) && ( currentValue >= 0.0 );
+        bool isDecreasingCrossing = ( previousValue > 0.0 ) && ( currentValue <= 0.0 );
+        switch( eventDirection_ )
+        {
+        case increasing_event_crossing:
+            return isIncreasingCrossing;
+        case decreasing_event_crossing:
+            return isDecreasingCrossing;
+        default:
+            return isIncreasingCrossing || isDecreasingCrossing;
+        }
+    }
+
+    //! Function to retrieve the name of the event.
+    /*!
+     * Function to retrieve the name of the event.
+     * \return Name of the event.
+     */
+    std::string getEventName( )
+    {
+        return eventName_;
+    }
+
+    //! Function to retrieve whether the propagation is to terminate upon the first occurrence of the event.
+    /*!
+     * Function to retrieve whether the propagation is to terminate upon the first occurrence of the event.
+     * \return Boolean denoting whether the propagation is to terminate upon the first occurrence of the event.
+     */
+    bool getTerminatePropagation( )
+    {
+        return terminatePropagation_;
+    }
+
+    //! Function to retrieve the settings for root finder used to determine the epoch of the event within a step.
+    /*!
+     * Function to retrieve the settings for root finder used to determine the epoch of the event within a step.
+     * \return Settings for root finder used to determine the epoch of the event within a step.
+     */
+    std::shared_ptr< root_finders::RootFinderSettings > getRootFinderSettings( )
+    {
+        return rootFinderSettings_;
+    }
+
+private:
+
+    //! Name of the event, used to identify its occurrences in the event history.
+    std::string eventName_;
+
+    //! Event function, with the time and the propagated state (in conventional form) as input.
+    std::function< double( const double, const Eigen::VectorXd& ) > eventFunction_;
+
+    //! Direction of zero crossing of the event function for which the event is detected.
+    PropagationEventDirection eventDirection_;
+
+    //! Boolean denoting whether the propagation is to terminate upon the first occurrence of the event.
+    bool terminatePropagation_;
+
+    //! Settings for root finder used to determine the epoch of the event within a step.
+    std::shared_ptr< root_finders::RootFinderSettings > rootFinderSettings_;
+};
+
+//! Class storing a single occurrence of a propagation event.
+class PropagationEventOccurrence
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event that occurred.
+     * \param eventTime Time at which the event occurred.
+     * \param eventState Propagated state (in conventional form) at which the event occurred.
+     * \param isPropagationTerminated Boolean denoting whether the event terminated the propagation.
+     */
+    PropagationEventOccurrence( const std::string& eventName, const double eventTime,
+                                const Eigen::VectorXd& eventState, const bool isPropagationTerminated ):
+        eventName_( eventName ), eventTime_( eventTime ), eventState_( eventState ),
+        isPropagationTerminated_( isPropagationTerminated ){ }
+
+    //! Name of the event that occurred.
+    std::string eventName_;
+
+    //! Time at which the event occurred.
+    double eventTime_;
+
+    //! Propagated state (in conventional form) at which the event occurred.
+    Eigen::VectorXd eventState_;
+
+    //! Boolean denoting whether the event terminated the propagation.
+    bool isPropagationTerminated_;
+};
+
+//! Class for storing details on the propagation termination when the propagation is terminated by an event.
+class PropagationTerminationDetailsFromEvent: public PropagationTerminationDetails
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param eventName Name of the event that terminated the propagation.
+     */
+    PropagationTerminationDetailsFromEvent( const std::string& eventName ):
+        PropagationTerminationDetails( termination_condition_reached, true ), eventName_( eventName ){ }
+
+    //! Function to retrieve the name of the event that terminated the propagation.
+    /*!
+     * Function to retrieve the name of the event that terminated the propagation.
+     * \return Name of the event that terminated the propagation.
+     */
+    std::string getEventName( )
+    {
+        return eventName_;
+    }
+
+private:
+
+    //! Name of the event that terminated the propagation.
+    std::string eventName_;
+};
+
+//! Class to detect and localize propagation events in each step of a numerical integration.
+/*!
+ *  Class to detect and localize propagation events in each step of a numerical integration. After each accepted step,
+ *  the event functions are evaluated at the end of the step. For each event function that crossed zero during the step,
+ *  the epoch of the crossing is determined by a root finder, using a cubic Hermite interpolation of the state within
+ *  the step. The state derivatives at the start and end of the step that are required for the interpolation are
+ *  retrieved from the integrator, so that no additional state derivative evaluations are needed (for integrators that
+ *  do not provide them, they are evaluated once per step in which an event occurs).
+ */
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType >
+class PropagationEventDetector
+{
+public:
+
+    //! Typedef for scalar type of state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param propagationEvents List of events that are to be detected.
+     * \param conventionalStateFunction Function converting the propagated state to the conventional form, in which the
+     * event functions are defined (if empty, the first column of the propagated state is used directly).
+     */
+    PropagationEventDetector(
+            const std::vector< std::shared_ptr< PropagationEvent > >& propagationEvents,
+            const std::function< Eigen::VectorXd( const TimeType, const StateType& ) > conventionalStateFunction =
+            std::function< Eigen::VectorXd( const TimeType, const StateType& ) >( ) ):
+        propagationEvents_( propagationEvents ), conventionalStateFunction_( conventionalStateFunction ),
+        previousEventFunctionValues_( propagationEvents.size( ), TUDAT_NAN ),
+        currentEventFunctionValues_( propagationEvents.size( ), TUDAT_NAN ){ }
+
+    //! Function to (re)initialize the event detection at the start of a propagation.
+    /*!
+     * Function to (re)initialize the event detection at the start of a propagation, clearing the event history and
+     * evaluating the event functions at the initial time and state.
+     * \param initialTime Initial time of the propagation.
+     * \param initialState Initial propagated state.
+     */
+    void initialize( const TimeType initialTime, const StateType& initialState )
+    {
+        eventHistory_.clear( );
+        evaluateEventFunctions( initialTime, initialState, previousEventFunctionValues_ );
+    }
+
+    //! Function to detect the events in the last step taken by an integrator.
+    /*!
+     * Function to detect the events in the last step taken by an integrator, and to add their occurrences to the event
+     * history (in chronological order). If a terminating event occurred, the events occurring after it are discarded,
+     * and the time and state of the terminating event are returned by reference. The integrator is not modified.
+     * \param integrator Numerical integrator that has just performed a step.
+     * \param terminationTime Time of the terminating event, if any (returned by reference).
+     * \param terminationState Propagated state at the terminating event, if any (returned by reference).
+     * \return True if a terminating event occurred in the last step, false otherwise.
+     */
+    bool processLastStep(
+            const std::shared_ptr< numerical_integrators::NumericalIntegrator<
+            TimeType, StateType, StateType, TimeStepType > > integrator,
+            TimeType& terminationTime,
+            StateType& terminationState )
+    {
+        bool isTerminatingEventDetected = false;
+
+        // Evaluate event functions at end of step
+        TimeType stepStartTime = integrator->getPreviousIndependentVariable( );
+        TimeType stepEndTime = integrator->getCurrentIndependentVariable( );
+        StateType stepEndState = integrator->getCurrentState( );
+        evaluateEventFunctions( stepEndTime, stepEndState, currentEventFunctionValues_ );
+
+        // Determine epochs of events that occurred in this step
+        std::vector< std::pair< double, int > > eventTimesInStep;
+        bool isStepInterpolationSet = false;
+        for( unsigned int i = 0; i < propagationEvents_.size( ); i++ )
+        {
+            if( propagationEvents_.at( i )->isEventCrossed(
+                        previousEventFunctionValues_.at( i ), currentEventFunctionValues_.at( i ) ) )
+            {
+                if( !isStepInterpolationSet )
+                {
+                    setStepInterpolation( integrator, stepStartTime, stepEndTime, stepEndState );
+                    isStepInterpolationSet = true;
+                }
+                eventTimesInStep.push_back(
+                            std::make_pair( static_cast< double >( findEventTimeInStep( i ) ), i ) );
+            }
+        }
+
+        // Log events in chronological order, up to first terminating event.
+        if( eventTimesInStep.size( ) > 0 )
+        {
+            std::sort( eventTimesInStep.begin( ), eventTimesInStep.end( ) );
+            for( unsigned int i = 0; i < eventTimesInStep.size( ); i++ )
+            {
+                TimeStepType timeSinceStepStart = static_cast< TimeStepType >( eventTimesInStep.at( i ).first );
+                std::shared_ptr< PropagationEvent > currentEvent = propagationEvents_.at( eventTimesInStep.at( i ).second );
+                StateType eventState = getInterpolatedState( timeSinceStepStart );
+                TimeType eventTime = stepStartTime + timeSinceStepStart;
+
+                eventHistory_.push_back( PropagationEventOccurrence(
+                                             currentEvent->getEventName( ), static_cast< double >( eventTime ),
+                                             getConventionalState( eventTime, eventState ),
+                                             currentEvent->getTerminatePropagation( ) ) );
+                if( currentEvent->getTerminatePropagation( ) )
+                {
+                    terminationTime = eventTime;
+                    terminationState = eventState;
+                    terminatingEventName_ = currentEvent->getEventName( );
+                    isTerminatingEventDetected = true;
+                    break;
+                }
+            }
+        }
+
+        previousEventFunctionValues_ = currentEventFunctionValues_;
+        return isTerminatingEventDetected;
+    }
+
+    //! Function to retrieve the history of event occurrences of the last propagation.
+    /*!
+     * Function to retrieve the history of event occurrences of the last propagation, in chronological order.
+     * \return History of event occurrences of the last propagation.
+     */
+    std::vector< PropagationEventOccurrence > getEventHistory( )
+    {
+        return eventHistory_;
+    }
+
+    //! Function to retrieve the name of the last event that terminated a propagation.
+    /*!
+     * Function to retrieve the name of the last event that terminated a propagation.
+     * \return Name of the last event that terminated a propagation.
+     */
+    std::string getTerminatingEventName( )
+    {
+        return terminatingEventName_;
+    }
+
+private:
+
+    //! Function to convert the propagated state to the conventional form, in which the event functions are defined.
+    Eigen::VectorXd getConventionalState( const TimeType time, const StateType& state )
+    {
+        if( conventionalStateFunction_ == nullptr )
+        {
+            return state.col( 0 ).template cast< double >( );
+        }
+        return conventionalStateFunction_( time, state );
+    }
+
+    //! Function to evaluate all event functions at a given time and (propagated) state.
+    void evaluateEventFunctions( const TimeType time, const StateType& state, std::vector< double >& eventFunctionValues )
+    {
+        if( propagationEvents_.size( ) > 0 )
+        {
+            Eigen::VectorXd conventionalState = getConventionalState( time, state );
+            for( unsigned int i = 0; i < propagationEvents_.size( ); i++ )
+            {
+                eventFunctionValues[ i ] = propagationEvents_.at( i )->evaluateEventFunction(
+                            static_cast< double >( time ), conventionalState );
+            }
+        }
+    }
+
+    //! Function to set the data needed for the interpolation of the state within the last step.
+    void setStepInterpolation(
+            const std::shared_ptr< numerical_integrators::NumericalIntegrator<
+            TimeType, StateType, StateType, TimeStepType > > integrator,
+            const TimeType stepStartTime, const TimeType stepEndTime, const StateType& stepEndState )
+    {
+        stepStartTime_ = stepStartTime;
+        stepSize_ = static_cast< TimeStepType >( stepEndTime - stepStartTime );
+        stepStartState_ = integrator->getPreviousState( );
+        stepEndState_ = stepEndState;
+
+        // Evaluate state derivatives if the integrator does not provide them (end of step is evaluated last, so that
+        // the environment is left at the end of the step).
+        if( !integrator->getLastStepBoundaryStateDerivatives( stepStartStateDerivative_, stepEndStateDerivative_ ) )
+        {
+            stepStartStateDerivative_ = integrator->getStateDerivativeFunction( )( stepStartTime, stepStartState_ );
+            stepEndStateDerivative_ = integrator->getStateDerivativeFunction( )( stepEndTime, stepEndState_ );
+        }
+    }
+
+    //! Function to compute the cubic Hermite interpolation of the state within the last step.
+    StateType getInterpolatedState( const TimeStepType timeSinceStepStart )
+    {
+        StateScalarType normalizedTime = static_cast< StateScalarType >( timeSinceStepStart / stepSize_ );
+        StateScalarType scaledStepSize = static_cast< StateScalarType >( stepSize_ );
+        StateScalarType normalizedTimeSquared = normalizedTime * normalizedTime;
+        StateScalarType normalizedTimeCubed = normalizedTimeSquared * normalizedTime;
+
+        return ( 2.0 * normalizedTimeCubed - 3.0 * normalizedTimeSquared + 1.0 ) * stepStartState_ +
+                ( normalizedTimeCubed - 2.0 * normalizedTimeSquared + normalizedTime ) * scaledStepSize *
+                stepStartStateDerivative_ +
+                ( -2.0 * normalizedTimeCubed + 3.0 * normalizedTimeSquared ) * stepEndState_ +
+                ( normalizedTimeCubed - normalizedTimeSquared ) * scaledStepSize * stepEndStateDerivative_;
+    }
+
+    //! Function to evaluate an event function on the interpolated state within the last step.
+    double getInterpolatedEventFunctionValue( const double timeSinceStepStart, const int eventIndex )
+    {
+        TimeStepType currentTimeSinceStepStart = static_cast< TimeStepType >( timeSinceStepStart );
+        TimeType currentTime = stepStartTime_ + currentTimeSinceStepStart;
+        return propagationEvents_.at( eventIndex )->evaluateEventFunction(
+                    static_cast< double >( currentTime ),
+                    getConventionalState( currentTime, getInterpolatedState( currentTimeSinceStepStart ) ) );
+    }
+
+    //! Function to determine the time (since the start of the last step) at which an event occurred in the last step.
+    double findEventTimeInStep( const int eventIndex )
+    {
+        double stepSize = static_cast< double >( stepSize_ );
+        if( currentEventFunctionValues_.at( eventIndex ) == 0.0 )
+        {
+            return stepSize;
+        }
+
+        std::function< double( double ) > eventFunctionInStep =
+                std::bind( &PropagationEventDetector< StateType, TimeType, TimeStepType >::getInterpolatedEventFunctionValue,
+                           this, std::placeholders::_1, eventIndex );
+
+        double eventTimeInStep;
+        try
+        {
+            std::shared_ptr< root_finders::RootFinderCore< double > > eventRootFinder =
+                    root_finders::createRootFinder< double >(
+                        propagationEvents_.at( eventIndex )->getRootFinderSettings( ),
+                        std::min( 0.0, stepSize ), std::max( 0.0, stepSize ), stepSize / 2.0 );
+            eventTimeInStep = eventRootFinder->execute(
+                        std::make_shared< basic_mathematics::FunctionProxy< double, double > >( eventFunctionInStep ),
+                        stepSize / 2.0 );
+        }
+        catch( std::runtime_error& caughtException )
+        {
+            // Use linear interpolation of event function if root finder failed
+            std::cerr << "Warning when determining epoch of event " << propagationEvents_.at( eventIndex )->getEventName( )
+                      << ", root finder failed, using linear interpolation. Caught exception: "
+                      << caughtException.what( ) << std::endl;
+            eventTimeInStep = stepSize * previousEventFunctionValues_.at( eventIndex ) /
+                    ( previousEventFunctionValues_.at( eventIndex ) - currentEventFunctionValues_.at( eventIndex ) );
+        }
+        return eventTimeInStep;
+    }
+
+    //! List of events that are to be detected.
+    std::vector< std::shared_ptr< PropagationEvent > > propagationEvents_;
+
+    //! Function converting the propagated state to the conventional form, in which the event functions are defined.
+    std::function< Eigen::VectorXd( const TimeType, const StateType& ) > conventionalStateFunction_;
+
+    //! Values of event functions at start of current step.
+    std::vector< double > previousEventFunctionValues_;
+
+    //! Values of event functions at end of current step.
+    std::vector< double > currentEventFunctionValues_;
+
+    //! History of event occurrences of the last propagation.
+    std::vector< PropagationEventOccurrence > eventHistory_;
+
+    //! Name of the last event that terminated a propagation.
+    std::string terminatingEventName_;
+
+    //! Time at start of step that is interpolated.
+    TimeType stepStartTime_;
+
+    //! Size of step that is interpolated.
+    TimeStepType stepSize_;
+
+    //! State at start of step that is interpolated.
+    StateType stepStartState_;
+
+    //! State at end of step that is interpolated.
+    StateType stepEndState_;
+
+    //! State derivative at start of step that is interpolated.
+    StateType stepStartStateDerivative_;
+
+    //! State derivative at end of step that is interpolated.
+    StateType stepEndStateDerivative_;
+};
+
+//! Function to create a propagation event from its settings.
+/*!
+ * Function to create a propagation event from its settings.
+ * \param eventSettings Settings for the event.
+ * \param bodyMap List of body objects, from which the environment models required by the event are retrieved.
+ * \param translationalStateIndices Start index in the (conventional) propagated state and central body of each body
+ * for which the translational state is propagated (body name as key).
+ * \return Propagation event.
+ */
+std::shared_ptr< PropagationEvent > createPropagationEvent(
+        const std::shared_ptr< PropagationEventSettings > eventSettings,
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::map< std::string, std::pair< int, std::string > >& translationalStateIndices );
+
+//! Function to create a list of propagation events from their settings.
+/*!
+ * Function to create a list of propagation events from their settings.
+ * \param eventSettings Settings for the events.
+ * \param bodyMap List of body objects, from which the environment models required by the events are retrieved.
+ * \param translationalStateIndices Start index in the (conventional) propagated state and central body of each body
+ * for which the translational state is propagated (body name as key).
+ * \return List of propagation events.
+ */
+std::vector< std::shared_ptr< PropagationEvent > > createPropagationEvents(
+        const std::vector< std::shared_ptr< PropagationEventSettings > >& eventSettings,
+        const simulation_setup::NamedBodyMap& bodyMap,
+        const std::map< std::string, std::pair< int, std::string > >& translationalStateIndices );
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_PROPAGATIONEVENTS_H
@@ -619,6 +619,7 @@ public:
         centralBodies_( centralBodies ),
         bodiesToIntegrate_( bodiesToIntegrate ),
         propagator_( propagator ),
+        useFixedSizeState_( false ), multiRateAccelerationSettings_( nullptr ),
         accelerationsMap_( accelerationsMap ) { }
 
     //! Constructor for generic stopping conditions, providing settings to create accelerations map.
@@ -653,6 +654,7 @@ public:
         centralBodies_( centralBodies ),
         bodiesToIntegrate_( bodiesToIntegrate ),
         propagator_( propagator ),
+        useFixedSizeState_( false ), multiRateAccelerationSettings_( nullptr ),
         accelerationSettingsMap_( accelerationSettingsMap ) { }
 
     //! Constructor for fixed propagation time stopping conditions, providing an alreay-created accelerations map.
@@ -688,6 +690,7 @@ public:
         centralBodies_( centralBodies ),
         bodiesToIntegrate_( bodiesToIntegrate ),
         propagator_( propagator ),
+        useFixedSizeState_( false ), multiRateAccelerationSettings_( nullptr ),
         accelerationsMap_( accelerationsMap ) { }
 
     //! Constructor for fixed propagation time stopping conditions, providing settings to create accelerations map.
@@ -723,6 +726,7 @@ public:
         centralBodies_( centralBodies ),
         bodiesToIntegrate_( bodiesToIntegrate ),
         propagator_( propagator ),
+        useFixedSizeState_( false ), multiRateAccelerationSettings_( nullptr ),
         accelerationSettingsMap_( accelerationSettingsMap ) { }
 
     //! Destructor
@@ -737,6 +741,24 @@ public:
     //! Type of translational state propagator to be used
     TranslationalPropagatorType propagator_;
 
+    //! Boolean denoting whether a fixed-size state vector is to be used in the numerical integration.
+    /*!
+     *  Boolean denoting whether a fixed-size state vector (Eigen::Matrix< StateScalarType, 6, 1 >, or 7 elements for the
+     *  unified state model propagators) is to be used in the numerical integration, instead of a dynamic-size vector. Only
+     *  the state arithmetic in the integrator is done on fixed-size vectors; the state derivative is still evaluated on
+     *  dynamic-size vectors, so this need not reduce the propagation time. It is only possible when a single body is
+     *  propagated (default false).
+     */
+    bool useFixedSizeState_;
+
+    //! Settings for multi-rate evaluation of the acceleration models.
+    /*!
+     *  Settings for multi-rate evaluation of the acceleration models, by which the expensive accelerations (e.g.
+     *  high-degree gravity, drag, radiation pressure) are fully evaluated at a reduced rate, and approximated in between
+     *  (see MultiRateAccelerationEvaluator). If nullptr (default), all accelerations are evaluated at each call.
+     */
+    std::shared_ptr< MultiRateAccelerationSettings > multiRateAccelerationSettings_;
+
     //! Function to create the acceleration models.
     /*!
      * Function to create the acceleration models.
@@ -844,7 +866,8 @@ public:
                                        const double printInterval = TUDAT_NAN ):
         SingleArcPropagatorSettings< StateScalarType >( rotational_state, initialBodyStates, terminationSettings,
                                                         dependentVariablesToSave, printInterval ),
-        bodiesToIntegrate_( bodiesToIntegrate ), propagator_( propagator ), torqueModelMap_( torqueModelMap ) { }
+        bodiesToIntegrate_( bodiesToIntegrate ), propagator_( propagator ), subCyclingSettings_( nullptr ),
+        torqueModelMap_( torqueModelMap ) { }
 
     //! Constructor with settings for torque models.
     /*!
@@ -870,7 +893,8 @@ public:
                                        const double printInterval = TUDAT_NAN ):
         SingleArcPropagatorSettings< StateScalarType >( rotational_state, initialBodyStates, terminationSettings,
                                                         dependentVariablesToSave, printInterval ),
-        bodiesToIntegrate_( bodiesToIntegrate ), propagator_( propagator ), torqueSettingsMap_( torqueSettingsMap ) { }
+        bodiesToIntegrate_( bodiesToIntegrate ), propagator_( propagator ), subCyclingSettings_( nullptr ),
+        torqueSettingsMap_( torqueSettingsMap ) { }
 
     //! Destructor
     ~RotationalStatePropagatorSettings( ){ }
@@ -881,6 +905,15 @@ public:
     //! Type of translational state propagator to be used
     RotationalPropagatorType propagator_;
 
+    //! Settings for sub-cycling the rotational dynamics inside the integration steps.
+    /*!
+     *  Settings for sub-cycling the rotational dynamics inside the integration steps, by which the rotational state is
+     *  integrated with a finer internal step inside each step of the numerical integrator (see
+     *  RotationalSubCyclingSettings). If nullptr (default), the rotational state is integrated directly by the
+     *  numerical integrator.
+     */
+    std::shared_ptr< RotationalSubCyclingSettings > subCyclingSettings_;
+
     //! Function to create the torque models.
     /*!
      * Function to create the torque models.
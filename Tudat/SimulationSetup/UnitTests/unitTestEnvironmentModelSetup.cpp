@@ -28,6 +28,7 @@
 #include "Tudat/Astrodynamics/BasicAstrodynamics/unitConversions.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/geodeticCoordinateConversions.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/simpleRotationalEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
@@ -290,6 +291,50 @@ BOOST_AUTO_TEST_CASE( test_ephemerisSetup )
                     std::numeric_limits< double >::epsilon( ) );
     }
 
+    {
+        // Create Chebyshev spice ephemeris
+        double initialTime = 1.0E7 - 5.0 * 86400.0;
+        double finalTime = 1.0E7 + 5.0 * 86400.0;
+        std::shared_ptr< EphemerisSettings > chebyshevEphemerisSettings =
+                std::make_shared< ChebyshevSpiceEphemerisSettings >(
+                    initialTime, finalTime, 43200.0, 12, "Earth", "J2000" );
+        std::shared_ptr< ephemerides::Ephemeris > chebyshevEphemeris =
+                createBodyEphemeris( chebyshevEphemerisSettings, "Moon" );
+        BOOST_CHECK( std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( chebyshevEphemeris ) != nullptr );
+
+        // Manually create Chebyshev spice ephemeris
+        std::shared_ptr< ephemerides::Ephemeris > manualChebyshevEphemeris =
+                createChebyshevEphemerisFromSpice( "Moon", initialTime, finalTime, 43200.0, 12, "Earth", "J2000" );
+
+        // Compare Chebyshev ephemerides against direct spice state, at boundaries of interval and away from node points.
+        std::vector< double > testTimes = { initialTime, 1.0E7 - 12345.6, 1.0E7, 1.0E7 + 110.0, 1.0E7 + 43200.0, finalTime };
+        for( unsigned int i = 0; i < testTimes.size( ); i++ )
+        {
+            Eigen::Vector6d spiceState = spice_interface::getBodyCartesianStateAtEpoch(
+                        "Moon", "Earth", "J2000", "None", testTimes.at( i ) );
+            Eigen::Vector6d chebyshevState = chebyshevEphemeris->getCartesianState( testTimes.at( i ) );
+
+            BOOST_CHECK_SMALL( ( chebyshevState.segment( 0, 3 ) - spiceState.segment( 0, 3 ) ).norm( ), 1.0E-3 );
+            BOOST_CHECK_SMALL( ( chebyshevState.segment( 3, 3 ) - spiceState.segment( 3, 3 ) ).norm( ), 1.0E-6 );
+            TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                        ( chebyshevState ), ( manualChebyshevEphemeris->getCartesianState( testTimes.at( i ) ) ),
+                        std::numeric_limits< double >::epsilon( ) );
+        }
+
+        // Check that default settings use Chebyshev ephemeris if requested, and compare against direct spice state.
+        std::shared_ptr< ephemerides::Ephemeris > defaultChebyshevEphemeris =
+                createBodyEphemeris( getDefaultEphemerisSettings( "Earth", initialTime, finalTime, 300.0, true ), "Earth" );
+        BOOST_CHECK( std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( defaultChebyshevEphemeris ) != nullptr );
+        BOOST_CHECK_SMALL( ( defaultChebyshevEphemeris->getCartesianState( 1.0E7 + 110.0 ).segment( 0, 3 ) -
+                             spice_interface::getBodyCartesianStateAtEpoch(
+                                 "Earth", "SSB", "ECLIPJ2000", "None", 1.0E7 + 110.0 ).segment( 0, 3 ) ).norm( ), 1.0E-3 );
+
+        // Check that insufficiently accurate Chebyshev ephemeris is rejected.
+        BOOST_CHECK_THROW( createBodyEphemeris( std::make_shared< ChebyshevSpiceEphemerisSettings >(
+                                                    initialTime, finalTime, 5.0 * 86400.0, 3, "Earth", "J2000" ), "Moon" ),
+                           std::runtime_error );
+    }
+
 
 }
 #endif